@@ -0,0 +1,176 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <parser.h>
+#include <profile.h>
+#include <visit.h>
+
+// Parse benchmark
+//
+// Parses every file given a number of times with one reused parser and
+// reports, per file and for the whole corpus, the median parse throughput,
+// AST nodes parsed per second and AST allocations per KB of input.
+//
+// make bench runs it over bench/corpus, which has one file per kind of
+// input: expr.c is expression heavy function bodies, decl.c top-level
+// declarations, nested.c deeply nested statements and parentheses, and
+// lists.c long initializer, argument and enumerator lists.
+
+typedef struct {
+    const char *path;
+    char *text;
+    int len;
+    long nodes;
+    long allocs;
+    double *times;
+} bench_file;
+
+int compare_double(const void *a, const void *b) {
+    double x = *(const double *) a;
+    double y = *(const double *) b;
+    return x < y ? -1 : x > y;
+}
+
+double median(double *values, int len) {
+    double *sorted = malloc(sizeof(double) * len);
+    memcpy(sorted, values, sizeof(double) * len);
+    qsort(sorted, len, sizeof(double), compare_double);
+
+    double res = len % 2 ? sorted[len / 2] : (sorted[len / 2 - 1] + sorted[len / 2]) / 2;
+    free(sorted);
+    return res;
+}
+
+double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int read_file(const char *path, char **buf, int *len) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return 1;
+    }
+
+    fseek(file, 0, SEEK_END);
+    *len = ftell(file);
+    rewind(file);
+
+    *buf = malloc(*len + 1);
+    int res = fread(*buf, 1, *len, file) != (size_t) *len;
+    fclose(file);
+    return res;
+}
+
+ciwic_visit_result count_node(void *data, ciwic_node_kind kind, void *node) {
+    (*(long *) data)++;
+    return ciwic_visit_continue;
+}
+
+int parse(ciwic_parser *parser, bench_file *file, ciwic_translation_unit *translation_unit) {
+    ciwic_parser_reset(parser, file->text, file->len);
+    return ciwic_parser_translation_unit(parser, translation_unit)
+        || (ciwic_parser_whitespace(parser), parser->pos != file->len);
+}
+
+void report(const char *name, double bytes, double nodes, double allocs, double seconds) {
+    printf("%-24s %10.0f %10.3f %10.2f %12.0f %10.1f\n", name, bytes / 1024, seconds * 1000,
+        bytes / seconds / 1e6, nodes / seconds, allocs / (bytes / 1024));
+}
+
+int main(int argc, char **argv) {
+    int runs = 11;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:")) != -1) {
+        if (opt != 'n') {
+            fprintf(stderr, "Usage: %s [-n runs] file...\n", argv[0]);
+            return 2;
+        }
+        runs = atoi(optarg);
+    }
+
+    int files_len = argc - optind;
+    if (files_len == 0 || runs < 1) {
+        fprintf(stderr, "Usage: %s [-n runs] file...\n", argv[0]);
+        return 2;
+    }
+
+    bench_file *files = malloc(sizeof(bench_file) * files_len);
+    ciwic_parser parser = ciwic_parser_new(NULL, 0);
+    ciwic_translation_unit translation_unit;
+    ciwic_visitor visitor;
+    ciwic_profile profile;
+
+    for (int i = 0; i < files_len; i++) {
+        bench_file *file = &files[i];
+        file->path = argv[optind + i];
+        file->nodes = 0;
+        file->times = malloc(sizeof(double) * runs);
+
+        if (read_file(file->path, &file->text, &file->len)) {
+            fprintf(stderr, "Error: could not read %s\n", file->path);
+            return 1;
+        }
+
+        // One untimed parse to count nodes and allocations, which also
+        // warms up the parser's buffers
+        ciwic_profile_init(&profile);
+        parser.profile = &profile;
+
+        if (parse(&parser, file, &translation_unit)) {
+            fprintf(stderr, "Error: could not parse %s\n", file->path);
+            return 1;
+        }
+
+        parser.profile = NULL;
+        file->allocs = 0;
+        for (int kind = 0; kind < CIWIC_ALLOC_KINDS; kind++) {
+            file->allocs += profile.allocs[kind].count;
+        }
+
+        ciwic_visitor_init(&visitor, &file->nodes);
+        for (int kind = 0; kind < ciwic_node_kind_count; kind++) {
+            visitor.pre[kind] = count_node;
+        }
+        ciwic_visit_translation_unit(&visitor, &translation_unit);
+        ciwic_visitor_free(&visitor);
+    }
+
+    // Files are interleaved within each run so drift affects them alike
+    double *totals = malloc(sizeof(double) * runs);
+
+    for (int run = 0; run < runs; run++) {
+        totals[run] = 0;
+        for (int i = 0; i < files_len; i++) {
+            double start = now();
+            parse(&parser, &files[i], &translation_unit);
+            files[i].times[run] = now() - start;
+            totals[run] += files[i].times[run];
+        }
+    }
+
+    printf("%-24s %10s %10s %10s %12s %10s\n", "file", "KB", "median ms", "MB/s", "nodes/s", "allocs/KB");
+
+    double bytes = 0, nodes = 0, allocs = 0;
+
+    for (int i = 0; i < files_len; i++) {
+        bench_file *file = &files[i];
+        const char *name = strrchr(file->path, '/');
+        report(name != NULL ? name + 1 : file->path, file->len, file->nodes, file->allocs, median(file->times, runs));
+
+        bytes += file->len;
+        nodes += file->nodes;
+        allocs += file->allocs;
+    }
+
+    report("total", bytes, nodes, allocs, median(totals, runs));
+    printf("%d runs\n", runs);
+
+    ciwic_parser_free(&parser);
+    return 0;
+}
@@ -0,0 +1,233 @@
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+// Frontend comparison
+//
+// Runs the ciwic command line tool, gcc -fsyntax-only and tcc over the same
+// files, each as its own process, and reports per file the median wall time,
+// throughput and peak RSS of every frontend, and its time relative to ciwic.
+// A frontend that is not installed is left out.
+//
+// make compare runs it over bench/valid, preprocessed files that are valid C
+// and in the subset ciwic parses, so neither side spends its time on errors.
+// ciwic is built with the CFLAGS of the makefile, so build it with
+// make CFLAGS="-Wall -O2" to compare optimized frontends.
+
+#define COMPARE_EXEC_FAILED 127
+
+typedef struct {
+    const char *name;
+    // argv of the frontend, the file is appended
+    const char *argv[8];
+    int missing;
+} frontend;
+
+// The first frontend is ciwic, argv[0] is set from -c. tcc has no syntax only
+// mode, so it also generates code, which is a small part of its time.
+frontend frontends[] = {
+    { "ciwic", { NULL } },
+    { "gcc", { "gcc", "-fsyntax-only", "-w", "-x", "c" } },
+    { "tcc", { "tcc", "-w", "-c", "-o", "/dev/null" } },
+};
+
+#define FRONTEND_COUNT ((int) (sizeof(frontends) / sizeof(frontends[0])))
+
+typedef struct {
+    double *times;
+    long rss; // Peak resident set size in KB
+    int failed; // Set if the frontend rejected the file
+} measurement;
+
+int compare_double(const void *a, const void *b) {
+    double x = *(const double *) a;
+    double y = *(const double *) b;
+    return x < y ? -1 : x > y;
+}
+
+double median(double *values, int len) {
+    double *sorted = malloc(sizeof(double) * len);
+    memcpy(sorted, values, sizeof(double) * len);
+    qsort(sorted, len, sizeof(double), compare_double);
+
+    double res = len % 2 ? sorted[len / 2] : (sorted[len / 2 - 1] + sorted[len / 2]) / 2;
+    free(sorted);
+    return res;
+}
+
+double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Runs fe on path with its output discarded. Returns the exit status, or -1
+// if the process could not be started or was killed.
+int run(frontend *fe, const char *path, double *time, long *rss) {
+    const char *argv[10];
+    int argc = 0;
+
+    while (fe->argv[argc] != NULL) {
+        argv[argc] = fe->argv[argc];
+        argc++;
+    }
+    argv[argc++] = path;
+    argv[argc] = NULL;
+
+    double start = now();
+    pid_t pid = fork();
+
+    if (pid == 0) {
+        int null = open("/dev/null", O_WRONLY);
+        dup2(null, STDOUT_FILENO);
+        dup2(null, STDERR_FILENO);
+        execvp(argv[0], (char **) argv);
+        _exit(COMPARE_EXEC_FAILED);
+    }
+
+    if (pid < 0) {
+        return -1;
+    }
+
+    // The usage of a process includes the children it waited for, so the
+    // peak RSS of gcc is that of cc1 rather than of the driver
+    int status;
+    struct rusage usage;
+    if (wait4(pid, &status, 0, &usage) != pid) {
+        return -1;
+    }
+
+    *time = now() - start;
+    *rss = usage.ru_maxrss;
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+void report(const char *name, double bytes, const char *frontend, double seconds, long rss, double relative, int failed) {
+    printf("%-16s %8.0f %-8s %10.2f %8.2f %8.1f %10.2f%s\n", name, bytes / 1024, frontend, seconds * 1000,
+        bytes / seconds / 1e6, rss / 1024.0, relative, failed ? "  rejected" : "");
+}
+
+int main(int argc, char **argv) {
+    int runs = 5;
+    int opt;
+
+    frontends[0].argv[0] = "target/main";
+
+    while ((opt = getopt(argc, argv, "n:c:")) != -1) {
+        if (opt == 'n') {
+            runs = atoi(optarg);
+        } else if (opt == 'c') {
+            frontends[0].argv[0] = optarg;
+        } else {
+            fprintf(stderr, "Usage: %s [-n runs] [-c ciwic] file...\n", argv[0]);
+            return 2;
+        }
+    }
+
+    int files_len = argc - optind;
+    if (files_len == 0 || runs < 1) {
+        fprintf(stderr, "Usage: %s [-n runs] [-c ciwic] file...\n", argv[0]);
+        return 2;
+    }
+
+    measurement *results = malloc(sizeof(measurement) * files_len * FRONTEND_COUNT);
+    long *sizes = malloc(sizeof(long) * files_len);
+
+    for (int i = 0; i < files_len; i++) {
+        struct stat st;
+        if (stat(argv[optind + i], &st)) {
+            fprintf(stderr, "Error: could not read %s\n", argv[optind + i]);
+            return 1;
+        }
+        sizes[i] = st.st_size;
+
+        for (int f = 0; f < FRONTEND_COUNT; f++) {
+            measurement *m = &results[i * FRONTEND_COUNT + f];
+            m->times = malloc(sizeof(double) * runs);
+            m->rss = 0;
+            m->failed = 0;
+        }
+    }
+
+    // Frontends and files are interleaved within each run so drift affects
+    // them alike
+    for (int run_index = 0; run_index < runs; run_index++) {
+        for (int i = 0; i < files_len; i++) {
+            for (int f = 0; f < FRONTEND_COUNT; f++) {
+                frontend *fe = &frontends[f];
+                measurement *m = &results[i * FRONTEND_COUNT + f];
+                if (fe->missing) {
+                    continue;
+                }
+
+                long rss;
+                int status = run(fe, argv[optind + i], &m->times[run_index], &rss);
+                if (status == COMPARE_EXEC_FAILED) {
+                    fe->missing = 1;
+                    continue;
+                }
+
+                m->failed |= status != 0;
+                if (rss > m->rss) {
+                    m->rss = rss;
+                }
+            }
+        }
+    }
+
+    if (frontends[0].missing) {
+        fprintf(stderr, "Error: could not run %s\n", frontends[0].argv[0]);
+        return 1;
+    }
+
+    printf("%-16s %8s %-8s %10s %8s %8s %10s\n", "file", "KB", "frontend", "median ms", "MB/s", "RSS MB", "vs ciwic");
+
+    double bytes = 0;
+    double totals[FRONTEND_COUNT] = { 0 };
+    long peaks[FRONTEND_COUNT] = { 0 };
+    int failed[FRONTEND_COUNT] = { 0 };
+
+    for (int i = 0; i < files_len; i++) {
+        const char *path = argv[optind + i];
+        const char *name = strrchr(path, '/');
+        name = name != NULL ? name + 1 : path;
+
+        double ciwic = median(results[i * FRONTEND_COUNT].times, runs);
+
+        for (int f = 0; f < FRONTEND_COUNT; f++) {
+            measurement *m = &results[i * FRONTEND_COUNT + f];
+            if (frontends[f].missing) {
+                continue;
+            }
+
+            double time = median(m->times, runs);
+            report(f == 0 ? name : "", sizes[i], frontends[f].name, time, m->rss, time / ciwic, m->failed);
+
+            totals[f] += time;
+            peaks[f] = m->rss > peaks[f] ? m->rss : peaks[f];
+            failed[f] |= m->failed;
+        }
+
+        bytes += sizes[i];
+    }
+
+    int res = 0;
+
+    for (int f = 0; f < FRONTEND_COUNT; f++) {
+        if (frontends[f].missing) {
+            printf("%-16s %8s %-8s not installed\n", "", "", frontends[f].name);
+            continue;
+        }
+        report(f == 0 ? "total" : "", bytes, frontends[f].name, totals[f], peaks[f], totals[f] / totals[0], failed[f]);
+        res |= failed[f];
+    }
+
+    printf("%d runs\n", runs);
+    return res;
+}
@@ -0,0 +1,568 @@
+struct s0 {
+    int **f0;
+    signed char f1;
+    float f2;
+    signed char **f3;
+    int f4;
+} s0_default, *s0_list;
+struct s1 {
+    const char **f0;
+    int f1;
+    long **f2;
+    char **f3;
+    const char **f4;
+    unsigned int *f5;
+    double *f6;
+    long *f7;
+} s1_default, *s1_list;
+static unsigned int (*handler2)(int, double *);
+static const float *const v3 = 0, w3 = 79;
+struct s4 {
+    unsigned long long *f0;
+    float *f1;
+    char f2;
+    unsigned int **f3;
+    const char f4;
+} s4_default, *s4_list;
+const char table5[59][7];
+enum { E6_0 = 0, E6_1 = 4, E6_2 = 8, E6_3 = 12, E6_4 = 16, E6_5 = 20, E6_6 = 24, E6_7 = 28 } e6;
+extern const char fn7(unsigned int x2);
+static const const char *const v8 = 0, w8 = 8;
+union u9 { int i; float f; struct { short lo; short hi; } parts; } uv9;
+extern unsigned int fn10(float p_tmp, signed char vx);
+struct s11 {
+    unsigned int **f0;
+    const char f1;
+    signed char f2;
+    long *f3;
+    short **f4;
+} s11_default, *s11_list;
+static const int *const v12 = 0, w12 = 66;
+static const int *const v13 = 0, w13 = 25;
+union u14 { int i; float f; struct { short lo; short hi; } parts; } uv14;
+enum { E15_0 = 0, E15_1 = 4, E15_2 = 8, E15_3 = 12, E15_4 = 16, E15_5 = 20, E15_6 = 24 } e15;
+struct s16 {
+    short *f0;
+    long f1;
+} s16_default, *s16_list;
+union u17 { int i; float f; struct { short lo; short hi; } parts; } uv17;
+static float (*handler18)(int, char *);
+static const double *const v19 = 0, w19 = 48;
+static const long *const v20 = 0, w20 = 49;
+static const char *const v21 = 0, w21 = 48;
+enum { E22_0 = 0, E22_1 = 4, E22_2 = 8, E22_3 = 12, E22_4 = 16, E22_5 = 20, E22_6 = 24, E22_7 = 28 } e22;
+struct s23 {
+    int f0;
+    unsigned int *f1;
+} s23_default, *s23_list;
+union u24 { int i; float f; struct { short lo; short hi; } parts; } uv24;
+extern char fn25(signed char *bcount, unsigned long long *qcount, char *v, unsigned long long xlen, short *b_tmp);
+static const float *const v26 = 0, w26 = 62;
+struct s27 {
+    const char *f0;
+    short **f1;
+    int f2;
+    long **f3;
+    signed char **f4;
+    unsigned long long f5;
+    const char *f6;
+} s27_default, *s27_list;
+enum { E28_0 = 0, E28_1 = 4 } e28;
+struct s29 {
+    float **f0;
+    short f1;
+    signed char f2;
+    float f3;
+    signed char *f4;
+    int *f5;
+    long f6;
+} s29_default, *s29_list;
+struct s30 {
+    signed char f0;
+    double *f1;
+    short **f2;
+    long *f3;
+} s30_default, *s30_list;
+struct s31 {
+    const char f0;
+    char *f1;
+    const char *f2;
+} s31_default, *s31_list;
+signed char table32[11][8];
+double table33[35][4];
+short table34[62][7];
+short table35[24][2];
+enum { E36_0 = 0, E36_1 = 4, E36_2 = 8, E36_3 = 12, E36_4 = 16, E36_5 = 20, E36_6 = 24, E36_7 = 28 } e36;
+enum { E37_0 = 0, E37_1 = 4, E37_2 = 8, E37_3 = 12 } e37;
+union u38 { int i; float f; struct { short lo; short hi; } parts; } uv38;
+static const unsigned int *const v39 = 0, w39 = 100;
+static int (*handler40)(int, const char *);
+union u41 { int i; float f; struct { short lo; short hi; } parts; } uv41;
+unsigned int table42[25][6];
+struct s43 {
+    float f0;
+    long **f1;
+    unsigned long long *f2;
+    const char *f3;
+    char **f4;
+    short *f5;
+    long f6;
+    const char *f7;
+} s43_default, *s43_list;
+static const char (*handler44)(int, const char *);
+extern unsigned long long fn45(const char h2);
+union u46 { int i; float f; struct { short lo; short hi; } parts; } uv46;
+static const double *const v47 = 0, w47 = 80;
+struct s48 {
+    const char f0;
+    long *f1;
+    unsigned int **f2;
+} s48_default, *s48_list;
+static unsigned long long (*handler49)(int, int *);
+enum { E50_0 = 0, E50_1 = 4, E50_2 = 8, E50_3 = 12, E50_4 = 16 } e50;
+enum { E51_0 = 0, E51_1 = 4, E51_2 = 8, E51_3 = 12 } e51;
+union u52 { int i; float f; struct { short lo; short hi; } parts; } uv52;
+enum { E53_0 = 0, E53_1 = 4, E53_2 = 8, E53_3 = 12, E53_4 = 16, E53_5 = 20, E53_6 = 24 } e53;
+struct s54 {
+    unsigned long long *f0;
+    double *f1;
+} s54_default, *s54_list;
+enum { E55_0 = 0, E55_1 = 4, E55_2 = 8, E55_3 = 12, E55_4 = 16, E55_5 = 20, E55_6 = 24, E55_7 = 28 } e55;
+char table56[51][6];
+extern unsigned int fn57(const char hcount, long cptr);
+static const long *const v58 = 0, w58 = 27;
+struct s59 {
+    char *f0;
+    short *f1;
+    char f2;
+    int **f3;
+    long *f4;
+    char *f5;
+    int f6;
+    short **f7;
+} s59_default, *s59_list;
+enum { E60_0 = 0, E60_1 = 4, E60_2 = 8, E60_3 = 12, E60_4 = 16, E60_5 = 20 } e60;
+short table61[51][7];
+extern double fn62(char *bcount, char dptr, long *bx, char *b_tmp);
+struct s63 {
+    short f0;
+    signed char **f1;
+    int *f2;
+    const char *f3;
+} s63_default, *s63_list;
+long table64[56][6];
+static long (*handler65)(int, signed char *);
+const char table66[22][4];
+static const unsigned int *const v67 = 0, w67 = 42;
+union u68 { int i; float f; struct { short lo; short hi; } parts; } uv68;
+extern float fn69(long *r2, signed char elen, long *pptr, float *ucount, unsigned long long h_tmp);
+struct s70 {
+    short *f0;
+    signed char *f1;
+    short **f2;
+    char f3;
+    char **f4;
+    double f5;
+    signed char *f6;
+} s70_default, *s70_list;
+extern signed char fn71(unsigned int *t, signed char h2, short *w_tmp);
+static int (*handler72)(int, unsigned long long *);
+static const float *const v73 = 0, w73 = 63;
+union u74 { int i; float f; struct { short lo; short hi; } parts; } uv74;
+union u75 { int i; float f; struct { short lo; short hi; } parts; } uv75;
+enum { E76_0 = 0, E76_1 = 4, E76_2 = 8, E76_3 = 12, E76_4 = 16 } e76;
+enum { E77_0 = 0, E77_1 = 4, E77_2 = 8, E77_3 = 12, E77_4 = 16, E77_5 = 20, E77_6 = 24 } e77;
+enum { E78_0 = 0, E78_1 = 4, E78_2 = 8, E78_3 = 12, E78_4 = 16, E78_5 = 20, E78_6 = 24, E78_7 = 28 } e78;
+enum { E79_0 = 0, E79_1 = 4, E79_2 = 8, E79_3 = 12, E79_4 = 16, E79_5 = 20 } e79;
+enum { E80_0 = 0, E80_1 = 4, E80_2 = 8, E80_3 = 12, E80_4 = 16, E80_5 = 20, E80_6 = 24, E80_7 = 28, E80_8 = 32 } e80;
+struct s81 {
+    float *f0;
+    const char *f1;
+    long **f2;
+    short *f3;
+    unsigned long long **f4;
+    const char *f5;
+} s81_default, *s81_list;
+union u82 { int i; float f; struct { short lo; short hi; } parts; } uv82;
+static const unsigned int *const v83 = 0, w83 = 28;
+extern float fn84(long tcount);
+enum { E85_0 = 0, E85_1 = 4, E85_2 = 8, E85_3 = 12, E85_4 = 16, E85_5 = 20, E85_6 = 24, E85_7 = 28, E85_8 = 32 } e85;
+union u86 { int i; float f; struct { short lo; short hi; } parts; } uv86;
+struct s87 {
+    double *f0;
+    int **f1;
+    short *f2;
+    int *f3;
+    unsigned long long f4;
+    long f5;
+} s87_default, *s87_list;
+union u88 { int i; float f; struct { short lo; short hi; } parts; } uv88;
+static double (*handler89)(int, signed char *);
+struct s90 {
+    long *f0;
+    short *f1;
+    unsigned int **f2;
+    char *f3;
+    long f4;
+    int *f5;
+    unsigned int *f6;
+    unsigned int *f7;
+} s90_default, *s90_list;
+union u91 { int i; float f; struct { short lo; short hi; } parts; } uv91;
+extern unsigned int fn92(const char *m2, float *r, long *sx, unsigned long long *vx);
+static const short *const v93 = 0, w93 = 90;
+float table94[53][6];
+int table95[15][5];
+enum { E96_0 = 0, E96_1 = 4, E96_2 = 8, E96_3 = 12, E96_4 = 16 } e96;
+union u97 { int i; float f; struct { short lo; short hi; } parts; } uv97;
+union u98 { int i; float f; struct { short lo; short hi; } parts; } uv98;
+static const char *const v99 = 0, w99 = 14;
+struct s100 {
+    signed char f0;
+    long f1;
+    signed char f2;
+    short **f3;
+    unsigned int **f4;
+    double **f5;
+    float *f6;
+} s100_default, *s100_list;
+unsigned long long table101[11][6];
+enum { E102_0 = 0, E102_1 = 4, E102_2 = 8, E102_3 = 12, E102_4 = 16, E102_5 = 20, E102_6 = 24, E102_7 = 28 } e102;
+union u103 { int i; float f; struct { short lo; short hi; } parts; } uv103;
+union u104 { int i; float f; struct { short lo; short hi; } parts; } uv104;
+enum { E105_0 = 0, E105_1 = 4, E105_2 = 8 } e105;
+struct s106 {
+    int f0;
+    int f1;
+    unsigned int **f2;
+    short **f3;
+    double f4;
+} s106_default, *s106_list;
+extern int fn107(const char ax, short c, char mx, short q_tmp, char n2);
+static long (*handler108)(int, double *);
+static const const char *const v109 = 0, w109 = 77;
+static short (*handler110)(int, const char *);
+static const long *const v111 = 0, w111 = 50;
+static const char *const v112 = 0, w112 = 83;
+enum { E113_0 = 0, E113_1 = 4, E113_2 = 8 } e113;
+short table114[22][3];
+union u115 { int i; float f; struct { short lo; short hi; } parts; } uv115;
+struct s116 {
+    char f0;
+    float f1;
+    char **f2;
+    short *f3;
+    float f4;
+} s116_default, *s116_list;
+struct s117 {
+    unsigned long long **f0;
+    int f1;
+    unsigned int **f2;
+    short *f3;
+    const char f4;
+    unsigned long long f5;
+    char f6;
+    double f7;
+} s117_default, *s117_list;
+extern int fn118(float *n2, signed char *b2, unsigned long long n2);
+static const char (*handler119)(int, int *);
+short table120[43][2];
+static short (*handler121)(int, long *);
+extern double fn122(double *t2);
+static const long *const v123 = 0, w123 = 81;
+unsigned long long table124[42][8];
+struct s125 {
+    float *f0;
+    char f1;
+} s125_default, *s125_list;
+short table126[11][3];
+enum { E127_0 = 0, E127_1 = 4, E127_2 = 8, E127_3 = 12, E127_4 = 16, E127_5 = 20, E127_6 = 24, E127_7 = 28, E127_8 = 32, E127_9 = 36 } e127;
+extern short fn128(long *hptr, char wlen);
+extern long fn129(char *hlen, long m, short m_tmp, int h_tmp, unsigned long long *k);
+extern float fn130(unsigned long long *dcount, unsigned int n2);
+struct s131 {
+    char f0;
+    const char *f1;
+} s131_default, *s131_list;
+long table132[30][8];
+union u133 { int i; float f; struct { short lo; short hi; } parts; } uv133;
+enum { E134_0 = 0, E134_1 = 4, E134_2 = 8, E134_3 = 12, E134_4 = 16 } e134;
+extern int fn135(long *q_tmp, unsigned long long nx, unsigned int *s2);
+enum { E136_0 = 0, E136_1 = 4, E136_2 = 8, E136_3 = 12, E136_4 = 16 } e136;
+static float (*handler137)(int, long *);
+extern long fn138(unsigned int q, long qcount, const char *kcount, long e);
+struct s139 {
+    unsigned long long *f0;
+    unsigned long long *f1;
+    long f2;
+    const char **f3;
+    signed char **f4;
+    double *f5;
+} s139_default, *s139_list;
+static const int *const v140 = 0, w140 = 12;
+enum { E141_0 = 0, E141_1 = 4 } e141;
+struct s142 {
+    int *f0;
+    const char **f1;
+    unsigned int *f2;
+} s142_default, *s142_list;
+struct s143 {
+    signed char *f0;
+    int **f1;
+    char **f2;
+    int **f3;
+} s143_default, *s143_list;
+static const unsigned long long *const v144 = 0, w144 = 79;
+extern float fn145(short *tcount, double kcount, int qcount, unsigned int *scount);
+static short (*handler146)(int, float *);
+union u147 { int i; float f; struct { short lo; short hi; } parts; } uv147;
+short table148[54][7];
+static const signed char *const v149 = 0, w149 = 82;
+static char (*handler150)(int, float *);
+extern const char fn151(int wptr, const char *tx, short d);
+static unsigned long long (*handler152)(int, unsigned long long *);
+enum { E153_0 = 0, E153_1 = 4, E153_2 = 8, E153_3 = 12, E153_4 = 16, E153_5 = 20, E153_6 = 24, E153_7 = 28 } e153;
+enum { E154_0 = 0, E154_1 = 4, E154_2 = 8, E154_3 = 12, E154_4 = 16, E154_5 = 20, E154_6 = 24, E154_7 = 28 } e154;
+enum { E155_0 = 0, E155_1 = 4, E155_2 = 8, E155_3 = 12, E155_4 = 16, E155_5 = 20 } e155;
+struct s156 {
+    unsigned long long **f0;
+    unsigned int *f1;
+    const char f2;
+    float *f3;
+    short **f4;
+} s156_default, *s156_list;
+union u157 { int i; float f; struct { short lo; short hi; } parts; } uv157;
+struct s158 {
+    double **f0;
+    short f1;
+    unsigned long long f2;
+    unsigned long long **f3;
+    float f4;
+    char **f5;
+} s158_default, *s158_list;
+enum { E159_0 = 0, E159_1 = 4, E159_2 = 8 } e159;
+extern long fn160(void);
+enum { E161_0 = 0, E161_1 = 4, E161_2 = 8 } e161;
+extern short fn162(const char h_tmp, double *d_tmp, unsigned long long *k2);
+union u163 { int i; float f; struct { short lo; short hi; } parts; } uv163;
+int table164[1][6];
+signed char table165[60][7];
+static const int *const v166 = 0, w166 = 80;
+static long (*handler167)(int, short *);
+union u168 { int i; float f; struct { short lo; short hi; } parts; } uv168;
+long table169[22][6];
+enum { E170_0 = 0, E170_1 = 4, E170_2 = 8, E170_3 = 12, E170_4 = 16 } e170;
+union u171 { int i; float f; struct { short lo; short hi; } parts; } uv171;
+extern unsigned int fn172(short *xcount, const char *f_tmp, short x, int *tlen, long b);
+enum { E173_0 = 0, E173_1 = 4 } e173;
+enum { E174_0 = 0, E174_1 = 4, E174_2 = 8, E174_3 = 12, E174_4 = 16, E174_5 = 20, E174_6 = 24, E174_7 = 28, E174_8 = 32, E174_9 = 36 } e174;
+static const signed char *const v175 = 0, w175 = 80;
+enum { E176_0 = 0, E176_1 = 4, E176_2 = 8, E176_3 = 12, E176_4 = 16, E176_5 = 20 } e176;
+struct s177 {
+    const char *f0;
+    signed char f1;
+    long *f2;
+} s177_default, *s177_list;
+signed char table178[37][4];
+extern signed char fn179(int *qptr, short t, int h2);
+int table180[7][8];
+extern unsigned long long fn181(short kcount, double *kx, unsigned long long *zlen);
+static const long *const v182 = 0, w182 = 94;
+union u183 { int i; float f; struct { short lo; short hi; } parts; } uv183;
+extern long fn184(unsigned int hlen, float tcount, unsigned long long hptr, double *b);
+extern unsigned long long fn185(void);
+extern unsigned long long fn186(char zptr, float *y2);
+static const unsigned int *const v187 = 0, w187 = 38;
+static float (*handler188)(int, float *);
+static char (*handler189)(int, short *);
+static long (*handler190)(int, char *);
+static double (*handler191)(int, double *);
+static unsigned int (*handler192)(int, double *);
+struct s193 {
+    const char **f0;
+    char *f1;
+    char f2;
+    long *f3;
+} s193_default, *s193_list;
+static const char (*handler194)(int, int *);
+unsigned long long table195[22][4];
+enum { E196_0 = 0, E196_1 = 4, E196_2 = 8, E196_3 = 12, E196_4 = 16, E196_5 = 20, E196_6 = 24, E196_7 = 28, E196_8 = 32, E196_9 = 36 } e196;
+static int (*handler197)(int, int *);
+union u198 { int i; float f; struct { short lo; short hi; } parts; } uv198;
+static unsigned long long (*handler199)(int, char *);
+static const char (*handler200)(int, double *);
+struct s201 {
+    long **f0;
+    unsigned int f1;
+    double *f2;
+} s201_default, *s201_list;
+signed char table202[10][2];
+char table203[29][6];
+enum { E204_0 = 0, E204_1 = 4, E204_2 = 8, E204_3 = 12, E204_4 = 16, E204_5 = 20, E204_6 = 24, E204_7 = 28, E204_8 = 32, E204_9 = 36 } e204;
+static const long *const v205 = 0, w205 = 37;
+extern float fn206(long sptr, long *b2, unsigned long long zx);
+enum { E207_0 = 0, E207_1 = 4, E207_2 = 8, E207_3 = 12, E207_4 = 16, E207_5 = 20, E207_6 = 24, E207_7 = 28, E207_8 = 32, E207_9 = 36 } e207;
+static short (*handler208)(int, short *);
+long table209[28][4];
+union u210 { int i; float f; struct { short lo; short hi; } parts; } uv210;
+const char table211[5][7];
+extern unsigned int fn212(unsigned long long bptr, unsigned int b, unsigned long long rptr, int *mptr, const char *rx);
+signed char table213[1][8];
+enum { E214_0 = 0, E214_1 = 4, E214_2 = 8, E214_3 = 12 } e214;
+extern const char fn215(int glen, short *kptr, long zlen);
+enum { E216_0 = 0, E216_1 = 4, E216_2 = 8, E216_3 = 12, E216_4 = 16, E216_5 = 20, E216_6 = 24 } e216;
+unsigned long long table217[60][5];
+static const signed char *const v218 = 0, w218 = 91;
+struct s219 {
+    unsigned long long **f0;
+    int *f1;
+    const char *f2;
+    unsigned int **f3;
+    unsigned int *f4;
+    signed char **f5;
+} s219_default, *s219_list;
+char table220[17][3];
+static char (*handler221)(int, double *);
+enum { E222_0 = 0, E222_1 = 4, E222_2 = 8, E222_3 = 12, E222_4 = 16, E222_5 = 20, E222_6 = 24, E222_7 = 28, E222_8 = 32 } e222;
+enum { E223_0 = 0, E223_1 = 4, E223_2 = 8, E223_3 = 12 } e223;
+static const unsigned long long *const v224 = 0, w224 = 77;
+struct s225 {
+    double f0;
+    float *f1;
+} s225_default, *s225_list;
+union u226 { int i; float f; struct { short lo; short hi; } parts; } uv226;
+enum { E227_0 = 0, E227_1 = 4, E227_2 = 8, E227_3 = 12, E227_4 = 16, E227_5 = 20, E227_6 = 24, E227_7 = 28 } e227;
+extern unsigned long long fn228(unsigned int g_tmp, float mx);
+float table229[18][7];
+unsigned long long table230[37][1];
+enum { E231_0 = 0, E231_1 = 4, E231_2 = 8, E231_3 = 12, E231_4 = 16, E231_5 = 20, E231_6 = 24, E231_7 = 28, E231_8 = 32, E231_9 = 36 } e231;
+union u232 { int i; float f; struct { short lo; short hi; } parts; } uv232;
+static float (*handler233)(int, char *);
+enum { E234_0 = 0, E234_1 = 4, E234_2 = 8, E234_3 = 12 } e234;
+union u235 { int i; float f; struct { short lo; short hi; } parts; } uv235;
+extern short fn236(const char *sx);
+enum { E237_0 = 0, E237_1 = 4, E237_2 = 8, E237_3 = 12 } e237;
+enum { E238_0 = 0, E238_1 = 4, E238_2 = 8, E238_3 = 12, E238_4 = 16, E238_5 = 20, E238_6 = 24, E238_7 = 28, E238_8 = 32, E238_9 = 36 } e238;
+extern short fn239(int w, int acount);
+static const char (*handler240)(int, unsigned int *);
+static const short *const v241 = 0, w241 = 32;
+unsigned long long table242[38][1];
+extern unsigned long long fn243(unsigned long long sptr);
+char table244[12][7];
+enum { E245_0 = 0, E245_1 = 4, E245_2 = 8, E245_3 = 12, E245_4 = 16, E245_5 = 20, E245_6 = 24, E245_7 = 28, E245_8 = 32 } e245;
+unsigned int table246[29][7];
+extern signed char fn247(double *bcount, signed char *dlen, short fx, short n_tmp, unsigned long long w2);
+long table248[3][1];
+struct s249 {
+    long **f0;
+    signed char **f1;
+} s249_default, *s249_list;
+enum { E250_0 = 0, E250_1 = 4, E250_2 = 8, E250_3 = 12, E250_4 = 16, E250_5 = 20, E250_6 = 24, E250_7 = 28, E250_8 = 32 } e250;
+long table251[1][8];
+struct s252 {
+    long *f0;
+    float **f1;
+    short *f2;
+    unsigned long long *f3;
+    short f4;
+    signed char **f5;
+} s252_default, *s252_list;
+static const const char *const v253 = 0, w253 = 39;
+struct s254 {
+    double **f0;
+    char **f1;
+    float **f2;
+    signed char f3;
+    const char *f4;
+} s254_default, *s254_list;
+union u255 { int i; float f; struct { short lo; short hi; } parts; } uv255;
+static const float *const v256 = 0, w256 = 83;
+union u257 { int i; float f; struct { short lo; short hi; } parts; } uv257;
+union u258 { int i; float f; struct { short lo; short hi; } parts; } uv258;
+unsigned int table259[11][5];
+enum { E260_0 = 0, E260_1 = 4, E260_2 = 8, E260_3 = 12, E260_4 = 16 } e260;
+enum { E261_0 = 0, E261_1 = 4, E261_2 = 8, E261_3 = 12, E261_4 = 16, E261_5 = 20, E261_6 = 24 } e261;
+enum { E262_0 = 0, E262_1 = 4, E262_2 = 8, E262_3 = 12, E262_4 = 16, E262_5 = 20, E262_6 = 24, E262_7 = 28, E262_8 = 32, E262_9 = 36 } e262;
+float table263[4][1];
+static long (*handler264)(int, float *);
+struct s265 {
+    char *f0;
+    char *f1;
+    long f2;
+    const char *f3;
+    float **f4;
+    char f5;
+    short f6;
+    int f7;
+} s265_default, *s265_list;
+enum { E266_0 = 0, E266_1 = 4, E266_2 = 8, E266_3 = 12, E266_4 = 16, E266_5 = 20, E266_6 = 24, E266_7 = 28 } e266;
+union u267 { int i; float f; struct { short lo; short hi; } parts; } uv267;
+enum { E268_0 = 0, E268_1 = 4, E268_2 = 8, E268_3 = 12, E268_4 = 16, E268_5 = 20, E268_6 = 24, E268_7 = 28 } e268;
+static signed char (*handler269)(int, long *);
+enum { E270_0 = 0, E270_1 = 4, E270_2 = 8, E270_3 = 12, E270_4 = 16, E270_5 = 20, E270_6 = 24 } e270;
+static unsigned int (*handler271)(int, signed char *);
+enum { E272_0 = 0, E272_1 = 4, E272_2 = 8, E272_3 = 12, E272_4 = 16, E272_5 = 20, E272_6 = 24, E272_7 = 28, E272_8 = 32 } e272;
+union u273 { int i; float f; struct { short lo; short hi; } parts; } uv273;
+static int (*handler274)(int, long *);
+static short (*handler275)(int, short *);
+struct s276 {
+    unsigned int **f0;
+    long *f1;
+    const char f2;
+    short f3;
+    unsigned int f4;
+    long **f5;
+} s276_default, *s276_list;
+static char (*handler277)(int, char *);
+extern unsigned long long fn278(const char a2, const char z2, short *n, unsigned long long *f, long *z_tmp);
+enum { E279_0 = 0, E279_1 = 4, E279_2 = 8, E279_3 = 12, E279_4 = 16, E279_5 = 20 } e279;
+static const double *const v280 = 0, w280 = 21;
+extern signed char fn281(const char d, short y, unsigned int tcount, const char ucount, unsigned long long h_tmp);
+struct s282 {
+    short **f0;
+    double f1;
+    unsigned long long *f2;
+    int f3;
+} s282_default, *s282_list;
+struct s283 {
+    int *f0;
+    long *f1;
+} s283_default, *s283_list;
+struct s284 {
+    char *f0;
+    char f1;
+    unsigned int f2;
+    double *f3;
+    char **f4;
+    int **f5;
+    float f6;
+    double *f7;
+} s284_default, *s284_list;
+static const signed char *const v285 = 0, w285 = 53;
+extern int fn286(float wlen, int a, char r2, const char *f2, float *vlen);
+enum { E287_0 = 0, E287_1 = 4, E287_2 = 8, E287_3 = 12, E287_4 = 16, E287_5 = 20 } e287;
+static char (*handler288)(int, double *);
+static float (*handler289)(int, const char *);
+extern char fn290(int scount, float *h_tmp, unsigned long long zptr, long hptr);
+extern unsigned int fn291(long hptr, unsigned int w2, const char *blen, double vptr, float blen);
+short table292[16][1];
+static const char *const v293 = 0, w293 = 79;
+double table294[24][4];
+union u295 { int i; float f; struct { short lo; short hi; } parts; } uv295;
+signed char table296[4][5];
+unsigned int table297[4][3];
+struct s298 {
+    double **f0;
+    char *f1;
+    long f2;
+    long **f3;
+} s298_default, *s298_list;
+struct s299 {
+    double *f0;
+    signed char **f1;
+    double f2;
+    unsigned long long *f3;
+    float **f4;
+    char f5;
+    char f6;
+} s299_default, *s299_list;
@@ -0,0 +1,1241 @@
+int calc_0(int a, int b, int *p)
+{
+    q <<= 0x1be1 && q2 ^ hlen[8] > xlen[7] << h_tmp.cptr <= vx[1] ? 878 : 588 ? 0x5b15 | 152 ? 0x3df4 && 0x7ea2 : h && t : 733 + v2;
+    xlen = 0xfe1c / hlen;
+    t_tmp |= h_tmp.tptr;
+    return * wptr;
+}
+
+int calc_1(int a, int b, int *p)
+{
+    blen <<= 883 > (((unsigned long) 0xaeaa));
+    y += ((int) cx);
+    eptr += 0xb9fb;
+    tlen += q_tmp.q_tmp;
+    plen = rx ? ((c) ? k_tmp[6] : & 0x923d) : elen;
+    x -= blen.p_tmp;
+    return 0xb887;
+}
+
+int calc_2(int a, int b, int *p)
+{
+    ux += xx(pptr[8]) && & w[6] ? ~ 0xf498 ? d_tmp(h2[6], h2[8], 944) : gptr(0x3804, 0xdcb6) : e2[7] >> ucount >= fptr[7] - ((const short) (tx)) == ~ r[2] ^ 0xcad9;
+    u = (hptr);
+    f <<= u(u2(c_tmp), c[8], 371 * 725 != t2[5] & p2);
+    xptr |= mx() > n_tmp(0x6a5f);
+    zlen = p2[0] && k->elen;
+    zcount -= 0x3717;
+    sx |= ((unsigned long) glen.d);
+    return (zcount->wx);
+}
+
+int calc_3(int a, int b, int *p)
+{
+    ulen |= u_tmp.hptr;
+    kx <<= * 895 <= 0xc19a < cx(316, zptr);
+    qx -= 455 ? - 0x65c3 : 608 + nptr << n2[1] + n.v;
+    zx <<= rcount.t2;
+    return ((unsigned long) a(scount[7], r2[6], mptr));
+}
+
+int calc_4(int a, int b, int *p)
+{
+    ncount |= 726;
+    e2 |= 0x26ba;
+    px <<= yptr();
+    xcount |= 0x765e;
+    f -= 418 ^ - q2[0] << vx(u_tmp) != ((char *) f_tmp ? 628 : 186);
+    m += h2->m_tmp ? t2->scount != 705 ^ t_tmp[8] > k2 : kptr;
+    hptr |= 0xb364 | 509 <= ((const short) 0x74d) > 470 << * mcount[5] * 0x24f7 < mlen[8] % 347;
+    return r_tmp(0xa89e) / 112 & 0xc17d & flen[5];
+}
+
+int calc_5(int a, int b, int *p)
+{
+    bx += mx || bcount ? wptr.uptr : ((unsigned long) 214 || 0xd3dd) * 769;
+    q_tmp += 932 > 342 * nptr[1] ? 0x7836 * 137 != ((char *) bcount) : 349;
+    uptr = eptr | ecount.q2;
+    hptr -= v2.m;
+    scount <<= & pptr;
+    clen += - mlen[4] << p2 < hcount(wx[7] - 444, cx[2] ? 0x931e : v2[0], 168 <= ycount);
+    d |= a;
+    ucount += 15;
+    return bcount[2];
+}
+
+int calc_6(int a, int b, int *p)
+{
+    kcount -= 0x7f70;
+    v <<= ((const short) n(hcount[5] << 0x9e43));
+    tcount <<= (u_tmp(213, hptr, d_tmp[5]) - ((unsigned long) blen[9]) && ylen);
+    return 791 + k2[9];
+}
+
+int calc_7(int a, int b, int *p)
+{
+    zptr += (cx[9]);
+    dlen <<= 0x8d45;
+    q_tmp += ((char *) 0x6986 >> 919 >> ! 0x317b != ((int) 344) & (0x1e0d));
+    return u[1] ^ 504;
+}
+
+int calc_8(int a, int b, int *p)
+{
+    uptr -= ((int) ecount.tlen || 537 & 241 << bptr(e2[0]));
+    bcount += 916 + mlen;
+    xptr |= g2(b2, 0x4679) >= (0xa94f) == ux[0] ? 263 ? 0x5692 : m(dptr, s, 141) : ((char *) * 0x2fc0 <= 0xec3c);
+    bcount += glen(hcount, elen) || 912 == 0x4cce >= flen * m2 ? 435 < g : 0xd66 - u_tmp >= 578 ? slen : 590 % p ? 580 : 0x508e;
+    gx |= z2;
+    yptr -= w2(ucount, 0x6224, d2);
+    p2 <<= 132 << qptr >> ((char *) 0x32bf) + v_tmp[6] - 710;
+    ccount |= clen(ax[0] + 0x779e, 998) >= * (0x7c9b) ? 0x3022 : bx->mx;
+    return 65;
+}
+
+int calc_9(int a, int b, int *p)
+{
+    s2 += ((int) 94);
+    cptr -= ycount || qlen.wlen;
+    ylen |= - ((char *) (f_tmp[8]) * * zlen);
+    acount = 413;
+    wcount = w->ex ? 489 : tptr();
+    y <<= ! g2 == (724 + klen) < 624 ^ ax->ucount;
+    vx = ucount[5];
+    wx |= - qlen(0xcc19, ~ w_tmp, hx);
+    return uptr[8] || ((char *) zlen->vcount);
+}
+
+int calc_10(int a, int b, int *p)
+{
+    eptr <<= ((px + 562 ? 0xdb21 ^ 0x7cf8 : ecount(sx[2], x_tmp)));
+    dptr += 820;
+    nx += a2->q2;
+    w_tmp -= ((uptr[9] % 0x2477 < klen <= hx[3]));
+    return gptr(0x130c != d);
+}
+
+int calc_11(int a, int b, int *p)
+{
+    ncount = (86);
+    a_tmp -= 741 / x2 ? 0x3f3 : 0xa729 > 0x300e ? (0x8fad) >> gptr[0] && 346 * vcount[1] : n2.tptr;
+    p <<= ((const short) ((char *) ccount(65)));
+    return a_tmp[7];
+}
+
+int calc_12(int a, int b, int *p)
+{
+    vx |= w_tmp();
+    r2 -= kcount[2];
+    rptr <<= y;
+    xx = f_tmp[8] << 0xe103;
+    return v_tmp(ulen->b2);
+}
+
+int calc_13(int a, int b, int *p)
+{
+    zx <<= kx >= (421) * hcount.t2 >= 639;
+    px <<= u_tmp[5];
+    wcount = - (q2(q2[3], vlen[4])) != (elen <= 0x70be) || a->eptr;
+    return dptr[5];
+}
+
+int calc_14(int a, int b, int *p)
+{
+    ccount |= t2.ylen < q_tmp[9] ? 888 : 431 - 801 + 32 < f2[1];
+    xptr |= m_tmp[1] | 0x57eb | qlen ? 266 - 226 : 757 >> 0x4181;
+    ex |= n();
+    hx <<= * z(0xa9c0, x_tmp[6], 0xa4e6) * 931 % (74) ^ cx(0xf21);
+    p = vptr[8];
+    return h(mlen, tx, y2.b);
+}
+
+int calc_15(int a, int b, int *p)
+{
+    blen -= 0xdfb0;
+    r_tmp |= & k_tmp;
+    wlen -= g_tmp[5] | glen;
+    c2 = ! (rptr[8]) ? flen.yptr : (0x2efe) ^ 545 << qlen;
+    wcount |= fx[4];
+    e <<= b;
+    f2 |= ! e2[6] | mptr[4] != 336 <= p2 == 0x3436;
+    cptr <<= t2[8] | 116 ? xptr[1] * rptr : c2(k[5]) << ! s[4] ? flen != sptr ? * ylen[5] : a[0] == 108 : 189;
+    return (ylen[1] ? 345 : 707) * ! k[3] / k->xcount;
+}
+
+int calc_16(int a, int b, int *p)
+{
+    dx -= e2() / s_tmp() > 0x6429;
+    d_tmp += (((char *) m[4]));
+    yx |= (v2.cx + gx->v2 || 683);
+    ecount -= 0xbafb;
+    b_tmp |= e2[1];
+    return 0x6045;
+}
+
+int calc_17(int a, int b, int *p)
+{
+    v_tmp -= ucount();
+    f <<= ((0x6d1a ? rptr : 225 ? bptr[2] : xx[5]));
+    x_tmp = 346 & c2.s;
+    f2 <<= pcount + ((unsigned long) 0x57cd) || gptr[0] * dlen ? dlen && 0x2f27 / ex : 293;
+    h <<= c_tmp.fcount * uptr->rcount;
+    return g2.fcount;
+}
+
+int calc_18(int a, int b, int *p)
+{
+    tcount -= t2(0xa445) == 0x3cae >= (902) ? ((int) slen) : (* 584 & n[2]);
+    ax = s_tmp(0x22bf, e2, cx[6]) * n_tmp[5] % 0x6035 * plen[0] % ! fptr[6] != yptr->s;
+    clen = sx >> 930;
+    a2 = ((int) ((unsigned long) e_tmp.t));
+    eptr |= ((char *) ((int) m[9]));
+    k_tmp = ! 105 >= ((const short) ((const short) 0x7e46) & 0xd204 != 186);
+    xptr = (g(qcount[1]) % 0x2c16 & 0xa625) << y2.zx;
+    b_tmp -= b->ylen;
+    return y->kptr || fptr[7] <= 397 > y2.f;
+}
+
+int calc_19(int a, int b, int *p)
+{
+    hcount <<= ((const short) fx[1]);
+    mcount += 846 <= ! h2.c;
+    rx -= (q2[7]) ? 0x94f7 : ((int) ~ plen);
+    return & ~ ((int) k_tmp);
+}
+
+int calc_20(int a, int b, int *p)
+{
+    zptr += - sx[2] % (dcount || qcount);
+    s2 <<= ~ ((unsigned long) ucount.px >= hcount(0x8791));
+    e2 -= (nlen(634, 493, qptr)) / s2(g_tmp, 20, 642) ? (295 ? fx.qlen : e_tmp->nptr) : h[4] ? wptr : flen[9] != 829 == d_tmp + h_tmp ? vcount[6] : 0xefe5 && bx[6];
+    blen <<= gptr[0];
+    return ((char *) a[8]);
+}
+
+int calc_21(int a, int b, int *p)
+{
+    e += 375;
+    n -= pptr;
+    t = ((char *) pptr(x2, 0x56f0, u_tmp[2])) | 0x15b ? u2 : v_tmp[0] % 110 / 0x385d ? rlen->u_tmp : & 692 || wptr[2];
+    ucount -= * ((unsigned long) 0xe3b7) || ucount <= (0xd8a5) ? (mcount.x2) : 901;
+    x |= ((unsigned long) d[7]);
+    ax |= 0x136e;
+    return r2 != wptr() >= ((int) 0x1b4c);
+}
+
+int calc_22(int a, int b, int *p)
+{
+    eptr += (k | 0xb051 - (k2->elen));
+    t |= & c(p_tmp, rlen) != e_tmp & 0xd4b5;
+    r -= (((const short) ecount->b2) | p & bx[0]);
+    ncount += (204) - qptr->m2;
+    g_tmp |= m->zx;
+    wcount = 0x1c01;
+    gcount -= (v2);
+    return (v[9] ? 0x1c44 : gptr <= n2());
+}
+
+int calc_23(int a, int b, int *p)
+{
+    u2 += ((char *) 0x76d9);
+    k += 0x6c7c;
+    m2 |= elen <= k && & blen(g, 0x2665, 224);
+    return ((int) ! kptr) - 0x7c58 ? eptr[8] : c_tmp[0] ? 0x25e : k2;
+}
+
+int calc_24(int a, int b, int *p)
+{
+    s = ((const short) 0xca4a);
+    x2 += fx[6] ^ p2(g_tmp, x[8]) | 0xdc05 ? 0x9a59 : zlen[5] > plen ? 174 : fx[9] || blen >> 0xa0df;
+    t2 <<= * ~ clen < gptr[9] == (871 << sx % 174);
+    t2 = acount | t_tmp[1] ? nlen : 571 | 572 / d2 ? 0x7bc1 : zlen[7] ? k_tmp(q_tmp.rx, (gcount[7])) : zlen % 0xad9f;
+    zcount |= (((blen)) < 782 % 592 ? 0xdae : v_tmp ? p_tmp : u2[1]);
+    return (0x5f01) | 0xe289;
+}
+
+int calc_25(int a, int b, int *p)
+{
+    r_tmp = ((const short) yx->w);
+    x2 |= 44;
+    dcount += zx;
+    fptr <<= eptr.wcount;
+    return r(f2[3], qlen[7] && 674, 87 - y_tmp);
+}
+
+int calc_26(int a, int b, int *p)
+{
+    w2 += m2;
+    mx = ((unsigned long) ((const short) p2 <= ecount[1]) ? 0x646b - 657 > dcount[1] : ((unsigned long) r));
+    r_tmp += ! (klen[2]);
+    return r_tmp;
+}
+
+int calc_27(int a, int b, int *p)
+{
+    c_tmp |= (& & t2) << (y(0x6376, ax));
+    hx |= & ((const short) blen ? 0x510c : 0x92c8 < 651);
+    h_tmp |= sptr[7];
+    e_tmp |= wptr((h_tmp) == flen >> 0x9be);
+    return 530;
+}
+
+int calc_28(int a, int b, int *p)
+{
+    wx -= & - 341 >= fptr || y;
+    tx |= mlen;
+    q2 -= (892 <= 426 ? 0x3f64 : dcount < kcount.ucount + 0x22fc - xlen);
+    return & zlen(p[9], b, m2);
+}
+
+int calc_29(int a, int b, int *p)
+{
+    p2 |= b2;
+    ax -= f2.ecount;
+    k2 <<= fptr(((const short) d_tmp), f[2]);
+    kx <<= ((unsigned long) 0x8ace || 775) ? alen(slen[4] ^ d2[4], - gcount[2]) : (((int) b_tmp.vx));
+    pcount += ((const short) 281) && s2(f, p2, p2[5]) < ! t2();
+    return ((unsigned long) n_tmp.n_tmp);
+}
+
+int calc_30(int a, int b, int *p)
+{
+    fcount <<= wptr->y || xlen->m_tmp > 960 ? (((char *) (827))) : yx->r;
+    k2 |= mptr() * g_tmp[4];
+    mlen <<= h[8] | 814 << 17 && (0xd921) ^ dptr ? k : bx >> xcount(0xddb9, 8);
+    return 0xb037 >> ucount < 0xfb11 != yptr[8] ? dptr : 418 && (slen);
+}
+
+int calc_31(int a, int b, int *p)
+{
+    nptr <<= r_tmp.gcount;
+    hcount += nlen / hptr << ((unsigned long) 928) == 0xeb71 < 0xffd4 ? 0x6574 : gx[2] ^ ex->x2;
+    nptr <<= p2;
+    alen <<= 333 % - 0xecec << 7 > d2(0xfdd8, y2);
+    v2 <<= ex[2] ? b_tmp & qcount[8] >> pcount || tlen(86) : (! ~ hx);
+    return ((const short) ! 0xfd9f >= d2[8]);
+}
+
+int calc_32(int a, int b, int *p)
+{
+    pcount = (ylen->f_tmp == t_tmp.z_tmp) ? ! 0x3ad : n2 ? 406 : 0xed45 && ((int) x2) == 0x2587 ? * r2 : mlen;
+    m = uptr;
+    n_tmp += (q_tmp.m | (65) == wx >= 230 << ((const short) 317));
+    zlen = (ucount() - 0x79bc == k[1] <= p);
+    return gcount(- wlen, nlen[9] % ycount, v2(728, 0xcfce, rcount));
+}
+
+int calc_33(int a, int b, int *p)
+{
+    ulen += wlen[9] ? (0x1af3 % 0x662) * 501 : ((unsigned long) (scount[8] & 0xecae));
+    fx <<= dlen;
+    klen -= scount[8];
+    vlen |= 0x5ae5;
+    r2 <<= 0x724b;
+    cptr <<= e_tmp[0];
+    return ((int) - acount[7]);
+}
+
+int calc_34(int a, int b, int *p)
+{
+    h <<= vx[4];
+    r_tmp -= (((int) 0xac6f) ? mptr.ax : - gcount ? dptr : u_tmp);
+    c2 = ((const short) s);
+    vcount |= c2((0x7784) ? 130 ? a_tmp[5] : 485 : tlen[6] ? 0x4f6a : 788, ! dptr[5] / ulen < kptr);
+    return 0xb7d < 0x30b2 < 983 - ~ v_tmp.z_tmp;
+}
+
+int calc_35(int a, int b, int *p)
+{
+    ncount <<= ((const short) pptr);
+    uptr <<= u() & m[7] ? b.c2 : * c[0] < w[5];
+    rptr <<= ((unsigned long) clen(s2, flen, 601) <= 0x11a4 ? 475 : 0xa211 != ((const short) 361 * 0x10e2));
+    v2 |= x_tmp;
+    r_tmp = ! 579 - dptr ? 840 == x_tmp : ~ wptr ? 0x6b65 > mptr : g2[5] ? 0x5173 : 0x7ca9 / 585;
+    p |= (t_tmp[8]);
+    k_tmp += p_tmp() ? 166 : 882 ? flen - 683 : - r.kx;
+    return p();
+}
+
+int calc_36(int a, int b, int *p)
+{
+    v_tmp += ((int) 38) < d_tmp[1] / d[8] && (821) * elen.kx;
+    ylen <<= & ((const short) wlen->s2);
+    u2 <<= kcount ? y2() : 910 >> zptr(x[7], qptr[0], 0xfd6) ? ((x_tmp[7])) : hlen[4] >= 0x4c1e || k_tmp[9] < 233;
+    return k_tmp;
+}
+
+int calc_37(int a, int b, int *p)
+{
+    t2 += (vptr[0]);
+    hptr += ((tx()) <= ux->nlen);
+    y |= ((char *) ((0xc2ce))) - dptr->tptr;
+    k -= (0xd60c == 64) + (d.uptr);
+    flen += a;
+    u += ex;
+    return (u[5]);
+}
+
+int calc_38(int a, int b, int *p)
+{
+    pptr -= x_tmp.slen << 813;
+    qptr <<= (z_tmp == 0x7400 - 0x1127 < 0xcaee ? (0xf2f) : hx->acount);
+    xptr |= ((kx ? 178 : r2 & x_tmp % 0xfcf7));
+    v += s2[3];
+    return xcount;
+}
+
+int calc_39(int a, int b, int *p)
+{
+    ccount -= slen[4];
+    dx |= ((unsigned long) (0x6b53) == ux(kptr[0]));
+    m_tmp <<= xptr->b_tmp;
+    uptr <<= & g_tmp.t;
+    qlen = c_tmp ? nptr[2] : 0x4a1f >> z.glen / 404 >> wlen ? r2->scount : 97 ^ q2 * & glen[0] && (z2[0]) * ((unsigned long) c) <= 0x4f5b;
+    return (fptr[0]) % t(n_tmp[7], t2[9]);
+}
+
+int calc_40(int a, int b, int *p)
+{
+    t2 |= ((const short) xcount >= 0x7a25 != 0x2092 <= cptr[3]);
+    qlen |= (ccount[0]);
+    vx -= fcount < n2->gptr;
+    x_tmp += (937) + ((const short) ucount[0]) - nx(578 == 0x7b0d, 0xfd8e | aptr);
+    return vcount(gx[1]) ? 0xd8a3 : (ccount) & & 0xafbd > 0x951;
+}
+
+int calc_41(int a, int b, int *p)
+{
+    tx <<= 0x2aa5;
+    tlen = ((int) (! hx) ? xcount(hlen[9], c2[9]) : m(g_tmp[1], p) - vlen.mx);
+    gptr += 0x86b;
+    g += 766 > 0xb336 <= d[2] < d[6] == a_tmp ^ 395 <= g || 829 * 193 + w[0] & xlen[6];
+    x2 <<= (0xf546) || 577 + q_tmp.g_tmp;
+    w_tmp <<= ax;
+    return ((int) ((unsigned long) 979)) <= dx(0x740c, 0x5581, r_tmp[2]) * 0x948f;
+}
+
+int calc_42(int a, int b, int *p)
+{
+    dptr = v2;
+    xcount |= 627 << ((char *) b_tmp[1] - rptr) <= ! * t[8];
+    sx -= ((int) (d_tmp(0x724b))) % a_tmp(0xf1c6, e2, 0xac79) > bcount[4] > 0xbf9c ? sptr() : (q2);
+    ux = 0xf415 / 0x18bb / 372 == 826 >> (412 - 397 == x[3]);
+    ecount <<= 0xf821;
+    return ! kcount + 803;
+}
+
+int calc_43(int a, int b, int *p)
+{
+    kptr -= y2[1];
+    sx = * d2 >> e[0] << * ((const short) 0x5b10) && ((unsigned long) d->vlen);
+    z -= 0x6183;
+    t <<= 239;
+    g_tmp <<= (w) >> ((char *) 890) >> y_tmp[4] & - 0xbbf3 ? 0xb06e ? 490 | 40 % pcount : * (593) : (~ 924);
+    f <<= nx.y_tmp / 0xcfb5;
+    s_tmp = tptr[3];
+    return slen.w_tmp;
+}
+
+int calc_44(int a, int b, int *p)
+{
+    qx -= v->d;
+    bcount += ((const short) f[7]) ^ & 0xc4b7 ? mx[8] : pcount & 0x22b9;
+    w2 |= qcount->m == 410 ? 0xbe5d : d(0x504b, 222) >= rx;
+    ex <<= mlen.w;
+    y_tmp |= 118;
+    tptr = ~ gcount->dptr;
+    return 214 ? b[9] : r_tmp[5] ? alen : 0x6a00 ? 0x1a61 : glen >= 991;
+}
+
+int calc_45(int a, int b, int *p)
+{
+    acount <<= 429 == 709 % fcount < ! dptr->bcount / p2;
+    z2 |= 0x2288;
+    w_tmp |= wptr;
+    kcount += acount[5];
+    b_tmp += 0xb0df && sptr << 0xd7d6 + 0x79e3 >> - hlen(xx) && ((const short) e_tmp(g_tmp[7], 0xb578));
+    return 0xa4e8 || (pcount);
+}
+
+int calc_46(int a, int b, int *p)
+{
+    mlen |= 388;
+    vx = - ((char *) aptr) && zptr[3] == v2 ? bptr[3] : 0xfd6f;
+    z2 -= r.h;
+    return - 51 + 166 / 0xeb70 - 0x8d8d ? ! 0xf4a2 : 956;
+}
+
+int calc_47(int a, int b, int *p)
+{
+    fx <<= fcount();
+    b = ~ dptr(blen(0x274f, 0x45f9, zx), * 825);
+    yptr = d;
+    u2 -= 845 || 0xf470 >> 693 & 922 & 853 ? gcount(sx, pcount[9], acount[8]) : & 945;
+    x -= ((unsigned long) px(446, 0x193c, yx[9])) - q[2] ? 118 - ((unsigned long) pcount->yptr) : plen;
+    hlen = - g2[4] || 414;
+    return (zx[3] | zptr[3] << (xptr[4]));
+}
+
+int calc_48(int a, int b, int *p)
+{
+    y2 -= 0xa581;
+    tcount = ((int) ncount[0]);
+    x += & (((const short) dptr[6])) && 487;
+    vcount += ycount.u2 & ((unsigned long) * d_tmp ? h_tmp[8] : w_tmp ? 0x2371 : b2);
+    return ((char *) ncount.d);
+}
+
+int calc_49(int a, int b, int *p)
+{
+    ycount |= ((int) ylen[2]) ? ulen[9] ? 0x405d : zlen : ((char *) 873) - ((unsigned long) zptr(dcount)) ^ slen;
+    rx += n2[0] + 0x6a2f ? ((char *) 940) : klen[4] != 0x9855 < & 0xe09a ^ - a[5] & tptr[0];
+    t2 -= 720;
+    return zlen;
+}
+
+int calc_50(int a, int b, int *p)
+{
+    wcount += ((const short) (((const short) 0x2e50) == (0x3273)));
+    n2 -= 0x44ed;
+    u2 += k2.wcount;
+    glen |= tptr % ((int) 0x7741 != t_tmp[8]) ^ z_tmp[2];
+    n_tmp <<= ((int) - ((unsigned long) 0xc905));
+    cx += (147 | 694 < b_tmp.nlen + ((unsigned long) 21));
+    pcount = ((char *) (xx.x_tmp) ? (984 <= 0x470c) : ylen[5] >> k_tmp[1]);
+    return ! acount;
+}
+
+int calc_51(int a, int b, int *p)
+{
+    b_tmp += fcount->slen >= ! d_tmp->d2;
+    dx |= kptr(klen(nlen[2], 0x48ea, 545), & e2[1] - 0x414f <= cptr[8]);
+    plen |= n2[2] << - 0xb799 >= 410 < g_tmp[0];
+    q2 -= ((const short) & (* 786));
+    mlen -= bptr.c < m2->sptr >= - ~ a2;
+    return * & 110 == 0x9d0c;
+}
+
+int calc_52(int a, int b, int *p)
+{
+    elen <<= (ncount ? s_tmp[4] : 596);
+    zlen += c;
+    mcount += 0xf980 ? ((char *) ~ vlen ? 137 : plen[2]) : g() ? gptr(b2, 744) : (528);
+    vcount -= & 0xf719 ? 0x4f83 : 0xe0e7 - 112 & 280 / 0x9383 > v_tmp[9] && 0x6acd % q[8] > 0xc938;
+    tx <<= nlen.slen;
+    f += ((unsigned long) 213) >> 0x7061 ? ! 423 : pcount->x2 < qptr.tcount;
+    return h2->ycount >> flen.q;
+}
+
+int calc_53(int a, int b, int *p)
+{
+    zlen |= kptr[5];
+    u -= ((unsigned long) ((unsigned long) u) ? ((unsigned long) 0x2dde ? qptr[4] : 378) : dcount[7] <= dcount[2] % 143);
+    rlen |= ! 293;
+    d_tmp += dcount() != ecount[8] ^ 0x60a9;
+    mx -= - xcount->n_tmp * ((int) h_tmp < z[2] << d2[8] >> flen);
+    w_tmp = ((const short) xx[0]);
+    return 123;
+}
+
+int calc_54(int a, int b, int *p)
+{
+    ux |= ((const short) (h2)) ? ((char *) 231) : nlen->e_tmp != kx[6] ? wptr : f ? ~ 0x72a7 == - 0x2cfa : (- ylen[6]);
+    a2 += ((char *) 593) >= 753;
+    hx |= acount->ux << 965;
+    clen = (0xb96e) % (x(0x7c46, ylen, 446));
+    nx |= 982;
+    return * ((int) 0xf6d6);
+}
+
+int calc_55(int a, int b, int *p)
+{
+    ux = qcount() ? (165 >= 269) : qx->cx ? dx[7] || y_tmp : gptr->hlen ? nx(~ 0x3146, (820)) : yptr.a2;
+    ncount |= 0x32ee;
+    dcount <<= - fptr;
+    e |= f2();
+    return 0xb208;
+}
+
+int calc_56(int a, int b, int *p)
+{
+    gptr += * (x_tmp);
+    mlen = s_tmp(128 ? d2 : 0xe46b, c2, * uptr) < - klen[4] % uptr(gptr) | fcount.aptr;
+    plen |= d;
+    c2 = v((e2[7] <= 952), kx[2], scount->hcount);
+    vcount = 0x8f34;
+    e_tmp += klen->x2 >> c_tmp(462) <= wcount(0xf22b, 0xa2bd, kptr[6] || 0xcb72);
+    n <<= ((const short) 0x3cfc > 154) ? acount->d ^ dx ? 0xd1ad : y_tmp[2] : * c_tmp[4] % 24 ? z2[8] : 0xa56 - vptr[7] ? k_tmp[6] : 0xd372 - rx->xcount != ((char *) ((char *) y_tmp));
+    return q_tmp.glen;
+}
+
+int calc_57(int a, int b, int *p)
+{
+    wlen <<= 205 << 0x8541 << 0x74c0 ? mptr : c2[3] - & y_tmp << mptr[8] >= nlen;
+    rcount = ~ (e2 * ((char *) b_tmp));
+    gx = 0xb698;
+    hcount -= 932 || ax[6] ? ncount[4] : (((char *) ((const short) p)));
+    q_tmp += ex[5] == rx[9];
+    h_tmp += 165;
+    zx += 0x13a4;
+    slen |= p2->bcount % ~ dx[7] / ~ vlen[2];
+    return kptr(0x2ab8, 0xd62f, n2[1]) ? k2 <= 0xb010 : glen / (bcount->u2);
+}
+
+int calc_58(int a, int b, int *p)
+{
+    mlen = * gptr >> ! 0xdfff && 0xe68d + u2[9];
+    z_tmp <<= * n(0x75b0) / 0xb563;
+    ycount += (795);
+    a_tmp -= n_tmp;
+    wcount += r2[8];
+    return (((char *) wx.h_tmp));
+}
+
+int calc_59(int a, int b, int *p)
+{
+    sx = 0xbc3 ? 0x44eb : a2[0] % v[3] || - - bptr[8] ? (qx->c_tmp != 133 * ncount[3]) : dx(986 % d_tmp[8]);
+    ccount |= 0x6aa1;
+    p2 <<= (t2) ^ 0xd036;
+    eptr <<= ~ h() < y.zlen;
+    h_tmp <<= 0x568b || z[1] && rcount >= (rx || tcount[6]) ? r : k2[9];
+    fptr <<= ((g2[2] && (dcount)));
+    wptr |= 0xba17 ? plen : 0x24 >= (488) >> 0x3e19 <= 0xa794;
+    cx |= clen.s2;
+    return rlen;
+}
+
+int calc_60(int a, int b, int *p)
+{
+    e_tmp |= r[5];
+    nptr -= ((unsigned long) y2.t2) >= pcount();
+    ax <<= * s2 & g_tmp[0] == 134 == 0xa5a2 / 72 & 0x2f11 | aptr->bptr ? (0xc7bd) : cx ? 482 : 0x623d;
+    return qlen.z2 ? 351 : f_tmp[2] < x_tmp[9] ? 586 ^ (v2[6]) : 0xcc57 ? t_tmp() : e_tmp->hcount;
+}
+
+int calc_61(int a, int b, int *p)
+{
+    ucount |= 889 && xcount[1] % 301 >> pptr(0x7c3) ? d->d : k_tmp[5] ? fcount[5] : (wx[9]) != qcount < x;
+    b_tmp = * ((unsigned long) mptr()) & 0xa1a2 ? flen >> k_tmp[2] % 0x4ec1 / rptr : x->kx;
+    pcount |= & dptr(e2[4], dlen[2], 0x87be) <= & ((char *) ~ m[1]);
+    return ucount > 893;
+}
+
+int calc_62(int a, int b, int *p)
+{
+    mptr <<= 207 || zptr[9] | 0x5;
+    t2 = ~ tx[6] & ((char *) hx) ? wlen(0x4dad) : 0xdf4b >> ~ s[4] % dcount.b2 ? ((const short) k_tmp(0x24d8)) : rptr->n_tmp;
+    zlen += ((int) 797 ? (dlen > sptr[4]) : ncount());
+    nx += ~ z2[2] ? qcount[3] | ((const short) dcount[0]) : ((const short) 15 != vlen[4]) ? ((char *) gptr(mx) < ccount) : ((const short) 0x68ac <= * 147);
+    gx = (((int) 24));
+    wx |= (nptr->clen);
+    yptr += & & 0x775d ? a[3] ? 0x2034 : pcount << wcount || 943 : tptr(0xae5e, 659, x_tmp[2]) <= ccount >= 778 ^ scount.x2;
+    ux |= w->rcount;
+    return 0xefec;
+}
+
+int calc_63(int a, int b, int *p)
+{
+    b_tmp = ! bx[4] && y_tmp[1] ? 0xd7aa : 0xb9fa < z_tmp.a2;
+    m2 <<= yx <= f_tmp;
+    dx |= y_tmp->m;
+    a2 <<= ((const short) rlen.ccount);
+    f_tmp = v2.yptr;
+    return e.alen;
+}
+
+int calc_64(int a, int b, int *p)
+{
+    blen <<= mlen.acount ? 319 << 0x7156 - ((unsigned long) 877) : r >> (g) ^ a2.y2;
+    tptr |= ((int) ((dx[6] & flen[0])));
+    w2 -= 997;
+    b2 += a >> a_tmp;
+    return xx ? 630 : 588 / s_tmp[8] % vlen(v[5], zlen[8]);
+}
+
+int calc_65(int a, int b, int *p)
+{
+    e2 = * 377 % ((unsigned long) clen);
+    p |= ! ax[8];
+    x2 |= (x(nptr[9]) & & scount - f->a2 || f2(v_tmp[2], 0x4b76));
+    ulen += s2;
+    wlen += glen(q2(dptr[3], k_tmp, 542), 932 * 748, d2 << t[4]) >= f_tmp;
+    slen -= ((int) 0xeffd);
+    return gptr[2] ? v.v : rptr(t);
+}
+
+int calc_66(int a, int b, int *p)
+{
+    x += 491 ? 0xbeac : 0xe716 != ~ 0xf97e % r2(447, 0x5216, f2) <= ((char *) kx[3] ? 0x17b6 : 0x3631) != a2[4] ? v2[7] : a >= tptr;
+    p2 = m2(& 853 >= px[3]);
+    ycount <<= (mx[8] + 572 | d2);
+    w_tmp -= c_tmp[2] && ((unsigned long) vptr) % h_tmp(0xfe68, px[8], 316) & 23;
+    w2 |= wcount * pcount | s[3] % 850 + & 0xfb79 & 774 ? rlen->c ? ucount[8] : (0xa49d > s2) : e_tmp * 860 - hptr[4] % z == ((int) 0xfc13) ? r2.bptr : 0x9501 < 345;
+    uptr |= 0xf4c5 & u2.plen;
+    sptr += glen->bx;
+    sx |= cx(((int) n_tmp ? q : pcount), 0x5d62 | 0x5829);
+    return 892 - ((rlen));
+}
+
+int calc_67(int a, int b, int *p)
+{
+    w |= ! c(0x2beb) < zlen[0] | 0x3e2e & gcount(gptr[2], h_tmp, 0xfa5c);
+    scount += ((char *) ((int) 0xa2bf) ? ! qcount : 0xa31a << 47 == * 563 >= 340);
+    g = (gcount[7]) && 55 != y_tmp | 0xc500 ? (0x5f17) : (pcount[7]) % (n[2] | 329 & 0x6a1c);
+    vptr = kcount->g_tmp;
+    x -= (0xe397);
+    r <<= gptr.x_tmp;
+    ecount += ((const short) ((unsigned long) ((unsigned long) 933) == 0x25cd || 442));
+    d_tmp |= ((const short) scount());
+    return 0x71d3 > 0x97ef < ((int) 693) >= 0x7538;
+}
+
+int calc_68(int a, int b, int *p)
+{
+    pptr -= (gptr) % ((const short) 936) * ((char *) h.a) >= s2((59), 923 >> h2);
+    pcount -= 978;
+    n += ((const short) qcount() == ((int) ex[8]) ? & 894 * (qlen) : 800);
+    dcount = z_tmp() ^ scount[7];
+    s2 |= k_tmp[6];
+    return f_tmp(px.u_tmp, 874, q_tmp->gcount);
+}
+
+int calc_69(int a, int b, int *p)
+{
+    kx |= ((int) ((int) f_tmp(0xd389, 744, blen)));
+    m <<= 0x74b1 / ((int) c2[5] ^ x->scount);
+    vlen <<= dptr[9];
+    ncount = gptr * (((char *) wlen)) * - ((char *) 0x27b9) ? y | 451 : 0x7f10;
+    e2 = ((const short) 119 ^ u_tmp) == & 0xbbbd <= 0x998c | b_tmp << * 198 >> a_tmp->d;
+    sptr |= nlen->n2 >= (yptr) ? (t[9] ? 244 : 384) : 0x894 ? b2.zx : zptr.v_tmp ^ tx.qcount;
+    cptr += ((char *) ccount[1] && nptr[0]) ? vptr.w : x_tmp->xlen ? mx->pcount * ~ 0xa907 <= 0xb839 : (891) ? r_tmp : 622;
+    c = ((int) 0xea06 ? 0x65b5 : 192 ? ecount() : x2(u_tmp[3], 0xcbb5) > plen);
+    return 0x379;
+}
+
+int calc_70(int a, int b, int *p)
+{
+    d -= w_tmp[2] ? s - ((unsigned long) n_tmp[8] || g_tmp) : ((char *) (mptr && 955));
+    m2 += x2 >= n_tmp & ~ rx(125, 0x131f);
+    r_tmp <<= ! ((int) 0xc55) * 887 < 979 && rcount;
+    flen = f(kptr[3], (465) >= tlen(k2[1], 0xb801), sx.k);
+    q += f_tmp->hcount;
+    u2 <<= rcount[9];
+    return ~ ~ 0xf2e4 ? aptr() : (h_tmp[8]);
+}
+
+int calc_71(int a, int b, int *p)
+{
+    fptr |= xlen(bx());
+    tcount = (0xa89 ? 0x62cc | 0xb447 : dlen ? cptr : 421 / ~ wlen);
+    n2 <<= (((const short) (43)) | f_tmp[8] ^ yptr);
+    b2 -= kx;
+    d_tmp -= gx() ^ kcount.vx != 878 | 0xe334 + (774);
+    eptr <<= 760 % - 570 * z[9] ^ u(0x9175, ulen[2], 794);
+    mptr -= ((char *) 0x1dbd) <= 284;
+    return k2(257, 0xdbc5) + ylen;
+}
+
+int calc_72(int a, int b, int *p)
+{
+    acount -= qptr(p2[5], fx, rcount) ? 188 || ucount(tlen[4], 482, 0x5261) : (569) * 318 == 861 ^ m.nx;
+    px <<= - ((int) gcount[0]) <= 0xe9c9 > 0xd96f ? (0x3f5a) % 919 : fx.vx;
+    kx <<= 0x7c59;
+    t_tmp -= ((unsigned long) d2[1]);
+    n += yptr.px;
+    q2 |= dptr[1];
+    rlen += vlen.ecount;
+    return cx;
+}
+
+int calc_73(int a, int b, int *p)
+{
+    slen = vptr(dlen) ? r() : wptr[7] / ax(621, hx, 741) << v->wptr;
+    plen |= - x || mx ? a->v : ex ? 0xb01e : h | acount ^ k | ((n_tmp));
+    f2 = (! - 0x1c60 & 0xdaa3);
+    t_tmp += ! ! n2 & 761;
+    zx = w_tmp(((const short) p_tmp(115, r[8])), n[0] << 48 | 0x253);
+    blen = e2[1];
+    ucount = wptr(775, v_tmp[0], t_tmp) > dptr || 483 ^ ~ 0xf2d8 & h2;
+    q <<= b2;
+    return (zptr[3]);
+}
+
+int calc_74(int a, int b, int *p)
+{
+    ex |= 998 && 940 < vx & ((const short) qptr * vptr) > & f_tmp * k_tmp[0];
+    b2 += nptr.aptr;
+    ucount -= w_tmp[5] << ((f_tmp));
+    return t2[1] / 0x431f;
+}
+
+int calc_75(int a, int b, int *p)
+{
+    wcount <<= 0x4d3e;
+    klen -= z_tmp->cx;
+    m += x.t != & (0xdba9) < ~ 0x263;
+    s += gcount;
+    r2 += 0xa5cd;
+    mptr = hlen[0];
+    uptr += ((297) != z.f2 % n());
+    ycount = (zlen) >> 0x519 ? mptr ^ 744 : & blen && & 0x9236 ? nx[0] >> zx : wcount;
+    return g->n;
+}
+
+int calc_76(int a, int b, int *p)
+{
+    xcount <<= n();
+    z |= - 0x2689 ^ (((int) n_tmp(243, zcount)));
+    sx |= ((int) 0x85e1 == 0xe98c) > ccount(0x5e40, 0xdbe8, q2[3]) - v.n_tmp ? ! k2 : scount <= r & ((int) ulen[4]);
+    b |= g_tmp;
+    klen += 576;
+    m_tmp = ncount(bx[1] || scount, xcount, rptr[4]) ? (0x72d) : q2(((int) v_tmp), zx(0x8de5, 158, 0x18e4), rptr[4]);
+    return b_tmp[2];
+}
+
+int calc_77(int a, int b, int *p)
+{
+    wcount += (0x45b3) == ux[1];
+    ulen = 215;
+    clen |= ! - qlen >= ucount[9] % (qcount[4]) / tlen(713, 0x7e73, scount[9]);
+    tcount = 0xe70 / kx[2];
+    w2 += - 777 >= s2 << 0xa36d ^ gptr(hx) ? ucount[3] && sptr[9] : (ncount[4]) ? 0xcacb == 0x639b >> 290 % 0xd8b4 | 0x648a ? (0x4013) : ! 592 : ((char *) slen[2] % y2[6] % mx[3]);
+    c += v[4];
+    ex -= ((const short) - 44);
+    kcount -= yx[0];
+    return a[8];
+}
+
+int calc_78(int a, int b, int *p)
+{
+    t_tmp += & ((unsigned long) 565);
+    fx -= hptr;
+    rcount |= dx[9] ^ 0xddc5 ? * mptr != 11 : 0x1182;
+    y2 |= 979 >= tx.qcount ^ y_tmp[2] % z_tmp | wx ? e[8] : 616 * pptr;
+    eptr -= ((unsigned long) (fcount[5]) >> 369 << 0xf0c5 ? kptr[4] ^ t2 : 151);
+    d_tmp <<= ex[7] * a(ex);
+    return x2(f_tmp->wcount, 0x33d2, y[9] >> gptr);
+}
+
+int calc_79(int a, int b, int *p)
+{
+    uptr = - ~ zx[7] ^ tx - slen->s2;
+    t_tmp += u_tmp->eptr;
+    f_tmp = 130;
+    return 941;
+}
+
+int calc_80(int a, int b, int *p)
+{
+    h2 += * q;
+    h <<= ((const short) ~ glen(zptr, 327, 0x2939));
+    nx -= c2(glen(z2, 378, 0x675), p_tmp.fcount);
+    c_tmp += q2[3] >= ((int) * ncount[9] < pptr[9] >> kcount[8]);
+    a2 -= plen[5];
+    cx -= 0xb138 >= ((bcount[6] || 959));
+    q2 += g2->yx <= clen->plen;
+    h_tmp <<= - ((int) ex) || & 0x4e2 <= ~ (817 / p2[9]);
+    return xptr->hptr;
+}
+
+int calc_81(int a, int b, int *p)
+{
+    w_tmp <<= m2[1];
+    blen |= (((const short) aptr->klen ? 0x9da2 || dlen : * x2[9]));
+    nlen -= b_tmp.w2;
+    ulen <<= * 0x363e <= h_tmp[0] <= 248 && 287 >> elen[4] ^ 0x8e0c > mcount[3] < c_tmp > - (d2);
+    return ! vx.p2;
+}
+
+int calc_82(int a, int b, int *p)
+{
+    ncount <<= * tx[3] || 216 ? tlen.aptr : clen & 0x9808;
+    dx -= (0xe34d ? vptr[6] : 0x2e99 ? h2 - 865 : 0x13c6 <= mptr[7] ^ & - v_tmp);
+    m = dptr[3];
+    return w * b_tmp->v ? hptr.x2 : m_tmp[7];
+}
+
+int calc_83(int a, int b, int *p)
+{
+    q2 += wx.slen && fx[7] > 703 <= 0xb377 % 196 <= 0x645e;
+    c <<= e(((const short) (0x69cc)), (dptr(mx)));
+    hx += ((unsigned long) (tptr));
+    u2 += ((zptr[2] <= ecount) ? clen != r_tmp[8] & 441 : vx[1]);
+    qcount <<= ((int) ((char *) fcount && 915) * ((char *) 489 > 439));
+    return vx(p / qx[3], ! 0x9557);
+}
+
+int calc_84(int a, int b, int *p)
+{
+    h_tmp |= * bcount->ncount & nlen[1];
+    b2 += 0xd34c;
+    clen |= 629 - 0x86a0 < & (rx[9]) && ((int) ((clen[4])));
+    return tlen;
+}
+
+int calc_85(int a, int b, int *p)
+{
+    k -= (((nx) != ncount->v_tmp));
+    ax -= 0xf296;
+    b = - 0x43c7;
+    return 867;
+}
+
+int calc_86(int a, int b, int *p)
+{
+    b_tmp += nx;
+    vcount = tcount->bx % ! ((unsigned long) eptr) - vx->b_tmp;
+    pcount <<= (f);
+    return ! (y_tmp[3]) * 0x5d68;
+}
+
+int calc_87(int a, int b, int *p)
+{
+    xx -= g[2] ? yptr[2] == c2 >> 558 - 114 : k2(sptr(578, zx[7]), f2.q2);
+    d -= ! (bcount[9] <= tlen <= 0x12b8 ? 140 : x[5]);
+    v2 = ulen() ? vx + px > 719 : mptr() > n2();
+    ulen <<= 0x7eb1 <= 140 == fcount[2] < 0xedac;
+    return u2(v2[8], fx) < ((unsigned long) h2) << ! qptr;
+}
+
+int calc_88(int a, int b, int *p)
+{
+    s -= d_tmp[1] ? glen->f_tmp != xlen[2] : rptr + vptr[1] < 0x8279 > bcount == (0x4c3f);
+    mlen = klen[3];
+    q_tmp |= wlen(0x5933, mptr[4], 0x88d5) / (sptr[4]) ? 0x1b74 : 0x8bc0;
+    w -= xlen[9];
+    p_tmp <<= ((unsigned long) ~ blen ? mcount : bcount[9]) < ((int) ((const short) hx[0]) - 994 ? 0x1ca2 : 0x77a4);
+    q_tmp += 50 % 0xaaec ? f2[5] ? 292 : 0xe70c : 0x1b8e & cptr / ((int) b2(0x5879, 0xf9bf, dptr)) << 24 == mcount[3] + p2 ? 442 : x[2] * 0x8ce8;
+    ycount = & q(tptr[5] - 0x792b, & mcount, hptr[5]);
+    return 587 ? z.ncount ? (0x93a4) : 0x578a & u : 708 ^ 0x31f0 < 96 + 0xdfe2;
+}
+
+int calc_89(int a, int b, int *p)
+{
+    dptr += rptr(tptr.nptr, q_tmp, (h_tmp.g_tmp));
+    z += xptr.alen * m(mptr, 4) >> x2[9];
+    s2 -= 918 ? 0xee13 - & u2[2] : 330 ? kcount(468, glen[5]) : - g2[2];
+    return (flen->u_tmp);
+}
+
+int calc_90(int a, int b, int *p)
+{
+    nx |= flen;
+    pcount -= tx[5] / s2 / xptr[1] >> qcount == ((char *) (173)) || rcount[1];
+    g2 <<= (flen[8] ? 650 : hptr->alen);
+    return 382;
+}
+
+int calc_91(int a, int b, int *p)
+{
+    p2 -= fcount >= & ((const short) ax);
+    yptr <<= ((unsigned long) ((unsigned long) 0x3932));
+    c2 <<= 0xd3f4;
+    b -= xlen.h2;
+    s_tmp <<= & nptr(859, 0xddf9 ? 963 : 0x13cf, 0xe7f1 ? bptr : 920);
+    s <<= c_tmp(* dlen[9]) > 531 <= 0x93cd > v(f2[4]) ? xlen <= kx | klen[5] : ! ((char *) 0xb462);
+    g2 <<= & 452 << ((const short) hcount == pptr[0] || 0x99cf);
+    z_tmp += 672 - n2(g2 || wx[7], vcount[9] % 353);
+    return 663 - (0x7736) + h2 <= zx;
+}
+
+int calc_92(int a, int b, int *p)
+{
+    acount <<= (((int) glen[0]) > 0x829e + dptr) * ((const short) 167 ? 0xc635 : s_tmp[2] ? g_tmp + w[7] : tx->t);
+    gx += (m == x2 >= k_tmp[2] ^ 753) | ex->xlen;
+    w2 -= (((const short) 294 ? fx[3] : s_tmp)) ? (((int) ! ecount)) : a2[5] == zcount[2] ? glen.s : 0x4d7d == 0x926d ? (0x5f04 != 839) : glen[3];
+    cptr <<= 798;
+    zx = n;
+    clen <<= - m->f_tmp >= 0x4396 ? 231 : f;
+    plen -= 0xd0f | t2 * ecount[7] ^ 0xb70b || ylen;
+    fx = px;
+    return c(194, 873, 0x5fe2) && 505 & vcount;
+}
+
+int calc_93(int a, int b, int *p)
+{
+    s2 += 345;
+    e_tmp -= ((const short) q(zlen[6], tcount[9], 118) >> m());
+    qlen |= bx[9] <= rlen[0];
+    n |= k2(r.zlen, 724 % dlen[3], qlen) | ((char *) rx(969));
+    return v->yx;
+}
+
+int calc_94(int a, int b, int *p)
+{
+    ax += 780 - r / ((const short) (973));
+    a2 <<= tx(px);
+    g2 = aptr && blen() >> glen[2];
+    k2 -= w.e_tmp;
+    qptr -= ((int) & ((unsigned long) ux[5]) < (u[5]));
+    zlen <<= rlen() == 961 ? 0xb995 : z_tmp(0x5256, 890) > 649 % hx == g_tmp[7] ? 0x70fc : nlen;
+    return q2->zx;
+}
+
+int calc_95(int a, int b, int *p)
+{
+    dptr = & hptr != hlen(683, 0x4482) > k[8] >= c2[3] <= s_tmp ? px.fx : k2 < mptr / ((unsigned long) qlen);
+    x_tmp = s_tmp->pptr;
+    vptr -= ((char *) 979);
+    rptr += ((unsigned long) 823);
+    plen += 0x6eba;
+    return (w2 > 531);
+}
+
+int calc_96(int a, int b, int *p)
+{
+    tx -= 972;
+    p_tmp |= - ((y_tmp[2]) % tcount.xptr);
+    vcount <<= wlen[4];
+    flen -= k;
+    yptr |= (wcount(297)) ? ! acount.v <= (wlen[1]) : ((const short) 0xa9c0 ? qptr < 560 : rcount | p2);
+    fx -= sx->k2;
+    return - kcount != fptr <= tlen[4] | (fx ? wlen : 0x1f26);
+}
+
+int calc_97(int a, int b, int *p)
+{
+    qlen <<= zlen < ((int) gptr[8]) ? e2[5] ? q2[9] : 949 : 319 / qx[6] + zptr[7];
+    s2 -= ((char *) 0x40a) < 312 ? 410 : k_tmp[4] ? 0x7bfe || dlen[5] : 884 ? 810 : 727;
+    ylen += 0xb086;
+    ax -= (* 273 | xptr[9] | v_tmp > 996);
+    q <<= ((unsigned long) c->nlen);
+    t2 = y_tmp[4];
+    gx -= (0xd1ae) <= xptr(93, 0xd73, sx) >= ((int) ~ 914) / 0xf161;
+    d <<= ((const short) (181) >= tx());
+    return s_tmp->e2;
+}
+
+int calc_98(int a, int b, int *p)
+{
+    u2 -= (~ 0x1aa9) / t2[4];
+    u_tmp <<= xptr.bx;
+    zptr <<= f_tmp % (kx[1]) != zptr[7] < ((int) t2 > b_tmp ? 165 & xlen : (zcount[0]));
+    e_tmp = ux[1];
+    xlen = qcount(m2(0x11e7, rptr));
+    w_tmp += 794;
+    hlen <<= yptr(nlen->bptr, f_tmp(s_tmp[4], 404));
+    eptr |= 767 >> d2->zx;
+    return 0x3041 <= ~ u_tmp[3] * 591;
+}
+
+int calc_99(int a, int b, int *p)
+{
+    s2 += dlen->tx;
+    ecount += p2(0x65d3) % 0xc3ac == s_tmp->zlen ^ flen | 0x1001 <= e[5] <= wptr.q_tmp;
+    p -= rx[6];
+    t_tmp = ((unsigned long) (524) ? - dx : (eptr)) ? bcount->qlen || wlen : p2() | 0x4106 ? xlen[6] : zptr > (0x68d1);
+    h |= 877;
+    w2 <<= nx((396), 759 > elen ? 0xd14f || w : 0x3a2b >> 0x673b);
+    f_tmp = ~ - 0xbd88 ^ e_tmp[5] ? (ulen[8]) - wlen : ((int) 0xbae3) ? mx[0] : 0x6325 ? 675 : 0xe8fd;
+    t_tmp |= s->yptr + 0x7547 <= 651;
+    return 332;
+}
+
+int calc_100(int a, int b, int *p)
+{
+    n_tmp -= sx >= 158;
+    sptr -= ulen[9] ? 0x263 : 0x14d7 & acount.dcount <= mptr[5] >> u_tmp[3] & p_tmp[1] * & ex(m_tmp[0], 453);
+    f += 651 && gx[7] / 0x4a6c << gcount.xcount ? ~ 578 : ex - 0xce01 | 0xddd9 * k_tmp * m_tmp->hlen;
+    xx += ((unsigned long) ! 940 ? 385 : 456) ? 0xa2b8 : mlen(m2[2], e2) ? ux[8] : & t2[8] ? t[8] : 10;
+    acount <<= cx->zcount;
+    m2 <<= fx[3] << - ((const short) c2) % ((unsigned long) hptr[3] & h2->p2);
+    elen += 0x2168;
+    return * 621 ? 72 : f_tmp ? ((unsigned long) 161) : klen[2] != 0x4d65;
+}
+
+int calc_101(int a, int b, int *p)
+{
+    r_tmp += sptr.sx;
+    m -= p2[8];
+    rlen <<= wx->v_tmp ^ ((unsigned long) ~ 592) * ~ d >= 0x55b0 ? ~ rcount[4] : kx[8];
+    blen -= ((int) ycount.x2) + rptr() ^ ucount / 0x8ece < ((char *) d2(477, s[0], 0x9e0f));
+    gx -= mcount(~ 0x42dd, v->cptr, 0x8b43);
+    f_tmp <<= vcount() << gptr();
+    cptr |= (ax & 988);
+    return (((int) (rx)));
+}
+
+int calc_102(int a, int b, int *p)
+{
+    bx = 0x56a3;
+    tcount <<= tx[3] >= & 0x8a;
+    u += p2.b < ((unsigned long) t2->v2);
+    cptr -= mlen();
+    return ! ((unsigned long) 178 >> 0x1f92);
+}
+
+int calc_103(int a, int b, int *p)
+{
+    eptr <<= 781;
+    gcount <<= fx->zcount;
+    rlen -= (((char *) 0x17ca >> 0xc285) % 0x7488 * vcount > 308 ? 0x6f02 : 928);
+    d |= wptr & slen.mx ? fcount.tcount : fx[8] ? yx[6] - hlen > ((unsigned long) u_tmp) : ((int) 688 >= alen);
+    g_tmp -= vptr(* 0xbe33 || wcount[4] <= 261, ((int) (938)));
+    px <<= g2(0xa34a, 0x4d2d, ((char *) ~ 160));
+    p2 = 0x62d7 < 539 / 0xa7cd > uptr * p_tmp && h[8];
+    k |= 755;
+    return 0x8094;
+}
+
+int calc_104(int a, int b, int *p)
+{
+    slen = pptr[6];
+    t = 0xd0ee;
+    z_tmp = g_tmp;
+    xlen = xx->n ? 344 >= 0xe400 : 0x59ad < 0xef9c == 0x4ee9 & 214 / 0x1916 ? pptr[6] : 790 * 119 - hptr();
+    dx = 890 >> g[8] > 0x390 && 735 && nptr.aptr >> 917 && ~ qcount.q2;
+    return vlen;
+}
+
+int calc_105(int a, int b, int *p)
+{
+    nx -= b_tmp[3];
+    w += f->acount;
+    nptr <<= 715 | p->zx;
+    nlen += ! 300 * u->m2 >> * cx[7] <= r2;
+    clen <<= (- yx->kcount ? ((unsigned long) k_tmp) : e(gcount[7]));
+    sptr |= 777 - aptr;
+    return (323);
+}
+
+int calc_106(int a, int b, int *p)
+{
+    b -= 925;
+    m += vlen(ycount[2]) * 0x6c40 == 0x68dc | fx[9] ? 214 : 754 - 0x4295 <= 623 < 0x9d74 << 0x1196;
+    sptr -= (((char *) r_tmp / 731 & 0x2ed1));
+    y2 += z.hx >= 0xc157 && 685 + wcount(q_tmp[1]) != ylen->slen >= 265 ? xx : 0x1881;
+    ax <<= 132;
+    return w_tmp[3];
+}
+
+int calc_107(int a, int b, int *p)
+{
+    sptr -= r_tmp(126 >= elen + 22, ((unsigned long) pcount(h2, 0x2685)));
+    nptr -= 268;
+    ccount += h_tmp.ccount;
+    mx |= (rptr[5]);
+    gcount |= f->rx ^ ecount(& q_tmp, t_tmp);
+    return scount / sptr.vptr;
+}
+
+int calc_108(int a, int b, int *p)
+{
+    w_tmp -= 0x90e2;
+    h |= hlen.qptr ? e >= 0x3d6f : 944 + sptr[4] * 0xd5a9 >> elen;
+    h <<= eptr[4] >> x() == ucount[4] ? 0xf7b6 : 306 || flen(0x670, 25);
+    k |= f2->y;
+    u_tmp <<= p2.vcount;
+    d |= ~ f_tmp() ^ tlen() ^ * y_tmp[8];
+    return ((char *) 937 << mcount[8] - & flen);
+}
+
+int calc_109(int a, int b, int *p)
+{
+    ax -= tptr;
+    zlen = f2 | (g_tmp < 0x12c6) - plen;
+    f2 = 373;
+    return t2[1];
+}
+
+int calc_110(int a, int b, int *p)
+{
+    nlen += v_tmp(0x38e2);
+    bptr -= mx | b2;
+    plen = q2(((int) (0x8e56)), ~ dcount[9], mlen(fx[8]));
+    kx |= x(ycount[5]);
+    return ~ slen[1] > yptr();
+}
+
+int calc_111(int a, int b, int *p)
+{
+    sx = & 0x551e ? wcount : 644 / h2.q << xptr(h2[6], 0xf7b8) | zcount(0x55c3, 0x982, zcount) && acount->u2;
+    mcount += 910 < x[8];
+    gcount -= e_tmp % 0x6e0e * ((char *) 0xfb9d) ? (666) >= 0xca74 % 454 : 776 <= 0xe444 < 429 ? mcount->n : h(((unsigned long) dptr), (t), e[7]);
+    aptr <<= ((char *) nx);
+    p2 |= 0x488d;
+    hptr |= ! pptr.z != (0xf097) ? vptr : dptr[1] != f2;
+    slen = dx[1];
+    zptr <<= ((int) ((unsigned long) 0xc50a >= fcount[4] != e_tmp[7]));
+    return rx[1];
+}
+
+int calc_112(int a, int b, int *p)
+{
+    tx <<= (m_tmp);
+    tlen |= yx(pcount[1], ((const short) 294 - 249), ((const short) b_tmp) % g[0]);
+    t = px;
+    zlen += t2(((const short) 221)) > 286;
+    hptr += clen[0];
+    return k2->elen;
+}
+
+int calc_113(int a, int b, int *p)
+{
+    x2 <<= ~ 728 <= ((unsigned long) - pcount[4] % 0xa626 | 874);
+    ex <<= 0x5a2c;
+    bcount += (- ncount ^ plen == 0x28aa);
+    mptr <<= 0x5208;
+    yptr -= tptr[3];
+    bptr <<= ((char *) 0x20ce < ex) ? 415 * 14 ? ((const short) eptr) : * ucount[7] : d->e >> 0xdc9a;
+    uptr += ~ dx(r2[1], 848) - ((char *) 0x65d3) < ! * k2 >> 0x7baf;
+    zx -= ux.fcount;
+    return 583;
+}
+
+int calc_114(int a, int b, int *p)
+{
+    m2 -= d(880, 0xf539 || 0xed8d / pptr ^ 229);
+    gptr <<= g2(dx, glen) ? 0x7c94 : 0x14e9 | f_tmp[9] > 233 != d2[8] || 154 | d_tmp[0] <= 0x7f43;
+    gptr |= m_tmp[9] % 880;
+    h <<= 856 << 0x1389;
+    return 207;
+}
+
+int calc_115(int a, int b, int *p)
+{
+    d2 = flen[3];
+    mptr |= wlen;
+    bptr <<= u2(((const short) x_tmp[8])) ? ! acount.aptr : 540 + ((unsigned long) qx(y, v[5]));
+    f_tmp -= 825 ^ ((const short) 189) ? 441 <= 82 : ((unsigned long) 340) <= 0x3690 == 121 + 0x3c0f;
+    return z.tcount < k2;
+}
+
+int calc_116(int a, int b, int *p)
+{
+    y2 = f2(0x7579 - tx, ((unsigned long) alen[9]), g[0] <= 724) & ((int) 151);
+    tlen = tptr;
+    s_tmp |= 0x3fee;
+    ecount = * (0xa57c + h) < ((unsigned long) wcount(z[1]));
+    ux = (acount[6] / 950);
+    yx = ulen->ulen <= & 0xe4e2 - h.nptr;
+    return scount->ecount;
+}
+
+int calc_117(int a, int b, int *p)
+{
+    qlen -= c(0x706f, 813 ? 146 : qx - 0xe949, p2[2]);
+    pcount += 595;
+    p_tmp <<= q_tmp;
+    m |= k->bptr % qx[4];
+    xptr |= 0xef8e ? w2(0x2af3, (g_tmp[6]), ! 847) : & ((unsigned long) cptr | 0xc8a8);
+    return * 0xea | (((int) c_tmp[1]));
+}
+
+int calc_118(int a, int b, int *p)
+{
+    n2 <<= dx.ulen / ((char *) dcount.zptr);
+    d2 |= eptr();
+    d2 |= (u);
+    hx |= (859) | (0x32a2);
+    return ((unsigned long) ccount || ylen ? wx[9] : fcount.q);
+}
+
+int calc_119(int a, int b, int *p)
+{
+    k_tmp = (0x79c1 ? q[9] : 940 && - nx[9]) != m2->qlen;
+    bptr = 0x15ae;
+    vlen -= * z2();
+    f2 |= ux;
+    tcount <<= qptr();
+    return hlen;
+}
@@ -0,0 +1,239 @@
+int init_0[] = { 1251, 6553, 654, 9643, 9615, 3744, 8449, 2489, 9563, 8815, 527, 497, 1129, 5244, 892, 505, 2218, 8989, 4838, 8646, 5401, 1522, 6520, 7843, 5904, 2557, 7712, 7628, 1217, 7529, 8919, 1792, 7088, 3708, 5515, 8299, 7273, 4506, 2511, 1747, 9744, 5812, 1131, 9980, 5498, 7543, 6652, 3010, 6289, 4943, 5843, 3336, 1881, 9556, 4065, 9998, 5147, 1058, 4651, 1897, 6043, 9176, 2997, 5994, 8680, 9316, 9540, 2810, 8890, 3104, 1078, 6460, 1649, 5524, 2854, 9369, 16, 3039, 4929, 6621, 9414, 379, 8471, 574, 3237, 3844, 5989, 1405, 1241, 6421, 7220, 2914, 2224, 6243, 8883, 4583, 7716, 6181, 2440, 6281, 5105, 6222, 2162, 6235, 671, 1784, 865, 3263, 1982, 6187, 5232, 4539, 8367, 5160, 933, 6641, 4052, 4460, 6376, 8117, 5019, 4813, 9109, 766, 3952, 50, 5378, 6401, 4461, 929, 9967, 8602, 8024, 1002, 5436, 4811, 7156, 8974, 223, 1224, 2370, 9912, 9806, 3391, 262, 6106, 4840, 2764, 23, 301, 9048, 6496, 1443, 9962, 3768, 8934, 1966, 9919, 6016, 236, 6700, 2412, 3505, 937, 5593, 2545, 8131, 4180, 6389, 2570, 4677, 1948, 3003, 5390, 3811, 4867, 4839, 5433, 5863, 9686, 9833, 1366, 8032, 7786, 8956, 4439, 9690, 3933, 6815, 7881, 6969, 8686, 7088, 2948, 9283, 1468, 3877, 7079, 2545, 2058 };
+struct point pts_0[] = { { .x = 87, .y = 8 }, { .x = 54, .y = 5 }, { .x = 41, .y = 76 }, { .x = 85, .y = 8 }, { .x = 24, .y = 79 }, { .x = 41, .y = 13 }, { .x = 66, .y = 5 }, { .x = 16, .y = 73 }, { .x = 26, .y = 35 }, { .x = 47, .y = 62 }, { .x = 36, .y = 79 }, { .x = 55, .y = 59 }, { .x = 18, .y = 28 }, { .x = 42, .y = 38 }, { .x = 53, .y = 40 }, { .x = 43, .y = 44 }, { .x = 26, .y = 21 }, { .x = 44, .y = 83 }, { .x = 0, .y = 31 }, { .x = 87, .y = 98 }, { .x = 92, .y = 60 }, { .x = 80, .y = 6 }, { .x = 19, .y = 43 }, { .x = 11, .y = 17 }, { .x = 36, .y = 11 }, { .x = 71, .y = 57 }, { .x = 30, .y = 2 }, { .x = 19, .y = 97 }, { .x = 28, .y = 20 }, { .x = 22, .y = 26 }, { .x = 98, .y = 98 }, { .x = 46, .y = 15 }, { .x = 0, .y = 30 }, { .x = 42, .y = 60 }, { .x = 32, .y = 24 }, { .x = 94, .y = 74 }, { .x = 49, .y = 64 }, { .x = 82, .y = 36 }, { .x = 50, .y = 75 }, { .x = 47, .y = 41 } };
+void call_0(void)
+{
+    sink(n2 * zlen[5], (c), k_tmp[6], & 0x923d, elen, 0x12e1 ? 865 : 0x542a, ! 0xd00e, 550 ? t_tmp[5] : wcount[1], d_tmp(h2[6], h2[8], 944), gptr(0x3804, 0xdcb6), eptr[2] | gptr, bx[2] ? t_tmp : ylen, 0x3e8b <= 421, 0xcad9, ulen << b_tmp, s2.u2, c_tmp, c[8], g[2] % 303, (fcount[5]), yx[1] ? fx : k2, g >> blen[0], (967), ((char *) n2[1]), 468 ? ncount : 0x29c7, 889 ? 274 : 678, gx == 240, 218 | qx[5], 334 >> q_tmp, 0xc09e > tptr, alen[8] == y, 0xe5fc ? 0x85f6 : qcount[7], (s[7]), uptr(0xee6b, wptr[5], tx), 749 > klen[3], xcount < 191, 418, ((char *) d_tmp), q2[0] ? 0x5884 : d2[6], px ? 628 : 186, 0x7f17 < z[7], t - qx[4], * 0x8075, v[7], z <= 0x6c78, k2[6] % tcount[1], kx[2], zx[2] ? 0xd2aa : rlen, 0x24f7, mlen[8], 778 || ucount[6], 0xa89e / yx, 0x1e7b, e_tmp(), hx[4] == 0x7494, ((char *) vx[0]), d_tmp(), wptr.uptr, 796 << 0x17e6, p2(0x609b), vx, 932, e2(0x5a20, rlen), 0xad8d && 301, c2[9], qlen[9], r_tmp << 897, f_tmp->a, z_tmp, 0xc2d3 & m[7], & a2, h2, mlen[4], plen, 388, q, 21, 0xf0ab > zptr, plen(), 995, (ycount), bptr * bptr[8], 15, bcount[2], cptr[3], (tcount[9]), & 0x1794, 0xe8e2 || 0xcbc8, (scount[8]), 0x42f8, d_tmp[5] - blen[9], ylen > 0x468a, k2[9] * zptr, (0x729d), ncount.xlen, 236, 0x263c <= 0x1a3e, uptr, p(0x30d9, 0x519c), 597 + u[1]);
+}
+enum { B0_0, B0_1, B0_2, B0_3, B0_4, B0_5, B0_6, B0_7, B0_8, B0_9, B0_10, B0_11, B0_12, B0_13, B0_14, B0_15, B0_16, B0_17, B0_18, B0_19, B0_20, B0_21, B0_22, B0_23, B0_24, B0_25, B0_26, B0_27, B0_28, B0_29, B0_30, B0_31, B0_32, B0_33, B0_34, B0_35, B0_36, B0_37, B0_38, B0_39, B0_40, B0_41, B0_42, B0_43, B0_44, B0_45, B0_46, B0_47, B0_48, B0_49, B0_50, B0_51, B0_52, B0_53, B0_54, B0_55, B0_56, B0_57, B0_58, B0_59, B0_60, B0_61, B0_62, B0_63, B0_64, B0_65, B0_66, B0_67, B0_68, B0_69, B0_70, B0_71, B0_72, B0_73, B0_74, B0_75, B0_76, B0_77, B0_78, B0_79, B0_80, B0_81, B0_82, B0_83, B0_84, B0_85, B0_86, B0_87, B0_88, B0_89, B0_90, B0_91, B0_92, B0_93, B0_94, B0_95, B0_96, B0_97, B0_98, B0_99, B0_100, B0_101, B0_102, B0_103, B0_104, B0_105, B0_106, B0_107, B0_108, B0_109, B0_110, B0_111, B0_112, B0_113, B0_114, B0_115, B0_116, B0_117, B0_118, B0_119, B0_120, B0_121, B0_122, B0_123, B0_124, B0_125, B0_126, B0_127, B0_128, B0_129, B0_130, B0_131, B0_132, B0_133, B0_134, B0_135, B0_136, B0_137, B0_138, B0_139, B0_140, B0_141, B0_142, B0_143, B0_144, B0_145, B0_146, B0_147, B0_148, B0_149 } big_0;
+
+int init_1[] = { 7523, 1944, 776, 6509, 8079, 2914, 4027, 4040, 6964, 2274, 8309, 5874, 8982, 739, 7642, 1958, 6015, 5655, 212, 9613, 2409, 6948, 5094, 7974, 6076, 9178, 7476, 2294, 2035, 2995, 5089, 8598, 5072, 118, 200, 3112, 2536, 6998, 8893, 3800, 3867, 3635, 7428, 8576, 5364, 4046, 2666, 6650, 6581, 1019, 3806, 7643, 1363, 1666, 3592, 2488, 19, 8021, 851, 8166, 2644, 183, 1855, 3020, 1859, 4999, 5459, 1991, 8357, 4281, 3636, 115, 1585, 1906, 5032, 5355, 1095, 379, 1636, 1436, 9879, 6434, 5146, 1232, 4820, 6229, 3346, 5280, 822, 436, 6291, 5049, 1490, 46, 9642, 5830, 4530, 9113, 8600, 2255, 1117, 9707, 5775, 4557, 5171, 9413, 1135, 6742, 4141, 5093, 5417, 4762, 301, 5670, 5805, 732, 1895, 5248, 8855, 8868, 9030, 2347, 8663, 2171, 558, 7235, 5178, 5218, 2102, 8931, 9310, 4215, 4105, 2599, 9972, 9942, 2429, 3699, 9764, 9794, 7713, 2929, 2770, 1150, 4073, 9363, 8510, 9573, 5757, 6850, 8544, 6334, 4963, 1129, 6321, 2029, 4455, 4422, 428, 404, 6698, 1163, 7239, 588, 9003, 749, 8715, 4534, 6523, 528, 7265, 334, 2256, 7740, 2438, 3927, 8846, 2665, 7541, 2150, 7627, 5267, 7768, 7124, 8827, 7801, 3270, 5461, 6366, 1528, 8793, 1598, 8530, 4399, 4634, 8584, 7548, 4062, 7559, 133 };
+struct point pts_1[] = { { .x = 76, .y = 96 }, { .x = 78, .y = 83 }, { .x = 32, .y = 5 }, { .x = 52, .y = 27 }, { .x = 38, .y = 87 }, { .x = 7, .y = 72 }, { .x = 24, .y = 50 }, { .x = 46, .y = 0 }, { .x = 51, .y = 45 }, { .x = 54, .y = 24 }, { .x = 43, .y = 46 }, { .x = 29, .y = 53 }, { .x = 94, .y = 54 }, { .x = 93, .y = 83 }, { .x = 53, .y = 44 }, { .x = 97, .y = 1 }, { .x = 19, .y = 32 }, { .x = 92, .y = 78 }, { .x = 95, .y = 30 }, { .x = 1, .y = 1 }, { .x = 69, .y = 78 }, { .x = 87, .y = 14 }, { .x = 70, .y = 2 }, { .x = 14, .y = 46 }, { .x = 45, .y = 65 }, { .x = 98, .y = 35 }, { .x = 20, .y = 44 }, { .x = 40, .y = 65 }, { .x = 90, .y = 19 }, { .x = 51, .y = 1 }, { .x = 95, .y = 50 }, { .x = 66, .y = 46 }, { .x = 40, .y = 66 }, { .x = 42, .y = 86 }, { .x = 65, .y = 4 }, { .x = 22, .y = 43 }, { .x = 3, .y = 52 }, { .x = 17, .y = 46 }, { .x = 99, .y = 95 }, { .x = 65, .y = 13 } };
+void call_1(void)
+{
+    sink((0xc8f2), 758 / 401, 798, u_tmp, 0xa689 % 866, 321, tlen[4], 580 + 0x508e, tptr[9], tptr[6] << dptr, xx[6], p->ncount, x.y_tmp, elen[2] >> 294, (kcount[0]), m_tmp->r, (vlen), qcount->dx, & 124, s_tmp, (0xf4c0), 695, m[7], tptr(), n2, ylen[0] / y, mx, ycount + k_tmp[2], mcount << v_tmp[3], p2.rcount, 272 % c2[8], * c2, 413, a_tmp(590, 489), tptr(), 222 % ax, (rlen), 192, cx->d2, w2->k_tmp, & fx[8], ucount[5] < slen[6], dcount(0x9810, w_tmp, c2), g_tmp[8] || 0x9c39, 0x8ee5, vx ? 0x2b69 : bcount[0], 0xedc6 % ecount[4], 807, ((unsigned long) fx[8]), 667 | 0x388c, (0xb80f), 0xddf1 * 841, klen <= hx[3], gptr(787), 631, (ncount[1]), 86 + xptr, 675, & p_tmp, 0x3f3 | 0xa729, n2(), x[2], 5, 885 - 835, x2[1], t_tmp, scount.sptr, (f2), 626, a_tmp[7], w_tmp[1], kcount[2] ? p2[0] : 919, cx(), & fx[2], sx.nlen, & 985, vx->bx, 0x93cc & 253, 353 << 676, 0x4b5 != wcount, - 0x3fd0, 0xc728, ~ 0xc7cb, elen <= 0x70be, * x, ! slen[1], 552 ? 751 : q_tmp, 688 - 0xaa6f, nptr->aptr, 823 ? mx[1] : 404, x[6], vx ? 480 : 0x84f4, 76 | 277, nx >= 131, qlen ? zcount : 0xa9c0, 0xfcea ? 653 : 931, zptr < f2[7], 91, r(0x3cce, vptr[8]), h(uptr[8], 259, zptr));
+}
+enum { B1_0, B1_1, B1_2, B1_3, B1_4, B1_5, B1_6, B1_7, B1_8, B1_9, B1_10, B1_11, B1_12, B1_13, B1_14, B1_15, B1_16, B1_17, B1_18, B1_19, B1_20, B1_21, B1_22, B1_23, B1_24, B1_25, B1_26, B1_27, B1_28, B1_29, B1_30, B1_31, B1_32, B1_33, B1_34, B1_35, B1_36, B1_37, B1_38, B1_39, B1_40, B1_41, B1_42, B1_43, B1_44, B1_45, B1_46, B1_47, B1_48, B1_49, B1_50, B1_51, B1_52, B1_53, B1_54, B1_55, B1_56, B1_57, B1_58, B1_59, B1_60, B1_61, B1_62, B1_63, B1_64, B1_65, B1_66, B1_67, B1_68, B1_69, B1_70, B1_71, B1_72, B1_73, B1_74, B1_75, B1_76, B1_77, B1_78, B1_79, B1_80, B1_81, B1_82, B1_83, B1_84, B1_85, B1_86, B1_87, B1_88, B1_89, B1_90, B1_91, B1_92, B1_93, B1_94, B1_95, B1_96, B1_97, B1_98, B1_99, B1_100, B1_101, B1_102, B1_103, B1_104, B1_105, B1_106, B1_107, B1_108, B1_109, B1_110, B1_111, B1_112, B1_113, B1_114, B1_115, B1_116, B1_117, B1_118, B1_119, B1_120, B1_121, B1_122, B1_123, B1_124, B1_125, B1_126, B1_127, B1_128, B1_129, B1_130, B1_131, B1_132, B1_133, B1_134, B1_135, B1_136, B1_137, B1_138, B1_139, B1_140, B1_141, B1_142, B1_143, B1_144, B1_145, B1_146, B1_147, B1_148, B1_149 } big_1;
+
+int init_2[] = { 8299, 866, 9655, 8290, 5211, 634, 257, 714, 4525, 6099, 2831, 7064, 4778, 6254, 9641, 7158, 7935, 1290, 5050, 6926, 9990, 7460, 9984, 8433, 8510, 260, 7854, 4483, 8976, 251, 2217, 266, 6281, 994, 565, 9451, 4236, 5233, 409, 2739, 1015, 7565, 3190, 489, 3194, 9566, 5499, 8133, 7995, 677, 3339, 4877, 4801, 2409, 265, 1949, 1420, 775, 1914, 5077, 8258, 2623, 5969, 4739, 5611, 7889, 9823, 4934, 3997, 9068, 2959, 6871, 8223, 6514, 7288, 8657, 9289, 2742, 4122, 5938, 6665, 7685, 4268, 8218, 1696, 1503, 6211, 8113, 1872, 4863, 7664, 1616, 2780, 6633, 3035, 8732, 3498, 5767, 1977, 3919, 3917, 2861, 1979, 501, 6459, 4948, 7861, 1074, 3812, 6124, 69, 9298, 6956, 7716, 1505, 3538, 3217, 5414, 4897, 2242, 3064, 4012, 4441, 8660, 6963, 2133, 1098, 9763, 1177, 1017, 1577, 3298, 6749, 7600, 6733, 605, 9387, 1150, 3070, 6320, 2581, 7967, 8707, 3838, 5875, 8361, 10, 818, 6988, 1822, 8304, 6563, 2489, 6863, 7950, 7731, 7769, 643, 7098, 6775, 2039, 9713, 7928, 4701, 4755, 9425, 8723, 7280, 6231, 2799, 647, 5388, 9188, 7971, 186, 1671, 6889, 3118, 5000, 6666, 9526, 3050, 1067, 5257, 5884, 4393, 7460, 3352, 921, 5968, 3817, 5206, 8120, 2876, 9098, 1670, 602, 353, 8777, 4895 };
+struct point pts_2[] = { { .x = 11, .y = 96 }, { .x = 67, .y = 53 }, { .x = 14, .y = 40 }, { .x = 87, .y = 15 }, { .x = 73, .y = 42 }, { .x = 45, .y = 8 }, { .x = 27, .y = 28 }, { .x = 61, .y = 63 }, { .x = 62, .y = 84 }, { .x = 66, .y = 72 }, { .x = 56, .y = 63 }, { .x = 79, .y = 14 }, { .x = 71, .y = 84 }, { .x = 57, .y = 70 }, { .x = 65, .y = 11 }, { .x = 20, .y = 49 }, { .x = 58, .y = 30 }, { .x = 33, .y = 19 }, { .x = 62, .y = 83 }, { .x = 75, .y = 20 }, { .x = 96, .y = 79 }, { .x = 10, .y = 97 }, { .x = 91, .y = 83 }, { .x = 50, .y = 9 }, { .x = 53, .y = 99 }, { .x = 83, .y = 97 }, { .x = 40, .y = 5 }, { .x = 65, .y = 25 }, { .x = 69, .y = 10 }, { .x = 55, .y = 93 }, { .x = 48, .y = 9 }, { .x = 81, .y = 21 }, { .x = 15, .y = 97 }, { .x = 34, .y = 88 }, { .x = 35, .y = 9 }, { .x = 42, .y = 49 }, { .x = 21, .y = 20 }, { .x = 64, .y = 19 }, { .x = 3, .y = 52 }, { .x = 63, .y = 35 } };
+void call_2(void)
+{
+    sink(((int) 0x603b), klen != sptr, * ylen[5], a[0], 0x3667 << blen[4], ! 0x7a69, 0x2c6b <= 465, 992 <= a2[3], ((char *) 0xc1a7), tptr / 0xe109, 0x6429, ! 260, alen->kcount, dlen(dcount[3], 721), 84, w_tmp >= 0xbafb, s, ((int) vx[1]), (320), w_tmp[4], 555 ^ wlen, 548, bptr[2] > rx, 0xf9fc >> rlen, gptr[5], ulen.p, g2[2], 0x57cd || 181, 118 - 237, b, (206), m_tmp[2] >> 252, v_tmp && 765, (slen[5]), 0x507d, 275 < 0x3cae, (902), ((int) ccount), (xlen), (fptr), 145 < s_tmp[9], qptr->v_tmp, (e2), hptr <= 0x4142, ((unsigned long) 0x6035), plen[0] % 517, qcount->fptr, q2.u_tmp, 69 / 236, 663, zptr + x2[8], m2[0] && 0x55d3, klen[3], ! 0xa861, mlen[7] <= 416, (bcount[0]), ((char *) 0xce94), & e_tmp, mx.kcount, rcount[6], 0x113a, 0xbfb4 ? 0x8110 : 0x18c0, 72 > rx[5], ((const short) 881), ((unsigned long) 140), * 16, 903 % 957, (720), 0x67ba - q2[7], 0x94f7, ((int) 0xbc44), 0x839 >= x2, - e2, dptr[4] >> 674, c_tmp[6], wptr || m2, ucount.px, hcount(0x8791), 0x7bb0 ? ncount[6] : 465, r->v_tmp, qptr, 845, zlen <= 932, (504), (249), qlen, (0xcd6), wptr[6] ? ylen : qptr[1], x2[2], 0xa88 < ulen, (qcount[7]), wlen(bx[6]), 309, ((char *) 122), 406 || 0xe94e, k, 0x182c | 0x445e, bcount(), a2, e2.t2);
+}
+enum { B2_0, B2_1, B2_2, B2_3, B2_4, B2_5, B2_6, B2_7, B2_8, B2_9, B2_10, B2_11, B2_12, B2_13, B2_14, B2_15, B2_16, B2_17, B2_18, B2_19, B2_20, B2_21, B2_22, B2_23, B2_24, B2_25, B2_26, B2_27, B2_28, B2_29, B2_30, B2_31, B2_32, B2_33, B2_34, B2_35, B2_36, B2_37, B2_38, B2_39, B2_40, B2_41, B2_42, B2_43, B2_44, B2_45, B2_46, B2_47, B2_48, B2_49, B2_50, B2_51, B2_52, B2_53, B2_54, B2_55, B2_56, B2_57, B2_58, B2_59, B2_60, B2_61, B2_62, B2_63, B2_64, B2_65, B2_66, B2_67, B2_68, B2_69, B2_70, B2_71, B2_72, B2_73, B2_74, B2_75, B2_76, B2_77, B2_78, B2_79, B2_80, B2_81, B2_82, B2_83, B2_84, B2_85, B2_86, B2_87, B2_88, B2_89, B2_90, B2_91, B2_92, B2_93, B2_94, B2_95, B2_96, B2_97, B2_98, B2_99, B2_100, B2_101, B2_102, B2_103, B2_104, B2_105, B2_106, B2_107, B2_108, B2_109, B2_110, B2_111, B2_112, B2_113, B2_114, B2_115, B2_116, B2_117, B2_118, B2_119, B2_120, B2_121, B2_122, B2_123, B2_124, B2_125, B2_126, B2_127, B2_128, B2_129, B2_130, B2_131, B2_132, B2_133, B2_134, B2_135, B2_136, B2_137, B2_138, B2_139, B2_140, B2_141, B2_142, B2_143, B2_144, B2_145, B2_146, B2_147, B2_148, B2_149 } big_2;
+
+int init_3[] = { 2877, 5585, 527, 1669, 5296, 7388, 1926, 43, 3777, 6513, 6735, 4727, 8691, 4042, 5163, 3003, 6381, 36, 1130, 931, 1952, 7245, 9608, 7373, 8914, 8967, 574, 8041, 2116, 5601, 489, 3730, 966, 6041, 1774, 2460, 6405, 435, 9845, 2625, 1851, 1312, 1111, 1803, 2569, 3538, 7857, 6022, 4201, 9363, 6854, 5730, 3253, 8519, 8652, 6682, 1831, 8311, 9959, 9565, 3907, 3453, 2396, 3626, 6886, 7587, 2354, 9158, 6151, 9792, 262, 7141, 9367, 2071, 6873, 8242, 7703, 4737, 4139, 5895, 2986, 1600, 8262, 7014, 8545, 4139, 7620, 2340, 3842, 7501, 5004, 7286, 9033, 5313, 9365, 5929, 8897, 4474, 1744, 2572, 8653, 7113, 3818, 7257, 4222, 8925, 1827, 4993, 7485, 5954, 4412, 3596, 4330, 6932, 3951, 1959, 6374, 8968, 5350, 5082, 9253, 4951, 6541, 4940, 9931, 129, 3317, 2253, 54, 6305, 4317, 1725, 8724, 2419, 9792, 489, 7827, 7975, 2695, 3463, 5902, 7858, 8336, 9158, 7442, 1606, 623, 7638, 6338, 479, 3344, 6778, 924, 6049, 4191, 6498, 2629, 621, 4801, 3018, 4392, 514, 251, 7221, 7127, 8485, 8898, 9719, 5692, 2797, 7223, 451, 6498, 5783, 399, 6180, 9272, 9854, 1389, 9651, 5558, 1505, 8125, 1525, 7133, 6105, 3407, 873, 200, 1915, 3431, 9356, 6141, 2083, 2893, 8415, 4667, 1456, 4979, 1204 };
+struct point pts_3[] = { { .x = 19, .y = 10 }, { .x = 32, .y = 11 }, { .x = 66, .y = 71 }, { .x = 46, .y = 67 }, { .x = 27, .y = 45 }, { .x = 15, .y = 60 }, { .x = 11, .y = 60 }, { .x = 82, .y = 53 }, { .x = 89, .y = 91 }, { .x = 89, .y = 44 }, { .x = 1, .y = 76 }, { .x = 6, .y = 35 }, { .x = 96, .y = 7 }, { .x = 47, .y = 97 }, { .x = 38, .y = 66 }, { .x = 77, .y = 34 }, { .x = 83, .y = 24 }, { .x = 19, .y = 32 }, { .x = 61, .y = 10 }, { .x = 60, .y = 92 }, { .x = 67, .y = 74 }, { .x = 81, .y = 86 }, { .x = 26, .y = 96 }, { .x = 53, .y = 11 }, { .x = 6, .y = 32 }, { .x = 47, .y = 75 }, { .x = 16, .y = 23 }, { .x = 67, .y = 76 }, { .x = 75, .y = 5 }, { .x = 53, .y = 36 }, { .x = 72, .y = 10 }, { .x = 85, .y = 70 }, { .x = 93, .y = 27 }, { .x = 6, .y = 88 }, { .x = 97, .y = 49 }, { .x = 90, .y = 27 }, { .x = 17, .y = 12 }, { .x = 18, .y = 65 }, { .x = 81, .y = 27 }, { .x = 53, .y = 44 } };
+void call_3(void)
+{
+    sink(eptr(0xc490), (t2[8]), ecount->b2, 0xb381 > 442, ncount[2] & 413, b2[6], (zx), zx >> gcount[5], 758 || 848, p_tmp->xptr, b[9], (gptr), n2(), ! n[5], hlen == m2[6], 191, qx, 28, ~ rcount, 908, y, qptr[1] ? 0x75b0 : 0x190e, 0x7c58 ? eptr[8] : c_tmp[0], 0x25e, k2, 0xe187 & 948, 181 != 0x6f52, mx ? x[8] : glen[2], 0xaa28 ? 0x5b3f : 0x5e20, c_tmp.uptr, tx(), 888 ? wcount : xlen, dlen(mcount[8], ulen, mptr), gptr[9], (0x58b2), xlen(805, ax[0]), 0x382d, zptr ? r2 : t_tmp[1], nlen, 838 && 0xfa45, mlen[1], h2[9], (zlen[7]), k_tmp(603, qx[6]), 908 - zptr[5], 695, 0x9a7b, 0x748, 782 % 592, 0xdae, v_tmp ? p_tmp : u2[1], 230 ^ 368, rlen[3], 465 >> w, t2 + zx, rptr[9], r(650, dcount[3], qptr[8]), 0xe0a3, b, tx->yptr, bptr / mx[1], 0xf405, (0xd36f), 493, q2 - 674, ~ ccount[7], 0x199d * r_tmp, 169 == r_tmp, 0xca33, & 0xffe3, 0x8da1, kx ? e : v_tmp[2], w.p, ((char *) 0x6bfa), 0x89f8 >= bcount, 235, qx[9] != tlen[3], mcount << m, 0x9be - 474, flen, - bptr, 650, g == ccount[3], mlen, k_tmp[0] ? 603 : 0x553f, 602 < 0x3f64, dcount, s_tmp[4] | ucount, p(mptr[0], zlen[9]), - 0xf903, z(clen[5], 44), 292, fptr.fptr, ((const short) 454), 19 * 0x5dd7, g_tmp[4] == 0x8d9c, plen[2] & scount, 385, mlen[2] - 629, 263 + 239);
+}
+enum { B3_0, B3_1, B3_2, B3_3, B3_4, B3_5, B3_6, B3_7, B3_8, B3_9, B3_10, B3_11, B3_12, B3_13, B3_14, B3_15, B3_16, B3_17, B3_18, B3_19, B3_20, B3_21, B3_22, B3_23, B3_24, B3_25, B3_26, B3_27, B3_28, B3_29, B3_30, B3_31, B3_32, B3_33, B3_34, B3_35, B3_36, B3_37, B3_38, B3_39, B3_40, B3_41, B3_42, B3_43, B3_44, B3_45, B3_46, B3_47, B3_48, B3_49, B3_50, B3_51, B3_52, B3_53, B3_54, B3_55, B3_56, B3_57, B3_58, B3_59, B3_60, B3_61, B3_62, B3_63, B3_64, B3_65, B3_66, B3_67, B3_68, B3_69, B3_70, B3_71, B3_72, B3_73, B3_74, B3_75, B3_76, B3_77, B3_78, B3_79, B3_80, B3_81, B3_82, B3_83, B3_84, B3_85, B3_86, B3_87, B3_88, B3_89, B3_90, B3_91, B3_92, B3_93, B3_94, B3_95, B3_96, B3_97, B3_98, B3_99, B3_100, B3_101, B3_102, B3_103, B3_104, B3_105, B3_106, B3_107, B3_108, B3_109, B3_110, B3_111, B3_112, B3_113, B3_114, B3_115, B3_116, B3_117, B3_118, B3_119, B3_120, B3_121, B3_122, B3_123, B3_124, B3_125, B3_126, B3_127, B3_128, B3_129, B3_130, B3_131, B3_132, B3_133, B3_134, B3_135, B3_136, B3_137, B3_138, B3_139, B3_140, B3_141, B3_142, B3_143, B3_144, B3_145, B3_146, B3_147, B3_148, B3_149 } big_3;
+
+int init_4[] = { 513, 5032, 7015, 7662, 6345, 2702, 1237, 357, 8586, 3344, 2258, 2895, 1867, 6093, 5768, 6245, 532, 4843, 9129, 245, 621, 2547, 1395, 2039, 5668, 5689, 7268, 3784, 5038, 6023, 8485, 2288, 5174, 5907, 7006, 7874, 1873, 4370, 7191, 9118, 8675, 3869, 5233, 8937, 4870, 5348, 9225, 539, 2577, 6237, 6923, 7142, 5149, 3336, 577, 9274, 9590, 9859, 1496, 636, 8827, 4902, 9128, 1844, 9977, 9760, 5454, 3986, 4793, 9509, 4465, 345, 9809, 8020, 287, 2786, 6139, 2116, 9808, 3552, 8870, 4351, 6202, 2352, 7269, 9729, 9475, 5975, 4880, 2650, 2269, 1581, 525, 2550, 2887, 6398, 2643, 2824, 6680, 231, 4476, 7002, 5348, 9251, 3328, 6892, 6460, 4639, 716, 1445, 1769, 9860, 7695, 6909, 1099, 3417, 8204, 4550, 6331, 4608, 5039, 8612, 5287, 2586, 3706, 3274, 4404, 1491, 1207, 1824, 787, 6920, 4024, 1132, 8890, 7211, 8100, 7206, 5986, 2983, 2747, 3623, 704, 7752, 47, 2484, 2420, 3063, 6919, 8818, 287, 8360, 4711, 5245, 7480, 1907, 4018, 8287, 6717, 2795, 2877, 6676, 2211, 4970, 4855, 2725, 6948, 5740, 8202, 4906, 7508, 4387, 5639, 1582, 8395, 5751, 5558, 2079, 5833, 1616, 4380, 1970, 2799, 8583, 3351, 4587, 3597, 7133, 1904, 557, 2624, 4243, 2140, 2407, 1992, 3224, 6288, 9769, 7513, 4780 };
+struct point pts_4[] = { { .x = 6, .y = 37 }, { .x = 46, .y = 67 }, { .x = 17, .y = 84 }, { .x = 87, .y = 68 }, { .x = 76, .y = 96 }, { .x = 55, .y = 35 }, { .x = 73, .y = 1 }, { .x = 91, .y = 46 }, { .x = 12, .y = 59 }, { .x = 58, .y = 5 }, { .x = 1, .y = 52 }, { .x = 26, .y = 75 }, { .x = 80, .y = 21 }, { .x = 98, .y = 79 }, { .x = 21, .y = 63 }, { .x = 89, .y = 28 }, { .x = 20, .y = 8 }, { .x = 4, .y = 24 }, { .x = 19, .y = 92 }, { .x = 11, .y = 44 }, { .x = 13, .y = 7 }, { .x = 31, .y = 87 }, { .x = 47, .y = 24 }, { .x = 88, .y = 11 }, { .x = 82, .y = 21 }, { .x = 67, .y = 60 }, { .x = 39, .y = 1 }, { .x = 77, .y = 63 }, { .x = 18, .y = 14 }, { .x = 82, .y = 29 }, { .x = 3, .y = 81 }, { .x = 37, .y = 66 }, { .x = 62, .y = 69 }, { .x = 3, .y = 41 }, { .x = 37, .y = 82 }, { .x = 51, .y = 72 }, { .x = 58, .y = 30 }, { .x = 90, .y = 49 }, { .x = 44, .y = 7 }, { .x = 47, .y = 7 } };
+void call_4(void)
+{
+    sink(0xd552, 0x423 < ulen, bptr.nptr, gcount[3] >> 603, e_tmp(0x3917, f2[3]), e2[5], 0xeb71 < 333, (0x6574), ((const short) 850), 0xa709, 61 ? 0x759a : 968, w2 > 0xecec, 7, (m_tmp[7]), (643), & gx[6], 405 <= 35, qcount[8] >> g_tmp, ~ rptr, (v_tmp[2]), ~ hx, ((const short) 777), klen && 0xb98d, (4), 0xfc03 != 0x6150, e_tmp, n2 ? 406 : 0xed45, ((int) x2), 750 << uptr[6], 0x3aa7 < c2, dlen >= 606, q_tmp.m, (65), 599 ^ r, (tcount[9]), 0x8ed1 < 0xc7c3, 501, n_tmp[7], qptr + 0x33e5, qlen(v, 583), zcount->ycount, x_tmp[6], hlen->wx, zlen[6] ? q2 : 269, w2[6] ? 152 : 0x1af3, 0x662 * 551, ((unsigned long) 291), ((const short) rptr), b2.fx, dlen > nlen, * 0xd483, p < 0x724b, 0xcfd0, 0xe6d3, rx ^ tcount, vx[4], n_tmp.p_tmp, cx, & mptr, gcount ? dptr : u_tmp, t_tmp[8], s, ((unsigned long) ylen[5]), 412 || e_tmp[5], ulen, 680, 410, m.h, & 836, dptr ? ulen : 281, 879, 0xa211 == 97, 0x7602 || s_tmp[7], pptr->w2, vx, 0xa947, scount ^ c2, hlen[3] != rptr[9], yptr[0], glen[0] && x_tmp, 601 <= 0x11a4, 418, z2.qcount, ((const short) xx), 0x10e2 || ycount, 864 * 151, dptr != 71, e_tmp == wptr[8], 396, 0x8a88, uptr->p_tmp, vlen(377, 638, p[0]), qlen.rx, ((int) acount[7]), ((char *) ulen[6]), p_tmp(), 166, 162 ? nx[3] : 943, fptr.v, r.kx);
+}
+enum { B4_0, B4_1, B4_2, B4_3, B4_4, B4_5, B4_6, B4_7, B4_8, B4_9, B4_10, B4_11, B4_12, B4_13, B4_14, B4_15, B4_16, B4_17, B4_18, B4_19, B4_20, B4_21, B4_22, B4_23, B4_24, B4_25, B4_26, B4_27, B4_28, B4_29, B4_30, B4_31, B4_32, B4_33, B4_34, B4_35, B4_36, B4_37, B4_38, B4_39, B4_40, B4_41, B4_42, B4_43, B4_44, B4_45, B4_46, B4_47, B4_48, B4_49, B4_50, B4_51, B4_52, B4_53, B4_54, B4_55, B4_56, B4_57, B4_58, B4_59, B4_60, B4_61, B4_62, B4_63, B4_64, B4_65, B4_66, B4_67, B4_68, B4_69, B4_70, B4_71, B4_72, B4_73, B4_74, B4_75, B4_76, B4_77, B4_78, B4_79, B4_80, B4_81, B4_82, B4_83, B4_84, B4_85, B4_86, B4_87, B4_88, B4_89, B4_90, B4_91, B4_92, B4_93, B4_94, B4_95, B4_96, B4_97, B4_98, B4_99, B4_100, B4_101, B4_102, B4_103, B4_104, B4_105, B4_106, B4_107, B4_108, B4_109, B4_110, B4_111, B4_112, B4_113, B4_114, B4_115, B4_116, B4_117, B4_118, B4_119, B4_120, B4_121, B4_122, B4_123, B4_124, B4_125, B4_126, B4_127, B4_128, B4_129, B4_130, B4_131, B4_132, B4_133, B4_134, B4_135, B4_136, B4_137, B4_138, B4_139, B4_140, B4_141, B4_142, B4_143, B4_144, B4_145, B4_146, B4_147, B4_148, B4_149 } big_4;
+
+int init_5[] = { 6426, 6084, 725, 711, 1758, 9150, 9284, 3100, 7614, 7854, 1294, 970, 7677, 7948, 865, 2417, 9317, 1956, 2884, 615, 1662, 1429, 3988, 2926, 3262, 3986, 6658, 976, 3981, 912, 8282, 8169, 993, 5610, 2175, 2030, 9822, 1863, 7103, 1830, 250, 4157, 9943, 4479, 7420, 1697, 1761, 8603, 7121, 9428, 8275, 1365, 1659, 1250, 4147, 3690, 1657, 8532, 9569, 9207, 1217, 7472, 842, 2659, 1239, 5931, 8609, 9621, 2249, 6010, 6101, 4208, 3742, 5451, 8197, 8239, 8661, 8283, 8137, 7455, 5159, 9213, 9579, 9469, 4708, 3558, 7630, 8652, 9201, 3573, 5152, 617, 5714, 4391, 6831, 3917, 112, 7245, 8947, 669, 4905, 2927, 6223, 8485, 925, 1891, 4984, 726, 38, 6057, 5127, 426, 2494, 3574, 5844, 6266, 7110, 7146, 6654, 9331, 4795, 271, 7662, 7339, 7491, 8417, 657, 5912, 6423, 884, 8057, 5844, 6435, 8287, 506, 5882, 2551, 446, 4160, 2224, 4206, 4530, 4346, 516, 8633, 2096, 9732, 8450, 7689, 6212, 8899, 1142, 9881, 3818, 4060, 6395, 4056, 4589, 4670, 7410, 5469, 2189, 9533, 5794, 2435, 3820, 3016, 3794, 5623, 9030, 9993, 3835, 7298, 6040, 3717, 4599, 9374, 7096, 3688, 6322, 754, 3739, 7772, 3386, 5188, 7946, 9134, 3532, 2838, 4118, 8481, 6990, 3266, 8110, 3326, 9911, 775, 7965, 7731, 2101 };
+struct point pts_5[] = { { .x = 80, .y = 39 }, { .x = 21, .y = 1 }, { .x = 89, .y = 74 }, { .x = 20, .y = 37 }, { .x = 65, .y = 18 }, { .x = 68, .y = 96 }, { .x = 5, .y = 48 }, { .x = 30, .y = 84 }, { .x = 28, .y = 39 }, { .x = 15, .y = 84 }, { .x = 36, .y = 57 }, { .x = 54, .y = 31 }, { .x = 16, .y = 37 }, { .x = 89, .y = 49 }, { .x = 60, .y = 18 }, { .x = 12, .y = 38 }, { .x = 63, .y = 85 }, { .x = 84, .y = 74 }, { .x = 65, .y = 31 }, { .x = 30, .y = 42 }, { .x = 41, .y = 81 }, { .x = 5, .y = 62 }, { .x = 84, .y = 96 }, { .x = 22, .y = 57 }, { .x = 41, .y = 86 }, { .x = 35, .y = 65 }, { .x = 41, .y = 32 }, { .x = 16, .y = 92 }, { .x = 90, .y = 67 }, { .x = 89, .y = 95 }, { .x = 48, .y = 73 }, { .x = 72, .y = 4 }, { .x = 42, .y = 77 }, { .x = 94, .y = 6 }, { .x = 7, .y = 73 }, { .x = 15, .y = 3 }, { .x = 60, .y = 32 }, { .x = 14, .y = 39 }, { .x = 70, .y = 9 }, { .x = 26, .y = 94 } };
+void call_5(void)
+{
+    sink(0x63ea ? p : wx, uptr, hx(542, fptr, 0x9629), tx ? 615 : 639, & vptr, c_tmp[5] && 0x7400, n, h2[1], 617, - 182, 0xe540 != bx, dcount[3] >> r2, - x_tmp, 0xfcf7 || xptr[3], 15 <= nx[0], kcount.mcount, t_tmp, (0xec55), 376, kptr[0] <= 0xf88, g_tmp.t, (454), c_tmp ? nptr[2] : 0x4a1f, g2, 81 ? zlen : ux[9], ((const short) glen[1]), cptr[0] + rptr[2], 572 >> 420, ((int) b_tmp[3]), c, ux | x2[8], 0xce3b & n_tmp[7], 503, ((int) e), 0x671 <= 919, uptr(735, kx[3]), m.bcount, (slen[6]), - 300, glen->ecount, (ycount[7]), w, b_tmp, nx(391, 0x7b0d), 0xfd8e | aptr, vcount[3] - 0x2644, mptr[1] ? 895 : 0xafbd, acount(qcount, d2), ((int) 671), d2, xcount(hlen[9], c2[9]), 0x9d6f <= 932, 0x13d4, (0x76db), cx[6] - c[6], elen && 0x9244, s->ecount, t[0] != xlen, 65, 0xe3d4, g || 829, ax[0], 938 / 441, pcount.x2, fx[7] || f[0], f[6] ^ 593, g && a[0], mptr, 0x5581 & 535, elen >> n_tmp, ((const short) x[9]), bcount[4] + dptr, 0x946a ^ w_tmp[2], t[8], (0xf3b4), d_tmp(0x724b), q[8], 918 % 0xb4b, mlen + bcount[4], 383 ? xlen[4] : 599, 0x640c, 646, 0xaade, 0x7d3d ? 949 : xx, 524 - 230, x[3] ? wx[6] : 461, kcount, 803, (wcount[1]), glen[8] << w, 277, 0xf39a, * 769, ucount[3], h2->xptr, g_tmp, 653 - 239, uptr.vx, 0x255e - glen, f2 >> n2);
+}
+enum { B5_0, B5_1, B5_2, B5_3, B5_4, B5_5, B5_6, B5_7, B5_8, B5_9, B5_10, B5_11, B5_12, B5_13, B5_14, B5_15, B5_16, B5_17, B5_18, B5_19, B5_20, B5_21, B5_22, B5_23, B5_24, B5_25, B5_26, B5_27, B5_28, B5_29, B5_30, B5_31, B5_32, B5_33, B5_34, B5_35, B5_36, B5_37, B5_38, B5_39, B5_40, B5_41, B5_42, B5_43, B5_44, B5_45, B5_46, B5_47, B5_48, B5_49, B5_50, B5_51, B5_52, B5_53, B5_54, B5_55, B5_56, B5_57, B5_58, B5_59, B5_60, B5_61, B5_62, B5_63, B5_64, B5_65, B5_66, B5_67, B5_68, B5_69, B5_70, B5_71, B5_72, B5_73, B5_74, B5_75, B5_76, B5_77, B5_78, B5_79, B5_80, B5_81, B5_82, B5_83, B5_84, B5_85, B5_86, B5_87, B5_88, B5_89, B5_90, B5_91, B5_92, B5_93, B5_94, B5_95, B5_96, B5_97, B5_98, B5_99, B5_100, B5_101, B5_102, B5_103, B5_104, B5_105, B5_106, B5_107, B5_108, B5_109, B5_110, B5_111, B5_112, B5_113, B5_114, B5_115, B5_116, B5_117, B5_118, B5_119, B5_120, B5_121, B5_122, B5_123, B5_124, B5_125, B5_126, B5_127, B5_128, B5_129, B5_130, B5_131, B5_132, B5_133, B5_134, B5_135, B5_136, B5_137, B5_138, B5_139, B5_140, B5_141, B5_142, B5_143, B5_144, B5_145, B5_146, B5_147, B5_148, B5_149 } big_5;
+
+int init_6[] = { 163, 6839, 8260, 6014, 8036, 8859, 9931, 4223, 4928, 5659, 1511, 1037, 99, 5645, 307, 642, 6049, 7318, 2352, 5663, 8421, 96, 3236, 2437, 7853, 9746, 9889, 3984, 7023, 6911, 6305, 2815, 7900, 2676, 651, 3601, 3334, 6438, 2172, 2372, 3581, 5768, 7166, 8009, 6908, 267, 9899, 271, 565, 9125, 7267, 9586, 4310, 8539, 830, 9488, 1692, 6303, 9060, 4076, 3100, 7343, 4703, 8318, 5587, 750, 3734, 6557, 4838, 6947, 7048, 3565, 2891, 1969, 8870, 2935, 9154, 8861, 9510, 5425, 3871, 4676, 9212, 1676, 1883, 8144, 6646, 6048, 5629, 9647, 5257, 7197, 8920, 949, 1188, 765, 9936, 6899, 5913, 9081, 1847, 8047, 3274, 7582, 7713, 2760, 9838, 7234, 5901, 7482, 9422, 9983, 7395, 6208, 3634, 5822, 5863, 9293, 9188, 278, 9410, 3693, 1748, 489, 989, 6687, 2645, 5442, 1529, 3184, 7477, 9691, 6517, 1636, 3445, 6085, 9387, 7363, 2644, 575, 7352, 6691, 7458, 9221, 715, 5993, 1879, 8820, 9872, 6428, 5248, 5563, 9829, 2563, 5409, 8800, 6294, 2536, 4968, 5057, 8194, 4949, 2726, 4290, 2491, 4901, 2871, 9141, 6408, 5904, 7523, 8573, 8894, 319, 8750, 5349, 4619, 8268, 1751, 7102, 1024, 5955, 9920, 1111, 4454, 8905, 5327, 9543, 6630, 5954, 389, 5318, 5907, 9619, 6935, 868, 1093, 6449, 6826, 3390 };
+struct point pts_6[] = { { .x = 36, .y = 7 }, { .x = 46, .y = 6 }, { .x = 56, .y = 4 }, { .x = 51, .y = 85 }, { .x = 35, .y = 39 }, { .x = 0, .y = 17 }, { .x = 20, .y = 6 }, { .x = 62, .y = 25 }, { .x = 14, .y = 15 }, { .x = 73, .y = 95 }, { .x = 47, .y = 6 }, { .x = 37, .y = 1 }, { .x = 38, .y = 91 }, { .x = 49, .y = 13 }, { .x = 1, .y = 67 }, { .x = 43, .y = 37 }, { .x = 32, .y = 94 }, { .x = 20, .y = 39 }, { .x = 15, .y = 9 }, { .x = 96, .y = 46 }, { .x = 10, .y = 67 }, { .x = 27, .y = 60 }, { .x = 12, .y = 35 }, { .x = 6, .y = 96 }, { .x = 17, .y = 74 }, { .x = 40, .y = 20 }, { .x = 52, .y = 29 }, { .x = 2, .y = 82 }, { .x = 20, .y = 99 }, { .x = 0, .y = 93 }, { .x = 7, .y = 72 }, { .x = 11, .y = 17 }, { .x = 21, .y = 78 }, { .x = 39, .y = 11 }, { .x = 74, .y = 36 }, { .x = 45, .y = 72 }, { .x = 41, .y = 96 }, { .x = 73, .y = 3 }, { .x = 80, .y = 64 }, { .x = 58, .y = 12 } };
+void call_6(void)
+{
+    sink(653, mlen / 375, (b[9]), r_tmp[5] ? alen : 0x6a00, 0x1a61, glen >= 991, ((int) 31), k2(0x6534, 874, q2), 240, ((int) b_tmp[4]), z2, a[9], 925 / ylen[0], b_tmp(176), 0xb0df, ((char *) s_tmp[6]), m(0x79e3), 0x3f3, xx && 0xf91d, 323, 107, 0xa4e8, m.t_tmp, alen[4] % 945, q[2] ^ ulen, 641, 0x7f0d == v2, (pcount[5]), (b2[9]), nx[4], 0xc54e, 0x761e < 0xb428, 254 ? w2[7] : 0x6867, ((unsigned long) qcount[2]), - u2[5], ncount >> 0xdaa, (zx), * 825, 0x24eb / 0x2f55, 871 + rcount[7], (395), rptr(), ((int) 0xfd11), e2(415), g2(), & 437, ucount, 0x2565, 841 ^ 446, ((int) 0x193c), hx, f % fx, 0x57a5, mx[5] || eptr, gptr[1] >> zlen, hptr[4], 890 >> wptr[7], s2 >= xptr, elen[7] + d[6], (840), & mcount[0], yx(), ((int) 487), e_tmp(0xe118, ucount[8], d_tmp), h_tmp[8], w_tmp ? 0x2371 : b2, ((char *) x2), 452, 0x28af ? 910 : r2, x_tmp[3] / 760, b_tmp[9] ? e2 : n2[1], slen, 0x903e + w_tmp[8], 360 >> 783, 0x99c0 ? uptr[3] : 0x9855, 0x198, & d2, p[3], 0x8da6 || 0xbbda, tx->u_tmp, sptr < 979, ~ 213, 329, (0x408c), tptr->kcount, 881 * 687, (0xbf97), ycount[7] ? 0x8604 : n_tmp[8], 659 << qptr[8], 859 ? 0x1c8c : fcount[6], ((unsigned long) 0x1540), pcount(hlen), 0x9a8f || 0x5bbb, 147 <= 0x470c, 0x9665 != g, & qptr[3], 550 != 258, d_tmp->d2, kptr[4], (410));
+}
+enum { B6_0, B6_1, B6_2, B6_3, B6_4, B6_5, B6_6, B6_7, B6_8, B6_9, B6_10, B6_11, B6_12, B6_13, B6_14, B6_15, B6_16, B6_17, B6_18, B6_19, B6_20, B6_21, B6_22, B6_23, B6_24, B6_25, B6_26, B6_27, B6_28, B6_29, B6_30, B6_31, B6_32, B6_33, B6_34, B6_35, B6_36, B6_37, B6_38, B6_39, B6_40, B6_41, B6_42, B6_43, B6_44, B6_45, B6_46, B6_47, B6_48, B6_49, B6_50, B6_51, B6_52, B6_53, B6_54, B6_55, B6_56, B6_57, B6_58, B6_59, B6_60, B6_61, B6_62, B6_63, B6_64, B6_65, B6_66, B6_67, B6_68, B6_69, B6_70, B6_71, B6_72, B6_73, B6_74, B6_75, B6_76, B6_77, B6_78, B6_79, B6_80, B6_81, B6_82, B6_83, B6_84, B6_85, B6_86, B6_87, B6_88, B6_89, B6_90, B6_91, B6_92, B6_93, B6_94, B6_95, B6_96, B6_97, B6_98, B6_99, B6_100, B6_101, B6_102, B6_103, B6_104, B6_105, B6_106, B6_107, B6_108, B6_109, B6_110, B6_111, B6_112, B6_113, B6_114, B6_115, B6_116, B6_117, B6_118, B6_119, B6_120, B6_121, B6_122, B6_123, B6_124, B6_125, B6_126, B6_127, B6_128, B6_129, B6_130, B6_131, B6_132, B6_133, B6_134, B6_135, B6_136, B6_137, B6_138, B6_139, B6_140, B6_141, B6_142, B6_143, B6_144, B6_145, B6_146, B6_147, B6_148, B6_149 } big_6;
+
+int init_7[] = { 5128, 5387, 2651, 7709, 7776, 9581, 5337, 2333, 7560, 4522, 7622, 4852, 7482, 642, 8734, 4733, 9306, 6577, 2500, 7544, 6936, 428, 8702, 8819, 4587, 6237, 152, 2418, 2004, 6297, 546, 9712, 2109, 3888, 7843, 2089, 2693, 7479, 9515, 5977, 4696, 6670, 4764, 4029, 1054, 8553, 7615, 5880, 5753, 8163, 7190, 3261, 4571, 480, 4368, 5077, 3776, 1472, 1481, 4336, 6069, 6728, 5576, 2058, 6252, 3020, 6658, 4680, 8266, 943, 6250, 5875, 5230, 2308, 3099, 5343, 5487, 3525, 6375, 3583, 6561, 9224, 3236, 5348, 4105, 8982, 4013, 4017, 2807, 8144, 861, 611, 3182, 3383, 8869, 54, 6920, 6163, 4157, 7637, 1618, 7649, 9996, 7841, 4438, 7266, 8882, 8960, 5629, 4258, 7929, 8948, 6856, 5931, 8945, 5156, 4011, 1513, 3906, 4000, 4729, 4110, 5990, 8385, 2462, 5293, 925, 7906, 1102, 1676, 3915, 3100, 2072, 8584, 9786, 4850, 1368, 7467, 5549, 9088, 96, 8781, 715, 693, 8659, 5052, 281, 4258, 6488, 7434, 6091, 1924, 1165, 4433, 8556, 6715, 5041, 8433, 9964, 7713, 7344, 2196, 305, 9935, 1772, 6583, 4856, 8618, 6517, 3669, 5817, 6370, 5025, 143, 9949, 4104, 6140, 7740, 2332, 4279, 9235, 4746, 346, 6111, 1521, 3057, 5146, 7378, 8476, 3963, 4865, 5343, 7019, 1403, 1448, 3050, 7434, 7174, 4461, 6208 };
+struct point pts_7[] = { { .x = 14, .y = 14 }, { .x = 44, .y = 74 }, { .x = 44, .y = 0 }, { .x = 12, .y = 88 }, { .x = 34, .y = 89 }, { .x = 87, .y = 91 }, { .x = 25, .y = 84 }, { .x = 39, .y = 31 }, { .x = 30, .y = 89 }, { .x = 10, .y = 6 }, { .x = 9, .y = 88 }, { .x = 47, .y = 39 }, { .x = 80, .y = 64 }, { .x = 11, .y = 37 }, { .x = 52, .y = 30 }, { .x = 58, .y = 32 }, { .x = 45, .y = 28 }, { .x = 90, .y = 29 }, { .x = 68, .y = 97 }, { .x = 62, .y = 14 }, { .x = 63, .y = 30 }, { .x = 42, .y = 4 }, { .x = 56, .y = 34 }, { .x = 94, .y = 44 }, { .x = 88, .y = 43 }, { .x = 41, .y = 72 }, { .x = 66, .y = 42 }, { .x = 70, .y = 46 }, { .x = 84, .y = 23 }, { .x = 64, .y = 49 }, { .x = 59, .y = 86 }, { .x = 6, .y = 29 }, { .x = 41, .y = 93 }, { .x = 17, .y = 53 }, { .x = 38, .y = 90 }, { .x = 82, .y = 41 }, { .x = 27, .y = 7 }, { .x = 72, .y = 83 }, { .x = 96, .y = 51 }, { .x = 89, .y = 24 } };
+void call_7(void)
+{
+    sink(rcount != 0x9be1, 912 << 704, 0xf25b, & 0x35c7, 0x4f83, ulen[8] * h_tmp[1], ((unsigned long) r), 206, 0x9383 > v_tmp[9], - 0x6acd, 0xcc29 >> 0xc938, 0xad80 << 239, xx[5] || 201, 226 == b_tmp[3], ((const short) wx[2]), w_tmp, 0x59b2 ? 57 : p2, 66 ? c2[0] : 0xdc23, ! p, dcount[7], dcount[2] % 143, b_tmp(0x928c), r2[1], fx[4] && sx[9], 694 >= v[9], 280 ? 44 : a, 0x5d44, 912 ? m2 : 468, 1 / 420, zlen ? h2 : slen, uptr[0] >> 748, nptr(250, f[2], 0x6776), 0x72a7 == y2, dptr, a2[3] << 761, a.wx, wptr(hx[6], 333, 0xd34d), & w2[2], hx == ecount, 0x4786 < cptr[5], ((unsigned long) flen[3]), 982, * k, ((int) 0x6d9a), tptr[0] ? 286 : 0xa5e0, (0xe540), qx->cx, dx[7] || y_tmp, gptr->hlen, nx(r, dlen), 0x6be6 + zlen, 872 && 362, 423 + fcount, gptr->ucount, (a2), (x2[6]), ecount[2] ? 123 : rcount[7], zptr[7] - u_tmp[8], 161 <= 0x3ce1, (739), 814 != qptr, ax, - dx[1], tlen[6] * zptr, eptr[9] | 450, 42, 991 & wx[1], u[6] & 0xa3f7, 0xa2bd, kptr[6] || 0xcb72, & mx[7], 0x3cfc > 154, mptr ^ t2, 0xd1ad ^ y_tmp[2], 514 * xlen, z2[8] % pptr, 150 || 0x9ec2, ycount(0xd372), dptr[9] != m2[9], mptr[9] || wlen[8], - 203, ux, (329), mptr[3], - c2[3], y_tmp[0], 0x20c7 <= 0xa284, * 423, (c), ecount, 0x293a << xlen[3], ~ 128, * ax[6], ncount[4], (0x9973), z2, xx(451, glen), fptr(0x24d8, 129, 0x13a4), (rcount), e_tmp);
+}
+enum { B7_0, B7_1, B7_2, B7_3, B7_4, B7_5, B7_6, B7_7, B7_8, B7_9, B7_10, B7_11, B7_12, B7_13, B7_14, B7_15, B7_16, B7_17, B7_18, B7_19, B7_20, B7_21, B7_22, B7_23, B7_24, B7_25, B7_26, B7_27, B7_28, B7_29, B7_30, B7_31, B7_32, B7_33, B7_34, B7_35, B7_36, B7_37, B7_38, B7_39, B7_40, B7_41, B7_42, B7_43, B7_44, B7_45, B7_46, B7_47, B7_48, B7_49, B7_50, B7_51, B7_52, B7_53, B7_54, B7_55, B7_56, B7_57, B7_58, B7_59, B7_60, B7_61, B7_62, B7_63, B7_64, B7_65, B7_66, B7_67, B7_68, B7_69, B7_70, B7_71, B7_72, B7_73, B7_74, B7_75, B7_76, B7_77, B7_78, B7_79, B7_80, B7_81, B7_82, B7_83, B7_84, B7_85, B7_86, B7_87, B7_88, B7_89, B7_90, B7_91, B7_92, B7_93, B7_94, B7_95, B7_96, B7_97, B7_98, B7_99, B7_100, B7_101, B7_102, B7_103, B7_104, B7_105, B7_106, B7_107, B7_108, B7_109, B7_110, B7_111, B7_112, B7_113, B7_114, B7_115, B7_116, B7_117, B7_118, B7_119, B7_120, B7_121, B7_122, B7_123, B7_124, B7_125, B7_126, B7_127, B7_128, B7_129, B7_130, B7_131, B7_132, B7_133, B7_134, B7_135, B7_136, B7_137, B7_138, B7_139, B7_140, B7_141, B7_142, B7_143, B7_144, B7_145, B7_146, B7_147, B7_148, B7_149 } big_7;
+
+int init_8[] = { 4728, 2796, 5336, 4206, 1857, 2601, 7685, 7150, 1551, 8413, 9120, 5196, 2288, 9302, 330, 9133, 5753, 2689, 8495, 7561, 4230, 1733, 7558, 5777, 8413, 6910, 4605, 6774, 9506, 5415, 9226, 8735, 1367, 6087, 8555, 3978, 5780, 9545, 6853, 8298, 9894, 1712, 8860, 5669, 1622, 383, 4271, 5536, 2047, 7077, 2675, 2062, 4599, 3461, 6549, 6017, 6718, 128, 4804, 8819, 1487, 8953, 5634, 1144, 335, 4866, 951, 3420, 5074, 3737, 4695, 5052, 1745, 1219, 838, 9480, 1809, 4187, 7147, 5829, 9576, 1012, 7561, 3858, 8349, 5769, 4831, 5450, 1066, 7493, 2607, 2623, 5652, 8365, 7219, 4020, 3534, 5496, 3356, 8370, 21, 1164, 3273, 8540, 4629, 1242, 8623, 8778, 4087, 3318, 1341, 7167, 2802, 8717, 4532, 8523, 8772, 4180, 7377, 4710, 3728, 9894, 5535, 9776, 76, 3213, 3003, 8343, 7049, 8385, 9029, 7171, 8184, 8755, 8042, 5970, 1484, 9544, 6443, 5132, 1140, 2117, 4600, 8278, 7942, 8721, 3766, 1385, 699, 8832, 4669, 1696, 1225, 7192, 9780, 5457, 5804, 6282, 5600, 138, 5983, 7610, 2560, 4832, 82, 5325, 6531, 5665, 9393, 1067, 9854, 8582, 9980, 8757, 3419, 358, 8982, 5916, 2374, 1084, 5138, 9129, 1070, 5293, 7930, 231, 1109, 9510, 9162, 339, 9527, 7233, 2134, 1673, 9176, 7432, 6193, 6148, 6698, 8708 };
+struct point pts_8[] = { { .x = 58, .y = 66 }, { .x = 35, .y = 57 }, { .x = 29, .y = 81 }, { .x = 63, .y = 97 }, { .x = 47, .y = 89 }, { .x = 8, .y = 72 }, { .x = 72, .y = 25 }, { .x = 47, .y = 29 }, { .x = 75, .y = 83 }, { .x = 59, .y = 18 }, { .x = 2, .y = 84 }, { .x = 19, .y = 44 }, { .x = 79, .y = 16 }, { .x = 22, .y = 53 }, { .x = 58, .y = 47 }, { .x = 18, .y = 80 }, { .x = 98, .y = 73 }, { .x = 44, .y = 76 }, { .x = 2, .y = 68 }, { .x = 33, .y = 91 }, { .x = 60, .y = 36 }, { .x = 26, .y = 15 }, { .x = 28, .y = 36 }, { .x = 50, .y = 67 }, { .x = 79, .y = 93 }, { .x = 71, .y = 17 }, { .x = 57, .y = 67 }, { .x = 62, .y = 44 }, { .x = 24, .y = 6 }, { .x = 86, .y = 53 }, { .x = 96, .y = 14 }, { .x = 95, .y = 1 }, { .x = 90, .y = 1 }, { .x = 80, .y = 59 }, { .x = 18, .y = 77 }, { .x = 84, .y = 58 }, { .x = 7, .y = 70 }, { .x = 15, .y = 27 }, { .x = 61, .y = 90 }, { .x = 69, .y = 69 } };
+void call_8(void)
+{
+    sink(0x18c3 - vcount, qx->c_tmp, 391 ? aptr[5] : 438, 44 % d_tmp[8], tx(0x6aa1), q->k, nptr[0], 0xd036, qptr->r_tmp, 428 ? 627 : 795, ex == hcount[1], 0xd879 >= 0xa44e, hx(v_tmp[8], vptr), b2, k2[9], 313, g2[2], mptr && 0x2067, pptr[8] ? qlen : hlen[3], 478, (488), z_tmp[1], nlen * m2, ((const short) 427), e_tmp[6] > 0xbb49, (sx[8]), r_tmp ? c_tmp[2] : x, vptr, 47 - 134, 0xa5a2 ? z2 : n_tmp[3], 0xd832 >= tcount, vcount[1] < g_tmp, y2, 800, 0xe2e7, 634 ? kptr[0] : 0x8084, ! elen[9], 0x505f << wlen[6], hcount[2] ? m_tmp : 587, 500 >> 889, f2 | 0x457c, 765 || 0x7c3, d->d, 0x77f0 ? 475 : 0x38b5, w2->wx, ((const short) q[4]), r_tmp[9] * z[5], ((unsigned long) d2[6]), 0xdf03 ? 310 : m, (244), 0x4ec1 / rptr, x->kx, ((const short) ucount[1]), 0x93d1, ! 0x4aab, v_tmp[8] ^ s2[4], a_tmp[8] || 29, 893, (0x2dbb), 670, - t[4], y_tmp[4], ((int) 0x661a), scount[9] <= hx, wlen(0x4dad), 0xdf4b, 0x66b9 ? s[4] : q_tmp[1], ((int) y_tmp[6]), 0x24d8 & clen, 971 ? wlen : 557, (ycount[5]), 912, (flen), fptr[8] * rcount[2], ! s2[6], 340 > ax, 622 ? 0x6082 : 931, ccount, ((const short) qx), k_tmp.p, ux(0x4c48, yptr, 659), e2(0x679, dcount), 22 | 903, pcount ? wcount[7] : 0x3516, gptr->qcount, xcount->xlen, 596 >= x_tmp[2], ccount >= 778, 739 | 959, tcount || 338, tlen ? flen : sx[5], s(), ((const short) wlen[3]), z_tmp.a2, rcount->ccount, 453 || a[2], y_tmp->m, s_tmp[0], z2.ccount, clen.yptr);
+}
+enum { B8_0, B8_1, B8_2, B8_3, B8_4, B8_5, B8_6, B8_7, B8_8, B8_9, B8_10, B8_11, B8_12, B8_13, B8_14, B8_15, B8_16, B8_17, B8_18, B8_19, B8_20, B8_21, B8_22, B8_23, B8_24, B8_25, B8_26, B8_27, B8_28, B8_29, B8_30, B8_31, B8_32, B8_33, B8_34, B8_35, B8_36, B8_37, B8_38, B8_39, B8_40, B8_41, B8_42, B8_43, B8_44, B8_45, B8_46, B8_47, B8_48, B8_49, B8_50, B8_51, B8_52, B8_53, B8_54, B8_55, B8_56, B8_57, B8_58, B8_59, B8_60, B8_61, B8_62, B8_63, B8_64, B8_65, B8_66, B8_67, B8_68, B8_69, B8_70, B8_71, B8_72, B8_73, B8_74, B8_75, B8_76, B8_77, B8_78, B8_79, B8_80, B8_81, B8_82, B8_83, B8_84, B8_85, B8_86, B8_87, B8_88, B8_89, B8_90, B8_91, B8_92, B8_93, B8_94, B8_95, B8_96, B8_97, B8_98, B8_99, B8_100, B8_101, B8_102, B8_103, B8_104, B8_105, B8_106, B8_107, B8_108, B8_109, B8_110, B8_111, B8_112, B8_113, B8_114, B8_115, B8_116, B8_117, B8_118, B8_119, B8_120, B8_121, B8_122, B8_123, B8_124, B8_125, B8_126, B8_127, B8_128, B8_129, B8_130, B8_131, B8_132, B8_133, B8_134, B8_135, B8_136, B8_137, B8_138, B8_139, B8_140, B8_141, B8_142, B8_143, B8_144, B8_145, B8_146, B8_147, B8_148, B8_149 } big_8;
+
+int init_9[] = { 5679, 9390, 2089, 549, 9352, 4808, 204, 4290, 3294, 561, 5306, 195, 8453, 5168, 5694, 3418, 9446, 4905, 4381, 5653, 30, 7458, 6014, 1284, 8743, 1347, 3176, 6330, 5116, 5576, 5266, 4055, 8992, 2362, 2891, 8731, 2109, 3620, 3626, 4153, 557, 4136, 696, 8599, 8076, 2119, 1197, 6645, 9341, 989, 3693, 503, 3515, 2088, 4420, 8679, 938, 2952, 6898, 818, 9732, 187, 7488, 5572, 4846, 1140, 3452, 4882, 3195, 20, 4033, 5508, 6848, 7774, 335, 7263, 6844, 9996, 245, 6092, 7831, 8100, 6560, 7751, 1661, 8791, 4589, 4767, 9626, 4704, 2330, 3425, 2939, 6446, 1776, 3862, 6228, 6414, 6784, 6537, 1172, 3359, 2756, 5406, 176, 8949, 7141, 9610, 5348, 97, 4252, 8884, 6252, 1008, 9511, 9286, 6624, 9480, 3340, 901, 2442, 7472, 1563, 3274, 8007, 419, 1124, 2624, 9498, 9301, 7050, 7476, 5125, 5654, 9327, 376, 3442, 3, 1394, 311, 9443, 6968, 878, 4239, 6112, 319, 7760, 2687, 5454, 2459, 5269, 2896, 7915, 9876, 7805, 6417, 8561, 708, 8086, 8581, 3064, 1332, 2436, 6036, 2467, 7489, 3141, 9421, 8570, 8462, 3361, 2711, 30, 2410, 1536, 438, 154, 3336, 2144, 1595, 7610, 8193, 7110, 2182, 5704, 6665, 8948, 4942, 5391, 4055, 2407, 6027, 9151, 1723, 5712, 7881, 8165, 5073, 4306, 8662 };
+struct point pts_9[] = { { .x = 53, .y = 48 }, { .x = 19, .y = 93 }, { .x = 12, .y = 90 }, { .x = 80, .y = 66 }, { .x = 56, .y = 90 }, { .x = 81, .y = 16 }, { .x = 7, .y = 65 }, { .x = 77, .y = 34 }, { .x = 47, .y = 26 }, { .x = 73, .y = 38 }, { .x = 49, .y = 76 }, { .x = 83, .y = 25 }, { .x = 17, .y = 39 }, { .x = 98, .y = 62 }, { .x = 19, .y = 19 }, { .x = 50, .y = 11 }, { .x = 47, .y = 42 }, { .x = 96, .y = 11 }, { .x = 87, .y = 96 }, { .x = 37, .y = 3 }, { .x = 45, .y = 4 }, { .x = 56, .y = 70 }, { .x = 29, .y = 16 }, { .x = 62, .y = 53 }, { .x = 95, .y = 82 }, { .x = 32, .y = 1 }, { .x = 16, .y = 69 }, { .x = 49, .y = 77 }, { .x = 81, .y = 61 }, { .x = 95, .y = 90 }, { .x = 37, .y = 65 }, { .x = 98, .y = 82 }, { .x = 92, .y = 1 }, { .x = 88, .y = 53 }, { .x = 28, .y = 42 }, { .x = 19, .y = 53 }, { .x = 79, .y = 3 }, { .x = 20, .y = 79 }, { .x = 44, .y = 96 }, { .x = 6, .y = 42 } };
+void call_9(void)
+{
+    sink(((const short) q2), a[0], 552, ((char *) 730), * wlen[2], glen[9] >> 410, h_tmp, 974, 197 * 748, d2 << t[4], eptr ? slen : 0xf9c2, 134 ? w_tmp[1] : rcount[3], s, s2[3], 491 ? 0xbeac : 0xe716, r2(0xf97e, 272), 318 <= 981, (0xfed4), xx.ex, ((char *) 0x17b6), - a, a2[4], kx, dlen[0], ((int) 0x1f84), 665 << 936, vptr(605, gcount), 572, ((int) u), (vx), c_tmp[2] && e_tmp[1], - 945, ((const short) 0x9662), 958, e_tmp, sx->w2, mptr[3] ? 0x7561 : slen, 732 | eptr, sx[1] | 0xba2e, y2 ? c[0] : ucount[8], (0x41e4), x_tmp[8], ex->tx, m * 860, 989, 904, n2[4] * 0xfc13, r2.bptr, 0x9501 < 345, ((const short) g2[9]), (0x58c7), 582 ^ 0x46de, ((int) rlen), e2, 368, 179, (xcount), (12), ! 0x922, & yptr, 419 >= fptr, aptr % 0x3b1b, qcount == 773, * gptr[2], clen->e, ((unsigned long) 0xd718), 684 + 0xd4f1, qcount | 195, 47 == 0xe0a4, h2 + v_tmp, 974 <= gcount, 752, aptr.qlen, acount, v_tmp(584, rlen[6]), 0xc8ab, n[2] | 329, ((const short) kx), kcount->g_tmp, 618 ^ zptr[4], 617, 494 ^ s_tmp[3], k_tmp(plen), k_tmp ? d_tmp[6] : 0xd9ba, y->wx, 0xb04c, ((char *) c[6]), (0xa91d), 0xc990 - 78, nx(), tx[7] <= c_tmp[1], h.a, * 0xa1e5, 837, h2[2], 858 << n[2], ! ylen, 0xc64 % 564, 0x3d66, mcount);
+}
+enum { B9_0, B9_1, B9_2, B9_3, B9_4, B9_5, B9_6, B9_7, B9_8, B9_9, B9_10, B9_11, B9_12, B9_13, B9_14, B9_15, B9_16, B9_17, B9_18, B9_19, B9_20, B9_21, B9_22, B9_23, B9_24, B9_25, B9_26, B9_27, B9_28, B9_29, B9_30, B9_31, B9_32, B9_33, B9_34, B9_35, B9_36, B9_37, B9_38, B9_39, B9_40, B9_41, B9_42, B9_43, B9_44, B9_45, B9_46, B9_47, B9_48, B9_49, B9_50, B9_51, B9_52, B9_53, B9_54, B9_55, B9_56, B9_57, B9_58, B9_59, B9_60, B9_61, B9_62, B9_63, B9_64, B9_65, B9_66, B9_67, B9_68, B9_69, B9_70, B9_71, B9_72, B9_73, B9_74, B9_75, B9_76, B9_77, B9_78, B9_79, B9_80, B9_81, B9_82, B9_83, B9_84, B9_85, B9_86, B9_87, B9_88, B9_89, B9_90, B9_91, B9_92, B9_93, B9_94, B9_95, B9_96, B9_97, B9_98, B9_99, B9_100, B9_101, B9_102, B9_103, B9_104, B9_105, B9_106, B9_107, B9_108, B9_109, B9_110, B9_111, B9_112, B9_113, B9_114, B9_115, B9_116, B9_117, B9_118, B9_119, B9_120, B9_121, B9_122, B9_123, B9_124, B9_125, B9_126, B9_127, B9_128, B9_129, B9_130, B9_131, B9_132, B9_133, B9_134, B9_135, B9_136, B9_137, B9_138, B9_139, B9_140, B9_141, B9_142, B9_143, B9_144, B9_145, B9_146, B9_147, B9_148, B9_149 } big_9;
+
+int init_10[] = { 4053, 266, 159, 5329, 3072, 824, 9018, 2673, 2013, 7397, 1314, 3165, 6196, 8674, 312, 7240, 320, 8790, 5580, 5796, 8167, 7276, 6605, 7649, 7080, 7302, 8161, 1597, 69, 4477, 469, 9568, 8987, 6053, 4339, 9741, 6407, 6362, 7301, 7063, 2952, 6674, 9033, 3632, 9329, 5767, 3028, 8262, 4831, 8260, 9198, 985, 1768, 7184, 949, 3306, 7823, 3203, 4558, 9741, 6203, 8210, 3502, 3562, 6522, 4149, 2805, 7119, 4932, 8030, 8589, 9978, 9356, 1470, 7347, 7943, 355, 9186, 6717, 3046, 9133, 9877, 7435, 7479, 9170, 2075, 6769, 4992, 5464, 2780, 6079, 2441, 935, 8975, 5926, 2196, 544, 4674, 1867, 8347, 9483, 3965, 1474, 7488, 5016, 1040, 5015, 893, 8814, 9745, 1119, 157, 4072, 2092, 2896, 2357, 3715, 3734, 1503, 385, 5728, 1661, 9808, 7518, 8486, 256, 4601, 8235, 1708, 265, 6232, 3124, 4613, 6537, 1491, 5315, 7471, 7557, 7192, 9930, 1714, 544, 7228, 7379, 9058, 5283, 8246, 11, 3111, 1202, 7974, 1934, 6705, 5186, 6581, 1883, 6957, 7814, 140, 261, 3087, 3425, 2067, 3186, 8280, 673, 6358, 4465, 7378, 122, 1388, 8331, 4599, 4403, 5642, 5475, 7855, 4271, 9678, 4787, 9426, 1451, 6243, 5796, 9865, 8383, 1355, 1464, 6741, 6482, 9092, 1334, 5407, 8576, 7251, 5328, 3373, 9324, 9050, 1271 };
+struct point pts_10[] = { { .x = 54, .y = 62 }, { .x = 3, .y = 40 }, { .x = 47, .y = 83 }, { .x = 12, .y = 83 }, { .x = 12, .y = 32 }, { .x = 81, .y = 47 }, { .x = 59, .y = 39 }, { .x = 0, .y = 89 }, { .x = 12, .y = 63 }, { .x = 40, .y = 56 }, { .x = 2, .y = 83 }, { .x = 33, .y = 30 }, { .x = 78, .y = 25 }, { .x = 19, .y = 5 }, { .x = 67, .y = 29 }, { .x = 31, .y = 15 }, { .x = 42, .y = 77 }, { .x = 46, .y = 18 }, { .x = 91, .y = 12 }, { .x = 59, .y = 88 }, { .x = 13, .y = 39 }, { .x = 89, .y = 94 }, { .x = 22, .y = 55 }, { .x = 66, .y = 62 }, { .x = 93, .y = 50 }, { .x = 57, .y = 61 }, { .x = 9, .y = 89 }, { .x = 80, .y = 60 }, { .x = 14, .y = 90 }, { .x = 18, .y = 25 }, { .x = 96, .y = 83 }, { .x = 68, .y = 67 }, { .x = 82, .y = 67 }, { .x = 86, .y = 92 }, { .x = 22, .y = 59 }, { .x = 64, .y = 74 }, { .x = 86, .y = 91 }, { .x = 2, .y = 78 }, { .x = 37, .y = 89 }, { .x = 53, .y = 96 } };
+void call_10(void)
+{
+    sink(676, 0x5e93, w[5] - v2, mx(81, g2, 0xe4a8), 956 ? 0x2707 : 0xc62, t[9] ? 244 : 384, 0x894, b2.zx, v_tmp[7] | 0xe39f, k_tmp[5] ? r2[8] : 0xa935, ~ 727, (0x45ef), rlen[2], 0x99d8 ? 0x46da : 282, zx, dx(622), 0xe0d0, 0xea06 ? 0x65b5 : 192, ecount(), x2(u_tmp[3], 0xcbb5), ((char *) mcount), alen[5] ? 376 : w_tmp[2], gcount - 0xf1d3, 0xe517 < rcount, rptr, (868), 0x970 < cptr, ((char *) 0xbf9), rx(125, 0x131f), x_tmp->d2, b2.dlen, xptr, 887 < 979, (rcount), aptr, 812 > bcount[9], 906 ? ylen : 0xb801, sx.k, 634 ^ u2, slen.vlen, cx[4] ? ulen : 299, * 0xfc22, 0x573, 0x9968, fptr(410, 0xf879, q2), cptr[1] * 421, 0xacba, 331, ! 0xd083, 439, 575 ? 970 : zlen, nlen->m2, f > rcount, ((unsigned long) 482), * 0xb33c, 166, rx->vptr, (ecount), 567 % hlen[9], rcount.r_tmp, 0x9175, fcount[7], p[5] >= 0x89ea, 0x9249 ^ rptr, k2(257, 0xdbc5), p_tmp[1], 2, 403 ? 804 : x[6], (365), g_tmp[6], wx(), ((char *) 0x8915), 0x5261 * 276, 0x4be2 < 512, ((char *) 0x4bdd), plen, k2 ? gcount[0] : mptr, plen.f2, (0x2556), 0x4934 ? 135 : 639, 0x38b8 || wlen[3], ! blen, 0xdc7d ? 0xedbe : dptr[1], 443 ? h_tmp[7] : pptr[0], 815 / mcount, r(), vlen[9] & dptr, 504, k2[8] != 168, 0xbf83 ? 0xf7be : 556, tcount / 288, 0xaad, kx | 0x317, x(k, 713, n_tmp), 0x8066 || 0x237b, - bptr[5], 519 * qlen, acount(vlen, scount[6]), 348 ? r[8] : 0x6e3d, sx);
+}
+enum { B10_0, B10_1, B10_2, B10_3, B10_4, B10_5, B10_6, B10_7, B10_8, B10_9, B10_10, B10_11, B10_12, B10_13, B10_14, B10_15, B10_16, B10_17, B10_18, B10_19, B10_20, B10_21, B10_22, B10_23, B10_24, B10_25, B10_26, B10_27, B10_28, B10_29, B10_30, B10_31, B10_32, B10_33, B10_34, B10_35, B10_36, B10_37, B10_38, B10_39, B10_40, B10_41, B10_42, B10_43, B10_44, B10_45, B10_46, B10_47, B10_48, B10_49, B10_50, B10_51, B10_52, B10_53, B10_54, B10_55, B10_56, B10_57, B10_58, B10_59, B10_60, B10_61, B10_62, B10_63, B10_64, B10_65, B10_66, B10_67, B10_68, B10_69, B10_70, B10_71, B10_72, B10_73, B10_74, B10_75, B10_76, B10_77, B10_78, B10_79, B10_80, B10_81, B10_82, B10_83, B10_84, B10_85, B10_86, B10_87, B10_88, B10_89, B10_90, B10_91, B10_92, B10_93, B10_94, B10_95, B10_96, B10_97, B10_98, B10_99, B10_100, B10_101, B10_102, B10_103, B10_104, B10_105, B10_106, B10_107, B10_108, B10_109, B10_110, B10_111, B10_112, B10_113, B10_114, B10_115, B10_116, B10_117, B10_118, B10_119, B10_120, B10_121, B10_122, B10_123, B10_124, B10_125, B10_126, B10_127, B10_128, B10_129, B10_130, B10_131, B10_132, B10_133, B10_134, B10_135, B10_136, B10_137, B10_138, B10_139, B10_140, B10_141, B10_142, B10_143, B10_144, B10_145, B10_146, B10_147, B10_148, B10_149 } big_10;
+
+int init_11[] = { 4438, 1762, 9977, 8711, 2388, 8113, 6310, 74, 3483, 6834, 4128, 680, 5192, 1288, 2091, 1714, 5491, 5109, 9216, 3892, 2418, 1588, 6973, 8651, 6200, 355, 9311, 1855, 3061, 9572, 4882, 6325, 9537, 6664, 8370, 727, 1520, 3820, 6198, 2996, 2791, 2583, 5052, 6312, 8716, 9028, 791, 6523, 8080, 8674, 6316, 7053, 9474, 1193, 4563, 9663, 4994, 2754, 8835, 935, 2273, 1670, 4732, 4826, 1823, 8839, 4504, 1945, 8890, 3125, 6817, 7735, 5386, 2183, 9655, 3106, 9502, 7343, 5643, 8441, 5653, 7965, 2009, 7771, 5122, 6333, 4533, 4251, 6756, 111, 4022, 3461, 7322, 9310, 707, 6537, 272, 8534, 1103, 9026, 635, 7303, 6502, 2535, 8860, 7223, 964, 5835, 5040, 2139, 776, 4588, 2964, 118, 6453, 3308, 6885, 444, 2247, 2418, 6569, 2200, 6775, 7386, 4041, 3522, 4004, 5602, 163, 4066, 7736, 4934, 3656, 8547, 9147, 3497, 2657, 9961, 6785, 9844, 8458, 1247, 9547, 415, 3362, 3786, 4043, 5455, 9005, 3155, 91, 6389, 4044, 7198, 2255, 8292, 509, 7055, 6841, 7578, 978, 4164, 7903, 8166, 9169, 5089, 2154, 6375, 2062, 2950, 4390, 4442, 386, 1056, 1130, 8840, 2896, 5811, 2964, 5498, 1026, 861, 4436, 7285, 1212, 7724, 8814, 8912, 3008, 8533, 782, 9778, 7651, 4363, 9253, 502, 1355, 1814, 5676, 3789 };
+struct point pts_11[] = { { .x = 19, .y = 33 }, { .x = 66, .y = 6 }, { .x = 81, .y = 48 }, { .x = 91, .y = 4 }, { .x = 88, .y = 30 }, { .x = 62, .y = 72 }, { .x = 40, .y = 59 }, { .x = 3, .y = 66 }, { .x = 58, .y = 37 }, { .x = 40, .y = 99 }, { .x = 30, .y = 4 }, { .x = 47, .y = 2 }, { .x = 77, .y = 65 }, { .x = 76, .y = 33 }, { .x = 72, .y = 64 }, { .x = 44, .y = 61 }, { .x = 21, .y = 80 }, { .x = 81, .y = 38 }, { .x = 68, .y = 33 }, { .x = 0, .y = 25 }, { .x = 21, .y = 73 }, { .x = 64, .y = 24 }, { .x = 26, .y = 63 }, { .x = 82, .y = 47 }, { .x = 3, .y = 50 }, { .x = 9, .y = 21 }, { .x = 27, .y = 16 }, { .x = 8, .y = 57 }, { .x = 62, .y = 80 }, { .x = 14, .y = 97 }, { .x = 62, .y = 72 }, { .x = 14, .y = 4 }, { .x = 7, .y = 15 }, { .x = 7, .y = 16 }, { .x = 74, .y = 75 }, { .x = 68, .y = 97 }, { .x = 34, .y = 85 }, { .x = 72, .y = 54 }, { .x = 89, .y = 67 }, { .x = 24, .y = 76 } };
+void call_11(void)
+{
+    sink(klen[5] & x2, ! z_tmp, & 718, k_tmp[5], wcount != gcount, 0xa5cd <= hlen[0], y[0] > 297, v(), rx << e2[4], 339 & wptr, ((char *) wx), ~ eptr, blen->g2, 0x7d47 <= mx, 850 | zptr, wcount, g->n, t2.n, z << 0xcc37, ((int) n_tmp[4]), e2[7] | sx[6], 0xebde, 0x2148, ((int) y_tmp), r_tmp(cptr[3]), q2 != zx, (n_tmp), bptr->h2, f_tmp / plen, ulen[4] - 0x46a8, 756, 576, bcount[5] != rx, ucount[2], xcount < rptr[4], (0x72d), q2(0x6, 747, 0x8de5), m2 == 907, (851), vptr.z_tmp, 0xec04 && 24, * d2[8], 682 ? kcount[1] : y_tmp, qlen, s2[4] || v2[4], & mcount[1], (88), ax(t_tmp[1]), vptr.tcount, y, 0xcfbd ? 0xe766 : z[3], 962, ecount, 0xa36d, ((const short) 277), 30 ^ gcount[8], 0xc798 >= 0x6fca, ((char *) mptr), 0x91dd, (yptr), 0xd8b4 | 0x648a, (0x4013), ! 592, ((char *) 20), x_tmp[2] != fcount[7], 0x4ac6 || flen[0], - b2[1], nx[4] >> 976, cptr[8], ((unsigned long) tx[3]), 77, 251, ux[1] <= 182, hptr.xx, (mptr[5]), bcount(), ((int) v), hcount >= 897, tx.qcount, ((unsigned long) y_tmp[2]), h | 252, 38 << 981, klen % yptr[3], aptr.alen, x2.fcount, ((unsigned long) zptr[0]), 163 > v_tmp, (0xfb7a), w, h->flen, qcount >= 75, q_tmp[6] | 0x56ee, 0x5d20, y[9] >> gptr, 0x1f72, xptr[3] % 809, bcount[2] <= 0xf489, & 808, 522 >> 493, p2 ^ 870);
+}
+enum { B11_0, B11_1, B11_2, B11_3, B11_4, B11_5, B11_6, B11_7, B11_8, B11_9, B11_10, B11_11, B11_12, B11_13, B11_14, B11_15, B11_16, B11_17, B11_18, B11_19, B11_20, B11_21, B11_22, B11_23, B11_24, B11_25, B11_26, B11_27, B11_28, B11_29, B11_30, B11_31, B11_32, B11_33, B11_34, B11_35, B11_36, B11_37, B11_38, B11_39, B11_40, B11_41, B11_42, B11_43, B11_44, B11_45, B11_46, B11_47, B11_48, B11_49, B11_50, B11_51, B11_52, B11_53, B11_54, B11_55, B11_56, B11_57, B11_58, B11_59, B11_60, B11_61, B11_62, B11_63, B11_64, B11_65, B11_66, B11_67, B11_68, B11_69, B11_70, B11_71, B11_72, B11_73, B11_74, B11_75, B11_76, B11_77, B11_78, B11_79, B11_80, B11_81, B11_82, B11_83, B11_84, B11_85, B11_86, B11_87, B11_88, B11_89, B11_90, B11_91, B11_92, B11_93, B11_94, B11_95, B11_96, B11_97, B11_98, B11_99, B11_100, B11_101, B11_102, B11_103, B11_104, B11_105, B11_106, B11_107, B11_108, B11_109, B11_110, B11_111, B11_112, B11_113, B11_114, B11_115, B11_116, B11_117, B11_118, B11_119, B11_120, B11_121, B11_122, B11_123, B11_124, B11_125, B11_126, B11_127, B11_128, B11_129, B11_130, B11_131, B11_132, B11_133, B11_134, B11_135, B11_136, B11_137, B11_138, B11_139, B11_140, B11_141, B11_142, B11_143, B11_144, B11_145, B11_146, B11_147, B11_148, B11_149 } big_11;
+
+int init_12[] = { 7374, 9240, 6565, 6681, 7356, 8620, 5276, 4156, 6531, 3382, 4121, 7004, 3810, 1672, 6186, 5148, 3745, 8728, 104, 4229, 3566, 5232, 5201, 5883, 3156, 3409, 4064, 1269, 5191, 4573, 1319, 8951, 8375, 9315, 5901, 5492, 2395, 5373, 6318, 1450, 5216, 2099, 6738, 3408, 5907, 6752, 3830, 7674, 9877, 3808, 5047, 917, 7177, 6056, 5889, 8589, 2780, 8058, 6662, 8382, 206, 6647, 7894, 5133, 4260, 9550, 5756, 8525, 4698, 2666, 8074, 1430, 9344, 2690, 416, 3770, 3698, 9604, 2077, 6650, 5362, 9631, 3053, 6582, 3763, 6359, 5438, 9220, 8793, 7451, 1191, 8766, 3081, 6935, 9078, 7503, 244, 3123, 5329, 6475, 9380, 7866, 3973, 4164, 1142, 8110, 3219, 3682, 5965, 5807, 9777, 7439, 3449, 4498, 3011, 7627, 3864, 4491, 7680, 8948, 6851, 162, 5194, 563, 1423, 4926, 3757, 6139, 5382, 5697, 7174, 1498, 2972, 5420, 8219, 1835, 3983, 830, 2598, 3534, 6875, 9797, 5671, 1017, 283, 4344, 5622, 6587, 802, 4927, 4119, 9322, 1138, 251, 3624, 3482, 3846, 600, 7706, 6265, 6179, 9205, 2233, 920, 5829, 4486, 4871, 2212, 6574, 3280, 5982, 1733, 1755, 8381, 8835, 9713, 3296, 538, 2119, 4771, 8361, 5756, 9896, 1471, 5775, 356, 5892, 5076, 3768, 9293, 8433, 6211, 3006, 7955, 698, 9002, 880, 7030, 5815, 3769 };
+struct point pts_12[] = { { .x = 45, .y = 30 }, { .x = 81, .y = 58 }, { .x = 94, .y = 8 }, { .x = 89, .y = 16 }, { .x = 24, .y = 99 }, { .x = 33, .y = 21 }, { .x = 51, .y = 25 }, { .x = 4, .y = 74 }, { .x = 70, .y = 69 }, { .x = 76, .y = 51 }, { .x = 94, .y = 45 }, { .x = 1, .y = 20 }, { .x = 56, .y = 32 }, { .x = 38, .y = 92 }, { .x = 59, .y = 68 }, { .x = 42, .y = 94 }, { .x = 25, .y = 39 }, { .x = 89, .y = 25 }, { .x = 12, .y = 10 }, { .x = 53, .y = 55 }, { .x = 94, .y = 92 }, { .x = 73, .y = 84 }, { .x = 26, .y = 15 }, { .x = 67, .y = 36 }, { .x = 87, .y = 44 }, { .x = 44, .y = 82 }, { .x = 79, .y = 82 }, { .x = 48, .y = 83 }, { .x = 32, .y = 73 }, { .x = 76, .y = 96 }, { .x = 85, .y = 88 }, { .x = 99, .y = 87 }, { .x = 75, .y = 31 }, { .x = 29, .y = 28 }, { .x = 74, .y = 75 }, { .x = 68, .y = 13 }, { .x = 23, .y = 97 }, { .x = 81, .y = 31 }, { .x = 64, .y = 67 }, { .x = 8, .y = 38 } };
+void call_12(void)
+{
+    sink(ylen[4] | xcount, 0x3b3d <= 191, g2[8] == wx, ((char *) b2[8]), 0x363e <= h_tmp[0], (0x7c14), 0x5c5b >> 0x6b3c, 0xb4b5, ((char *) 819), ! mcount, d2 != kptr, ! 0x598e, b(497, fx[6]), 484 / 369, rx[0], ~ 0xadaf, pptr[1] - z, qx(93), vlen(0x1583), 0xe19a || ylen, ((const short) u_tmp[1]), g.c, dptr[3], kptr ? c : w, hptr.x2, m_tmp[7], 851 < 288, & fx[7], ((unsigned long) ccount), plen ? 299 : z_tmp, 0x2b93, rcount[6], (0x69cc), (ucount), h_tmp[6] ? 0x89bd : 0x2f60, (818), t2 || g2, bcount->klen, x_tmp(0x9ce7, f2[5], rptr[6]), 0x7343 < fptr, 276 * 0x8b76, kcount[6] - 925, ((unsigned long) p), qx[3], ! 0x9557, uptr, bcount->ncount, e_tmp(347, 0xd34c), 0xb9f0 <= e, z->qx, (0x85f7), * xcount[8], qlen, (150), 0x2664 <= 0x4394, (0x16c5), & 0xb781, ycount, - 0x6e77, 867 + 866, (w2), 889 - e2, ((unsigned long) eptr), 601 - 467, qptr, ! y_tmp[3], 0x5d68, elen.nlen, g[2], yptr[2] == mlen, (c_tmp[3]), ((unsigned long) ax), 0x497a ? 423 : 994, scount <= 0x689e, bcount[9] <= tlen, 0x12b8 ^ elen, v2(), y_tmp == vx[6], 819, ((int) 0x95e3), 0x975d, n2(), (x_tmp), b2[0], bx[8], fptr << fcount[2], 0xedac, q_tmp || 0x55a4, 0x7d8b, y << 0x7552, a_tmp.dlen, 0x3cf6 / x, (0x5e88), m2->rx, e > 826, - 380, (u2), glen, 0x4c3f <= 0xb9b, (452));
+}
+enum { B12_0, B12_1, B12_2, B12_3, B12_4, B12_5, B12_6, B12_7, B12_8, B12_9, B12_10, B12_11, B12_12, B12_13, B12_14, B12_15, B12_16, B12_17, B12_18, B12_19, B12_20, B12_21, B12_22, B12_23, B12_24, B12_25, B12_26, B12_27, B12_28, B12_29, B12_30, B12_31, B12_32, B12_33, B12_34, B12_35, B12_36, B12_37, B12_38, B12_39, B12_40, B12_41, B12_42, B12_43, B12_44, B12_45, B12_46, B12_47, B12_48, B12_49, B12_50, B12_51, B12_52, B12_53, B12_54, B12_55, B12_56, B12_57, B12_58, B12_59, B12_60, B12_61, B12_62, B12_63, B12_64, B12_65, B12_66, B12_67, B12_68, B12_69, B12_70, B12_71, B12_72, B12_73, B12_74, B12_75, B12_76, B12_77, B12_78, B12_79, B12_80, B12_81, B12_82, B12_83, B12_84, B12_85, B12_86, B12_87, B12_88, B12_89, B12_90, B12_91, B12_92, B12_93, B12_94, B12_95, B12_96, B12_97, B12_98, B12_99, B12_100, B12_101, B12_102, B12_103, B12_104, B12_105, B12_106, B12_107, B12_108, B12_109, B12_110, B12_111, B12_112, B12_113, B12_114, B12_115, B12_116, B12_117, B12_118, B12_119, B12_120, B12_121, B12_122, B12_123, B12_124, B12_125, B12_126, B12_127, B12_128, B12_129, B12_130, B12_131, B12_132, B12_133, B12_134, B12_135, B12_136, B12_137, B12_138, B12_139, B12_140, B12_141, B12_142, B12_143, B12_144, B12_145, B12_146, B12_147, B12_148, B12_149 } big_12;
+
+int init_13[] = { 5362, 2004, 2055, 6164, 9507, 4620, 7383, 5238, 3825, 2854, 9041, 7631, 2380, 8613, 5099, 8093, 4443, 9013, 7116, 4927, 4481, 8646, 6481, 8665, 8675, 4378, 6698, 3615, 2346, 4297, 1928, 4430, 3514, 2976, 4880, 1037, 932, 7622, 4936, 8023, 2330, 5771, 8712, 8412, 878, 2774, 1131, 9718, 5629, 2688, 3433, 3621, 8186, 4617, 4472, 6069, 1912, 4967, 9321, 1911, 5273, 2355, 5432, 6954, 3780, 392, 4947, 6658, 6099, 9912, 8711, 5489, 3828, 5965, 5463, 7761, 4092, 8845, 2042, 8916, 5075, 5399, 974, 5444, 5697, 2444, 606, 737, 1672, 4608, 6267, 5295, 8641, 1816, 5210, 9983, 4460, 5655, 767, 7231, 9885, 7889, 3760, 5631, 7538, 8322, 8815, 1524, 8917, 6741, 3017, 28, 7670, 6916, 704, 8935, 4281, 3852, 4042, 509, 6823, 968, 5563, 6275, 4750, 1762, 1742, 8228, 3672, 7620, 7696, 7854, 916, 6947, 8613, 5556, 6046, 2741, 576, 3828, 124, 4719, 4118, 4937, 6412, 3790, 8157, 5674, 1162, 2076, 9541, 2991, 5908, 6759, 975, 3386, 5167, 6010, 815, 357, 7073, 7642, 2158, 8368, 2410, 2433, 7593, 5469, 3936, 8254, 1793, 4355, 5520, 5861, 1055, 1129, 4770, 2993, 5239, 9012, 7885, 2677, 165, 4679, 8206, 8908, 7080, 2046, 89, 5542, 2372, 6372, 5149, 4834, 8898, 7393, 1137, 1626, 5669, 376 };
+struct point pts_13[] = { { .x = 19, .y = 72 }, { .x = 19, .y = 12 }, { .x = 6, .y = 10 }, { .x = 71, .y = 26 }, { .x = 42, .y = 79 }, { .x = 53, .y = 10 }, { .x = 39, .y = 50 }, { .x = 17, .y = 12 }, { .x = 35, .y = 5 }, { .x = 99, .y = 15 }, { .x = 40, .y = 95 }, { .x = 61, .y = 0 }, { .x = 98, .y = 64 }, { .x = 48, .y = 88 }, { .x = 4, .y = 82 }, { .x = 73, .y = 60 }, { .x = 29, .y = 29 }, { .x = 48, .y = 92 }, { .x = 65, .y = 76 }, { .x = 22, .y = 73 }, { .x = 9, .y = 53 }, { .x = 75, .y = 94 }, { .x = 99, .y = 33 }, { .x = 42, .y = 60 }, { .x = 76, .y = 82 }, { .x = 62, .y = 58 }, { .x = 1, .y = 8 }, { .x = 32, .y = 14 }, { .x = 16, .y = 43 }, { .x = 22, .y = 23 }, { .x = 4, .y = 0 }, { .x = 23, .y = 71 }, { .x = 38, .y = 17 }, { .x = 8, .y = 43 }, { .x = 6, .y = 77 }, { .x = 82, .y = 3 }, { .x = 36, .y = 32 }, { .x = 5, .y = 97 }, { .x = 95, .y = 49 }, { .x = 27, .y = 46 } };
+void call_13(void)
+{
+    sink(0x7b51 == zx, 101 + fcount, c_tmp[8] && rptr, rptr ? 0x792b : sptr[7], 0x3768 | vlen, gptr | 0x9318, ~ g2[2], pcount || alen[6], ! 0x7dc8, 562, 0xdfe2, rptr[7], nptr[2], acount[4] ? 244 : 0x4ec4, 0xc778, 101 ? 947 : g_tmp[9], (alen), mcount[0], 292, u2[2], 285 ? t : 0x7401, fcount[8], 481 && 0x709e, aptr[5], 220 << h2[5], ((const short) mlen), t2[3] != 0x994b, ((char *) 0x3051), & 573, ccount(ulen[2]), & clen[2], 724, 0xce47 << 370, r2 >= 515, yptr[8], tx - zlen, 0xd3f4, zlen[3], qlen[8] << 0x2fb6, r2[0], mcount->glen, 0x1333, ((int) 0x1ed8), ((int) p_tmp), z_tmp[8], 0x3116 | 0x1d71, 0x1863, (xlen), (f2[4]), 625 + 964, 0x4309, t_tmp(0xf0e7), g2[9], ((unsigned long) 0xa6ae), y2[9], 0x7b1d % 0xcb19, t_tmp->u, 146, dlen & 0x71d1, - 752, 257 ^ 949, * 0xc3e3, zlen != 0x32fe, 726, a2->cx, wptr(), m2 + k[4], 747 >= aptr, 0xae23, dptr * 861, ((unsigned long) vlen), qx, ((unsigned long) r2), 569, dcount, 0x39e3, m[5] - x2[8], y > ux, h2(0x43f6, 0x96ac, kcount), q2(fx[3]), mcount(t2[0]), ecount == 0x3322, kptr[7], eptr, 0x4d7d == 0x926d, (438), rx(), t2, 224, klen ? vlen : 0x7f86, 0x99e5 - 0x4396, 231, f, (mptr), tptr(0xf2e, dlen), ecount[7] ^ 0xb70b, xptr ? 0x7d40 : g2[0], y2[2] * 217, 0x5fe2 && 924, 59 * 0x6ebe);
+}
+enum { B13_0, B13_1, B13_2, B13_3, B13_4, B13_5, B13_6, B13_7, B13_8, B13_9, B13_10, B13_11, B13_12, B13_13, B13_14, B13_15, B13_16, B13_17, B13_18, B13_19, B13_20, B13_21, B13_22, B13_23, B13_24, B13_25, B13_26, B13_27, B13_28, B13_29, B13_30, B13_31, B13_32, B13_33, B13_34, B13_35, B13_36, B13_37, B13_38, B13_39, B13_40, B13_41, B13_42, B13_43, B13_44, B13_45, B13_46, B13_47, B13_48, B13_49, B13_50, B13_51, B13_52, B13_53, B13_54, B13_55, B13_56, B13_57, B13_58, B13_59, B13_60, B13_61, B13_62, B13_63, B13_64, B13_65, B13_66, B13_67, B13_68, B13_69, B13_70, B13_71, B13_72, B13_73, B13_74, B13_75, B13_76, B13_77, B13_78, B13_79, B13_80, B13_81, B13_82, B13_83, B13_84, B13_85, B13_86, B13_87, B13_88, B13_89, B13_90, B13_91, B13_92, B13_93, B13_94, B13_95, B13_96, B13_97, B13_98, B13_99, B13_100, B13_101, B13_102, B13_103, B13_104, B13_105, B13_106, B13_107, B13_108, B13_109, B13_110, B13_111, B13_112, B13_113, B13_114, B13_115, B13_116, B13_117, B13_118, B13_119, B13_120, B13_121, B13_122, B13_123, B13_124, B13_125, B13_126, B13_127, B13_128, B13_129, B13_130, B13_131, B13_132, B13_133, B13_134, B13_135, B13_136, B13_137, B13_138, B13_139, B13_140, B13_141, B13_142, B13_143, B13_144, B13_145, B13_146, B13_147, B13_148, B13_149 } big_13;
+
+int init_14[] = { 5532, 9692, 5791, 7816, 8102, 2007, 3839, 2306, 9748, 4110, 5554, 2542, 8059, 9766, 7931, 7612, 5385, 3132, 6841, 6898, 6225, 1554, 8404, 8114, 4268, 55, 2400, 5724, 6530, 6840, 5531, 4670, 7215, 5998, 8143, 7387, 9382, 8046, 8041, 1897, 3322, 2015, 236, 2588, 3523, 4199, 6663, 4888, 741, 764, 6346, 5963, 6231, 8195, 1520, 773, 5102, 6148, 3681, 1406, 538, 3566, 9772, 7936, 4727, 2920, 6593, 9374, 2024, 7075, 4960, 807, 6516, 5583, 312, 7364, 5744, 2481, 7161, 4325, 7279, 8566, 9680, 6656, 1164, 9279, 9145, 4497, 4610, 3916, 3494, 3100, 8891, 2919, 1002, 342, 2758, 2148, 2194, 4154, 2751, 7392, 2803, 1919, 4785, 3562, 8157, 629, 6607, 5852, 8045, 3651, 1250, 1642, 7730, 7907, 4954, 7216, 6402, 7107, 2065, 3078, 2406, 4457, 815, 4447, 653, 2230, 7572, 8864, 1376, 2625, 3488, 6382, 70, 3296, 3175, 6271, 8309, 2145, 234, 2799, 9785, 6968, 79, 543, 2961, 9570, 641, 5417, 5233, 3905, 3949, 7136, 2032, 2773, 4045, 7730, 3707, 1262, 1692, 990, 8115, 7449, 8001, 5957, 4642, 8324, 6201, 9672, 6620, 4646, 9171, 2732, 402, 8471, 5982, 4735, 6988, 8087, 3236, 2778, 1612, 7555, 5916, 3771, 8508, 5162, 6970, 3164, 274, 3353, 1456, 3326, 413, 384, 4115, 227, 2852, 3802 };
+struct point pts_14[] = { { .x = 15, .y = 68 }, { .x = 77, .y = 2 }, { .x = 66, .y = 90 }, { .x = 91, .y = 90 }, { .x = 15, .y = 38 }, { .x = 5, .y = 53 }, { .x = 89, .y = 5 }, { .x = 34, .y = 71 }, { .x = 12, .y = 95 }, { .x = 26, .y = 21 }, { .x = 54, .y = 58 }, { .x = 87, .y = 96 }, { .x = 7, .y = 90 }, { .x = 26, .y = 41 }, { .x = 19, .y = 50 }, { .x = 99, .y = 33 }, { .x = 90, .y = 45 }, { .x = 61, .y = 75 }, { .x = 73, .y = 8 }, { .x = 97, .y = 75 }, { .x = 41, .y = 18 }, { .x = 77, .y = 91 }, { .x = 50, .y = 41 }, { .x = 59, .y = 31 }, { .x = 56, .y = 14 }, { .x = 90, .y = 63 }, { .x = 67, .y = 70 }, { .x = 12, .y = 27 }, { .x = 52, .y = 27 }, { .x = 98, .y = 56 }, { .x = 28, .y = 82 }, { .x = 77, .y = 83 }, { .x = 21, .y = 67 }, { .x = 21, .y = 44 }, { .x = 50, .y = 80 }, { .x = 28, .y = 33 }, { .x = 46, .y = 33 }, { .x = 30, .y = 95 }, { .x = 6, .y = 64 }, { .x = 1, .y = 88 } };
+void call_14(void)
+{
+    sink(zlen(y2[6], 0xb1ed), sx->elen, 0xb157 ? 598 : 0xbee8, 0x6e3b < 0x5607, dlen[6] >> x2, v_tmp, 0xc7ed, aptr, ((char *) 637), hlen(683, 0x4482), k[8] ? pcount[0] : gcount[4], 0xadf << k2[7], ((int) 823), 0x492f * g, s_tmp->pptr, b[2] ? 0x6954 : h_tmp[9], 0xb36a, f2(f), z2, (898), ((const short) n_tmp[4]), glen.d_tmp, ((char *) m_tmp), ! 0x9284, * 0xb50c, mlen * w2[5], (0xdf51), fx->ux, mcount <= 0x7c9f, 794 - 0xa9c0, qptr < 560, rcount | p2, hx[4], (f_tmp), - fptr[6], ((int) dlen[6]), (964), 0xe1b9, dx->a, tcount != g, x_tmp, - gptr, 0x444f, dx[0], 0x44fa, 0x7f46, e2(t, s2[4], 0xeef0), 0x40a, 0xb15f <= 390, fx >= k_tmp, 91, (856), & 324, ((char *) 540), ((int) 0xcfc5), 284, t[7] | p2, klen.tptr, - fcount, wx, y_tmp[4], 0x6a78, 0xd1ae, xptr(93, 0xd73, sx), 0xc5e & v_tmp, 0xf161, 0xf601, 181, y[8] ? 0xf8f : 0x93df, 0x1aa9, t2[4], x_tmp.bx, x->ax, ! gx, (kx[1]), wlen[7] < 0xba46, 0x11af >> 0x52cb, 0x5d3d, c(zcount[0], 115, ux), qcount(mptr), 952 + mcount[9], 0xa089 ? 0x36fc : s_tmp[4], ((const short) gx[7]), 155 >> 0x3f8b, 0x3041, vlen(u_tmp[3]), 481, dlen->tx, f_tmp[0], eptr->t_tmp, 438 ? 0xc3ac : 0x505a, nx, ((char *) d2), mlen(0x477, 382), hcount[6], 985 > 524, - dx, (eptr), 0x1d03 || bptr, p2[0] >= 0x4106);
+}
+enum { B14_0, B14_1, B14_2, B14_3, B14_4, B14_5, B14_6, B14_7, B14_8, B14_9, B14_10, B14_11, B14_12, B14_13, B14_14, B14_15, B14_16, B14_17, B14_18, B14_19, B14_20, B14_21, B14_22, B14_23, B14_24, B14_25, B14_26, B14_27, B14_28, B14_29, B14_30, B14_31, B14_32, B14_33, B14_34, B14_35, B14_36, B14_37, B14_38, B14_39, B14_40, B14_41, B14_42, B14_43, B14_44, B14_45, B14_46, B14_47, B14_48, B14_49, B14_50, B14_51, B14_52, B14_53, B14_54, B14_55, B14_56, B14_57, B14_58, B14_59, B14_60, B14_61, B14_62, B14_63, B14_64, B14_65, B14_66, B14_67, B14_68, B14_69, B14_70, B14_71, B14_72, B14_73, B14_74, B14_75, B14_76, B14_77, B14_78, B14_79, B14_80, B14_81, B14_82, B14_83, B14_84, B14_85, B14_86, B14_87, B14_88, B14_89, B14_90, B14_91, B14_92, B14_93, B14_94, B14_95, B14_96, B14_97, B14_98, B14_99, B14_100, B14_101, B14_102, B14_103, B14_104, B14_105, B14_106, B14_107, B14_108, B14_109, B14_110, B14_111, B14_112, B14_113, B14_114, B14_115, B14_116, B14_117, B14_118, B14_119, B14_120, B14_121, B14_122, B14_123, B14_124, B14_125, B14_126, B14_127, B14_128, B14_129, B14_130, B14_131, B14_132, B14_133, B14_134, B14_135, B14_136, B14_137, B14_138, B14_139, B14_140, B14_141, B14_142, B14_143, B14_144, B14_145, B14_146, B14_147, B14_148, B14_149 } big_14;
+
+int init_15[] = { 2179, 1618, 2433, 431, 5009, 6180, 7420, 8706, 2038, 6450, 8277, 6583, 1748, 4490, 7456, 2071, 4989, 462, 5953, 9282, 3354, 7953, 4273, 3865, 102, 6760, 3639, 201, 2010, 1338, 7650, 4763, 1827, 8716, 3723, 9216, 8971, 7638, 6360, 5455, 2125, 5127, 9235, 4366, 2114, 1578, 6826, 2649, 6343, 3140, 820, 6890, 5960, 2522, 4590, 6886, 5279, 4712, 8132, 1869, 670, 1789, 3629, 9667, 211, 3414, 4265, 2073, 4346, 9260, 4226, 4753, 5238, 779, 1591, 9426, 2389, 6687, 4687, 6697, 7274, 1319, 8788, 5509, 8825, 9380, 171, 1156, 8732, 8080, 505, 1035, 1079, 1248, 5179, 629, 1030, 8098, 1861, 8039, 1746, 2675, 4571, 3170, 7859, 4376, 2888, 3303, 9920, 6807, 5600, 9693, 4811, 2844, 9047, 1193, 6002, 8755, 5562, 1800, 6035, 4777, 9060, 437, 3907, 716, 793, 7001, 6065, 3983, 5049, 7305, 4662, 7440, 3467, 8708, 5582, 2404, 8334, 5697, 6739, 4800, 7046, 635, 9506, 5834, 4987, 7686, 7573, 4614, 8626, 4692, 8271, 6297, 538, 2895, 7097, 9291, 4206, 884, 1081, 3306, 4046, 4852, 900, 6835, 3731, 5529, 5063, 7959, 584, 3398, 1823, 5980, 1155, 4503, 4991, 2000, 6397, 4819, 1548, 6125, 5103, 2760, 117, 8521, 7672, 6255, 3867, 5856, 2561, 2344, 3172, 6021, 5263, 4143, 7590, 1497, 8605, 7825 };
+struct point pts_15[] = { { .x = 99, .y = 93 }, { .x = 46, .y = 18 }, { .x = 67, .y = 87 }, { .x = 84, .y = 21 }, { .x = 30, .y = 85 }, { .x = 98, .y = 89 }, { .x = 58, .y = 1 }, { .x = 61, .y = 55 }, { .x = 45, .y = 62 }, { .x = 78, .y = 82 }, { .x = 56, .y = 36 }, { .x = 21, .y = 28 }, { .x = 96, .y = 6 }, { .x = 74, .y = 96 }, { .x = 56, .y = 1 }, { .x = 87, .y = 25 }, { .x = 80, .y = 99 }, { .x = 0, .y = 93 }, { .x = 69, .y = 11 }, { .x = 21, .y = 9 }, { .x = 53, .y = 37 }, { .x = 86, .y = 29 }, { .x = 82, .y = 35 }, { .x = 3, .y = 33 }, { .x = 37, .y = 23 }, { .x = 80, .y = 76 }, { .x = 81, .y = 29 }, { .x = 44, .y = 55 }, { .x = 29, .y = 25 }, { .x = 15, .y = 89 }, { .x = 54, .y = 70 }, { .x = 41, .y = 60 }, { .x = 45, .y = 5 }, { .x = 34, .y = 71 }, { .x = 24, .y = 73 }, { .x = 92, .y = 43 }, { .x = 64, .y = 98 }, { .x = 35, .y = 51 }, { .x = 10, .y = 25 }, { .x = 16, .y = 94 } };
+void call_15(void)
+{
+    sink(((unsigned long) 379), 732, q2[3] ? 0xfe69 : 0x9801, (0x14d7), rx(), 0x2943 != 359, p_tmp[1] * 564, * q2[4], f[3] ? pcount : 547, ((const short) 0x5e46), 0xac42 && sptr[4], ~ 0xa41a, ux.yx, 150 >> d, g_tmp[9], ! 900, zlen->w, m_tmp->hlen, fx.zcount, 812, ! 0x4d1d, t(456), 0xa2b8, mlen[5] ? 279 : n, 979 == t2[8], 0x3442, gptr, ! x, fx[3] << z_tmp[7], p[2], 629 ? 0x5dd : elen, ~ 311, q2.ccount, 327, tptr.uptr, vcount, tx, 385 >> 510, sptr.sx, p2[8] & 466, wx->v_tmp, ((unsigned long) 0x847e), (686), 0x5842, 0xb703, ((const short) f2[3]), (0xf48f), zcount[1] | hx[1], - 0x5ee3, - 889, tlen.d2, ((int) 87), a_tmp[8], (979), 0x9503 * 0x42dd, v->cptr, 0x8b43, ux[6], p2, ~ 0xa16, (79), 0x8122 & h, 0x18e5 << 351, tx[3], rcount ? 773 : 0x8490, h2[9] < k_tmp[0], (vptr[2]), (e_tmp), 0x1f92, v >> 505, 305, hcount, 0x69e5 + 0x4d07, 0x7488, vcount > 143, 0x6f02 ? 928 : g[8], w(334, 316, r2), ((unsigned long) hptr), yx / 231, zx->g, ((int) 587), 0x2ed ? 0xc37f : ucount[8], w_tmp, 0xdb52 ? 261 : 464, glen[3] >> 43, 0xf764, ((const short) 69), 918, 0x62d7, g <= rcount, 0xa7cd, ! 0x10db, p(b_tmp), k(194, fx, e), hlen(928, 0xd0ee), - ax, 0x30fc != 682, hptr ? hlen : 0x59ad, 0xef9c == 825, 630 + qptr);
+}
+enum { B15_0, B15_1, B15_2, B15_3, B15_4, B15_5, B15_6, B15_7, B15_8, B15_9, B15_10, B15_11, B15_12, B15_13, B15_14, B15_15, B15_16, B15_17, B15_18, B15_19, B15_20, B15_21, B15_22, B15_23, B15_24, B15_25, B15_26, B15_27, B15_28, B15_29, B15_30, B15_31, B15_32, B15_33, B15_34, B15_35, B15_36, B15_37, B15_38, B15_39, B15_40, B15_41, B15_42, B15_43, B15_44, B15_45, B15_46, B15_47, B15_48, B15_49, B15_50, B15_51, B15_52, B15_53, B15_54, B15_55, B15_56, B15_57, B15_58, B15_59, B15_60, B15_61, B15_62, B15_63, B15_64, B15_65, B15_66, B15_67, B15_68, B15_69, B15_70, B15_71, B15_72, B15_73, B15_74, B15_75, B15_76, B15_77, B15_78, B15_79, B15_80, B15_81, B15_82, B15_83, B15_84, B15_85, B15_86, B15_87, B15_88, B15_89, B15_90, B15_91, B15_92, B15_93, B15_94, B15_95, B15_96, B15_97, B15_98, B15_99, B15_100, B15_101, B15_102, B15_103, B15_104, B15_105, B15_106, B15_107, B15_108, B15_109, B15_110, B15_111, B15_112, B15_113, B15_114, B15_115, B15_116, B15_117, B15_118, B15_119, B15_120, B15_121, B15_122, B15_123, B15_124, B15_125, B15_126, B15_127, B15_128, B15_129, B15_130, B15_131, B15_132, B15_133, B15_134, B15_135, B15_136, B15_137, B15_138, B15_139, B15_140, B15_141, B15_142, B15_143, B15_144, B15_145, B15_146, B15_147, B15_148, B15_149 } big_15;
+
+int init_16[] = { 8157, 6004, 8684, 802, 3867, 4880, 6086, 2109, 2882, 6334, 2612, 5882, 7040, 9547, 9843, 7225, 8714, 3498, 549, 4594, 2068, 1084, 9180, 3667, 1481, 1547, 3307, 5855, 706, 1912, 2941, 9886, 6726, 8622, 3609, 1008, 8840, 6873, 3802, 1957, 1752, 3186, 877, 7106, 374, 7857, 1022, 9292, 8611, 3849, 2227, 6973, 2824, 5977, 8525, 2364, 3501, 2641, 3663, 3685, 3430, 1521, 8242, 7258, 4457, 9821, 2727, 9667, 114, 3194, 2620, 8124, 4865, 8494, 556, 2286, 6148, 6933, 9868, 3158, 3822, 8203, 9526, 2171, 9530, 5402, 5369, 439, 3320, 5096, 1322, 3282, 4843, 1620, 4452, 8416, 3650, 4831, 2430, 8238, 8214, 4437, 9163, 9275, 6215, 7518, 9814, 8093, 6605, 3381, 8929, 5809, 37, 7152, 5742, 9716, 1699, 7441, 5276, 2962, 5325, 3150, 5725, 5307, 6196, 1011, 8397, 3591, 6366, 9658, 509, 3856, 6295, 9875, 2611, 337, 8357, 2608, 470, 6533, 5457, 9424, 3113, 3663, 3575, 1271, 2414, 5030, 1464, 4074, 2875, 7870, 2016, 9925, 5943, 319, 9966, 1021, 3657, 5419, 6037, 2132, 7126, 7054, 8241, 2869, 7010, 2551, 5296, 556, 1347, 1372, 4630, 4809, 6570, 5593, 6496, 8651, 2881, 1027, 9116, 1258, 9498, 8261, 1686, 993, 4776, 3092, 6378, 3246, 4432, 1417, 8305, 7488, 8602, 473, 6860, 1497, 3573, 7882 };
+struct point pts_16[] = { { .x = 60, .y = 87 }, { .x = 36, .y = 27 }, { .x = 3, .y = 52 }, { .x = 80, .y = 72 }, { .x = 88, .y = 90 }, { .x = 80, .y = 49 }, { .x = 81, .y = 9 }, { .x = 12, .y = 3 }, { .x = 9, .y = 34 }, { .x = 76, .y = 44 }, { .x = 95, .y = 33 }, { .x = 24, .y = 69 }, { .x = 15, .y = 38 }, { .x = 92, .y = 41 }, { .x = 74, .y = 83 }, { .x = 21, .y = 0 }, { .x = 33, .y = 57 }, { .x = 82, .y = 60 }, { .x = 76, .y = 19 }, { .x = 96, .y = 35 }, { .x = 70, .y = 77 }, { .x = 62, .y = 99 }, { .x = 91, .y = 23 }, { .x = 80, .y = 54 }, { .x = 9, .y = 36 }, { .x = 54, .y = 19 }, { .x = 11, .y = 83 }, { .x = 69, .y = 19 }, { .x = 76, .y = 85 }, { .x = 19, .y = 28 }, { .x = 24, .y = 62 }, { .x = 94, .y = 62 }, { .x = 50, .y = 57 }, { .x = 98, .y = 84 }, { .x = 56, .y = 71 }, { .x = 62, .y = 18 }, { .x = 16, .y = 6 }, { .x = 50, .y = 11 }, { .x = 97, .y = 47 }, { .x = 73, .y = 14 } };
+void call_16(void)
+{
+    sink(816 + mlen[2], ! 0x91cf, ((const short) hlen), vlen(ycount[2]), 275, zlen.b2, pcount[5] / fx[9], vlen % m, 0x4295 <= 623, 0x8754, 0x1196 ^ 0x8bf5, 0xdf1e / 306, zptr->ycount, (mx[6]), 758 - 54, (173), vptr, (q_tmp), ylen->slen, 374 ? xx : 0x1881, f_tmp % 0x5df8, 0x8f2a | r[8], 768, alen[0] && 0xe982, c[0] <= 0x97aa, 268, ((unsigned long) wlen[1]), e_tmp[8] < 0xce73, 707, u[8] << d[7], f2->yx, scount, zlen[8], 0x69be ? 58 : k2, alen >= 511, (0x74be), nx ? sptr[4] : x2[4], (203), b2, eptr[4], 0xdb9b, 0xeb46 != 0xf7b6, 0x8934, rx, 349 > 0x5b66, * 0xdb61, v ^ 0xfe6e, * vlen[8], ((char *) e[4]), a2 != mcount[8], & flen, elen + d2, 103 | 0x3a33, g_tmp < 0x12c6, b2 - f2, pptr(t2[1]), 445, 0x38e2, hlen[2], ccount * scount[6], ((int) d_tmp[4]), 675 / 0xed96, ! fx[8], (737), ycount[5], ~ 0x1e22, 0x1df, 0xd825 >= 0x551e, q2(), 58 / r, 0x7fcd, zcount[8], ycount[5] & 667, 0x982 ? zcount : 0x99d, ax.yx, ((unsigned long) 0x7ccd), c_tmp.gcount, 401 ? hptr : 0x6e0e, 299, d_tmp[4] ^ 0xfc53, 0xca74 % 454, 964 <= 0xe444, 627, mcount->n, h(486, vx[4], b2), e[7], & 815, w[5], 0x488d, v_tmp(rx), scount(0xf097, 0xd6a0), rcount, rcount ^ hlen[9], zptr[8] / 0x58ca, rlen(333), 711, * 0xebc3, rlen <= p_tmp[0], ((int) c2[7]), ((int) 254));
+}
+enum { B16_0, B16_1, B16_2, B16_3, B16_4, B16_5, B16_6, B16_7, B16_8, B16_9, B16_10, B16_11, B16_12, B16_13, B16_14, B16_15, B16_16, B16_17, B16_18, B16_19, B16_20, B16_21, B16_22, B16_23, B16_24, B16_25, B16_26, B16_27, B16_28, B16_29, B16_30, B16_31, B16_32, B16_33, B16_34, B16_35, B16_36, B16_37, B16_38, B16_39, B16_40, B16_41, B16_42, B16_43, B16_44, B16_45, B16_46, B16_47, B16_48, B16_49, B16_50, B16_51, B16_52, B16_53, B16_54, B16_55, B16_56, B16_57, B16_58, B16_59, B16_60, B16_61, B16_62, B16_63, B16_64, B16_65, B16_66, B16_67, B16_68, B16_69, B16_70, B16_71, B16_72, B16_73, B16_74, B16_75, B16_76, B16_77, B16_78, B16_79, B16_80, B16_81, B16_82, B16_83, B16_84, B16_85, B16_86, B16_87, B16_88, B16_89, B16_90, B16_91, B16_92, B16_93, B16_94, B16_95, B16_96, B16_97, B16_98, B16_99, B16_100, B16_101, B16_102, B16_103, B16_104, B16_105, B16_106, B16_107, B16_108, B16_109, B16_110, B16_111, B16_112, B16_113, B16_114, B16_115, B16_116, B16_117, B16_118, B16_119, B16_120, B16_121, B16_122, B16_123, B16_124, B16_125, B16_126, B16_127, B16_128, B16_129, B16_130, B16_131, B16_132, B16_133, B16_134, B16_135, B16_136, B16_137, B16_138, B16_139, B16_140, B16_141, B16_142, B16_143, B16_144, B16_145, B16_146, B16_147, B16_148, B16_149 } big_16;
+
+int init_17[] = { 3527, 7459, 4704, 7565, 7658, 8592, 3110, 835, 2452, 8514, 3993, 3138, 7040, 7019, 3756, 3763, 7082, 8114, 6313, 944, 9660, 3384, 9951, 5448, 2325, 5977, 5874, 1186, 2055, 2182, 723, 5575, 6515, 6795, 6422, 3524, 1616, 826, 7682, 8091, 400, 1582, 2190, 7143, 5915, 2409, 4292, 9346, 6862, 2952, 3896, 9695, 1461, 4569, 2623, 3469, 3091, 6029, 7014, 8088, 9609, 3204, 8694, 7052, 7838, 8322, 7620, 3180, 8069, 3545, 2312, 5477, 4842, 2514, 4114, 1323, 5137, 5773, 4051, 4585, 2405, 8357, 616, 7680, 8512, 2271, 3963, 4053, 2957, 6570, 5176, 9690, 7566, 1296, 5891, 946, 7677, 9293, 9705, 9787, 4118, 8442, 1257, 2128, 4441, 9761, 8489, 2507, 5445, 9149, 5659, 3532, 8913, 8303, 4504, 1619, 6400, 9646, 3794, 5114, 176, 7298, 2628, 6786, 2854, 7085, 9207, 1857, 8874, 750, 3810, 3543, 5815, 7881, 4418, 7736, 2154, 2057, 8905, 9934, 5316, 7572, 7982, 4571, 7697, 5320, 7094, 5982, 8267, 8638, 2352, 2302, 3565, 8617, 2234, 8786, 2342, 346, 2885, 314, 4748, 7813, 5335, 984, 7227, 3562, 7785, 7547, 4688, 9891, 9003, 560, 7517, 1687, 850, 5424, 1430, 5135, 7576, 4976, 2208, 4733, 3690, 766, 7395, 5868, 4824, 4759, 3131, 2636, 490, 3064, 8461, 1172, 9477, 5794, 1159, 9475, 9749, 9326 };
+struct point pts_17[] = { { .x = 29, .y = 98 }, { .x = 10, .y = 4 }, { .x = 83, .y = 91 }, { .x = 90, .y = 3 }, { .x = 40, .y = 36 }, { .x = 79, .y = 31 }, { .x = 83, .y = 20 }, { .x = 34, .y = 36 }, { .x = 45, .y = 37 }, { .x = 88, .y = 81 }, { .x = 42, .y = 0 }, { .x = 20, .y = 42 }, { .x = 11, .y = 40 }, { .x = 62, .y = 27 }, { .x = 52, .y = 5 }, { .x = 96, .y = 64 }, { .x = 85, .y = 26 }, { .x = 47, .y = 99 }, { .x = 57, .y = 89 }, { .x = 84, .y = 45 }, { .x = 92, .y = 98 }, { .x = 0, .y = 74 }, { .x = 95, .y = 99 }, { .x = 87, .y = 8 }, { .x = 54, .y = 56 }, { .x = 23, .y = 38 }, { .x = 28, .y = 19 }, { .x = 30, .y = 39 }, { .x = 38, .y = 28 }, { .x = 64, .y = 31 }, { .x = 66, .y = 8 }, { .x = 68, .y = 45 }, { .x = 32, .y = 23 }, { .x = 11, .y = 55 }, { .x = 4, .y = 51 }, { .x = 23, .y = 82 }, { .x = 89, .y = 95 }, { .x = 61, .y = 21 }, { .x = 8, .y = 40 }, { .x = 54, .y = 1 } };
+void call_17(void)
+{
+    sink(tlen[7] % n[7], 0xcfd3, 131 % 0xa0d2, 0xbda9 & u2[0], q2 & 0x1914, 0x5dd3 < 0x4d43, wx[0] >= 0x7baf, 850 ? 583 : glen, rcount(), fx[9] | vx[5], g ? pptr : mptr[9], 659 == 759, ~ mcount[1], 0x7ffc | 0xa0c1, ~ kcount[1], 233 != d2[8], ! 154, qlen[3] ? 0x7f43 : 810, & blen, 0x7807 ? g : hx, (150), hx->z, flen[3], ((int) v_tmp), plen[3], u2 || vcount, 0xb2d0 ? c : 0xc1b3, w2 & 152, (0x7688), n_tmp[9] ^ 189, 441 <= 82, ((unsigned long) 340), bptr ? 0xce87 : 0x53ac, dx(ax), (s_tmp[1]), alen | 843, ((const short) 0x7579), h2, ((unsigned long) alen[9]), g[0] <= 724, b2(ax, c[5], d[7]), 0x3fee, ((int) dptr[8]), (0x2d65), k2, 21 & z[1], elen && acount[6], 526 % 0x6c69, ~ 315, (163), sx[2], plen(636, 683, xptr), ! 146, eptr < b2[8], m(), p2[2], rx ? 536 : wcount, r2 < 0x5a30, (w2), 0xef8e / 0xcc2b, - k_tmp[6], x[2], 197 * e[7], qptr && 0xa672, (462), 0x4c41, 0x3202 / qlen[1], eptr(), slen, w_tmp ? g2 : yptr[2], (0x3f53), 0xf756 ? d : v2, wx[9], fcount.q, (w), 0xcc8d, q[9], ! m_tmp, ((int) 0xe7d9), n(), 0x15ae, (923), ux | 292, (w_tmp), 0x39aa, r2[6] % 322, xcount << cptr[2], acount < x[5], ((char *) 0xc5d8), p2[1] ? 0x4bc9 : e[7], ylen, 484, wcount - scount[9], ((char *) 0xcfe8), 227 % s2, ((const short) zlen), b_tmp.mlen, qx, ((char *) 361), s2->mx);
+}
+enum { B17_0, B17_1, B17_2, B17_3, B17_4, B17_5, B17_6, B17_7, B17_8, B17_9, B17_10, B17_11, B17_12, B17_13, B17_14, B17_15, B17_16, B17_17, B17_18, B17_19, B17_20, B17_21, B17_22, B17_23, B17_24, B17_25, B17_26, B17_27, B17_28, B17_29, B17_30, B17_31, B17_32, B17_33, B17_34, B17_35, B17_36, B17_37, B17_38, B17_39, B17_40, B17_41, B17_42, B17_43, B17_44, B17_45, B17_46, B17_47, B17_48, B17_49, B17_50, B17_51, B17_52, B17_53, B17_54, B17_55, B17_56, B17_57, B17_58, B17_59, B17_60, B17_61, B17_62, B17_63, B17_64, B17_65, B17_66, B17_67, B17_68, B17_69, B17_70, B17_71, B17_72, B17_73, B17_74, B17_75, B17_76, B17_77, B17_78, B17_79, B17_80, B17_81, B17_82, B17_83, B17_84, B17_85, B17_86, B17_87, B17_88, B17_89, B17_90, B17_91, B17_92, B17_93, B17_94, B17_95, B17_96, B17_97, B17_98, B17_99, B17_100, B17_101, B17_102, B17_103, B17_104, B17_105, B17_106, B17_107, B17_108, B17_109, B17_110, B17_111, B17_112, B17_113, B17_114, B17_115, B17_116, B17_117, B17_118, B17_119, B17_120, B17_121, B17_122, B17_123, B17_124, B17_125, B17_126, B17_127, B17_128, B17_129, B17_130, B17_131, B17_132, B17_133, B17_134, B17_135, B17_136, B17_137, B17_138, B17_139, B17_140, B17_141, B17_142, B17_143, B17_144, B17_145, B17_146, B17_147, B17_148, B17_149 } big_17;
+
+int init_18[] = { 1414, 4251, 196, 8454, 3408, 3764, 1803, 6318, 6768, 9845, 3862, 7493, 6392, 6778, 5592, 8370, 4778, 6626, 2189, 82, 4668, 4455, 1711, 5645, 4419, 9635, 7748, 8921, 8007, 850, 6077, 4714, 7452, 7547, 2987, 3453, 2422, 8335, 1673, 6101, 7153, 6708, 518, 3162, 9918, 6119, 4136, 4489, 4168, 1268, 1817, 1412, 6675, 8085, 6242, 4979, 5997, 7841, 3869, 385, 9575, 3453, 5456, 5566, 5064, 9850, 1945, 7892, 4944, 6423, 5216, 4403, 5263, 2830, 7596, 1212, 1221, 2484, 3355, 916, 4085, 9186, 5865, 9251, 4420, 381, 6944, 1559, 3376, 4102, 1566, 5835, 3572, 3223, 1795, 1130, 401, 7127, 8281, 1282, 4415, 1825, 9498, 1592, 9001, 3044, 1950, 3350, 6996, 1196, 4376, 7692, 6008, 2557, 8616, 9432, 6248, 8460, 6954, 7121, 4586, 1210, 9075, 3686, 8988, 6052, 1787, 8891, 5242, 9096, 7424, 1293, 6301, 8727, 5783, 7669, 176, 666, 6887, 1400, 4866, 4829, 6964, 7952, 9750, 7509, 5694, 3139, 4042, 2271, 6523, 2650, 23, 221, 3292, 6726, 3411, 737, 7123, 5262, 2773, 4374, 7686, 210, 2848, 1, 3057, 5288, 3194, 5766, 6437, 680, 4564, 5918, 439, 359, 7947, 1580, 1994, 562, 2026, 5300, 7895, 8328, 2172, 2302, 9033, 1999, 9404, 134, 8309, 9608, 2575, 5987, 1453, 3483, 1105, 7086, 2409, 220 };
+struct point pts_18[] = { { .x = 80, .y = 66 }, { .x = 39, .y = 17 }, { .x = 78, .y = 18 }, { .x = 64, .y = 46 }, { .x = 81, .y = 55 }, { .x = 10, .y = 79 }, { .x = 75, .y = 85 }, { .x = 44, .y = 17 }, { .x = 80, .y = 0 }, { .x = 78, .y = 34 }, { .x = 89, .y = 44 }, { .x = 20, .y = 60 }, { .x = 75, .y = 19 }, { .x = 95, .y = 68 }, { .x = 94, .y = 12 }, { .x = 96, .y = 22 }, { .x = 79, .y = 21 }, { .x = 72, .y = 52 }, { .x = 4, .y = 12 }, { .x = 32, .y = 21 }, { .x = 17, .y = 26 }, { .x = 94, .y = 39 }, { .x = 78, .y = 79 }, { .x = 2, .y = 56 }, { .x = 15, .y = 71 }, { .x = 95, .y = 63 }, { .x = 0, .y = 69 }, { .x = 76, .y = 76 }, { .x = 8, .y = 6 }, { .x = 40, .y = 52 }, { .x = 44, .y = 4 }, { .x = 57, .y = 85 }, { .x = 77, .y = 13 }, { .x = 34, .y = 17 }, { .x = 96, .y = 6 }, { .x = 36, .y = 62 }, { .x = 88, .y = 48 }, { .x = 64, .y = 41 }, { .x = 16, .y = 6 }, { .x = 86, .y = 13 } };
+void call_18(void)
+{
+    sink(345 ? zptr[5] : d_tmp, gptr <= 0x2e7e, ((unsigned long) sx[0]), hx(hx, 923, rcount), 0x840d, ((unsigned long) 0x87d0), 0xef06, gptr[1] ? 0x21dc : wcount[5], f_tmp.mcount, acount, c_tmp[3], (v), 256, scount[7] * 0x5fb7, 0xf41e / gcount[2], (185), 0x2571, 543 > 125, ((int) 54), px(fptr), 924 == 0xf23a, mcount[3] > 886, clen[8] | 0xc46d, ((int) 393), elen[8] || q, * d_tmp, (806), uptr->d2, 713 ^ elen[1], 0xe354 ? 0x1d86 : 0xd00f, gx && dx, plen / f2, ((char *) x2), ccount[6] || q_tmp, c % vlen[2], uptr[3] * xx, e2[8], 92, (0x4f9f), & 0xd47d, ax.qptr, 0xb2f << 0xd3d4, 0x5318 / fcount, ((int) 60), (n_tmp[8]), 0x53a1, dptr[2] != 0x99df, ecount == 0xa24e, xx(), 0x5245 << xx[9], m_tmp[8], fx(h2[9], 0x1c3f, 0xde41), 237 % n2, 59 < 431, 0xff47, d2, 0xc76e != 166, fcount ? hlen[3] : 329, rlen ? z : acount[8], (296), f2 & w2, w2[1] < 0xd911, x2 - 68, 930 ^ 0x5756, fcount->clen, dlen, rptr[3] | 827, mx->k_tmp, (vlen[4]), 206 ? hx : dptr[9], ! e2[0], 0x8145 == a2, t2[9] + 277, y_tmp(q, 0xcc87), (vlen), ecount ? 200 : 0x7439, v_tmp ? 0xdcdb : 159, ncount->qlen, xlen[0] << 48, ((const short) 488), (dptr), a2, r2[4] * 487, ! 0xbba6, (fptr[6]), f_tmp->plen, 881, - 0x4503, ncount[3], 695 != 494, slen[6] && u2, (0xa9a9), s_tmp - 398, k[4], 84 <= 565, 89, hcount / 0x3fad, blen / m2[6], dcount[6], 107);
+}
+enum { B18_0, B18_1, B18_2, B18_3, B18_4, B18_5, B18_6, B18_7, B18_8, B18_9, B18_10, B18_11, B18_12, B18_13, B18_14, B18_15, B18_16, B18_17, B18_18, B18_19, B18_20, B18_21, B18_22, B18_23, B18_24, B18_25, B18_26, B18_27, B18_28, B18_29, B18_30, B18_31, B18_32, B18_33, B18_34, B18_35, B18_36, B18_37, B18_38, B18_39, B18_40, B18_41, B18_42, B18_43, B18_44, B18_45, B18_46, B18_47, B18_48, B18_49, B18_50, B18_51, B18_52, B18_53, B18_54, B18_55, B18_56, B18_57, B18_58, B18_59, B18_60, B18_61, B18_62, B18_63, B18_64, B18_65, B18_66, B18_67, B18_68, B18_69, B18_70, B18_71, B18_72, B18_73, B18_74, B18_75, B18_76, B18_77, B18_78, B18_79, B18_80, B18_81, B18_82, B18_83, B18_84, B18_85, B18_86, B18_87, B18_88, B18_89, B18_90, B18_91, B18_92, B18_93, B18_94, B18_95, B18_96, B18_97, B18_98, B18_99, B18_100, B18_101, B18_102, B18_103, B18_104, B18_105, B18_106, B18_107, B18_108, B18_109, B18_110, B18_111, B18_112, B18_113, B18_114, B18_115, B18_116, B18_117, B18_118, B18_119, B18_120, B18_121, B18_122, B18_123, B18_124, B18_125, B18_126, B18_127, B18_128, B18_129, B18_130, B18_131, B18_132, B18_133, B18_134, B18_135, B18_136, B18_137, B18_138, B18_139, B18_140, B18_141, B18_142, B18_143, B18_144, B18_145, B18_146, B18_147, B18_148, B18_149 } big_18;
+
+int init_19[] = { 1109, 682, 971, 7887, 6490, 3089, 2632, 2355, 8701, 727, 1121, 4042, 2930, 8232, 2374, 5093, 8559, 5989, 2970, 3308, 1383, 6542, 7776, 8710, 1145, 1127, 1315, 6555, 7946, 550, 3386, 4192, 9526, 5349, 7772, 5764, 646, 3553, 1674, 1764, 536, 4378, 5686, 745, 5407, 8952, 3873, 8203, 7784, 6573, 7026, 4591, 2273, 4910, 1567, 649, 8392, 418, 1330, 4912, 9816, 6634, 2032, 1876, 9759, 1928, 4435, 4845, 6334, 4756, 6733, 9389, 5721, 3457, 4798, 5025, 4742, 8017, 194, 9714, 7977, 6000, 5468, 812, 2819, 8603, 6824, 6104, 1015, 5243, 6066, 7803, 4538, 7306, 3257, 2810, 2322, 7043, 3312, 6488, 4209, 2667, 4804, 3775, 97, 4676, 4336, 6078, 1652, 2619, 1680, 2918, 8952, 8315, 1038, 1507, 6587, 1786, 7521, 1613, 9498, 1299, 8673, 2252, 8057, 9811, 1189, 5119, 4651, 9242, 4031, 9493, 8405, 9149, 4720, 5928, 80, 5862, 7827, 3926, 2057, 7771, 2509, 6466, 1279, 5464, 9896, 7473, 5750, 9434, 5761, 1079, 6954, 29, 4406, 1803, 90, 8564, 7520, 7298, 6839, 3005, 787, 8090, 965, 5328, 6031, 320, 7542, 3419, 4555, 5801, 8709, 3788, 496, 5270, 1685, 8803, 1332, 8646, 5445, 8000, 268, 6895, 8897, 8561, 2761, 9772, 6197, 4363, 5072, 4311, 9354, 1925, 8118, 5159, 187, 6200, 4329, 8420 };
+struct point pts_19[] = { { .x = 73, .y = 37 }, { .x = 95, .y = 32 }, { .x = 35, .y = 1 }, { .x = 54, .y = 87 }, { .x = 71, .y = 68 }, { .x = 77, .y = 78 }, { .x = 20, .y = 21 }, { .x = 82, .y = 21 }, { .x = 94, .y = 78 }, { .x = 59, .y = 43 }, { .x = 56, .y = 14 }, { .x = 83, .y = 85 }, { .x = 79, .y = 95 }, { .x = 95, .y = 48 }, { .x = 15, .y = 93 }, { .x = 47, .y = 57 }, { .x = 64, .y = 26 }, { .x = 56, .y = 54 }, { .x = 71, .y = 53 }, { .x = 44, .y = 36 }, { .x = 99, .y = 96 }, { .x = 50, .y = 6 }, { .x = 70, .y = 82 }, { .x = 7, .y = 62 }, { .x = 72, .y = 61 }, { .x = 1, .y = 81 }, { .x = 65, .y = 67 }, { .x = 8, .y = 84 }, { .x = 71, .y = 30 }, { .x = 52, .y = 62 }, { .x = 72, .y = 9 }, { .x = 11, .y = 32 }, { .x = 19, .y = 18 }, { .x = 44, .y = 74 }, { .x = 17, .y = 56 }, { .x = 65, .y = 45 }, { .x = 76, .y = 36 }, { .x = 53, .y = 13 }, { .x = 18, .y = 81 }, { .x = 43, .y = 89 } };
+void call_19(void)
+{
+    sink(937 | 53, wx[9], xlen(dcount[7], 0xb8f7), qcount(), v2(k_tmp[8], 602, 0x7a51), 686 ? 366 : 285, ((unsigned long) 622), - ccount[5], ycount + k[3], vx(677), mptr, 0xe883, 32, z2(), 0x75ea, 0x7220, e2[1], 0x39f6 ^ 178, nptr[3] == b_tmp[7], elen, ccount[8], qx->xcount, 544, ~ acount[3], zptr || 766, 0xeee5, bx[6] ? y_tmp[6] : xcount[2], u && c2[3], qlen[0] / tcount[4], 138 || 0xc345, 474 & 837, 0x5ac7 % 379, 835 >= 0x7dc5, nx[0] ? 0xf4e8 : 422, 286, alen[7], m2[1], 299, 929, ! d2[7], 0xb2aa, 206, bcount(plen[2], yx), b_tmp >= scount, wx[3] > g2, q[9] ^ yptr[7], bptr - b, - d_tmp[5], 276, 0x9da0 <= 677, w2[5], (584), 0xc119, 12 || 0x76c2, 326, 0x723c * 0xcf25, nx[0], 0xde24, (z), elen(187, ax[2]), rlen->g2, 432 * yx, pptr != 0x9387, rcount(479, 617, k), dlen > 821, 980 + vlen, (70), ecount(0x23a5), (rcount), tx[2], flen, acount(376, 0x409f, kptr), * dptr, tx[1], 647, 0x4c59 < 0x356, cptr(xlen[2]), r_tmp ? e : 212, mcount[4] | nlen, b_tmp[3], xx.e2, e, 619 && 13, tptr[6] ? uptr : 73, (238), klen[7], 0x7cbc == kcount, b_tmp(455, 15), 0x6acb != dx, ux[5] & 360, 187 ^ 955, hcount(p2), ~ 0xf895, mcount[4] % 0x4487, zcount[1] <= ex, 0xaf54 - 0x2401, 0x2f7d <= 0x97ef, 512 % q_tmp, u2[8], 0x7dd9 ? u : 0xfc06);
+}
+enum { B19_0, B19_1, B19_2, B19_3, B19_4, B19_5, B19_6, B19_7, B19_8, B19_9, B19_10, B19_11, B19_12, B19_13, B19_14, B19_15, B19_16, B19_17, B19_18, B19_19, B19_20, B19_21, B19_22, B19_23, B19_24, B19_25, B19_26, B19_27, B19_28, B19_29, B19_30, B19_31, B19_32, B19_33, B19_34, B19_35, B19_36, B19_37, B19_38, B19_39, B19_40, B19_41, B19_42, B19_43, B19_44, B19_45, B19_46, B19_47, B19_48, B19_49, B19_50, B19_51, B19_52, B19_53, B19_54, B19_55, B19_56, B19_57, B19_58, B19_59, B19_60, B19_61, B19_62, B19_63, B19_64, B19_65, B19_66, B19_67, B19_68, B19_69, B19_70, B19_71, B19_72, B19_73, B19_74, B19_75, B19_76, B19_77, B19_78, B19_79, B19_80, B19_81, B19_82, B19_83, B19_84, B19_85, B19_86, B19_87, B19_88, B19_89, B19_90, B19_91, B19_92, B19_93, B19_94, B19_95, B19_96, B19_97, B19_98, B19_99, B19_100, B19_101, B19_102, B19_103, B19_104, B19_105, B19_106, B19_107, B19_108, B19_109, B19_110, B19_111, B19_112, B19_113, B19_114, B19_115, B19_116, B19_117, B19_118, B19_119, B19_120, B19_121, B19_122, B19_123, B19_124, B19_125, B19_126, B19_127, B19_128, B19_129, B19_130, B19_131, B19_132, B19_133, B19_134, B19_135, B19_136, B19_137, B19_138, B19_139, B19_140, B19_141, B19_142, B19_143, B19_144, B19_145, B19_146, B19_147, B19_148, B19_149 } big_19;
+
+int init_20[] = { 7249, 9640, 158, 6805, 9377, 2470, 3848, 8442, 6085, 5719, 1417, 4147, 828, 7702, 3696, 310, 419, 5524, 5873, 172, 228, 4816, 1913, 1665, 9232, 6983, 7915, 1176, 6249, 656, 9129, 5312, 398, 2330, 93, 4956, 7272, 4265, 1625, 2118, 5575, 4634, 491, 5348, 4929, 8677, 3938, 9815, 6620, 3349, 8370, 1020, 6389, 7832, 7286, 7283, 5777, 5555, 7150, 7286, 1435, 433, 9558, 4514, 851, 3127, 1916, 8554, 5341, 6686, 2759, 1370, 1039, 6475, 5740, 628, 2711, 4068, 3380, 7184, 3719, 4814, 7143, 7915, 5857, 8764, 7374, 7387, 6212, 8941, 6347, 6426, 9755, 1240, 1367, 6581, 84, 6265, 1295, 8881, 6912, 8147, 2525, 6805, 2951, 9961, 3120, 9692, 6029, 5318, 4480, 4130, 2045, 2707, 2287, 596, 8033, 4075, 7145, 2609, 6575, 3227, 3130, 1418, 3443, 1521, 3938, 4645, 2128, 2804, 1374, 571, 3955, 6403, 8056, 1071, 736, 9433, 2162, 9126, 7115, 6240, 3869, 9381, 5002, 386, 3240, 3631, 9781, 9772, 8865, 7067, 5676, 2190, 643, 7015, 9551, 6292, 3682, 1815, 1231, 5088, 387, 2644, 4944, 8908, 2216, 8536, 2907, 2262, 2093, 2990, 9978, 1522, 4458, 1498, 4554, 1779, 1388, 8873, 8464, 6671, 4524, 7154, 381, 2206, 7565, 9806, 3257, 4035, 1223, 3458, 2609, 6747, 2918, 3681, 6660, 416, 4838, 5426 };
+struct point pts_20[] = { { .x = 63, .y = 59 }, { .x = 20, .y = 23 }, { .x = 27, .y = 88 }, { .x = 49, .y = 78 }, { .x = 21, .y = 32 }, { .x = 40, .y = 20 }, { .x = 94, .y = 64 }, { .x = 14, .y = 14 }, { .x = 11, .y = 98 }, { .x = 20, .y = 11 }, { .x = 78, .y = 24 }, { .x = 19, .y = 73 }, { .x = 61, .y = 7 }, { .x = 2, .y = 66 }, { .x = 68, .y = 78 }, { .x = 74, .y = 79 }, { .x = 34, .y = 52 }, { .x = 23, .y = 69 }, { .x = 84, .y = 91 }, { .x = 73, .y = 29 }, { .x = 60, .y = 89 }, { .x = 67, .y = 77 }, { .x = 61, .y = 88 }, { .x = 46, .y = 45 }, { .x = 56, .y = 28 }, { .x = 21, .y = 15 }, { .x = 44, .y = 99 }, { .x = 10, .y = 90 }, { .x = 71, .y = 98 }, { .x = 46, .y = 71 }, { .x = 70, .y = 41 }, { .x = 34, .y = 80 }, { .x = 45, .y = 22 }, { .x = 56, .y = 26 }, { .x = 56, .y = 21 }, { .x = 56, .y = 80 }, { .x = 21, .y = 51 }, { .x = 87, .y = 59 }, { .x = 40, .y = 88 }, { .x = 43, .y = 63 } };
+void call_20(void)
+{
+    sink(h[0] != 215, bcount(gptr, 675), 117 || b2[5], slen.p2, h_tmp(d[9], vptr[8]), d, 0x23c5, ((int) yx[2]), y2(fx[1]), wlen[9], qptr(0xd75a, nx[4], g2), u_tmp.r2, bptr(flen[6], 209, qx[5]), (rcount), g2, a[2] == sx, 0x4c8c ? 0xf207 : c_tmp[2], c_tmp, ncount[1] + 0xd2b3, c2[8], ecount, ((char *) 0xd93f), 0xc40d >> 0x1293, ((const short) c), 0x5e76, (q2), clen.c2, (0xa931), 700, eptr(q_tmp, 0x4a32, wx[8]), 0x1ca6 << 801, h_tmp[9] || g2[1], y2[4], rx[4] == yx, & xx, vlen[4], u2.flen, slen(709, vptr), pptr(kx), 0xa9a5, tlen ? dx : nptr[9], b_tmp->r, d2 < 0x66b, 718 ? 389 : s_tmp, yptr > 969, ! eptr[0], p(rcount, zx[1], 68), aptr[2], ~ bptr, 718, 0x70d5 * rlen[9], r_tmp(), 0xa207, 0xb2f7, slen.zlen, 876, z_tmp[7] || 306, ~ 658, p(988), 0xa1c, r[9], vcount[8], dlen->v2, x2(e_tmp[9]), (u_tmp[9]), (0x37e9), r2(547, ex[8], zptr[7]), (nlen), u_tmp.x_tmp, y2 ? 0x8998 : 703, e[4] != 385, 952 > 42, e2[6] <= g_tmp[5], 0x2de7, xlen(862), a2[0], 27 < 0x1b21, scount.kcount, 0x4027, bptr << dlen, ((const short) xx[6]), m, 0x54bd * e_tmp[8], 0xe16a || 0xffac, w_tmp.p2, fcount, hx[0], b_tmp.wlen, w[2] ? mcount : 234, 506 <= 0x6459, - 0x5197, 0x4657 ? 209 : b_tmp[7], ((unsigned long) 0x989b), m_tmp ^ kptr, mcount[0], d2[0] | 0xe0b4, 39 ? w : e2[3], b2[6] >= 0x5e80, z_tmp.vx, 147);
+}
+enum { B20_0, B20_1, B20_2, B20_3, B20_4, B20_5, B20_6, B20_7, B20_8, B20_9, B20_10, B20_11, B20_12, B20_13, B20_14, B20_15, B20_16, B20_17, B20_18, B20_19, B20_20, B20_21, B20_22, B20_23, B20_24, B20_25, B20_26, B20_27, B20_28, B20_29, B20_30, B20_31, B20_32, B20_33, B20_34, B20_35, B20_36, B20_37, B20_38, B20_39, B20_40, B20_41, B20_42, B20_43, B20_44, B20_45, B20_46, B20_47, B20_48, B20_49, B20_50, B20_51, B20_52, B20_53, B20_54, B20_55, B20_56, B20_57, B20_58, B20_59, B20_60, B20_61, B20_62, B20_63, B20_64, B20_65, B20_66, B20_67, B20_68, B20_69, B20_70, B20_71, B20_72, B20_73, B20_74, B20_75, B20_76, B20_77, B20_78, B20_79, B20_80, B20_81, B20_82, B20_83, B20_84, B20_85, B20_86, B20_87, B20_88, B20_89, B20_90, B20_91, B20_92, B20_93, B20_94, B20_95, B20_96, B20_97, B20_98, B20_99, B20_100, B20_101, B20_102, B20_103, B20_104, B20_105, B20_106, B20_107, B20_108, B20_109, B20_110, B20_111, B20_112, B20_113, B20_114, B20_115, B20_116, B20_117, B20_118, B20_119, B20_120, B20_121, B20_122, B20_123, B20_124, B20_125, B20_126, B20_127, B20_128, B20_129, B20_130, B20_131, B20_132, B20_133, B20_134, B20_135, B20_136, B20_137, B20_138, B20_139, B20_140, B20_141, B20_142, B20_143, B20_144, B20_145, B20_146, B20_147, B20_148, B20_149 } big_20;
+
+int init_21[] = { 9628, 8160, 7673, 380, 4008, 7190, 7994, 8608, 7346, 6843, 127, 2050, 3181, 980, 5872, 9524, 8090, 6313, 4205, 2621, 2882, 190, 3930, 2179, 4321, 640, 9969, 625, 5100, 857, 4529, 7971, 2065, 4093, 7816, 8951, 2658, 6018, 2678, 6751, 579, 69, 9835, 3683, 177, 9469, 2484, 9863, 161, 7270, 815, 5198, 9135, 2545, 8668, 1498, 7150, 3015, 903, 4495, 1213, 2200, 2024, 4781, 620, 5560, 3523, 7451, 8174, 1488, 8004, 5398, 9989, 8014, 6398, 6967, 8524, 7401, 7093, 3602, 5644, 1251, 982, 6958, 2785, 2722, 4293, 3657, 8329, 6121, 261, 5738, 4600, 1241, 166, 6541, 4926, 3100, 7069, 5633, 8309, 7556, 4158, 2183, 4387, 2075, 7212, 6490, 6543, 5210, 6329, 618, 4135, 8651, 9655, 1896, 6469, 3702, 486, 9754, 9802, 3011, 4383, 9937, 915, 306, 5056, 5288, 9859, 3002, 1263, 4646, 5355, 6152, 1700, 399, 2471, 5449, 3137, 5280, 5666, 5321, 171, 5713, 8336, 6057, 4192, 9700, 5765, 2531, 9031, 609, 4483, 3395, 8470, 5521, 6226, 1443, 1287, 3639, 8069, 8735, 1993, 9932, 9753, 7105, 8838, 1813, 2141, 993, 729, 5046, 8897, 1037, 259, 5365, 8187, 7907, 1400, 7474, 6420, 8501, 9828, 5919, 2742, 4912, 3053, 7213, 1585, 7181, 9206, 2544, 3095, 7527, 9404, 3049, 6856, 4540, 265, 3519 };
+struct point pts_21[] = { { .x = 27, .y = 44 }, { .x = 55, .y = 53 }, { .x = 16, .y = 17 }, { .x = 64, .y = 21 }, { .x = 30, .y = 54 }, { .x = 14, .y = 79 }, { .x = 0, .y = 31 }, { .x = 99, .y = 11 }, { .x = 86, .y = 98 }, { .x = 15, .y = 89 }, { .x = 80, .y = 81 }, { .x = 65, .y = 6 }, { .x = 38, .y = 65 }, { .x = 0, .y = 97 }, { .x = 39, .y = 62 }, { .x = 90, .y = 3 }, { .x = 86, .y = 22 }, { .x = 75, .y = 95 }, { .x = 1, .y = 82 }, { .x = 78, .y = 33 }, { .x = 69, .y = 52 }, { .x = 39, .y = 13 }, { .x = 22, .y = 56 }, { .x = 42, .y = 13 }, { .x = 81, .y = 23 }, { .x = 72, .y = 3 }, { .x = 10, .y = 87 }, { .x = 52, .y = 7 }, { .x = 54, .y = 49 }, { .x = 9, .y = 45 }, { .x = 99, .y = 37 }, { .x = 85, .y = 0 }, { .x = 97, .y = 54 }, { .x = 66, .y = 84 }, { .x = 69, .y = 50 }, { .x = 86, .y = 92 }, { .x = 70, .y = 91 }, { .x = 79, .y = 65 }, { .x = 95, .y = 41 }, { .x = 24, .y = 69 } };
+void call_21(void)
+{
+    sink(y[6], dx, 0x5ae1, slen[8] <= u, cx != 694, (936), 976 >> qlen[4], e->z2, 0x4dcb ? v2 : wx[3], 574 == kx[8], vx[6] >= nx[3], 770, ! 844, 0x7b38, * 124, 718 ? 0xed78 : 666, flen(), & c_tmp, aptr, tptr * b2, nx, xlen <= b[8], 0x2552, dptr(), fx->d, wx & t_tmp, bx(147, m[0]), 485, 0xcad9, 372 || 660, & 730, rptr, ((unsigned long) a[7]), 504 << f_tmp[0], 0xa827, mlen.f2, g[9], ((const short) r2), 0xa314, wptr.nlen, clen(), (q[5]), * 888, ((int) t), 910 == tx, f_tmp[9], (rptr), ~ r, ~ 0xc6bd, p_tmp, plen[7], ((int) 0x243d), & tx, 2 == 0x9c08, - rx[9], pcount ? 368 : sx, ax ? v : gcount, 0xca91, 0xd61b & wptr[6], * x2[4], mptr->mlen, w[2], c2 + hlen[2], qlen[2], z_tmp->wptr, m2[6], ((char *) 260), - 629, fcount->zptr, k2.m2, bx(ulen), s2, z.mptr, k < cptr, ! fx[0], 0x8bc1 == 63, 643 ? 517 : 0x92bd, tcount[8] % f, 0x2478 || vx[6], 409 % dx[8], nptr ? 551 : cptr[8], ((const short) f2[0]), 330, w != 0x4584, 0xc4b9 ? eptr : 189, 744 ^ 0xc62b, ((const short) 773), 638, 517 ? 592 : kptr, 489 ? yptr[7] : 0x58c2, 0xf39e + zx, 0x2143 + b[5], 0xfe1 ? 0x3a68 : 0x71d2, 0x4125, f2->gcount, d_tmp > p2, ! 0x81f9, & 0xd977, (xx), e_tmp());
+}
+enum { B21_0, B21_1, B21_2, B21_3, B21_4, B21_5, B21_6, B21_7, B21_8, B21_9, B21_10, B21_11, B21_12, B21_13, B21_14, B21_15, B21_16, B21_17, B21_18, B21_19, B21_20, B21_21, B21_22, B21_23, B21_24, B21_25, B21_26, B21_27, B21_28, B21_29, B21_30, B21_31, B21_32, B21_33, B21_34, B21_35, B21_36, B21_37, B21_38, B21_39, B21_40, B21_41, B21_42, B21_43, B21_44, B21_45, B21_46, B21_47, B21_48, B21_49, B21_50, B21_51, B21_52, B21_53, B21_54, B21_55, B21_56, B21_57, B21_58, B21_59, B21_60, B21_61, B21_62, B21_63, B21_64, B21_65, B21_66, B21_67, B21_68, B21_69, B21_70, B21_71, B21_72, B21_73, B21_74, B21_75, B21_76, B21_77, B21_78, B21_79, B21_80, B21_81, B21_82, B21_83, B21_84, B21_85, B21_86, B21_87, B21_88, B21_89, B21_90, B21_91, B21_92, B21_93, B21_94, B21_95, B21_96, B21_97, B21_98, B21_99, B21_100, B21_101, B21_102, B21_103, B21_104, B21_105, B21_106, B21_107, B21_108, B21_109, B21_110, B21_111, B21_112, B21_113, B21_114, B21_115, B21_116, B21_117, B21_118, B21_119, B21_120, B21_121, B21_122, B21_123, B21_124, B21_125, B21_126, B21_127, B21_128, B21_129, B21_130, B21_131, B21_132, B21_133, B21_134, B21_135, B21_136, B21_137, B21_138, B21_139, B21_140, B21_141, B21_142, B21_143, B21_144, B21_145, B21_146, B21_147, B21_148, B21_149 } big_21;
+
+int init_22[] = { 5775, 3465, 2958, 3626, 336, 4195, 1935, 4436, 1797, 250, 3857, 6831, 2083, 7295, 108, 3660, 8527, 7850, 1409, 8053, 3165, 8306, 2598, 2608, 1459, 5662, 5184, 9280, 2189, 4070, 2346, 965, 5005, 9893, 5833, 8610, 9025, 5787, 219, 496, 563, 5896, 7074, 823, 9360, 5242, 9424, 2332, 9796, 4924, 3265, 1678, 8196, 276, 1119, 837, 7196, 6591, 8913, 9246, 7006, 7822, 5020, 3070, 645, 8622, 2367, 4083, 8859, 103, 7691, 2104, 4866, 8012, 1707, 3625, 8028, 5402, 7006, 9591, 8183, 8944, 1213, 6966, 1655, 3663, 3194, 6617, 8753, 9786, 1403, 1504, 6209, 7616, 7298, 4771, 9777, 1063, 9394, 8076, 5212, 4276, 768, 6331, 8751, 9868, 3660, 4429, 8833, 4918, 8046, 1684, 8129, 7899, 9685, 3625, 1777, 3973, 3085, 8669, 6399, 5958, 7631, 9538, 3754, 1449, 4726, 3107, 2380, 9329, 8654, 8266, 2032, 5165, 105, 6270, 610, 5773, 3194, 990, 2221, 982, 2750, 3816, 724, 642, 5897, 7341, 7735, 5394, 1500, 9952, 5093, 9306, 348, 9126, 4227, 2260, 436, 8585, 2694, 1980, 9918, 680, 4606, 7982, 2302, 776, 147, 8674, 4265, 8119, 5261, 4789, 9598, 8913, 8987, 5749, 3541, 7635, 6272, 8030, 2111, 8800, 8731, 8586, 4023, 9106, 3342, 7829, 7592, 5638, 7965, 7172, 312, 3048, 1279, 9162, 4423, 2907 };
+struct point pts_22[] = { { .x = 39, .y = 70 }, { .x = 74, .y = 74 }, { .x = 4, .y = 81 }, { .x = 71, .y = 82 }, { .x = 9, .y = 61 }, { .x = 1, .y = 27 }, { .x = 89, .y = 95 }, { .x = 99, .y = 32 }, { .x = 63, .y = 96 }, { .x = 76, .y = 40 }, { .x = 6, .y = 19 }, { .x = 46, .y = 11 }, { .x = 32, .y = 64 }, { .x = 87, .y = 53 }, { .x = 30, .y = 61 }, { .x = 60, .y = 12 }, { .x = 54, .y = 11 }, { .x = 0, .y = 42 }, { .x = 79, .y = 6 }, { .x = 98, .y = 82 }, { .x = 41, .y = 66 }, { .x = 41, .y = 64 }, { .x = 57, .y = 13 }, { .x = 91, .y = 52 }, { .x = 53, .y = 63 }, { .x = 97, .y = 26 }, { .x = 84, .y = 66 }, { .x = 7, .y = 0 }, { .x = 19, .y = 43 }, { .x = 40, .y = 21 }, { .x = 25, .y = 30 }, { .x = 40, .y = 80 }, { .x = 70, .y = 81 }, { .x = 83, .y = 85 }, { .x = 12, .y = 53 }, { .x = 25, .y = 0 }, { .x = 16, .y = 57 }, { .x = 38, .y = 29 }, { .x = 98, .y = 89 }, { .x = 83, .y = 6 } };
+void call_22(void)
+{
+    sink(mlen | 0x3be9, (493), ~ 0x7281, 0xc544 + 0x4491, d_tmp || 394, e_tmp(), 0x904c ? p : tptr[5], nlen == plen[5], hptr[3], ~ d_tmp[3], (0xe8af), 534, hptr(nlen[0], g_tmp[5], ycount), ((const short) 648), vptr[8] % aptr[8], ((int) zx), 853 - u_tmp, x2 == 51, a >= 0xab7a, h2(), gptr[5] && e2, c2[1] ^ 0xc5aa, 185, - d, 381, d[5] | 369, (663), aptr(rcount, bptr, g_tmp), zlen < z[1], 564 & t2[5], r(tcount[9]), 0x1f1b ? k2 : 0xd14c, cptr, 0xc9bc == 627, zlen % 0x6659, 454, ucount(787), (wcount), 0x2b4e < 0xa5df, ((char *) s_tmp[4]), (0x1863), p[1], 0xab22 >> 142, ycount.f, (0xcb69), (0x984a), t(y2[0]), fptr[7] >> 0x1357, ((unsigned long) klen[0]), qx(0x225, ncount[0], 237), * 0xcdce, gptr(dptr), 0xf53 ? rcount[1] : kx, vptr << ulen[2], px->y, sptr(988, g2[2]), & klen[0], gcount || 0x22cb, f_tmp(0x7015, 426, 87), ((int) 329), ! 0x3827, 0x6184, 0x8cfe, 546 % 532, 255 * t, n[7] >= d2, & 0x9734, x, mptr[1] ? r2 : 939, u[1] ? m[1] : 0x9ce, 425 ? x_tmp[9] : 824, kx[4], ((const short) f), dlen[6] / ulen, bcount->m_tmp, e_tmp[6] & 0xe9b9, 0xa5e | 580, mptr[3], 0xa132 % q, 0x9fa4 % t_tmp, 131, 0x80ff - m_tmp[3], ((const short) 0xa901), 918 >> x2, plen->k_tmp, rcount[5] > t2, 947, v[8] >> 386, dptr != 856, mlen->wcount, 0xedca > qlen[8], d2 == 0xabd7, 0x98e5 && 0xd88a, zx(ax[5], t_tmp, 0xb002), 0x42fb, - xptr, 152, (t_tmp), - 561, - 0x1ffb);
+}
+enum { B22_0, B22_1, B22_2, B22_3, B22_4, B22_5, B22_6, B22_7, B22_8, B22_9, B22_10, B22_11, B22_12, B22_13, B22_14, B22_15, B22_16, B22_17, B22_18, B22_19, B22_20, B22_21, B22_22, B22_23, B22_24, B22_25, B22_26, B22_27, B22_28, B22_29, B22_30, B22_31, B22_32, B22_33, B22_34, B22_35, B22_36, B22_37, B22_38, B22_39, B22_40, B22_41, B22_42, B22_43, B22_44, B22_45, B22_46, B22_47, B22_48, B22_49, B22_50, B22_51, B22_52, B22_53, B22_54, B22_55, B22_56, B22_57, B22_58, B22_59, B22_60, B22_61, B22_62, B22_63, B22_64, B22_65, B22_66, B22_67, B22_68, B22_69, B22_70, B22_71, B22_72, B22_73, B22_74, B22_75, B22_76, B22_77, B22_78, B22_79, B22_80, B22_81, B22_82, B22_83, B22_84, B22_85, B22_86, B22_87, B22_88, B22_89, B22_90, B22_91, B22_92, B22_93, B22_94, B22_95, B22_96, B22_97, B22_98, B22_99, B22_100, B22_101, B22_102, B22_103, B22_104, B22_105, B22_106, B22_107, B22_108, B22_109, B22_110, B22_111, B22_112, B22_113, B22_114, B22_115, B22_116, B22_117, B22_118, B22_119, B22_120, B22_121, B22_122, B22_123, B22_124, B22_125, B22_126, B22_127, B22_128, B22_129, B22_130, B22_131, B22_132, B22_133, B22_134, B22_135, B22_136, B22_137, B22_138, B22_139, B22_140, B22_141, B22_142, B22_143, B22_144, B22_145, B22_146, B22_147, B22_148, B22_149 } big_22;
+
+int init_23[] = { 8490, 7551, 8401, 1044, 2437, 3746, 1307, 2402, 613, 1793, 5139, 9481, 4153, 8392, 2298, 6123, 4987, 4353, 1302, 6744, 4117, 8647, 9118, 9229, 9511, 1799, 8760, 7693, 6794, 2761, 5160, 8716, 778, 6407, 8542, 6875, 7664, 2937, 1689, 3187, 9695, 6455, 2277, 2133, 24, 1384, 4918, 1148, 161, 1611, 6925, 1078, 5379, 2065, 9399, 5089, 6227, 9726, 9498, 4691, 8802, 8089, 629, 4383, 3863, 1859, 3553, 8905, 6848, 9239, 3919, 8065, 6590, 8947, 1926, 8315, 1276, 2040, 1247, 3889, 2662, 7443, 8835, 5324, 1344, 2471, 2237, 6432, 6251, 8624, 2079, 2427, 649, 1645, 5330, 2390, 5532, 614, 5605, 904, 3280, 6958, 1914, 3410, 122, 1028, 2194, 7955, 7366, 5371, 8753, 6775, 4244, 750, 9487, 3804, 2836, 8584, 7030, 6106, 1171, 5898, 8465, 9469, 5344, 4678, 2833, 8930, 5205, 2544, 4649, 6190, 1018, 6528, 9517, 181, 1279, 4321, 5293, 2176, 5571, 3119, 8180, 142, 3825, 2031, 4301, 2018, 8044, 4491, 5891, 7844, 3381, 1466, 9448, 6741, 3533, 4314, 9399, 6577, 8503, 9539, 3396, 427, 2853, 8355, 953, 1287, 612, 8191, 3839, 7373, 1441, 3470, 6097, 4121, 6121, 7573, 7123, 2070, 4012, 4938, 9420, 7915, 7036, 179, 461, 3964, 8527, 4377, 7279, 6128, 6108, 2515, 5646, 446, 5902, 4227, 4267, 6052 };
+struct point pts_23[] = { { .x = 50, .y = 82 }, { .x = 68, .y = 50 }, { .x = 33, .y = 64 }, { .x = 46, .y = 46 }, { .x = 14, .y = 67 }, { .x = 17, .y = 64 }, { .x = 52, .y = 38 }, { .x = 34, .y = 6 }, { .x = 39, .y = 12 }, { .x = 9, .y = 36 }, { .x = 34, .y = 28 }, { .x = 44, .y = 91 }, { .x = 9, .y = 49 }, { .x = 49, .y = 78 }, { .x = 94, .y = 11 }, { .x = 2, .y = 59 }, { .x = 19, .y = 85 }, { .x = 90, .y = 52 }, { .x = 83, .y = 15 }, { .x = 91, .y = 47 }, { .x = 54, .y = 59 }, { .x = 49, .y = 72 }, { .x = 21, .y = 2 }, { .x = 94, .y = 53 }, { .x = 33, .y = 51 }, { .x = 27, .y = 34 }, { .x = 21, .y = 49 }, { .x = 69, .y = 98 }, { .x = 91, .y = 89 }, { .x = 90, .y = 95 }, { .x = 75, .y = 94 }, { .x = 71, .y = 21 }, { .x = 4, .y = 41 }, { .x = 57, .y = 23 }, { .x = 44, .y = 76 }, { .x = 15, .y = 19 }, { .x = 18, .y = 15 }, { .x = 44, .y = 29 }, { .x = 59, .y = 70 }, { .x = 83, .y = 89 } };
+void call_23(void)
+{
+    sink(0xe9cb, * y, 352, 0xb8c0, 0x679f ? xcount : m2, k, ex * wptr[2], f % z2, 0xc90e & 267, 114 | 0x1569, qptr[2] ? fcount[0] : 195, e_tmp % mx[3], 0x8b55 > 0xfca0, f[0] <= 821, k_tmp, h.kptr, w2 + kcount[2], cptr || x2[9], y_tmp[5], cptr(), nx(194), b2, 0xdb54 * 0xdf93, 917 >> 0x8f8f, w_tmp.z2, 0x7fcc, c2, 640 * qcount[7], 68, g_tmp[7] >> 0xac2d, 610 % 0xd59, k_tmp ^ 774, 125 < vcount[0], 434, ((unsigned long) q2), 0xca3f, 0xb63e || yptr, a2, 0x163e % 129, kx, & 0x396, 0x6d56, 331, qlen(t2, g2), ((unsigned long) dcount[6]), 0x4fea | t_tmp, 0xdf6d, a2 != mcount, 0x9a09 % 621, vx, ((unsigned long) v_tmp[7]), v_tmp, 0xd5b6 > e_tmp, ylen(0xb536), 0x6cb7, 0x540f, * rlen, (384), 0xfcc9 ^ x_tmp, a2[0], (573), 0x1397 ? n[8] : 564, 500, p2.hlen, e != 0x7a13, 0x6f89 ? 0xa980 : 0x1795, ucount.z_tmp, 551, 0x5e12 * 0xf201, 0x5fcc, ycount[3], q_tmp | 97, (r2), ((unsigned long) k), tx[1], pptr->u_tmp, rlen, 0x784e & 0x8dea, s, 0x1adb / 0xa0d1, ((int) 0xdd05), fcount(34, 0x4c38, scount[7]), & 0x758, s[9], h[9], vlen->x, (xlen), 861, ((int) s_tmp[5]), yptr, z_tmp[1], ((unsigned long) 623), vcount == dptr, d[8] == 180, ((char *) 648), 0x4650 / vlen, 424 + 352, * 145, qx.ecount, 0x3fb3 <= rcount[3]);
+}
+enum { B23_0, B23_1, B23_2, B23_3, B23_4, B23_5, B23_6, B23_7, B23_8, B23_9, B23_10, B23_11, B23_12, B23_13, B23_14, B23_15, B23_16, B23_17, B23_18, B23_19, B23_20, B23_21, B23_22, B23_23, B23_24, B23_25, B23_26, B23_27, B23_28, B23_29, B23_30, B23_31, B23_32, B23_33, B23_34, B23_35, B23_36, B23_37, B23_38, B23_39, B23_40, B23_41, B23_42, B23_43, B23_44, B23_45, B23_46, B23_47, B23_48, B23_49, B23_50, B23_51, B23_52, B23_53, B23_54, B23_55, B23_56, B23_57, B23_58, B23_59, B23_60, B23_61, B23_62, B23_63, B23_64, B23_65, B23_66, B23_67, B23_68, B23_69, B23_70, B23_71, B23_72, B23_73, B23_74, B23_75, B23_76, B23_77, B23_78, B23_79, B23_80, B23_81, B23_82, B23_83, B23_84, B23_85, B23_86, B23_87, B23_88, B23_89, B23_90, B23_91, B23_92, B23_93, B23_94, B23_95, B23_96, B23_97, B23_98, B23_99, B23_100, B23_101, B23_102, B23_103, B23_104, B23_105, B23_106, B23_107, B23_108, B23_109, B23_110, B23_111, B23_112, B23_113, B23_114, B23_115, B23_116, B23_117, B23_118, B23_119, B23_120, B23_121, B23_122, B23_123, B23_124, B23_125, B23_126, B23_127, B23_128, B23_129, B23_130, B23_131, B23_132, B23_133, B23_134, B23_135, B23_136, B23_137, B23_138, B23_139, B23_140, B23_141, B23_142, B23_143, B23_144, B23_145, B23_146, B23_147, B23_148, B23_149 } big_23;
+
+int init_24[] = { 8658, 7437, 6927, 4322, 7838, 6443, 5438, 3227, 3008, 2324, 8800, 1961, 9740, 7911, 9289, 9131, 2978, 6032, 4557, 2427, 8079, 7351, 4370, 2158, 9990, 3672, 8925, 8427, 7795, 8715, 9376, 3678, 1328, 5160, 667, 1, 8193, 5399, 2943, 6990, 3352, 7122, 4966, 4138, 2599, 6409, 7257, 74, 1155, 3910, 3189, 7872, 8973, 5973, 7117, 8820, 2008, 5586, 8133, 3472, 1761, 6373, 6942, 3027, 8865, 2848, 5602, 7993, 9494, 1892, 5601, 6321, 484, 9961, 4617, 332, 266, 9233, 7903, 5435, 8937, 3805, 1261, 2632, 9353, 6858, 4151, 6352, 9229, 9027, 7903, 2530, 9580, 4110, 7216, 4068, 9909, 8986, 9452, 1031, 2680, 5400, 6103, 4232, 3405, 8936, 3909, 3641, 1997, 7379, 232, 8227, 2436, 4460, 8365, 1621, 4914, 9055, 6939, 3071, 2089, 437, 8727, 3640, 2952, 9230, 3, 1699, 1866, 7967, 1604, 9797, 7306, 549, 4168, 6725, 3029, 6427, 1566, 3467, 6285, 6551, 3789, 4216, 3700, 6098, 5280, 4468, 986, 48, 4522, 3769, 1074, 2594, 6157, 9398, 2021, 6047, 5457, 7494, 9890, 8276, 9551, 9853, 1850, 2369, 5313, 3531, 8834, 8501, 6760, 8892, 685, 4040, 6261, 1034, 5623, 2365, 5702, 9947, 1238, 1073, 5926, 2373, 4285, 482, 2133, 3058, 5715, 1758, 6321, 7834, 1265, 6689, 3066, 1313, 4721, 6696, 9115, 4518 };
+struct point pts_24[] = { { .x = 45, .y = 36 }, { .x = 56, .y = 47 }, { .x = 53, .y = 28 }, { .x = 59, .y = 6 }, { .x = 65, .y = 12 }, { .x = 53, .y = 15 }, { .x = 62, .y = 7 }, { .x = 48, .y = 91 }, { .x = 23, .y = 58 }, { .x = 35, .y = 26 }, { .x = 3, .y = 41 }, { .x = 76, .y = 56 }, { .x = 94, .y = 87 }, { .x = 6, .y = 54 }, { .x = 29, .y = 81 }, { .x = 3, .y = 4 }, { .x = 27, .y = 97 }, { .x = 31, .y = 94 }, { .x = 76, .y = 1 }, { .x = 83, .y = 61 }, { .x = 44, .y = 90 }, { .x = 71, .y = 90 }, { .x = 81, .y = 14 }, { .x = 54, .y = 72 }, { .x = 31, .y = 15 }, { .x = 52, .y = 94 }, { .x = 96, .y = 99 }, { .x = 60, .y = 82 }, { .x = 19, .y = 9 }, { .x = 95, .y = 20 }, { .x = 19, .y = 95 }, { .x = 50, .y = 21 }, { .x = 45, .y = 90 }, { .x = 81, .y = 95 }, { .x = 58, .y = 42 }, { .x = 34, .y = 22 }, { .x = 14, .y = 61 }, { .x = 30, .y = 97 }, { .x = 2, .y = 95 }, { .x = 66, .y = 83 } };
+void call_24(void)
+{
+    sink(0xf276, 249 ? zlen[6] : gcount[5], (0x72de), wcount[8], ~ 0xa3ba, ~ mx[6], vptr, bx && 0xb815, q2[5] ? gcount[1] : ccount, h2 <= 0x8496, 0xae31 | 771, ((const short) x[1]), * 0xeade, b_tmp, v2 > vptr, 0xcf64 && 715, 711 || 0x97c2, 550 == 195, hptr[8] && 436, (872), ((const short) 880), (793), g >= tptr, 873 - p, 640, r_tmp, 0x4ee3, 0xe993, (0xe606), vcount & 0x6796, * 517, (t_tmp[1]), bptr(q_tmp), ((const short) c[2]), 0x9923 + 393, 635, x->uptr, 0x8322, d * 858, vcount[3] ? 234 : wx, ! ex, & 108, 149, 0x2f17 % zptr[8], c->sx, sptr(201, tlen[5]), 671 & 0x559c, 508, alen + 317, ((char *) ulen[1]), b_tmp, wptr[4], 0xe380 < gcount[8], ex[7] * z_tmp, (tcount), 0x2d46 * 0x3d5d, fx[9], y[5], e_tmp(dcount), 0xf1ec == rx, 0xb264 != hx[6], tcount(scount[1]), u2->x, ((char *) ex), ycount, 569 < gcount, ~ 287, 0x8821, & aptr, gptr << 922, ((unsigned long) bptr[9]), 995, b * gx[9], zlen - 0x1fc8, 0xd8d5, vptr + k, nptr ? 347 : 14, 167 ^ alen, u[5] != pptr, 0xc4f7 * 155, 0x8c8 - 208, 0x4d8c << 0x8cf, ((int) c2), * mlen[4], 0xdf71 | 933, wcount->d, & g2[4], xcount == 0x81dc, ((int) xptr), qx.hx, 978, d_tmp->p2, ~ kcount, v2[5] == cx, w2->dlen, tx(), f2 <= 934, sptr, 0x6575 >> dx, m_tmp && r_tmp);
+}
+enum { B24_0, B24_1, B24_2, B24_3, B24_4, B24_5, B24_6, B24_7, B24_8, B24_9, B24_10, B24_11, B24_12, B24_13, B24_14, B24_15, B24_16, B24_17, B24_18, B24_19, B24_20, B24_21, B24_22, B24_23, B24_24, B24_25, B24_26, B24_27, B24_28, B24_29, B24_30, B24_31, B24_32, B24_33, B24_34, B24_35, B24_36, B24_37, B24_38, B24_39, B24_40, B24_41, B24_42, B24_43, B24_44, B24_45, B24_46, B24_47, B24_48, B24_49, B24_50, B24_51, B24_52, B24_53, B24_54, B24_55, B24_56, B24_57, B24_58, B24_59, B24_60, B24_61, B24_62, B24_63, B24_64, B24_65, B24_66, B24_67, B24_68, B24_69, B24_70, B24_71, B24_72, B24_73, B24_74, B24_75, B24_76, B24_77, B24_78, B24_79, B24_80, B24_81, B24_82, B24_83, B24_84, B24_85, B24_86, B24_87, B24_88, B24_89, B24_90, B24_91, B24_92, B24_93, B24_94, B24_95, B24_96, B24_97, B24_98, B24_99, B24_100, B24_101, B24_102, B24_103, B24_104, B24_105, B24_106, B24_107, B24_108, B24_109, B24_110, B24_111, B24_112, B24_113, B24_114, B24_115, B24_116, B24_117, B24_118, B24_119, B24_120, B24_121, B24_122, B24_123, B24_124, B24_125, B24_126, B24_127, B24_128, B24_129, B24_130, B24_131, B24_132, B24_133, B24_134, B24_135, B24_136, B24_137, B24_138, B24_139, B24_140, B24_141, B24_142, B24_143, B24_144, B24_145, B24_146, B24_147, B24_148, B24_149 } big_24;
+
+int init_25[] = { 9414, 1132, 2804, 961, 8989, 600, 3890, 7511, 1695, 5823, 8178, 4315, 8365, 4926, 2867, 3215, 3860, 9325, 9431, 4933, 4854, 7356, 8236, 4897, 7239, 8216, 6760, 6282, 5247, 5674, 7575, 6550, 7791, 4641, 9311, 382, 9835, 5292, 5625, 859, 4031, 1512, 5164, 1370, 6682, 4785, 6906, 9647, 7314, 2461, 74, 2681, 2826, 1265, 3773, 5727, 3574, 4421, 1521, 7069, 1488, 2054, 1734, 2358, 8742, 3541, 7960, 9987, 5444, 8747, 925, 9965, 1157, 9096, 4068, 5775, 8375, 4554, 5021, 9671, 5880, 7300, 7815, 735, 7048, 6509, 1896, 8851, 8718, 1481, 4295, 7655, 6116, 9818, 280, 9518, 6095, 4314, 3313, 3036, 6983, 1570, 4896, 5383, 6613, 7446, 7299, 2446, 4937, 5640, 8988, 4477, 750, 3774, 5292, 1336, 9003, 3429, 1223, 6880, 3898, 2402, 1854, 1284, 569, 2261, 6537, 4284, 3919, 78, 1161, 9584, 5432, 3589, 7347, 3027, 6176, 5559, 2330, 978, 9658, 164, 9718, 4436, 4651, 8148, 5438, 7983, 4173, 2425, 4235, 1347, 4782, 5776, 9407, 8878, 4418, 5873, 8346, 5385, 8456, 5643, 9924, 9130, 2144, 411, 6749, 5465, 2066, 5593, 5645, 1099, 8920, 1219, 8754, 2662, 5617, 2249, 5438, 9419, 3895, 6449, 7694, 5184, 7536, 2961, 957, 2615, 5299, 6142, 1707, 7856, 9350, 5163, 2017, 7166, 5880, 2674, 3095, 1637 };
+struct point pts_25[] = { { .x = 88, .y = 66 }, { .x = 93, .y = 47 }, { .x = 41, .y = 15 }, { .x = 85, .y = 78 }, { .x = 89, .y = 72 }, { .x = 95, .y = 24 }, { .x = 58, .y = 37 }, { .x = 84, .y = 6 }, { .x = 68, .y = 20 }, { .x = 34, .y = 34 }, { .x = 83, .y = 11 }, { .x = 57, .y = 14 }, { .x = 28, .y = 93 }, { .x = 81, .y = 4 }, { .x = 30, .y = 11 }, { .x = 48, .y = 15 }, { .x = 78, .y = 53 }, { .x = 41, .y = 81 }, { .x = 83, .y = 89 }, { .x = 87, .y = 8 }, { .x = 18, .y = 60 }, { .x = 26, .y = 85 }, { .x = 66, .y = 43 }, { .x = 9, .y = 81 }, { .x = 64, .y = 2 }, { .x = 7, .y = 83 }, { .x = 61, .y = 99 }, { .x = 54, .y = 38 }, { .x = 31, .y = 2 }, { .x = 10, .y = 71 }, { .x = 24, .y = 77 }, { .x = 55, .y = 27 }, { .x = 24, .y = 97 }, { .x = 26, .y = 95 }, { .x = 82, .y = 49 }, { .x = 52, .y = 80 }, { .x = 53, .y = 75 }, { .x = 68, .y = 20 }, { .x = 12, .y = 32 }, { .x = 92, .y = 80 } };
+void call_25(void)
+{
+    sink(ncount * tlen[3], ((char *) zptr[3]), 0xecde - 780, xlen(0x3154, 0x9448, eptr[0]), sx[8] ? a : 0xe9f7, 0x2dd2 != ux, 171 << hptr, & 0x97e3, ~ mx, 328, 714, ! 855, k2[4], h2(917, t_tmp, c2), * n_tmp[7], 0x1ee9, 999, ~ 0xa0b7, h->ylen, a_tmp, 11 - c, 745, y_tmp[4] | n2[2], 646 ^ 0x6fa2, & 0x7298, h2[7] ? yx[2] : 0x909c, e2[5], * e[4], (dlen[0]), g % 0xaafd, kx.n2, e2 & 716, 0x5803 > 0xf813, 0xa297 && zx[9], 128 >= xlen, (a[5]), gptr->yx, (ulen[0]), 230, n2(57, 653, 762), gptr->cptr, 0xe91f, 101 < 0xa53b, 0x5c3f, f, 0xa10a << w_tmp[1], * 0xa3a1, tx[6] <= q[5], ylen ^ hcount[6], hx[5] && fptr[2], ecount[5], b[7] - 384, 0xdfb8 & s2, p_tmp, 0x834d, 0xd43 + t_tmp, 0x98ba <= 597, e_tmp(231, 520), rptr[4], e2->wcount, 0xc0ff % 0x1383, dcount != mlen, 0xaab1, wcount[7], ~ 702, 588, 59 & slen[7], 669 ? 0x7316 : k2[0], - h, e_tmp[7] * 0x73c7, s_tmp[3], rx, tcount[0], 0xa9b7 || c2, 0x68cc, cx[6], ccount ? 70 : dcount[3], 0x72d2 ? 0x8ac7 : 328, (g_tmp[5]), nlen[3] ? 0xaada : v2[5], * 0x64c8, aptr->vcount, rptr(426, g2), & yptr[7], (307), 633 < 0x587d, (484), 0xecf8, 899 ? u2[5] : 342, (0xf2f9), tcount->slen, aptr >> vlen[4], & 31, 0xca83 >= 0xd601, 0xa04a ? 0x17ff : 0xac6c, q2(0x3844, a_tmp, d2), ((const short) xcount), elen.a, 0xed9f ? 0x154a : u2, e_tmp.fcount);
+}
+enum { B25_0, B25_1, B25_2, B25_3, B25_4, B25_5, B25_6, B25_7, B25_8, B25_9, B25_10, B25_11, B25_12, B25_13, B25_14, B25_15, B25_16, B25_17, B25_18, B25_19, B25_20, B25_21, B25_22, B25_23, B25_24, B25_25, B25_26, B25_27, B25_28, B25_29, B25_30, B25_31, B25_32, B25_33, B25_34, B25_35, B25_36, B25_37, B25_38, B25_39, B25_40, B25_41, B25_42, B25_43, B25_44, B25_45, B25_46, B25_47, B25_48, B25_49, B25_50, B25_51, B25_52, B25_53, B25_54, B25_55, B25_56, B25_57, B25_58, B25_59, B25_60, B25_61, B25_62, B25_63, B25_64, B25_65, B25_66, B25_67, B25_68, B25_69, B25_70, B25_71, B25_72, B25_73, B25_74, B25_75, B25_76, B25_77, B25_78, B25_79, B25_80, B25_81, B25_82, B25_83, B25_84, B25_85, B25_86, B25_87, B25_88, B25_89, B25_90, B25_91, B25_92, B25_93, B25_94, B25_95, B25_96, B25_97, B25_98, B25_99, B25_100, B25_101, B25_102, B25_103, B25_104, B25_105, B25_106, B25_107, B25_108, B25_109, B25_110, B25_111, B25_112, B25_113, B25_114, B25_115, B25_116, B25_117, B25_118, B25_119, B25_120, B25_121, B25_122, B25_123, B25_124, B25_125, B25_126, B25_127, B25_128, B25_129, B25_130, B25_131, B25_132, B25_133, B25_134, B25_135, B25_136, B25_137, B25_138, B25_139, B25_140, B25_141, B25_142, B25_143, B25_144, B25_145, B25_146, B25_147, B25_148, B25_149 } big_25;
+
+int init_26[] = { 8060, 8582, 5722, 454, 6548, 4319, 5293, 4361, 6432, 9540, 8362, 2647, 5407, 3292, 1163, 3061, 809, 3599, 6260, 6074, 5540, 7981, 1079, 4981, 6253, 5741, 4553, 3511, 1147, 6437, 4881, 1354, 6159, 7073, 1923, 9319, 6183, 7119, 4476, 5632, 204, 4817, 5928, 7456, 7304, 3569, 3551, 2482, 3041, 253, 9769, 5546, 4121, 8027, 7529, 5336, 7909, 3370, 537, 913, 2319, 7524, 9306, 1776, 8138, 3302, 5361, 1582, 7542, 1939, 8475, 1149, 3105, 8455, 9320, 9628, 4133, 3399, 7117, 1128, 1603, 9627, 6836, 627, 954, 8311, 8446, 1015, 8842, 594, 4802, 607, 3638, 812, 2035, 3599, 5007, 8808, 6709, 2930, 6359, 1394, 161, 5353, 5654, 9125, 4128, 3772, 4964, 9631, 1534, 1693, 6545, 6559, 8834, 2782, 5862, 1762, 1394, 759, 5118, 6573, 7517, 1872, 193, 6587, 5126, 8267, 1517, 9262, 8434, 1508, 2278, 6333, 5666, 7685, 2481, 8061, 442, 2514, 4553, 8285, 2498, 6726, 6309, 8933, 67, 5346, 8246, 937, 6445, 5910, 7669, 8984, 8171, 9527, 9174, 7736, 9360, 2889, 6927, 4994, 1625, 4145, 140, 1392, 9995, 2836, 6445, 8433, 8772, 501, 1757, 9252, 5438, 2533, 1806, 5472, 4342, 8970, 4948, 368, 2563, 8942, 9780, 1268, 2020, 9511, 4081, 601, 8109, 2917, 7642, 5627, 9697, 8967, 7080, 420, 2283, 9853 };
+struct point pts_26[] = { { .x = 1, .y = 8 }, { .x = 81, .y = 8 }, { .x = 70, .y = 0 }, { .x = 90, .y = 7 }, { .x = 38, .y = 73 }, { .x = 81, .y = 52 }, { .x = 61, .y = 78 }, { .x = 6, .y = 53 }, { .x = 33, .y = 63 }, { .x = 20, .y = 82 }, { .x = 29, .y = 75 }, { .x = 21, .y = 73 }, { .x = 9, .y = 58 }, { .x = 0, .y = 4 }, { .x = 47, .y = 9 }, { .x = 92, .y = 91 }, { .x = 60, .y = 75 }, { .x = 85, .y = 40 }, { .x = 24, .y = 9 }, { .x = 29, .y = 60 }, { .x = 15, .y = 13 }, { .x = 31, .y = 90 }, { .x = 74, .y = 65 }, { .x = 96, .y = 77 }, { .x = 15, .y = 22 }, { .x = 44, .y = 1 }, { .x = 16, .y = 23 }, { .x = 54, .y = 15 }, { .x = 88, .y = 72 }, { .x = 50, .y = 60 }, { .x = 24, .y = 47 }, { .x = 88, .y = 67 }, { .x = 47, .y = 65 }, { .x = 3, .y = 22 }, { .x = 22, .y = 25 }, { .x = 83, .y = 86 }, { .x = 63, .y = 87 }, { .x = 69, .y = 20 }, { .x = 70, .y = 71 }, { .x = 90, .y = 30 } };
+void call_26(void)
+{
+    sink(0xf10c, (363), a_tmp, 0xd53e <= 342, 421 / 268, rx, 0xc1f << 688, 133, glen[3], 263, acount, 0xc78c >> hlen[4], elen[9] < 119, 415 ? tx : r2[8], 0xc85 == k, w_tmp[0], k->nlen, yptr - qx[2], fptr ? klen : 438, 405 != c_tmp, (0xca6c), 117 << 0x724b, wlen ^ 556, plen[7] == 0xff89, 558, a_tmp->d, 0x8b92, 0xb5e9 ? 0xeed0 : 0x7f87, 201 & c2, n[4], 468, 0xf944 == ex[7], 0x21a9, ((char *) 62), ((int) 0x591a), ux[8] < f[0], 0x6ec1 ^ u_tmp[9], nlen->kptr, b2 * 628, r ? f_tmp : 474, 0xd3bd == 0xb97e, 0xea90 ? t[9] : 167, dx(b2[5], 794), c2, ((char *) blen[9]), 0x702d, mcount[2], (306), 626 * 0xf9b5, 0x35df <= 485, y2[0], & 0xb37b, r2(), aptr[5] & ax, 0xe5d7 ? bcount : nlen[9], 0xbd2f, 353 << 525, zptr ? gcount : 0xaa3f, 0x8d3f ^ e2[5], c2[2], k2[7], * 0xc2df, & pcount[1], hptr[8] != yptr[9], fx ? 471 : 287, 0x49bf, 264 ? 68 : 668, a_tmp[1] / 22, 6 / nptr[4], f_tmp->ecount, & 824, kptr >> qx[8], m + nlen[4], ((const short) cx), (q), 0xd37e ^ tx, 0x1249 * ax[1], 929, 0xf157 >> p2[2], 138, 0x51e7, 344, u_tmp(219), hptr < 0x6a9c, ((unsigned long) glen), 53 < 0x678e, 219 && x, (tcount[0]), 0xd492, 593, gptr ? n[2] : n_tmp, t2 ? v[8] : 0x300c, 586 ? ccount[2] : eptr[6], 0xfaf2 > alen, mptr[8] ? n : 0xfe3a, & 431, ((const short) ecount), dptr(), * t_tmp[5], wx ? 0x9fb : 0x86fc);
+}
+enum { B26_0, B26_1, B26_2, B26_3, B26_4, B26_5, B26_6, B26_7, B26_8, B26_9, B26_10, B26_11, B26_12, B26_13, B26_14, B26_15, B26_16, B26_17, B26_18, B26_19, B26_20, B26_21, B26_22, B26_23, B26_24, B26_25, B26_26, B26_27, B26_28, B26_29, B26_30, B26_31, B26_32, B26_33, B26_34, B26_35, B26_36, B26_37, B26_38, B26_39, B26_40, B26_41, B26_42, B26_43, B26_44, B26_45, B26_46, B26_47, B26_48, B26_49, B26_50, B26_51, B26_52, B26_53, B26_54, B26_55, B26_56, B26_57, B26_58, B26_59, B26_60, B26_61, B26_62, B26_63, B26_64, B26_65, B26_66, B26_67, B26_68, B26_69, B26_70, B26_71, B26_72, B26_73, B26_74, B26_75, B26_76, B26_77, B26_78, B26_79, B26_80, B26_81, B26_82, B26_83, B26_84, B26_85, B26_86, B26_87, B26_88, B26_89, B26_90, B26_91, B26_92, B26_93, B26_94, B26_95, B26_96, B26_97, B26_98, B26_99, B26_100, B26_101, B26_102, B26_103, B26_104, B26_105, B26_106, B26_107, B26_108, B26_109, B26_110, B26_111, B26_112, B26_113, B26_114, B26_115, B26_116, B26_117, B26_118, B26_119, B26_120, B26_121, B26_122, B26_123, B26_124, B26_125, B26_126, B26_127, B26_128, B26_129, B26_130, B26_131, B26_132, B26_133, B26_134, B26_135, B26_136, B26_137, B26_138, B26_139, B26_140, B26_141, B26_142, B26_143, B26_144, B26_145, B26_146, B26_147, B26_148, B26_149 } big_26;
+
+int init_27[] = { 2368, 4875, 8206, 8926, 6993, 9611, 5421, 720, 564, 9776, 2532, 1862, 2015, 145, 8201, 5981, 2362, 4989, 2549, 8440, 4473, 991, 3410, 1090, 5525, 4433, 4730, 4523, 2941, 8059, 1980, 8581, 2348, 8148, 1849, 7023, 2288, 3009, 1756, 8723, 1011, 6248, 9601, 2312, 4193, 5890, 316, 6888, 465, 6276, 2558, 4402, 4089, 6199, 1538, 5684, 7174, 6962, 2015, 4893, 3567, 1532, 5048, 9949, 3497, 2527, 2328, 3902, 2160, 6515, 9044, 6183, 8675, 9220, 9123, 3818, 2754, 9205, 9522, 9193, 3837, 6963, 9075, 2241, 8336, 5978, 2342, 3585, 4997, 3792, 548, 7365, 9879, 4029, 4040, 7378, 3226, 1896, 2607, 5576, 9506, 3030, 8930, 3791, 7628, 7032, 6592, 3476, 21, 2556, 1438, 3114, 6319, 5933, 2343, 6502, 9190, 1011, 5886, 5658, 4770, 7076, 8583, 1193, 5745, 6931, 6746, 8923, 7834, 5817, 1945, 9016, 6266, 6434, 9672, 6617, 157, 962, 9599, 6384, 5956, 4117, 1858, 689, 2347, 7684, 5129, 6709, 6432, 6357, 562, 8579, 3998, 1060, 9622, 8046, 2989, 3879, 1207, 4476, 8199, 5845, 3155, 6501, 7070, 9155, 8718, 3916, 4135, 9105, 4940, 8726, 197, 2150, 8734, 4572, 2960, 3442, 885, 7238, 9435, 1048, 632, 3262, 8199, 3208, 3410, 7410, 1756, 5472, 1026, 6139, 2091, 8133, 862, 2967, 8226, 8945, 7169, 973 };
+struct point pts_27[] = { { .x = 98, .y = 7 }, { .x = 47, .y = 52 }, { .x = 36, .y = 23 }, { .x = 22, .y = 69 }, { .x = 6, .y = 28 }, { .x = 93, .y = 53 }, { .x = 57, .y = 53 }, { .x = 58, .y = 31 }, { .x = 88, .y = 71 }, { .x = 26, .y = 75 }, { .x = 53, .y = 42 }, { .x = 76, .y = 29 }, { .x = 16, .y = 87 }, { .x = 15, .y = 2 }, { .x = 6, .y = 11 }, { .x = 55, .y = 44 }, { .x = 3, .y = 20 }, { .x = 65, .y = 6 }, { .x = 68, .y = 83 }, { .x = 74, .y = 19 }, { .x = 14, .y = 40 }, { .x = 44, .y = 61 }, { .x = 22, .y = 89 }, { .x = 54, .y = 99 }, { .x = 88, .y = 86 }, { .x = 18, .y = 13 }, { .x = 92, .y = 27 }, { .x = 5, .y = 9 }, { .x = 16, .y = 97 }, { .x = 54, .y = 36 }, { .x = 78, .y = 54 }, { .x = 66, .y = 2 }, { .x = 69, .y = 39 }, { .x = 56, .y = 37 }, { .x = 2, .y = 38 }, { .x = 41, .y = 4 }, { .x = 9, .y = 2 }, { .x = 53, .y = 14 }, { .x = 75, .y = 55 }, { .x = 5, .y = 46 } };
+void call_27(void)
+{
+    sink(tx[7] && e, 860 >= 206, qptr->fcount, 364, 0x8056, a[0] & 304, vcount[6] & dptr, vlen(), 927, 0x7e9a, 0x83e0 > 0x7f00, 722, rptr[8] || ycount[5], * yptr, (520), 588 / n2, gcount, y2, 0xbb76 << 0xbb33, 679 ? 800 : c_tmp, e->zlen, ~ eptr, ((const short) 0x7b1d), h2->xcount, aptr <= 0xba1e, (z[8]), ! 90, 0x6467, dlen & b_tmp, 780 + 284, sx == c2, tx(), ((int) 0x4c59), * flen[0], 488 ? h_tmp : 0xc6ca, 952, ~ 334, g2[0], hcount->nlen, ~ x[3], (w2), nptr > 0x7fef, s, w_tmp.a_tmp, 0x2ea0 & 206, s2[8], n, t, qlen ? 124 : ncount[6], 0xe848, 0xc9ea >= dlen, zx != 944, 0x4d4c + ex[3], v_tmp->rx, 541 ? mlen : d_tmp[1], (487), ((unsigned long) px[8]), ncount->zlen, ((const short) a2), cx[8], 862, - q_tmp, wptr, 0x84f2 || a_tmp, 611 | 0xc536, 367, f[4] ? 794 : 149, 430, g(), d[3], wlen(q_tmp[6]), 0xb26d, v[7], 363 * 85, mcount ? sptr[6] : ulen[5], dlen <= 0xd4a9, 598 ? z[8] : s[1], 0xf74, (0x4b85), qptr(316), d <= 396, kcount(418, elen[6], 150), u_tmp[8], bx ? x2[7] : 366, a_tmp | rlen, c2(285, 958, qptr[6]), n_tmp[0] ? 563 : 0x7b2, 341 << 0x88bc, (973), ! q[5], pcount && b2, yptr[2] * y2, tlen.pptr, (hcount[5]), 0xf519 || 0x4e38, hx[2], ucount ? 0x6550 : mcount[9], zx[3] << 0xdd32, qlen[1] == 0xc5dc, zlen[0]);
+}
+enum { B27_0, B27_1, B27_2, B27_3, B27_4, B27_5, B27_6, B27_7, B27_8, B27_9, B27_10, B27_11, B27_12, B27_13, B27_14, B27_15, B27_16, B27_17, B27_18, B27_19, B27_20, B27_21, B27_22, B27_23, B27_24, B27_25, B27_26, B27_27, B27_28, B27_29, B27_30, B27_31, B27_32, B27_33, B27_34, B27_35, B27_36, B27_37, B27_38, B27_39, B27_40, B27_41, B27_42, B27_43, B27_44, B27_45, B27_46, B27_47, B27_48, B27_49, B27_50, B27_51, B27_52, B27_53, B27_54, B27_55, B27_56, B27_57, B27_58, B27_59, B27_60, B27_61, B27_62, B27_63, B27_64, B27_65, B27_66, B27_67, B27_68, B27_69, B27_70, B27_71, B27_72, B27_73, B27_74, B27_75, B27_76, B27_77, B27_78, B27_79, B27_80, B27_81, B27_82, B27_83, B27_84, B27_85, B27_86, B27_87, B27_88, B27_89, B27_90, B27_91, B27_92, B27_93, B27_94, B27_95, B27_96, B27_97, B27_98, B27_99, B27_100, B27_101, B27_102, B27_103, B27_104, B27_105, B27_106, B27_107, B27_108, B27_109, B27_110, B27_111, B27_112, B27_113, B27_114, B27_115, B27_116, B27_117, B27_118, B27_119, B27_120, B27_121, B27_122, B27_123, B27_124, B27_125, B27_126, B27_127, B27_128, B27_129, B27_130, B27_131, B27_132, B27_133, B27_134, B27_135, B27_136, B27_137, B27_138, B27_139, B27_140, B27_141, B27_142, B27_143, B27_144, B27_145, B27_146, B27_147, B27_148, B27_149 } big_27;
+
+int init_28[] = { 9898, 2981, 3171, 4874, 108, 6606, 6884, 3251, 1283, 2013, 3214, 1308, 7982, 8028, 6872, 5909, 1149, 7016, 1630, 850, 2619, 1068, 5130, 9056, 6464, 8274, 5943, 6218, 4391, 6717, 7148, 8556, 5994, 7147, 2447, 9681, 5631, 8730, 6487, 6160, 4664, 8057, 6298, 9656, 6958, 8303, 5520, 3090, 572, 4518, 5379, 6180, 9529, 6176, 4085, 8079, 8495, 3641, 3418, 88, 737, 4098, 1142, 3143, 7095, 7602, 9803, 3366, 9135, 6194, 6965, 9406, 6377, 1776, 4254, 4046, 5212, 2954, 2258, 1725, 9502, 1174, 101, 3121, 5489, 4962, 9498, 873, 1141, 7530, 8405, 5305, 3283, 63, 8714, 357, 9292, 8437, 876, 103, 1171, 7948, 1970, 608, 1877, 2585, 6421, 3367, 1448, 7674, 4734, 6527, 8134, 7290, 4266, 5361, 110, 7885, 283, 1398, 9586, 8659, 7661, 7992, 826, 3287, 4737, 5814, 4339, 5083, 6669, 756, 9722, 7228, 8001, 4927, 8647, 5684, 7075, 3957, 5257, 4983, 5909, 8127, 1524, 9912, 7866, 5828, 2873, 5022, 509, 4725, 5575, 7522, 4297, 4050, 3858, 759, 5898, 1159, 3399, 9687, 2140, 8700, 9104, 2408, 1564, 4762, 7316, 8313, 5760, 9168, 8787, 7766, 6714, 8451, 9896, 6162, 2243, 4041, 7708, 6999, 2678, 7967, 4587, 90, 3457, 1562, 5593, 6315, 9873, 8529, 6132, 9031, 5379, 1258, 4277, 5417, 2514, 8446 };
+struct point pts_28[] = { { .x = 73, .y = 39 }, { .x = 92, .y = 28 }, { .x = 1, .y = 41 }, { .x = 76, .y = 88 }, { .x = 16, .y = 59 }, { .x = 64, .y = 24 }, { .x = 5, .y = 21 }, { .x = 15, .y = 61 }, { .x = 70, .y = 31 }, { .x = 38, .y = 65 }, { .x = 69, .y = 63 }, { .x = 90, .y = 8 }, { .x = 73, .y = 30 }, { .x = 15, .y = 1 }, { .x = 14, .y = 71 }, { .x = 21, .y = 90 }, { .x = 87, .y = 78 }, { .x = 16, .y = 60 }, { .x = 37, .y = 13 }, { .x = 40, .y = 29 }, { .x = 89, .y = 26 }, { .x = 62, .y = 4 }, { .x = 20, .y = 72 }, { .x = 21, .y = 58 }, { .x = 9, .y = 16 }, { .x = 61, .y = 11 }, { .x = 93, .y = 96 }, { .x = 68, .y = 22 }, { .x = 16, .y = 69 }, { .x = 28, .y = 75 }, { .x = 68, .y = 56 }, { .x = 39, .y = 90 }, { .x = 75, .y = 76 }, { .x = 94, .y = 85 }, { .x = 4, .y = 56 }, { .x = 53, .y = 68 }, { .x = 77, .y = 69 }, { .x = 75, .y = 55 }, { .x = 83, .y = 73 }, { .x = 82, .y = 27 } };
+void call_28(void)
+{
+    sink((elen), 938 ? 0xffcf : 0x5d05, a_tmp->y, hx[4] <= clen[0], 219, q2[9] % 350, vptr[6] ? e_tmp[5] : d, 0xef98, hptr ^ 0xa404, 514 ? d2 : 0xdddf, 0xe685 && b_tmp[1], (0x6ed9), ((unsigned long) t_tmp), bcount, 137 - 0x3fa5, 722 >> xlen[1], h_tmp == qptr, tx(e_tmp, cptr, kcount), xx ? 0x7c21 : 990, 151, 115 | 796, ! 609, ((int) 646), (gcount[3]), b_tmp[6] ? tptr : c_tmp, 482, 0xc26f != 716, 0xc13d, 0x8bc3 != 0xfb09, 0xa449, (u_tmp[3]), 0xfe10, ~ 0x6248, q2, 0x414e, ((const short) 0xdbda), 0x9a89 > 0x9122, r, ulen << 335, eptr[3] * 0x2089, & w_tmp, 0x472e && h, vlen[2], c2.g_tmp, c[4], 0x8bb6 ? 0xada9 : yx, & wlen[3], yx[4], p2[3], qptr, ulen[7] & 209, rcount[4] > ecount, ucount >= clen[4], 0x3d3 + 392, 800, 0x253e, * ncount[9], cx[0] << k_tmp, 426 & 0x8fab, x2, mlen[7] ? 0x7b49 : wcount, ((unsigned long) 0xc68), 897 * 0xcd3, s[2] > 0xaaf, ((int) 672), wx->x2, h2.yptr, 721 ? 347 : px[2], z2 - 0xd132, (ux[3]), kcount[6], ! 123, 0xc9ac ? 544 : nx, ux[5], 425, & ncount[6], ((char *) 451), cx[6], * c_tmp[8], 584, 61, aptr, 0x7e1c ? 0x83c8 : 611, v ? ycount[3] : 469, blen->plen, 0x5e2b, t2.qx, (116), z[6], ((const short) 0xa90), ccount->zlen, 0x82e0, 0x98d1, ucount.sptr, q2[5], (488), ux[9] <= 867, ~ f, 748 % 0xeb74, 0x96d);
+}
+enum { B28_0, B28_1, B28_2, B28_3, B28_4, B28_5, B28_6, B28_7, B28_8, B28_9, B28_10, B28_11, B28_12, B28_13, B28_14, B28_15, B28_16, B28_17, B28_18, B28_19, B28_20, B28_21, B28_22, B28_23, B28_24, B28_25, B28_26, B28_27, B28_28, B28_29, B28_30, B28_31, B28_32, B28_33, B28_34, B28_35, B28_36, B28_37, B28_38, B28_39, B28_40, B28_41, B28_42, B28_43, B28_44, B28_45, B28_46, B28_47, B28_48, B28_49, B28_50, B28_51, B28_52, B28_53, B28_54, B28_55, B28_56, B28_57, B28_58, B28_59, B28_60, B28_61, B28_62, B28_63, B28_64, B28_65, B28_66, B28_67, B28_68, B28_69, B28_70, B28_71, B28_72, B28_73, B28_74, B28_75, B28_76, B28_77, B28_78, B28_79, B28_80, B28_81, B28_82, B28_83, B28_84, B28_85, B28_86, B28_87, B28_88, B28_89, B28_90, B28_91, B28_92, B28_93, B28_94, B28_95, B28_96, B28_97, B28_98, B28_99, B28_100, B28_101, B28_102, B28_103, B28_104, B28_105, B28_106, B28_107, B28_108, B28_109, B28_110, B28_111, B28_112, B28_113, B28_114, B28_115, B28_116, B28_117, B28_118, B28_119, B28_120, B28_121, B28_122, B28_123, B28_124, B28_125, B28_126, B28_127, B28_128, B28_129, B28_130, B28_131, B28_132, B28_133, B28_134, B28_135, B28_136, B28_137, B28_138, B28_139, B28_140, B28_141, B28_142, B28_143, B28_144, B28_145, B28_146, B28_147, B28_148, B28_149 } big_28;
+
+int init_29[] = { 1146, 8204, 7467, 1321, 9844, 4688, 9871, 8137, 3319, 7652, 343, 3192, 828, 5831, 4579, 9329, 6184, 2418, 7062, 9744, 8554, 7706, 2731, 7872, 4158, 3913, 3629, 6903, 5078, 6867, 1333, 8084, 9172, 3036, 7607, 3086, 6397, 2227, 1268, 1665, 5508, 2470, 2366, 6029, 246, 1266, 3732, 3158, 356, 5560, 5282, 177, 2966, 4506, 7201, 5059, 3761, 7831, 1036, 8499, 6493, 725, 3707, 3448, 5041, 5891, 1862, 6096, 877, 1178, 5668, 7765, 4231, 5062, 9433, 7411, 6444, 5223, 8067, 2722, 1351, 1690, 6289, 2032, 1186, 425, 4416, 4461, 8729, 3739, 6178, 3521, 4901, 3797, 1754, 7107, 8466, 3321, 4383, 3774, 9789, 2072, 5324, 8931, 4885, 4894, 9317, 5304, 9184, 3359, 399, 1357, 3721, 3386, 8298, 3455, 8324, 2814, 3064, 5908, 9004, 8267, 21, 9398, 994, 6018, 438, 3497, 2185, 1920, 6128, 6898, 4338, 6301, 8746, 3175, 3454, 8195, 3142, 8394, 9616, 551, 7309, 9029, 734, 9462, 5273, 4029, 2751, 3354, 3793, 9097, 7662, 1231, 3364, 1996, 65, 5544, 221, 3799, 115, 1449, 3590, 1311, 813, 2467, 2360, 2222, 8078, 6019, 706, 1682, 2880, 5112, 5657, 1401, 277, 2395, 5310, 6787, 2184, 3125, 1033, 6056, 5690, 9337, 3748, 2054, 5990, 5099, 1852, 2637, 9034, 8383, 4678, 3481, 279, 126, 5979, 5236 };
+struct point pts_29[] = { { .x = 70, .y = 45 }, { .x = 54, .y = 92 }, { .x = 37, .y = 37 }, { .x = 33, .y = 33 }, { .x = 66, .y = 42 }, { .x = 61, .y = 25 }, { .x = 42, .y = 0 }, { .x = 34, .y = 55 }, { .x = 9, .y = 3 }, { .x = 47, .y = 87 }, { .x = 89, .y = 78 }, { .x = 72, .y = 31 }, { .x = 4, .y = 64 }, { .x = 81, .y = 93 }, { .x = 30, .y = 16 }, { .x = 79, .y = 14 }, { .x = 99, .y = 40 }, { .x = 2, .y = 83 }, { .x = 88, .y = 49 }, { .x = 8, .y = 84 }, { .x = 34, .y = 25 }, { .x = 23, .y = 83 }, { .x = 70, .y = 5 }, { .x = 65, .y = 54 }, { .x = 62, .y = 62 }, { .x = 53, .y = 77 }, { .x = 83, .y = 43 }, { .x = 30, .y = 55 }, { .x = 3, .y = 9 }, { .x = 53, .y = 43 }, { .x = 84, .y = 64 }, { .x = 42, .y = 76 }, { .x = 39, .y = 60 }, { .x = 27, .y = 26 }, { .x = 58, .y = 42 }, { .x = 16, .y = 24 }, { .x = 10, .y = 28 }, { .x = 79, .y = 31 }, { .x = 30, .y = 24 }, { .x = 5, .y = 86 } };
+void call_29(void)
+{
+    sink(x_tmp < 0xc848, ((const short) e2[2]), 0x944e ? hptr[0] : t_tmp, ((const short) 0xd9ec), y_tmp[9], * 0xbd60, 0x8d08, 0x5033 + qlen[0], 116 ? q_tmp : pcount, ((char *) hx[6]), cptr ? 0x3602 : 0x7ff9, 236 - d, (qlen[4]), 0xe750, y2[9] + 816, y_tmp->v2, dlen[1], dcount, q2.elen, 0x73a2 <= p2, 288, 0x392c ? 0xbc24 : 0x7fb2, 0x9b08 > elen, nx.g, & rptr, k2[5] ^ zlen[0], 236 << 736, y2(0xaa9d, 272), 0x193c, 27, n * 628, gcount->m_tmp, (ecount), nptr[6], * nptr[6], - sx[1], zcount->q2, h_tmp + 0x6fb3, 0 ? 0x9f27 : cx[7], 868, 0xca66 | n_tmp, 0x7df0, nptr - b, 729 % alen, 878, mptr[3], x2.fptr, u2 != t[5], ((const short) acount), ((int) 499), b, d2[8], gx > 796, 0x8ce9 < 0xe950, 513 / r[6], q2.elen, 0x640 < gptr, kptr[6], y + mx[5], 875, ((int) 826), a_tmp->d2, qcount.e, u_tmp[2] & bcount, m->u2, (0x75cc), 610 && z_tmp, (0xb4d), 94 | zcount, uptr[8] == 793, 0x7713, 0x6385, qlen->f2, 0x9a55 ? cptr[8] : 0xe934, a2[6], w2[3] >> tx[2], rlen <= k[3], tx >= r_tmp[5], z, c(213), 0x3832 | rlen, 569 | klen, yx(nx[9], flen, 0xb6db), 0xdf52, g_tmp->rx, 72 || 290, qptr == 979, hptr[9] & 174, 542 ? mcount[4] : 186, 0x6574 <= 0x5c08, fcount(649, 0xcba1), (h2), ((const short) fcount), t_tmp(195, 334, 450), ! b_tmp, ylen[7] & u_tmp[0], 0x266a, vptr.e, (101), 419 * r_tmp[5]);
+}
+enum { B29_0, B29_1, B29_2, B29_3, B29_4, B29_5, B29_6, B29_7, B29_8, B29_9, B29_10, B29_11, B29_12, B29_13, B29_14, B29_15, B29_16, B29_17, B29_18, B29_19, B29_20, B29_21, B29_22, B29_23, B29_24, B29_25, B29_26, B29_27, B29_28, B29_29, B29_30, B29_31, B29_32, B29_33, B29_34, B29_35, B29_36, B29_37, B29_38, B29_39, B29_40, B29_41, B29_42, B29_43, B29_44, B29_45, B29_46, B29_47, B29_48, B29_49, B29_50, B29_51, B29_52, B29_53, B29_54, B29_55, B29_56, B29_57, B29_58, B29_59, B29_60, B29_61, B29_62, B29_63, B29_64, B29_65, B29_66, B29_67, B29_68, B29_69, B29_70, B29_71, B29_72, B29_73, B29_74, B29_75, B29_76, B29_77, B29_78, B29_79, B29_80, B29_81, B29_82, B29_83, B29_84, B29_85, B29_86, B29_87, B29_88, B29_89, B29_90, B29_91, B29_92, B29_93, B29_94, B29_95, B29_96, B29_97, B29_98, B29_99, B29_100, B29_101, B29_102, B29_103, B29_104, B29_105, B29_106, B29_107, B29_108, B29_109, B29_110, B29_111, B29_112, B29_113, B29_114, B29_115, B29_116, B29_117, B29_118, B29_119, B29_120, B29_121, B29_122, B29_123, B29_124, B29_125, B29_126, B29_127, B29_128, B29_129, B29_130, B29_131, B29_132, B29_133, B29_134, B29_135, B29_136, B29_137, B29_138, B29_139, B29_140, B29_141, B29_142, B29_143, B29_144, B29_145, B29_146, B29_147, B29_148, B29_149 } big_29;
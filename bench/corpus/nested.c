@@ -0,0 +1,3142 @@
+void deep_0(void)
+{
+    if (wptr->y_tmp) {
+        while (a % 0xa8c8) {
+            while (rx[5] > c_tmp[5]) {
+                {
+                    while (gptr ? 118 : 67) {
+                        switch (a2) {
+                        case 1:
+                            fptr = z->gptr;
+                            break;
+                        }
+                    }
+                    hlen = 0x5b15 | 152;
+                }
+            }
+        }
+    } else {
+        {
+            if (0xa380) {
+                if ((qcount)) {
+                    switch (nptr) {
+                    case 1:
+                        {
+                            k2 = ucount;
+                            cx = x2->alen;
+                        }
+                        break;
+                    }
+                } else {
+                    for (i = 0; i < 22; i++) {
+                        if (v2) {
+                            xlen = 150 | 0x5054;
+                        } else {
+                            hlen = 0x2ab5 ? tptr[6] : 725;
+                        }
+                    }
+                }
+            } else {
+                if (nptr && 0x690e) {
+                    switch (rptr) {
+                    case 1:
+                        {
+                            ex = nlen(gx, elen[1]);
+                            h = 180;
+                        }
+                        break;
+                    }
+                } else {
+                    for (i = 0; i < 61; i++) {
+                        for (i = 0; i < 25; i++) {
+                            wcount = (0xbc36);
+                        }
+                    }
+                }
+            }
+            ylen = rx;
+        }
+    }
+}
+
+int paren_0 = ((((((((((0))))))))));
+
+void deep_1(void)
+{
+    for (i = 0; i < 45; i++) {
+        {
+            for (i = 0; i < 94; i++) {
+                for (i = 0; i < 9; i++) {
+                    if (20 ? 0xc837 : t_tmp) {
+                        if (nptr - 0x12e1) {
+                            switch (eptr) {
+                            case 1:
+                                y2 = 590 ? 0xa923 : 0x59fe;
+                                break;
+                            }
+                        } else {
+                            for (i = 0; i < 69; i++) {
+                                vptr = * h_tmp[0];
+                            }
+                        }
+                    } else {
+                        {
+                            switch (pcount) {
+                            case 1:
+                                vlen = wcount[5];
+                                break;
+                            }
+                            d_tmp = ((int) t_tmp[8]);
+                        }
+                    }
+                }
+            }
+            bx = ((unsigned long) 594);
+        }
+    }
+}
+
+int paren_1 = (((((((((((1)))))))))));
+
+void deep_2(void)
+{
+    for (i = 0; i < 21; i++) {
+        {
+            if (* 740) {
+                for (i = 0; i < 42; i++) {
+                    if (e2[7]) {
+                        while (ucount >= fptr[7]) {
+                            switch (bptr) {
+                            case 1:
+                                while (((const short) m)) {
+                                    q = 0x3e8b <= 421;
+                                }
+                                break;
+                            }
+                        }
+                    } else {
+                        while (! q2) {
+                            switch (mx) {
+                            case 1:
+                                while ((d)) {
+                                    ycount = s2.u2;
+                                }
+                                break;
+                            }
+                        }
+                    }
+                }
+            } else {
+                while (xlen | c[8]) {
+                    switch (tx) {
+                    case 1:
+                        for (i = 0; i < 92; i++) {
+                            if (g ? 41 : 265) {
+                                {
+                                    ylen = rlen(258);
+                                    eptr = 0x288f;
+                                }
+                            } else {
+                                switch (e) {
+                                case 1:
+                                    g2 = d2;
+                                    break;
+                                }
+                            }
+                        }
+                        break;
+                    }
+                }
+            }
+            gx = 0x13d8 >= 0x18d4;
+        }
+    }
+}
+
+int paren_2 = ((((((((((((2))))))))))));
+
+void deep_3(void)
+{
+    {
+        for (i = 0; i < 4; i++) {
+            switch (qlen) {
+            case 1:
+                if (253 >= t) {
+                    switch (zcount) {
+                    case 1:
+                        if (0xc5aa < kx[4]) {
+                            while (403 < 0xc19a) {
+                                while (cx(316, zptr)) {
+                                    {
+                                        elen = 334 >> q_tmp;
+                                        q = 0xc09e;
+                                    }
+                                }
+                            }
+                        } else {
+                            for (i = 0; i < 61; i++) {
+                                while (608 + nptr) {
+                                    while (n2[1]) {
+                                        alen = n.v;
+                                    }
+                                }
+                            }
+                        }
+                        break;
+                    }
+                } else {
+                    while (& 483) {
+                        for (i = 0; i < 56; i++) {
+                            if (scount[7]) {
+                                switch (xcount) {
+                                case 1:
+                                    {
+                                        r2 = ((char *) 0xc85a);
+                                        scount = 726;
+                                    }
+                                    break;
+                                }
+                            } else {
+                                while (938 / r2[0]) {
+                                    {
+                                        h2 = h_tmp;
+                                        pptr = 352 ^ n;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+                break;
+            }
+        }
+        aptr = v_tmp.q2;
+    }
+}
+
+int paren_3 = (((((((((((((3)))))))))))));
+
+void deep_4(void)
+{
+    if (0x5884 % ycount[6]) {
+        for (i = 0; i < 99; i++) {
+            for (i = 0; i < 24; i++) {
+                switch (qx) {
+                case 1:
+                    switch (d) {
+                    case 1:
+                        switch (xcount) {
+                        case 1:
+                            {
+                                for (i = 0; i < 20; i++) {
+                                    while (0x4e76) {
+                                        for (i = 0; i < 79; i++) {
+                                            h2 = k2[9];
+                                        }
+                                    }
+                                }
+                                z = hcount();
+                            }
+                            break;
+                        }
+                        break;
+                    }
+                    break;
+                }
+            }
+        }
+    } else {
+        if (px[7]) {
+            while (((const short) 0x8075)) {
+                while (hlen < 0x28ee) {
+                    while (0xb364 | 509) {
+                        for (i = 0; i < 64; i++) {
+                            {
+                                {
+                                    {
+                                        if ((kx[2])) {
+                                            t2 = eptr[8] - mcount[5];
+                                        } else {
+                                            cx = w && 264;
+                                        }
+                                        mlen = ((unsigned long) 778);
+                                    }
+                                    vx = 642 < 590;
+                                }
+                                c = rptr[0] <= v_tmp[0];
+                            }
+                        }
+                    }
+                }
+            }
+        } else {
+            while (hx[4]) {
+                for (i = 0; i < 33; i++) {
+                    while (mx) {
+                        switch (g2) {
+                        case 1:
+                            if (0x2974 ? ecount[4] : f2) {
+                                if (0x44df * 597) {
+                                    {
+                                        switch (gptr) {
+                                        case 1:
+                                            m = 932;
+                                            break;
+                                        }
+                                        kcount = 0x7646;
+                                    }
+                                } else {
+                                    {
+                                        for (i = 0; i < 83; i++) {
+                                            ax = aptr & 238;
+                                        }
+                                        h = k.e_tmp;
+                                    }
+                                }
+                            } else {
+                                {
+                                    switch (c_tmp) {
+                                    case 1:
+                                        while (slen->r_tmp) {
+                                            t = 403 << 16;
+                                        }
+                                        break;
+                                    }
+                                    t_tmp = wx[7];
+                                }
+                            }
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+int paren_4 = ((((((((((((((4))))))))))))));
+
+void deep_5(void)
+{
+    {
+        while (m[7] ? wlen : clen) {
+            if (p2[4] << flen) {
+                while (hcount(128, bx[7], 628)) {
+                    {
+                        if (0xf0ab > zptr) {
+                            {
+                                for (i = 0; i < 42; i++) {
+                                    if (995) {
+                                        for (i = 0; i < 83; i++) {
+                                            {
+                                                flen = cptr ? y : 0x783;
+                                                r2 = 141 != 262;
+                                            }
+                                        }
+                                    } else {
+                                        {
+                                            {
+                                                k_tmp = q2[9];
+                                                n = & 0x1794;
+                                            }
+                                            hcount = ((unsigned long) 0x9e43);
+                                        }
+                                    }
+                                }
+                                tcount = ~ ccount[6];
+                            }
+                        } else {
+                            while (0x42f8 / zptr) {
+                                switch (nptr) {
+                                case 1:
+                                    switch (v2) {
+                                    case 1:
+                                        {
+                                            if (((unsigned long) blen[9])) {
+                                                u = k_tmp;
+                                            } else {
+                                                k_tmp = sptr[4];
+                                            }
+                                            f = k2[9];
+                                        }
+                                        break;
+                                    }
+                                    break;
+                                }
+                            }
+                        }
+                        c2 = ((char *) 110);
+                    }
+                }
+            } else {
+                switch (t2) {
+                case 1:
+                    if (0x8d45 != 821) {
+                        {
+                            switch (c2) {
+                            case 1:
+                                while (g2 == 807) {
+                                    {
+                                        switch (d) {
+                                        case 1:
+                                            switch (blen) {
+                                            case 1:
+                                                q2 = 0x30d9 ? 0x519c : 0x1e0d;
+                                                break;
+                                            }
+                                            break;
+                                        }
+                                        zlen = y | 992;
+                                    }
+                                }
+                                break;
+                            }
+                            hcount = uptr;
+                        }
+                    } else {
+                        for (i = 0; i < 45; i++) {
+                            if (ecount.tlen) {
+                                switch (sx) {
+                                case 1:
+                                    if (537 & 241) {
+                                        while (bptr(e2[0])) {
+                                            if (0x39fc / 0x71a4) {
+                                                n = 0xc916;
+                                            } else {
+                                                qptr = b2 ? 0x4679 : 0x237d;
+                                            }
+                                        }
+                                    } else {
+                                        for (i = 0; i < 38; i++) {
+                                            if (118 ? 0xe219 : h_tmp[9]) {
+                                                fptr = 0xb3ed;
+                                            } else {
+                                                cptr = (k);
+                                            }
+                                        }
+                                    }
+                                    break;
+                                }
+                            } else {
+                                switch (kcount) {
+                                case 1:
+                                    if (h_tmp[2] % 485) {
+                                        for (i = 0; i < 50; i++) {
+                                            if (ucount[3] + 0x83b0) {
+                                                z = 0xcfb1 == hcount;
+                                            } else {
+                                                elen = h->v_tmp;
+                                            }
+                                        }
+                                    } else {
+                                        if (- 912) {
+                                            for (i = 0; i < 41; i++) {
+                                                u2 = a2;
+                                            }
+                                        } else {
+                                            while (0xba80 ? 0xc8f2 : 122) {
+                                                dx = b ? fx[0] : 221;
+                                            }
+                                        }
+                                    }
+                                    break;
+                                }
+                            }
+                        }
+                    }
+                    break;
+                }
+            }
+        }
+        wx = 769 ^ nptr;
+    }
+}
+
+int paren_5 = (((((((((((((((5)))))))))))))));
+
+void deep_6(void)
+{
+    for (i = 0; i < 96; i++) {
+        switch (mx) {
+        case 1:
+            switch (y2) {
+            case 1:
+                while (0xb024 | vx[9]) {
+                    while (mptr[2]) {
+                        while (& w2) {
+                            switch (z2) {
+                            case 1:
+                                {
+                                    {
+                                        switch (qx) {
+                                        case 1:
+                                            if (f[8] ? 832 : 0x6224) {
+                                                if (0xe15 - elen[2]) {
+                                                    gx = ecount - 0x2da;
+                                                } else {
+                                                    ux = a2[1] ? 101 : 606;
+                                                }
+                                            } else {
+                                                if (((int) 737)) {
+                                                    bcount = ulen->eptr;
+                                                } else {
+                                                    bptr = x(0xbc8b, cptr, 0x9ca);
+                                                }
+                                            }
+                                            break;
+                                        }
+                                        rlen = (ylen[0]);
+                                    }
+                                    dptr = (348);
+                                }
+                                break;
+                            }
+                        }
+                    }
+                }
+                break;
+            }
+            break;
+        }
+    }
+}
+
+int paren_6 = ((((((((((((((((6))))))))))))))));
+
+void deep_7(void)
+{
+    while ((708)) {
+        {
+            while (((int) k_tmp[2])) {
+                while (mcount) {
+                    while (v(0x888a)) {
+                        {
+                            {
+                                switch (u) {
+                                case 1:
+                                    for (i = 0; i < 62; i++) {
+                                        for (i = 0; i < 74; i++) {
+                                            if ((f_tmp[8])) {
+                                                if (* zlen) {
+                                                    if (q_tmp[1] >= a_tmp[5]) {
+                                                        h_tmp = ycount[7] || n2;
+                                                    } else {
+                                                        wcount = b;
+                                                    }
+                                                } else {
+                                                    while (0x1f87 <= rlen) {
+                                                        h = alen < 145;
+                                                    }
+                                                }
+                                            } else {
+                                                for (i = 0; i < 65; i++) {
+                                                    while (! 29) {
+                                                        z = ucount[5];
+                                                    }
+                                                }
+                                            }
+                                        }
+                                    }
+                                    break;
+                                }
+                                wx = & qlen[8];
+                            }
+                            dcount = ycount->w2;
+                        }
+                    }
+                }
+            }
+            ulen = ~ w_tmp;
+        }
+    }
+}
+
+int paren_7 = (((((((((((((((((7)))))))))))))))));
+
+void deep_8(void)
+{
+    if (y[0] <= 0xd3da) {
+        for (i = 0; i < 74; i++) {
+            switch (zlen) {
+            case 1:
+                if (0x8ee5 * p_tmp) {
+                    for (i = 0; i < 66; i++) {
+                        for (i = 0; i < 98; i++) {
+                            c = ~ bcount[0];
+                        }
+                    }
+                } else {
+                    switch (flen) {
+                    case 1:
+                        {
+                            n = 150 ^ 655;
+                            eptr = gptr.tx;
+                        }
+                        break;
+                    }
+                }
+                break;
+            }
+        }
+    } else {
+        if (513 >= elen) {
+            if (ulen.mptr) {
+                for (i = 0; i < 74; i++) {
+                    for (i = 0; i < 47; i++) {
+                        switch (gcount) {
+                        case 1:
+                            mptr = uptr[9];
+                            break;
+                        }
+                    }
+                }
+            } else {
+                while ((952)) {
+                    for (i = 0; i < 26; i++) {
+                        for (i = 0; i < 42; i++) {
+                            s_tmp = (673);
+                        }
+                    }
+                }
+            }
+        } else {
+            while (rx >> acount) {
+                switch (e2) {
+                case 1:
+                    if (0xe2e7 < 293) {
+                        while (klen) {
+                            g = (0x67b5);
+                        }
+                    } else {
+                        switch (yx) {
+                        case 1:
+                            fcount = 0x3f3 | 0xa729;
+                            break;
+                        }
+                    }
+                    break;
+                }
+            }
+        }
+    }
+}
+
+int paren_8 = ((((((((((((((((((8))))))))))))))))));
+
+void deep_9(void)
+{
+    for (i = 0; i < 19; i++) {
+        {
+            for (i = 0; i < 88; i++) {
+                switch (u) {
+                case 1:
+                    if (m_tmp()) {
+                        while (5 == 730) {
+                            if (~ 738) {
+                                x2 = 0xfd44;
+                            } else {
+                                qcount = 0xef91 << r;
+                            }
+                        }
+                    } else {
+                        if (kx[0] & h_tmp) {
+                            {
+                                zptr = h_tmp.kcount;
+                                fcount = - 0xdff8;
+                            }
+                        } else {
+                            if (0x134b << fx[2]) {
+                                p_tmp = ((unsigned long) 820);
+                            } else {
+                                x_tmp = 104 * bx;
+                            }
+                        }
+                    }
+                    break;
+                }
+            }
+            mcount = zlen;
+        }
+    }
+}
+
+int paren_9 = (((((((((((((((((((9)))))))))))))))))));
+
+void deep_10(void)
+{
+    while (0xce91 % 172) {
+        for (i = 0; i < 26; i++) {
+            switch (b) {
+            case 1:
+                if (~ q_tmp) {
+                    switch (ccount) {
+                    case 1:
+                        for (i = 0; i < 33; i++) {
+                            if (wptr(q2[3], vlen[4])) {
+                                switch (qx) {
+                                case 1:
+                                    mlen = elen <= 0x70be;
+                                    break;
+                                }
+                            } else {
+                                switch (rptr) {
+                                case 1:
+                                    x = 919;
+                                    break;
+                                }
+                            }
+                        }
+                        break;
+                    }
+                } else {
+                    switch (h) {
+                    case 1:
+                        for (i = 0; i < 60; i++) {
+                            for (i = 0; i < 11; i++) {
+                                {
+                                    tptr = ((const short) 662);
+                                    hlen = (q_tmp[9]);
+                                }
+                            }
+                        }
+                        break;
+                    }
+                }
+                break;
+            }
+        }
+    }
+}
+
+int paren_10 = ((((((((((((((((((((10))))))))))))))))))));
+
+void deep_11(void)
+{
+    while (0x6adc - 0x1dbc) {
+        while (& 809) {
+            if (124 ? mx[1] : 404) {
+                if (((char *) 395)) {
+                    while (wlen[7] == bx) {
+                        if (- 76) {
+                            {
+                                while (~ 0xe5e1) {
+                                    while (802 && 0xf31f) {
+                                        a = zcount[8];
+                                    }
+                                }
+                                xptr = 0xa9c0 ^ plen;
+                            }
+                        } else {
+                            if (311 == 935) {
+                                while (357 % f2) {
+                                    while (0xd124 * mcount[4]) {
+                                        u2 = pcount[8] && 557;
+                                    }
+                                }
+                            } else {
+                                for (i = 0; i < 70; i++) {
+                                    for (i = 0; i < 71; i++) {
+                                        xptr = 0xa2da == q2[9];
+                                    }
+                                }
+                            }
+                        }
+                    }
+                } else {
+                    {
+                        if (s2->tlen) {
+                            switch (aptr) {
+                            case 1:
+                                while (b(n2, g_tmp)) {
+                                    while (zptr <= plen[5]) {
+                                        x2 = ! 513;
+                                    }
+                                }
+                                break;
+                            }
+                        } else {
+                            for (i = 0; i < 47; i++) {
+                                {
+                                    {
+                                        kptr = 117 != 218;
+                                        d = (tptr);
+                                    }
+                                    wcount = fx[4] % dx[6];
+                                }
+                            }
+                        }
+                        r = 757 == 51;
+                    }
+                }
+            } else {
+                {
+                    {
+                        {
+                            {
+                                if (w_tmp[7] << 643) {
+                                    for (i = 0; i < 53; i++) {
+                                        wx = p2;
+                                    }
+                                } else {
+                                    for (i = 0; i < 30; i++) {
+                                        ncount = d;
+                                    }
+                                }
+                                ucount = 127;
+                            }
+                            tcount = & scount;
+                        }
+                        fcount = (xptr[1]);
+                    }
+                    ccount = b_tmp ? k[5] : 0x4cf2;
+                }
+            }
+        }
+    }
+}
+
+int paren_11 = (((((((((((((((((((((11)))))))))))))))))))));
+
+void deep_12(void)
+{
+    switch (qcount) {
+    case 1:
+        if (((char *) 0xa86f)) {
+            for (i = 0; i < 4; i++) {
+                if (((int) 0xeaa1)) {
+                    if (* ylen[5]) {
+                        while (h->bcount) {
+                            for (i = 0; i < 10; i++) {
+                                for (i = 0; i < 43; i++) {
+                                    if (h_tmp) {
+                                        for (i = 0; i < 35; i++) {
+                                            s2 = ((unsigned long) 709);
+                                        }
+                                    } else {
+                                        for (i = 0; i < 82; i++) {
+                                            c2 = ~ 33;
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    } else {
+                        if (76) {
+                            for (i = 0; i < 49; i++) {
+                                {
+                                    for (i = 0; i < 1; i++) {
+                                        while (0x28a8 / gcount[0]) {
+                                            e2 = 0xe109 - 0x6429;
+                                        }
+                                    }
+                                    d_tmp = dlen;
+                                }
+                            }
+                        } else {
+                            for (i = 0; i < 2; i++) {
+                                for (i = 0; i < 59; i++) {
+                                    while (t2[1] < 725) {
+                                        while (84) {
+                                            d_tmp = hx.ylen;
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    }
+                } else {
+                    if (p_tmp && s) {
+                        {
+                            if ((0x2d9f)) {
+                                switch (xlen) {
+                                case 1:
+                                    switch (zcount) {
+                                    case 1:
+                                        switch (q2) {
+                                        case 1:
+                                            cx = w_tmp[4];
+                                            break;
+                                        }
+                                        break;
+                                    }
+                                    break;
+                                }
+                            } else {
+                                switch (px) {
+                                case 1:
+                                    switch (vcount) {
+                                    case 1:
+                                        for (i = 0; i < 90; i++) {
+                                            gptr = wlen;
+                                        }
+                                        break;
+                                    }
+                                    break;
+                                }
+                            }
+                            glen = 0xe712;
+                        }
+                    } else {
+                        if (0x13b1 & g) {
+                            if (346) {
+                                {
+                                    for (i = 0; i < 56; i++) {
+                                        switch (c2) {
+                                        case 1:
+                                            wlen = gptr[5] && d[5];
+                                            break;
+                                        }
+                                    }
+                                    p2 = 478;
+                                }
+                            } else {
+                                if (dcount[2] ? 0x4d7 : h) {
+                                    if (a2 * a_tmp) {
+                                        while (wx(3, 478, 599)) {
+                                            r = uptr->rcount;
+                                        }
+                                    } else {
+                                        if (s2[7] <= zptr[6]) {
+                                            zx = 0x257f ? qlen : 0xae4c;
+                                        } else {
+                                            ncount = & x2;
+                                        }
+                                    }
+                                } else {
+                                    {
+                                        for (i = 0; i < 99; i++) {
+                                            f2 = xlen[2] << w;
+                                        }
+                                        mcount = 0xf7a1 + nptr[6];
+                                    }
+                                }
+                            }
+                        } else {
+                            switch (wcount) {
+                            case 1:
+                                for (i = 0; i < 76; i++) {
+                                    {
+                                        if (mx(893, hptr)) {
+                                            xlen = 331;
+                                        } else {
+                                            dlen = 0x8182 << 48;
+                                        }
+                                        wcount = s[2];
+                                    }
+                                }
+                                break;
+                            }
+                        }
+                    }
+                }
+            }
+        } else {
+            switch (q2) {
+            case 1:
+                {
+                    switch (w2) {
+                    case 1:
+                        while (h[8] < 471) {
+                            if (- 21) {
+                                {
+                                    if (((unsigned long) x2[8])) {
+                                        {
+                                            dx = zptr(39, 0x9b07, 287);
+                                            glen = 0x3114 <= m[7];
+                                        }
+                                    } else {
+                                        for (i = 0; i < 59; i++) {
+                                            ex = - k2;
+                                        }
+                                    }
+                                    s = ((char *) 0xce94);
+                                }
+                            } else {
+                                switch (x2) {
+                                case 1:
+                                    switch (wx) {
+                                    case 1:
+                                        switch (c2) {
+                                        case 1:
+                                            gx = (938);
+                                            break;
+                                        }
+                                        break;
+                                    }
+                                    break;
+                                }
+                            }
+                        }
+                        break;
+                    }
+                    bptr = ! qcount[1];
+                }
+                break;
+            }
+        }
+        break;
+    }
+}
+
+int paren_12 = ((((((((((((((((((((((12))))))))))))))))))))));
+
+void deep_13(void)
+{
+    while (0x2c16 & 0xa625) {
+        while (y2.zx) {
+            if (h_tmp ? 72 : rx[5]) {
+                while (uptr.ylen) {
+                    while (hlen[2]) {
+                        while (q_tmp[8]) {
+                            {
+                                if (fx[1]) {
+                                    for (i = 0; i < 58; i++) {
+                                        while (643 <= 768) {
+                                            {
+                                                c = 341 ^ 843;
+                                                k_tmp = (tcount[1]);
+                                            }
+                                        }
+                                    }
+                                } else {
+                                    switch (p) {
+                                    case 1:
+                                        for (i = 0; i < 36; i++) {
+                                            for (i = 0; i < 10; i++) {
+                                                gptr = a_tmp.n_tmp;
+                                            }
+                                        }
+                                        break;
+                                    }
+                                }
+                                t2 = u_tmp;
+                            }
+                        }
+                    }
+                }
+            } else {
+                while (0x144 / 219) {
+                    for (i = 0; i < 82; i++) {
+                        while (c_tmp[6]) {
+                            for (i = 0; i < 23; i++) {
+                                switch (k) {
+                                case 1:
+                                    {
+                                        switch (b_tmp) {
+                                        case 1:
+                                            for (i = 0; i < 92; i++) {
+                                                mcount = 0x18cf;
+                                            }
+                                            break;
+                                        }
+                                        px = hcount(0x8791);
+                                    }
+                                    break;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+int paren_13 = (((((((((((((((((((((((13)))))))))))))))))))))));
+
+void deep_14(void)
+{
+    while (0x7bb0 ? ncount[6] : 465) {
+        {
+            switch (r) {
+            case 1:
+                if (qptr / 816) {
+                    switch (t) {
+                    case 1:
+                        for (i = 0; i < 12; i++) {
+                            if (304 <= zlen[3]) {
+                                for (i = 0; i < 57; i++) {
+                                    switch (nx) {
+                                    case 1:
+                                        while (gx(0x5171, 0x4f29)) {
+                                            {
+                                                if (351 - t2[5]) {
+                                                    c2 = x2[6];
+                                                } else {
+                                                    d2 = ((unsigned long) d_tmp[2]);
+                                                }
+                                                g_tmp = 0x2c95 || 0x1ad3;
+                                            }
+                                        }
+                                        break;
+                                    }
+                                }
+                            } else {
+                                if (qcount(592, bx[6], blen)) {
+                                    while (((char *) 122)) {
+                                        if (* 0x625e) {
+                                            for (i = 0; i < 61; i++) {
+                                                {
+                                                    z = dlen;
+                                                    z = 0x182c | 0x445e;
+                                                }
+                                            }
+                                        } else {
+                                            while (0x56f0 << u_tmp[2]) {
+                                                {
+                                                    f2 = 694 != nptr[2];
+                                                    a = v_tmp[0];
+                                                }
+                                            }
+                                        }
+                                    }
+                                } else {
+                                    while (110 / 0x385d) {
+                                        for (i = 0; i < 74; i++) {
+                                            {
+                                                for (i = 0; i < 81; i++) {
+                                                    g2 = d_tmp(692);
+                                                }
+                                                v2 = acount->r_tmp;
+                                            }
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                        break;
+                    }
+                } else {
+                    {
+                        for (i = 0; i < 33; i++) {
+                            for (i = 0; i < 24; i++) {
+                                if (* hcount[4]) {
+                                    switch (nptr) {
+                                    case 1:
+                                        switch (p_tmp) {
+                                        case 1:
+                                            for (i = 0; i < 14; i++) {
+                                                while (h2(0x3918, 0xd8a5, mptr)) {
+                                                    zx = acount;
+                                                }
+                                            }
+                                            break;
+                                        }
+                                        break;
+                                    }
+                                } else {
+                                    {
+                                        {
+                                            while (d[7]) {
+                                                if (blen(qx, acount)) {
+                                                    qlen = wptr();
+                                                } else {
+                                                    wlen = ((int) 0x1b4c);
+                                                }
+                                            }
+                                            xptr = zx % clen;
+                                        }
+                                        t = p();
+                                    }
+                                }
+                            }
+                        }
+                        kptr = 0x887d;
+                    }
+                }
+                break;
+            }
+            t = & 0xd76e;
+        }
+    }
+}
+
+int paren_14 = ((((((((((((((((((((((((14))))))))))))))))))))))));
+
+void deep_15(void)
+{
+    switch (ex) {
+    case 1:
+        switch (x_tmp) {
+        case 1:
+            if (c2->b2) {
+                {
+                    while (e_tmp) {
+                        {
+                            while (0xc490 + tlen[7]) {
+                                switch (y_tmp) {
+                                case 1:
+                                    while (zcount || qlen) {
+                                        switch (vx) {
+                                        case 1:
+                                            while (ncount[2] & 413) {
+                                                if (0xc29b >> wcount) {
+                                                    if (q->b) {
+                                                        g_tmp = 0xe23d;
+                                                    } else {
+                                                        cx = xptr > 0x5746;
+                                                    }
+                                                } else {
+                                                    switch (h_tmp) {
+                                                    case 1:
+                                                        f_tmp = 0x12a2;
+                                                        break;
+                                                    }
+                                                }
+                                            }
+                                            break;
+                                        }
+                                    }
+                                    break;
+                                }
+                            }
+                            gptr = k_tmp - 0xc4da;
+                        }
+                    }
+                    s_tmp = hlen;
+                }
+            } else {
+                switch (px) {
+                case 1:
+                    if (0xc90d) {
+                        while (elen) {
+                            for (i = 0; i < 15; i++) {
+                                switch (k) {
+                                case 1:
+                                    while (0xbd2f ? rcount : b) {
+                                        while (y) {
+                                            {
+                                                while (xx || hptr) {
+                                                    if (e2[3] ? a[2] : c_tmp[0]) {
+                                                        gcount = 0x98f6 && px;
+                                                    } else {
+                                                        zcount = (0xca4a);
+                                                    }
+                                                }
+                                                x2 = 220;
+                                            }
+                                        }
+                                    }
+                                    break;
+                                }
+                            }
+                        }
+                    } else {
+                        while (tcount(0x7d7a, mx, x[8])) {
+                            {
+                                for (i = 0; i < 48; i++) {
+                                    while (0xb5e8 & mptr) {
+                                        for (i = 0; i < 48; i++) {
+                                            {
+                                                for (i = 0; i < 78; i++) {
+                                                    while (plen ? 174 : fx[9]) {
+                                                        vptr = blen;
+                                                    }
+                                                }
+                                                g2 = 853 ? 0xc666 : clen[9];
+                                            }
+                                        }
+                                    }
+                                }
+                                a2 = bx->a;
+                            }
+                        }
+                    }
+                    break;
+                }
+            }
+            break;
+        }
+        break;
+    }
+}
+
+int paren_15 = (((((((((((((((((((((((((15)))))))))))))))))))))))));
+
+void deep_16(void)
+{
+    while (rlen.mlen) {
+        for (i = 0; i < 46; i++) {
+            while (871 << sx) {
+                while (174) {
+                    {
+                        if (zptr ? r2 : t_tmp[1]) {
+                            ex = hlen ? cptr[2] : 582;
+                        } else {
+                            xcount = & 0xdd6b;
+                        }
+                        d2 = cx[9] ^ zlen[7];
+                    }
+                }
+            }
+        }
+    }
+}
+
+int paren_16 = ((((((((((((((((((((((((((16))))))))))))))))))))))))));
+
+void deep_17(void)
+{
+    {
+        for (i = 0; i < 77; i++) {
+            for (i = 0; i < 61; i++) {
+                for (i = 0; i < 76; i++) {
+                    {
+                        switch (pcount) {
+                        case 1:
+                            while ((gcount[7])) {
+                                ax = z2 ? 0xad9f : 840;
+                            }
+                            break;
+                        }
+                        cptr = (0xb85c);
+                    }
+                }
+            }
+        }
+        dx = ((int) hptr);
+    }
+}
+
+int paren_17 = (((((((((((((((((((((((((((17)))))))))))))))))))))))))));
+
+void deep_18(void)
+{
+    for (i = 0; i < 18; i++) {
+        while (! 823) {
+            if (0xdae) {
+                while (v_tmp ? p_tmp : u2[1]) {
+                    for (i = 0; i < 27; i++) {
+                        while ((38)) {
+                            for (i = 0; i < 61; i++) {
+                                while (453 & t2[7]) {
+                                    nx = g_tmp * 44;
+                                }
+                            }
+                        }
+                    }
+                }
+            } else {
+                if (a2 << rptr[9]) {
+                    {
+                        {
+                            {
+                                if (f2[3] / qlen[7]) {
+                                    ucount = 0xe0a3;
+                                } else {
+                                    c_tmp = b2[9];
+                                }
+                                gptr = 637 + slen;
+                            }
+                            mx = vptr[5] | 912;
+                        }
+                        cptr = m2 | 15;
+                    }
+                } else {
+                    {
+                        for (i = 0; i < 67; i++) {
+                            for (i = 0; i < 6; i++) {
+                                switch (y) {
+                                case 1:
+                                    b = 0x5e2e << 78;
+                                    break;
+                                }
+                            }
+                        }
+                        f = 562 && 0x9098;
+                    }
+                }
+            }
+        }
+    }
+}
+
+int paren_18 = ((((((((((((((((((((((((((((18))))))))))))))))))))))))))));
+
+void deep_19(void)
+{
+    for (i = 0; i < 22; i++) {
+        for (i = 0; i < 42; i++) {
+            while (p2 % qx[9]) {
+                for (i = 0; i < 78; i++) {
+                    switch (xcount) {
+                    case 1:
+                        {
+                            switch (wptr) {
+                            case 1:
+                                {
+                                    for (i = 0; i < 8; i++) {
+                                        flen = 0x8da1;
+                                    }
+                                    qlen = 0xb6d8 <= 0x2b1f;
+                                }
+                                break;
+                            }
+                            v_tmp = ((const short) p[4]);
+                        }
+                        break;
+                    }
+                }
+            }
+        }
+    }
+}
+
+int paren_19 = (((((((((((((((((((((((((((((19)))))))))))))))))))))))))))));
+
+void deep_20(void)
+{
+    for (i = 0; i < 50; i++) {
+        while (0x510c) {
+            while (wlen) {
+                if (d2 <= sptr[7]) {
+                    while (yptr(tlen[3], yx, 0x3735)) {
+                        {
+                            switch (pptr) {
+                            case 1:
+                                switch (c2) {
+                                case 1:
+                                    while (0x9be - 474) {
+                                        if (q ? bptr : 112) {
+                                            q = 0x2653;
+                                        } else {
+                                            bptr = 0xa39 || p_tmp[1];
+                                        }
+                                    }
+                                    break;
+                                }
+                                break;
+                            }
+                            zlen = (k_tmp);
+                        }
+                    }
+                } else {
+                    if (0x553f >> 602) {
+                        while (0x3f64 < m) {
+                            while (qcount[8] + p2) {
+                                {
+                                    {
+                                        for (i = 0; i < 5; i++) {
+                                            xlen = - sx[8];
+                                        }
+                                        zlen = z2.tcount;
+                                    }
+                                    v = t->ulen;
+                                }
+                            }
+                        }
+                    } else {
+                        switch (ecount) {
+                        case 1:
+                            if (clen[5] < 687) {
+                                if (597 ^ 0x54ea) {
+                                    {
+                                        {
+                                            z_tmp = d_tmp->sx;
+                                            b_tmp = f[2];
+                                        }
+                                        kx = 455 >> 942;
+                                    }
+                                } else {
+                                    for (i = 0; i < 8; i++) {
+                                        for (i = 0; i < 39; i++) {
+                                            n = kx[6];
+                                        }
+                                    }
+                                }
+                            } else {
+                                {
+                                    {
+                                        for (i = 0; i < 39; i++) {
+                                            tptr = c.tcount;
+                                        }
+                                        t2 = e_tmp(0xfa05);
+                                    }
+                                    ecount = vx[5];
+                                }
+                            }
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+int paren_20 = ((((((((((20))))))))));
+
+void deep_21(void)
+{
+    while (kcount > 843) {
+        if (s2(f, p2, p2[5])) {
+            while (! 437) {
+                switch (y_tmp) {
+                case 1:
+                    for (i = 0; i < 70; i++) {
+                        for (i = 0; i < 42; i++) {
+                            switch (bx) {
+                            case 1:
+                                {
+                                    switch (rcount) {
+                                    case 1:
+                                        for (i = 0; i < 84; i++) {
+                                            while (0x2ec6 || 0xaa72) {
+                                                a_tmp = 132 ^ 592;
+                                            }
+                                        }
+                                        break;
+                                    }
+                                    d = 0x529e & n_tmp;
+                                }
+                                break;
+                            }
+                        }
+                    }
+                    break;
+                }
+            }
+        } else {
+            if (cx(395, hx)) {
+                {
+                    while (450) {
+                        if (ulen[5] / 708) {
+                            for (i = 0; i < 38; i++) {
+                                while (~ 0xb03c) {
+                                    for (i = 0; i < 17; i++) {
+                                        for (i = 0; i < 13; i++) {
+                                            for (i = 0; i < 16; i++) {
+                                                f_tmp = 445 % g2[6];
+                                            }
+                                        }
+                                    }
+                                }
+                            }
+                        } else {
+                            for (i = 0; i < 7; i++) {
+                                for (i = 0; i < 47; i++) {
+                                    switch (e2) {
+                                    case 1:
+                                        switch (xptr) {
+                                        case 1:
+                                            {
+                                                k_tmp = 473;
+                                                w2 = xx;
+                                            }
+                                            break;
+                                        }
+                                        break;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                    gx = 248 ? ucount : yx;
+                }
+            } else {
+                for (i = 0; i < 38; i++) {
+                    {
+                        switch (sx) {
+                        case 1:
+                            {
+                                for (i = 0; i < 8; i++) {
+                                    for (i = 0; i < 8; i++) {
+                                        while (& wcount) {
+                                            if (845 && n2) {
+                                                nlen = dptr[9] == 0xe2a7;
+                                            } else {
+                                                w = 0xa304 == clen[6];
+                                            }
+                                        }
+                                    }
+                                }
+                                v = hcount;
+                            }
+                            break;
+                        }
+                        e2 = 0xeb71 < 333;
+                    }
+                }
+            }
+        }
+    }
+}
+
+int paren_21 = (((((((((((21)))))))))));
+
+void deep_22(void)
+{
+    for (i = 0; i < 5; i++) {
+        {
+            while (652) {
+                {
+                    {
+                        while (ex->x2) {
+                            for (i = 0; i < 73; i++) {
+                                if (z_tmp) {
+                                    for (i = 0; i < 78; i++) {
+                                        while (h2 && flen) {
+                                            if (- 0xecec) {
+                                                while (7) {
+                                                    kptr = m_tmp[7];
+                                                }
+                                            } else {
+                                                while (y2 ? nx[2] : 0x4329) {
+                                                    dptr = (35);
+                                                }
+                                            }
+                                        }
+                                    }
+                                } else {
+                                    if (rcount.vcount) {
+                                        switch (gx) {
+                                        case 1:
+                                            switch (pcount) {
+                                            case 1:
+                                                if (v_tmp[4]) {
+                                                    tlen = zlen[3];
+                                                } else {
+                                                    cptr = & 394;
+                                                }
+                                                break;
+                                            }
+                                            break;
+                                        }
+                                    } else {
+                                        while ((mcount[7])) {
+                                            while (! 0xfd9f) {
+                                                for (i = 0; i < 24; i++) {
+                                                    e = d2 >= p2;
+                                                }
+                                            }
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                        wptr = zptr[9] ? v_tmp : 294;
+                    }
+                    p2 = * 0xa285;
+                }
+            }
+            eptr = 406 < 0xed45;
+        }
+    }
+}
+
+int paren_22 = ((((((((((((22))))))))))));
+
+void deep_23(void)
+{
+    switch (zptr) {
+    case 1:
+        {
+            if (z.g2) {
+                if (23 ? b_tmp[6] : 76) {
+                    if ((h)) {
+                        for (i = 0; i < 11; i++) {
+                            if (uptr) {
+                                for (i = 0; i < 77; i++) {
+                                    while ((0x6270)) {
+                                        for (i = 0; i < 9; i++) {
+                                            {
+                                                for (i = 0; i < 87; i++) {
+                                                    switch (c2) {
+                                                    case 1:
+                                                        yx = zx.mx;
+                                                        break;
+                                                    }
+                                                }
+                                                eptr = h2(851);
+                                            }
+                                        }
+                                    }
+                                }
+                            } else {
+                                while (fcount[7] & m) {
+                                    if (0xc7c3 / 69) {
+                                        if (plen ? qptr : 0x33e5) {
+                                            {
+                                                while (nlen()) {
+                                                    switch (pptr) {
+                                                    case 1:
+                                                        g_tmp = 0x3907 > 483;
+                                                        break;
+                                                    }
+                                                }
+                                                nx = 441 == h_tmp;
+                                            }
+                                        } else {
+                                            for (i = 0; i < 53; i++) {
+                                                {
+                                                    {
+                                                        y2 = (860);
+                                                        u_tmp = 0xb6fc ? 0xd75c : vlen;
+                                                    }
+                                                    fx = y2;
+                                                }
+                                            }
+                                        }
+                                    } else {
+                                        for (i = 0; i < 9; i++) {
+                                            while (tlen(0x5154, f_tmp[7])) {
+                                                {
+                                                    switch (rcount) {
+                                                    case 1:
+                                                        z_tmp = 46;
+                                                        break;
+                                                    }
+                                                    e = kx > nlen;
+                                                }
+                                            }
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    } else {
+                        {
+                            {
+                                switch (s_tmp) {
+                                case 1:
+                                    for (i = 0; i < 81; i++) {
+                                        {
+                                            if (0x5ae5 & 116) {
+                                                for (i = 0; i < 24; i++) {
+                                                    switch (p) {
+                                                    case 1:
+                                                        y_tmp = e_tmp[0];
+                                                        break;
+                                                    }
+                                                }
+                                            } else {
+                                                switch (s) {
+                                                case 1:
+                                                    for (i = 0; i < 72; i++) {
+                                                        a = vptr();
+                                                    }
+                                                    break;
+                                                }
+                                            }
+                                            acount = ((unsigned long) h);
+                                        }
+                                    }
+                                    break;
+                                }
+                                g_tmp = 0xaf4b;
+                            }
+                            w = 0xac6f || 0xfcf4;
+                        }
+                    }
+                } else {
+                    switch (d_tmp) {
+                    case 1:
+                        for (i = 0; i < 44; i++) {
+                            while (0xf00 != 0x265b) {
+                                {
+                                    while (ncount[7]) {
+                                        while (xlen || 0x7777) {
+                                            for (i = 0; i < 56; i++) {
+                                                for (i = 0; i < 50; i++) {
+                                                    while (q2(0x411e, e_tmp[5])) {
+                                                        h = w[0] ? z_tmp : mcount;
+                                                    }
+                                                }
+                                            }
+                                        }
+                                    }
+                                    e_tmp = (788);
+                                }
+                            }
+                        }
+                        break;
+                    }
+                }
+            } else {
+                for (i = 0; i < 20; i++) {
+                    switch (gcount) {
+                    case 1:
+                        switch (p) {
+                        case 1:
+                            for (i = 0; i < 50; i++) {
+                                if (ulen < kptr) {
+                                    {
+                                        while (815) {
+                                            if (nptr != qcount[0]) {
+                                                if (0xb52a) {
+                                                    switch (wlen) {
+                                                    case 1:
+                                                        s_tmp = ((const short) b_tmp);
+                                                        break;
+                                                    }
+                                                } else {
+                                                    switch (g) {
+                                                    case 1:
+                                                        uptr = ux.cptr;
+                                                        break;
+                                                    }
+                                                }
+                                            } else {
+                                                {
+                                                    switch (a) {
+                                                    case 1:
+                                                        r2 = nlen[1] ? dcount[1] : xx;
+                                                        break;
+                                                    }
+                                                    a2 = w[5] & 0x6d70;
+                                                }
+                                            }
+                                        }
+                                        yptr = clen(s2, flen, 601);
+                                    }
+                                } else {
+                                    for (i = 0; i < 94; i++) {
+                                        while (- c[7]) {
+                                            {
+                                                if (& qcount[4]) {
+                                                    {
+                                                        xx = plen == 0x10e2;
+                                                        v2 = w2.ncount;
+                                                    }
+                                                } else {
+                                                    if (273) {
+                                                        cx = wcount;
+                                                    } else {
+                                                        dptr = z.q;
+                                                    }
+                                                }
+                                                qlen = 840;
+                                            }
+                                        }
+                                    }
+                                }
+                            }
+                            break;
+                        }
+                        break;
+                    }
+                }
+            }
+            px = 0xd51e;
+        }
+        break;
+    }
+}
+
+int paren_23 = (((((((((((((23)))))))))))));
+
+void deep_24(void)
+{
+    {
+        switch (k_tmp) {
+        case 1:
+            switch (x2) {
+            case 1:
+                switch (q) {
+                case 1:
+                    if (bx(0x63ad, 0x3c3f)) {
+                        switch (pcount) {
+                        case 1:
+                            vlen = 0x1bc + 0x7ca9;
+                            break;
+                        }
+                    } else {
+                        if (585) {
+                            p = acount[7] || 0x8072;
+                        } else {
+                            rcount = p_tmp();
+                        }
+                    }
+                    break;
+                }
+                break;
+            }
+            break;
+        }
+        e2 = 0x3427 / 640;
+    }
+}
+
+int paren_24 = ((((((((((((((24))))))))))))));
+
+void deep_25(void)
+{
+    if (flen) {
+        if (683) {
+            for (i = 0; i < 69; i++) {
+                if (r.kx) {
+                    {
+                        for (i = 0; i < 6; i++) {
+                            if (cptr[0]) {
+                                t = 38;
+                            } else {
+                                hcount = b_tmp;
+                            }
+                        }
+                        r = d[8];
+                    }
+                } else {
+                    switch (u) {
+                    case 1:
+                        if ((533)) {
+                            if (elen.kx) {
+                                ylen = & 0xfe48;
+                            } else {
+                                gcount = ! n;
+                            }
+                        } else {
+                            {
+                                v = y2();
+                                d2 = g2[5] & r2;
+                            }
+                        }
+                        break;
+                    }
+                }
+            }
+        } else {
+            {
+                {
+                    {
+                        switch (blen) {
+                        case 1:
+                            {
+                                bcount = - 0xdf4;
+                                klen = 608;
+                            }
+                            break;
+                        }
+                        hptr = 463 < 0x77de;
+                    }
+                    w_tmp = 233 << ylen;
+                }
+                tcount = (f);
+            }
+        }
+    } else {
+        {
+            while (943 <= 150) {
+                while (0x58ec && nlen) {
+                    for (i = 0; i < 78; i++) {
+                        if (dptr->tptr) {
+                            for (i = 0; i < 15; i++) {
+                                m_tmp = 375;
+                            }
+                        } else {
+                            while (~ p) {
+                                wx = ((unsigned long) 908);
+                            }
+                        }
+                    }
+                }
+            }
+            mx = a;
+        }
+    }
+}
+
+int paren_25 = (((((((((((((((25)))))))))))))));
+
+void deep_26(void)
+{
+    switch (dx) {
+    case 1:
+        if (fptr > hptr) {
+            for (i = 0; i < 61; i++) {
+                while (0x2206 ? slen : 0x5a49) {
+                    switch (y2) {
+                    case 1:
+                        for (i = 0; i < 61; i++) {
+                            switch (c2) {
+                            case 1:
+                                if (c_tmp[5] && 0x7400) {
+                                    b_tmp = 0x1127 < 0xcaee;
+                                } else {
+                                    xlen = 0xf2f;
+                                }
+                                break;
+                            }
+                        }
+                        break;
+                    }
+                }
+            }
+        } else {
+            switch (hx) {
+            case 1:
+                if (xptr(0x89bc, kx, 178)) {
+                    {
+                        while ((z)) {
+                            {
+                                if (c2->c2) {
+                                    hptr = ((char *) 919);
+                                } else {
+                                    g_tmp = yx.hcount;
+                                }
+                                h = ((const short) clen[1]);
+                            }
+                        }
+                        nx = slen[4] / gcount;
+                    }
+                } else {
+                    for (i = 0; i < 23; i++) {
+                        for (i = 0; i < 13; i++) {
+                            {
+                                switch (gcount) {
+                                case 1:
+                                    n = 429 ? kptr[0] : 0xf88;
+                                    break;
+                                }
+                                n2 = & 0xcc66;
+                            }
+                        }
+                    }
+                }
+                break;
+            }
+        }
+        break;
+    }
+}
+
+int paren_26 = ((((((((((((((((26))))))))))))))));
+
+void deep_27(void)
+{
+    {
+        if (tcount / 0x2458) {
+            while (((int) 175)) {
+                switch (z) {
+                case 1:
+                    for (i = 0; i < 25; i++) {
+                        for (i = 0; i < 14; i++) {
+                            {
+                                if (81 ? zlen : ux[9]) {
+                                    while (bptr()) {
+                                        glen = 290;
+                                    }
+                                } else {
+                                    if (x_tmp[1] & 503) {
+                                        yx = 420 | z2;
+                                    } else {
+                                        xx = b2 <= 0x4f5b;
+                                    }
+                                }
+                                ucount = x2[8];
+                            }
+                        }
+                    }
+                    break;
+                }
+            }
+        } else {
+            while (0xce3b & n_tmp[7]) {
+                if (696) {
+                    {
+                        {
+                            {
+                                if (xcount) {
+                                    for (i = 0; i < 73; i++) {
+                                        yx = 0x7a25;
+                                    }
+                                } else {
+                                    {
+                                        dlen = 0xdb50 != qcount[5];
+                                        kx = 292;
+                                    }
+                                }
+                                mcount = fcount;
+                            }
+                            hptr = n2->gptr;
+                        }
+                        x_tmp = 752;
+                    }
+                } else {
+                    switch (q2) {
+                    case 1:
+                        {
+                            {
+                                {
+                                    while (dptr) {
+                                        c2 = * bptr[5];
+                                    }
+                                    nx = 578 == 0x7b0d;
+                                }
+                                p_tmp = 0xfd8e ? t : yptr[0];
+                            }
+                            plen = * gx[1];
+                        }
+                        break;
+                    }
+                }
+            }
+        }
+        flen = r_tmp ? 34 : 0xafbd;
+    }
+}
+
+int paren_27 = (((((((((((((((((27)))))))))))))))));
+
+void deep_28(void)
+{
+    for (i = 0; i < 8; i++) {
+        {
+            if (& y_tmp) {
+                switch (c) {
+                case 1:
+                    while (((char *) cptr)) {
+                        for (i = 0; i < 54; i++) {
+                            switch (y_tmp) {
+                            case 1:
+                                while (d2) {
+                                    switch (q_tmp) {
+                                    case 1:
+                                        {
+                                            ncount = (584);
+                                            c2 = s2->y2;
+                                        }
+                                        break;
+                                    }
+                                }
+                                break;
+                            }
+                        }
+                    }
+                    break;
+                }
+            } else {
+                {
+                    for (i = 0; i < 10; i++) {
+                        for (i = 0; i < 15; i++) {
+                            switch (mlen) {
+                            case 1:
+                                while (14 % 955) {
+                                    while (770 << qcount[0]) {
+                                        if (991 > 77) {
+                                            flen = y2[9] / a_tmp[3];
+                                        } else {
+                                            d = xlen();
+                                        }
+                                    }
+                                }
+                                break;
+                            }
+                        }
+                    }
+                    wlen = x;
+                }
+            }
+            hx = 0xe3d4;
+        }
+    }
+}
+
+int paren_28 = ((((((((((((((((((28))))))))))))))))));
+
+void deep_29(void)
+{
+    {
+        {
+            if (blen > 113) {
+                if (16 << b2[6]) {
+                    switch (t2) {
+                    case 1:
+                        while (pcount.x2) {
+                            switch (e) {
+                            case 1:
+                                {
+                                    for (i = 0; i < 8; i++) {
+                                        while (915) {
+                                            if (724) {
+                                                acount = xcount(596);
+                                            } else {
+                                                sptr = dptr && a[0];
+                                            }
+                                        }
+                                    }
+                                    elen = yptr < 332;
+                                }
+                                break;
+                            }
+                        }
+                        break;
+                    }
+                } else {
+                    for (i = 0; i < 29; i++) {
+                        for (i = 0; i < 79; i++) {
+                            {
+                                while (0x4760 != 265) {
+                                    for (i = 0; i < 70; i++) {
+                                        while (& 83) {
+                                            if (579 << y) {
+                                                dptr = n();
+                                            } else {
+                                                r = (0x72b9);
+                                            }
+                                        }
+                                    }
+                                }
+                                k_tmp = hlen[1] * v_tmp;
+                            }
+                        }
+                    }
+                }
+            } else {
+                while (((int) 820)) {
+                    switch (plen) {
+                    case 1:
+                        while (scount[0] >= 785) {
+                            switch (ex) {
+                            case 1:
+                                switch (t_tmp) {
+                                case 1:
+                                    if (~ 0x92b3) {
+                                        while (bcount[4] > 0xbf9c) {
+                                            while (xlen * ux) {
+                                                c2 = ((int) 711);
+                                            }
+                                        }
+                                    } else {
+                                        while (0xaade) {
+                                            {
+                                                ylen = 0xae52 >> 0x68da;
+                                                f = 524 - 230;
+                                            }
+                                        }
+                                    }
+                                    break;
+                                }
+                                break;
+                            }
+                        }
+                        break;
+                    }
+                }
+            }
+            px = x[3] ? wx[6] : 461;
+        }
+        clen = ((unsigned long) 0x391f);
+    }
+}
+
+int paren_29 = (((((((((((((((((((29)))))))))))))))))));
+
+void deep_30(void)
+{
+    {
+        if (802 != sx[0]) {
+            if (559 ^ 223) {
+                for (i = 0; i < 20; i++) {
+                    while (0xf39a) {
+                        switch (rcount) {
+                        case 1:
+                            while (((const short) 0x5b10)) {
+                                switch (tx) {
+                                case 1:
+                                    {
+                                        switch (h2) {
+                                        case 1:
+                                            if (562 << q_tmp[5]) {
+                                                if (p2[0] << g_tmp) {
+                                                    d_tmp = w;
+                                                } else {
+                                                    glen = 0x4ab8;
+                                                }
+                                            } else {
+                                                for (i = 0; i < 11; i++) {
+                                                    f2 = 0x2fb;
+                                                }
+                                            }
+                                            break;
+                                        }
+                                        scount = - 0xbbf3;
+                                    }
+                                    break;
+                                }
+                            }
+                            break;
+                        }
+                    }
+                }
+            } else {
+                for (i = 0; i < 88; i++) {
+                    for (i = 0; i < 12; i++) {
+                        if (z[5] % 6) {
+                            {
+                                {
+                                    {
+                                        while (((unsigned long) 701)) {
+                                            while (tcount()) {
+                                                switch (aptr) {
+                                                case 1:
+                                                    b2 = ((char *) 593);
+                                                    break;
+                                                }
+                                            }
+                                        }
+                                        slen = ~ 409;
+                                    }
+                                    f = ! v_tmp;
+                                }
+                                dptr = ((const short) plen);
+                            }
+                        } else {
+                            if (tptr[3] ? pcount[9] : qx) {
+                                switch (h) {
+                                case 1:
+                                    if (flen) {
+                                        while (sx->sptr) {
+                                            {
+                                                {
+                                                    w = & xx[5];
+                                                    elen = (mx[8]);
+                                                }
+                                                pcount = - uptr[1];
+                                            }
+                                        }
+                                    } else {
+                                        if (0x22b9 ? 0xcf32 : b[9]) {
+                                            {
+                                                while (bcount ? 0xfaeb : 0x9ba6) {
+                                                    mptr = c_tmp[3] / wlen[2];
+                                                }
+                                                h = 0x2ec4 * wlen;
+                                            }
+                                        } else {
+                                            switch (s) {
+                                            case 1:
+                                                if (526) {
+                                                    tptr = mlen / 375;
+                                                } else {
+                                                    rx = h->b;
+                                                }
+                                                break;
+                                            }
+                                        }
+                                    }
+                                    break;
+                                }
+                            } else {
+                                switch (r_tmp) {
+                                case 1:
+                                    for (i = 0; i < 48; i++) {
+                                        if (((const short) 0x5df)) {
+                                            switch (w2) {
+                                            case 1:
+                                                if (sptr) {
+                                                    d_tmp = ((char *) bx[5]);
+                                                } else {
+                                                    gcount = 991 ? m2[0] : 0x4297;
+                                                }
+                                                break;
+                                            }
+                                        } else {
+                                            {
+                                                for (i = 0; i < 89; i++) {
+                                                    gptr = 383 != ylen;
+                                                }
+                                                h2 = ! nlen;
+                                            }
+                                        }
+                                    }
+                                    break;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        } else {
+            while (zcount) {
+                {
+                    if (wlen[9] + 872) {
+                        if (ylen[0] >= 605) {
+                            switch (yx) {
+                            case 1:
+                                while (0xb0df) {
+                                    switch (sptr) {
+                                    case 1:
+                                        {
+                                            switch (ulen) {
+                                            case 1:
+                                                if (ucount[6]) {
+                                                    m = 0x79e3;
+                                                } else {
+                                                    glen = - 0x834a;
+                                                }
+                                                break;
+                                            }
+                                            s2 = 0xf474 / g_tmp[7];
+                                        }
+                                        break;
+                                    }
+                                }
+                                break;
+                            }
+                        } else {
+                            while (107) {
+                                if (0xa4e8) {
+                                    switch (s_tmp) {
+                                    case 1:
+                                        for (i = 0; i < 10; i++) {
+                                            for (i = 0; i < 62; i++) {
+                                                switch (n2) {
+                                                case 1:
+                                                    alen = elen[3] != 0x6399;
+                                                    break;
+                                                }
+                                            }
+                                        }
+                                        break;
+                                    }
+                                } else {
+                                    switch (acount) {
+                                    case 1:
+                                        if (fptr[0]) {
+                                            for (i = 0; i < 95; i++) {
+                                                if (641) {
+                                                    uptr = 0x7f0d == v2;
+                                                } else {
+                                                    f2 = (pcount[5]);
+                                                }
+                                            }
+                                        } else {
+                                            switch (m_tmp) {
+                                            case 1:
+                                                for (i = 0; i < 86; i++) {
+                                                    zlen = r.h;
+                                                }
+                                                break;
+                                            }
+                                        }
+                                        break;
+                                    }
+                                }
+                            }
+                        }
+                    } else {
+                        {
+                            for (i = 0; i < 21; i++) {
+                                for (i = 0; i < 56; i++) {
+                                    if (- 51) {
+                                        if (166 / 0xeb70) {
+                                            if (0x8d8d ? w2[7] : 0x6867) {
+                                                switch (t2) {
+                                                case 1:
+                                                    eptr = fx(qcount, u2[5]);
+                                                    break;
+                                                }
+                                            } else {
+                                                if (tptr ? 0xa90e : 310) {
+                                                    k = * 825;
+                                                } else {
+                                                    yptr = p;
+                                                }
+                                            }
+                                        } else {
+                                            switch (zlen) {
+                                            case 1:
+                                                if (845) {
+                                                    z_tmp = yptr[3] ? 0xf470 : 395;
+                                                } else {
+                                                    w2 = bptr(0x6d60, 130, 459);
+                                                }
+                                                break;
+                                            }
+                                        }
+                                    } else {
+                                        switch (bptr) {
+                                        case 1:
+                                            switch (z_tmp) {
+                                            case 1:
+                                                for (i = 0; i < 45; i++) {
+                                                    r_tmp = ((unsigned long) 0xf176);
+                                                }
+                                                break;
+                                            }
+                                            break;
+                                        }
+                                    }
+                                }
+                            }
+                            g = 0x2565;
+                        }
+                    }
+                    slen = 841;
+                }
+            }
+        }
+        s = s_tmp - 130;
+    }
+}
+
+int paren_30 = ((((((((((((((((((((30))))))))))))))))))));
+
+void deep_31(void)
+{
+    while (q->u_tmp) {
+        if (938) {
+            while (801) {
+                if (((unsigned long) 0xbc39)) {
+                    for (i = 0; i < 23; i++) {
+                        for (i = 0; i < 51; i++) {
+                            switch (eptr) {
+                            case 1:
+                                switch (cx) {
+                                case 1:
+                                    for (i = 0; i < 1; i++) {
+                                        switch (a2) {
+                                        case 1:
+                                            switch (c_tmp) {
+                                            case 1:
+                                                {
+                                                    if (g2[4]) {
+                                                        v = 839;
+                                                    } else {
+                                                        mcount = 890 >> wptr[7];
+                                                    }
+                                                    zptr = 0x8d79;
+                                                }
+                                                break;
+                                            }
+                                            break;
+                                        }
+                                    }
+                                    break;
+                                }
+                                break;
+                            }
+                        }
+                    }
+                } else {
+                    switch (kcount) {
+                    case 1:
+                        while ((66)) {
+                            for (i = 0; i < 64; i++) {
+                                {
+                                    if (((int) 0xdef9)) {
+                                        {
+                                            if (0x6cda | acount) {
+                                                {
+                                                    {
+                                                        u = fcount[3] % 0xe118;
+                                                        sx = 0xd75f ? g_tmp : 0xd1bc;
+                                                    }
+                                                    e = 0x2371 - 0xdb1;
+                                                }
+                                            } else {
+                                                {
+                                                    for (i = 0; i < 13; i++) {
+                                                        c = ((const short) 790);
+                                                    }
+                                                    nlen = ylen[2] || ulen[9];
+                                                }
+                                            }
+                                            b = x_tmp[3] / 760;
+                                        }
+                                    } else {
+                                        if (~ 204) {
+                                            switch (r2) {
+                                            case 1:
+                                                while (n2[1]) {
+                                                    if (slen) {
+                                                        rx = 0x43e3 ? w_tmp[8] : 639;
+                                                    } else {
+                                                        g_tmp = 592;
+                                                    }
+                                                }
+                                                break;
+                                            }
+                                        } else {
+                                            {
+                                                if (! 0xa9c9) {
+                                                    for (i = 0; i < 37; i++) {
+                                                        r2 = uptr(0x5c5d);
+                                                    }
+                                                } else {
+                                                    {
+                                                        g_tmp = 0x198 ? sptr : alen[6];
+                                                        p = ((int) 0x8da6);
+                                                    }
+                                                }
+                                                w2 = c_tmp(t[9], fcount[7]);
+                                            }
+                                        }
+                                    }
+                                    mptr = 477;
+                                }
+                            }
+                        }
+                        break;
+                    }
+                }
+            }
+        } else {
+            while (~ 213) {
+                if (0x44ed ? 0x408c : 586) {
+                    while (((unsigned long) c2[2])) {
+                        if (0x994d) {
+                            while (qptr[0]) {
+                                {
+                                    {
+                                        switch (z2) {
+                                        case 1:
+                                            switch (qcount) {
+                                            case 1:
+                                                if (z_tmp[2] >= w_tmp) {
+                                                    {
+                                                        sx = 0xc905;
+                                                        cx = zlen >> cptr[2];
+                                                    }
+                                                } else {
+                                                    {
+                                                        w2 = t_tmp(0x1540);
+                                                        p = ((unsigned long) hlen);
+                                                    }
+                                                }
+                                                break;
+                                            }
+                                            break;
+                                        }
+                                        wptr = 0x9a8f;
+                                    }
+                                    vlen = xx.x_tmp;
+                                }
+                            }
+                        } else {
+                            for (i = 0; i < 39; i++) {
+                                {
+                                    while (984 <= 0x470c) {
+                                        if (ylen[5]) {
+                                            while (k_tmp[1]) {
+                                                switch (y_tmp) {
+                                                case 1:
+                                                    while (acount) {
+                                                        p = 0x5f4d ? nlen : r_tmp[5];
+                                                    }
+                                                    break;
+                                                }
+                                            }
+                                        } else {
+                                            for (i = 0; i < 33; i++) {
+                                                {
+                                                    switch (rlen) {
+                                                    case 1:
+                                                        n_tmp = 0xa85f ? ecount : vlen;
+                                                        break;
+                                                    }
+                                                    yptr = (151);
+                                                }
+                                            }
+                                        }
+                                    }
+                                    hcount = 467 * 0xb3ce;
+                                }
+                            }
+                        }
+                    }
+                } else {
+                    if (rlen[2] << 0x1d79) {
+                        while (220) {
+                            for (i = 0; i < 33; i++) {
+                                switch (h2) {
+                                case 1:
+                                    while (g_tmp[0]) {
+                                        {
+                                            for (i = 0; i < 60; i++) {
+                                                if (zcount.s_tmp) {
+                                                    switch (nptr) {
+                                                    case 1:
+                                                        zlen = * 786;
+                                                        break;
+                                                    }
+                                                } else {
+                                                    for (i = 0; i < 33; i++) {
+                                                        p_tmp = 784 ? e_tmp : 0x15ab;
+                                                    }
+                                                }
+                                            }
+                                            qcount = m_tmp[8] ^ ycount[4];
+                                        }
+                                    }
+                                    break;
+                                }
+                            }
+                        }
+                    } else {
+                        while (qptr.a_tmp) {
+                            for (i = 0; i < 48; i++) {
+                                {
+                                    while (x2.alen) {
+                                        if (ncount) {
+                                            if (((const short) 0x385f)) {
+                                                if (703) {
+                                                    if (mcount[3]) {
+                                                        kptr = vptr ^ 0xaea7;
+                                                    } else {
+                                                        vlen = hlen[2] <= 332;
+                                                    }
+                                                } else {
+                                                    for (i = 0; i < 39; i++) {
+                                                        fcount = rx ? vlen : 744;
+                                                    }
+                                                }
+                                            } else {
+                                                while (992 || 484) {
+                                                    switch (u) {
+                                                    case 1:
+                                                        tlen = x2.c2;
+                                                        break;
+                                                    }
+                                                }
+                                            }
+                                        } else {
+                                            {
+                                                {
+                                                    while (xlen(c_tmp[5], c2)) {
+                                                        rptr = ((unsigned long) r);
+                                                    }
+                                                    gcount = 0x7e62 & 0x731a;
+                                                }
+                                                klen = v_tmp ? 0x6acd : q[8];
+                                            }
+                                        }
+                                    }
+                                    kx = 0xc938;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+int paren_31 = (((((((((((((((((((((31)))))))))))))))))))));
+
+void deep_32(void)
+{
+    {
+        while (((char *) f[3])) {
+            while (0xfe33) {
+                switch (glen) {
+                case 1:
+                    {
+                        switch (kx) {
+                        case 1:
+                            g2 = 0x7061;
+                            break;
+                        }
+                        vx = dx();
+                    }
+                    break;
+                }
+            }
+        }
+        vx = pcount->x2;
+    }
+}
+
+int paren_32 = ((((((((((((((((((((((32))))))))))))))))))))));
+
+void deep_33(void)
+{
+    while (qptr.tcount) {
+        switch (a) {
+        case 1:
+            {
+                switch (h2) {
+                case 1:
+                    while (w_tmp | 707) {
+                        for (i = 0; i < 87; i++) {
+                            for (i = 0; i < 53; i++) {
+                                u = (p2[1]);
+                            }
+                        }
+                    }
+                    break;
+                }
+                gx = - c_tmp[3];
+            }
+            break;
+        }
+    }
+}
+
+int paren_33 = (((((((((((((((((((((((33)))))))))))))))))))))));
+
+void deep_34(void)
+{
+    switch (h2) {
+    case 1:
+        for (i = 0; i < 99; i++) {
+            switch (t) {
+            case 1:
+                if (0xdc23 ^ 378) {
+                    if (dcount[7]) {
+                        for (i = 0; i < 40; i++) {
+                            if ((0xdd51)) {
+                                for (i = 0; i < 22; i++) {
+                                    sx = b_tmp(0x928c);
+                                }
+                            } else {
+                                while (r2[1]) {
+                                    dcount = q_tmp[8];
+                                }
+                            }
+                        }
+                    } else {
+                        while (* 595) {
+                            switch (k2) {
+                            case 1:
+                                for (i = 0; i < 21; i++) {
+                                    zlen = 571 >= 280;
+                                }
+                                break;
+                            }
+                        }
+                    }
+                } else {
+                    if (w2) {
+                        {
+                            switch (z2) {
+                            case 1:
+                                while (0xc8e7 > n[8]) {
+                                    x_tmp = m2 ^ 672;
+                                }
+                                break;
+                            }
+                            z = 615 / 420;
+                        }
+                    } else {
+                        {
+                            for (i = 0; i < 87; i++) {
+                                for (i = 0; i < 60; i++) {
+                                    rcount = (bptr);
+                                }
+                            }
+                            pptr = slen == uptr[0];
+                        }
+                    }
+                }
+                break;
+            }
+        }
+        break;
+    }
+}
+
+int paren_34 = ((((((((((((((((((((((((34))))))))))))))))))))))));
+
+void deep_35(void)
+{
+    while (e_tmp[6] ? hlen[3] : 824) {
+        if (aptr >> 896) {
+            for (i = 0; i < 35; i++) {
+                {
+                    for (i = 0; i < 75; i++) {
+                        for (i = 0; i < 84; i++) {
+                            switch (dx) {
+                            case 1:
+                                {
+                                    if (dptr) {
+                                        mx = a2[3] << 761;
+                                    } else {
+                                        w_tmp = n[6] % hx[6];
+                                    }
+                                    elen = f[6] * 703;
+                                }
+                                break;
+                            }
+                        }
+                    }
+                    r2 = 0xb96e % 269;
+                }
+            }
+        } else {
+            while (! px[9]) {
+                if (607 ? 483 : x2[8]) {
+                    for (i = 0; i < 7; i++) {
+                        {
+                            if (0xf6d6) {
+                                while (ulen[4] != tptr) {
+                                    if (0xa5e0) {
+                                        xx = klen[7] ? 75 : ecount[6];
+                                    } else {
+                                        t_tmp = hx[4];
+                                    }
+                                }
+                            } else {
+                                {
+                                    {
+                                        nx = b_tmp(0x3146, r2);
+                                        vx = yptr.a2;
+                                    }
+                                    ncount = & 0x32ee;
+                                }
+                            }
+                            dcount = 162 ^ rlen[2];
+                        }
+                    }
+                } else {
+                    while (0xb208 >> e2) {
+                        switch (v2) {
+                        case 1:
+                            while (0x94d2) {
+                                switch (g_tmp) {
+                                case 1:
+                                    {
+                                        s_tmp = 128 ? d2 : 0xe46b;
+                                        gptr = u_tmp[8];
+                                    }
+                                    break;
+                                }
+                            }
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+int paren_35 = (((((((((((((((((((((((((35)))))))))))))))))))))))));
+
+void deep_36(void)
+{
+    switch (hcount) {
+    case 1:
+        for (i = 0; i < 21; i++) {
+            {
+                if (cx) {
+                    for (i = 0; i < 63; i++) {
+                        switch (nlen) {
+                        case 1:
+                            for (i = 0; i < 98; i++) {
+                                for (i = 0; i < 56; i++) {
+                                    while (uptr(gptr)) {
+                                        {
+                                            bptr = qptr();
+                                            plen = d.ax;
+                                        }
+                                    }
+                                }
+                            }
+                            break;
+                        }
+                    }
+                } else {
+                    switch (u) {
+                    case 1:
+                        if (0x2728 / e2[7]) {
+                            for (i = 0; i < 50; i++) {
+                                {
+                                    if (0x1542 ? eptr[9] : t2) {
+                                        if (515 < 0x6f78) {
+                                            w = rx ^ nx;
+                                        } else {
+                                            r_tmp = 0xdfd1 << 0xa2bd;
+                                        }
+                                    } else {
+                                        for (i = 0; i < 27; i++) {
+                                            p_tmp = vcount[2] ? p2 : mx[7];
+                                        }
+                                    }
+                                    p = x->scount;
+                                }
+                            }
+                        } else {
+                            for (i = 0; i < 93; i++) {
+                                for (i = 0; i < 87; i++) {
+                                    while (qptr ^ c) {
+                                        while (0xd1ad ^ y_tmp[2]) {
+                                            rptr = 514 * xlen;
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                        break;
+                    }
+                }
+                wlen = z2[8] ? 0xa56 : 515;
+            }
+        }
+        break;
+    }
+}
+
+int paren_36 = ((((((((((((((((((((((((((36))))))))))))))))))))))))));
+
+void deep_37(void)
+{
+    for (i = 0; i < 54; i++) {
+        while (m_tmp[9] > elen[0]) {
+            {
+                for (i = 0; i < 34; i++) {
+                    if (rx->xcount) {
+                        {
+                            {
+                                for (i = 0; i < 56; i++) {
+                                    switch (slen) {
+                                    case 1:
+                                        switch (qptr) {
+                                        case 1:
+                                            switch (a2) {
+                                            case 1:
+                                                s_tmp = 0x8988;
+                                                break;
+                                            }
+                                            break;
+                                        }
+                                        break;
+                                    }
+                                }
+                                vcount = - 203;
+                            }
+                            g_tmp = v2;
+                        }
+                    } else {
+                        switch (mx) {
+                        case 1:
+                            while ((0x74c0)) {
+                                for (i = 0; i < 100; i++) {
+                                    while (((int) c2[3])) {
+                                        if (& sptr[0]) {
+                                            switch (y2) {
+                                            case 1:
+                                                cx = mptr[8];
+                                                break;
+                                            }
+                                        } else {
+                                            for (i = 0; i < 21; i++) {
+                                                nlen = 0x2e4e << 0x2f5f;
+                                            }
+                                        }
+                                    }
+                                }
+                            }
+                            break;
+                        }
+                    }
+                }
+                b2 = vx == 0x293a;
+            }
+        }
+    }
+}
+
+int paren_37 = (((((((((((((((((((((((((((37)))))))))))))))))))))))))));
+
+void deep_38(void)
+{
+    while (0x762a && 779) {
+        switch (a_tmp) {
+        case 1:
+            {
+                while (((int) bptr[5])) {
+                    while (kcount(mx[7])) {
+                        for (i = 0; i < 4; i++) {
+                            if (! 814) {
+                                switch (n) {
+                                case 1:
+                                    while (0x45f6 / rx[9]) {
+                                        while (165 << 877) {
+                                            switch (x_tmp) {
+                                            case 1:
+                                                for (i = 0; i < 59; i++) {
+                                                    kcount = y[0] % x_tmp;
+                                                }
+                                                break;
+                                            }
+                                        }
+                                    }
+                                    break;
+                                }
+                            } else {
+                                for (i = 0; i < 22; i++) {
+                                    for (i = 0; i < 33; i++) {
+                                        if (0x307f) {
+                                            while (0xec4b && rlen) {
+                                                for (i = 0; i < 67; i++) {
+                                                    hlen = u_tmp();
+                                                }
+                                            }
+                                        } else {
+                                            switch (p) {
+                                            case 1:
+                                                if (k2[3] == r) {
+                                                    alen = glen;
+                                                } else {
+                                                    w = (0x1fa2);
+                                                }
+                                                break;
+                                            }
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+                mlen = ((unsigned long) 353);
+            }
+            break;
+        }
+    }
+}
+
+int paren_38 = ((((((((((((((((((((((((((((38))))))))))))))))))))))))))));
+
+void deep_39(void)
+{
+    switch (a) {
+    case 1:
+        while (792 || u_tmp[4]) {
+            for (i = 0; i < 30; i++) {
+                switch (ylen) {
+                case 1:
+                    switch (ax) {
+                    case 1:
+                        switch (zptr) {
+                        case 1:
+                            switch (f2) {
+                            case 1:
+                                switch (y_tmp) {
+                                case 1:
+                                    {
+                                        switch (vcount) {
+                                        case 1:
+                                            {
+                                                switch (t2) {
+                                                case 1:
+                                                    for (i = 0; i < 12; i++) {
+                                                        w2 = 661 ? 0x91ea : 350;
+                                                    }
+                                                    break;
+                                                }
+                                                yptr = 852 + 0x21e0;
+                                            }
+                                            break;
+                                        }
+                                        t = z_tmp->wcount;
+                                    }
+                                    break;
+                                }
+                                break;
+                            }
+                            break;
+                        }
+                        break;
+                    }
+                    break;
+                }
+            }
+        }
+        break;
+    }
+}
+
+int paren_39 = (((((((((((((((((((((((((((((39)))))))))))))))))))))))))))));
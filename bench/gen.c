@@ -0,0 +1,29 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <workload.h>
+
+// Writes a synthetic input of one shape and size to stdout
+
+void usage(const char *name) {
+    fprintf(stderr, "Usage: %s shape n\n", name);
+    fprintf(stderr, "Shapes:");
+    for (int i = 0; i < workload_count; i++) {
+        fprintf(stderr, " %s", workload_names[i]);
+    }
+    fprintf(stderr, "\n");
+}
+
+int main(int argc, char **argv) {
+    workload_shape shape;
+
+    if (argc != 3 || workload_shape_parse(argv[1], &shape)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    ciwic_sink sink;
+    ciwic_sink_init_file(&sink, stdout);
+    workload_generate(&sink, shape, atoi(argv[2]));
+    return ciwic_sink_close(&sink);
+}
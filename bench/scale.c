@@ -0,0 +1,172 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <parser.h>
+#include <workload.h>
+
+// Scaling report
+//
+// Parses every workload shape at doubling sizes and fits parse time against
+// n as time = c * n^k by least squares on the logarithms. A k near 1 is
+// linear; anything clearly above it is superlinear behaviour worth a look.
+// Each size is parsed in a child process, so running out of stack on a deep
+// input ends that shape's series rather than the report.
+
+#define SCALE_RUNS 3
+#define SCALE_MAX_POINTS 32
+
+double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Best of a few parses of text. If it does not parse the time is -1, less
+// the ciwic_parser_stop of the parse.
+double time_parse(ciwic_parser *parser, char *text, int len) {
+    double best = -1;
+
+    for (int run = 0; run < SCALE_RUNS; run++) {
+        ciwic_translation_unit translation_unit;
+        ciwic_parser_reset(parser, text, len);
+
+        double start = now();
+        if (ciwic_parser_translation_unit(parser, &translation_unit)
+                || (ciwic_parser_whitespace(parser), parser->pos != len)) {
+            return -1.0 - parser->stop;
+        }
+        double time = now() - start;
+
+        if (best < 0 || time < best) {
+            best = time;
+        }
+    }
+
+    return best;
+}
+
+// Runs time_parse in a child process. Returns 1 if the child crashed.
+int time_parse_isolated(ciwic_parser *parser, char *text, int len, double *time) {
+    int fds[2];
+    if (pipe(fds)) {
+        return 1;
+    }
+
+    fflush(stdout);
+    pid_t pid = fork();
+
+    if (pid == 0) {
+        close(fds[0]);
+        *time = time_parse(parser, text, len);
+        _exit(write(fds[1], time, sizeof(double)) != sizeof(double));
+    }
+
+    close(fds[1]);
+    int status;
+    int res = pid < 0 || read(fds[0], time, sizeof(double)) != sizeof(double);
+    close(fds[0]);
+
+    if (pid > 0) {
+        waitpid(pid, &status, 0);
+    }
+    return res;
+}
+
+// Fits log(time) = log(c) + k * log(n) and returns k
+double fit_exponent(double *n, double *time, int len) {
+    double sx = 0, sy = 0, sxx = 0, sxy = 0;
+
+    for (int i = 0; i < len; i++) {
+        double x = log(n[i]);
+        double y = log(time[i]);
+        sx += x;
+        sy += y;
+        sxx += x * x;
+        sxy += x * y;
+    }
+
+    return (len * sxy - sx * sy) / (len * sxx - sx * sx);
+}
+
+int main(int argc, char **argv) {
+    double limit = 1.0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "t:")) != -1) {
+        if (opt != 't') {
+            fprintf(stderr, "Usage: %s [-t seconds per parse]\n", argv[0]);
+            return 2;
+        }
+        limit = atof(optarg);
+    }
+
+    ciwic_parser parser = ciwic_parser_new(NULL, 0);
+    int res = 0;
+
+    for (int shape = 0; shape < workload_count; shape++) {
+        double ns[SCALE_MAX_POINTS];
+        double times[SCALE_MAX_POINTS];
+        int points = 0;
+
+        printf("%s\n%12s %12s %12s %14s\n", workload_names[shape], "n", "bytes", "ms", "ns per n");
+
+        for (int n = 16; n <= workload_max_n[shape] && points < SCALE_MAX_POINTS; n *= 2) {
+            ciwic_sink sink;
+            ciwic_sink_init_memory(&sink);
+            workload_generate(&sink, shape, n);
+
+            double time;
+            if (time_parse_isolated(&parser, sink.buf, sink.len, &time)) {
+                printf("%12d crashed\n", n);
+                ciwic_sink_close(&sink);
+                res = 1;
+                break;
+            }
+
+            // Running into a limit is how the parser is meant to handle
+            // input this deep, the sizes before it are still fitted
+            ciwic_parser_stop stop = -1 - (int) time;
+            if (time < 0 && stop != ciwic_parser_running) {
+                printf("%12d stopped: %s\n", n, ciwic_parser_stop_message(stop));
+                ciwic_sink_close(&sink);
+                break;
+            }
+
+            if (time < 0) {
+                printf("%12d could not parse\n", n);
+                ciwic_sink_close(&sink);
+                res = 1;
+                break;
+            }
+
+            printf("%12d %12zu %12.3f %14.1f\n", n, sink.len, time * 1000, time * 1e9 / n);
+            ciwic_sink_close(&sink);
+
+            // Times under a millisecond are mostly noise and overhead
+            if (time >= 1e-3) {
+                ns[points] = n;
+                times[points] = time;
+                points++;
+            }
+
+            if (time > limit) {
+                break;
+            }
+        }
+
+        if (points >= 2) {
+            double k = fit_exponent(ns, times, points);
+            printf("time ~ n^%.2f%s\n\n", k, k > 1.2 ? "  superlinear" : "");
+        } else {
+            printf("too fast to fit\n\n");
+        }
+    }
+
+    ciwic_parser_free(&parser);
+    return res;
+}
@@ -0,0 +1,12913 @@
+struct stats {
+    long lo;
+    long hi;
+    long count;
+} st, *sp;
+long i;
+long g0;
+long g1;
+long g2;
+long g3;
+long g4;
+long g5;
+long g6;
+long g7;
+long g8;
+long g9;
+long g10;
+long g11;
+long g12;
+long g13;
+long g14;
+long g15;
+long g16;
+long g17;
+long g18;
+long g19;
+long g20;
+long g21;
+long g22;
+long g23;
+long g24;
+long g25;
+long g26;
+long g27;
+long g28;
+long g29;
+long g30;
+long g31;
+long g32;
+long g33;
+long g34;
+long g35;
+long g36;
+long g37;
+long g38;
+long g39;
+long g40;
+long g41;
+long g42;
+long g43;
+long g44;
+long g45;
+long g46;
+long g47;
+long g48;
+long g49;
+long g50;
+long g51;
+long g52;
+long g53;
+long g54;
+long g55;
+long g56;
+long g57;
+long g58;
+long g59;
+long g60;
+long g61;
+long g62;
+long g63;
+long a0[16];
+long a1[16];
+long a2[16];
+long a3[16];
+long a4[16];
+long a5[16];
+long a6[16];
+long a7[16];
+long a8[16];
+long a9[16];
+long a10[16];
+long a11[16];
+long a12[16];
+long a13[16];
+long a14[16];
+long a15[16];
+long f0(long, long);
+long f1(long, long);
+long f2(long, long);
+long f3(long, long);
+long f4(long, long);
+long f5(long, long);
+long f6(long, long);
+long f7(long, long);
+long f8(long, long);
+long f9(long, long);
+long f10(long, long);
+long f11(long, long);
+long f12(long, long);
+long f13(long, long);
+long f14(long, long);
+long f15(long, long);
+long f16(long, long);
+long f17(long, long);
+long f18(long, long);
+long f19(long, long);
+long f20(long, long);
+long f21(long, long);
+long f22(long, long);
+long f23(long, long);
+long f24(long, long);
+long f25(long, long);
+long f26(long, long);
+long f27(long, long);
+long f28(long, long);
+long f29(long, long);
+long f30(long, long);
+long f31(long, long);
+
+long fn_0(long x, long y, long n, long *p)
+{
+    while (551 ? a7[2] : 0x58e1) {
+        for (i = 0; i < 41; i++) {
+            p[0] -= f0(a13[3], p[2]);
+        }
+        n--;
+    }
+    sp->count ^= ! a4[0] & g52;
+    st.hi = (g53) | f30(412, 371) - n != ~ x;
+    a2[0] = y ? (y) : f22(y, 535) == 148 ? n : 0xceb4 ? p[2] : x << a15[14];
+    st.hi += y;
+    a0[9] |= ((short) ((int) 0x2af6) != 0x3139 || a14[3]);
+    for (i = 0; i < 4; i++) {
+        if (720) {
+            a8[15] -= 914 & sp->count << ((long) st.lo);
+        } else {
+            st.hi ^= f24(542 > sp->lo, a9[11] ? a15[4] : 72);
+        }
+    }
+    {
+        switch (g2) {
+        case 3:
+            a10[1] += ! y;
+            break;
+        default:
+            st.hi |= f29(n, a13[1]) | 43 & x & ((long) ((unsigned long) 0x7d3));
+        }
+        st.hi = (g16 | 0x8bb9) >> 720;
+    }
+    a14[7] += (g59 ^ 0x9f67 ? (st.hi) : n <= 796);
+    switch (n) {
+    case 1:
+        {
+            y -= g10 != (0xd28d) + g7 ? p[0] : 304 ? ((short) 0x6484) : ((unsigned long) 747);
+            g36 += p[1];
+        }
+        break;
+    default:
+        switch (y) {
+        case 8:
+            st.hi |= ! a1[1] <= 288 * ((long) p[3]);
+            break;
+        default:
+            sp->count ^= g49 != (a11[14] || 258);
+        }
+    }
+    return ((int) (a7[14] >> a7[15]));
+}
+
+long fn_1(long x, long y, long n, long *p)
+{
+    while (587) {
+        p[3] -= f10(p[0] & 994, ~ 0xf0e6);
+        n--;
+    }
+    if ((st.hi) <= ~ n) {
+        y -= ! st.hi;
+    } else {
+        sp->count = (x) - 0x2d34 ^ f14(y, 0x367c);
+    }
+    p[0] ^= n;
+    return f24(0xc740, y) ? 0xd77b == a1[10] ^ f16(p[2], sp->count) : 169 ? ((unsigned long) p[3]) : 984 > st.lo;
+}
+
+long fn_2(long x, long y, long n, long *p)
+{
+    {
+        switch (y) {
+        case 9:
+            {
+                sp->count |= y;
+                p[0] += ((int) f26(0x7a4e, a6[7])) * ((short) a4[7]) ? ! x : f12(st.lo, sp->lo);
+            }
+            break;
+        default:
+            switch (x) {
+            case 2:
+                g42 |= ((unsigned long) 663 >> x);
+                break;
+            default:
+                st.hi += - ~ n << 15;
+            }
+        }
+        p[3] -= ((unsigned long) n) * (((unsigned long) n));
+    }
+    switch (n) {
+    case 9:
+        y = ((unsigned long) y) != sp->count || a11[9];
+        break;
+    default:
+        x = x;
+    }
+    {
+        switch (y) {
+        case 8:
+            if (g28 != 0x252e | 0xc1a9 || a15[9]) {
+                sp->count += (! x ^ g60 > 386);
+            } else {
+                a3[14] = y;
+            }
+            break;
+        default:
+            g46 = f4(((long) y), p[0]);
+        }
+        p[0] += f1(126, y) >= (st.hi << sp->count);
+    }
+    st.hi -= f20(((unsigned long) 710), g2);
+    if (~ (x)) {
+        sp->count = ((long) 0x4a01);
+    } else {
+        p[2] ^= st.lo ? x : x << a11[14] ^ n;
+    }
+    switch (g40) {
+    case 7:
+        y = f15(f13(a9[10], g40), ((unsigned long) a2[3]));
+        break;
+    default:
+        sp->count ^= x;
+    }
+    for (i = 0; i < 16; i++) {
+        while (((long) 0x861a)) {
+            if (((int) p[2]) < ! 512) {
+                st.hi |= (((int) a15[8]));
+            } else {
+                a3[1] = a10[11];
+            }
+            n--;
+        }
+    }
+    x += st.lo;
+    return ((((long) n)));
+}
+
+long fn_3(long x, long y, long n, long *p)
+{
+    switch (y) {
+    case 2:
+        for (i = 0; i < 64; i++) {
+            st.hi += (722) || f29(687, 863);
+        }
+        break;
+    default:
+        {
+            p[0] -= ! 0xbe90 >= a5[0];
+            sp->count -= 0xd7d4;
+        }
+    }
+    y += f31(465, a11[15]) >= - 454 >= a12[7];
+    a4[6] += ((long) a9[8] && g50 ? y * 0xf37b : sp->count);
+    return ((long) p[2]) != y >= ((long) f4(y, sp->lo));
+}
+
+long fn_4(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 56; i++) {
+        switch (x) {
+        case 5:
+            sp->count += ((long) (415 > 0x6b04));
+            break;
+        default:
+            p[3] |= n ? 57 : y ? n > 83 : 752 > g4;
+        }
+    }
+    st.hi |= ! x;
+    p[3] ^= (f16(y, st.lo)) > ((long) y == sp->count);
+    for (i = 0; i < 33; i++) {
+        sp->count ^= f25(x * g44, - a2[10]);
+    }
+    if (~ f18(n, y)) {
+        for (i = 0; i < 3; i++) {
+            if (a14[12]) {
+                for (i = 0; i < 89; i++) {
+                    st.hi -= y;
+                }
+            } else {
+                {
+                    p[1] = 805;
+                    st.hi = (n) <= ((short) x) * (g17);
+                }
+            }
+        }
+    } else {
+        for (i = 0; i < 34; i++) {
+            p[3] |= ((short) ((unsigned long) f20(st.hi, 545)));
+        }
+    }
+    if (a15[9] > 0xc5d3 == x) {
+        while (a3[11] ? st.lo : a8[0]) {
+            x += p[3];
+            n--;
+        }
+    } else {
+        {
+            switch (n) {
+            case 5:
+                p[1] -= ((int) a3[7]);
+                break;
+            default:
+                sp->count |= y >= 358 <= 589 >= 919;
+            }
+            a4[12] ^= a12[9] ? n : a4[4] ? 0xc29d <= 64 : st.lo ^ a9[1] <= 596 <= 0xf84d < x;
+        }
+    }
+    a2[6] += 198 + sp->lo >= ((int) ((unsigned long) g22));
+    {
+        switch (g38) {
+        case 2:
+            sp->count += n;
+            break;
+        default:
+            {
+                n -= f1(g38, a0[10]) ? st.lo || sp->count : 0xe57f >= n ^ 278 != n;
+                sp->count = - f0(a10[0], n) & 387 ^ 770 * p[2] ^ x;
+            }
+        }
+        a9[10] ^= ((short) ((short) (y)));
+    }
+    return ~ (sp->lo >= 0xd51f);
+}
+
+long fn_5(long x, long y, long n, long *p)
+{
+    st.hi += - x < n;
+    switch (n) {
+    case 7:
+        p[2] = a1[5];
+        break;
+    default:
+        st.hi -= ((x ^ 0xc2ea));
+    }
+    a4[1] ^= (0x37b9) != a4[4] < 0xe2d7 | 581 ? sp->lo : n && 17;
+    if (- 0xe8bd || 212 || 616) {
+        {
+            a7[3] -= (~ sp->count & g42);
+            x ^= 637 ^ 0x2202 * st.hi <= y & y;
+        }
+    } else {
+        switch (n) {
+        case 8:
+            sp->count += - 564 >= n ? g45 : n == g54;
+            break;
+        default:
+            g30 -= ~ 671 * 412 - n;
+        }
+    }
+    for (i = 0; i < 37; i++) {
+        switch (g55) {
+        case 0:
+            {
+                a2[15] ^= n ? 0xb1ed : 767 ? ~ st.lo : f24(464, sp->count) ? st.hi - n * p[1] : a4[7] > y;
+                st.hi = y;
+            }
+            break;
+        default:
+            switch (g21) {
+            case 7:
+                if (f16(sp->lo, p[2])) {
+                    st.hi ^= a6[14] | - a1[5] >= a3[2] + a12[4];
+                } else {
+                    sp->count += n;
+                }
+                break;
+            default:
+                if (0xd117 ? 480 : y ? 0x5c3 | y : st.lo && x) {
+                    p[0] += p[2];
+                } else {
+                    a4[2] = g21 ? sp->count : n + sp->count >= (f29(n, x));
+                }
+            }
+        }
+    }
+    {
+        n += y >= 0xc6bf * 702 + ((long) st.lo);
+        sp->count -= ((int) (g39 ^ sp->lo));
+    }
+    for (i = 0; i < 38; i++) {
+        g43 |= y;
+    }
+    if (f13(0x2405, 881)) {
+        sp->count += (0xf2d1 < st.lo < ((short) 836));
+    } else {
+        p[2] |= ! 0xe001 > 0x3cd5 > f23(254, 0xd7f);
+    }
+    return y == - ! 532;
+}
+
+long fn_6(long x, long y, long n, long *p)
+{
+    while (a10[14] > 0xec22) {
+        switch (y) {
+        case 8:
+            p[2] -= 0x995c ? ! (st.lo) : (a3[11] ? y : 0x3e45);
+            break;
+        default:
+            st.hi += - 0x729;
+        }
+        n--;
+    }
+    while (p[3] > sp->count) {
+        for (i = 0; i < 49; i++) {
+            p[3] = ((int) (600));
+        }
+        n--;
+    }
+    switch (n) {
+    case 1:
+        {
+            a12[9] ^= ((long) ! ~ a11[4]);
+            n ^= ~ x ? st.lo >= st.lo : sp->count << a7[3] ^ sp->count & a12[7] + (st.lo);
+        }
+        break;
+    default:
+        switch (y) {
+        case 2:
+            if (y | 488 ? ((long) 0xefbc) : st.lo) {
+                sp->count += (y < a4[3] < 0x98b0);
+            } else {
+                x = - - f5(g56, 0xcad1);
+            }
+            break;
+        default:
+            for (i = 0; i < 99; i++) {
+                st.hi -= a6[2];
+            }
+        }
+    }
+    sp->count += ((unsigned long) 0xba0a) <= n ? p[3] : x == - n;
+    switch (n) {
+    case 6:
+        st.hi += 712;
+        break;
+    default:
+        st.hi |= a0[14] <= a1[9] && (790) && (! n);
+    }
+    for (i = 0; i < 59; i++) {
+        a0[11] += a6[0];
+    }
+    return - 0x5d3c ? g46 > g52 : ((unsigned long) 655) == 950;
+}
+
+long fn_7(long x, long y, long n, long *p)
+{
+    if (g22 ? y >> 0x64c4 : a13[10] <= g21) {
+        p[3] ^= a12[4];
+    } else {
+        p[1] -= 303 > a1[4] >= 676;
+    }
+    for (i = 0; i < 24; i++) {
+        sp->count += ((int) (534));
+    }
+    while (((short) sp->count)) {
+        while (((unsigned long) x)) {
+            y -= 791;
+            n--;
+        }
+        n--;
+    }
+    while (a14[1]) {
+        g27 += y ? f31(y, a0[6]) : f9(g45, 0xd739);
+        n--;
+    }
+    switch (n) {
+    case 3:
+        a4[12] += ((long) st.hi);
+        break;
+    default:
+        {
+            a5[12] += ((unsigned long) n | st.lo >> a12[3]);
+            p[3] |= f28(sp->count, g19) ? a1[14] : - (0xc670);
+        }
+    }
+    while (a15[1]) {
+        if (((unsigned long) 0x1f77 >= a6[9])) {
+            st.hi -= ((unsigned long) sp->count != 838 >> x);
+        } else {
+            p[2] = (0xd230);
+        }
+        n--;
+    }
+    if (0x32b4) {
+        n ^= ! sp->lo - a1[3] ? 0xc6aa : n >> x;
+    } else {
+        p[2] ^= x < ~ y - 0xd9bf;
+    }
+    if (n) {
+        for (i = 0; i < 79; i++) {
+            switch (x) {
+            case 3:
+                switch (y) {
+                case 1:
+                    g10 |= sp->count ? p[1] : 656 ? ((int) g27) : ((long) sp->count) | 957 != n << a7[4];
+                    break;
+                default:
+                    a10[7] = a7[1] ^ ((short) ~ a8[6]);
+                }
+                break;
+            default:
+                a1[14] += ((short) ((unsigned long) 811));
+            }
+        }
+    } else {
+        {
+            for (i = 0; i < 3; i++) {
+                while (0xa15e << a0[5]) {
+                    st.hi += a4[10] + y ^ 0x816e >= 3 || 988 <= n;
+                    n--;
+                }
+            }
+            st.hi ^= x;
+        }
+    }
+    return y ? 0xe5e5 : 0xeb43 > sp->lo;
+}
+
+long fn_8(long x, long y, long n, long *p)
+{
+    n -= a5[15];
+    g19 += a6[8] < ! a1[0];
+    st.hi = (((short) 70));
+    {
+        a4[14] -= x;
+        g52 += - g59;
+    }
+    while (a7[12]) {
+        {
+            while (g3 && sp->lo) {
+                a3[5] |= ! f30(y, y);
+                n--;
+            }
+            p[1] ^= a11[2] > p[3] - f10(269, p[2]) | y - a2[11];
+        }
+        n--;
+    }
+    return (n);
+}
+
+long fn_9(long x, long y, long n, long *p)
+{
+    sp->count += f18(f10(g22, x), 0x9056 > x);
+    while (y ? a9[5] : 0x93be) {
+        a3[13] += a10[9] <= a14[2] + f5(y, a5[10]);
+        n--;
+    }
+    {
+        st.hi |= f12(x ^ n, f4(612, a3[3]));
+        st.hi ^= ((unsigned long) g38) <= 896 ? a14[12] : x ? x && st.lo : st.hi;
+    }
+    return f15(sp->lo, g38) != g28 != ((int) st.lo);
+}
+
+long fn_10(long x, long y, long n, long *p)
+{
+    if (971) {
+        for (i = 0; i < 23; i++) {
+            x ^= st.hi - 0x14d8 + y & x + st.lo;
+        }
+    } else {
+        while (y) {
+            sp->count ^= ~ a15[15];
+            n--;
+        }
+    }
+    if (sp->lo * 0xde54 >= 740) {
+        sp->count -= ((unsigned long) g47) >= 67 >> 0x1689 & ((unsigned long) 214);
+    } else {
+        for (i = 0; i < 41; i++) {
+            p[3] ^= 644;
+        }
+    }
+    for (i = 0; i < 54; i++) {
+        st.hi |= - g63 > ((long) n) <= (n) | g63;
+    }
+    for (i = 0; i < 7; i++) {
+        {
+            p[3] = 0x1a89;
+            sp->count |= ~ 0x2c2c >> 147 & n;
+        }
+    }
+    p[0] += ((short) ((short) x)) >> sp->lo > st.lo + g56;
+    n += (p[2] + y) == ((unsigned long) 214 > g41);
+    for (i = 0; i < 65; i++) {
+        st.hi += y > sp->lo == 508 ? n && sp->count : (g6);
+    }
+    while (- a7[10]) {
+        g45 += f27(x, y) >= ~ 0x8856 ? a9[4] : 912;
+        n--;
+    }
+    {
+        if (f8(0x4ce5, sp->lo)) {
+            p[2] ^= f23(g20, x);
+        } else {
+            sp->count ^= 219 << 162 ? 0xae07 : x >> y & y;
+        }
+        a13[8] = a5[6];
+    }
+    return f7(854, y) ? f25(a15[4], g54) : g42 | f0(826, y);
+}
+
+long fn_11(long x, long y, long n, long *p)
+{
+    switch (y) {
+    case 9:
+        st.hi |= a12[9] + 0x7aa;
+        break;
+    default:
+        sp->count -= 0xbb4d ? ((short) x << a5[4]) : st.hi;
+    }
+    if (x | a12[7] ? ~ y : st.hi) {
+        switch (y) {
+        case 1:
+            x += sp->lo * a3[5] ? 161 : x > sp->count && f20(0x7f6d, 0x1de2);
+            break;
+        default:
+            y |= 0x3d31;
+        }
+    } else {
+        n |= g40 + 712 ? y : st.hi ^ st.lo;
+    }
+    p[1] = 443 ? (a8[8] << x) : n;
+    switch (g34) {
+    case 9:
+        n = g49;
+        break;
+    default:
+        st.hi |= f17(629 & a13[8], n ? y : 938);
+    }
+    return (st.hi <= y == a1[7] ? 0x45c0 : 0x164e);
+}
+
+long fn_12(long x, long y, long n, long *p)
+{
+    while (337) {
+        a13[5] |= 0xc4b0 * g62 > ((unsigned long) 0x86b8) < sp->count;
+        n--;
+    }
+    {
+        sp->count += f27(a13[7], y);
+        p[0] = ((unsigned long) f20(a5[12], a3[7]));
+    }
+    a11[1] = ((int) 849 ^ x == 703);
+    return 0x12a4 >= f19(6, 0xa5dd);
+}
+
+long fn_13(long x, long y, long n, long *p)
+{
+    y ^= 0xa19b;
+    {
+        if (((int) y || n)) {
+            a7[1] += (((int) 187 ? 439 : p[1]));
+        } else {
+            a9[7] ^= f20(a4[4] ? n : 207, ((unsigned long) 85));
+        }
+        st.hi = (f23(n, a5[6]));
+    }
+    {
+        sp->count = ~ 0xcfe1 ? x : ((long) n) != ((long) n);
+        sp->count |= 0xf351;
+    }
+    {
+        for (i = 0; i < 70; i++) {
+            switch (g14) {
+            case 3:
+                x |= ! 0xae91 == g28 < a4[9];
+                break;
+            default:
+                switch (x) {
+                case 1:
+                    x = f2(st.hi < 0xd48a, - st.hi);
+                    break;
+                default:
+                    x += st.hi;
+                }
+            }
+        }
+        st.hi -= ((short) 764 ? 405 : a5[8] || st.hi >> n);
+    }
+    for (i = 0; i < 51; i++) {
+        if (! a0[0] ? y : a2[3]) {
+            sp->count -= 299;
+        } else {
+            st.hi = a13[10];
+        }
+    }
+    switch (n) {
+    case 9:
+        while (a15[1]) {
+            while (! g57) {
+                n ^= ((short) ! 0xfff1) > 153;
+                n--;
+            }
+            n--;
+        }
+        break;
+    default:
+        while (873 * 840) {
+            if (st.hi ^ sp->lo < 0xfd22) {
+                p[1] = g1;
+            } else {
+                st.hi -= 0x7c07;
+            }
+            n--;
+        }
+    }
+    p[1] -= ((short) ((int) 276)) < a7[10] <= 742;
+    if ((~ g54)) {
+        {
+            a7[12] -= ~ ((long) n) || n;
+            st.hi ^= (((long) (n)));
+        }
+    } else {
+        p[3] += - st.lo != a11[11] >> 687 != g0 + y ? 900 : x;
+    }
+    {
+        while (n <= g8) {
+            a5[13] ^= (n) & st.hi | a1[8] < f5(x, a1[8]);
+            n--;
+        }
+        p[0] ^= ((short) (a8[5]));
+    }
+    return (a3[10] <= n) - - 22;
+}
+
+long fn_14(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 47; i++) {
+        g44 |= x;
+    }
+    {
+        p[3] = (a0[12]);
+        x |= f24(y, 0x37c) ? sp->lo > x : (911) ? (- 141) : n == 695 ^ x + g58;
+    }
+    switch (g25) {
+    case 5:
+        switch (y) {
+        case 6:
+            a6[3] |= sp->lo;
+            break;
+        default:
+            a7[5] += f16(0xb2b7, sp->lo) >> sp->lo;
+        }
+        break;
+    default:
+        {
+            a1[9] -= (y) >= p[1] <= sp->count > 0xaa31 * 0xffd2 ? n : g7 + g42;
+            a4[7] = f30(st.lo, 783) | 3 ? 0xf462 : x << y;
+        }
+    }
+    while (0x93ec + st.hi) {
+        for (i = 0; i < 88; i++) {
+            while (0x96fc > x) {
+                if (f12(y, a6[8]) << g32) {
+                    st.hi ^= st.lo | a4[2] | 144 ^ a7[9] & f0(967, a13[14]);
+                } else {
+                    a10[15] ^= a5[14] >= x == 540 == (204);
+                }
+                n--;
+            }
+        }
+        n--;
+    }
+    return n < (x);
+}
+
+long fn_15(long x, long y, long n, long *p)
+{
+    {
+        switch (g8) {
+        case 7:
+            for (i = 0; i < 61; i++) {
+                p[0] |= (0x25b8);
+            }
+            break;
+        default:
+            while (st.hi > a14[15]) {
+                sp->count ^= p[2];
+                n--;
+            }
+        }
+        st.hi += ((int) a6[14]);
+    }
+    for (i = 0; i < 36; i++) {
+        y -= x || f16(a11[3], 793);
+    }
+    while (((long) y)) {
+        for (i = 0; i < 84; i++) {
+            {
+                a11[11] = sp->lo;
+                st.hi ^= f19(a4[3] != n, ~ 267);
+            }
+        }
+        n--;
+    }
+    st.hi ^= f7((y), x >= x);
+    return ((int) f24(216, y));
+}
+
+long fn_16(long x, long y, long n, long *p)
+{
+    switch (y) {
+    case 6:
+        for (i = 0; i < 71; i++) {
+            p[0] -= n ? y : 0x1182 ? g56 : f14(0x467e, y) << p[0];
+        }
+        break;
+    default:
+        {
+            while (g36) {
+                st.hi += g44 ? p[2] | n : y - - g41;
+                n--;
+            }
+            a11[6] |= 0x606b;
+        }
+    }
+    for (i = 0; i < 78; i++) {
+        switch (n) {
+        case 9:
+            sp->count = sp->lo;
+            break;
+        default:
+            st.hi = a9[5] > 897 <= n >> 0xffae - sp->count;
+        }
+    }
+    while (sp->count) {
+        if (x) {
+            st.hi ^= (x ? n : st.lo) > y;
+        } else {
+            sp->count = p[2] ^ 656 ? n == 0xe7d9 ? 0x2cd2 - g52 : n != 421 : (sp->count);
+        }
+        n--;
+    }
+    for (i = 0; i < 12; i++) {
+        {
+            for (i = 0; i < 48; i++) {
+                g54 ^= 0xc21f | a9[7] ? x : sp->lo || ! st.hi;
+            }
+            a4[15] |= ((short) x) ? f6(sp->lo, a14[0]) : ((long) (n));
+        }
+    }
+    return ((unsigned long) n);
+}
+
+long fn_17(long x, long y, long n, long *p)
+{
+    sp->count += sp->lo;
+    while (a14[3] * g58) {
+        y = a3[4] | g43 >= 0xdbbb | 993 << st.hi ^ - y;
+        n--;
+    }
+    for (i = 0; i < 44; i++) {
+        {
+            for (i = 0; i < 52; i++) {
+                st.hi = - 0x4fe3 <= ((long) x) >= x ? 0x84f8 : sp->count >> a0[6] <= 957;
+            }
+            p[0] -= ((unsigned long) f26(x, a11[15]) ? n | n : ((int) a8[9]));
+        }
+    }
+    p[1] = 938 + 0xc390 >= g18 << sp->count ? (0x9a83) || n : 418 * a6[5] - ((unsigned long) 0xf4e9);
+    return st.hi ? 0x6418 : sp->count * f20(n, 0x46a3) && 585 + n ? 0xaaa7 : y - n;
+}
+
+long fn_18(long x, long y, long n, long *p)
+{
+    sp->count += ((unsigned long) 0xbe85 << a13[3]) ? (- 0xeae9) : ! 522;
+    p[2] -= (- 0x9524) && n || a2[15] ? n : (0x4b36);
+    if (p[2]) {
+        switch (x) {
+        case 5:
+            a4[11] ^= 0xec01 >= sp->lo || a9[5] != - sp->lo;
+            break;
+        default:
+            p[0] -= (460) || 28 ? 0xb7e7 : a13[1] != st.lo ? a12[14] : g62 * f2(g6, 599);
+        }
+    } else {
+        while (0x7afd) {
+            n |= 540 - ((int) a9[10]) || ! x <= a6[13];
+            n--;
+        }
+    }
+    {
+        n |= x <= ((short) a12[0]) * - x;
+        y += f11(0x2556 <= 0x1097, 979);
+    }
+    switch (g4) {
+    case 6:
+        while (a6[1] - a5[13]) {
+            {
+                sp->count += f20(14, st.hi << sp->lo);
+                g14 -= st.lo ? (0x6ea8 * 0xeca) : 566 >= 455 & y;
+            }
+            n--;
+        }
+        break;
+    default:
+        while (a13[7]) {
+            p[2] -= f26(a10[13], g25) == ((short) g45);
+            n--;
+        }
+    }
+    a8[8] += ((short) a11[13]) != x ? 292 : a13[11] ? y || 0xe4ba | 21 >> a2[9] : g16 - g47 > (0x5489);
+    while (n != 0x4ac8) {
+        st.hi -= f25(sp->lo, a0[0] >> 0x8dd5);
+        n--;
+    }
+    y -= f30(p[0], a1[1]) * x;
+    {
+        st.hi += (sp->count != x ? ~ 493 : (0xe4c3));
+        a6[15] -= 969 ? x - a15[14] < p[0] : a6[8];
+    }
+    return ((int) 595 == 894 << a4[13] >= n);
+}
+
+long fn_19(long x, long y, long n, long *p)
+{
+    while (a12[3] == a11[9]) {
+        st.hi = 395 * a0[14] - x | g55 <= 0xe1b5;
+        n--;
+    }
+    while (! 192) {
+        p[0] |= ((unsigned long) - y) != f12(a3[13], n);
+        n--;
+    }
+    if (f5(a10[8], 102)) {
+        {
+            st.hi |= ((unsigned long) g57);
+            st.hi |= ~ y && 262;
+        }
+    } else {
+        while (473 ? 146 : 798) {
+            st.hi |= f8(y >> y, 0xd + a1[2]);
+            n--;
+        }
+    }
+    {
+        sp->count -= - ((long) x) - g6;
+        y |= f28(398 << 0xa8bd, a12[15] != 0xf365);
+    }
+    return a12[14] <= 0xf6cb >= y < (p[3]);
+}
+
+long fn_20(long x, long y, long n, long *p)
+{
+    st.hi ^= ~ f5(st.lo, y) & g39;
+    st.hi |= 515;
+    {
+        for (i = 0; i < 71; i++) {
+            g24 += (385) ? f13(a10[6], 0xf69) : 69 >= st.hi;
+        }
+        y |= 138 * y & 0xbf50 ? 549 : 0x1101 >> ((long) x >> a15[13]);
+    }
+    return a6[1] ? f26(0x1e0a, st.hi) : x - 0xc6ef >= ! sp->lo - 0xba22;
+}
+
+long fn_21(long x, long y, long n, long *p)
+{
+    n |= g38 * st.hi != ! n * ((short) (st.lo));
+    while (sp->count) {
+        if ((n & y)) {
+            st.hi = f28(- 365, f7(n, a12[1]));
+        } else {
+            x ^= f23((x), ((unsigned long) 0x86d8));
+        }
+        n--;
+    }
+    p[2] -= n;
+    while (240 < g63) {
+        switch (x) {
+        case 9:
+            switch (x) {
+            case 5:
+                if (a9[0]) {
+                    st.hi |= ((unsigned long) 829);
+                } else {
+                    st.hi ^= y;
+                }
+                break;
+            default:
+                y += f2(g34 < g60, a13[6] < x);
+            }
+            break;
+        default:
+            {
+                if ((769) - a12[13]) {
+                    a5[7] |= (185);
+                } else {
+                    a7[15] -= ((long) a14[7]) + (264) && a7[8];
+                }
+                p[2] ^= (sp->count) + f18(0x4c09, st.hi) < ((int) 55);
+            }
+        }
+        n--;
+    }
+    while ((0x9f67)) {
+        while (f6(511, 0xdadd)) {
+            while (f25(n, a4[14])) {
+                a3[13] |= g38 ^ f16(a15[12], g57) << ((short) n) || (x);
+                n--;
+            }
+            n--;
+        }
+        n--;
+    }
+    return 87;
+}
+
+long fn_22(long x, long y, long n, long *p)
+{
+    if (x ? a10[6] : a9[15] > f20(0x40a, x)) {
+        a14[13] -= n & p[3] ? a7[11] : 315 == x ? 0x610e : 0xb117;
+    } else {
+        st.hi += 0x5821;
+    }
+    p[0] ^= n;
+    if (889) {
+        {
+            g53 ^= - y << a3[12];
+            y = ((long) 0x8747) ? sp->count == ((int) 0x9456) : 0x3a42;
+        }
+    } else {
+        while (a12[3] != a15[2]) {
+            switch (x) {
+            case 8:
+                p[0] |= n;
+                break;
+            default:
+                g58 += f5((g49), (566));
+            }
+            n--;
+        }
+    }
+    p[1] ^= (((int) 0x845a) - g61);
+    y ^= y;
+    if (757) {
+        {
+            sp->count ^= ~ a12[3] ? st.hi : x << n;
+            p[0] -= 0xa923;
+        }
+    } else {
+        while (sp->lo) {
+            p[0] ^= f12(sp->count, st.lo) ? - 762 : st.lo * a8[0] <= a2[7];
+            n--;
+        }
+    }
+    switch (y) {
+    case 6:
+        for (i = 0; i < 38; i++) {
+            {
+                switch (x) {
+                case 0:
+                    sp->count |= y;
+                    break;
+                default:
+                    st.hi ^= st.lo ^ sp->lo;
+                }
+                sp->count += f8(a15[15], 0x314a) < 256;
+            }
+        }
+        break;
+    default:
+        st.hi |= ((short) 0x2978);
+    }
+    return n;
+}
+
+long fn_23(long x, long y, long n, long *p)
+{
+    g48 |= ((st.hi && x));
+    if (((y))) {
+        st.hi += 0xc2f8 > g4 ? 0x8612 || 612 : x < 799 || (x << 714);
+    } else {
+        sp->count -= x - a1[8] < g15 + x != f8(y, 0xeee6);
+    }
+    while (n ? 0xf89d : 754) {
+        {
+            if ((n) | y) {
+                {
+                    g32 -= f7(- st.lo, st.hi << st.hi);
+                    sp->count -= - 0x9919 > 0xc4a6;
+                }
+            } else {
+                if (f13(y, x)) {
+                    sp->count ^= - g9 & g27 & g62 == y >> sp->lo && sp->lo;
+                } else {
+                    x |= 0xbbd6;
+                }
+            }
+            p[1] -= f29(sp->lo ? x : x, - a7[9]);
+        }
+        n--;
+    }
+    while (590 != sp->lo) {
+        sp->count += 827 & f15(a1[0], 0x305c) != f22(st.lo, 0xa3db);
+        n--;
+    }
+    for (i = 0; i < 64; i++) {
+        while (a12[3]) {
+            sp->count ^= x & x + 854 * st.hi | ((unsigned long) p[0]) << 0xc514;
+            n--;
+        }
+    }
+    return 0x4a19 || f30(y, sp->count);
+}
+
+long fn_24(long x, long y, long n, long *p)
+{
+    switch (x) {
+    case 3:
+        {
+            st.hi ^= - ~ f18(a5[4], a9[11]);
+            x += 964;
+        }
+        break;
+    default:
+        switch (n) {
+        case 5:
+            st.hi |= ~ a11[4];
+            break;
+        default:
+            sp->count -= a3[0] ? f9(a1[3], p[2]) : ((short) f0(st.hi, sp->count));
+        }
+    }
+    while (x == 2) {
+        g32 -= ((unsigned long) ! f6(361, a6[7]));
+        n--;
+    }
+    p[3] += p[3] * (y >= st.lo);
+    switch (x) {
+    case 1:
+        sp->count = f13(((short) y), (a13[7]));
+        break;
+    default:
+        while (a4[11] ? 13 : a9[13]) {
+            switch (g31) {
+            case 1:
+                n = sp->lo;
+                break;
+            default:
+                g39 |= 430;
+            }
+            n--;
+        }
+    }
+    a12[10] += ((unsigned long) a1[9]) ^ ((long) x ? g13 : n);
+    sp->count ^= - 0xb2e2 & x ? g2 && sp->lo != n | 0x66a : f6(769, 0x9aa9) & f22(963, y);
+    if ((a4[0] * a3[14])) {
+        x -= 0xfafc;
+    } else {
+        st.hi ^= f13(a14[9], 652) << (f9(g40, x));
+    }
+    return 360;
+}
+
+long fn_25(long x, long y, long n, long *p)
+{
+    {
+        a4[14] = ((long) f9(0x3e0a, st.lo)) ? ~ (st.hi) : x >= y & 0x2d4 - st.lo;
+        st.hi += g35 >> f24(a5[5], a11[14]);
+    }
+    p[1] |= f23(0xfdcc >= 223, 0x3a85 ? 0x304d : n);
+    while (x) {
+        sp->count ^= 544;
+        n--;
+    }
+    st.hi |= ((int) 756) * f27(973, g43);
+    for (i = 0; i < 3; i++) {
+        {
+            {
+                st.hi += f14(0x87a7, sp->lo) - ! y < a11[0];
+                sp->count += 0x35f2 + 0x4000 * (a13[2]) ^ g39 || g41 | 0x13ba;
+            }
+            g41 |= (0x3462);
+        }
+    }
+    switch (n) {
+    case 6:
+        p[0] = sp->count & f10(n, sp->count);
+        break;
+    default:
+        y = ((((unsigned long) st.hi)));
+    }
+    return (y) * st.lo << 0x7ee1 << 0xbae2;
+}
+
+long fn_26(long x, long y, long n, long *p)
+{
+    st.hi -= 0x6515 | (y) ? a5[13] : ((unsigned long) a13[0]);
+    st.hi -= f17(y, g8) - (g39 != x);
+    n ^= ! ((unsigned long) f19(st.lo, 343));
+    a11[14] = n;
+    if (f19(sp->lo, g55)) {
+        if ((y) != g42 ? 498 : 0xfa) {
+            switch (g39) {
+            case 9:
+                st.hi |= (0x370b ? g27 : sp->count) >> ((long) x) || ! 0x2cdd;
+                break;
+            default:
+                y += (((int) 658 + a0[14]));
+            }
+        } else {
+            a3[12] += - x;
+        }
+    } else {
+        x = st.lo >> ! 0x88a2 >> 334;
+    }
+    {
+        if (f26(a7[9], a13[2])) {
+            n -= (st.lo & ((int) a8[3]));
+        } else {
+            g59 += g49 >> 339 != (0x298c) > f30(g62, n);
+        }
+        p[0] = y;
+    }
+    st.hi |= - - y << a2[13];
+    return ((int) p[2]) ? 0xcae8 : f29(y, x);
+}
+
+long fn_27(long x, long y, long n, long *p)
+{
+    g20 ^= n;
+    for (i = 0; i < 60; i++) {
+        switch (n) {
+        case 7:
+            {
+                p[2] -= ! 908 - sp->lo > x ? y : a9[1];
+                x ^= ((long) x);
+            }
+            break;
+        default:
+            if ((0x48a1 ^ x)) {
+                sp->count ^= (g42) && - 339 | f28(0xd5b4, 183);
+            } else {
+                p[1] ^= ! ! a12[7] && x;
+            }
+        }
+    }
+    switch (g46) {
+    case 9:
+        a12[0] = st.hi >= 410;
+        break;
+    default:
+        switch (g54) {
+        case 9:
+            {
+                g56 |= g2 < g46 ? n : 438 && 0x1793 != sp->count || 700 ^ g30;
+                p[0] = 0x34e8 * f6(sp->lo, a13[7]) > f2(p[0], a9[5]);
+            }
+            break;
+        default:
+            {
+                sp->count = g20 >= x;
+                p[3] -= ! st.hi > x != n - ((unsigned long) st.lo);
+            }
+        }
+    }
+    g56 = f19(289, a13[4]) <= g26 == a7[8] | a3[2];
+    p[3] |= ~ a0[15] ? a10[8] : sp->lo;
+    sp->count += y;
+    st.hi = 581;
+    g60 |= ~ x || 228 != sp->lo;
+    while ((g23)) {
+        switch (n) {
+        case 8:
+            for (i = 0; i < 48; i++) {
+                st.hi = ! a3[7] && 293 - a6[2] ? 0x872a : 0xa5a0 ? ((int) x) : 596 ? y : st.hi;
+            }
+            break;
+        default:
+            st.hi = x;
+        }
+        n--;
+    }
+    return ((long) n) ? ((long) x & 0xed12) : 0xfc01;
+}
+
+long fn_28(long x, long y, long n, long *p)
+{
+    st.hi -= f20(x, a5[5]) == f23(a2[9], a7[14]) || (st.hi);
+    a13[11] = f11(- 367, ((long) p[0]));
+    {
+        while (sp->count) {
+            switch (x) {
+            case 3:
+                while ((y)) {
+                    st.hi += g52 >> y && (y) & ~ (0x4946);
+                    n--;
+                }
+                break;
+            default:
+                if (f21(a0[10], sp->count)) {
+                    p[3] += (a3[5] >= st.lo) <= (y) != (p[3]);
+                } else {
+                    g19 ^= ! sp->lo * g27 ? ((unsigned long) x) ? y >> st.lo : a2[4] < st.lo : g28;
+                }
+            }
+            n--;
+        }
+        p[1] |= g61;
+    }
+    while ((st.lo)) {
+        p[0] += ! a5[11] | 831 * ~ a10[5];
+        n--;
+    }
+    a13[13] ^= x;
+    a12[3] = ((int) x ? a12[6] : g53 & ! n);
+    y |= (p[3] && g1 < 775);
+    sp->count ^= (st.hi ? 0x2d09 : g9 << a10[10]);
+    return f15(y, g11) ? 0x8cf8 || n : 0x5448 && a4[5] || f30(0xf5a8, n);
+}
+
+long fn_29(long x, long y, long n, long *p)
+{
+    {
+        if (((int) ((unsigned long) 0x18f6))) {
+            p[3] |= g51;
+        } else {
+            if (! a12[4] ? g42 : p[3]) {
+                p[0] += (((int) st.lo) ? ! y : p[1] & n);
+            } else {
+                g22 ^= ! 584 ? y : a4[4] ^ f3(sp->count, y);
+            }
+        }
+        st.hi |= f24(((long) sp->lo), 0x1c56 | n);
+    }
+    for (i = 0; i < 9; i++) {
+        sp->count ^= f0(x, a14[12]) && ~ a14[1];
+    }
+    sp->count -= ~ 0xbf17;
+    {
+        {
+            for (i = 0; i < 24; i++) {
+                a14[4] -= ! ! y * n;
+            }
+            a6[9] = st.hi;
+        }
+        x = 721 == ((int) 0x8def) >= a14[7];
+    }
+    sp->count ^= (st.lo) >> (x) * n || y ^ x;
+    for (i = 0; i < 50; i++) {
+        {
+            a11[2] = 0x5bda;
+            p[0] -= a2[1] * 691 >= (g41) < 124 & 0x896 - 0x4742;
+        }
+    }
+    return g63;
+}
+
+long fn_30(long x, long y, long n, long *p)
+{
+    a5[10] += f24(f0(g16, 0x7280), y);
+    {
+        sp->count ^= a12[15] == 489 - n << 0xe36 ? 405 : n << n;
+        p[0] -= n;
+    }
+    {
+        switch (x) {
+        case 2:
+            for (i = 0; i < 62; i++) {
+                n += ((long) y ? 72 : a1[15]) + (a5[9] << g16);
+            }
+            break;
+        default:
+            st.hi -= (a14[9] & a7[12]) ? y : x ? ((unsigned long) g8) : (st.hi);
+        }
+        a12[5] ^= (671);
+    }
+    st.hi += (n);
+    n ^= (((unsigned long) a13[8]));
+    while (((int) 610)) {
+        for (i = 0; i < 84; i++) {
+            p[3] += ((unsigned long) n ^ y) || 955;
+        }
+        n--;
+    }
+    y += ~ 0x992d << x * f9(g41, 0x662e);
+    if (y << st.hi ? 0xace8 : n) {
+        y ^= st.lo ? 0x7084 ? 370 : 351 : ((unsigned long) x) & g51 << y;
+    } else {
+        if (0x51ef != n | f19(290, g27)) {
+            while (0xe92c) {
+                for (i = 0; i < 10; i++) {
+                    p[3] -= 0x770d;
+                }
+                n--;
+            }
+        } else {
+            p[1] = (601 && a9[9] == g26 << n);
+        }
+    }
+    switch (y) {
+    case 6:
+        a12[15] |= ! ((int) ((long) 0x3057));
+        break;
+    default:
+        if (f17(x, g57) <= sp->lo) {
+            st.hi += ((int) f22(279, n) ? 235 : (a10[10]));
+        } else {
+            st.hi -= - st.hi;
+        }
+    }
+    p[0] |= ~ 421 >> ~ a5[13] && (((long) 0xc22c));
+    return f20(((short) 0x554e), n >> a5[0]);
+}
+
+long fn_31(long x, long y, long n, long *p)
+{
+    st.hi -= a11[10];
+    switch (x) {
+    case 4:
+        {
+            st.hi ^= y;
+            p[1] |= n;
+        }
+        break;
+    default:
+        y |= 129;
+    }
+    for (i = 0; i < 42; i++) {
+        switch (g62) {
+        case 3:
+            p[1] += ((int) - p[3] || n);
+            break;
+        default:
+            sp->count -= g54;
+        }
+    }
+    g31 -= p[0];
+    switch (g36) {
+    case 7:
+        if (p[2]) {
+            a14[12] += (~ y) ? p[1] : a3[14];
+        } else {
+            st.hi = (f16(n, a9[14]) >> 0x78ee >= a2[8]);
+        }
+        break;
+    default:
+        for (i = 0; i < 37; i++) {
+            p[3] |= f23(st.lo ? 0x6d15 : 0xe305, 0x6685);
+        }
+    }
+    return (a11[9] - n < x);
+}
+
+long fn_32(long x, long y, long n, long *p)
+{
+    {
+        for (i = 0; i < 59; i++) {
+            p[3] -= g34;
+        }
+        st.hi = (g30 * sp->count + 173 <= y);
+    }
+    st.hi |= n < a4[14] & ~ 0xd5a4 < 795;
+    n -= - f16(sp->lo, sp->count);
+    switch (g50) {
+    case 9:
+        sp->count = f20(124 ^ n, n);
+        break;
+    default:
+        g2 |= ((g37)) ? (0x8516 != sp->count) : sp->count != 687 == ((int) a6[15]);
+    }
+    while (637 > 350) {
+        if (st.hi > (a4[1])) {
+            n |= x;
+        } else {
+            p[0] -= a13[5] | 0xfbaa ^ y ^ 0x2ff2;
+        }
+        n--;
+    }
+    {
+        while (x + 0x638c) {
+            x ^= ((short) x >= 947 < f8(0x5d94, n));
+            n--;
+        }
+        a15[4] ^= (a1[13] != a10[5] | f30(x, 129));
+    }
+    return ! (sp->lo) - n;
+}
+
+long fn_33(long x, long y, long n, long *p)
+{
+    while (f8(g34, st.hi)) {
+        p[0] -= ((long) f20(g52, sp->count));
+        n--;
+    }
+    while (0x2606 <= a5[9]) {
+        if (sp->count) {
+            st.hi = st.hi ^ 0x8231 << sp->lo == a14[14] + ((short) n <= st.lo);
+        } else {
+            g57 = (f13(x, 904));
+        }
+        n--;
+    }
+    {
+        for (i = 0; i < 44; i++) {
+            g5 = ((long) f23(302, a0[7]));
+        }
+        a15[4] += n;
+    }
+    n |= 863 == ((int) a2[9]) <= (66 <= 0x2fef);
+    {
+        p[0] += (((short) n << 576));
+        a0[14] = 84;
+    }
+    switch (y) {
+    case 5:
+        for (i = 0; i < 54; i++) {
+            {
+                sp->count |= ((unsigned long) 0x48c);
+                st.hi += 42 >= p[0] - (a5[6]) - f8(g59, a11[4]) - p[0];
+            }
+        }
+        break;
+    default:
+        while (- 0x2db7) {
+            x += y >> st.hi & g24 >= 0x591a ? x : ((int) st.lo);
+            n--;
+        }
+    }
+    return a9[3];
+}
+
+long fn_34(long x, long y, long n, long *p)
+{
+    switch (y) {
+    case 9:
+        a14[8] |= ((long) f24(245, 645));
+        break;
+    default:
+        st.hi = g31;
+    }
+    for (i = 0; i < 92; i++) {
+        {
+            {
+                {
+                    p[0] = st.lo;
+                    st.hi ^= (0xc459) > f7(0x2f1a, 0xeae9) - ! 0x62f8 || (x);
+                }
+                y ^= ((short) 160);
+            }
+            a11[8] = 0xbc52 > 879;
+        }
+    }
+    switch (x) {
+    case 9:
+        y += y << 665 + 363 >> g10 || a4[6] ^ ((int) 0x289a);
+        break;
+    default:
+        while (f23(a14[3], 0xa5ce)) {
+            sp->count = f6(g32, p[1]) ? - a13[13] : ~ x ? ((long) st.hi + n) : st.lo != n != a10[14];
+            n--;
+        }
+    }
+    {
+        for (i = 0; i < 48; i++) {
+            a12[8] |= 908;
+        }
+        p[3] -= ((long) f24(a6[11], 0x78e4) >> a4[6] != x);
+    }
+    while (589 >= p[3]) {
+        for (i = 0; i < 28; i++) {
+            st.hi ^= 0x6d38 & - g42 >= ~ sp->count <= a4[11] >= 0x4255;
+        }
+        n--;
+    }
+    while (0x62f5 + st.hi) {
+        while (((long) n)) {
+            sp->count |= ((long) (f7(n, a3[0])));
+            n--;
+        }
+        n--;
+    }
+    for (i = 0; i < 63; i++) {
+        switch (y) {
+        case 1:
+            x |= ! f18(g10, a11[6]) && ((long) n) + (x);
+            break;
+        default:
+            sp->count = sp->lo < f13(x, g35);
+        }
+    }
+    if (x || st.hi << ((short) 0x74c4)) {
+        sp->count -= ((long) sp->lo);
+    } else {
+        while (f16(a13[12], 585)) {
+            {
+                if ((((int) 32))) {
+                    p[0] = a4[13];
+                } else {
+                    g59 += 746 > sp->count ? 563 : 0xa1d != (~ a3[14]);
+                }
+                sp->count += ((short) a4[3] ? a11[11] : 0x9ed6) != a15[0];
+            }
+            n--;
+        }
+    }
+    for (i = 0; i < 2; i++) {
+        n -= 625;
+    }
+    return ((unsigned long) sp->count) << ((int) 0x8635) ? ((unsigned long) 92) : a0[10];
+}
+
+long fn_35(long x, long y, long n, long *p)
+{
+    if (((short) x) << y) {
+        p[0] ^= ! x < n * ((int) a13[2]);
+    } else {
+        n ^= 0xc623;
+    }
+    for (i = 0; i < 16; i++) {
+        switch (n) {
+        case 4:
+            if (220) {
+                sp->count = g5;
+            } else {
+                p[3] -= f7(610, g29) ^ (n) <= (y) <= 0x5af2 - 320;
+            }
+            break;
+        default:
+            {
+                a10[1] -= (y && a7[7] >> a11[8]);
+                p[0] ^= (a13[3]) >> (582) << ((unsigned long) x);
+            }
+        }
+    }
+    {
+        while (a8[2] ? 135 : 0x44fe) {
+            {
+                p[2] |= (((short) f5(182, 0x3908)));
+                sp->count += f24(96, x) < ! x ? n : 650;
+            }
+            n--;
+        }
+        p[2] -= ((unsigned long) - a3[7]) >= 960;
+    }
+    return ((sp->count) <= (440));
+}
+
+long fn_36(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 34; i++) {
+        st.hi |= (- x && 0xd318);
+    }
+    p[2] |= g3 == f1(984, n) || p[2];
+    if (a0[15]) {
+        a12[3] -= - a5[1] > sp->count != 0xdf94 ? ((long) f26(st.hi, a1[12])) : x;
+    } else {
+        for (i = 0; i < 19; i++) {
+            if (~ y ? 665 : sp->lo) {
+                sp->count -= 0x65b0 || 486 >= ((long) st.hi) ? 609 : (a14[3]);
+            } else {
+                p[0] += n;
+            }
+        }
+    }
+    return 0x8668 >> sp->lo - 0x764d == 779;
+}
+
+long fn_37(long x, long y, long n, long *p)
+{
+    while (610) {
+        st.hi += y - n <= st.lo <= g45 ? f24(y, sp->count) : y == 915 < sp->lo;
+        n--;
+    }
+    while (0x26bc) {
+        st.hi += (f24(915, a15[6])) ? sp->count : ((int) y >= a3[11]);
+        n--;
+    }
+    while (a3[11] < 983) {
+        sp->count += ((unsigned long) p[2]) >= ((unsigned long) n);
+        n--;
+    }
+    {
+        while (a9[1]) {
+            switch (y) {
+            case 0:
+                n += 0xd069;
+                break;
+            default:
+                a2[11] += 83 >> ((unsigned long) 776 ? g18 : 0x767d);
+            }
+            n--;
+        }
+        sp->count = ((short) x) || ((int) y) ? sp->count > y : p[0];
+    }
+    a2[15] ^= (x >> 0x1af2) ^ f13(y, sp->lo);
+    a13[14] -= a1[1];
+    return (443) >= x ? f20(p[0], y) : ~ ((unsigned long) 770);
+}
+
+long fn_38(long x, long y, long n, long *p)
+{
+    sp->count = x << x >= g19 & ((unsigned long) f24(907, x));
+    {
+        g42 |= ((long) ~ a14[3]);
+        a7[9] += (((unsigned long) 0x61d3 | 845));
+    }
+    for (i = 0; i < 48; i++) {
+        switch (g22) {
+        case 6:
+            for (i = 0; i < 76; i++) {
+                y ^= f11(n, 796 || 0x1427);
+            }
+            break;
+        default:
+            for (i = 0; i < 36; i++) {
+                for (i = 0; i < 64; i++) {
+                    st.hi -= n;
+                }
+            }
+        }
+    }
+    return (f14(0x34fe, sp->count)) - f14(a13[11], 0x2b5d);
+}
+
+long fn_39(long x, long y, long n, long *p)
+{
+    switch (y) {
+    case 0:
+        for (i = 0; i < 5; i++) {
+            p[2] |= 954 <= a11[12] & a7[5] >= a10[13] < ~ 0xb51a;
+        }
+        break;
+    default:
+        p[0] = f1(0x5183, st.hi);
+    }
+    switch (n) {
+    case 7:
+        switch (y) {
+        case 3:
+            if (f1(y, 429)) {
+                y |= f2(588 ? a13[2] : 0xafe9, ~ a9[10]);
+            } else {
+                a5[5] = ((long) st.hi * st.lo) << y;
+            }
+            break;
+        default:
+            {
+                sp->count |= ((388)) - (551 < 480);
+                sp->count = 0x8489;
+            }
+        }
+        break;
+    default:
+        st.hi = n ^ f16(g25, p[3]) + g48 && g46;
+    }
+    a5[2] += (st.lo == g53 < st.lo);
+    if ((x * 0x8d00)) {
+        for (i = 0; i < 45; i++) {
+            a7[11] -= 0xb755 > g25 <= 0x575c * sp->lo - y | 0xeb22 * y;
+        }
+    } else {
+        {
+            st.hi -= f16((0xf3cb), (0x750));
+            st.hi ^= 0x9475;
+        }
+    }
+    p[2] ^= x << x * y ? f23(0x52ac, st.lo) : ((int) st.lo);
+    sp->count += (0xc867) | (228) ? ~ g37 >> x : ~ n;
+    if ((! st.hi)) {
+        n -= p[2];
+    } else {
+        n += sp->lo;
+    }
+    p[2] |= a13[0] & (x << n);
+    {
+        n = f10(a10[0] > a10[8], ((long) y));
+        n |= ~ 0xc115;
+    }
+    {
+        sp->count ^= (y) == f26(697, 903) - f17(g7, 0x616b) <= 0xd19 < a3[12];
+        n |= ~ f18(y, g35) ^ - ((short) n);
+    }
+    return ! f22(st.lo, 64);
+}
+
+long fn_40(long x, long y, long n, long *p)
+{
+    n |= a12[0];
+    for (i = 0; i < 61; i++) {
+        st.hi ^= f9(a3[3] <= g32, a8[15]);
+    }
+    switch (x) {
+    case 7:
+        st.hi += y;
+        break;
+    default:
+        a7[4] ^= (0x227c >> x ^ n * 532);
+    }
+    {
+        while (250) {
+            a4[15] += st.lo ? n : 925 >> 0xd105 || f19(925, n);
+            n--;
+        }
+        n -= st.hi;
+    }
+    x ^= (f13(764, p[1]));
+    y -= - - 679;
+    if (f16(0x1978, a5[6])) {
+        switch (y) {
+        case 9:
+            x = 353;
+            break;
+        default:
+            st.hi |= sp->lo;
+        }
+    } else {
+        p[1] -= ((int) ((int) a7[0]) & 229 >> y);
+    }
+    a7[4] = a3[4] && f19(n, n);
+    return x > ((a9[8]));
+}
+
+long fn_41(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 70; i++) {
+        g16 = n;
+    }
+    while (438) {
+        while (g24 << sp->count) {
+            if (f21(0x482b, n)) {
+                sp->count = f16(a13[11] << x, st.lo | 0xec5f);
+            } else {
+                {
+                    st.hi -= ((short) a1[0]) ? - a15[14] : 0x2410 * st.lo ? f28(n, sp->count) : (g15 | x);
+                    a3[13] ^= ((long) 0x8127 < a1[6]) & (st.hi > x);
+                }
+            }
+            n--;
+        }
+        n--;
+    }
+    for (i = 0; i < 55; i++) {
+        switch (x) {
+        case 0:
+            switch (x) {
+            case 0:
+                switch (n) {
+                case 1:
+                    a5[10] -= n;
+                    break;
+                default:
+                    st.hi = ~ sp->lo < 561;
+                }
+                break;
+            default:
+                a2[5] ^= 779;
+            }
+            break;
+        default:
+            while (a3[0] == 505) {
+                {
+                    st.hi ^= a14[8] != a4[10] || f22(y, sp->count) == x;
+                    st.hi |= - 0xd0c2 != n ? a4[4] : 0x2d4 <= f4(0x8234, 0x2967);
+                }
+                n--;
+            }
+        }
+    }
+    for (i = 0; i < 98; i++) {
+        if (y && 0xd2fb < n) {
+            n = ! g2;
+        } else {
+            n = f19(a14[3], a12[13]) ^ x || (0xbca5) && ((long) 0xa920);
+        }
+    }
+    switch (n) {
+    case 6:
+        x = ((long) 0xc3ae ? a8[15] : p[3] ? 210 | a10[6] : n ? 0xd002 : 891);
+        break;
+    default:
+        n += f18(sp->lo, 0x262e) | 883 * g55 + n;
+    }
+    while (f7(0x5abf, p[1])) {
+        while (f28(0x5e6d, x)) {
+            a11[15] ^= 0x62ee;
+            n--;
+        }
+        n--;
+    }
+    switch (x) {
+    case 7:
+        for (i = 0; i < 99; i++) {
+            sp->count -= ! n;
+        }
+        break;
+    default:
+        x += - x && 136 ^ 313 + a6[4];
+    }
+    for (i = 0; i < 36; i++) {
+        if (f22(p[1], a12[7]) <= sp->count ? st.hi : 0x1097) {
+            st.hi -= (x);
+        } else {
+            a12[9] ^= x;
+        }
+    }
+    {
+        switch (g1) {
+        case 7:
+            while (898) {
+                p[3] ^= ((short) 198 ^ 0x6856 != n);
+                n--;
+            }
+            break;
+        default:
+            switch (y) {
+            case 0:
+                p[1] -= a8[7] || a7[9];
+                break;
+            default:
+                st.hi -= a1[3];
+            }
+        }
+        x |= a4[9];
+    }
+    return st.hi & g59 || ((long) y);
+}
+
+long fn_42(long x, long y, long n, long *p)
+{
+    switch (g23) {
+    case 5:
+        if (0x7c44) {
+            st.hi = f21(a15[6], 0xe13a) <= f28(g32, a10[5]);
+        } else {
+            p[2] |= 781;
+        }
+        break;
+    default:
+        if (sp->lo == sp->lo >= sp->lo) {
+            p[2] += g34;
+        } else {
+            st.hi -= ((int) y) ? a0[0] < 313 : st.hi | 0x45a6 == a5[4];
+        }
+    }
+    while (0x309e) {
+        {
+            sp->count = (sp->lo >> 738 ^ 369 * a11[13]);
+            x -= a10[13] && sp->lo >> ((unsigned long) a12[10]) ? (! a12[4]) : f27(sp->count, 610);
+        }
+        n--;
+    }
+    {
+        sp->count ^= a11[13] << 757 >= 0x15de < n << a2[11];
+        x |= x;
+    }
+    return ((short) x) || g56 - a1[2] | y;
+}
+
+long fn_43(long x, long y, long n, long *p)
+{
+    switch (y) {
+    case 7:
+        {
+            if (f19(207, y) || sp->lo | sp->count) {
+                n ^= a4[4];
+            } else {
+                g14 ^= p[3] || a0[2] && x < 0x41a2 | a14[1];
+            }
+            a11[0] = sp->count;
+        }
+        break;
+    default:
+        for (i = 0; i < 27; i++) {
+            a13[0] ^= f13(((unsigned long) 0xa3ee), ! p[3]);
+        }
+    }
+    {
+        n = (g20) && (sp->lo < n);
+        x += ((short) 0xd554);
+    }
+    st.hi ^= n & st.hi;
+    switch (x) {
+    case 6:
+        {
+            st.hi += g26 <= y ? 0x5fd0 + sp->lo : (41) >> ((short) sp->count) >> (0x33cb);
+            y += f4(- y, f12(781, 0x6543));
+        }
+        break;
+    default:
+        a7[6] ^= ((int) p[1]);
+    }
+    x = 566;
+    if (g50) {
+        if (((int) (g13))) {
+            a0[13] ^= g60;
+        } else {
+            st.hi = ((unsigned long) x >= st.hi <= a12[6] || x);
+        }
+    } else {
+        while (x <= g39) {
+            p[2] -= (sp->lo != a5[12] <= g17 >> sp->count);
+            n--;
+        }
+    }
+    a5[0] = - ((short) sp->lo) >> ((long) 214);
+    return 172;
+}
+
+long fn_44(long x, long y, long n, long *p)
+{
+    while (0x493b != x) {
+        for (i = 0; i < 96; i++) {
+            y |= g23 >> ((int) n) - (n);
+        }
+        n--;
+    }
+    while (a5[0] | 658) {
+        {
+            while (0x9fd4 || y) {
+                if (f8(p[0], y) ? st.lo & st.hi : 0x806c >= 752) {
+                    y -= (y || 624) == 0xfa33;
+                } else {
+                    a2[1] = f21(a7[14] * n, ! n);
+                }
+                n--;
+            }
+            p[0] ^= (- sp->lo > g16);
+        }
+        n--;
+    }
+    switch (n) {
+    case 4:
+        {
+            st.hi |= (270);
+            st.hi |= f3(x, g3) && 915 | a8[8] > f22(n, 0x570);
+        }
+        break;
+    default:
+        a3[12] = ((long) a6[10]);
+    }
+    switch (x) {
+    case 7:
+        st.hi = ! f30(575, 0x5e5a);
+        break;
+    default:
+        x |= 812 <= - 576 != sp->lo;
+    }
+    st.hi += x < a3[3] * x == f1(g28, a15[0]);
+    for (i = 0; i < 74; i++) {
+        g17 += sp->lo;
+    }
+    a14[8] ^= f2(f17(0x6386, sp->count), (g56));
+    while (~ 0x3228) {
+        p[1] -= ((long) 0x7b4b ? ((long) 688) : ~ g30);
+        n--;
+    }
+    {
+        for (i = 0; i < 85; i++) {
+            for (i = 0; i < 59; i++) {
+                while (f18(a0[13], g22)) {
+                    sp->count = ~ a14[11] ? f3(a9[6], st.hi) : st.hi * 630 | f22(g49, n) << st.lo ? 468 : a9[5];
+                    n--;
+                }
+            }
+        }
+        st.hi -= (f21(986, x) ^ ((int) g13));
+    }
+    return ((int) f8(a5[10], 807)) ^ - a12[9];
+}
+
+long fn_45(long x, long y, long n, long *p)
+{
+    a1[8] -= (625 * 0x469a) > (g52 > 843);
+    switch (g34) {
+    case 5:
+        st.hi = 0x7cfb ? (~ 447) : st.lo << a2[13] ? f19(0xf56, 0x65d3) : 179 || a13[3];
+        break;
+    default:
+        p[1] -= sp->lo;
+    }
+    st.hi -= st.lo;
+    return - g27 >> 59;
+}
+
+long fn_46(long x, long y, long n, long *p)
+{
+    st.hi = (f1(st.hi, a2[7]) && y * 0x48ae);
+    switch (y) {
+    case 0:
+        n |= (a9[15]) ? ~ f12(x, st.lo) : sp->lo;
+        break;
+    default:
+        st.hi -= a3[8] != (g30) ^ a15[3] >= g4 && ((unsigned long) 0xd8f8);
+    }
+    st.hi -= 0x38ac;
+    switch (x) {
+    case 9:
+        if (f16(sp->count, a5[3])) {
+            for (i = 0; i < 15; i++) {
+                y += (0x3273) && ((short) 0xa83b ? a14[14] : sp->count);
+            }
+        } else {
+            if (y >= a2[1]) {
+                x -= a15[3];
+            } else {
+                n |= 0xcfe7 ^ 0x171 ? sp->count : n >= st.hi;
+            }
+        }
+        break;
+    default:
+        for (i = 0; i < 97; i++) {
+            for (i = 0; i < 8; i++) {
+                a15[1] |= ((int) ((short) n)) > st.lo;
+            }
+        }
+    }
+    {
+        switch (n) {
+        case 1:
+            p[1] += (g28) * g52 ? st.lo : sp->count ? 370 ? y : 0x9974 : n * ((int) n);
+            break;
+        default:
+            sp->count -= st.hi;
+        }
+        sp->count ^= x;
+    }
+    if (0x6c7c & y) {
+        a15[12] -= (((short) a5[0] ? 804 : st.lo));
+    } else {
+        sp->count -= (p[3]) <= ~ n || f15(x, n);
+    }
+    {
+        {
+            st.hi = a3[11] > st.hi ? 0x33dd : sp->lo ? a0[9] ? sp->lo : a5[10] ? 29 && p[0] : - 0xf7cd : (p[0]) & f28(0x328c, 79);
+            st.hi += g24 || n ? x >> st.lo : n <= 0xbee2 ? 389 : ((int) sp->lo);
+        }
+        p[0] += (a12[4]);
+    }
+    return ((long) a14[14]);
+}
+
+long fn_47(long x, long y, long n, long *p)
+{
+    a9[3] |= - f12(n, a7[3]) | - 965 | a10[1];
+    {
+        p[0] |= - ! 652 - 477 || 282 ? x + 0xcb00 : g13;
+        p[1] -= (815);
+    }
+    {
+        while (y || 285) {
+            switch (x) {
+            case 2:
+                a7[1] |= 102;
+                break;
+            default:
+                g35 ^= f19(0x5d0c - a5[5], - st.lo);
+            }
+            n--;
+        }
+        a5[12] |= 0xb83e;
+    }
+    switch (x) {
+    case 6:
+        {
+            g40 += 90 & n == n ? p[1] == st.lo : ~ g41 & x;
+            sp->count -= (a11[2] + x <= 0x9a7e);
+        }
+        break;
+    default:
+        while (st.lo << x) {
+            g6 |= - n - y + st.lo;
+            n--;
+        }
+    }
+    if (973 ? 0xbeb6 : 0x9d44 >= ((long) y)) {
+        while (((long) n)) {
+            for (i = 0; i < 68; i++) {
+                p[1] = st.lo & n << 0x3ef8 < 0xdac & a13[0] + x;
+            }
+            n--;
+        }
+    } else {
+        for (i = 0; i < 95; i++) {
+            for (i = 0; i < 1; i++) {
+                sp->count |= ~ ((0x3042));
+            }
+        }
+    }
+    if (((int) g46) != n) {
+        a12[15] = (p[3]);
+    } else {
+        while ((sp->lo)) {
+            sp->count |= 785 <= x || a8[9] || y >> ((long) y | 535);
+            n--;
+        }
+    }
+    if (((unsigned long) st.lo) ? f17(x, a9[14]) : st.lo) {
+        a3[5] ^= 0xef18;
+    } else {
+        switch (y) {
+        case 5:
+            {
+                sp->count ^= ((unsigned long) a10[13]);
+                y -= st.lo;
+            }
+            break;
+        default:
+            x += a5[13];
+        }
+    }
+    {
+        a4[15] -= y;
+        n += (755) >= st.lo <= g51 < ((unsigned long) g42 << a1[13]);
+    }
+    st.hi ^= f24((x), 450 <= 995);
+    return a2[5];
+}
+
+long fn_48(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 99; i++) {
+        a8[6] ^= (! 0xc8db + sp->lo);
+    }
+    while (403) {
+        st.hi -= a12[1];
+        n--;
+    }
+    a0[8] = - ((short) st.hi >> a13[7]);
+    if (((long) 727) && f23(n, 0x48f9)) {
+        p[2] += f1(0x58ce > 847, 89);
+    } else {
+        a3[10] -= f8(sp->lo, a6[10]) >> ~ y < f13(sp->count, 0x1e45);
+    }
+    if (588) {
+        {
+            {
+                while (553 << g8) {
+                    st.hi += ((long) ~ 157);
+                    n--;
+                }
+                st.hi -= f7(- sp->lo, a9[11] && st.lo);
+            }
+            st.hi -= (3) >= n >> n > 0x1669;
+        }
+    } else {
+        switch (y) {
+        case 3:
+            x -= ~ n & a7[1] < 872;
+            break;
+        default:
+            n -= ((short) y ^ a12[11]) ? ! x || y : y;
+        }
+    }
+    return 0x1612;
+}
+
+long fn_49(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 39; i++) {
+        st.hi |= a10[5];
+    }
+    p[0] -= 720 > g38 != ! a3[8];
+    while (x) {
+        switch (g35) {
+        case 6:
+            sp->count |= ((short) a4[8] + x) ? f29(p[0], 387) + p[1] ? a2[15] : 594 : 83;
+            break;
+        default:
+            sp->count -= ((int) f13(x, g32) || 0x73f7);
+        }
+        n--;
+    }
+    n = a7[10] >= (546);
+    for (i = 0; i < 6; i++) {
+        while (509 + y) {
+            a1[9] -= 938;
+            n--;
+        }
+    }
+    return (a1[9] || g27 >= x ? 0xcba : st.lo);
+}
+
+long fn_50(long x, long y, long n, long *p)
+{
+    switch (x) {
+    case 8:
+        a2[1] ^= ~ f1(a1[14], a6[10]);
+        break;
+    default:
+        p[3] += 328 == x << x < 0x478e ? 901 + 39 < a6[9] : f8(0xba0c, 0xc00);
+    }
+    if (- (st.lo)) {
+        sp->count += st.lo || f0(391, g33);
+    } else {
+        st.hi += sp->count;
+    }
+    switch (y) {
+    case 2:
+        while (p[0]) {
+            p[2] = ~ a6[1];
+            n--;
+        }
+        break;
+    default:
+        while (114) {
+            sp->count |= (0x8d49);
+            n--;
+        }
+    }
+    return g38 >= x - y != 0x70a5;
+}
+
+long fn_51(long x, long y, long n, long *p)
+{
+    {
+        {
+            st.hi = p[0];
+            st.hi = 0x224e;
+        }
+        p[2] |= (f21(0x74a0, 0x568));
+    }
+    switch (n) {
+    case 6:
+        while (y >> st.lo) {
+            a12[3] ^= ((unsigned long) 300) >= ~ 0xdc37 << g26;
+            n--;
+        }
+        break;
+    default:
+        while (n || st.hi) {
+            a11[9] = sp->lo & 0xb97c & ((int) g45) ? a5[11] : f24(285, p[2]) << ((int) x);
+            n--;
+        }
+    }
+    {
+        while (((unsigned long) n)) {
+            sp->count -= f12(330, 323);
+            n--;
+        }
+        st.hi = a7[10];
+    }
+    if ((((long) y))) {
+        sp->count |= ((unsigned long) f15(x, n)) + a14[0];
+    } else {
+        switch (g11) {
+        case 5:
+            for (i = 0; i < 40; i++) {
+                a10[14] += x;
+            }
+            break;
+        default:
+            if (sp->lo * 0x9318 + 0xbd82) {
+                a11[12] -= ((short) 0xf34d ? ((long) a3[8]) : ((short) x));
+            } else {
+                {
+                    sp->count -= (((int) n)) <= a14[7] == g47 ^ n > 908;
+                    p[0] ^= n < n ^ f15(179, y) << sp->lo != a15[7] & 272;
+                }
+            }
+        }
+    }
+    if (a6[0]) {
+        if (p[2]) {
+            sp->count ^= g16;
+        } else {
+            x |= 0x1c95 >> f26(x, n);
+        }
+    } else {
+        for (i = 0; i < 11; i++) {
+            st.hi -= 383 != n ? sp->count : sp->lo && ~ 0x9c1e;
+        }
+    }
+    for (i = 0; i < 42; i++) {
+        switch (g37) {
+        case 1:
+            if (st.hi) {
+                a11[3] ^= x;
+            } else {
+                st.hi ^= f12(x, sp->count) ? (a12[9]) : y ? x : a15[7] || p[0] ? a15[11] : a2[2] || g0 < sp->lo;
+            }
+            break;
+        default:
+            sp->count += f25(n >> sp->count, y ? x : y);
+        }
+    }
+    return ((unsigned long) ((short) f9(x, 0x1f29)));
+}
+
+long fn_52(long x, long y, long n, long *p)
+{
+    n |= ((int) ! ((unsigned long) 0xe940));
+    {
+        if (x >= x <= a13[14] | a7[15]) {
+            while (a5[12] + a4[5]) {
+                p[3] -= ! st.hi;
+                n--;
+            }
+        } else {
+            while (x) {
+                a14[0] = 509 * g7 && f22(a7[15], 0x9c46) <= ((short) (a3[14]));
+                n--;
+            }
+        }
+        x -= (0xeb5f) ? a9[1] : (0x8140 == st.hi);
+    }
+    p[1] -= ~ 922 >> 0xa568 << n <= y;
+    switch (x) {
+    case 1:
+        if (~ y >= g37 && 0x938c) {
+            n += a12[11];
+        } else {
+            st.hi |= (p[1]);
+        }
+        break;
+    default:
+        n -= 0x96e4;
+    }
+    {
+        st.hi -= y;
+        st.hi = a8[10];
+    }
+    switch (n) {
+    case 6:
+        a15[7] ^= f28(x == sp->lo, sp->lo);
+        break;
+    default:
+        st.hi += g24;
+    }
+    {
+        sp->count -= f24(! a5[13], (g39));
+        st.hi ^= (f25(a1[0], x));
+    }
+    return f0(0x3fc9, 177) < x;
+}
+
+long fn_53(long x, long y, long n, long *p)
+{
+    {
+        for (i = 0; i < 87; i++) {
+            p[3] += a13[5];
+        }
+        st.hi += n;
+    }
+    a15[10] ^= ~ y && x == 708 >> f4(179, n);
+    {
+        sp->count |= (sp->lo) & st.hi;
+        a4[9] -= ((a15[5]) != 243 ^ st.lo);
+    }
+    if (0xd95e) {
+        p[0] += (sp->count) < p[2] ^ a10[8] ? 884 ^ y : st.hi;
+    } else {
+        x ^= f26(a14[7], 855) ? x * 0x249f : (n) && a1[2];
+    }
+    st.hi = (21);
+    sp->count = a5[14] + g15 || - a11[10];
+    {
+        if (a6[8]) {
+            p[3] ^= ((long) n == sp->lo & a15[11] * n);
+        } else {
+            a13[1] -= f13(21, 0xcd9a) ^ g42;
+        }
+        sp->count ^= f19(a5[2], a11[0]);
+    }
+    for (i = 0; i < 16; i++) {
+        n |= x;
+    }
+    return g54;
+}
+
+long fn_54(long x, long y, long n, long *p)
+{
+    a11[8] ^= f28(0xb2d5 << 368, ! y);
+    for (i = 0; i < 32; i++) {
+        switch (x) {
+        case 6:
+            for (i = 0; i < 39; i++) {
+                while (f16(58, y)) {
+                    sp->count |= g10;
+                    n--;
+                }
+            }
+            break;
+        default:
+            for (i = 0; i < 31; i++) {
+                while (((int) 0x14f3)) {
+                    n = a9[8] * ((int) sp->lo != y);
+                    n--;
+                }
+            }
+        }
+    }
+    {
+        for (i = 0; i < 39; i++) {
+            st.hi |= 0xf424;
+        }
+        a7[10] -= 0x890f;
+    }
+    sp->count |= 0x9c10;
+    return a0[14];
+}
+
+long fn_55(long x, long y, long n, long *p)
+{
+    while (f23(sp->lo, sp->count)) {
+        n = g34;
+        n--;
+    }
+    sp->count |= g22 + ~ a5[1] - 0x19ea;
+    a10[8] -= f30(0x97f9, y) << 365;
+    st.hi = ((short) g15) ^ a5[11] >> n >> (st.lo != a4[8]);
+    while (p[1]) {
+        for (i = 0; i < 94; i++) {
+            p[1] |= 0x4655;
+        }
+        n--;
+    }
+    return f17(y ? 0xaca6 : 100, ((short) x));
+}
+
+long fn_56(long x, long y, long n, long *p)
+{
+    if (y > 994 > 962) {
+        g9 |= (! sp->lo) & (0xa546) ? f10(a6[12], n) : x;
+    } else {
+        for (i = 0; i < 7; i++) {
+            a1[0] ^= 646 - ((long) x * a12[7]);
+        }
+    }
+    switch (g49) {
+    case 2:
+        st.hi += (n) ? a8[4] * 110 : (394) >= a3[14];
+        break;
+    default:
+        st.hi -= ! - 0x6d4b && a1[0];
+    }
+    switch (n) {
+    case 2:
+        while (a10[5]) {
+            switch (n) {
+            case 4:
+                sp->count -= y <= 0xa375;
+                break;
+            default:
+                y |= ((unsigned long) y);
+            }
+            n--;
+        }
+        break;
+    default:
+        p[1] |= 702;
+    }
+    for (i = 0; i < 82; i++) {
+        sp->count -= ! g8 || x >= g39 << ! n << ((int) 0xf58e);
+    }
+    return 0x99d8;
+}
+
+long fn_57(long x, long y, long n, long *p)
+{
+    p[3] += p[3];
+    if (sp->count) {
+        a13[10] ^= st.lo;
+    } else {
+        sp->count += f30(825, p[1]) + st.lo >= 380 >= n;
+    }
+    {
+        switch (y) {
+        case 9:
+            st.hi |= ((long) g58) ^ ~ 0x5388 ^ f16(0xc79, x);
+            break;
+        default:
+            sp->count ^= ((int) p[0] + a5[11]) << 500;
+        }
+        sp->count |= (f12(28, a15[6])) ? ((int) y && g8) : 822 ? g37 : n ? n ? n : n : a2[8] <= sp->lo;
+    }
+    return f23(a9[0], - st.lo);
+}
+
+long fn_58(long x, long y, long n, long *p)
+{
+    if (~ ((unsigned long) x)) {
+        {
+            for (i = 0; i < 73; i++) {
+                if ((a10[10]) || a5[7] << 625) {
+                    st.hi = 429;
+                } else {
+                    sp->count ^= st.lo ? a3[10] <= g16 : 0xe77e + 0xb583 == ((int) 0x5e47 || p[1]);
+                }
+            }
+            sp->count |= p[3];
+        }
+    } else {
+        while ((sp->count)) {
+            for (i = 0; i < 37; i++) {
+                for (i = 0; i < 62; i++) {
+                    a9[1] += a15[5];
+                }
+            }
+            n--;
+        }
+    }
+    sp->count += 246;
+    p[3] -= x;
+    for (i = 0; i < 21; i++) {
+        st.hi += 932;
+    }
+    p[3] |= (f17(0x6c1c, x));
+    while (336 ? y : st.hi) {
+        g45 |= st.hi;
+        n--;
+    }
+    st.hi |= - a11[10] && y != ! 24;
+    sp->count += f17(~ y, 0xa11c <= 0xbbf8);
+    for (i = 0; i < 14; i++) {
+        {
+            st.hi -= ((unsigned long) sp->count);
+            y -= (f24(a3[8], x));
+        }
+    }
+    {
+        while (y) {
+            n -= 453;
+            n--;
+        }
+        a0[2] |= (sp->lo);
+    }
+    return f18(703, 459) * sp->lo;
+}
+
+long fn_59(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 100; i++) {
+        {
+            {
+                while (f21(st.lo, a9[15])) {
+                    sp->count = g4;
+                    n--;
+                }
+                a0[7] ^= (0xafcf) ^ 0xed30 && a2[4] ? y == 206 : y;
+            }
+            a1[3] += f25(- a3[3], a1[15]);
+        }
+    }
+    while ((101)) {
+        for (i = 0; i < 92; i++) {
+            for (i = 0; i < 55; i++) {
+                p[0] |= ((int) 424) == ((unsigned long) a13[8]) == (((short) a7[15]));
+            }
+        }
+        n--;
+    }
+    p[2] ^= ((unsigned long) ~ 306 >= f23(0xdb7f, 0x4cef));
+    st.hi -= y == g57 ? x <= 265 : - n ^ sp->lo <= 20 != ! y;
+    while (738 < g62) {
+        while (p[2] ^ 0x5c22) {
+            p[1] |= st.hi;
+            n--;
+        }
+        n--;
+    }
+    for (i = 0; i < 97; i++) {
+        sp->count = st.hi;
+    }
+    return f18(((short) a4[5]), 498);
+}
+
+long fn_60(long x, long y, long n, long *p)
+{
+    {
+        while (0x670c) {
+            a9[6] |= g6;
+            n--;
+        }
+        p[3] |= y;
+    }
+    for (i = 0; i < 57; i++) {
+        p[2] += y;
+    }
+    sp->count |= ((short) - a15[2]) | st.hi | 0xee99 != 0x9c72 == 441;
+    a14[15] -= 424 ? 541 : ((unsigned long) g31 > a9[4]);
+    while (0x616e == x) {
+        st.hi ^= 61 ^ 0x16d5;
+        n--;
+    }
+    if (x >> g11 || 0xbfd8 << a5[2]) {
+        st.hi ^= p[0] <= ~ y ^ x;
+    } else {
+        p[1] = (715) ? n > 344 ? n || 0x67d : st.lo : g28 != st.hi ? ((short) a13[9]) : ! 102;
+    }
+    return - ((int) 0x3d1e) >> a9[8];
+}
+
+long fn_61(long x, long y, long n, long *p)
+{
+    {
+        y -= f14(x, sp->count) - ((long) 824 ? st.lo : g50);
+        st.hi -= n | f10(578, x);
+    }
+    a3[1] += a0[13];
+    for (i = 0; i < 59; i++) {
+        sp->count ^= ((int) sp->count << st.hi) >= ((int) ((long) 0xc47));
+    }
+    return n;
+}
+
+long fn_62(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 97; i++) {
+        y += a10[13];
+    }
+    n |= a11[11];
+    for (i = 0; i < 33; i++) {
+        for (i = 0; i < 34; i++) {
+            if (n >= 0x98a2 ? 889 : x) {
+                while (f3(a11[10], 0x83d2)) {
+                    x |= - a14[6] + y <= 656 < 0xfa83;
+                    n--;
+                }
+            } else {
+                while (g55 != 0x7d02) {
+                    a0[8] = f2(f22(sp->lo, n), p[0] < y);
+                    n--;
+                }
+            }
+        }
+    }
+    for (i = 0; i < 13; i++) {
+        p[3] ^= f15(a4[15] ? n : a7[9], 229 > g16);
+    }
+    for (i = 0; i < 88; i++) {
+        for (i = 0; i < 70; i++) {
+            if (y ? 36 : - sp->count) {
+                a5[1] -= f27(0x5b54, 0x986d) >= 396 ^ sp->count > ((long) 121);
+            } else {
+                sp->count ^= st.hi;
+            }
+        }
+    }
+    switch (y) {
+    case 4:
+        a4[5] ^= 897;
+        break;
+    default:
+        p[2] = x << n - 662 <= a2[8];
+    }
+    return sp->count ? ((int) a2[0]) || 0x1518 >= 730 : ((long) - g56);
+}
+
+long fn_63(long x, long y, long n, long *p)
+{
+    if (sp->count ? (0xcad7) : ((int) st.lo)) {
+        {
+            y += ((long) (n)) && y != st.lo ? (782) : ~ 50;
+            sp->count ^= (((long) 0xd640)) ? 926 : f4(a4[12], a13[14]) != (x);
+        }
+    } else {
+        switch (x) {
+        case 0:
+            sp->count ^= f25(a15[10], (a5[7]));
+            break;
+        default:
+            sp->count -= y;
+        }
+    }
+    switch (n) {
+    case 3:
+        switch (g5) {
+        case 6:
+            g55 -= 0xeb23;
+            break;
+        default:
+            if (! (y)) {
+                p[3] ^= ((unsigned long) 0x8f96 & st.lo) | a9[5];
+            } else {
+                a4[3] |= x;
+            }
+        }
+        break;
+    default:
+        for (i = 0; i < 81; i++) {
+            {
+                sp->count += p[1];
+                a5[4] -= st.lo && st.lo ? 0x437d : (0x7e00) + a6[4] < sp->lo != g18 || p[0];
+            }
+        }
+    }
+    st.hi |= 0xb742 ? (st.lo) * - x : ((unsigned long) ((unsigned long) sp->count));
+    a10[7] += f16(- y, ! g43);
+    st.hi ^= p[2] | n ? n * 14 : a15[6] >= 903 ? x : p[3];
+    return 0xa947;
+}
+
+long fn_64(long x, long y, long n, long *p)
+{
+    while (st.hi || 136) {
+        if (796 ? st.hi : sp->count | x ? y : sp->lo) {
+            a4[5] = ((long) 0xa946) >> a12[11] < g60 <= ! (0xafa2);
+        } else {
+            if ((0xe03f) * a9[4] & x) {
+                if (- f29(747, a8[11])) {
+                    st.hi -= n > - 0x99ea * 109 - a8[4];
+                } else {
+                    x = ((long) (190) ? 513 ? g56 : g44 : ((long) x));
+                }
+            } else {
+                while (((short) p[2])) {
+                    y += p[1];
+                    n--;
+                }
+            }
+        }
+        n--;
+    }
+    switch (y) {
+    case 6:
+        a9[15] += (0xfcc2) == n >> 186;
+        break;
+    default:
+        {
+            g9 |= a6[5] ? 0x5496 + 348 && a2[7] : 0xcb6a * st.lo * f16(st.hi, y);
+            st.hi ^= ((int) g60 ? a8[3] : 682 * 0xcd26 < 0xdb3);
+        }
+    }
+    {
+        switch (x) {
+        case 0:
+            for (i = 0; i < 68; i++) {
+                for (i = 0; i < 35; i++) {
+                    st.hi |= ((int) x ? 0x1e82 : n << 372 || g59);
+                }
+            }
+            break;
+        default:
+            {
+                if (((unsigned long) a0[11]) + ((long) p[2])) {
+                    sp->count ^= y;
+                } else {
+                    st.hi = y ? ! st.lo : - 329 + f8(y, 247);
+                }
+                sp->count += x;
+            }
+        }
+        y |= ((int) 0xf158 ? 188 : 223 > f11(0x1697, a4[5]));
+    }
+    switch (n) {
+    case 2:
+        st.hi ^= st.hi;
+        break;
+    default:
+        p[1] = n;
+    }
+    switch (x) {
+    case 4:
+        {
+            p[3] ^= ~ g56 - 307;
+            st.hi |= g32;
+        }
+        break;
+    default:
+        switch (x) {
+        case 5:
+            a2[15] ^= 876 - sp->count;
+            break;
+        default:
+            sp->count += g46;
+        }
+    }
+    while (f23(x, st.lo)) {
+        {
+            {
+                {
+                    st.hi ^= g2 <= f21(st.lo, a13[2]);
+                    st.hi += f28(f2(326, g52), a2[12]);
+                }
+                sp->count = ((a2[3]) && st.hi ? n : y);
+            }
+            sp->count -= 539;
+        }
+        n--;
+    }
+    while (g47 * g42) {
+        p[0] = p[1];
+        n--;
+    }
+    if ((0x8783) + x ? y : y) {
+        a7[12] ^= ((short) ((int) 0xc346) < sp->lo << st.hi);
+    } else {
+        st.hi += 86;
+    }
+    while (0x30a9 >= p[0]) {
+        st.hi ^= x;
+        n--;
+    }
+    return ((unsigned long) 403);
+}
+
+long fn_65(long x, long y, long n, long *p)
+{
+    switch (x) {
+    case 0:
+        st.hi ^= f14(st.lo, y) & p[0] | 662 && x == 829;
+        break;
+    default:
+        {
+            p[2] += ((short) (sp->count & y));
+            st.hi += 396 & a4[4] ? (y) : 0x63e4 > ~ 0x9cf4 <= ! a11[13];
+        }
+    }
+    {
+        switch (g54) {
+        case 3:
+            if (f23(sp->count, 0xc92) & a11[13]) {
+                g63 -= - ((short) st.lo) * f8(y, x);
+            } else {
+                y = st.hi;
+            }
+            break;
+        default:
+            while ((n)) {
+                y |= g30 ? a3[7] : 0x613c ? ((short) y) : y <= y ? n || a12[12] | 157 : p[3] << 0x7972 && x + p[1];
+                n--;
+            }
+        }
+        g10 |= st.hi;
+    }
+    for (i = 0; i < 42; i++) {
+        {
+            {
+                sp->count += - sp->lo - x ^ ((unsigned long) 563);
+                a4[5] -= ((short) st.hi);
+            }
+            a3[14] |= ! y;
+        }
+    }
+    return 0xf3d9 ? a6[12] : 0xeda - g24 && ! st.lo ? 0x8d39 : ((short) a12[13]);
+}
+
+long fn_66(long x, long y, long n, long *p)
+{
+    switch (g30) {
+    case 9:
+        if (((short) a12[4])) {
+            n ^= st.lo && ((int) (n));
+        } else {
+            while (st.hi && 0x1517) {
+                p[0] -= f23(g40, y ? a11[7] : 0x6efd);
+                n--;
+            }
+        }
+        break;
+    default:
+        switch (g53) {
+        case 4:
+            {
+                p[3] += x;
+                p[3] |= p[0];
+            }
+            break;
+        default:
+            p[3] = y * 0x91fd >= 0xda5d != a14[7] & y;
+        }
+    }
+    while (! sp->count) {
+        a15[8] = 0x8c16;
+        n--;
+    }
+    for (i = 0; i < 11; i++) {
+        switch (x) {
+        case 0:
+            st.hi = 773;
+            break;
+        default:
+            p[1] += (100) >> a2[0] || 0xa35b || (f20(n, 0xdda4));
+        }
+    }
+    return st.hi;
+}
+
+long fn_67(long x, long y, long n, long *p)
+{
+    {
+        a1[13] ^= x;
+        sp->count += (a6[14] ? 695 > n : 641 ^ g35);
+    }
+    p[1] -= - x <= 0xdb8c ^ f0(y, n) + sp->count | 0xe723;
+    p[2] = (sp->lo != g8 <= 453 >> y);
+    switch (n) {
+    case 5:
+        {
+            a4[9] ^= ~ y ^ g36 ^ y < (307 <= a2[3]);
+            g63 -= g31;
+        }
+        break;
+    default:
+        switch (x) {
+        case 7:
+            p[3] |= f28(sp->lo, n) ^ 0x8688 ? sp->lo : 589 >= y != 467;
+            break;
+        default:
+            switch (g43) {
+            case 3:
+                switch (g20) {
+                case 6:
+                    y |= (0xcac9 < a2[7]) != f19(sp->count, p[2]);
+                    break;
+                default:
+                    n |= ~ a3[8] == x | y >= n;
+                }
+                break;
+            default:
+                while (! a14[13]) {
+                    sp->count |= - a13[15];
+                    n--;
+                }
+            }
+        }
+    }
+    switch (g20) {
+    case 8:
+        st.hi |= ~ 113 >= g39 + 606 && 0x3aa8 | ((unsigned long) n);
+        break;
+    default:
+        if (0xf7b7) {
+            for (i = 0; i < 44; i++) {
+                sp->count -= f10(y, (g42));
+            }
+        } else {
+            sp->count ^= (((short) 0xeb7f & 116));
+        }
+    }
+    while (184 != p[1]) {
+        g48 |= st.hi;
+        n--;
+    }
+    {
+        if (f30(a10[14], 0xaff9)) {
+            for (i = 0; i < 71; i++) {
+                st.hi = ((unsigned long) sp->lo ? st.hi : 0xe55e >> ((int) st.lo));
+            }
+        } else {
+            if ((((unsigned long) st.lo))) {
+                sp->count |= 667 ? f14(g34, x) ? a7[3] & g42 : ((short) y) : y;
+            } else {
+                p[1] = g52;
+            }
+        }
+        a0[1] = x;
+    }
+    while (n) {
+        y |= ! ! a4[14];
+        n--;
+    }
+    x -= p[1] & 0x6680 <= y ^ st.hi;
+    if (f9(136, n)) {
+        while (y == y) {
+            if (! n ^ 0xfec4) {
+                st.hi |= ! f26(p[1], 0xa901);
+            } else {
+                p[1] += (((short) 0x1f85) != 409 <= a8[15]);
+            }
+            n--;
+        }
+    } else {
+        if (0x3aac) {
+            switch (x) {
+            case 7:
+                n += ((short) g58) || a3[0] > y;
+                break;
+            default:
+                sp->count |= y;
+            }
+        } else {
+            while ((x)) {
+                sp->count += ((unsigned long) ~ a11[8]);
+                n--;
+            }
+        }
+    }
+    return a5[6];
+}
+
+long fn_68(long x, long y, long n, long *p)
+{
+    g51 -= ! 768;
+    for (i = 0; i < 18; i++) {
+        x -= f6(0xfdf8 || a2[7], ~ p[3]);
+    }
+    sp->count += f10(n, a6[8] != 335);
+    if (x) {
+        p[0] += x << f3(a0[7], 350);
+    } else {
+        while (g57 ? 0xdaca : x) {
+            if (sp->count * g23 != (n)) {
+                g35 += g47;
+            } else {
+                n |= f13(681, sp->lo) == 363 - 77;
+            }
+            n--;
+        }
+    }
+    switch (n) {
+    case 6:
+        a13[4] = 122;
+        break;
+    default:
+        a2[0] |= ((short) p[0]) + ~ n + a12[12];
+    }
+    while (x || y) {
+        if (f21(0xeb24, n)) {
+            switch (g34) {
+            case 0:
+                if (((long) ~ 566)) {
+                    a10[8] += sp->lo ^ a15[2] + a5[11] & 0xd71a;
+                } else {
+                    a3[15] ^= f0(y < p[2], n);
+                }
+                break;
+            default:
+                if (! ((unsigned long) sp->lo)) {
+                    a2[6] |= f9((a5[1]), 105 || g63);
+                } else {
+                    a15[11] |= - 0x66de ? 617 : st.lo >= ~ 0x785 - n != x;
+                }
+            }
+        } else {
+            for (i = 0; i < 96; i++) {
+                g20 -= ((int) a10[10]);
+            }
+        }
+        n--;
+    }
+    {
+        {
+            while (0xf45d ? p[1] : st.hi) {
+                if (a2[1] | n & y ? y : 0xc76a) {
+                    a8[5] += ! ((long) ! 0xc2a0);
+                } else {
+                    st.hi ^= st.hi;
+                }
+                n--;
+            }
+            a13[3] = - ((g7));
+        }
+        x -= - g7 || n - ~ st.lo;
+    }
+    return sp->lo >> a12[1] ? sp->count : 0x5739 ? n * 225 : ((long) 974);
+}
+
+long fn_69(long x, long y, long n, long *p)
+{
+    while (0x34a5 ? 691 : sp->lo) {
+        a15[1] -= x ? n & g14 : g34 == n || g35;
+        n--;
+    }
+    switch (n) {
+    case 3:
+        sp->count = f10(a9[5], a6[7]);
+        break;
+    default:
+        p[0] |= (f18(g30, sp->count));
+    }
+    a12[7] += ! ((short) y ? 0x49be : st.hi);
+    while (a9[9] * sp->count) {
+        g36 = y >= a15[1];
+        n--;
+    }
+    while (a8[14]) {
+        {
+            while (((short) sp->lo)) {
+                {
+                    sp->count = f18(538 | y, g38 ? g43 : g20);
+                    p[0] += ~ 0xfe5 != a1[4] || ((int) 325);
+                }
+                n--;
+            }
+            a7[8] |= ((int) n) != (902) || ! a2[7] >> 0x2089;
+        }
+        n--;
+    }
+    switch (y) {
+    case 2:
+        a7[1] += f17(0x502e, y) >> (a10[15]);
+        break;
+    default:
+        sp->count |= a1[5];
+    }
+    while (x != p[1]) {
+        for (i = 0; i < 26; i++) {
+            st.hi -= 0x2a04 & 0x4e36 != st.lo - 366 >= ~ - y;
+        }
+        n--;
+    }
+    switch (n) {
+    case 8:
+        {
+            switch (x) {
+            case 5:
+                a5[11] = (a7[1]);
+                break;
+            default:
+                p[2] -= ((unsigned long) - x) + f9(0x2100, 0x5dd1);
+            }
+            sp->count += g54 > x < 367 > 0xba23 - sp->count;
+        }
+        break;
+    default:
+        p[0] -= sp->count;
+    }
+    {
+        {
+            {
+                sp->count += sp->count && 958;
+                sp->count ^= f9(0x55e4, 0xcc02) ^ f6(x, 723);
+            }
+            p[3] = f31(n, n) + 0x69a9 | ! a13[8];
+        }
+        p[2] ^= 0x37d6 >> 0x512f - 0xdd29 * (((short) 285));
+    }
+    p[0] |= (a4[15] < sp->count < (n));
+    return f2(x, 289) >> a7[10] < g24 ^ (sp->count);
+}
+
+long fn_70(long x, long y, long n, long *p)
+{
+    g45 |= 80 & st.hi;
+    while (a2[13] > y) {
+        g26 = ((unsigned long) 0x9f1e);
+        n--;
+    }
+    for (i = 0; i < 96; i++) {
+        while (0xfac4) {
+            while (x * n) {
+                for (i = 0; i < 34; i++) {
+                    sp->count ^= (0x5aff);
+                }
+                n--;
+            }
+            n--;
+        }
+    }
+    for (i = 0; i < 45; i++) {
+        while (g55 * a0[3]) {
+            switch (x) {
+            case 9:
+                a12[3] |= n > 146 != g58 * y;
+                break;
+            default:
+                sp->count ^= ((short) 0x8690 || st.hi) || ((short) a12[6]) == n * sp->count;
+            }
+            n--;
+        }
+    }
+    switch (y) {
+    case 5:
+        if ((a5[2]) ? 0x242a << g48 : ! g23) {
+            sp->count -= 0x471d;
+        } else {
+            a8[6] = y;
+        }
+        break;
+    default:
+        while (823 + x) {
+            p[3] += n ? 0xa662 ? st.lo : 372 ? ((unsigned long) 0xf2c6) : 0x35c ^ g46 : ~ st.hi;
+            n--;
+        }
+    }
+    switch (x) {
+    case 9:
+        y = ((long) ((unsigned long) 0xf5d1 >> 0xafb1));
+        break;
+    default:
+        for (i = 0; i < 35; i++) {
+            st.hi = x;
+        }
+    }
+    sp->count -= st.lo != g3 >> a12[8] < n && (sp->lo) && sp->lo >= p[0];
+    for (i = 0; i < 32; i++) {
+        switch (g19) {
+        case 9:
+            st.hi ^= (((long) 0xcc0b));
+            break;
+        default:
+            if (- x ? ! 0xad5e : a12[8] & sp->lo) {
+                sp->count += st.hi;
+            } else {
+                if (- g57) {
+                    sp->count -= ((unsigned long) - g62 <= 0x336c);
+                } else {
+                    sp->count += sp->lo == (g12 ? 830 : x);
+                }
+            }
+        }
+    }
+    return - ((unsigned long) 269 | a11[8]);
+}
+
+long fn_71(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 48; i++) {
+        while (450) {
+            sp->count += st.hi ? 854 : st.hi >> ((int) 0x3cbc) ? sp->count : ! (p[0]);
+            n--;
+        }
+    }
+    switch (g61) {
+    case 5:
+        switch (n) {
+        case 6:
+            {
+                a14[2] += f30(531 ? 156 : a3[0], 0xc0c0 + 530);
+                sp->count |= 0x1607 >> a12[15];
+            }
+            break;
+        default:
+            while (255 && g19) {
+                st.hi = (983 == g26 & 450);
+                n--;
+            }
+        }
+        break;
+    default:
+        switch (n) {
+        case 8:
+            switch (g0) {
+            case 1:
+                sp->count -= 0x2e4f;
+                break;
+            default:
+                y -= a0[5] * y >> a9[15] >= n && 0xb373;
+            }
+            break;
+        default:
+            for (i = 0; i < 96; i++) {
+                x -= f1(a2[2], 439) && n * 0x277e || n;
+            }
+        }
+    }
+    st.hi -= ((long) ~ n);
+    switch (g23) {
+    case 2:
+        sp->count += y;
+        break;
+    default:
+        st.hi ^= 0x5e7f;
+    }
+    while (a10[5] <= g7) {
+        a10[14] = n;
+        n--;
+    }
+    p[0] -= sp->count;
+    switch (n) {
+    case 0:
+        while ((x)) {
+            g45 += (g59);
+            n--;
+        }
+        break;
+    default:
+        st.hi += 150;
+    }
+    for (i = 0; i < 1; i++) {
+        a3[11] -= ! x | sp->count && 152 != a9[5];
+    }
+    return (((unsigned long) g58) | 0x415f ^ n);
+}
+
+long fn_72(long x, long y, long n, long *p)
+{
+    n += (sp->count) && (((long) g37));
+    switch (g41) {
+    case 8:
+        n ^= 711;
+        break;
+    default:
+        sp->count -= ~ a11[5] & n ? n * 0x8b2e : 92 * 0xfd1e;
+    }
+    if (395) {
+        {
+            x -= 35;
+            g53 = n;
+        }
+    } else {
+        st.hi ^= 0x7353 == x & ((long) 0x5bec ^ p[3]);
+    }
+    switch (n) {
+    case 6:
+        if (st.lo) {
+            switch (g39) {
+            case 5:
+                {
+                    sp->count -= ((unsigned long) f11(n, 0x59a9) ^ n);
+                    p[0] += f3(821 - 360, g46 && 0x2c3e);
+                }
+                break;
+            default:
+                for (i = 0; i < 34; i++) {
+                    sp->count -= g55 ? sp->lo : sp->count != a5[4] != 42 >> st.hi;
+                }
+            }
+        } else {
+            while (((long) y)) {
+                if (sp->lo) {
+                    x = ~ 680;
+                } else {
+                    st.hi -= a12[0] < 0xe037 == 0x637b << - y;
+                }
+                n--;
+            }
+        }
+        break;
+    default:
+        n = n - (x ? y : 69);
+    }
+    a10[14] |= (((int) p[1])) ? f6(0xdd46, y) != sp->count | 0xf23 : 0x3c58;
+    for (i = 0; i < 95; i++) {
+        for (i = 0; i < 95; i++) {
+            st.hi = (- 711);
+        }
+    }
+    while (a1[8] + 0xe21c) {
+        y = 0x520c == 0x9098 || a13[1] && 694 & - 0x6094;
+        n--;
+    }
+    {
+        sp->count += f25(x, a3[5]) ? x && 885 + y : (n) - (a6[14]);
+        st.hi |= f9(g10 << a3[10], ((short) st.hi));
+    }
+    return ((long) (st.lo));
+}
+
+long fn_73(long x, long y, long n, long *p)
+{
+    sp->count |= - 42 * 613 ? (((short) a1[13])) : ! f7(n, n);
+    p[0] -= 109;
+    {
+        {
+            while (0x1189 ? 0x5d45 : st.lo) {
+                st.hi ^= ((int) 0x2c3) && g46 ? 0x4871 : x - n;
+                n--;
+            }
+            a15[8] -= y;
+        }
+        g16 += ((long) st.lo) ? (x) : 0xc5db | n == ((long) 0x6ae1 + y);
+    }
+    st.hi -= g43 > sp->lo > a14[10] || sp->lo || y >= 0x1f50 == g63;
+    switch (n) {
+    case 4:
+        while (0x59ae ? 0x7b51 : 0x728a) {
+            st.hi += y;
+            n--;
+        }
+        break;
+    default:
+        st.hi = ! ~ x & 0xd55d;
+    }
+    st.hi -= sp->lo != g19 | y || (a5[2]) & 355;
+    return 379;
+}
+
+long fn_74(long x, long y, long n, long *p)
+{
+    if (455) {
+        {
+            n -= st.lo;
+            p[3] += ~ a14[14];
+        }
+    } else {
+        if (y + a1[10] >= 0x6c7 * n) {
+            sp->count |= (n);
+        } else {
+            a1[11] |= (f3(y, g8));
+        }
+    }
+    a1[9] += x & f17(0xc258, 0xf0a3);
+    while (0xa037 ? a14[13] : a4[1]) {
+        {
+            while (f29(a13[0], 510)) {
+                {
+                    st.hi += sp->lo;
+                    g0 += ((short) x);
+                }
+                n--;
+            }
+            a10[13] += 434;
+        }
+        n--;
+    }
+    {
+        p[2] ^= ~ g15 << a7[15] << a6[11];
+        p[1] ^= st.lo;
+    }
+    sp->count ^= ((int) a14[0]);
+    for (i = 0; i < 83; i++) {
+        if ((a5[5]) != 0xa9fd & st.hi) {
+            {
+                switch (g17) {
+                case 8:
+                    y = (a5[10] || 0x2f0b * 0xb695);
+                    break;
+                default:
+                    st.hi -= - 488 >= f4(975, a8[5]) == ! (314);
+                }
+                p[2] |= 507 ? 0xfe28 : sp->count >= ((short) a8[7]) ? 0xe0d6 : 656 + n + g14 >> y;
+            }
+        } else {
+            for (i = 0; i < 97; i++) {
+                switch (g62) {
+                case 1:
+                    p[0] = f2(g44 > sp->lo, g11 | p[3]);
+                    break;
+                default:
+                    sp->count += (p[1]) ^ ((unsigned long) (393));
+                }
+            }
+        }
+    }
+    return 184 ? sp->count : y == 0xb4c <= 769 ^ ~ ! x;
+}
+
+long fn_75(long x, long y, long n, long *p)
+{
+    if (110) {
+        y |= ! ! y | g55;
+    } else {
+        p[2] = st.hi == 966 ? (x) : g40 | a4[1] >> sp->count;
+    }
+    if ((a10[10])) {
+        x += ~ x;
+    } else {
+        switch (n) {
+        case 3:
+            switch (x) {
+            case 6:
+                st.hi ^= g52;
+                break;
+            default:
+                p[1] += sp->count;
+            }
+            break;
+        default:
+            a14[9] = x;
+        }
+    }
+    y += ((int) ((unsigned long) x ? x : a7[10]));
+    n ^= 0x5235;
+    y = a9[9];
+    for (i = 0; i < 40; i++) {
+        while (a6[3]) {
+            p[2] += (n >> sp->lo) & (0x6c3c) ? sp->count || x : f22(n, x);
+            n--;
+        }
+    }
+    return f17(a11[3], g57) ? ((short) 273) : sp->count ? 0xaa73 : 162 != ((long) n <= 0xd6ce);
+}
+
+long fn_76(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 9; i++) {
+        switch (g8) {
+        case 3:
+            switch (x) {
+            case 7:
+                a2[12] ^= ((short) a10[13]) != g46 && 62 ? 619 : a6[8] | ~ g32;
+                break;
+            default:
+                p[3] |= a0[14] && f11(0x5573, p[2]);
+            }
+            break;
+        default:
+            switch (x) {
+            case 0:
+                sp->count ^= - ! (393);
+                break;
+            default:
+                st.hi -= st.hi ? a7[3] : ((int) a1[11] >= n);
+            }
+        }
+    }
+    switch (g9) {
+    case 8:
+        g11 += a7[7];
+        break;
+    default:
+        g39 = (744);
+    }
+    p[2] ^= (~ y);
+    while (st.hi <= sp->count) {
+        {
+            p[3] = ((short) ! x | n);
+            a12[12] ^= (276 << 0x7213) >= 577;
+        }
+        n--;
+    }
+    if (sp->count + g49 < 287 | 955) {
+        for (i = 0; i < 21; i++) {
+            sp->count = (a8[12] >= x ? (882) : ! st.lo);
+        }
+    } else {
+        sp->count -= - ((unsigned long) a8[0]) - (405) ? 0xf382 ^ sp->lo : 294;
+    }
+    sp->count ^= a8[12];
+    switch (x) {
+    case 9:
+        sp->count += 348 - ((long) 231) ? 169 + a13[2] : 820;
+        break;
+    default:
+        switch (n) {
+        case 8:
+            sp->count = - f26(a7[10], a15[7]) != f16(a11[13], 967);
+            break;
+        default:
+            p[1] -= ((long) p[0] && x ? ~ 0x8190 : (906));
+        }
+    }
+    for (i = 0; i < 46; i++) {
+        sp->count = 13;
+    }
+    for (i = 0; i < 57; i++) {
+        sp->count ^= - st.hi <= sp->lo >> (a4[4]) ? x : 801 ? 0x5e9e : x;
+    }
+    return a15[12];
+}
+
+long fn_77(long x, long y, long n, long *p)
+{
+    switch (x) {
+    case 1:
+        g9 -= st.hi || st.hi * a10[3] & x ? a14[8] : a14[3] - a10[1];
+        break;
+    default:
+        a14[4] ^= 304;
+    }
+    while (- g31) {
+        g34 += ((int) a4[1] >= 0xafe1);
+        n--;
+    }
+    for (i = 0; i < 18; i++) {
+        g30 += y;
+    }
+    a4[5] = 0xc83c;
+    st.hi = (828 ? sp->lo : n) <= f2(sp->count, a7[8]) | 57;
+    while (f14(n, sp->count)) {
+        p[3] -= ((810 ? n : x));
+        n--;
+    }
+    {
+        st.hi += 0x64d6;
+        sp->count ^= ((int) 0x4311) ? ((short) n) : x;
+    }
+    st.hi += a14[7];
+    for (i = 0; i < 95; i++) {
+        {
+            y ^= sp->count;
+            st.hi -= st.lo;
+        }
+    }
+    while (x ? y : g7) {
+        for (i = 0; i < 65; i++) {
+            st.hi ^= f14(153, a2[5]) ? 0x207a : x;
+        }
+        n--;
+    }
+    return ((unsigned long) 0x5e2a) > g47 + sp->count;
+}
+
+long fn_78(long x, long y, long n, long *p)
+{
+    {
+        for (i = 0; i < 60; i++) {
+            st.hi = (0x921d);
+        }
+        st.hi ^= x * (g36) ? (a2[1]) : n;
+    }
+    if (sp->count) {
+        for (i = 0; i < 19; i++) {
+            sp->count -= 0x3af3;
+        }
+    } else {
+        y |= f20(f28(0xd4dc, x), 372);
+    }
+    switch (n) {
+    case 9:
+        a6[15] |= y - x == x ^ g23;
+        break;
+    default:
+        a10[7] -= a5[11];
+    }
+    for (i = 0; i < 100; i++) {
+        if (- n - 0xff) {
+            {
+                if (st.hi) {
+                    a13[5] |= - st.lo;
+                } else {
+                    x += ((unsigned long) a6[11] ? n : y) != y + sp->lo != a6[3] >> 0xfc7d;
+                }
+                p[2] = (a10[5]);
+            }
+        } else {
+            if (p[3] ? 0x22a2 : 0x42ef * st.lo - a3[14]) {
+                for (i = 0; i < 38; i++) {
+                    p[2] += a4[8];
+                }
+            } else {
+                {
+                    sp->count = ! n << n >> 972 - 0xffa1;
+                    p[3] -= a9[9] + - 0x677f ^ 688 & n;
+                }
+            }
+        }
+    }
+    if (458 == ((int) 0x53f1)) {
+        x ^= ~ sp->count;
+    } else {
+        if (0xf993 ^ 0x7d2a) {
+            if (a10[10] == f8(n, 0xcd56)) {
+                p[1] |= ~ 570 & 0x911f != st.lo;
+            } else {
+                y -= g26 > st.hi > (a6[11]);
+            }
+        } else {
+            for (i = 0; i < 54; i++) {
+                x |= f3(a9[13] > 0x9d0d, y < g61);
+            }
+        }
+    }
+    if (((long) 0xffa1 == st.hi)) {
+        if (f12(0x81ef, a11[0])) {
+            if (((int) y)) {
+                sp->count |= sp->count;
+            } else {
+                p[3] ^= 752 || f9(y, sp->lo) >= ! st.lo >= x;
+            }
+        } else {
+            st.hi = (st.hi || 0x567d) >= - n ? n : 32;
+        }
+    } else {
+        while (0x5e81 * a7[15]) {
+            switch (y) {
+            case 4:
+                st.hi -= (0x6e6d);
+                break;
+            default:
+                sp->count = f22(376, y) + f3(0xc9d, a12[6]) + 0x125d == n;
+            }
+            n--;
+        }
+    }
+    for (i = 0; i < 64; i++) {
+        p[1] |= - g38 * (sp->lo) + f27(0xa45c, 722);
+    }
+    switch (n) {
+    case 5:
+        a7[11] ^= ((short) f9(a14[7], 266));
+        break;
+    default:
+        st.hi += st.lo;
+    }
+    while (n) {
+        sp->count = a13[8] | ! a3[3] > 0x3377;
+        n--;
+    }
+    return - 673 >> 256 ? g9 : a11[11] + (a0[7]);
+}
+
+long fn_79(long x, long y, long n, long *p)
+{
+    st.hi += (f3(a10[13], y));
+    switch (x) {
+    case 2:
+        sp->count = ~ a14[12];
+        break;
+    default:
+        while (0xf9ca == 0x8230) {
+            for (i = 0; i < 4; i++) {
+                p[3] = a8[13] ? 0x503d >> n : (x) - sp->lo;
+            }
+            n--;
+        }
+    }
+    p[0] -= a15[11];
+    while (((int) st.lo)) {
+        n |= ((a11[5]) ? f30(a11[11], sp->lo) : p[3] <= 0x7fb2);
+        n--;
+    }
+    a9[9] ^= f6(299 && 0x93c3, a6[4] ? 606 : 0x73a2);
+    n = f26((sp->count), n ? st.hi : st.lo);
+    p[1] += a15[11];
+    st.hi ^= (x);
+    for (i = 0; i < 85; i++) {
+        for (i = 0; i < 82; i++) {
+            while (0xa1e1) {
+                p[1] ^= sp->count ? f12(150, st.lo) : ((unsigned long) (sp->lo));
+                n--;
+            }
+        }
+    }
+    p[0] ^= f25(((int) g52), a10[7]);
+    return f6(g20 + a10[8], x <= 159);
+}
+
+long fn_80(long x, long y, long n, long *p)
+{
+    while (st.hi <= a3[7]) {
+        p[1] |= 477;
+        n--;
+    }
+    sp->count += (n && x) == 0xa425 - (0x85e1);
+    while (f3(0x5c9, a13[4])) {
+        {
+            switch (n) {
+            case 0:
+                if (- sp->lo) {
+                    g40 ^= ((int) (0x1604));
+                } else {
+                    st.hi ^= g14;
+                }
+                break;
+            default:
+                if (402) {
+                    sp->count += 401;
+                } else {
+                    g58 ^= g35;
+                }
+            }
+            st.hi = x ? g43 : ~ st.lo || ! a5[10];
+        }
+        n--;
+    }
+    if (((int) 975 <= 764)) {
+        a15[0] ^= (863);
+    } else {
+        sp->count ^= g37 ? y : a9[10] >> 236 * st.lo || ~ sp->lo && 0xdd2b;
+    }
+    for (i = 0; i < 33; i++) {
+        {
+            st.hi |= sp->count;
+            sp->count = ((unsigned long) 404) || y <= 0x8ecb * g14 < y > x ? st.hi : x;
+        }
+    }
+    for (i = 0; i < 38; i++) {
+        g31 = a8[6];
+    }
+    return f18(n, a8[13]) != (f8(n, 113));
+}
+
+long fn_81(long x, long y, long n, long *p)
+{
+    switch (x) {
+    case 3:
+        p[2] |= ((short) n < ((long) 0x2c50));
+        break;
+    default:
+        sp->count ^= 348 * g44 == a10[12] ? 24 : n != f27(st.hi, a4[15]);
+    }
+    for (i = 0; i < 21; i++) {
+        y += f30(617, g37 | st.hi);
+    }
+    for (i = 0; i < 75; i++) {
+        sp->count += ((int) ((int) x ? 0xf66d : g39));
+    }
+    return g63 ? ((short) sp->count) : st.lo;
+}
+
+long fn_82(long x, long y, long n, long *p)
+{
+    if (((short) n)) {
+        x |= ! f10(a11[12], y);
+    } else {
+        for (i = 0; i < 92; i++) {
+            st.hi += 0xdec4;
+        }
+    }
+    st.hi += a5[14];
+    if (a9[6]) {
+        st.hi -= ((int) 0xcb1);
+    } else {
+        p[3] |= sp->count * g18 != g46 & x;
+    }
+    st.hi -= ! y < y ^ x;
+    for (i = 0; i < 62; i++) {
+        if (((unsigned long) sp->count)) {
+            a3[12] += x + 0xc72d ? st.hi != sp->lo >= (a4[1]) : f15(y, g41);
+        } else {
+            st.hi |= f21(p[2], ! y);
+        }
+    }
+    for (i = 0; i < 68; i++) {
+        a9[12] = ~ x < sp->count > (a11[8]);
+    }
+    sp->count -= st.hi << f20(951, p[1]);
+    while (g62 > n) {
+        st.hi |= ((short) g40 <= 114 ? 513 : a13[5]);
+        n--;
+    }
+    return n;
+}
+
+long fn_83(long x, long y, long n, long *p)
+{
+    if (((short) 0xaff7) | (0x6b96)) {
+        st.hi -= ! n || a1[4] + p[3] || (395);
+    } else {
+        switch (n) {
+        case 5:
+            if (! sp->lo ? n ^ y : g52) {
+                if (f14(352, 0x256b)) {
+                    a5[7] |= f17(0x656e, 990) < ((unsigned long) 0x345d) ? f3(p[2], 0x311c) : 0x813c;
+                } else {
+                    st.hi -= ~ (476) || a5[2];
+                }
+            } else {
+                g37 ^= ((short) f7(sp->lo, st.lo));
+            }
+            break;
+        default:
+            for (i = 0; i < 54; i++) {
+                if (((short) 835)) {
+                    st.hi = ((int) ! 0xcc != (a13[11]));
+                } else {
+                    sp->count += 440 ? ((int) a13[7] ? 0xd941 : 0xf378) : 766;
+                }
+            }
+        }
+    }
+    while ((0xaebe)) {
+        while (650 ^ x) {
+            g13 = a4[7] & 0x8a28 > 0x9c30 >= st.hi;
+            n--;
+        }
+        n--;
+    }
+    switch (g53) {
+    case 8:
+        switch (n) {
+        case 0:
+            x -= g61;
+            break;
+        default:
+            a2[6] |= sp->count <= n | 448 * f13(y, n);
+        }
+        break;
+    default:
+        sp->count |= - ((int) a10[1]);
+    }
+    while (n) {
+        st.hi += ((long) ! 490) << a12[0];
+        n--;
+    }
+    return ((long) 65 ^ 0xfff) ? a2[4] < p[3] ? 0x2bd5 : sp->lo : ((unsigned long) f19(874, n));
+}
+
+long fn_84(long x, long y, long n, long *p)
+{
+    {
+        while (0x4908 * n) {
+            if (- p[3] < (y)) {
+                {
+                    x ^= (sp->count) ? 0x6f0b && a15[10] : x * a9[7] + 0xa83c && 407 == a9[6];
+                    p[0] = ! ((int) 0xc492 ^ n);
+                }
+            } else {
+                for (i = 0; i < 44; i++) {
+                    sp->count = x & sp->count != 332 + g26 >= a12[12];
+                }
+            }
+            n--;
+        }
+        g9 = a10[13];
+    }
+    switch (n) {
+    case 4:
+        switch (x) {
+        case 3:
+            switch (g40) {
+            case 3:
+                switch (n) {
+                case 7:
+                    a10[13] ^= g8;
+                    break;
+                default:
+                    p[1] ^= ((short) ((int) p[3]));
+                }
+                break;
+            default:
+                for (i = 0; i < 64; i++) {
+                    sp->count |= ! f28(3, sp->count) <= ((short) ((long) st.hi));
+                }
+            }
+            break;
+        default:
+            a8[5] |= y;
+        }
+        break;
+    default:
+        for (i = 0; i < 74; i++) {
+            for (i = 0; i < 88; i++) {
+                while (a0[2] ? a10[4] : 0x4521) {
+                    n += ! f21(p[2], 977) >= y;
+                    n--;
+                }
+            }
+        }
+    }
+    switch (n) {
+    case 6:
+        switch (n) {
+        case 2:
+            sp->count -= (sp->count || 424) & x ? a9[2] : x - st.lo;
+            break;
+        default:
+            for (i = 0; i < 7; i++) {
+                sp->count = ((int) (70)) > ((long) g7 ^ a5[3]);
+            }
+        }
+        break;
+    default:
+        if (((short) g11 ? g9 : g19)) {
+            {
+                {
+                    p[2] |= sp->count;
+                    a12[3] |= ~ y == f24(g61, sp->count) ? x * a6[15] << (sp->lo) : x;
+                }
+                a4[7] = n;
+            }
+        } else {
+            sp->count |= ~ 0x452f <= f24(g36, p[1]);
+        }
+    }
+    {
+        a2[10] |= ~ ((long) sp->count * p[0]);
+        a11[2] |= f27(p[2] || y, (975));
+    }
+    sp->count -= ((short) n) & st.lo && 0xfa64 ? (341) : 0xc455;
+    while ((0x96c5)) {
+        if (- a0[12] - 743) {
+            if (431) {
+                {
+                    g52 |= ((short) sp->count) < f16(a1[3], p[3]) - x ^ y;
+                    p[0] += f19((304), x);
+                }
+            } else {
+                st.hi = p[0];
+            }
+        } else {
+            switch (g17) {
+            case 6:
+                {
+                    sp->count -= ! f27(st.hi, a8[11]) - st.hi;
+                    st.hi += ((short) st.hi);
+                }
+                break;
+            default:
+                g16 |= f2(n, 120) < ! (st.lo);
+            }
+        }
+        n--;
+    }
+    p[0] ^= ((long) (0x1205) + sp->count + y);
+    return (a0[9]);
+}
+
+long fn_85(long x, long y, long n, long *p)
+{
+    p[1] |= 969 > y >= y * 0xb8d7 >> a5[15] <= sp->count;
+    for (i = 0; i < 37; i++) {
+        switch (n) {
+        case 6:
+            st.hi |= st.hi;
+            break;
+        default:
+            st.hi -= f12(a15[7], a3[13]) != (0x7f7a >> sp->count);
+        }
+    }
+    p[3] = ((unsigned long) f12(sp->lo, a15[2]));
+    if (st.hi) {
+        {
+            {
+                st.hi ^= a13[12] || n;
+                st.hi = f10(972, x) - (st.hi);
+            }
+            p[1] |= f7(a6[9] - st.lo, 142);
+        }
+    } else {
+        for (i = 0; i < 69; i++) {
+            switch (x) {
+            case 2:
+                a7[1] -= 420;
+                break;
+            default:
+                y += f12(981, 196) & f6(a12[13], g63);
+            }
+        }
+    }
+    {
+        if (n) {
+            a13[1] -= ((unsigned long) a11[0]) >= 0xaf48 || ((int) a7[9] >> x);
+        } else {
+            a6[14] |= f27(x, p[0] ? n : g36);
+        }
+        p[1] -= (! sp->lo == 0x3bb6);
+    }
+    {
+        if ((643 ? p[3] : p[1])) {
+            while (((short) 209)) {
+                sp->count -= ((short) n) >> y <= sp->count;
+                n--;
+            }
+        } else {
+            {
+                sp->count -= st.hi;
+                p[0] |= a2[1];
+            }
+        }
+        st.hi -= sp->lo;
+    }
+    a14[9] |= ~ 0xb3ff >= n ? 0xe366 : a14[15] ^ st.lo;
+    if (f7(0x6084, x)) {
+        st.hi -= ((long) ((int) 915) ? (a8[7]) : ((short) g55));
+    } else {
+        sp->count |= ((unsigned long) f5(a4[6], p[2]));
+    }
+    for (i = 0; i < 75; i++) {
+        n |= st.lo;
+    }
+    return n;
+}
+
+long fn_86(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 19; i++) {
+        st.hi = ((unsigned long) 614);
+    }
+    n |= 490 && 673 > x && (sp->count);
+    while (0xbac1) {
+        p[0] ^= a5[6] >= 966 >= a15[1] + 0xc338 << ~ (0x2629);
+        n--;
+    }
+    p[0] += ((long) 165 << p[3]) || 199;
+    return f10(831 | sp->lo, n | x);
+}
+
+long fn_87(long x, long y, long n, long *p)
+{
+    st.hi -= ((int) n);
+    for (i = 0; i < 45; i++) {
+        sp->count -= f30(663, sp->count) != a2[3] - a14[0] & (0x4764);
+    }
+    if (n ? 0x88a0 : sp->lo >= g26 ? 498 : n) {
+        y += (0x8768 < 857 & ~ 14);
+    } else {
+        x |= f21(a3[11] - a14[10], f28(n, 632));
+    }
+    p[2] = ((long) x);
+    sp->count = 444;
+    a5[8] += 0x6650 ? a1[2] : g38;
+    st.hi ^= ((long) (a10[13]) * st.lo != 724);
+    return 108 >> 0x68c0 ? y : 0x1017 ? 511 : 0xc662;
+}
+
+long fn_88(long x, long y, long n, long *p)
+{
+    if (y) {
+        while (n) {
+            switch (g44) {
+            case 3:
+                if (a7[14] ^ 0x5d28 != y & x) {
+                    p[1] -= 0xa147;
+                } else {
+                    st.hi ^= ((short) x != y) ? - y ? x >> 0xaf82 : 451 : 0x13b1;
+                }
+                break;
+            default:
+                {
+                    p[1] += - 3 < 0x614 != p[1] ? g47 : g31;
+                    a11[14] ^= ! a0[12];
+                }
+            }
+            n--;
+        }
+    } else {
+        while (y) {
+            {
+                st.hi |= (f7(y, g8));
+                sp->count -= ! 0xcc56 * 0x8fd8 ? x : a15[5] > ((long) 964) ? (a7[1]) : f31(a8[3], a9[11]);
+            }
+            n--;
+        }
+    }
+    switch (g54) {
+    case 9:
+        sp->count = y;
+        break;
+    default:
+        p[2] |= f3(f28(st.lo, y), n && st.hi);
+    }
+    p[1] ^= 0xf4a4;
+    p[2] |= ((unsigned long) ~ 0x7035 >> 0x7826 ? 207 : 0x5fb4);
+    for (i = 0; i < 94; i++) {
+        x |= f4(0xd482, sp->lo) - (y) != ~ 0x500b;
+    }
+    sp->count ^= 0x10b9;
+    y |= ((- 163));
+    n -= g38;
+    switch (g26) {
+    case 1:
+        {
+            while (((short) n)) {
+                a0[11] += x | 539 != y;
+                n--;
+            }
+            a0[11] ^= 0xeff5 ? a10[12] : 474 - x * - 233 ^ n << 0x9dd5;
+        }
+        break;
+    default:
+        if ((0x4bf0)) {
+            if (g41) {
+                n ^= ((short) f17(sp->lo, sp->lo));
+            } else {
+                sp->count ^= (a5[2] < (sp->lo));
+            }
+        } else {
+            for (i = 0; i < 19; i++) {
+                sp->count ^= - y;
+            }
+        }
+    }
+    st.hi -= ((short) ((long) 463)) != x ^ 22 && a10[6] & 0x4198;
+    return sp->count;
+}
+
+long fn_89(long x, long y, long n, long *p)
+{
+    a15[12] += sp->lo;
+    switch (n) {
+    case 1:
+        sp->count ^= (f7(a9[9], 0x4ce7));
+        break;
+    default:
+        switch (n) {
+        case 1:
+            {
+                sp->count |= ~ x;
+                p[3] |= a3[14];
+            }
+            break;
+        default:
+            {
+                g13 |= 330;
+                st.hi ^= ! 0xe435 & g13 == f7(0xffda, sp->lo) | a7[4] ^ n;
+            }
+        }
+    }
+    n |= 0x26c2;
+    sp->count -= y ? y >= (0x388a) : ((long) ~ 566);
+    for (i = 0; i < 19; i++) {
+        x |= - (0x9e5e == n);
+    }
+    st.hi -= 0xd3b1;
+    if ((st.lo)) {
+        switch (g8) {
+        case 9:
+            st.hi -= (n);
+            break;
+        default:
+            a5[4] ^= a8[10] >> g51 ^ 0x427 <= x <= n;
+        }
+    } else {
+        st.hi |= f13(p[2], x > x);
+    }
+    if (((long) 0xd555) < 267 > 794) {
+        {
+            sp->count ^= ((n) != 0xf266);
+            a10[0] = sp->count && ((int) 906 * a14[15]);
+        }
+    } else {
+        sp->count |= 791;
+    }
+    return f7(311 - 0x9867, (566));
+}
+
+long fn_90(long x, long y, long n, long *p)
+{
+    if (f2(0xd30e, 769)) {
+        n += ((long) f5(st.lo, y)) ? ! 407 <= 19 : sp->lo;
+    } else {
+        switch (g16) {
+        case 3:
+            st.hi |= st.lo;
+            break;
+        default:
+            p[0] = f13((n), g4 >> a0[6]);
+        }
+    }
+    y = f24(((short) p[0]), g19);
+    a15[9] = ((short) ((int) a8[6]) ? (71) : sp->lo ? a7[6] : 339);
+    for (i = 0; i < 88; i++) {
+        p[2] += ((short) a5[15]);
+    }
+    {
+        sp->count = 0x573 ? y : g25 | 535 >> (473);
+        x |= a9[4] || - (a14[13]);
+    }
+    st.hi -= g60 * - ! y;
+    p[0] -= sp->lo;
+    switch (x) {
+    case 5:
+        a10[15] += (570 ? 0xca1a : g39) >> x << n ? ((int) 784) : (0x6e90);
+        break;
+    default:
+        while (((int) 0x7813)) {
+            p[3] |= - sp->lo ^ ((short) 0x525b ? 0x6e0d : a6[1]);
+            n--;
+        }
+    }
+    return ((unsigned long) 0x188);
+}
+
+long fn_91(long x, long y, long n, long *p)
+{
+    while (a10[1]) {
+        {
+            if (a2[11] >= y & a4[11]) {
+                a5[14] |= (f17(p[2], g50));
+            } else {
+                if (n) {
+                    sp->count -= ((unsigned long) (~ 386));
+                } else {
+                    st.hi |= (x ? n ? n : x : y || a7[9]);
+                }
+            }
+            p[2] -= a2[11];
+        }
+        n--;
+    }
+    if (((unsigned long) (y))) {
+        switch (n) {
+        case 6:
+            {
+                g5 += ~ f13(0xaf63, 269);
+                n += ~ (a0[13]);
+            }
+            break;
+        default:
+            for (i = 0; i < 37; i++) {
+                y -= a15[7] ? 613 : g45 != n <= 0xbbbb ? p[1] ? x : sp->lo + y || 0x9d63 : n;
+            }
+        }
+    } else {
+        if ((0x1a30) - a7[9] << n) {
+            switch (g37) {
+            case 5:
+                a2[15] = f0(a13[15], ! 0x7a6);
+                break;
+            default:
+                a1[3] ^= ((short) (256) ^ x);
+            }
+        } else {
+            {
+                g25 ^= g13;
+                n += (0x5c47);
+            }
+        }
+    }
+    switch (y) {
+    case 3:
+        if (y) {
+            a14[7] -= f23(x ? a2[13] : x, - 0xd697);
+        } else {
+            {
+                switch (y) {
+                case 8:
+                    st.hi |= f3((a4[0]), ~ y);
+                    break;
+                default:
+                    sp->count += f14(n, 0xc369) >= n || 0x145d >> 0x13d2;
+                }
+                a13[13] = 153 | 56 >= ! st.hi == n ? g51 : g21 + a0[3] ^ st.hi;
+            }
+        }
+        break;
+    default:
+        switch (y) {
+        case 2:
+            for (i = 0; i < 26; i++) {
+                {
+                    a6[1] += f23(g10, 0xeb52) | f31(165, x) >= g19;
+                    x |= 0xa034;
+                }
+            }
+            break;
+        default:
+            sp->count = ((int) 0x4603 && n) ? 0x263c << 249 * x ? 855 : 0xa335 : sp->lo;
+        }
+    }
+    {
+        st.hi = g44;
+        x |= ((long) sp->count >= f16(0xaea9, 0xf0e));
+    }
+    return ((unsigned long) f21(sp->count, n));
+}
+
+long fn_92(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 37; i++) {
+        switch (y) {
+        case 5:
+            a10[8] ^= ((unsigned long) 0xc541) ^ ! (n);
+            break;
+        default:
+            st.hi ^= sp->lo ^ a0[2] & 0x4139 & ~ 0x8964 != g51 <= 0x563d;
+        }
+    }
+    {
+        if (n ^ ((unsigned long) 0x1a08)) {
+            sp->count |= (sp->count);
+        } else {
+            st.hi |= f17(126, g57) ? 0x3dea & 123 || n : f26(115, g28) != sp->lo;
+        }
+        st.hi -= ((short) ((int) f27(0x37de, 0x4402)));
+    }
+    while (((int) 2)) {
+        a14[10] ^= f13(g6 ? a7[5] : n, a8[12]);
+        n--;
+    }
+    return ((short) a0[5]) ^ a4[0];
+}
+
+long fn_93(long x, long y, long n, long *p)
+{
+    {
+        while (st.hi && sp->count) {
+            g26 |= x;
+            n--;
+        }
+        a5[14] += x;
+    }
+    for (i = 0; i < 97; i++) {
+        x -= n;
+    }
+    while (0x7718 ^ 105) {
+        while (x * st.lo) {
+            a11[5] += y;
+            n--;
+        }
+        n--;
+    }
+    for (i = 0; i < 16; i++) {
+        switch (g37) {
+        case 3:
+            while (st.lo == a13[13]) {
+                a14[14] = (488 | 0x140a + n >> 653);
+                n--;
+            }
+            break;
+        default:
+            for (i = 0; i < 32; i++) {
+                p[3] = sp->count ^ a11[6] <= p[1];
+            }
+        }
+    }
+    switch (y) {
+    case 2:
+        x -= a0[8] <= 0xa0cb ? y : 0xe2;
+        break;
+    default:
+        st.hi ^= a6[4];
+    }
+    switch (g63) {
+    case 9:
+        if ((0xb795) ^ f18(a14[12], 863)) {
+            while (((unsigned long) a7[13])) {
+                switch (n) {
+                case 7:
+                    a10[1] ^= ! (y == 676);
+                    break;
+                default:
+                    sp->count += 996;
+                }
+                n--;
+            }
+        } else {
+            a7[2] = (((short) 102 & a5[8]));
+        }
+        break;
+    default:
+        sp->count -= f3(a11[2], a11[5]);
+    }
+    return st.hi;
+}
+
+long fn_94(long x, long y, long n, long *p)
+{
+    switch (y) {
+    case 7:
+        st.hi -= ((short) ! st.hi >= 0x5fc0);
+        break;
+    default:
+        sp->count -= - ~ p[0] ? a7[5] : 611 && x + p[2];
+    }
+    switch (y) {
+    case 5:
+        {
+            for (i = 0; i < 56; i++) {
+                switch (g8) {
+                case 5:
+                    a14[11] ^= 0x4b47;
+                    break;
+                default:
+                    st.hi = 0x5062 ? st.lo : y ? f30(y, 276) : a9[1] <= f25(663, p[0]);
+                }
+            }
+            p[2] += ((short) g7) ? sp->count : n;
+        }
+        break;
+    default:
+        for (i = 0; i < 92; i++) {
+            if (f0(a14[12], sp->lo) ? - y : a0[12] - 257) {
+                for (i = 0; i < 38; i++) {
+                    a3[6] ^= n ^ 0x9517 ^ 0xc53 == 346 >> st.hi;
+                }
+            } else {
+                for (i = 0; i < 55; i++) {
+                    sp->count += p[1] ? st.lo : a10[7] & x ? x : 235;
+                }
+            }
+        }
+    }
+    while (a4[2] >> st.hi) {
+        for (i = 0; i < 13; i++) {
+            st.hi |= (~ 239);
+        }
+        n--;
+    }
+    for (i = 0; i < 44; i++) {
+        x = n == 0xe20d > g41 - 24 >= g26 * (p[2]);
+    }
+    {
+        sp->count ^= ((int) 0xfa2a) ^ 0x6bc0 > 358 != st.lo << 0xcecc;
+        sp->count |= ((0x514a > 433));
+    }
+    if (y <= 0x9d5d - 0x6dff) {
+        p[2] += y >> st.lo > a8[11] ? f0(a2[6], st.hi) : st.hi == 0x5f10;
+    } else {
+        {
+            p[3] -= 0x936f ? g52 : a0[13] & ((unsigned long) 783) - f0(a8[11], n);
+            p[0] |= f1(x << a6[15], 530 <= y);
+        }
+    }
+    {
+        if (! 0xef1d + a11[8]) {
+            st.hi |= f1(! y, f11(476, st.hi));
+        } else {
+            while (f7(0x83f7, y)) {
+                a8[6] -= g51;
+                n--;
+            }
+        }
+        sp->count += g20;
+    }
+    return y;
+}
+
+long fn_95(long x, long y, long n, long *p)
+{
+    p[1] |= - n || y;
+    {
+        while (a15[14]) {
+            a14[11] ^= (a1[2] >> 0x9926 == f29(0xce3f, g57));
+            n--;
+        }
+        y -= - a1[3] || st.lo > a2[6] < 0x576b;
+    }
+    st.hi = 0x6ffd || x;
+    if (f21(a4[5], x) ? y < x : 975) {
+        if (a7[7] - g51 == a0[12]) {
+            a11[5] -= f23(692, y);
+        } else {
+            n += ((int) st.lo ? n : sp->count << x);
+        }
+    } else {
+        for (i = 0; i < 89; i++) {
+            x ^= a14[5];
+        }
+    }
+    {
+        {
+            y |= x * - 0xde2b;
+            p[1] |= ~ ((long) st.lo == p[2]);
+        }
+        p[2] += - 0x21fc | n >= y >> ! f8(sp->lo, 341);
+    }
+    a1[1] -= ! ((int) x) <= ~ 0xcb0e;
+    switch (x) {
+    case 2:
+        sp->count ^= - p[0] ? y : 248 || a6[5];
+        break;
+    default:
+        {
+            for (i = 0; i < 26; i++) {
+                n ^= 0x773 >= n;
+            }
+            st.hi = y < f2(0x2200, st.hi) <= n;
+        }
+    }
+    n = g30 + ((long) 0x13ed) << st.lo & 242;
+    return ((int) ((short) 526 >> sp->count));
+}
+
+long fn_96(long x, long y, long n, long *p)
+{
+    a5[6] |= (f14(769, 0x64dc)) ? f14(n, 921) : ((a13[8]));
+    sp->count += ((unsigned long) f7(st.lo, 0x5ff7));
+    while (g11) {
+        sp->count |= (a8[0] <= x);
+        n--;
+    }
+    while (y != g14) {
+        {
+            switch (x) {
+            case 9:
+                st.hi -= x <= a0[1] >= p[2] > st.lo >> f16(907, a0[3]);
+                break;
+            default:
+                sp->count ^= (929 < 962 && a8[0]);
+            }
+            p[1] -= sp->count;
+        }
+        n--;
+    }
+    while (g19) {
+        if (g24) {
+            {
+                sp->count += (438);
+                sp->count |= f9(702, 267 <= a7[10]);
+            }
+        } else {
+            {
+                a6[12] ^= (n);
+                p[3] |= (n || 0x1242 ? g11 + x : p[0] < g4);
+            }
+        }
+        n--;
+    }
+    {
+        if (0x6854 ? f26(sp->lo, 0x4c81) : ~ n) {
+            for (i = 0; i < 20; i++) {
+                {
+                    x |= (((unsigned long) sp->count)) ? n : ! ~ y;
+                    g40 -= f2(y || n, a14[15] | g36);
+                }
+            }
+        } else {
+            for (i = 0; i < 2; i++) {
+                while (0xbbb6 | sp->lo) {
+                    p[2] ^= ~ ((short) sp->count) | a10[10];
+                    n--;
+                }
+            }
+        }
+        st.hi ^= - g50 < a7[13] > 704 ? sp->lo - n : ((int) g18);
+    }
+    n = y;
+    if ((a12[10]) & p[3]) {
+        for (i = 0; i < 69; i++) {
+            st.hi = (0xfdea ? x && g31 : - a3[5]);
+        }
+    } else {
+        g35 ^= f1(0x2ca2, 0x424f) >> f8(0xc2bc, 135) < a5[0];
+    }
+    for (i = 0; i < 83; i++) {
+        p[2] -= 0xcc9d ? (0x8bbe ? st.lo : x) : f26(g41, 851);
+    }
+    st.hi ^= (sp->lo) & ! y * ((short) y) + 0x30;
+    return f17(~ n, a1[13] && p[1]);
+}
+
+long fn_97(long x, long y, long n, long *p)
+{
+    p[2] = ! f2(0x9759, sp->lo) <= x || a9[14];
+    x ^= st.hi << 518 | ((short) a11[0]) ^ f26(g45, 586) | a4[1] >> g18;
+    if (a2[0]) {
+        switch (x) {
+        case 9:
+            if (((int) (x))) {
+                g17 |= (a14[13] * st.lo ? ! n : ((unsigned long) y));
+            } else {
+                {
+                    a12[0] += (n ? g9 ? g42 : x : y == x);
+                    p[2] = 608;
+                }
+            }
+            break;
+        default:
+            if (x & (g31)) {
+                a14[13] ^= 0xe0ea;
+            } else {
+                for (i = 0; i < 98; i++) {
+                    a12[2] += (n) < f15(356, g30);
+                }
+            }
+        }
+    } else {
+        p[0] ^= - g3;
+    }
+    st.hi -= (n);
+    sp->count ^= sp->lo;
+    for (i = 0; i < 30; i++) {
+        st.hi |= y << 0x7755 + (g18 >> 187);
+    }
+    if (172) {
+        for (i = 0; i < 60; i++) {
+            while (0x30f2) {
+                while (614) {
+                    a11[9] |= g8;
+                    n--;
+                }
+                n--;
+            }
+        }
+    } else {
+        {
+            sp->count += - a8[2];
+            n ^= ((short) st.lo > sp->count >> 102);
+        }
+    }
+    return ((int) st.lo > 0xaf60) >= st.hi ? ! n : a0[5];
+}
+
+long fn_98(long x, long y, long n, long *p)
+{
+    switch (n) {
+    case 4:
+        st.hi |= 921 << g60 ? 26 : (0x7c4f);
+        break;
+    default:
+        p[2] -= n;
+    }
+    for (i = 0; i < 32; i++) {
+        if (709 ? sp->count : n * 334) {
+            while (152) {
+                n ^= ((long) sp->count) >= 452 + y == f2(x, g23);
+                n--;
+            }
+        } else {
+            for (i = 0; i < 47; i++) {
+                y |= 0xb55b;
+            }
+        }
+    }
+    {
+        switch (g20) {
+        case 5:
+            a12[13] |= a2[14];
+            break;
+        default:
+            x += 174 << a7[4] * f12(a2[0], g19) >= ~ g58;
+        }
+        y = ((short) 894 == 473) <= a11[15] ? y : a0[1] ? 505 : 0x7aa0;
+    }
+    {
+        for (i = 0; i < 6; i++) {
+            sp->count += 293;
+        }
+        a12[3] ^= n;
+    }
+    sp->count ^= a7[9];
+    p[3] |= (((short) y >> sp->count));
+    switch (n) {
+    case 2:
+        while (p[0] ? sp->count : 0xc2bc) {
+            if (g16) {
+                st.hi -= ((short) (917));
+            } else {
+                p[3] += ((long) (y + 987));
+            }
+            n--;
+        }
+        break;
+    default:
+        sp->count |= sp->lo;
+    }
+    for (i = 0; i < 53; i++) {
+        for (i = 0; i < 90; i++) {
+            {
+                a5[13] += a8[15];
+                a1[15] -= 0xc831;
+            }
+        }
+    }
+    a11[4] += f16(107, y) << - y + ((short) a2[5]);
+    return (849 ? st.hi : ((long) a0[3]));
+}
+
+long fn_99(long x, long y, long n, long *p)
+{
+    sp->count += n + sp->lo < 0x861b & 0x637e ? a11[1] : - 909 ? n : 0x9e50;
+    a5[5] += ! (923);
+    {
+        if (! y) {
+            g2 ^= (sp->lo | 0x60bc < a8[10]);
+        } else {
+            x |= 0x68a1 << a12[10] | x && 0xc7d8 ? 45 : st.lo >> ((int) 0x26b3);
+        }
+        p[3] += f10((st.lo), (0x94ca));
+    }
+    a9[10] = 821;
+    for (i = 0; i < 2; i++) {
+        {
+            switch (y) {
+            case 4:
+                x = ((unsigned long) x ? y : 862) && y;
+                break;
+            default:
+                st.hi += g50;
+            }
+            a4[15] -= (n);
+        }
+    }
+    st.hi += f29(0x9d81, (sp->lo));
+    p[1] -= f27(((short) a1[3]), st.hi);
+    {
+        switch (y) {
+        case 2:
+            for (i = 0; i < 47; i++) {
+                sp->count -= a2[1];
+            }
+            break;
+        default:
+            while (~ p[1]) {
+                while ((x)) {
+                    st.hi = 0xef2;
+                    n--;
+                }
+                n--;
+            }
+        }
+        a13[8] ^= a7[13];
+    }
+    if (((int) n >= a1[13])) {
+        switch (y) {
+        case 1:
+            st.hi ^= - 279 * 0xb421 ^ a13[1];
+            break;
+        default:
+            p[0] += ~ 762 <= x >> f4(sp->lo, sp->count);
+        }
+    } else {
+        {
+            p[0] += f5(y, a2[12]) == ! 200 ? x == x : (x);
+            st.hi += y == n && x >> 0x8098 >= 4;
+        }
+    }
+    return a15[6];
+}
+
+long fn_100(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 32; i++) {
+        switch (n) {
+        case 0:
+            switch (g9) {
+            case 1:
+                sp->count -= 361;
+                break;
+            default:
+                g49 ^= st.lo;
+            }
+            break;
+        default:
+            while ((y)) {
+                st.hi ^= (n);
+                n--;
+            }
+        }
+    }
+    while ((y)) {
+        for (i = 0; i < 43; i++) {
+            switch (x) {
+            case 8:
+                if (st.lo && ((unsigned long) 0x4cb9)) {
+                    x -= f5(f2(0x2d70, a1[1]), p[2] + 230);
+                } else {
+                    sp->count ^= g25;
+                }
+                break;
+            default:
+                switch (g33) {
+                case 5:
+                    n += sp->count;
+                    break;
+                default:
+                    p[1] |= f3(((long) y), sp->lo);
+                }
+            }
+        }
+        n--;
+    }
+    if (sp->lo ? st.hi || a0[10] : ((unsigned long) a9[1])) {
+        switch (x) {
+        case 5:
+            {
+                p[2] ^= ~ ((unsigned long) f13(a0[5], 484));
+                st.hi ^= ((short) 72 ^ 598 & x);
+            }
+            break;
+        default:
+            for (i = 0; i < 49; i++) {
+                st.hi += a12[4] >> sp->count != 0x7d2d || g31;
+            }
+        }
+    } else {
+        while (g46 == 180) {
+            if ((st.lo > y)) {
+                sp->count |= - y ? x == g38 : 0xc560 | (g8) << 0x4bf << st.hi;
+            } else {
+                st.hi = a0[4] ? g47 : st.hi >> ! st.hi | n & 0x4568 ^ sp->count;
+            }
+            n--;
+        }
+    }
+    {
+        switch (x) {
+        case 2:
+            while (sp->lo >= n) {
+                {
+                    g24 ^= st.lo;
+                    p[2] -= n ? - 0xcf3f ^ 862 : ((short) y) ? x >= p[1] : x;
+                }
+                n--;
+            }
+            break;
+        default:
+            switch (y) {
+            case 8:
+                switch (n) {
+                case 0:
+                    p[0] = f19(0xd5c, 0xbb17) - ((int) 184) > n ^ sp->count > f21(st.hi, y);
+                    break;
+                default:
+                    sp->count += ~ a9[14] >= a11[5] > 0x5109;
+                }
+                break;
+            default:
+                st.hi -= ~ 128 < f24(a8[12], y) << 0x53c1;
+            }
+        }
+        p[1] |= f11(n, g61) - 0xa7e3 ? st.hi << st.hi : a9[2];
+    }
+    return a14[2] > ((int) f4(x, 760));
+}
+
+long fn_101(long x, long y, long n, long *p)
+{
+    sp->count ^= ((long) ! 524 * y << a9[9]);
+    sp->count ^= ((long) 0x588f);
+    sp->count |= - (f13(x, g37));
+    for (i = 0; i < 52; i++) {
+        for (i = 0; i < 43; i++) {
+            while ((sp->count)) {
+                while (((short) 701)) {
+                    a12[13] = ((unsigned long) f7(p[3], n)) << a1[5] | x + 0x84ed;
+                    n--;
+                }
+                n--;
+            }
+        }
+    }
+    for (i = 0; i < 58; i++) {
+        x += 380 | st.hi == p[2] | y;
+    }
+    return a1[11] <= ((unsigned long) ~ x);
+}
+
+long fn_102(long x, long y, long n, long *p)
+{
+    sp->count -= ((int) 0x74ae);
+    sp->count = (95 ? a14[3] && 0x920b : p[1] - 63);
+    st.hi |= a11[8] ? (((unsigned long) 0xe7a1)) : 290 == a4[12];
+    n ^= a12[12];
+    while (n == 0x2367) {
+        st.hi ^= f1(y, 769) & 0x51b9 > st.lo == y;
+        n--;
+    }
+    p[2] -= x ? ((int) a9[11]) : (f29(835, 443));
+    a13[5] += x || y <= a9[9] ? 209 == a0[0] : y == 0x731c;
+    switch (n) {
+    case 4:
+        st.hi ^= y;
+        break;
+    default:
+        st.hi |= f11(711 && sp->lo, 789 || sp->lo);
+    }
+    p[2] ^= f7(((unsigned long) y), sp->count & 343);
+    a3[7] = (a10[1]) ? 0xbd79 > st.hi : ((unsigned long) a9[2]) > f1(n, sp->count);
+    return ((short) ((short) ((unsigned long) g50)));
+}
+
+long fn_103(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 18; i++) {
+        p[0] += st.hi;
+    }
+    sp->count = g13;
+    sp->count = f21(st.lo, n ? x : a7[14]);
+    sp->count |= - f1(a11[9], x);
+    {
+        sp->count ^= sp->count;
+        g60 ^= ~ sp->count;
+    }
+    while (((long) p[3])) {
+        switch (x) {
+        case 9:
+            st.hi |= n | f6(0xaa64, sp->lo) && f24(a14[11], 0xd6fd);
+            break;
+        default:
+            p[1] |= st.lo;
+        }
+        n--;
+    }
+    while (338 && g63) {
+        st.hi ^= x;
+        n--;
+    }
+    switch (n) {
+    case 2:
+        if (sp->count) {
+            a9[14] ^= g55;
+        } else {
+            g31 |= ((int) (((long) y)));
+        }
+        break;
+    default:
+        a11[12] += n && f4(a11[3], y);
+    }
+    return (! 0x5db1 <= n);
+}
+
+long fn_104(long x, long y, long n, long *p)
+{
+    if (a7[13] < st.lo || 0xfd15 || g29) {
+        switch (g49) {
+        case 4:
+            for (i = 0; i < 98; i++) {
+                sp->count = ((long) sp->lo) > ((long) 0x11d4) | f19(343, st.lo);
+            }
+            break;
+        default:
+            g50 -= ~ f8(523, a8[11]) == sp->count > g31 != x || y;
+        }
+    } else {
+        while (g19) {
+            {
+                g33 -= (sp->count);
+                y += g37;
+            }
+            n--;
+        }
+    }
+    switch (y) {
+    case 9:
+        {
+            g23 = ! g40 ? 0x6a6 : 0x20ef << n << g25;
+            x |= y;
+        }
+        break;
+    default:
+        {
+            {
+                {
+                    a11[15] += ((long) y + 0x5fdd && ~ 0x1ded);
+                    p[3] -= (st.lo ? 0x5462 : 0x5fc5 | f31(0x10ba, 0x94a3));
+                }
+                p[1] += (280);
+            }
+            y ^= ~ ((unsigned long) g6);
+        }
+    }
+    switch (y) {
+    case 8:
+        {
+            a10[8] = 0x849a;
+            sp->count ^= x;
+        }
+        break;
+    default:
+        a11[2] ^= 322;
+    }
+    {
+        a1[1] ^= f12(n, 0xf5e7) & a15[14] && g49 & x;
+        g39 += ! ((unsigned long) ((long) st.hi));
+    }
+    return a13[10] + sp->lo > p[2] <= y && 0x8ef7 | sp->lo ? p[0] : sp->lo - st.hi;
+}
+
+long fn_105(long x, long y, long n, long *p)
+{
+    {
+        while (- 378) {
+            {
+                for (i = 0; i < 8; i++) {
+                    a14[15] ^= (a11[10] >= ! n);
+                }
+                st.hi = f17(a11[14], 384) > g6 ? st.hi : 232 - sp->lo != x < g60;
+            }
+            n--;
+        }
+        a5[1] -= f26(a9[11], x) * sp->count;
+    }
+    switch (n) {
+    case 2:
+        if (0xaebe * g4) {
+            y ^= sp->lo - ((unsigned long) st.lo) < st.lo && (0x6818);
+        } else {
+            p[3] ^= f14(762, a2[2]) <= sp->lo;
+        }
+        break;
+    default:
+        switch (n) {
+        case 1:
+            sp->count -= st.hi >= g24;
+            break;
+        default:
+            a8[1] ^= - 64 * a13[4] | a15[2];
+        }
+    }
+    st.hi |= 0x9ce4;
+    while (a13[0] <= y) {
+        n |= sp->lo;
+        n--;
+    }
+    switch (n) {
+    case 4:
+        while (x << y) {
+            p[3] ^= y;
+            n--;
+        }
+        break;
+    default:
+        y += ((int) n);
+    }
+    st.hi += f7(a11[11], 603) || f12(x, x) == g35 <= 0xfaa6;
+    switch (x) {
+    case 3:
+        {
+            p[1] = ! (n ? a4[7] : 698);
+            sp->count += (504);
+        }
+        break;
+    default:
+        sp->count = - (y) >> ((short) sp->lo);
+    }
+    a11[4] = n;
+    if (f19(y, a2[15])) {
+        p[2] |= ((unsigned long) ((long) (x)));
+    } else {
+        sp->count += 178;
+    }
+    return (y);
+}
+
+long fn_106(long x, long y, long n, long *p)
+{
+    y |= f27(358 < n, (0x404d));
+    while (y >> n) {
+        switch (y) {
+        case 4:
+            x ^= y;
+            break;
+        default:
+            st.hi ^= f6(f11(a9[2], a7[13]), 0x8d8);
+        }
+        n--;
+    }
+    for (i = 0; i < 22; i++) {
+        a3[4] |= x;
+    }
+    for (i = 0; i < 63; i++) {
+        a9[9] ^= (a0[10] && st.lo) - sp->lo;
+    }
+    x -= ((short) n | 0x52d6) ^ n << 162 - y << x;
+    a5[12] ^= 0xdc55 ^ 937 ? 0x53f7 : y > 346;
+    {
+        for (i = 0; i < 98; i++) {
+            a13[5] |= (y | x) && 409 ? 254 : g46 == (a15[6]);
+        }
+        a11[8] += 0x4b4e;
+    }
+    for (i = 0; i < 49; i++) {
+        sp->count ^= a10[3] && 709 ? n : 518 * (f9(x, x));
+    }
+    n += 0xcec6 - 193 && f13(a6[2], 0xef0b) & (f30(p[1], a4[12]));
+    return n;
+}
+
+long fn_107(long x, long y, long n, long *p)
+{
+    p[0] |= g47;
+    {
+        p[3] -= a9[14] ? a5[6] : a13[11] * (0x5d6f) && g0 ? a13[9] : st.lo && 153 ? a6[5] : x;
+        p[1] = ! (0xfacb) - 0x9f81 == a13[3];
+    }
+    sp->count ^= f2((n), 0xfd2a > x);
+    for (i = 0; i < 47; i++) {
+        switch (y) {
+        case 6:
+            switch (y) {
+            case 2:
+                for (i = 0; i < 40; i++) {
+                    x |= st.hi ? a7[9] : ! f18(y, a9[6]);
+                }
+                break;
+            default:
+                for (i = 0; i < 55; i++) {
+                    st.hi |= ((long) 60);
+                }
+            }
+            break;
+        default:
+            if (882) {
+                p[1] ^= ~ (n) != ! (st.hi);
+            } else {
+                sp->count |= - f14(x, 0xad6d) << 0x3a38;
+            }
+        }
+    }
+    sp->count += (! y);
+    sp->count |= ((long) a8[4]) << 957 ? a0[9] : 0x4592 * 459 != 0x9d99 < y;
+    switch (g60) {
+    case 8:
+        p[1] += (n);
+        break;
+    default:
+        st.hi |= ! a13[0] < a11[12] != (a5[14] + st.lo);
+    }
+    {
+        for (i = 0; i < 65; i++) {
+            if ((a2[6])) {
+                switch (x) {
+                case 4:
+                    sp->count ^= (~ 0x48b7 ? 155 < x : a13[14] ? sp->lo : 721);
+                    break;
+                default:
+                    a0[13] |= (f5(st.lo, 0xa846));
+                }
+            } else {
+                x -= 0x3454;
+            }
+        }
+        st.hi ^= ~ 255 && y ? 794 : a6[5];
+    }
+    return sp->count;
+}
+
+long fn_108(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 47; i++) {
+        sp->count -= 159;
+    }
+    for (i = 0; i < 28; i++) {
+        {
+            for (i = 0; i < 1; i++) {
+                switch (n) {
+                case 4:
+                    y ^= 21 == 0x9e4d * ! a2[3] * (0x80ee) <= ((unsigned long) 304);
+                    break;
+                default:
+                    x |= f8(x, x < sp->count);
+                }
+            }
+            sp->count = (a2[2] << 0x6259 != 805);
+        }
+    }
+    if (729 == a13[11] && n << a3[4]) {
+        y |= sp->lo;
+    } else {
+        switch (x) {
+        case 7:
+            if (! n < g48) {
+                {
+                    x += sp->count >> x && 810 && f17(a7[9], x) * 0xf098;
+                    a12[4] += ~ y >= ((unsigned long) g1);
+                }
+            } else {
+                a1[9] = g4 ? 374 : a3[0] ? a10[9] != g37 : 0xd2a8 >> 0x12e8 && ((short) ((long) 528));
+            }
+            break;
+        default:
+            if (a2[3]) {
+                if (((unsigned long) a10[9] > n)) {
+                    st.hi |= 0x74c4;
+                } else {
+                    y = 0xdbf2 && (~ n);
+                }
+            } else {
+                if (0xbcfd < p[1] <= st.lo) {
+                    n |= f23(a2[4], 0xf852) >> - 0 >= 45 || st.lo;
+                } else {
+                    p[3] = x;
+                }
+            }
+        }
+    }
+    if ((n > a7[12])) {
+        while (618) {
+            y = ~ x ? 0xef16 : g19 != n;
+            n--;
+        }
+    } else {
+        p[3] |= 393;
+    }
+    p[1] |= 0x29a0 ? 0x272a : st.lo;
+    return 381 >= ~ f26(931, 0x1c0a);
+}
+
+long fn_109(long x, long y, long n, long *p)
+{
+    sp->count -= x;
+    switch (y) {
+    case 2:
+        {
+            while (16) {
+                if (! 960 & ~ a12[14]) {
+                    p[3] ^= 263 * a4[2];
+                } else {
+                    st.hi = sp->count;
+                }
+                n--;
+            }
+            p[0] |= n ? st.hi : a8[11];
+        }
+        break;
+    default:
+        while (n) {
+            p[3] += 554 || ((unsigned long) a0[15]) + x && g13 >= (y);
+            n--;
+        }
+    }
+    switch (y) {
+    case 5:
+        {
+            st.hi ^= sp->count * sp->lo == a5[8] != ((long) x) && ((long) st.hi);
+            a15[4] |= n;
+        }
+        break;
+    default:
+        while (0x9e6f >> a1[5]) {
+            n = ((long) 504 ? 0xa1 : n) < (st.lo);
+            n--;
+        }
+    }
+    for (i = 0; i < 38; i++) {
+        for (i = 0; i < 45; i++) {
+            x -= 118;
+        }
+    }
+    while (((long) 0x84a4)) {
+        sp->count += sp->lo;
+        n--;
+    }
+    return (x >= n) != a1[9];
+}
+
+long fn_110(long x, long y, long n, long *p)
+{
+    while (((int) 770)) {
+        switch (n) {
+        case 6:
+            for (i = 0; i < 41; i++) {
+                if (224) {
+                    p[2] -= f19(f1(st.lo, sp->lo), g20);
+                } else {
+                    sp->count -= 0x1817;
+                }
+            }
+            break;
+        default:
+            while (f8(n, n)) {
+                for (i = 0; i < 70; i++) {
+                    x -= ~ ((a11[14]));
+                }
+                n--;
+            }
+        }
+        n--;
+    }
+    {
+        sp->count += sp->lo;
+        x |= ~ y;
+    }
+    y = a11[6] ^ 0x69f4;
+    p[0] -= f9(a13[4], 139) ? 458 ? 0xea1e : 0x26c2 : p[3] && y & 80 >= a14[1] ? sp->lo : 808;
+    {
+        if (a1[4]) {
+            p[3] |= ~ ! ((short) n);
+        } else {
+            n ^= y <= sp->count ? g60 : 0x71e2 << st.lo ? f7(sp->lo, 462) - a4[2] > x : 446;
+        }
+        p[3] |= ! g56 ? st.lo || sp->count : g57 > y ? n : (g20);
+    }
+    return (f23(g48, a8[3])) & ~ x < a2[13];
+}
+
+long fn_111(long x, long y, long n, long *p)
+{
+    {
+        for (i = 0; i < 71; i++) {
+            p[2] ^= f31(g18, y) ? y | a0[15] >= f25(x, sp->lo) : ! 0x9ba0;
+        }
+        n -= a7[12] ^ sp->lo ? 0x5c07 : g63 ? (a12[15]) : x;
+    }
+    sp->count += a7[3];
+    switch (x) {
+    case 6:
+        while (a8[12] + st.hi) {
+            x += f27(g29, ((int) 239));
+            n--;
+        }
+        break;
+    default:
+        x |= ! f12(g14, st.lo);
+    }
+    {
+        for (i = 0; i < 34; i++) {
+            if (((long) 35)) {
+                switch (y) {
+                case 8:
+                    st.hi = ~ f25(a14[13], 0x5356);
+                    break;
+                default:
+                    a9[9] -= (p[0]) ? f16(a1[7], 0xf453) : (0xebbb & 259);
+                }
+            } else {
+                a3[8] ^= 0x8a10 * g2 || (x) + g38;
+            }
+        }
+        sp->count ^= ((short) (((short) 954)));
+    }
+    sp->count |= p[3] >> x < st.lo >= a9[3] != 203 << p[2] > 774;
+    if (((unsigned long) 0xaf91 > x)) {
+        st.hi = f24(a1[12], a5[4]) * sp->lo;
+    } else {
+        p[3] = f25(g49 && 861, 193);
+    }
+    p[1] = ~ st.hi ^ sp->count || a14[2] >= 695;
+    return ~ 0xfdfd & 320 ? a12[5] : 0xb1c4 != p[0];
+}
+
+long fn_112(long x, long y, long n, long *p)
+{
+    p[3] |= ((short) st.hi == st.hi) << f9(st.lo, y) ? n != p[1] : 0xabf4 ^ a15[9];
+    while (a0[13] & a8[9]) {
+        for (i = 0; i < 36; i++) {
+            sp->count = f26(0xcdc, y) | f4(0xcf68, x);
+        }
+        n--;
+    }
+    {
+        while (sp->count) {
+            {
+                st.hi -= a14[15];
+                st.hi += ((int) n) <= 156;
+            }
+            n--;
+        }
+        sp->count ^= ((a1[6] && 671));
+    }
+    {
+        if (0 >> 476 * a7[13]) {
+            while (sp->count) {
+                {
+                    p[0] -= 0x3aa1 == a3[13] && y > (683 > y);
+                    a13[2] += a1[9];
+                }
+                n--;
+            }
+        } else {
+            a10[6] |= f17(- y, (418));
+        }
+        y ^= f7(488 != x, sp->lo - y);
+    }
+    a13[1] += (a11[3]);
+    return (((long) x) & ((int) 0xc08b));
+}
+
+long fn_113(long x, long y, long n, long *p)
+{
+    st.hi ^= ((a0[5] || sp->count));
+    {
+        sp->count |= g28 == x == y < g62;
+        a0[6] = n >= ((short) g8) + f24(sp->count, x);
+    }
+    for (i = 0; i < 2; i++) {
+        sp->count ^= 0x1192;
+    }
+    while (st.hi << a3[12]) {
+        a0[1] += 296 >> 247 <= 626 ? y : n;
+        n--;
+    }
+    while (316) {
+        switch (y) {
+        case 7:
+            for (i = 0; i < 64; i++) {
+                while (f4(y, p[0])) {
+                    a13[1] ^= ! ! 0x11cd;
+                    n--;
+                }
+            }
+            break;
+        default:
+            for (i = 0; i < 99; i++) {
+                st.hi ^= a4[6];
+            }
+        }
+        n--;
+    }
+    st.hi -= x << a8[6] ^ f3(a7[15], 176) - a15[8];
+    return x << x;
+}
+
+long fn_114(long x, long y, long n, long *p)
+{
+    if ((x) == a6[5] && 0xf518) {
+        switch (g49) {
+        case 7:
+            if (! st.lo & f13(y, 780)) {
+                sp->count ^= - 0xd285 | ((int) a8[11]) ? n && 0xae4c : - sp->count;
+            } else {
+                y += ~ y != 0x338a;
+            }
+            break;
+        default:
+            {
+                sp->count -= 732 >> 415 >> sp->lo ? n : 44;
+                a5[15] = ! y;
+            }
+        }
+    } else {
+        st.hi = f6(g42, 0xcff7) - ((unsigned long) ! sp->count);
+    }
+    {
+        if ((f9(504, n))) {
+            switch (g22) {
+            case 7:
+                while (a6[7]) {
+                    st.hi += f27((y), ((int) st.hi));
+                    n--;
+                }
+                break;
+            default:
+                {
+                    sp->count += 0x3c57 < st.hi - x * y ? 0x24a2 : n ^ g17 >> n;
+                    a1[11] = ! n != ~ a3[1];
+                }
+            }
+        } else {
+            switch (y) {
+            case 2:
+                for (i = 0; i < 23; i++) {
+                    a12[15] ^= f9(f21(149, a13[0]), x ? 0x1f38 : y);
+                }
+                break;
+            default:
+                if (- 0x518b >> g55 + y) {
+                    a14[9] = f26(st.lo, x) ? ((int) st.hi) : a12[1] << 0x7563 <= f5(955, p[2]);
+                } else {
+                    a13[14] = f11(0x994e == n, y == 0xfbe8);
+                }
+            }
+        }
+        sp->count += (~ a10[5]);
+    }
+    for (i = 0; i < 36; i++) {
+        switch (x) {
+        case 0:
+            if (x <= ((unsigned long) a5[0])) {
+                {
+                    g16 ^= ((((short) p[1])));
+                    sp->count -= f24(x < g18, 534 > a11[11]);
+                }
+            } else {
+                n |= 889 ^ y | (a7[6]) < ((short) 698);
+            }
+            break;
+        default:
+            while (p[1]) {
+                if ((x == x)) {
+                    st.hi ^= (g18) > (a10[0]) + 311 > x < p[1];
+                } else {
+                    x |= f18(x ? 0x96d2 : a2[14], a2[5] | 657);
+                }
+                n--;
+            }
+        }
+    }
+    {
+        sp->count = (- a12[10]) ? g10 >= 0xdf2 ? x : a6[10] : y;
+        sp->count = x >= sp->count ? ~ a8[0] : 173 + n ^ a2[9] >= n < x - a2[6];
+    }
+    sp->count ^= 0xd633;
+    st.hi -= - x || ((unsigned long) 702) <= x;
+    return x;
+}
+
+long fn_115(long x, long y, long n, long *p)
+{
+    {
+        p[0] ^= ! f7(0xb9fe, n) | 0xb842 & 0xc1f9 << 672;
+        p[2] += n;
+    }
+    {
+        g58 += 0xa913 & x && x ? a15[14] : g0 ? (y) : a6[9];
+        g26 = f22(((int) 0xb8ab), ((long) y));
+    }
+    for (i = 0; i < 12; i++) {
+        switch (x) {
+        case 7:
+            for (i = 0; i < 77; i++) {
+                {
+                    p[1] = ~ ((unsigned long) 0xabc3);
+                    st.hi -= st.lo << n < x | ((long) sp->lo) > 0x5931 == sp->count;
+                }
+            }
+            break;
+        default:
+            {
+                p[0] = - g53 == g26 == 0xe866 < 0x705;
+                p[3] -= (x ? (x) : (sp->lo));
+            }
+        }
+    }
+    {
+        a3[11] ^= ((short) 449 & 789 * ! a2[4]);
+        p[3] += sp->count;
+    }
+    {
+        sp->count += ((int) 0x224c);
+        st.hi = y << ((unsigned long) 0xcc8e) < 284 ? a11[9] : 557;
+    }
+    for (i = 0; i < 91; i++) {
+        for (i = 0; i < 32; i++) {
+            while (sp->count <= 492) {
+                sp->count -= ((unsigned long) f6(y, st.lo) ? a9[6] << 534 : ~ sp->count);
+                n--;
+            }
+        }
+    }
+    if (f0(708, x)) {
+        for (i = 0; i < 67; i++) {
+            {
+                while ((0xb8f5)) {
+                    sp->count ^= g44;
+                    n--;
+                }
+                a3[2] -= (f24(0x6048, 0xd5d2) && y);
+            }
+        }
+    } else {
+        switch (y) {
+        case 3:
+            switch (y) {
+            case 3:
+                y -= sp->lo > 0x8600 | p[2] < g40 ^ ((unsigned long) 682 > a6[5]);
+                break;
+            default:
+                switch (n) {
+                case 1:
+                    a6[15] ^= (g18 ^ 0x7439) ? x : (sp->lo ? y : x);
+                    break;
+                default:
+                    y = - 0xac21 & 634 ? g49 : 14 > a4[9];
+                }
+            }
+            break;
+        default:
+            while (y && a12[0]) {
+                while (n >= x) {
+                    p[3] = 0x3922;
+                    n--;
+                }
+                n--;
+            }
+        }
+    }
+    for (i = 0; i < 43; i++) {
+        switch (x) {
+        case 1:
+            {
+                switch (x) {
+                case 5:
+                    x += g3;
+                    break;
+                default:
+                    g57 += 372 <= sp->count + a11[12] || g3 * ((a10[3]));
+                }
+                n |= - (n << y);
+            }
+            break;
+        default:
+            sp->count -= 238 ? 0xc41b : 815 + a0[15] == st.hi ? (st.hi) & g4 : 0x218f & y == a2[11];
+        }
+    }
+    return a6[14];
+}
+
+long fn_116(long x, long y, long n, long *p)
+{
+    {
+        if (f13(a15[11], sp->count)) {
+            a1[5] |= (x);
+        } else {
+            a9[10] ^= (0x865e & x ? 922 : a12[1]);
+        }
+        p[3] -= 0x2103;
+    }
+    a4[10] |= f14(624, sp->count) ? a11[13] ? a10[1] : st.lo >= sp->lo ^ 0x6b90 : sp->count + x < x;
+    if (! sp->lo ? y : g33) {
+        if (((unsigned long) (g61))) {
+            p[1] ^= f18(n + p[0], 0x73b4);
+        } else {
+            a4[14] += p[2] > a6[4] >> f18(g43, 0xc13e);
+        }
+    } else {
+        a0[11] = 753;
+    }
+    return x;
+}
+
+long fn_117(long x, long y, long n, long *p)
+{
+    sp->count += a3[12] + y > ! a3[14] >= (210);
+    while ((g13)) {
+        while (y) {
+            a7[0] |= 0x10e4 >= 0xe763 <= sp->lo <= a5[9] ? (n >> a0[12]) : (n) ? 0x18e5 : ! y;
+            n--;
+        }
+        n--;
+    }
+    for (i = 0; i < 94; i++) {
+        x |= ((n));
+    }
+    {
+        p[0] += f17(st.lo, y | 0xaf4b);
+        n ^= f18(p[1], 0x43d2) && 0x2ba8 >= 0x5099 ? g34 : 614;
+    }
+    if (((short) 0xb657)) {
+        n = ~ 852 | x >> 229 + (- y);
+    } else {
+        {
+            while (g32) {
+                st.hi -= g42 ? ~ n >= 68 : 718;
+                n--;
+            }
+            sp->count = st.hi ? a5[0] ? n : y - 0xccc : 139;
+        }
+    }
+    while (y && x) {
+        {
+            n -= f24(0x33e7, st.hi) & y == st.hi ? y : a2[11] >> ! sp->count;
+            y -= g51;
+        }
+        n--;
+    }
+    switch (y) {
+    case 6:
+        if (! 0x4d03 & ((int) n)) {
+            switch (n) {
+            case 5:
+                p[3] |= ((int) f22(a6[7], 0xa362)) > sp->lo;
+                break;
+            default:
+                p[3] = x;
+            }
+        } else {
+            while (! n) {
+                st.hi ^= (((int) a15[10])) | st.lo & 0x95ae >= n;
+                n--;
+            }
+        }
+        break;
+    default:
+        switch (x) {
+        case 0:
+            switch (n) {
+            case 6:
+                sp->count -= n;
+                break;
+            default:
+                a6[5] = 486;
+            }
+            break;
+        default:
+            {
+                a3[6] -= n;
+                a3[10] |= f17(st.lo >> 0x34c9, ((int) 0x494e));
+            }
+        }
+    }
+    if (~ (a5[10])) {
+        st.hi ^= p[2];
+    } else {
+        sp->count |= ((unsigned long) 0x5efe) ? f13(x, x) : g45 >> 0x9f56 - ~ n;
+    }
+    return ((int) n < x) * p[1];
+}
+
+long fn_118(long x, long y, long n, long *p)
+{
+    if (sp->count) {
+        x = ((short) f31(a12[9], sp->lo) & x);
+    } else {
+        if (g46) {
+            for (i = 0; i < 9; i++) {
+                if (x >= a8[7] - ((unsigned long) y)) {
+                    sp->count += (st.lo);
+                } else {
+                    g7 ^= (x) && ((unsigned long) a2[12] - 221);
+                }
+            }
+        } else {
+            switch (x) {
+            case 3:
+                sp->count = ! 646;
+                break;
+            default:
+                while (a11[3] >= 811) {
+                    sp->count |= (a10[1] || sp->count ? x : a0[12]);
+                    n--;
+                }
+            }
+        }
+    }
+    g50 ^= n ? ((long) g37 * a8[2]) : a14[13] ? a12[3] : n < p[1] | p[2];
+    while (f15(y, a13[0])) {
+        sp->count -= ((short) f15(st.lo, sp->lo));
+        n--;
+    }
+    x += y * ~ ~ sp->lo;
+    while (a0[1] == 0xc280) {
+        while (711 ? st.hi : g50) {
+            while (((long) y)) {
+                if (f24(0x153f, 0xeb69) ? a5[4] : y) {
+                    st.hi += (523);
+                } else {
+                    x = ~ f13(g5, g22);
+                }
+                n--;
+            }
+            n--;
+        }
+        n--;
+    }
+    for (i = 0; i < 53; i++) {
+        p[3] |= st.hi;
+    }
+    return ! ((long) - 338);
+}
+
+long fn_119(long x, long y, long n, long *p)
+{
+    p[2] ^= f3(y || n, a13[10] == a9[15]);
+    sp->count = (- n > 121);
+    {
+        for (i = 0; i < 12; i++) {
+            st.hi ^= (x);
+        }
+        p[3] = f27(y, 618) + ~ y ? n : y;
+    }
+    a7[12] = p[3];
+    if (38 ? 0xd305 ^ a5[1] : sp->lo >> x) {
+        g10 |= - ((int) g17) | a13[14];
+    } else {
+        p[0] -= f5(384, g30) ? ~ 0x4389 : 75 && p[0] + 0x1792 != a4[2] < x && 471;
+    }
+    a4[7] = st.hi;
+    return f30((a0[1]), y);
+}
+
+long fn_120(long x, long y, long n, long *p)
+{
+    st.hi = - - 505 << ((unsigned long) 0x7142) ? (824) : y;
+    y |= p[3];
+    switch (y) {
+    case 1:
+        {
+            st.hi += f21(f13(a8[0], x), f29(a9[8], n));
+            x -= 120;
+        }
+        break;
+    default:
+        for (i = 0; i < 41; i++) {
+            for (i = 0; i < 2; i++) {
+                x |= (((int) a2[12]) << ! 605);
+            }
+        }
+    }
+    return 922;
+}
+
+long fn_121(long x, long y, long n, long *p)
+{
+    {
+        x -= (((int) x)) ? sp->count >> x > 0xe1fa : ((short) g34 || x);
+        a13[5] = (246) && 0xdc72 + a4[2] - (0x5efc) ^ y << 306;
+    }
+    g47 ^= 0xf5cd > ! x >= st.hi;
+    for (i = 0; i < 41; i++) {
+        st.hi += 759;
+    }
+    if (a1[9] | 0x48ce == - 0x7bf6) {
+        st.hi = ((short) - f17(a1[0], y));
+    } else {
+        a1[15] ^= ((int) st.lo);
+    }
+    for (i = 0; i < 43; i++) {
+        if (a15[12]) {
+            st.hi |= 932;
+        } else {
+            g45 = f15(0xf4c0 * y, y * a4[14]);
+        }
+    }
+    if (((int) a12[7] >> 0x19cd)) {
+        a13[8] ^= 107 + f11(0xe9f7, 112);
+    } else {
+        st.hi ^= - 776 != y;
+    }
+    y += - f30(g16, 0x5dd3);
+    return (a0[0]);
+}
+
+long fn_122(long x, long y, long n, long *p)
+{
+    while ((n)) {
+        {
+            switch (g0) {
+            case 6:
+                st.hi = y ? f27(0x223a, y) : (x);
+                break;
+            default:
+                n = f20(((long) st.hi), ~ n);
+            }
+            p[3] |= a1[6];
+        }
+        n--;
+    }
+    while (x != g47) {
+        sp->count = ((int) ((unsigned long) 0x7e54));
+        n--;
+    }
+    switch (n) {
+    case 4:
+        while ((0x8fb0)) {
+            a1[3] ^= ((long) (f18(sp->lo, st.hi)));
+            n--;
+        }
+        break;
+    default:
+        {
+            a7[10] ^= ((int) a9[13] - (n));
+            p[0] -= f1(y, x) >= a10[9];
+        }
+    }
+    p[1] -= x ^ 0x18a9 ? g37 & a6[15] : ((long) st.lo ? 782 : x);
+    if (- 0xb47a - a15[6]) {
+        if (308 & sp->count ^ 0x3a ? a4[14] : 0xdc55) {
+            st.hi |= 0x5416;
+        } else {
+            switch (n) {
+            case 9:
+                st.hi = g9 && (a14[2]) == f8(y, y);
+                break;
+            default:
+                n = a7[6];
+            }
+        }
+    } else {
+        if (a11[7]) {
+            if (((long) 681) != 0xb744 < 772) {
+                st.hi |= - (a9[10] ^ st.hi);
+            } else {
+                p[3] += ((long) 0xfdbd ^ y >> 0xa827);
+            }
+        } else {
+            for (i = 0; i < 68; i++) {
+                p[2] += (sp->count & st.hi < (x));
+            }
+        }
+    }
+    switch (g11) {
+    case 9:
+        {
+            g10 += ((short) ((int) x)) << f1(a4[0], sp->lo);
+            sp->count |= f14(st.hi >> 743, 0x7f2e ? 0x9dc1 : a1[15]);
+        }
+        break;
+    default:
+        for (i = 0; i < 55; i++) {
+            while (0x3e01 >= a13[10]) {
+                st.hi ^= a0[8];
+                n--;
+            }
+        }
+    }
+    while (845) {
+        while (st.lo ^ x) {
+            if (f12(815, 0x6bd5)) {
+                if (a12[14]) {
+                    a13[3] |= st.hi;
+                } else {
+                    st.hi ^= p[1];
+                }
+            } else {
+                {
+                    a12[9] = 0xcf86 == - g60 * 248;
+                    st.hi |= 0x2c28 & f23(x, 348);
+                }
+            }
+            n--;
+        }
+        n--;
+    }
+    while (f19(st.lo, 697)) {
+        {
+            x += g38;
+            st.hi ^= 0x4beb & a14[4] ^ a10[12] ? x : 0x9732;
+        }
+        n--;
+    }
+    {
+        while (675 >= 200) {
+            st.hi -= f21(a10[10], 0xb42f) - 214 && f5(y, st.lo) ? f8(a1[5], 257) : 605;
+            n--;
+        }
+        sp->count -= a4[9];
+    }
+    return st.hi;
+}
+
+long fn_123(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 85; i++) {
+        st.hi |= a0[3];
+    }
+    for (i = 0; i < 40; i++) {
+        for (i = 0; i < 34; i++) {
+            if (f15(sp->lo, a3[12]) < ((short) 80)) {
+                p[1] ^= 186 ? 0xa63c > a4[9] & 128 + st.lo : ((long) x ? a10[7] : n);
+            } else {
+                g58 = p[1];
+            }
+        }
+    }
+    for (i = 0; i < 69; i++) {
+        y ^= f8(0xf75d > g55, 709 ? 60 : a10[8]);
+    }
+    return n;
+}
+
+long fn_124(long x, long y, long n, long *p)
+{
+    a9[10] -= 0x6e24 * ((short) 653);
+    for (i = 0; i < 98; i++) {
+        p[0] |= ! a11[9] || ((short) st.lo) ? n : ~ 122 * n;
+    }
+    for (i = 0; i < 75; i++) {
+        for (i = 0; i < 100; i++) {
+            for (i = 0; i < 29; i++) {
+                while (n >= x) {
+                    n |= 178 < y + ((long) 174) * 224;
+                    n--;
+                }
+            }
+        }
+    }
+    st.hi += x + y << 0x5b5a != f22(y, st.hi) | ((unsigned long) g54);
+    switch (g12) {
+    case 2:
+        if (a0[15] * y == a8[10] & a7[10]) {
+            while (f6(159, 812)) {
+                while (x) {
+                    st.hi += (g18 < g24 < a3[15] > n);
+                    n--;
+                }
+                n--;
+            }
+        } else {
+            st.hi = (f14(149, g5) > sp->count);
+        }
+        break;
+    default:
+        st.hi += (0x6b8d >> x ? ! p[0] : ~ x);
+    }
+    for (i = 0; i < 31; i++) {
+        p[0] ^= ((unsigned long) (n)) > a1[1];
+    }
+    while (((long) a2[10])) {
+        sp->count -= n;
+        n--;
+    }
+    for (i = 0; i < 84; i++) {
+        p[2] = g29 ? f24(sp->count, 427) >= st.lo + sp->count : ! f3(g6, a10[9]);
+    }
+    st.hi = ! y >= sp->count ? sp->lo & y : sp->lo ? n : n;
+    sp->count ^= ((long) g47 & n - 0x1faa || sp->lo);
+    return f12((p[3]), st.hi << a4[10]);
+}
+
+long fn_125(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 96; i++) {
+        sp->count |= 637;
+    }
+    {
+        g31 ^= (x);
+        st.hi |= y >= st.lo + ~ g47 - n >> a5[3] >= st.lo;
+    }
+    if (0xabc5) {
+        if (5 == n | y) {
+            x = sp->count;
+        } else {
+            st.hi -= ! 0xa0e2 - st.hi ^ sp->count && ((short) x);
+        }
+    } else {
+        switch (x) {
+        case 9:
+            sp->count = (x >= a4[7] ? 480 : g45);
+            break;
+        default:
+            a0[6] -= a12[13] == sp->count - x - n < x;
+        }
+    }
+    for (i = 0; i < 62; i++) {
+        p[2] = sp->count * a1[1];
+    }
+    for (i = 0; i < 43; i++) {
+        sp->count |= 52 >= 55 >= n != y ? 0xf8d3 : (a10[2]);
+    }
+    st.hi += (- f28(a14[1], a4[11]));
+    p[1] = f14(a7[5] != a8[8], 0x6ce6 ? 0x27e6 : n);
+    st.hi += st.lo && 132 > x | p[0] && ((short) 0x7523);
+    return ((long) - a4[10]) ? (a3[8]) ^ ((unsigned long) n) : (((long) p[3]));
+}
+
+long fn_126(long x, long y, long n, long *p)
+{
+    if (~ a4[3] >= x) {
+        y ^= (x > 804 ? 0xb0e3 >= 663 : sp->count);
+    } else {
+        x = ((unsigned long) f1(a10[3], st.lo)) || f5(a7[1], 0xc451) ? y != x : 772;
+    }
+    {
+        {
+            a4[11] ^= sp->count;
+            st.hi -= (~ a4[6] | sp->lo);
+        }
+        st.hi -= ((int) (sp->count)) <= g33 != (y);
+    }
+    if (n) {
+        sp->count = a7[2] - ~ ((short) x);
+    } else {
+        while (x) {
+            switch (n) {
+            case 5:
+                p[0] += a13[15];
+                break;
+            default:
+                {
+                    a0[13] += 854;
+                    sp->count -= n;
+                }
+            }
+            n--;
+        }
+    }
+    if (((short) 15 + y)) {
+        if (a2[8] || 605 * - a0[5]) {
+            if (f18(g5, g39) && x == g3) {
+                {
+                    a6[10] |= y;
+                    p[1] -= sp->count;
+                }
+            } else {
+                for (i = 0; i < 26; i++) {
+                    sp->count ^= f30(a0[12], p[3] + sp->lo);
+                }
+            }
+        } else {
+            st.hi ^= 733 | 0x5cc0 >> (sp->count) < n >> sp->count >= ((int) a4[5]);
+        }
+    } else {
+        while (sp->count & a3[2]) {
+            {
+                p[3] = 0x9006 ? x : n ? ((unsigned long) g57) : st.lo - g20;
+                p[2] -= (st.hi != a10[11]);
+            }
+            n--;
+        }
+    }
+    switch (g18) {
+    case 9:
+        if (~ x >> (710)) {
+            x = a7[10];
+        } else {
+            st.hi -= f4(0x5d8f, 0x444e) ? ~ (g3) : ~ f27(x, st.lo);
+        }
+        break;
+    default:
+        a14[12] ^= f28(x, n) > 719 ? 875 : a13[9] >> f14(590, sp->count);
+    }
+    return x;
+}
+
+long fn_127(long x, long y, long n, long *p)
+{
+    p[0] += - f14(a8[9], x) ? ! sp->count : 0x5d5a;
+    st.hi -= ((unsigned long) ((unsigned long) (0xd74b)));
+    for (i = 0; i < 64; i++) {
+        a0[11] += a1[5];
+    }
+    {
+        while (~ st.lo) {
+            y = (77 || y > 0x8786 || n);
+            n--;
+        }
+        p[1] -= (a13[15]);
+    }
+    switch (x) {
+    case 9:
+        switch (n) {
+        case 2:
+            sp->count |= f27(0xb553, 0x49e8) + ((long) y >= 212);
+            break;
+        default:
+            if (a3[12] ^ 0x4413 ^ n <= p[2]) {
+                a13[1] = x >> 227 + a1[7] != n == 421;
+            } else {
+                sp->count -= (n);
+            }
+        }
+        break;
+    default:
+        if (467) {
+            sp->count |= f1(y, n) || (n) * 0x72c2 < 0xb0cf | st.lo;
+        } else {
+            n -= a8[2] < n | st.lo || (0xecbd);
+        }
+    }
+    for (i = 0; i < 40; i++) {
+        x += ! (- a10[0]);
+    }
+    return (sp->lo ? a8[13] : a1[1]) >> ~ n ^ n;
+}
+
+long fn_128(long x, long y, long n, long *p)
+{
+    {
+        for (i = 0; i < 1; i++) {
+            while (g33) {
+                switch (g29) {
+                case 1:
+                    st.hi |= (0xbc64 ? x : n > (n));
+                    break;
+                default:
+                    n ^= ((short) y);
+                }
+                n--;
+            }
+        }
+        sp->count ^= ((long) n);
+    }
+    while (f24(sp->lo, a9[9])) {
+        st.hi |= (881) + 901 >= a3[7] < sp->lo == 0x597c < 0x96d0 >= st.hi;
+        n--;
+    }
+    switch (x) {
+    case 1:
+        g44 ^= (0x4b61 <= x && x ? g58 : 0xfcc7);
+        break;
+    default:
+        sp->count -= a5[6] ? n >= 263 | sp->count ? n : 0xac75 : a9[5] - x && 349;
+    }
+    a13[7] |= ((short) (st.hi)) ^ 614;
+    while (0x105b & a10[12]) {
+        while (sp->lo) {
+            y |= y || 0xdb5d ^ 271 == g1 << f23(n, g34);
+            n--;
+        }
+        n--;
+    }
+    switch (g54) {
+    case 6:
+        while (n) {
+            while (sp->count >= 0xe9f9) {
+                g27 ^= 651 >= (((int) a5[1]));
+                n--;
+            }
+            n--;
+        }
+        break;
+    default:
+        g28 -= f2(0x75cd, 896) + a9[3] * a5[6] >> (sp->lo);
+    }
+    switch (x) {
+    case 1:
+        if (a12[13] >= 0x400f & f3(0x868a, a1[5])) {
+            while (159) {
+                switch (g40) {
+                case 5:
+                    p[1] = f18(~ 788, st.hi + 0x8e24);
+                    break;
+                default:
+                    y ^= ((long) ((long) 0xe9cc));
+                }
+                n--;
+            }
+        } else {
+            switch (g34) {
+            case 9:
+                switch (n) {
+                case 1:
+                    a14[14] |= (0x7db7 + 0xd1ae) > 699;
+                    break;
+                default:
+                    a14[10] ^= ((long) y);
+                }
+                break;
+            default:
+                while (n) {
+                    x -= f15(! 561, 104);
+                    n--;
+                }
+            }
+        }
+        break;
+    default:
+        {
+            while (~ 0x2d08) {
+                while ((p[2])) {
+                    sp->count = ((int) (a11[6]));
+                    n--;
+                }
+                n--;
+            }
+            g32 |= 0x5765 + y & f6(a6[1], a6[9]) ? ((int) 0x9839 < g2) : 0xf92c + 0x6e76 ? 162 : 540;
+        }
+    }
+    while (st.lo < sp->count) {
+        switch (n) {
+        case 2:
+            p[0] |= 0xde74 || ((short) ((unsigned long) 950));
+            break;
+        default:
+            st.hi |= (((long) 0xeb1d) ? p[0] : ((short) 922));
+        }
+        n--;
+    }
+    for (i = 0; i < 16; i++) {
+        for (i = 0; i < 79; i++) {
+            a14[6] += (f11(a14[13], 238));
+        }
+    }
+    for (i = 0; i < 16; i++) {
+        for (i = 0; i < 47; i++) {
+            switch (g32) {
+            case 5:
+                {
+                    p[0] -= n | n ? 929 != x : st.hi ^ 0xa1b < x;
+                    sp->count ^= a11[11];
+                }
+                break;
+            default:
+                for (i = 0; i < 58; i++) {
+                    y -= ((int) f12(380, y)) >> f31(a6[1], y);
+                }
+            }
+        }
+    }
+    return y && f31(p[0], x) ? st.lo * 0x7991 : - 689;
+}
+
+long fn_129(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 64; i++) {
+        for (i = 0; i < 6; i++) {
+            switch (y) {
+            case 8:
+                n ^= g36 == 0x8804 > f0(458, 297) >> 745;
+                break;
+            default:
+                st.hi |= - a13[9];
+            }
+        }
+    }
+    {
+        sp->count += 641;
+        sp->count = a14[3];
+    }
+    for (i = 0; i < 92; i++) {
+        switch (x) {
+        case 7:
+            x |= (x == x ? g27 : (a2[3]));
+            break;
+        default:
+            g60 -= ((int) 716);
+        }
+    }
+    while ((0x3c82)) {
+        for (i = 0; i < 4; i++) {
+            st.hi ^= 0x360c;
+        }
+        n--;
+    }
+    {
+        st.hi += n;
+        p[2] |= ((int) a12[4]) + sp->lo ? y : ! a13[10];
+    }
+    {
+        p[2] ^= (0xf36d);
+        p[2] += y == y < 382 ^ y & g31 && ~ 926;
+    }
+    while (a11[1] ? g32 : g17) {
+        for (i = 0; i < 23; i++) {
+            st.hi += ((unsigned long) 735);
+        }
+        n--;
+    }
+    {
+        p[3] += - 746 != (st.hi) ? ((unsigned long) x) : f23(x, sp->lo);
+        g30 = (a2[8] >> ((long) g30));
+    }
+    return x;
+}
+
+long fn_130(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 57; i++) {
+        st.hi |= g23 ? n : x + f26(x, g53) ? f24(a0[14], x) + y || g2 : g20;
+    }
+    sp->count ^= (705);
+    p[2] -= (((short) sp->count) & 264);
+    if (a12[8]) {
+        x = a9[14];
+    } else {
+        {
+            a12[0] ^= ! 240 > x >= st.hi;
+            x ^= f7(st.hi, 4 * 548);
+        }
+    }
+    sp->count |= (20);
+    for (i = 0; i < 25; i++) {
+        st.hi |= 990;
+    }
+    a4[5] -= (0x814f & 809 ? st.lo : g47);
+    sp->count = y;
+    return - g62 >> 20 ^ st.lo;
+}
+
+long fn_131(long x, long y, long n, long *p)
+{
+    a10[14] += 0xada8;
+    sp->count -= ~ n;
+    a7[0] |= f25(((unsigned long) g34), n | n);
+    {
+        g11 |= 0x78cd << 365 * 0x340 ? sp->count : a1[13] & ((long) - 167);
+        p[2] += 0x60a ^ sp->lo;
+    }
+    switch (y) {
+    case 5:
+        sp->count ^= ! st.hi;
+        break;
+    default:
+        x ^= a9[10];
+    }
+    {
+        if (f12(0x8fc0, 663)) {
+            if (f6(g28, a15[11])) {
+                {
+                    n += ! ((unsigned long) f26(0x881f, g49));
+                    a10[3] ^= 100 <= - sp->lo > g22;
+                }
+            } else {
+                sp->count |= ! - 78 & n == 466;
+            }
+        } else {
+            n = g47;
+        }
+        st.hi |= y ? sp->count >= sp->lo || sp->count <= y : g54;
+    }
+    switch (n) {
+    case 9:
+        for (i = 0; i < 90; i++) {
+            p[3] = ((unsigned long) a3[3] != 598 - y);
+        }
+        break;
+    default:
+        sp->count |= n;
+    }
+    while (g37 == p[2]) {
+        st.hi = ((int) sp->lo >> a5[11] << f29(a14[8], y));
+        n--;
+    }
+    p[1] = f1(~ a3[3], ((int) 515));
+    return ((short) g28) != f7(x, n) ? 888 > n + g49 : ((int) sp->count) ? f13(x, st.lo) : f11(a12[13], sp->count);
+}
+
+long fn_132(long x, long y, long n, long *p)
+{
+    while (0x7832) {
+        p[0] += ((short) ~ g39);
+        n--;
+    }
+    switch (x) {
+    case 8:
+        p[1] |= 858;
+        break;
+    default:
+        {
+            switch (x) {
+            case 8:
+                g53 += ~ (x | a1[15]);
+                break;
+            default:
+                sp->count ^= (y) == sp->lo ? 679 : st.hi & x | 0xe8ca;
+            }
+            p[1] = ((unsigned long) y) > p[0] < (260 >> st.lo);
+        }
+    }
+    {
+        switch (y) {
+        case 4:
+            st.hi -= a8[7] ? ((int) x) : g10 | 661 || - 0x8f2c << g47 ? n : 879;
+            break;
+        default:
+            while (x && a14[7]) {
+                x += ((long) sp->count - 0xaef8) > 46 ? ~ sp->lo : g34 ? 211 : y;
+                n--;
+            }
+        }
+        p[1] += (n) << st.lo >> y > ((short) st.lo * a10[8]);
+    }
+    return 148 ? y : st.lo | ((unsigned long) g41) != y & 801 ? sp->lo <= x : a3[12];
+}
+
+long fn_133(long x, long y, long n, long *p)
+{
+    {
+        sp->count -= - g60 > n ? (683) : 50;
+        sp->count ^= y - x < g52 == x;
+    }
+    while (((unsigned long) 0x3156)) {
+        y |= ((short) n);
+        n--;
+    }
+    for (i = 0; i < 84; i++) {
+        a2[4] |= a11[6];
+    }
+    if (0x4aa0 ^ 277 && y >= sp->count) {
+        x += ((int) a3[4]) & p[0] - 481 * 0xbad1 && x || st.hi ^ x;
+    } else {
+        switch (y) {
+        case 2:
+            for (i = 0; i < 86; i++) {
+                sp->count += (f10(a11[2], x) ? f3(a14[1], 90) : 918 == 0x6c12);
+            }
+            break;
+        default:
+            if (a11[13] ? a7[14] : x && a8[4] || 0x60b5) {
+                st.hi += f20(st.hi, g46) | x ? f2(a3[6], g8) : ((unsigned long) sp->lo) < x;
+            } else {
+                if (a9[7] && n >> 0x7ef) {
+                    st.hi -= st.lo ? ((unsigned long) a7[15] == 933) : (0x46d) | a9[5];
+                } else {
+                    st.hi |= ((long) f13(y, st.hi) ? 0x7f0 * n : - 0x3799);
+                }
+            }
+        }
+    }
+    return ((short) ((int) 149 & 0x75f8));
+}
+
+long fn_134(long x, long y, long n, long *p)
+{
+    p[1] ^= ((int) ((int) 0x7442)) + f30(0xb257, a3[5]);
+    {
+        a1[9] ^= ! x + a13[14] & x ? 303 : x;
+        sp->count |= ~ f20(0xd931, 0xa659);
+    }
+    sp->count |= a10[0];
+    {
+        switch (n) {
+        case 8:
+            if (st.hi) {
+                g15 -= ((int) 544 || n) * - 0x8558 < n;
+            } else {
+                if (f10(y, 0x54db)) {
+                    st.hi = (a11[13]) && ((int) x) || g24;
+                } else {
+                    p[0] -= f3(0x746b, f17(n, 135));
+                }
+            }
+            break;
+        default:
+            while (0x7b69) {
+                switch (x) {
+                case 5:
+                    sp->count ^= (a2[4] - f13(760, 879));
+                    break;
+                default:
+                    sp->count ^= st.lo >> ((unsigned long) n) != 0x9eb2;
+                }
+                n--;
+            }
+        }
+        n ^= g39 - - sp->lo <= a4[4] - x;
+    }
+    for (i = 0; i < 93; i++) {
+        a13[7] ^= 851 <= ~ a7[0] >> g32 > 0x343b;
+    }
+    switch (n) {
+    case 7:
+        if (((long) n)) {
+            a15[15] -= st.lo >> f23(0xaa20, 591) != g57 & 476;
+        } else {
+            p[3] -= st.hi;
+        }
+        break;
+    default:
+        a15[1] ^= f6(y, 444) && (n - st.lo);
+    }
+    for (i = 0; i < 76; i++) {
+        p[3] ^= ((int) f31(a11[3], a5[6]));
+    }
+    while (a3[10] ? 142 : g19) {
+        switch (n) {
+        case 2:
+            if (912) {
+                switch (y) {
+                case 4:
+                    a0[10] |= p[1];
+                    break;
+                default:
+                    a9[0] ^= ~ p[2] <= f28(93, x) <= f31(a8[1], 812) ? 0x34b5 | g38 : 195 > g30;
+                }
+            } else {
+                p[2] ^= (a12[14] & x ? 0xaf0c : 0xb1cb <= 445);
+            }
+            break;
+        default:
+            {
+                sp->count |= x;
+                p[1] |= ~ 0x2769 && 739 ? a12[0] : n ? sp->count : g28 == 882;
+            }
+        }
+        n--;
+    }
+    {
+        a9[0] ^= a7[12];
+        sp->count -= f17(x, 965) && (((short) p[1]));
+    }
+    return st.lo << ((unsigned long) g28 < 962);
+}
+
+long fn_135(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 18; i++) {
+        switch (y) {
+        case 4:
+            sp->count = y;
+            break;
+        default:
+            p[1] ^= 0x894b - sp->count ? n : 709 * ! 723 << a13[9];
+        }
+    }
+    while (p[1]) {
+        for (i = 0; i < 75; i++) {
+            while (a3[10]) {
+                if (x) {
+                    p[0] -= ~ ((long) y);
+                } else {
+                    p[2] = y ? 141 : 0xe7cb * x || sp->lo ? f7(0xe022, 0xe5bf) + - st.hi : y == y ? st.lo << g42 : ((int) n);
+                }
+                n--;
+            }
+        }
+        n--;
+    }
+    {
+        if (sp->lo <= x == a7[2] && 147) {
+            while ((561)) {
+                while (f20(0x122d, st.lo)) {
+                    a7[0] |= ~ x;
+                    n--;
+                }
+                n--;
+            }
+        } else {
+            p[3] ^= (n ? 286 : p[0] ? (p[0]) : - 767);
+        }
+        a1[8] -= g32 <= 0xe3d2;
+    }
+    return 0x874;
+}
+
+long fn_136(long x, long y, long n, long *p)
+{
+    switch (y) {
+    case 3:
+        {
+            if (x || 0x9a3d <= 79) {
+                a7[2] ^= f14(n, ~ 473);
+            } else {
+                sp->count += f2(f30(sp->lo, a13[13]), st.hi <= 733);
+            }
+            n ^= - 818;
+        }
+        break;
+    default:
+        st.hi = a10[6] == y ^ sp->lo == - 121;
+    }
+    for (i = 0; i < 47; i++) {
+        for (i = 0; i < 89; i++) {
+            y = ((unsigned long) f14(st.hi, 0x26f1));
+        }
+    }
+    sp->count -= sp->lo <= (g37 || 80);
+    {
+        while (a14[11] ? 0x53c4 : st.hi) {
+            {
+                sp->count -= sp->lo;
+                x ^= (0xc3cb) ^ a11[12] || 0x60d != ((short) 279) ^ st.hi & g2;
+            }
+            n--;
+        }
+        st.hi = (0x2d33) != 0x8873 ? a1[9] : y >> sp->lo;
+    }
+    if (n == a15[7] != x) {
+        st.hi |= st.lo ? a4[12] : g22 || ((int) a10[9]) ? ((short) y > 0xcab5) : a13[0] | 0x2cf4 ? ~ g59 : ((short) 0x385);
+    } else {
+        st.hi += ~ y ^ y * g29;
+    }
+    switch (y) {
+    case 8:
+        a15[15] += n <= 214 | ((unsigned long) sp->lo) == (852) && ! st.lo;
+        break;
+    default:
+        p[0] ^= - a11[5];
+    }
+    return y;
+}
+
+long fn_137(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 11; i++) {
+        while (0xed86 || 0xa5a2) {
+            a1[0] += n ? a1[6] : 0x7dc1 ? 0x9ccc : 739 || st.lo || ~ g54;
+            n--;
+        }
+    }
+    switch (y) {
+    case 4:
+        while (g44) {
+            switch (x) {
+            case 6:
+                if (y ? p[3] : 0x6ce6 << ((long) x)) {
+                    sp->count ^= ((long) 592 == 0xc821);
+                } else {
+                    sp->count |= sp->lo;
+                }
+                break;
+            default:
+                switch (y) {
+                case 9:
+                    st.hi = a2[1] <= n <= 0xb960 << n || f4(0xcd2b, a11[0]);
+                    break;
+                default:
+                    a13[6] ^= f18(x >> a8[4], f21(x, 253));
+                }
+            }
+            n--;
+        }
+        break;
+    default:
+        if (f13(g43, st.lo)) {
+            if ((f5(a13[10], 419))) {
+                if (f24(901, 0x4ce4) | 40 ? 0x9a53 : g46) {
+                    a12[11] |= - 0x4a7b;
+                } else {
+                    x = y << 0x9f02 < a5[7] <= (x) - 101 | g57;
+                }
+            } else {
+                sp->count -= ((long) (0xcf92));
+            }
+        } else {
+            st.hi |= (~ y) >= x;
+        }
+    }
+    for (i = 0; i < 9; i++) {
+        {
+            sp->count = a13[9] >> y;
+            st.hi += f31(a14[0], a5[0]) || ((short) ((long) g3));
+        }
+    }
+    sp->count |= ((short) a1[9] | a9[6]) | g23;
+    switch (y) {
+    case 2:
+        p[2] += ((short) 493) != 864 | ! x | 534;
+        break;
+    default:
+        p[0] ^= 243 | 611 + a2[14] * ((long) sp->count + y);
+    }
+    n -= f28(st.lo, st.hi) << 0x63ba;
+    {
+        {
+            {
+                n |= 0xc601;
+                st.hi -= (y);
+            }
+            st.hi |= ((int) y);
+        }
+        sp->count ^= ((unsigned long) 168 ? y : 0xda92 ? a4[13] == g0 : - n);
+    }
+    return f8(sp->lo, 756) | 0xe3ab < a5[4] <= x < (sp->lo);
+}
+
+long fn_138(long x, long y, long n, long *p)
+{
+    x += f21(a10[11] ? n : 0x6294, 777 ? y : 741);
+    switch (x) {
+    case 8:
+        switch (n) {
+        case 2:
+            x -= f24(y, (383));
+            break;
+        default:
+            sp->count = ((int) - y);
+        }
+        break;
+    default:
+        switch (g18) {
+        case 0:
+            a10[7] ^= - 0x1afb;
+            break;
+        default:
+            st.hi ^= (x) != sp->lo <= n;
+        }
+    }
+    {
+        st.hi -= 0x1d6a;
+        st.hi ^= ((int) sp->count + g22) + (sp->count) - - y;
+    }
+    y |= st.lo * f23(a15[0], st.hi) ? st.hi : sp->count - a15[9];
+    for (i = 0; i < 97; i++) {
+        p[1] += - a11[0];
+    }
+    return y;
+}
+
+long fn_139(long x, long y, long n, long *p)
+{
+    if ((a0[15] ? p[2] : y)) {
+        y |= 0x4737;
+    } else {
+        p[1] |= ((int) ~ 0x4833 ? x : sp->lo ? st.lo : a7[12]);
+    }
+    if (n) {
+        switch (x) {
+        case 2:
+            switch (x) {
+            case 1:
+                a0[2] ^= 297;
+                break;
+            default:
+                p[2] = ((unsigned long) 0x3aac <= sp->lo) > a4[8];
+            }
+            break;
+        default:
+            if (f30(a14[14], p[2]) & g56) {
+                g14 ^= a13[7];
+            } else {
+                x ^= f20(x, 876) ? y | 279 : f8(x, n) << sp->count;
+            }
+        }
+    } else {
+        sp->count += ((unsigned long) 0xd0a1) < x & 490 < 0xeb81 != f22(235, n);
+    }
+    for (i = 0; i < 71; i++) {
+        st.hi |= a15[0] << x ? g43 : ((unsigned long) a13[14]) - x;
+    }
+    while (131) {
+        switch (n) {
+        case 5:
+            switch (y) {
+            case 0:
+                a1[12] = (y) ^ ! g19 >= g4;
+                break;
+            default:
+                p[3] -= 549 * ((int) ((long) st.hi));
+            }
+            break;
+        default:
+            if (n) {
+                switch (x) {
+                case 2:
+                    p[2] += ((unsigned long) 0xae94);
+                    break;
+                default:
+                    sp->count += 0x3708;
+                }
+            } else {
+                st.hi -= (g7);
+            }
+        }
+        n--;
+    }
+    switch (y) {
+    case 2:
+        while (g43 ^ st.lo) {
+            switch (x) {
+            case 7:
+                sp->count -= (a13[7] | (272));
+                break;
+            default:
+                a9[4] = f23(a0[0], sp->count) <= sp->count;
+            }
+            n--;
+        }
+        break;
+    default:
+        g30 |= ~ a15[11] > (n) << f8(y, 92);
+    }
+    return ((unsigned long) a5[15] >= a10[14]) <= ! a7[15] - x;
+}
+
+long fn_140(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 27; i++) {
+        st.hi = g37 - st.lo ? a0[0] : a4[1] ^ 685 ? a2[9] : n;
+    }
+    sp->count = f30(g23, sp->lo) != ~ n;
+    {
+        sp->count -= sp->count;
+        sp->count |= f28(a9[0], 0x72ae) < ~ st.lo >= 0xb440;
+    }
+    {
+        if ((f25(g44, n))) {
+            sp->count += ((((short) p[3])));
+        } else {
+            st.hi |= 0x95cb ? n : sp->count <= st.lo;
+        }
+        a8[11] ^= f5(656, a11[6]) << x ? st.lo : 0xb9de >= g2 || a13[4];
+    }
+    if (a3[5]) {
+        switch (y) {
+        case 7:
+            {
+                sp->count += sp->lo - f20(0x41e0, 0xf90d);
+                p[3] += ~ a0[2] != 0xcac0;
+            }
+            break;
+        default:
+            for (i = 0; i < 48; i++) {
+                sp->count = 0x1150 ? 0xef1e : a11[15] ? x >> 27 : (x) | sp->lo < n > n;
+            }
+        }
+    } else {
+        while (x) {
+            a3[5] |= ~ 0x2d30 != (a2[11]);
+            n--;
+        }
+    }
+    {
+        {
+            switch (g16) {
+            case 6:
+                sp->count -= - f14(sp->count, 0x3e1f) != ((short) ((long) g20));
+                break;
+            default:
+                st.hi -= 265 ? a1[12] : x ? p[1] : a4[9] < a4[13] * n || st.lo;
+            }
+            st.hi -= a14[15] < sp->count || 0x2d7a * st.lo;
+        }
+        a10[0] += (st.hi ? x : y) || ! (809);
+    }
+    switch (n) {
+    case 3:
+        x = a11[11] ? a10[6] : 0x63c7 && a4[9] - 0xe134 & (n);
+        break;
+    default:
+        switch (y) {
+        case 2:
+            while (a11[12]) {
+                p[3] |= 607;
+                n--;
+            }
+            break;
+        default:
+            {
+                p[1] -= 906 * f17(x, a4[12]) * a15[9];
+                x -= x;
+            }
+        }
+    }
+    return (a11[1] ? a7[13] : x) & (n + 0x9b2e);
+}
+
+long fn_141(long x, long y, long n, long *p)
+{
+    {
+        a7[2] = - st.lo ? a15[13] : (0xdcba || g11);
+        st.hi -= y | a12[7];
+    }
+    sp->count ^= n > 0xe035 + 0xcf0b ? 0xca32 : f0(x, x) ? f25(x, y) : x ^ g56;
+    if (a8[12] ? y : g25 ^ ! g33) {
+        y += a2[9] - (f24(p[0], 937));
+    } else {
+        a5[2] ^= (sp->count) && 513 != g38 + ! a2[15] ? 542 : g4 || y;
+    }
+    while (f9(0x40a1, x)) {
+        a1[4] -= (0x50bc);
+        n--;
+    }
+    for (i = 0; i < 5; i++) {
+        a5[5] = a1[14];
+    }
+    for (i = 0; i < 4; i++) {
+        while (x >= n) {
+            a11[7] ^= st.lo << g49 == 0x793c == x >= f20(st.hi, x);
+            n--;
+        }
+    }
+    while (- y) {
+        while (772 && g21) {
+            switch (g38) {
+            case 8:
+                while (p[3] ? a15[10] : x) {
+                    sp->count -= a2[14];
+                    n--;
+                }
+                break;
+            default:
+                a15[15] ^= ((sp->lo >= x));
+            }
+            n--;
+        }
+        n--;
+    }
+    for (i = 0; i < 46; i++) {
+        if (g26 >= 0x1733 ? 0x3896 | a2[2] : n > 111) {
+            sp->count = f6((0xe418), 0x4f1f);
+        } else {
+            sp->count += (0x778e) ? 405 ? 0xd982 : 399 : y & st.hi - ((unsigned long) n);
+        }
+    }
+    if (~ g16 < 0x57d9) {
+        for (i = 0; i < 10; i++) {
+            for (i = 0; i < 85; i++) {
+                while (((short) a6[3])) {
+                    p[2] = (0x30fa) & ((unsigned long) y) ? f0(sp->count, 184) : 785 > y * f12(y, x);
+                    n--;
+                }
+            }
+        }
+    } else {
+        {
+            for (i = 0; i < 18; i++) {
+                for (i = 0; i < 74; i++) {
+                    p[3] += ! a11[6] && (y);
+                }
+            }
+            st.hi += 0x6c77;
+        }
+    }
+    switch (x) {
+    case 3:
+        switch (n) {
+        case 6:
+            sp->count -= ~ 0xabe3 >= p[1];
+            break;
+        default:
+            if (~ 752 >> st.hi) {
+                sp->count -= a2[14];
+            } else {
+                st.hi += p[1] == 717 > sp->count ? g35 ? x ? y : n : ((int) y) : ((unsigned long) 0x7af5 ? 0x1e43 : 767);
+            }
+        }
+        break;
+    default:
+        for (i = 0; i < 55; i++) {
+            g9 |= st.lo;
+        }
+    }
+    return a5[8];
+}
+
+long fn_142(long x, long y, long n, long *p)
+{
+    {
+        st.hi |= 705;
+        st.hi = f7(x || a6[15], 0x4d66 != st.lo);
+    }
+    if (((long) (n))) {
+        n = (~ n) <= p[1] << sp->count ? 44 >= p[1] : st.hi;
+    } else {
+        for (i = 0; i < 6; i++) {
+            g35 -= ~ a7[6];
+        }
+    }
+    a15[0] = ((unsigned long) f18(a3[15], 296));
+    {
+        switch (n) {
+        case 0:
+            sp->count += ((unsigned long) 0x81cc ? y | a9[3] : sp->lo < 445);
+            break;
+        default:
+            while (y) {
+                while ((g5)) {
+                    p[1] |= ! g2 ? f13(492, x) : ((int) a8[5]);
+                    n--;
+                }
+                n--;
+            }
+        }
+        st.hi -= ((long) 249) > 510 <= sp->count | (326);
+    }
+    {
+        while (- p[3]) {
+            sp->count |= f13(a5[0], 129);
+            n--;
+        }
+        st.hi = x;
+    }
+    x = f23(g25, 0x9b38) < p[0] ? g29 : p[3] + 502 || 0x2e0a | ~ n;
+    a8[11] += a2[10];
+    return sp->lo + g62 ? st.lo < 338 : f16(a5[11], st.hi) >> n <= sp->lo < g5;
+}
+
+long fn_143(long x, long y, long n, long *p)
+{
+    a15[8] += sp->count ? 558 : (((unsigned long) sp->count));
+    if (827 == a14[7]) {
+        if (446) {
+            a3[6] += (0x5593) ? (((long) 178)) : a14[9] | sp->lo < 0xfa92 || a11[7];
+        } else {
+            sp->count ^= y * x * p[3] < 0xc048;
+        }
+    } else {
+        {
+            sp->count ^= (696 >> 0x7251) ^ st.hi;
+            sp->count += a11[9];
+        }
+    }
+    if (st.lo) {
+        p[1] += f17(y != x, 46);
+    } else {
+        n += a0[1] ? n : x && p[0] ? ((short) a15[5] != y) : a15[13] & y ? ((unsigned long) a2[12]) : ~ y;
+    }
+    a9[13] += f2(sp->count, 373) << st.hi == p[3] < n || a10[10];
+    switch (x) {
+    case 2:
+        st.hi |= f20(f9(715, st.hi), f17(0x5cf, g44));
+        break;
+    default:
+        switch (n) {
+        case 1:
+            for (i = 0; i < 19; i++) {
+                {
+                    a0[13] += ((short) 0x652 >> 0x7ef4 << y ? 728 : 0x6b8e);
+                    p[2] -= x;
+                }
+            }
+            break;
+        default:
+            if (((long) f11(a8[9], 0xe76c))) {
+                {
+                    p[2] = a13[2] < y && g63 == 0xd0ea && g6;
+                    a3[8] -= f6(213, 0xab6c) < 0x6a97 ? 0x494c : p[0] | ((long) a15[11]);
+                }
+            } else {
+                a13[0] ^= n != x * 74 >> a2[12];
+            }
+        }
+    }
+    if (st.lo) {
+        sp->count |= ((long) a8[14] | a10[8]) > a3[0];
+    } else {
+        st.hi -= n;
+    }
+    {
+        st.hi += 672 == - g28 > 0xd44a ^ g60 == 823;
+        sp->count ^= ((long) (! 414));
+    }
+    while (y + g4) {
+        for (i = 0; i < 51; i++) {
+            if (((short) ! a13[5])) {
+                switch (y) {
+                case 4:
+                    st.hi -= - (a15[11] - x);
+                    break;
+                default:
+                    p[1] = (a14[7]) << (x) && 654;
+                }
+            } else {
+                while (717 < sp->count) {
+                    sp->count += x != a1[13] ? y : st.hi == g6;
+                    n--;
+                }
+            }
+        }
+        n--;
+    }
+    return f19(~ 0x926e, f21(x, a3[6]));
+}
+
+long fn_144(long x, long y, long n, long *p)
+{
+    x = a13[14] - n + a14[10] || g30 == 156;
+    st.hi |= ((long) f28(x, a3[3]) >= 637 ? g54 : n);
+    switch (x) {
+    case 2:
+        switch (y) {
+        case 6:
+            sp->count -= (111) >= n;
+            break;
+        default:
+            p[2] = a8[4];
+        }
+        break;
+    default:
+        while (881 << 0xedb4) {
+            p[0] -= ((unsigned long) ~ a7[12] + a2[0] == a5[7]);
+            n--;
+        }
+    }
+    g53 ^= f7(706, g20) == ~ sp->count ^ 107;
+    {
+        a1[4] = sp->count;
+        x = (st.hi);
+    }
+    {
+        for (i = 0; i < 51; i++) {
+            while (st.lo ? 0x937d : 0xfc5b) {
+                a6[2] -= a1[6] ^ n ? 234 : 0x51c6 ^ x ? sp->count == 286 ? 487 : a12[8] : ~ f0(52, 0x5258);
+                n--;
+            }
+        }
+        st.hi |= 0xfc99 && ~ (934);
+    }
+    switch (y) {
+    case 3:
+        if (sp->lo != 544 < a13[6] < st.lo) {
+            if ((f1(300, y))) {
+                sp->count -= f24(n & y, (142));
+            } else {
+                sp->count ^= (~ st.hi << (st.hi));
+            }
+        } else {
+            a2[10] |= ((int) sp->count);
+        }
+        break;
+    default:
+        switch (n) {
+        case 4:
+            if (~ 927) {
+                g8 += ! ((a6[8]));
+            } else {
+                g39 += y;
+            }
+            break;
+        default:
+            if (p[2]) {
+                st.hi ^= 629;
+            } else {
+                x = g52 ? g62 : 0xdca3 != 316 || st.hi;
+            }
+        }
+    }
+    return ((short) ((long) a14[9]));
+}
+
+long fn_145(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 81; i++) {
+        st.hi = f20(x == 0xc6ac, (st.lo));
+    }
+    if (((int) f17(0xcffe, x))) {
+        while (582 ? g36 : sp->lo) {
+            for (i = 0; i < 95; i++) {
+                sp->count += ! st.hi;
+            }
+            n--;
+        }
+    } else {
+        p[1] -= (f16(x, 0x47b0));
+    }
+    {
+        while (a7[10] ? st.hi : 0x8821) {
+            st.hi |= f23(((long) n), p[3] & x);
+            n--;
+        }
+        sp->count |= f3(f24(622, 0x4c5b), ((unsigned long) 0xcc8f));
+    }
+    return (f9(a14[4], y)) < ((short) y);
+}
+
+long fn_146(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 20; i++) {
+        {
+            sp->count ^= (0x3a58);
+            y ^= f2(n ? st.hi : x, (p[3]));
+        }
+    }
+    p[3] -= f3(g51, a10[14]) | f28(153, y);
+    if (((unsigned long) f8(196, 551))) {
+        while (st.hi << y) {
+            switch (y) {
+            case 7:
+                st.hi |= g11;
+                break;
+            default:
+                st.hi += ! y ? n : st.lo - a2[5] == x;
+            }
+            n--;
+        }
+    } else {
+        if (sp->lo && (35)) {
+            for (i = 0; i < 59; i++) {
+                n |= (a0[2] ^ sp->lo & sp->count ? 0x14ca : n);
+            }
+        } else {
+            for (i = 0; i < 19; i++) {
+                st.hi ^= g10;
+            }
+        }
+    }
+    return ((short) f29(0xb907, st.hi)) != a7[4] <= sp->lo;
+}
+
+long fn_147(long x, long y, long n, long *p)
+{
+    st.hi |= f27(338, a8[3]) ^ ((long) x & x);
+    switch (g6) {
+    case 6:
+        {
+            if (0xd63d ^ 0xba97 + sp->lo) {
+                while (((long) a7[1])) {
+                    st.hi -= y;
+                    n--;
+                }
+            } else {
+                for (i = 0; i < 4; i++) {
+                    n ^= ((unsigned long) (199 * n));
+                }
+            }
+            a11[3] ^= (n);
+        }
+        break;
+    default:
+        n += sp->lo & ! p[2];
+    }
+    switch (x) {
+    case 8:
+        sp->count -= g20 << y ^ ! 0x603d && f7(a8[12], 45);
+        break;
+    default:
+        p[1] |= (a0[2]);
+    }
+    sp->count += 0xb0f8;
+    return - st.lo;
+}
+
+long fn_148(long x, long y, long n, long *p)
+{
+    st.hi += f2(y, (y));
+    for (i = 0; i < 65; i++) {
+        switch (y) {
+        case 3:
+            switch (n) {
+            case 5:
+                {
+                    y |= 171 ? g29 : 274 ? 0x93f >= sp->lo : (368) << 833 * st.hi ^ n;
+                    p[2] |= ((long) a11[9] && 730 + ((long) y));
+                }
+                break;
+            default:
+                while (st.hi ? x : p[2]) {
+                    st.hi = (a2[14] << y ^ 308);
+                    n--;
+                }
+            }
+            break;
+        default:
+            while (! sp->count) {
+                while ((n)) {
+                    p[2] += f13(f20(sp->lo, 495), 538 == y);
+                    n--;
+                }
+                n--;
+            }
+        }
+    }
+    while (x) {
+        st.hi ^= - sp->count;
+        n--;
+    }
+    st.hi += f30(630, 309 || 690);
+    if (f25(g58, y) == ((unsigned long) y)) {
+        for (i = 0; i < 3; i++) {
+            a1[7] -= ((unsigned long) sp->lo != 0xc3f4) != a15[3];
+        }
+    } else {
+        st.hi ^= a1[6] || ! - x;
+    }
+    p[0] -= ((unsigned long) 133);
+    if (310 | 82 * g56) {
+        st.hi -= 683 < (0x310a) || ! a13[2];
+    } else {
+        {
+            p[0] += f10(x, a4[1]) != (a3[13] ^ n);
+            p[0] ^= ~ 434 >= st.hi - 0xa66a << (932) ? x < a0[12] : st.hi | a12[2];
+        }
+    }
+    return ~ a5[0];
+}
+
+long fn_149(long x, long y, long n, long *p)
+{
+    switch (y) {
+    case 3:
+        sp->count = ~ y;
+        break;
+    default:
+        n |= (0xe25f ^ a6[11] ? sp->lo : y);
+    }
+    st.hi -= - a9[11] ? sp->count : st.hi + (145) ? 0x29ca & a1[12] : y ? 0x3c86 : a1[0];
+    while (618 || x) {
+        p[3] ^= 0x9820;
+        n--;
+    }
+    p[3] ^= - ~ ((unsigned long) n);
+    a9[5] = ((unsigned long) (p[3])) * 719;
+    for (i = 0; i < 100; i++) {
+        a9[2] = sp->lo ^ a0[15];
+    }
+    {
+        {
+            n += st.hi - a5[0] * f5(0x7836, n) < y >= y << x;
+            sp->count |= y > sp->count > ((short) y) | (a5[12]);
+        }
+        x |= x;
+    }
+    {
+        switch (y) {
+        case 5:
+            a10[13] -= f29((a0[15]), f12(199, a15[0]));
+            break;
+        default:
+            p[2] ^= a8[4];
+        }
+        a14[13] = ! x >= a6[3] >= p[3];
+    }
+    switch (n) {
+    case 6:
+        for (i = 0; i < 73; i++) {
+            {
+                sp->count |= ((g54)) + x || n && a5[2] ? x : sp->lo;
+                sp->count = - 0x32c5 | x > f27(y, n);
+            }
+        }
+        break;
+    default:
+        for (i = 0; i < 61; i++) {
+            y += 352;
+        }
+    }
+    return f14(n, st.hi || x);
+}
+
+long fn_150(long x, long y, long n, long *p)
+{
+    sp->count -= n ? a1[13] : 810 >= 501 || 0xd38f ? (741) : g0 >> sp->lo && 336;
+    {
+        g28 ^= a3[5] > ~ y * 0x54ba;
+        a8[13] -= f28(st.hi >= 79, (n));
+    }
+    y ^= f9(x ? n : sp->lo, 0x8fcd);
+    while (a12[5]) {
+        a13[4] ^= 0x50c0 ? sp->lo : n ? a13[5] >> 487 : f15(0x24a0, n) | ~ ! x;
+        n--;
+    }
+    return ((int) y) << ~ 0x19d3 <= ! f26(0x3bec, 0x5232);
+}
+
+long fn_151(long x, long y, long n, long *p)
+{
+    {
+        p[3] |= 839;
+        a9[2] = y;
+    }
+    p[0] |= 710;
+    st.hi ^= n | - (y);
+    x = f3(a5[3], 0x33c8);
+    y |= 0xb077;
+    for (i = 0; i < 57; i++) {
+        while (n >= sp->count) {
+            for (i = 0; i < 1; i++) {
+                a9[6] -= 0x16a2 == y ^ ((int) n) ? f2(a13[7], a5[10]) : (f11(sp->count, x));
+            }
+            n--;
+        }
+    }
+    {
+        st.hi += a4[12] + 43 | ((unsigned long) 338) - (f27(a10[13], a14[3]));
+        p[0] = ! ! st.hi ? y : 0xb984;
+    }
+    for (i = 0; i < 24; i++) {
+        p[0] -= 0xf6ca | 355 && 0x2050 & a5[9];
+    }
+    for (i = 0; i < 38; i++) {
+        sp->count += g15;
+    }
+    for (i = 0; i < 89; i++) {
+        if ((a14[12] + g4)) {
+            for (i = 0; i < 84; i++) {
+                for (i = 0; i < 64; i++) {
+                    sp->count |= a2[0];
+                }
+            }
+        } else {
+            if (451 <= 0xbeff ? g31 : f31(425, 175)) {
+                p[1] = (y * n) ? ! f10(539, 0xa944) : g10;
+            } else {
+                sp->count = y;
+            }
+        }
+    }
+    return sp->lo <= - - 0xf1ae;
+}
+
+long fn_152(long x, long y, long n, long *p)
+{
+    {
+        while (g34 ? y : 0x4289) {
+            sp->count -= ((int) f18(n, 358));
+            n--;
+        }
+        sp->count = 0x4210 & (n) ? (0x41c1) : (n);
+    }
+    for (i = 0; i < 50; i++) {
+        if (y) {
+            a3[1] += ! 0x96b5 && 138 <= 0x4414;
+        } else {
+            switch (n) {
+            case 8:
+                p[0] |= sp->lo;
+                break;
+            default:
+                st.hi |= a1[6];
+            }
+        }
+    }
+    st.hi += ! (y) || 0x4899 | 0x5e14;
+    while (- 0x49a9) {
+        a15[3] = y;
+        n--;
+    }
+    p[3] ^= ! sp->count < a3[3] <= f31(sp->count, 846);
+    if (a14[4]) {
+        {
+            switch (x) {
+            case 4:
+                sp->count -= (a11[13]);
+                break;
+            default:
+                n ^= 562 <= st.lo == (x) != ! ((short) p[1]);
+            }
+            p[3] = 818 + 0x725c ^ st.hi * x;
+        }
+    } else {
+        switch (g25) {
+        case 5:
+            switch (g31) {
+            case 6:
+                sp->count -= n;
+                break;
+            default:
+                p[0] = a1[3] ^ y & 0xacaf != sp->lo || st.lo;
+            }
+            break;
+        default:
+            for (i = 0; i < 31; i++) {
+                sp->count |= a3[6];
+            }
+        }
+    }
+    return ((int) ~ 0x6e92 || 615);
+}
+
+long fn_153(long x, long y, long n, long *p)
+{
+    switch (y) {
+    case 3:
+        p[0] = ((unsigned long) f18(707, a7[11]));
+        break;
+    default:
+        a11[11] -= (259);
+    }
+    a9[5] -= g39;
+    {
+        {
+            while (f19(0x3731, a11[9])) {
+                p[1] ^= st.lo << ((long) 0xb7a5) | ((long) n);
+                n--;
+            }
+            st.hi ^= ! f2(x, 198) == p[3];
+        }
+        g53 -= ((unsigned long) 0x15cb && y) << 638;
+    }
+    {
+        while (f3(sp->count, a7[4])) {
+            for (i = 0; i < 24; i++) {
+                if ((f27(st.lo, 273))) {
+                    x |= (((short) p[1])) << f20(0xefbf, 0x9938);
+                } else {
+                    sp->count ^= x == 0xd721 & a6[14] ^ - x;
+                }
+            }
+            n--;
+        }
+        x = f30(y, f0(st.lo, 300));
+    }
+    for (i = 0; i < 64; i++) {
+        sp->count ^= a1[0];
+    }
+    for (i = 0; i < 55; i++) {
+        switch (g5) {
+        case 8:
+            a10[3] += 228 >> x >= a8[8] >= y;
+            break;
+        default:
+            p[1] -= f23(sp->lo, f11(g37, g29));
+        }
+    }
+    while (a8[12]) {
+        while (y << x) {
+            {
+                st.hi -= p[3];
+                sp->count += f27(- 694, n != n);
+            }
+            n--;
+        }
+        n--;
+    }
+    {
+        for (i = 0; i < 9; i++) {
+            switch (g14) {
+            case 9:
+                st.hi ^= ~ 602 < p[2] >> a1[6] - (494);
+                break;
+            default:
+                for (i = 0; i < 60; i++) {
+                    sp->count -= ((int) st.lo);
+                }
+            }
+        }
+        x ^= ! ((short) g11 ^ st.lo);
+    }
+    switch (y) {
+    case 9:
+        sp->count ^= a14[4] == n ^ a0[13] ? a10[15] : a3[0] << ~ a0[3] ? g14 : st.lo;
+        break;
+    default:
+        a14[4] -= a2[13] != st.lo << 687 + 342;
+    }
+    p[3] += (g56 >= p[3]);
+    return ((long) f26(x, y));
+}
+
+long fn_154(long x, long y, long n, long *p)
+{
+    {
+        {
+            a13[2] |= ((unsigned long) (482));
+            n -= f9(x, 847) ? n : a6[6];
+        }
+        a4[6] |= (0xb30e) << sp->count + f22(sp->lo, sp->lo);
+    }
+    while (g60 != 371) {
+        p[2] ^= f29(a8[7], x) ? 765 : a9[7];
+        n--;
+    }
+    {
+        x = a4[2];
+        sp->count = - st.lo >> 98 && - g63 > x;
+    }
+    p[3] = 569;
+    {
+        n -= sp->count & x;
+        g47 = ~ 598 >> ((short) y) << 291 ^ sp->count == a3[2] == st.lo;
+    }
+    for (i = 0; i < 32; i++) {
+        while (y <= 0xfd10) {
+            sp->count += f14(((long) g39), sp->lo < a13[6]);
+            n--;
+        }
+    }
+    while (p[3] < n) {
+        p[1] = y + st.hi <= f23(957, 0xcf08) & (a9[6] < y);
+        n--;
+    }
+    return ((int) 0xe50a);
+}
+
+long fn_155(long x, long y, long n, long *p)
+{
+    sp->count += ((unsigned long) 0x8253);
+    {
+        switch (y) {
+        case 0:
+            for (i = 0; i < 75; i++) {
+                st.hi -= ! - 0xe04b << 346;
+            }
+            break;
+        default:
+            for (i = 0; i < 89; i++) {
+                a11[14] += 548;
+            }
+        }
+        st.hi |= ~ 970 ? (824) : a2[9] > a6[14];
+    }
+    {
+        a13[2] = 902;
+        p[1] += g0 | 596;
+    }
+    return y;
+}
+
+long fn_156(long x, long y, long n, long *p)
+{
+    a6[0] += 0xd60c && p[1];
+    st.hi += 543;
+    sp->count |= a12[7] >> 426;
+    a7[15] |= ! - y <= st.hi;
+    while ((g1)) {
+        {
+            sp->count -= f8(g15 << 0x391f, 0x85a);
+            st.hi += ~ ! x;
+        }
+        n--;
+    }
+    return (y);
+}
+
+long fn_157(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 74; i++) {
+        {
+            p[1] |= y;
+            st.hi -= (p[3]);
+        }
+    }
+    if (x - 942 | st.hi) {
+        x ^= 929;
+    } else {
+        switch (y) {
+        case 4:
+            n -= 0x1b2;
+            break;
+        default:
+            for (i = 0; i < 31; i++) {
+                n = (st.lo);
+            }
+        }
+    }
+    p[3] = - f12(x, sp->lo) < a14[10];
+    {
+        p[2] += 0x2575 * 0x959b <= ((unsigned long) 730) < ~ st.hi && a9[10];
+        st.hi -= - - ~ a15[2];
+    }
+    for (i = 0; i < 40; i++) {
+        st.hi = a5[13] < x > p[2] ? f7(0x406d, g51) << (a1[13]) : 763 < a11[2] & n * p[1];
+    }
+    switch (x) {
+    case 6:
+        y += 212;
+        break;
+    default:
+        a13[1] ^= sp->lo;
+    }
+    return (((int) a13[13] >> n));
+}
+
+long fn_158(long x, long y, long n, long *p)
+{
+    g39 = 591;
+    {
+        n += (0x665 ? a11[14] : n == ((short) a14[6]));
+        p[3] -= 0xd02a == a8[5] || 724 * sp->count + (((unsigned long) st.hi));
+    }
+    p[3] |= 0x86ae <= ! 0xfd9e * n ? st.lo : sp->lo;
+    while (0xae5e | g30) {
+        x |= ! 0xc764;
+        n--;
+    }
+    p[3] ^= a14[13] && f16(y, y) < f20(a7[1], st.hi);
+    while (f8(g6, 0x6003)) {
+        st.hi -= ~ 0x8d36 >> (g11) | 50;
+        n--;
+    }
+    return 0xafe2;
+}
+
+long fn_159(long x, long y, long n, long *p)
+{
+    if (0x8285) {
+        n ^= p[2] > ~ 0x1f77 | ((long) g30);
+    } else {
+        {
+            while (! n) {
+                a9[2] ^= sp->count;
+                n--;
+            }
+            sp->count += n;
+        }
+    }
+    n -= a11[1] ? 468 : 716 ? sp->lo <= a1[4] : (st.lo) - - y > (288);
+    if (n && x - a11[6]) {
+        {
+            sp->count = ((long) sp->lo ? 558 : p[0] | 565);
+            a14[11] ^= - ((int) ((int) x));
+        }
+    } else {
+        p[1] = sp->count - x;
+    }
+    while (x * g39) {
+        for (i = 0; i < 22; i++) {
+            switch (g26) {
+            case 3:
+                p[1] = 0xeb34 != ~ g47 != f5(y, y);
+                break;
+            default:
+                st.hi = 923 * 0x29b0;
+            }
+        }
+        n--;
+    }
+    return (p[3]) && f4(st.hi, a6[6]) && st.lo;
+}
+
+long fn_160(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 78; i++) {
+        if (a12[7]) {
+            sp->count |= (125 << 0x9e3c != st.hi & n);
+        } else {
+            y += ((int) (0x12fc < 0xa2bb));
+        }
+    }
+    switch (n) {
+    case 9:
+        sp->count -= - sp->lo;
+        break;
+    default:
+        sp->count += f11(a5[10] > p[0], (st.hi));
+    }
+    st.hi += g52;
+    for (i = 0; i < 44; i++) {
+        p[1] |= 0x9791;
+    }
+    return 941 - a12[4];
+}
+
+long fn_161(long x, long y, long n, long *p)
+{
+    if (f6(x, 358)) {
+        y ^= f30((sp->count), a11[4] & st.lo);
+    } else {
+        sp->count = (((long) g24) | x <= st.lo);
+    }
+    for (i = 0; i < 32; i++) {
+        for (i = 0; i < 92; i++) {
+            a5[3] -= (f10(g3, 478) * ((unsigned long) n));
+        }
+    }
+    {
+        x = (0x8ccd);
+        sp->count = (a10[7]);
+    }
+    sp->count ^= 0x7c11;
+    while (0x336e <= 0x9897) {
+        while ((644)) {
+            if (a9[13] ? 0xb308 : 838 <= ((int) a5[5])) {
+                st.hi = ! 820 || ((long) a13[4]);
+            } else {
+                st.hi -= ! 0x8d4 ? x : a15[15] | - st.lo <= 0xcb34;
+            }
+            n--;
+        }
+        n--;
+    }
+    g37 |= ((long) st.lo) ? (a13[4] ? 317 : 961) : ~ ~ n;
+    {
+        switch (g57) {
+        case 9:
+            sp->count -= f10(587, (p[2]));
+            break;
+        default:
+            x = 930;
+        }
+        p[3] |= ((int) y);
+    }
+    switch (g1) {
+    case 5:
+        while (((int) y)) {
+            for (i = 0; i < 15; i++) {
+                for (i = 0; i < 68; i++) {
+                    sp->count += (y <= st.hi >= 0xaf72);
+                }
+            }
+            n--;
+        }
+        break;
+    default:
+        {
+            while (- n) {
+                switch (n) {
+                case 2:
+                    n |= a13[5] >> st.hi ? ((int) a0[9]) : x;
+                    break;
+                default:
+                    g40 ^= f21(x << y, ! 0xd406);
+                }
+                n--;
+            }
+            st.hi ^= a11[12] >= 0x9666 >= n || 212;
+        }
+    }
+    n -= f15((sp->lo), 0xca25 != x);
+    while (a2[7] > a4[10]) {
+        st.hi = - 0x4c11 & sp->count < 174 << g48;
+        n--;
+    }
+    return ((0x12b7)) && g16 ? sp->count : g51 >= ! y;
+}
+
+long fn_162(long x, long y, long n, long *p)
+{
+    while (a10[2] ^ 0x50b2) {
+        if (((short) 909 & n)) {
+            sp->count += ! a1[11] < g27 ^ g10;
+        } else {
+            a4[12] -= (a15[2]) * g34 | p[3] * st.hi == 925;
+        }
+        n--;
+    }
+    a12[5] += n;
+    for (i = 0; i < 39; i++) {
+        y |= 894 || (x) ? f21(x, g22) : (st.hi);
+    }
+    return g16;
+}
+
+long fn_163(long x, long y, long n, long *p)
+{
+    while (a7[7]) {
+        sp->count += a10[4];
+        n--;
+    }
+    while (0x5722 << a13[13]) {
+        {
+            switch (g48) {
+            case 2:
+                while (sp->count + 0xa8e8) {
+                    n -= ! ! a11[14] ? ((long) 0x591d) : x;
+                    n--;
+                }
+                break;
+            default:
+                a5[13] -= 0x9212 ? f21(n, 286) : (0xa1d7) << - 984 ? p[2] : a2[15];
+            }
+            a12[13] -= g21;
+        }
+        n--;
+    }
+    switch (n) {
+    case 7:
+        {
+            switch (x) {
+            case 8:
+                st.hi += (0x3ae0 || a11[0]) != f11(g46, 0x92c9);
+                break;
+            default:
+                p[3] += x;
+            }
+            sp->count += a7[1];
+        }
+        break;
+    default:
+        st.hi += f5(955 & 714, 0x92b5 != 772);
+    }
+    while (((short) 0x93bf)) {
+        a2[6] -= 203 ? 0xbecf : - a13[11] || a11[1];
+        n--;
+    }
+    if (419 << 616 > f21(156, a15[11])) {
+        for (i = 0; i < 88; i++) {
+            sp->count -= a15[7];
+        }
+    } else {
+        {
+            for (i = 0; i < 69; i++) {
+                p[1] += n;
+            }
+            st.hi -= n;
+        }
+    }
+    return ~ a0[2] != x - 384 != x & n ? 684 : 372;
+}
+
+long fn_164(long x, long y, long n, long *p)
+{
+    switch (x) {
+    case 5:
+        sp->count ^= st.lo;
+        break;
+    default:
+        st.hi = (((int) st.lo) >> f15(a11[0], st.hi));
+    }
+    for (i = 0; i < 66; i++) {
+        st.hi -= ((short) a14[9]);
+    }
+    if (a13[14] == x ? n : 466) {
+        {
+            p[3] |= st.lo;
+            sp->count -= n && - g63 * ((long) 0x91b8);
+        }
+    } else {
+        while (0x1f95 | g61) {
+            a2[15] += (a14[8] & g55 ? st.lo : y);
+            n--;
+        }
+    }
+    sp->count += (((short) 151));
+    st.hi ^= ((int) - a1[11]) ? (552) ^ 342 : (0x132b <= 0xa9e4);
+    return - 0x4dca ^ a3[7] ? sp->count > sp->count > (y) : ((short) 0x4017 ? 298 : y);
+}
+
+long fn_165(long x, long y, long n, long *p)
+{
+    st.hi |= ((short) a11[15]) - a1[9] != ! - y;
+    for (i = 0; i < 87; i++) {
+        switch (x) {
+        case 9:
+            switch (n) {
+            case 2:
+                for (i = 0; i < 60; i++) {
+                    p[1] += n & ~ a10[2] & f9(sp->lo, sp->lo);
+                }
+                break;
+            default:
+                switch (n) {
+                case 3:
+                    y |= 977 < p[1] ? 0x702 ? 0x13b9 : st.lo : a11[5] <= y;
+                    break;
+                default:
+                    p[1] -= x;
+                }
+            }
+            break;
+        default:
+            while (a2[9] || 41) {
+                switch (x) {
+                case 7:
+                    a2[7] -= 0xb73d >= 281 & f3(n, a5[2]) | a5[12] && p[3] == 0x6744 ^ st.hi;
+                    break;
+                default:
+                    p[3] += y & 865 ? a12[1] - g6 : 0xebb6 < a9[0] ? - 0x702d : ((int) st.lo) ^ y;
+                }
+                n--;
+            }
+        }
+    }
+    for (i = 0; i < 60; i++) {
+        g55 |= 353 & a5[3] | p[3] > a12[3];
+    }
+    if ((35) * 376 ? n : 0xee1f) {
+        while (0x2b32 < 0xb7be) {
+            n |= ((int) (n) ? g60 : f16(0x9e31, 891));
+            n--;
+        }
+    } else {
+        for (i = 0; i < 86; i++) {
+            if (~ 0xee2a >> 21 <= a0[8]) {
+                p[0] -= 0xa4df < ~ 29 > y;
+            } else {
+                while ((st.hi)) {
+                    p[3] += n ^ 254 ? 0x8185 < 872 : - a0[4] > (0x37de);
+                    n--;
+                }
+            }
+        }
+    }
+    {
+        {
+            {
+                st.hi |= ((short) - 0x8022 <= 0x5310);
+                n -= f3(x, x) ? f11(88, 728) : a14[13] <= 0x90c1;
+            }
+            st.hi |= a13[4];
+        }
+        a14[12] |= ~ - x + 339;
+    }
+    while ((0x61d9)) {
+        for (i = 0; i < 23; i++) {
+            st.hi -= f14(0xd5e8, 989) + y;
+        }
+        n--;
+    }
+    if (f24(371, p[2])) {
+        n += ((int) ((short) y)) && - 0x19a6 - x;
+    } else {
+        st.hi ^= (0xc038 < g23 == - a1[0]);
+    }
+    switch (y) {
+    case 9:
+        if (a8[10] || 0x6c2b) {
+            while (((long) g21)) {
+                if (((long) x)) {
+                    p[1] = y;
+                } else {
+                    p[2] += a9[5] - a13[0] ? y : 270;
+                }
+                n--;
+            }
+        } else {
+            while (a4[10] < 0x9bab) {
+                while (818 * y) {
+                    st.hi += st.hi;
+                    n--;
+                }
+                n--;
+            }
+        }
+        break;
+    default:
+        y ^= n;
+    }
+    a10[5] = 875 >= (0x101e + 0xdfe6);
+    {
+        y |= sp->count ? n : sp->count < 423 > sp->lo || g62;
+        a15[6] |= - st.lo <= ~ (x);
+    }
+    return a8[6] ? g30 ? 0xce83 : sp->lo ? y ? n : st.lo : a12[11] + st.lo : f11(30, n);
+}
+
+long fn_166(long x, long y, long n, long *p)
+{
+    switch (n) {
+    case 8:
+        sp->count ^= ((long) 861 | a8[8]) > g49;
+        break;
+    default:
+        n = - ~ a15[3] ^ y * 298;
+    }
+    if (a6[3] < 0xeda5 <= y) {
+        {
+            st.hi |= (((long) ((long) p[0])));
+            y ^= y;
+        }
+    } else {
+        p[2] ^= ((short) f4(g62, y)) * ((short) ((int) g16));
+    }
+    {
+        p[2] |= ! x || 0xb93c << x;
+        st.hi = x + 544 | sp->count == 209 * (a9[15] >> 371);
+    }
+    switch (y) {
+    case 6:
+        if (n) {
+            y = 0x6dff + f8(0x79ec, 0xef7a) >> (a15[11]);
+        } else {
+            a13[4] -= (793 * sp->lo) == - 869 | 302;
+        }
+        break;
+    default:
+        switch (n) {
+        case 4:
+            sp->count = f1(((unsigned long) 429), y);
+            break;
+        default:
+            g10 |= ! ((int) y) > f3(n, st.lo);
+        }
+    }
+    return f16(146, y) ? x > y >> 0xbfa1 : f0(0x9cb1, g35);
+}
+
+long fn_167(long x, long y, long n, long *p)
+{
+    switch (g5) {
+    case 9:
+        {
+            if (a9[0]) {
+                p[2] += a4[14] * 212 << 348 <= - sp->count ? 592 || 108 : 0xde7f || p[0];
+            } else {
+                g62 ^= ((long) g30 ? 0x5eca >> g34 : f3(g2, x));
+            }
+            p[0] -= f6(((unsigned long) 938), (g14));
+        }
+        break;
+    default:
+        while (n) {
+            switch (n) {
+            case 0:
+                st.hi -= ((long) (a13[12])) * (418 << g23);
+                break;
+            default:
+                p[1] += f15(544, 352) * a8[0] ? a14[10] : p[2] != a11[1];
+            }
+            n--;
+        }
+    }
+    sp->count -= (0x301c) > a11[3] + a13[9] > ! a1[10] || y;
+    switch (g13) {
+    case 8:
+        for (i = 0; i < 83; i++) {
+            st.hi += ((g55)) * 0x2f87;
+        }
+        break;
+    default:
+        while (((long) g61)) {
+            p[0] |= f25(0xeddd, 375) < 14 ? n ? a7[11] : x : a13[11];
+            n--;
+        }
+    }
+    return x ? x != 366 <= 331 != 125 : x;
+}
+
+long fn_168(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 1; i++) {
+        while (g27) {
+            for (i = 0; i < 89; i++) {
+                for (i = 0; i < 93; i++) {
+                    y |= 0x1d5 == 0xf895 >= ((int) 837) != ! 112 | st.lo;
+                }
+            }
+            n--;
+        }
+    }
+    {
+        st.hi ^= f12(f16(a9[13], 0x6675), 227 >> a9[7]);
+        g31 -= ((unsigned long) g19);
+    }
+    {
+        {
+            if (f23(0x3416, 747)) {
+                while (0x9272 < 954) {
+                    p[0] = 0xe241;
+                    n--;
+                }
+            } else {
+                st.hi |= ((short) x);
+            }
+            st.hi = g58 && - (a5[11]);
+        }
+        x = (478 ? x : a14[12] <= a14[5] != a2[1]);
+    }
+    return n;
+}
+
+long fn_169(long x, long y, long n, long *p)
+{
+    if (0x1a52) {
+        for (i = 0; i < 93; i++) {
+            a12[5] ^= 0x919f ? g0 : y ? g54 : n >> a4[2];
+        }
+    } else {
+        st.hi = f6(n, n) && ((unsigned long) 292 ? 0x9121 : a11[12]);
+    }
+    a11[6] = sp->lo;
+    for (i = 0; i < 50; i++) {
+        st.hi += (x) ? ((long) 0x7341) == ((int) n) : st.hi ^ - a9[11];
+    }
+    for (i = 0; i < 9; i++) {
+        if (0xd510) {
+            {
+                a15[12] ^= - x > a14[0] | a12[14] ? ((unsigned long) p[0]) : ~ y;
+                x = g60;
+            }
+        } else {
+            if (a8[15]) {
+                g53 |= a13[1];
+            } else {
+                sp->count ^= ((unsigned long) 0x7fcc);
+            }
+        }
+    }
+    n += 807 ? g48 : 0x7913 >> x <= st.hi ? ((int) ~ a0[7]) : 0x5a6b;
+    if (n) {
+        p[0] |= 0x21df <= (g51) ? ((int) 271) : ((int) st.lo);
+    } else {
+        a12[8] |= (0x144e - sp->lo) & 0x5b6b >> g27 ? (st.hi) : a3[8] & n;
+    }
+    for (i = 0; i < 76; i++) {
+        n ^= f21(0x8203, n ? x : 187);
+    }
+    sp->count -= ((unsigned long) ((unsigned long) ((long) y)));
+    return ~ ((short) x) > 0xf2a3;
+}
+
+long fn_170(long x, long y, long n, long *p)
+{
+    while (f24(0x9f, 911)) {
+        p[3] = ((unsigned long) g48 < a8[0]) ? 669 ? (335) : ~ 0xc3a0 : ~ a11[11] && 0x2ef <= st.lo;
+        n--;
+    }
+    if (st.hi) {
+        if ((st.lo) || f7(a12[1], 12)) {
+            {
+                p[2] = g63 && 0x999f;
+                a1[13] += (- x & g16);
+            }
+        } else {
+            p[3] -= f17(g14, g14) * sp->lo ? 328 : 0x677f ? (y) : p[0] + y;
+        }
+    } else {
+        for (i = 0; i < 89; i++) {
+            sp->count |= 21 << f4(y, 0x7c0f);
+        }
+    }
+    while (- y) {
+        for (i = 0; i < 75; i++) {
+            while (f3(0x8130, a13[0])) {
+                {
+                    a13[12] -= n;
+                    a10[8] -= ! f18(823, y);
+                }
+                n--;
+            }
+        }
+        n--;
+    }
+    x = a14[15] && 725 >> (a6[11]) >> 583;
+    switch (y) {
+    case 9:
+        p[1] -= ((short) ~ x);
+        break;
+    default:
+        while (sp->lo && a15[15]) {
+            p[0] ^= - ~ a0[1] | y;
+            n--;
+        }
+    }
+    switch (y) {
+    case 3:
+        switch (x) {
+        case 0:
+            y ^= f27(0x7e38, (225));
+            break;
+        default:
+            sp->count = ! 431;
+        }
+        break;
+    default:
+        {
+            n -= a3[8] + f31(st.hi, st.lo);
+            a1[5] |= - 0x30c2 << x <= - sp->count >= a10[8];
+        }
+    }
+    switch (n) {
+    case 7:
+        {
+            sp->count -= (a12[7]);
+            x |= (0xe476 && a8[13] != ! 893);
+        }
+        break;
+    default:
+        p[0] += 954 >> a3[1] ? a1[14] : 781 > a14[12];
+    }
+    for (i = 0; i < 52; i++) {
+        for (i = 0; i < 47; i++) {
+            p[3] += n;
+        }
+    }
+    sp->count ^= a11[12] << sp->lo * 0xe029 == 788 << a3[11];
+    if (879 < n << sp->lo) {
+        p[3] += x;
+    } else {
+        a13[0] -= a7[3] & n + g25 == st.hi << 197;
+    }
+    return x;
+}
+
+long fn_171(long x, long y, long n, long *p)
+{
+    {
+        switch (g8) {
+        case 0:
+            a7[8] ^= ~ a9[13] | ((int) st.lo);
+            break;
+        default:
+            st.hi ^= g1 != n && a5[15] ? y : ~ x;
+        }
+        p[3] -= g40;
+    }
+    switch (y) {
+    case 4:
+        p[0] += g58 & (((unsigned long) st.lo));
+        break;
+    default:
+        p[2] += ((unsigned long) ((long) 0x20c7)) << 412;
+    }
+    while (0x2ed7 > a8[5]) {
+        st.hi |= - p[1] ? 0x7e8f : a3[11] != 515 - 198 - y;
+        n--;
+    }
+    {
+        while (933) {
+            y ^= ~ 14;
+            n--;
+        }
+        sp->count ^= st.lo;
+    }
+    while (f17(a12[0], 0x1dc0)) {
+        if (- 273 > ((int) sp->count)) {
+            a10[7] ^= a8[3];
+        } else {
+            sp->count -= y | f19(0x13f7, 149);
+        }
+        n--;
+    }
+    sp->count ^= 0xde1c;
+    a0[9] -= ((short) f23(x, a7[11]) & a3[6] ? 0x50b0 : sp->lo);
+    return 0xd635;
+}
+
+long fn_172(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 20; i++) {
+        {
+            if ((y ^ x)) {
+                switch (x) {
+                case 6:
+                    sp->count ^= ((short) 365);
+                    break;
+                default:
+                    a9[3] |= y + f8(x, a0[2]) <= x >= n;
+                }
+            } else {
+                p[1] = a12[6];
+            }
+            sp->count -= ((int) st.lo < 0x7aa2 | y);
+        }
+    }
+    switch (g8) {
+    case 0:
+        y += n;
+        break;
+    default:
+        sp->count -= ((unsigned long) ((long) st.hi));
+    }
+    switch (n) {
+    case 1:
+        a1[14] -= ! 223;
+        break;
+    default:
+        sp->count |= a4[9];
+    }
+    for (i = 0; i < 77; i++) {
+        for (i = 0; i < 48; i++) {
+            for (i = 0; i < 37; i++) {
+                p[1] ^= 0xd022;
+            }
+        }
+    }
+    {
+        {
+            while (g19) {
+                if (f17(p[1], p[3])) {
+                    st.hi ^= a5[7] || 0xd368;
+                } else {
+                    p[3] += g62;
+                }
+                n--;
+            }
+            n |= y;
+        }
+        y -= ((int) f9(a3[3], n));
+    }
+    return ((int) 0x92bd) ? y : n;
+}
+
+long fn_173(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 22; i++) {
+        n |= (g47);
+    }
+    if (g2) {
+        p[0] = ((short) 0xfe9f);
+    } else {
+        a2[13] ^= ! y < 0xfae >= x ^ p[3];
+    }
+    sp->count += sp->count && (432);
+    switch (g57) {
+    case 0:
+        switch (g33) {
+        case 0:
+            if ((f25(n, 880))) {
+                a3[1] -= ((short) g3 - g43 | p[1]);
+            } else {
+                if ((st.lo ? y : st.lo)) {
+                    sp->count = ! a9[15] >> y ? sp->count : f12(0x6d4f, sp->count);
+                } else {
+                    g22 ^= - a15[2] != 895 << n ^ n >> 0xa662 >= a11[8];
+                }
+            }
+            break;
+        default:
+            g54 = ((short) (p[1])) > y;
+        }
+        break;
+    default:
+        {
+            p[1] += ((unsigned long) a12[9]);
+            y |= f7(g25 << y, f29(0xe8ac, sp->count));
+        }
+    }
+    return ((long) - 851) * a14[11];
+}
+
+long fn_174(long x, long y, long n, long *p)
+{
+    p[3] = f11(n, y) | f24(363, g46);
+    if (f11(382, p[0])) {
+        p[0] ^= (0x5dc9 << a12[10] && ~ 318);
+    } else {
+        for (i = 0; i < 20; i++) {
+            for (i = 0; i < 55; i++) {
+                sp->count |= 716 != (y);
+            }
+        }
+    }
+    a1[9] += ((unsigned long) f21(y, g46));
+    y |= p[2] | 762 ? ((int) st.lo) : 795 < 863;
+    {
+        if (y) {
+            p[1] ^= sp->count | n ? f31(0xd16a, x) : (x) >> g24 ? 724 : 0x61d2 || a5[5];
+        } else {
+            st.hi |= ((unsigned long) - x + ~ a9[6]);
+        }
+        st.hi -= ((int) 0xb71d);
+    }
+    switch (g16) {
+    case 3:
+        st.hi ^= ! g24;
+        break;
+    default:
+        st.hi += (((long) a3[3]));
+    }
+    switch (n) {
+    case 5:
+        while (0xb028 && g62) {
+            a1[5] -= ! ~ ! 0xb300;
+            n--;
+        }
+        break;
+    default:
+        while (((int) x)) {
+            st.hi += a1[6];
+            n--;
+        }
+    }
+    for (i = 0; i < 72; i++) {
+        if (587) {
+            for (i = 0; i < 96; i++) {
+                if (987 * p[3] || sp->count) {
+                    p[0] -= n;
+                } else {
+                    st.hi -= 0xc0a6 >= 908 > st.lo ? sp->lo : 0xf87b + sp->lo;
+                }
+            }
+        } else {
+            for (i = 0; i < 97; i++) {
+                if (sp->lo) {
+                    sp->count -= 0xba8b & 0x5ee3 & ((unsigned long) n) | 48;
+                } else {
+                    p[3] += 0xd891;
+                }
+            }
+        }
+    }
+    return (((st.hi)));
+}
+
+long fn_175(long x, long y, long n, long *p)
+{
+    st.hi ^= - st.hi == 0x2b9c + 539 ? x != 0xb8f9 >> a0[9] : ((long) f30(277, x));
+    switch (n) {
+    case 2:
+        {
+            while (sp->lo > 0x2243) {
+                st.hi += ((short) g33);
+                n--;
+            }
+            st.hi |= a6[2];
+        }
+        break;
+    default:
+        st.hi -= 914 ? (f26(a5[15], a12[6])) : f22(a7[10], x);
+    }
+    sp->count |= 50 ? 555 : y << a15[5] - a12[12] ? 0x22c2 ^ g55 : y;
+    {
+        a12[1] ^= ((unsigned long) 684 >= g52) - ((short) x) + 0x7b8d * 0xa072;
+        a3[7] |= x > 611 ? 855 ^ sp->count : st.hi;
+    }
+    switch (n) {
+    case 5:
+        a5[9] = f9(a4[11] + p[2], f27(a12[3], a13[8]));
+        break;
+    default:
+        st.hi += st.hi * y;
+    }
+    while (882 + a2[6]) {
+        g16 = n;
+        n--;
+    }
+    while (p[0] ^ 506) {
+        sp->count ^= - x > g48 == 791 >> - g37;
+        n--;
+    }
+    switch (x) {
+    case 9:
+        for (i = 0; i < 37; i++) {
+            sp->count += ~ 142 <= 110 ? f0(0x2789, 0x30fc) >> f15(x, st.hi) : ((unsigned long) - n);
+        }
+        break;
+    default:
+        switch (x) {
+        case 5:
+            sp->count = - y * x || (a13[8]);
+            break;
+        default:
+            st.hi |= f8(((long) p[3]), ~ 516);
+        }
+    }
+    while (811) {
+        while (n) {
+            st.hi = x;
+            n--;
+        }
+        n--;
+    }
+    return f12(78 + x, sp->lo << x);
+}
+
+long fn_176(long x, long y, long n, long *p)
+{
+    {
+        p[0] |= 0xa597;
+        a11[3] ^= ~ a7[0] << a7[5] || y > ((short) st.lo <= st.hi);
+    }
+    for (i = 0; i < 51; i++) {
+        a6[15] += sp->lo > 777;
+    }
+    p[2] ^= (((unsigned long) g30));
+    switch (x) {
+    case 7:
+        switch (x) {
+        case 5:
+            st.hi += 869 || a5[10] ? 0x1f57 : g58;
+            break;
+        default:
+            st.hi += - 834 >> x != f23(a13[3], 534) | y;
+        }
+        break;
+    default:
+        a11[8] -= ~ f26(n, sp->count);
+    }
+    p[2] += ((int) 0xba9d);
+    for (i = 0; i < 54; i++) {
+        while (st.lo * g31) {
+            if (a0[0]) {
+                n ^= f26(0x7dcf, a14[15] ? st.lo : n);
+            } else {
+                x -= 837;
+            }
+            n--;
+        }
+    }
+    sp->count -= (y + g43) && y * ((unsigned long) a15[10]);
+    switch (x) {
+    case 1:
+        a5[5] ^= ~ ((short) x < 70);
+        break;
+    default:
+        st.hi += ((short) g38);
+    }
+    sp->count += f10(601, a1[8]);
+    {
+        switch (g30) {
+        case 2:
+            for (i = 0; i < 54; i++) {
+                switch (y) {
+                case 5:
+                    sp->count += 91 ? 92 : x == g50 ? sp->lo : 0xd09d * - - 0x595a;
+                    break;
+                default:
+                    sp->count ^= x + 0xebd4 + 0x361e == x > a5[13] ? 0x8d27 : a9[10];
+                }
+            }
+            break;
+        default:
+            switch (g33) {
+            case 6:
+                a9[11] += x >= (f1(st.hi, y));
+                break;
+            default:
+                sp->count |= ((int) a12[12] >> g62);
+            }
+        }
+        a10[11] |= 815 ? a5[13] : 483 == 0xf96d != sp->lo + (f6(736, 0x52ad));
+    }
+    return ! n ? 700 : a9[14] || n;
+}
+
+long fn_177(long x, long y, long n, long *p)
+{
+    if ((a12[11]) ? a5[11] : n) {
+        sp->count ^= (a9[5]);
+    } else {
+        for (i = 0; i < 17; i++) {
+            {
+                st.hi |= (a0[6] | 897) >= 0x9ef5 + g60 >= x;
+                st.hi ^= ((short) y) <= - (a2[6]);
+            }
+        }
+    }
+    switch (x) {
+    case 9:
+        for (i = 0; i < 55; i++) {
+            sp->count |= (((long) 474));
+        }
+        break;
+    default:
+        x |= (323);
+    }
+    switch (x) {
+    case 0:
+        {
+            if (((long) (sp->lo))) {
+                g10 |= - sp->lo;
+            } else {
+                sp->count = y << ! 452;
+            }
+            sp->count += a7[14];
+        }
+        break;
+    default:
+        switch (n) {
+        case 4:
+            for (i = 0; i < 27; i++) {
+                a2[1] = ((long) a8[2]) ^ st.lo == x;
+            }
+            break;
+        default:
+            st.hi |= sp->count;
+        }
+    }
+    {
+        p[1] += (! g13 || p[3]);
+        a1[0] |= x;
+    }
+    sp->count ^= 499 * 910;
+    sp->count ^= sp->lo != 0x1fbe + g26 >> 0xced2 < 264 + x || 0xa435 * 783;
+    if (((int) 882) != st.lo) {
+        sp->count ^= ((short) y) * 0x6ce3 | sp->count != 0x9f25 == 0x535a;
+    } else {
+        if (y < y ? g2 || x : ((unsigned long) 996)) {
+            sp->count ^= g24;
+        } else {
+            while ((y)) {
+                while (n && x) {
+                    st.hi += g37 - f15(g45, a2[15]);
+                    n--;
+                }
+                n--;
+            }
+        }
+    }
+    if (f23(y, g33) >> ((unsigned long) p[1])) {
+        if (n ? 747 : - n) {
+            y += f11(f9(779, 0x62de), a13[10]);
+        } else {
+            st.hi ^= f12(x, a1[10] >= p[2]);
+        }
+    } else {
+        {
+            st.hi = ~ 0xb68;
+            sp->count += (a15[12]);
+        }
+    }
+    return 0x46d ? sp->count : 697 ? 0x5f65 >= n : 0x80b5 ? (((int) 299)) : f19(101, 42) >= n;
+}
+
+long fn_178(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 96; i++) {
+        switch (y) {
+        case 5:
+            while (~ a4[9]) {
+                st.hi += f28(n, n) < n * 0xccbe;
+                n--;
+            }
+            break;
+        default:
+            {
+                a7[4] |= (y ? p[1] : sp->count ? y : x);
+                st.hi -= st.hi & st.hi == x - a1[8] <= a11[8];
+            }
+        }
+    }
+    {
+        for (i = 0; i < 63; i++) {
+            a3[3] += a2[6] < g25;
+        }
+        x -= (x + a2[13] > sp->count);
+    }
+    for (i = 0; i < 83; i++) {
+        if (84) {
+            for (i = 0; i < 46; i++) {
+                switch (n) {
+                case 7:
+                    n ^= g17;
+                    break;
+                default:
+                    st.hi ^= 237 > 525 << 0x3281 | st.lo;
+                }
+            }
+        } else {
+            for (i = 0; i < 63; i++) {
+                if (((int) a2[8] != a0[9])) {
+                    p[2] |= n >> st.hi | ((int) 0xe4ea);
+                } else {
+                    a7[3] = ((unsigned long) f22(a7[2], y));
+                }
+            }
+        }
+    }
+    {
+        while (! a7[4]) {
+            if (~ f5(x, 0xef43)) {
+                st.hi ^= f18(0x64a4, 0xa5b1) | x;
+            } else {
+                {
+                    sp->count = 0x3cce + f26(st.lo, 0x88e3);
+                    p[2] = y * 0x2b77 >= st.lo >> ! (sp->lo);
+                }
+            }
+            n--;
+        }
+        st.hi |= (n < 79 - y);
+    }
+    st.hi -= a13[8] ? a0[1] : a14[6];
+    p[3] ^= a15[4] > a7[5] ? sp->count : st.hi ? 248 : st.lo >= n << p[0];
+    switch (g8) {
+    case 8:
+        sp->count ^= f12(((long) a14[10]), (p[2]));
+        break;
+    default:
+        y |= - 0xa6d8 > 611 * - x;
+    }
+    while (0x1351) {
+        while (f25(294, g12)) {
+            for (i = 0; i < 36; i++) {
+                x = sp->count;
+            }
+            n--;
+        }
+        n--;
+    }
+    return 0x46f8 ^ ((long) x) ? 146 : g48;
+}
+
+long fn_179(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 11; i++) {
+        sp->count = 0x4e07;
+    }
+    st.hi = (g24 || (y));
+    switch (n) {
+    case 0:
+        a3[13] += 404;
+        break;
+    default:
+        y ^= a3[8];
+    }
+    x = a15[15] << x | n || 771;
+    switch (n) {
+    case 8:
+        for (i = 0; i < 5; i++) {
+            sp->count |= 0xe482;
+        }
+        break;
+    default:
+        sp->count ^= ((long) p[3]);
+    }
+    while (a3[12] != g6) {
+        a2[14] |= x || a14[13] + x;
+        n--;
+    }
+    p[3] -= f28(sp->lo, x) ? 0x5b1c : (st.lo ^ 969);
+    return g25;
+}
+
+long fn_180(long x, long y, long n, long *p)
+{
+    if (! y == 743) {
+        while (n ? sp->count : p[0]) {
+            p[1] += ~ ((short) a14[3] | g11);
+            n--;
+        }
+    } else {
+        switch (g44) {
+        case 9:
+            x += - y << y * st.lo >= 0x50ee * g47 != 0xb7e5;
+            break;
+        default:
+            a15[8] -= a11[6];
+        }
+    }
+    while (0x9256 + n) {
+        for (i = 0; i < 42; i++) {
+            st.hi |= (a12[13] ? g30 : n <= n);
+        }
+        n--;
+    }
+    for (i = 0; i < 60; i++) {
+        st.hi -= x;
+    }
+    if (g61) {
+        p[3] += 918;
+    } else {
+        for (i = 0; i < 62; i++) {
+            switch (x) {
+            case 3:
+                while (((int) sp->lo)) {
+                    st.hi += ((unsigned long) sp->lo && a0[0]) ? a14[11] > ! y : ((short) - 396);
+                    n--;
+                }
+                break;
+            default:
+                switch (n) {
+                case 8:
+                    p[3] = ((unsigned long) n) < ! g40 << (783) ? ~ y : ~ y;
+                    break;
+                default:
+                    x += f1(y & 0x6cfd, a14[5]);
+                }
+            }
+        }
+    }
+    switch (n) {
+    case 7:
+        p[3] ^= (818 <= n) > (((short) a6[13]));
+        break;
+    default:
+        while ((761)) {
+            st.hi += 0xefdd - n;
+            n--;
+        }
+    }
+    a2[14] += ((int) f27(sp->lo, 0xfdd8) ? n - g14 : n);
+    return g25;
+}
+
+long fn_181(long x, long y, long n, long *p)
+{
+    a8[14] -= g47;
+    {
+        while ((g19)) {
+            st.hi -= ((long) ~ x) > 0x559d >> a7[6] + x;
+            n--;
+        }
+        n |= f4(x + 0xfea8, a8[15]);
+    }
+    sp->count += 0xfae1;
+    switch (y) {
+    case 4:
+        sp->count |= - f13(n, a10[9]);
+        break;
+    default:
+        p[1] -= ~ 0x68f4 != a6[12] || g39;
+    }
+    p[2] += n;
+    a11[3] += ((short) a13[8] <= st.hi) || (g13) - 83 ? p[1] : a13[9];
+    if (348) {
+        x += ~ 0x1ef8 & - g24;
+    } else {
+        a7[1] = ! ! 0x3861 | (0x12b9);
+    }
+    for (i = 0; i < 15; i++) {
+        p[0] -= ~ ~ 780 < g4;
+    }
+    return - f14(g9, a13[6]);
+}
+
+long fn_182(long x, long y, long n, long *p)
+{
+    if (((short) st.hi) ? ~ 578 : 346) {
+        while (g2) {
+            p[3] = (! 105) ? f1(n, y) + y && 0xc1dc : ~ 443 & sp->lo;
+            n--;
+        }
+    } else {
+        g36 = 650 * y * st.hi > a10[3];
+    }
+    {
+        while (y) {
+            x |= ((unsigned long) sp->count << 0x9ef9) ? f16(a10[10], a15[1]) : n;
+            n--;
+        }
+        g27 += 0xd573 >> p[1] >> ((short) g55);
+    }
+    if (f4(g18, 649)) {
+        for (i = 0; i < 78; i++) {
+            a1[2] ^= ~ 943 ? (st.hi) : (n) ^ (y) ^ x;
+        }
+    } else {
+        y ^= 0x1144 == (g52) ? y || sp->count : f16(a11[1], 0x3874);
+    }
+    {
+        while (((short) 0xe089)) {
+            sp->count = ((long) f0(a2[3], 0x1e6e)) >= ! y ? ((unsigned long) 0xfdaf) : g59 | a3[15];
+            n--;
+        }
+        p[3] = a11[13];
+    }
+    return 0x9a5a;
+}
+
+long fn_183(long x, long y, long n, long *p)
+{
+    switch (y) {
+    case 9:
+        {
+            switch (y) {
+            case 6:
+                switch (x) {
+                case 6:
+                    st.hi |= ((unsigned long) a4[2]);
+                    break;
+                default:
+                    a3[5] += ! ((int) g8) ? f20(a1[10], 0xeda9) : f27(0x649b, 467);
+                }
+                break;
+            default:
+                switch (x) {
+                case 6:
+                    sp->count += x;
+                    break;
+                default:
+                    sp->count = (x) >= a11[10] == x;
+                }
+            }
+            p[1] += 143 << n >= 0xb4ed ? g23 : 0xd20f - y;
+        }
+        break;
+    default:
+        for (i = 0; i < 21; i++) {
+            for (i = 0; i < 39; i++) {
+                while (n >> 243) {
+                    p[2] += (((short) x));
+                    n--;
+                }
+            }
+        }
+    }
+    switch (x) {
+    case 4:
+        p[2] |= (st.lo) != ((unsigned long) st.lo) & sp->lo;
+        break;
+    default:
+        while (((int) sp->lo)) {
+            while (n) {
+                p[0] ^= (697 + 0x71b6) >= a14[9] << st.hi || ((long) a13[11]);
+                n--;
+            }
+            n--;
+        }
+    }
+    for (i = 0; i < 66; i++) {
+        if (((unsigned long) a4[2]) & f11(0x8f53, a11[1])) {
+            sp->count = 0x3ab1;
+        } else {
+            p[0] += f4(a13[11], (sp->count));
+        }
+    }
+    return f1(g19 | 0xebb5, (a5[8]));
+}
+
+long fn_184(long x, long y, long n, long *p)
+{
+    if (f12(401, st.lo) ? st.hi : ((int) 0xd636)) {
+        switch (g29) {
+        case 6:
+            {
+                g32 += 669;
+                p[0] |= ((int) - 66);
+            }
+            break;
+        default:
+            if (x ? g47 ? a10[14] : g30 : g59) {
+                n ^= (n);
+            } else {
+                sp->count += ~ - 0x57f6 ? 0x1c15 : 0xf2ac;
+            }
+        }
+    } else {
+        while (x) {
+            sp->count |= st.hi;
+            n--;
+        }
+    }
+    st.hi ^= sp->lo;
+    for (i = 0; i < 31; i++) {
+        while (((int) n)) {
+            st.hi ^= f28(0x6f56, f2(a15[7], 0x923e));
+            n--;
+        }
+    }
+    {
+        p[3] += y >= 0x59c;
+        a9[11] -= y;
+    }
+    switch (g14) {
+    case 5:
+        switch (x) {
+        case 1:
+            if (((int) a3[14])) {
+                for (i = 0; i < 20; i++) {
+                    st.hi = (0x1a2d >= g19) | 0xb2be | p[0] ? a14[10] : 0x9840 & a0[0];
+                }
+            } else {
+                y = ! a11[7];
+            }
+            break;
+        default:
+            st.hi += ((unsigned long) 117);
+        }
+        break;
+    default:
+        switch (n) {
+        case 3:
+            switch (y) {
+            case 0:
+                if (a9[10]) {
+                    y = ((long) x <= n) ^ 0xac41;
+                } else {
+                    a8[11] = n;
+                }
+                break;
+            default:
+                while ((0xd163)) {
+                    sp->count ^= f14(f1(sp->count, g56), 0xe709);
+                    n--;
+                }
+            }
+            break;
+        default:
+            p[2] |= y & a6[11] ? 595 : 0xb656 > a12[5];
+        }
+    }
+    g7 |= 889;
+    sp->count |= ! ((int) 0xebe9) || x != 820;
+    return x > g61 - y ? n : 0x4141 < st.lo < 0xa2d1;
+}
+
+long fn_185(long x, long y, long n, long *p)
+{
+    if (447 != n < y) {
+        a0[0] ^= f13(- a11[1], - n);
+    } else {
+        {
+            st.hi ^= st.lo >> a0[0] & a1[9] & 680 >= y;
+            p[3] -= st.lo > a7[3] || - st.hi >= sp->lo;
+        }
+    }
+    {
+        {
+            {
+                st.hi = a14[4];
+                a13[1] -= st.hi;
+            }
+            p[3] = 0x6b31;
+        }
+        st.hi = ((int) ((unsigned long) f16(0x3cee, 714)));
+    }
+    for (i = 0; i < 40; i++) {
+        p[0] = ! 540 - 0xc35b;
+    }
+    x |= 505;
+    for (i = 0; i < 39; i++) {
+        switch (n) {
+        case 0:
+            p[3] |= ((int) n + a4[15]);
+            break;
+        default:
+            st.hi = f27((239), 0x2116 ^ 203);
+        }
+    }
+    return a4[9];
+}
+
+long fn_186(long x, long y, long n, long *p)
+{
+    switch (x) {
+    case 8:
+        while (p[3] != 0xd42f) {
+            st.hi += x;
+            n--;
+        }
+        break;
+    default:
+        for (i = 0; i < 8; i++) {
+            st.hi |= g61;
+        }
+    }
+    if (((long) p[1]) ? ((long) y) : sp->count) {
+        switch (g48) {
+        case 8:
+            while (846 == a2[7]) {
+                p[3] ^= x << st.hi ? - sp->lo ? n : n : ((long) f9(847, 0x1771));
+                n--;
+            }
+            break;
+        default:
+            {
+                if (n & f26(0x599c, 841)) {
+                    p[3] = ((0x3a60)) ? a3[13] ? 0x49d0 ? 915 : 24 : 0x5b2a : f25(st.lo, y);
+                } else {
+                    a6[3] |= (n) && y == a6[10] ? f11(219, sp->count) : 0xb92f >= 0x97b4;
+                }
+                a3[3] += p[3] | f18(495, 0x52c3);
+            }
+        }
+    } else {
+        switch (n) {
+        case 5:
+            {
+                a2[5] = ((short) 293);
+                st.hi -= - x >> 380 & (y) == f3(283, st.lo);
+            }
+            break;
+        default:
+            while (st.lo | 869) {
+                if (a2[10] <= y) {
+                    sp->count |= y;
+                } else {
+                    a15[5] += (f16(st.hi, n)) ^ ((unsigned long) 0xdbf8);
+                }
+                n--;
+            }
+        }
+    }
+    sp->count |= ~ f26(g60, x) && ((int) 980);
+    {
+        {
+            x -= f28(f8(sp->count, p[3]), - p[1]);
+            st.hi ^= ~ 861 ? g25 & g4 : - 608 - ! 512 != x ? 464 : 526;
+        }
+        sp->count ^= 266;
+    }
+    a3[4] += n;
+    while (g40) {
+        while (f27(g58, x)) {
+            p[1] |= f11(0xc98b, - a10[3]);
+            n--;
+        }
+        n--;
+    }
+    while (a11[0] >> a4[10]) {
+        sp->count += f26(sp->lo ? 573 : a0[2], ((short) 0x66d3));
+        n--;
+    }
+    for (i = 0; i < 64; i++) {
+        for (i = 0; i < 97; i++) {
+            if (0xf5ef == sp->lo ? a7[0] : g40) {
+                st.hi = ~ ((unsigned long) 161) >> (0x6b90);
+            } else {
+                p[2] ^= ! y;
+            }
+        }
+    }
+    {
+        st.hi |= (n);
+        a1[9] = 0xccf3 ? x : a13[15] >= p[1] & 52 & a2[11] + f3(x, g53);
+    }
+    return n ^ p[1] - (0x6922) - f18(0x47e, 0x3edc);
+}
+
+long fn_187(long x, long y, long n, long *p)
+{
+    if (y) {
+        g8 -= (g13 & y) >= ~ (sp->count);
+    } else {
+        if ((((short) y))) {
+            while (((unsigned long) a10[6])) {
+                {
+                    p[3] += 829 < f12(n, a5[14]);
+                    p[2] |= y;
+                }
+                n--;
+            }
+        } else {
+            for (i = 0; i < 93; i++) {
+                while (((long) y)) {
+                    sp->count += ~ ((unsigned long) a3[14]) != x >= y;
+                    n--;
+                }
+            }
+        }
+    }
+    a13[13] += ! ((short) p[3]);
+    while (130) {
+        for (i = 0; i < 3; i++) {
+            {
+                if (sp->lo ? y : g17 == 0x41e5 != y) {
+                    p[1] |= f25(g50, sp->lo) && 947 > f12(x, 0x9979) < ~ g54;
+                } else {
+                    a8[15] -= st.hi;
+                }
+                sp->count = y;
+            }
+        }
+        n--;
+    }
+    for (i = 0; i < 57; i++) {
+        if (f6(g24, 491)) {
+            if (n != ! y) {
+                {
+                    st.hi = f23(g53, g54) ^ ! n != st.hi ? 0x9dde : g31;
+                    p[1] |= - x > g8;
+                }
+            } else {
+                if (! y && n) {
+                    st.hi ^= (0xc76f) > ~ 0x15d2 * ~ x != x;
+                } else {
+                    p[1] += n & a4[4];
+                }
+            }
+        } else {
+            a13[12] ^= - n >> x < (a11[14]);
+        }
+    }
+    st.hi -= (g45) + ((short) ((long) y));
+    while (x) {
+        a15[6] += y;
+        n--;
+    }
+    for (i = 0; i < 49; i++) {
+        switch (y) {
+        case 3:
+            g29 += a9[11] | a15[11] ? 226 : a3[7] & y;
+            break;
+        default:
+            st.hi = 0x7dea;
+        }
+    }
+    while (st.hi >> n) {
+        p[2] |= (x > y >= g1);
+        n--;
+    }
+    a0[14] |= ((int) f23(sp->lo, p[1]) ? ((short) x) : st.lo);
+    return 0x41ae || a9[1] == 68 * st.hi != 583;
+}
+
+long fn_188(long x, long y, long n, long *p)
+{
+    a12[14] -= 0x9d39 == y > x ? (sp->count) : (y);
+    x ^= st.hi;
+    n -= ~ 0xa7fe ? st.lo : sp->lo || st.lo ^ p[0];
+    st.hi ^= ! 62 >= 874 ? (603) != n ^ 622 : 0x1284;
+    for (i = 0; i < 89; i++) {
+        switch (x) {
+        case 2:
+            p[3] ^= g33;
+            break;
+        default:
+            n |= (~ 944 >= g37);
+        }
+    }
+    {
+        {
+            p[0] |= 0xc590 <= x + a3[9] >= y;
+            sp->count = g13;
+        }
+        a3[6] = ~ 751 != a11[5] == n + st.lo | y << (0xc3a6);
+    }
+    {
+        for (i = 0; i < 5; i++) {
+            sp->count = - n;
+        }
+        st.hi ^= ((y)) ? ((int) n) & a7[3] >= g14 : f12(998, x) && ! a2[11];
+    }
+    if (a8[6] >= y ? (p[1]) : ! 833) {
+        if (a7[8] - 0xf436 == 0xc45f > y) {
+            st.hi |= a1[8];
+        } else {
+            for (i = 0; i < 57; i++) {
+                if (0x437 + n ^ 0xa55a | g25) {
+                    sp->count ^= a6[6] << 142 < g45 ? a13[9] : x < a12[0] <= st.hi;
+                } else {
+                    p[0] = y;
+                }
+            }
+        }
+    } else {
+        if (sp->lo | 35) {
+            switch (n) {
+            case 8:
+                while (389 > 186) {
+                    x ^= n;
+                    n--;
+                }
+                break;
+            default:
+                if (632) {
+                    a1[15] += (a15[7]) & 0x9605 > a14[13] >= y;
+                } else {
+                    st.hi -= sp->lo;
+                }
+            }
+        } else {
+            switch (x) {
+            case 0:
+                while ((a8[3])) {
+                    g42 ^= (~ a12[13]) & 0x5c83 ^ a1[5] & x;
+                    n--;
+                }
+                break;
+            default:
+                while (st.hi ? st.lo : x) {
+                    a6[2] = (sp->count > n ? 708 != sp->count : 308);
+                    n--;
+                }
+            }
+        }
+    }
+    if (~ ((short) 0x79b1)) {
+        if (~ 606) {
+            sp->count |= f22(862, n) ^ ((short) 448) - y & a12[9];
+        } else {
+            g31 += f25(a7[2], y) & ~ f4(0xafb6, 277);
+        }
+    } else {
+        sp->count |= ((unsigned long) ((y)));
+    }
+    sp->count |= sp->count - g14 || p[3] ^ ((short) a7[11] ^ a2[12]);
+    return ((short) f7(n, sp->count) > sp->lo <= sp->lo);
+}
+
+long fn_189(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 62; i++) {
+        p[0] |= a7[2];
+    }
+    {
+        if (f21(0x1deb, x) >> x & y) {
+            while (n < sp->count) {
+                st.hi += a7[3];
+                n--;
+            }
+        } else {
+            {
+                y ^= ((unsigned long) 683);
+                p[2] += st.hi >> g56 + sp->count ? f13(0xacf7, a4[11]) : ! n;
+            }
+        }
+        sp->count += g53 & ((long) st.lo) + g10;
+    }
+    switch (g56) {
+    case 1:
+        a2[1] |= ((long) 0x53e7 ^ g43);
+        break;
+    default:
+        {
+            p[1] += x;
+            a4[7] -= ~ ((long) a14[11] ? sp->lo : g41);
+        }
+    }
+    while (n) {
+        p[0] = - st.hi && (365) ? a11[6] : p[2] == 876;
+        n--;
+    }
+    if (n) {
+        while (st.lo) {
+            if (g37 & ! 0x7428) {
+                {
+                    x -= (566);
+                    sp->count += 0xe33 <= 0xf3c5 && 482 ^ (((short) n));
+                }
+            } else {
+                a0[7] += ((short) ! 787);
+            }
+            n--;
+        }
+    } else {
+        {
+            {
+                p[0] |= a15[13] == f31(n, y);
+                a2[13] += ((unsigned long) ((int) 0x5a7a ? g31 : a11[1]));
+            }
+            st.hi ^= (206);
+        }
+    }
+    {
+        a6[8] |= x > 563 ? x != a7[1] : sp->lo ? 0xc437 : 0x4a37 ? (sp->count > 370) : n ? 0x96e7 : a2[7] ? - a4[6] : ! x;
+        p[3] = a9[15] ? n ? sp->lo ? x : n : ((short) 219) : - sp->count << ((long) sp->lo);
+    }
+    if (g61) {
+        p[0] += (f20(a12[8], g60) && 0xf2ff >= g45);
+    } else {
+        st.hi ^= 0x70e8;
+    }
+    sp->count -= f24(186, n == a1[15]);
+    while (f21(y, p[0])) {
+        p[2] = - st.lo;
+        n--;
+    }
+    while (0xbe6d || sp->count) {
+        if (f15(y, a0[8])) {
+            st.hi = (0xfc2b == 343) + ((long) 606) < a13[11];
+        } else {
+            p[3] |= (0x4533 ? a2[13] : y != p[0] & 0x2bcb);
+        }
+        n--;
+    }
+    return g49;
+}
+
+long fn_190(long x, long y, long n, long *p)
+{
+    if (a15[13]) {
+        switch (g42) {
+        case 3:
+            p[2] ^= ! p[0] | - n | ((long) x) << y;
+            break;
+        default:
+            n += 928 ^ st.hi + sp->count + 686 & (st.hi + sp->lo);
+        }
+    } else {
+        switch (g32) {
+        case 8:
+            st.hi |= (g55 > p[1] <= st.lo >= y);
+            break;
+        default:
+            g29 ^= n;
+        }
+    }
+    g16 |= f0(((long) 0x495), a8[4]);
+    {
+        switch (x) {
+        case 2:
+            n = - sp->lo + 352;
+            break;
+        default:
+            p[3] |= ((unsigned long) ! ! a13[6]);
+        }
+        y = st.hi;
+    }
+    st.hi |= 128;
+    if (0x4f76 > st.lo >= ! 0xc3ca) {
+        st.hi ^= (f16(a9[2], 436) > n);
+    } else {
+        y = f20(~ g43, - a7[12]);
+    }
+    if (0xce9f) {
+        if (f26(0x7cc2, g16)) {
+            a6[12] = f18(g50, a4[10]) < (22) <= 132;
+        } else {
+            n = 0xa151;
+        }
+    } else {
+        while (f3(0xf0b3, y)) {
+            y -= (y);
+            n--;
+        }
+    }
+    while (f31(n, st.hi)) {
+        {
+            sp->count ^= ((short) 0xf1ea) >> ((short) 0xa093);
+            st.hi ^= f7(st.hi, y);
+        }
+        n--;
+    }
+    switch (y) {
+    case 0:
+        p[2] = f21(0x9be6, 684) ^ - p[2] | y;
+        break;
+    default:
+        sp->count -= 714;
+    }
+    return f2(f1(n, x), st.hi ? a1[1] : g62);
+}
+
+long fn_191(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 7; i++) {
+        {
+            y |= ~ n;
+            a14[3] ^= 0xa493;
+        }
+    }
+    a0[1] += f9(x, 89) >> 419;
+    while (a9[15] & g58) {
+        while (y ? 0x776f : sp->count) {
+            {
+                while (sp->lo) {
+                    a11[15] -= g30;
+                    n--;
+                }
+                a3[10] -= f1(g3, 278) >= 0x362b || 0x24d5 >> st.hi;
+            }
+            n--;
+        }
+        n--;
+    }
+    for (i = 0; i < 44; i++) {
+        if (((short) n) != 894 ? g31 : 64) {
+            if (f20(x, n) | f1(g63, 0x1c12)) {
+                switch (y) {
+                case 1:
+                    a7[5] += 125;
+                    break;
+                default:
+                    st.hi ^= 848;
+                }
+            } else {
+                switch (y) {
+                case 5:
+                    n += sp->count;
+                    break;
+                default:
+                    a14[8] ^= (((long) x) <= a6[4] | 0xeb17);
+                }
+            }
+        } else {
+            switch (y) {
+            case 1:
+                if (y || x | a11[14]) {
+                    st.hi += a9[8] < a1[9] ? (0xc8ae) : g13 | x != ((unsigned long) st.hi);
+                } else {
+                    sp->count ^= f27(y, (n));
+                }
+                break;
+            default:
+                sp->count |= f18(n, y) < f14(a6[1], a10[0]);
+            }
+        }
+    }
+    if ((732 != y)) {
+        sp->count |= f9(281, 0x89ea) + f23(a3[12], a8[1]);
+    } else {
+        n -= ((unsigned long) x || p[2]) != g18;
+    }
+    st.hi += n * g8;
+    for (i = 0; i < 64; i++) {
+        for (i = 0; i < 81; i++) {
+            for (i = 0; i < 41; i++) {
+                switch (y) {
+                case 1:
+                    p[1] |= (f14(a6[3], a5[5])) ? (st.hi) >= n : (0xc8f8) && ! p[1];
+                    break;
+                default:
+                    p[2] ^= (39) != x;
+                }
+            }
+        }
+    }
+    a4[12] = a14[7];
+    for (i = 0; i < 50; i++) {
+        st.hi ^= f6(n - 26, g57 ? sp->count : 497);
+    }
+    switch (x) {
+    case 6:
+        {
+            switch (y) {
+            case 5:
+                for (i = 0; i < 19; i++) {
+                    sp->count -= f24(589, a12[9]) || n;
+                }
+                break;
+            default:
+                {
+                    a14[4] ^= 0xac14;
+                    st.hi |= ! a9[13] < ((short) g40) && a15[10] ? g46 : 0x5c72 & ~ 0xee4;
+                }
+            }
+            p[0] = a15[5] && (st.hi) + p[0];
+        }
+        break;
+    default:
+        sp->count += n != 111 + (n) - a3[5];
+    }
+    return - a3[2] << 184 >> 0x3c51;
+}
+
+long fn_192(long x, long y, long n, long *p)
+{
+    a7[5] -= x;
+    while (0xb1de ? x : 0x99b1) {
+        x -= f11(((short) 0xb2a), p[3]);
+        n--;
+    }
+    y |= (sp->count ? g30 : a13[13]) ^ y;
+    sp->count ^= x;
+    return ~ ((unsigned long) 541) * g43 ^ 0x77c8 <= 0x5d13 == st.hi;
+}
+
+long fn_193(long x, long y, long n, long *p)
+{
+    {
+        st.hi |= ((unsigned long) 0x7f17) ? (x && 0x3388) : st.lo;
+        p[2] ^= 0xb7cc >> 0xb1ed > y >> g40;
+    }
+    if (n ^ y * f7(x, x)) {
+        if (((short) 0x1fac)) {
+            sp->count |= 20 ^ a3[1] ? y : a14[12] | (g36);
+        } else {
+            sp->count |= f21(627, n) & 0xe884;
+        }
+    } else {
+        switch (g4) {
+        case 7:
+            sp->count += a15[7];
+            break;
+        default:
+            a5[11] = f28(! 467, x > g2);
+        }
+    }
+    {
+        x |= a2[7];
+        sp->count ^= y < 0xc438 ? 0x569a : ~ a11[1] <= ~ a8[1];
+    }
+    for (i = 0; i < 87; i++) {
+        switch (g26) {
+        case 9:
+            while (a6[10]) {
+                sp->count = st.lo;
+                n--;
+            }
+            break;
+        default:
+            p[3] += n && g6 ^ 0x669e ? sp->count : (((long) a1[12]));
+        }
+    }
+    sp->count |= f1(0x6c20, 0x2f28);
+    switch (x) {
+    case 3:
+        {
+            a8[14] += ((unsigned long) y);
+            g63 -= x || 0xd5ce ^ 0x9dd5 <= a10[12] > 0xc0b2;
+        }
+        break;
+    default:
+        if (864 != x | ! 926) {
+            st.hi = (- a10[15] << n);
+        } else {
+            n -= ~ g51;
+        }
+    }
+    a3[1] ^= a4[14] && ((long) y) >> sp->lo ^ 306 + 82;
+    for (i = 0; i < 15; i++) {
+        st.hi = ((short) a5[11] | a3[13]) >> 98;
+    }
+    if (f18(0x24de, p[2])) {
+        st.hi -= (0x2c3f) < (y ? n : a13[3]);
+    } else {
+        st.hi ^= g4;
+    }
+    return ((st.lo));
+}
+
+long fn_194(long x, long y, long n, long *p)
+{
+    while (y) {
+        x ^= ((int) a13[15] != st.hi - 112);
+        n--;
+    }
+    sp->count -= ! 557 ^ ((long) 738 >> n);
+    while (0x527c ? a15[2] : a10[4]) {
+        while (- p[0]) {
+            while (n > 4) {
+                p[1] ^= (y) ? sp->count - 972 : n || a1[2];
+                n--;
+            }
+            n--;
+        }
+        n--;
+    }
+    while (0x82d5 ? y : 931) {
+        {
+            sp->count += (n << g26) <= x >= a9[15] != y;
+            sp->count += - f10(y, y);
+        }
+        n--;
+    }
+    st.hi = ((unsigned long) ((short) a1[10] - a12[14]));
+    for (i = 0; i < 76; i++) {
+        a5[6] |= a11[13] || (- 0x8b6);
+    }
+    while (g22 < a3[0]) {
+        st.hi ^= g31;
+        n--;
+    }
+    return 630;
+}
+
+long fn_195(long x, long y, long n, long *p)
+{
+    g42 += a11[0];
+    while (a3[14] ? 0x10ec : y) {
+        y = p[2];
+        n--;
+    }
+    x -= p[3] < p[3] * ((short) x);
+    a8[9] -= f6((x), (a15[2]));
+    sp->count = - a10[3] <= n ? 0x6da7 : (y >= a15[8]);
+    while (0xa54 + a3[1]) {
+        switch (y) {
+        case 5:
+            while (x ? st.lo : 0x95a0) {
+                {
+                    sp->count |= ! 0xf10 & f25(g0, g25);
+                    st.hi += 764 != p[3] ? a3[12] : (g13) ? 880 ^ p[3] ? 136 >> 0x791 : 0x9df == g40 : ((st.lo));
+                }
+                n--;
+            }
+            break;
+        default:
+            while (g34) {
+                for (i = 0; i < 99; i++) {
+                    a6[8] ^= p[2];
+                }
+                n--;
+            }
+        }
+        n--;
+    }
+    st.hi ^= f27((x), 0xdc58);
+    for (i = 0; i < 78; i++) {
+        sp->count |= 0xa43;
+    }
+    if (~ g9 | 0x827) {
+        {
+            p[3] -= - n != n << sp->count;
+            st.hi -= a6[12];
+        }
+    } else {
+        sp->count |= a10[0] || x <= 0x9835 ? f8(0x1ef0, n) - 0x8505 ? 0x3bf3 : 0x4785 : f1(y, 161);
+    }
+    switch (x) {
+    case 5:
+        switch (g33) {
+        case 4:
+            {
+                if ((((short) y))) {
+                    st.hi = n <= 0xd3d3 * 109 ? st.lo < x <= f0(n, 0x9f2d) : y;
+                } else {
+                    p[1] ^= ! g0;
+                }
+                p[0] -= (a5[4]);
+            }
+            break;
+        default:
+            while (n) {
+                y ^= sp->lo ? x ? a4[1] : p[0] <= 0x3f1a & p[2] : a11[2];
+                n--;
+            }
+        }
+        break;
+    default:
+        while (a6[13] << sp->lo) {
+            {
+                if (y > a12[6] * n) {
+                    a13[13] += g23;
+                } else {
+                    x = f27(g58, n) ? ((int) a0[11]) : ! g31 * (a14[1] >> 0x1cb6);
+                }
+                st.hi ^= 0x624f >> 0x9174 ^ ((short) x) == ! a13[7];
+            }
+            n--;
+        }
+    }
+    return 0x9cf2;
+}
+
+long fn_196(long x, long y, long n, long *p)
+{
+    n = g52;
+    st.hi |= y;
+    while (- n) {
+        if (sp->lo ? 0x9b22 : 0xb876 * f12(270, g41)) {
+            sp->count += f26(f8(0x884e, g13), a5[4]);
+        } else {
+            a3[14] ^= (0xb976 >= 373) ? y : (g25);
+        }
+        n--;
+    }
+    {
+        {
+            while (st.hi) {
+                x -= y ? y : p[3] * a2[8] << 769 > n || x > ! 989;
+                n--;
+            }
+            sp->count += (x) || f11(n, sp->lo) <= n > f14(n, st.lo);
+        }
+        p[0] |= g45;
+    }
+    p[2] -= a6[11];
+    while (((short) g49)) {
+        st.hi |= 6 ? st.lo : x << - x << y || a12[14] ? sp->count * sp->count : (0xf2c1);
+        n--;
+    }
+    p[0] += ! ((int) 0x852f - st.hi);
+    for (i = 0; i < 37; i++) {
+        if (n) {
+            y -= (- f17(st.hi, a8[5]));
+        } else {
+            p[1] = (n) > st.lo != 163 ^ (x) || g49 ? 621 : a11[13];
+        }
+    }
+    if (0xf07e || 0x8347 & a8[3]) {
+        n -= sp->lo - ((short) ~ 779);
+    } else {
+        sp->count -= a15[2] ^ 574 - ((long) x) >= - y && st.hi;
+    }
+    a4[0] += 0xcab6;
+    return (424 * - 0xe50c);
+}
+
+long fn_197(long x, long y, long n, long *p)
+{
+    {
+        g1 += f28(n, 0x4922) ? n : (x == 852);
+        n |= ~ ((unsigned long) sp->lo) && x <= 485;
+    }
+    a1[2] ^= f21(0xadae, 0x1fda);
+    for (i = 0; i < 67; i++) {
+        {
+            a9[2] |= y;
+            a15[5] |= f28(x, st.hi);
+        }
+    }
+    return 254;
+}
+
+long fn_198(long x, long y, long n, long *p)
+{
+    while (a11[0] == a12[13]) {
+        if (0xef1d ? 0x1d8c : 0x6f70 ? y : y ? x : a9[13]) {
+            st.hi |= ((long) x & g11) - (sp->count) ? 873 : a14[4];
+        } else {
+            n |= - g29 && 0x9f1d - f22(0x51e5, 141);
+        }
+        n--;
+    }
+    while ((a8[14])) {
+        {
+            p[2] = p[3];
+            g11 ^= 0x269d;
+        }
+        n--;
+    }
+    if (~ f30(a8[13], 434)) {
+        for (i = 0; i < 86; i++) {
+            for (i = 0; i < 12; i++) {
+                p[1] ^= sp->count || p[0] < p[1] ? ! ! sp->lo : ((y));
+            }
+        }
+    } else {
+        for (i = 0; i < 86; i++) {
+            if (st.lo - f28(0x3e81, 0xa292)) {
+                if (g10 >> 74 == a5[10]) {
+                    a8[11] += x ^ - y ? y : g52;
+                } else {
+                    st.hi = f18(f15(16, sp->lo), 0x1604 ? n : 844);
+                }
+            } else {
+                sp->count = (((long) 0x903f ? a4[12] : g45));
+            }
+        }
+    }
+    if ((sp->lo == st.lo)) {
+        while (0x725e && st.hi) {
+            while (n & 0xd1c6) {
+                if (0x464d <= 0x7a1a ? st.hi - a13[4] : 0xf25c) {
+                    sp->count -= st.lo;
+                } else {
+                    sp->count |= x;
+                }
+                n--;
+            }
+            n--;
+        }
+    } else {
+        if ((18 + p[2])) {
+            {
+                if (- f7(y, 0xe9a7)) {
+                    st.hi |= g18 << n && 839 ^ f18(p[3], 158) ^ a0[10];
+                } else {
+                    a12[7] += f13(0x48f5, y) | ~ 999 <= x >= st.hi;
+                }
+                p[1] ^= f13(983, ((long) 392));
+            }
+        } else {
+            sp->count += (x) >> - y && sp->count;
+        }
+    }
+    n ^= 0xc920 >= x ? 436 >= g59 ? n + g24 : a12[3] : f17(366, a0[10]);
+    for (i = 0; i < 50; i++) {
+        p[2] = 0xbc08;
+    }
+    a9[2] -= (! 0x6a4b);
+    while ((x)) {
+        sp->count ^= g56 | 0x465a ^ x >> g6 & 0x3f36;
+        n--;
+    }
+    sp->count -= ((int) sp->lo && 0xe716) > f10(a8[0], x);
+    return f17(884 + g32, a14[8] >> sp->lo);
+}
+
+long fn_199(long x, long y, long n, long *p)
+{
+    st.hi |= 0x8727;
+    a4[11] ^= 0xa5df;
+    {
+        if (((int) 0xfcc2 < 846)) {
+            while (13) {
+                sp->count += f29(x, a2[8]);
+                n--;
+            }
+        } else {
+            {
+                {
+                    g10 = ((long) f20(0x82d0, 663));
+                    y += n + sp->lo ? ! n : - n ? a12[2] : n;
+                }
+                y -= (~ 16 == a1[11] ? y : y);
+            }
+        }
+        sp->count -= a5[0];
+    }
+    {
+        while (283) {
+            sp->count -= 0xd3a4 > (a0[10]) >= 0x50e6 | a11[3];
+            n--;
+        }
+        p[0] -= (p[2] * 706) ? ~ a6[1] : f15(x, a8[0]);
+    }
+    while (f25(st.lo, 214)) {
+        st.hi ^= ! n + 0xe19c << ~ sp->lo;
+        n--;
+    }
+    switch (x) {
+    case 5:
+        {
+            {
+                st.hi -= ! a9[3] >> sp->lo <= 0xf608 - 0xc9de & a4[12];
+                y -= ((f26(a13[15], 0x95d5)));
+            }
+            sp->count |= a10[3] == a14[1] > 0x7f02 * x;
+        }
+        break;
+    default:
+        while (a6[8] > sp->count) {
+            if (! y ? sp->count : ((int) sp->count)) {
+                x = (st.hi) ? ! x > g24 : (a1[3]) ? (st.hi) : y;
+            } else {
+                st.hi -= y;
+            }
+            n--;
+        }
+    }
+    p[1] ^= n - ! g25 ? 643 : st.hi;
+    a0[6] += (0x97d6 ? st.lo : 685) << (446);
+    return - f7(833, g15);
+}
+
+long fn_200(long x, long y, long n, long *p)
+{
+    if (a6[2] - f7(n, g11)) {
+        if (st.lo) {
+            sp->count ^= x <= 0x92e >= ((short) x);
+        } else {
+            st.hi = 0xb6b2 ? 953 : n == ! p[3] ? ! st.hi > p[0] : 0x4f3 * n;
+        }
+    } else {
+        a11[12] += 874;
+    }
+    while (0xc78e && a12[1]) {
+        for (i = 0; i < 51; i++) {
+            sp->count = ~ y | 0x4e95 ? n : 789;
+        }
+        n--;
+    }
+    switch (y) {
+    case 8:
+        switch (n) {
+        case 4:
+            sp->count -= a4[15] <= n ^ st.hi | 418 > (sp->lo) ? ((long) 0xe8) : sp->count ? 294 : a4[4];
+            break;
+        default:
+            st.hi |= ! y;
+        }
+        break;
+    default:
+        for (i = 0; i < 17; i++) {
+            p[3] = p[3];
+        }
+    }
+    switch (x) {
+    case 4:
+        for (i = 0; i < 36; i++) {
+            a2[15] -= f16(171 >= sp->count, sp->count);
+        }
+        break;
+    default:
+        if (0xa944 ? x >= g12 : sp->lo != 347) {
+            st.hi |= (st.lo) >> ((short) ! 0xb3d2);
+        } else {
+            p[3] = ((short) f16(x, a5[6]));
+        }
+    }
+    st.hi ^= ((g58));
+    {
+        {
+            {
+                for (i = 0; i < 14; i++) {
+                    a10[15] = ~ ~ 267;
+                }
+                x |= g39;
+            }
+            sp->count = y;
+        }
+        y = (a14[4] >> y) <= f31(a7[5], 965);
+    }
+    st.hi ^= ! ((unsigned long) n | 688);
+    {
+        for (i = 0; i < 79; i++) {
+            a13[8] += x;
+        }
+        sp->count |= (((unsigned long) n) != x > st.lo);
+    }
+    if ((a4[1]) >> f21(427, sp->count)) {
+        {
+            p[1] -= y >> f19(n, 0x14c0);
+            a7[15] ^= a9[5];
+        }
+    } else {
+        y = f11(x + 0x35c5, f18(y, g51));
+    }
+    return 0x8;
+}
+
+long fn_201(long x, long y, long n, long *p)
+{
+    st.hi = 0x7bc5;
+    for (i = 0; i < 99; i++) {
+        {
+            for (i = 0; i < 81; i++) {
+                p[3] += (a15[1] | x ? f25(y, a1[9]) : 695 || a8[7]);
+            }
+            x |= ~ f5(sp->count, n);
+        }
+    }
+    if (- f11(g30, 157)) {
+        while (((short) sp->lo)) {
+            while (! y) {
+                while (x ? a13[10] : y) {
+                    a13[7] = 0x806c;
+                    n--;
+                }
+                n--;
+            }
+            n--;
+        }
+    } else {
+        while (a3[0] != 418) {
+            a5[9] |= f16(231, sp->count) == st.lo & y ? (x) : a2[3] != sp->count;
+            n--;
+        }
+    }
+    switch (g4) {
+    case 5:
+        sp->count ^= g56;
+        break;
+    default:
+        p[3] = ((a13[9])) + x;
+    }
+    if (((long) n) | ~ a0[12]) {
+        switch (y) {
+        case 1:
+            sp->count -= (((g58)));
+            break;
+        default:
+            g16 |= f25(((unsigned long) st.lo), x ? a2[13] : n);
+        }
+    } else {
+        if ((947 < 846)) {
+            st.hi |= sp->count != ((short) ((short) 0x8c99));
+        } else {
+            g61 -= ((unsigned long) f26(0xaf03, 639));
+        }
+    }
+    switch (y) {
+    case 3:
+        switch (y) {
+        case 7:
+            while (n) {
+                sp->count -= 0xe8a7 ? 615 ? n : n : a8[10] == ((int) g63 * x);
+                n--;
+            }
+            break;
+        default:
+            while (788 != 0xc512) {
+                a9[7] += ! 262 != g47 != n;
+                n--;
+            }
+        }
+        break;
+    default:
+        switch (n) {
+        case 7:
+            switch (x) {
+            case 0:
+                p[0] |= g16 == x ? 110 + a6[5] : g11 > p[1] > a13[1] > x >> (a5[12]);
+                break;
+            default:
+                sp->count += f22(n != n, ~ 995);
+            }
+            break;
+        default:
+            switch (g43) {
+            case 3:
+                p[2] ^= 202 && (st.hi << 0x9f5e);
+                break;
+            default:
+                st.hi ^= ~ sp->lo;
+            }
+        }
+    }
+    return p[0] ? ~ - y : f0(sp->lo, x);
+}
+
+long fn_202(long x, long y, long n, long *p)
+{
+    p[0] ^= n;
+    switch (n) {
+    case 7:
+        st.hi ^= ~ 753;
+        break;
+    default:
+        st.hi = ~ a4[10] | st.lo ? p[3] << 769 : p[0] >> n;
+    }
+    {
+        p[0] = ((long) ((int) y) && 0x85be != a1[1]);
+        a13[10] -= y ? y : y >> a1[2] && 0x34f >= (y != y);
+    }
+    st.hi += g59;
+    return 512;
+}
+
+long fn_203(long x, long y, long n, long *p)
+{
+    while (0x4325 ^ g6) {
+        if (a4[15]) {
+            for (i = 0; i < 64; i++) {
+                y += sp->lo - p[1] < sp->count | 199;
+            }
+        } else {
+            switch (x) {
+            case 5:
+                sp->count -= y;
+                break;
+            default:
+                sp->count ^= y >> g5;
+            }
+        }
+        n--;
+    }
+    p[1] = ((int) (0x6850 >= p[0]));
+    for (i = 0; i < 45; i++) {
+        y += (0xfdde);
+    }
+    for (i = 0; i < 71; i++) {
+        st.hi ^= f25(! a1[7], ((long) 73));
+    }
+    {
+        while (684 <= x) {
+            sp->count ^= f27(g37 | st.hi, a7[8] > a11[11]);
+            n--;
+        }
+        a0[1] -= ((short) (g43 > sp->count));
+    }
+    while (n) {
+        p[2] += f15(a3[1] ? sp->count : 0x248b, a7[6] << 40);
+        n--;
+    }
+    return st.lo;
+}
+
+long fn_204(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 13; i++) {
+        {
+            if (p[2]) {
+                sp->count ^= y;
+            } else {
+                for (i = 0; i < 89; i++) {
+                    sp->count -= ((long) - 567) <= p[3];
+                }
+            }
+            a11[12] ^= sp->lo | ((unsigned long) g0) >> 0x41d4 + a0[7];
+        }
+    }
+    if (((unsigned long) sp->count)) {
+        switch (n) {
+        case 7:
+            switch (g27) {
+            case 0:
+                p[3] ^= f31(sp->count, sp->lo) ? f30(st.lo, n) + ~ a0[13] : 828;
+                break;
+            default:
+                sp->count ^= ~ 0x1f58;
+            }
+            break;
+        default:
+            switch (g31) {
+            case 1:
+                st.hi += a2[5] - a12[7];
+                break;
+            default:
+                st.hi = (p[1] << g6 * a14[5]);
+            }
+        }
+    } else {
+        if (255 ? 0x198 == p[2] : ((unsigned long) 138)) {
+            {
+                st.hi += (a10[6]) * f22(x, a8[9]);
+                p[1] += a8[8];
+            }
+        } else {
+            {
+                a11[11] = f10(n, 0xfe87) < ! 0x1b31 > sp->count;
+                st.hi -= 0x7b3b;
+            }
+        }
+    }
+    switch (g31) {
+    case 0:
+        while (0x9151 > st.hi) {
+            {
+                g3 |= (x <= f11(n, y));
+                sp->count ^= ! a13[0] & f7(0x1406, n);
+            }
+            n--;
+        }
+        break;
+    default:
+        if (g36) {
+            {
+                st.hi += sp->count;
+                x += ~ ((unsigned long) 0x4f51) ? (a3[10]) ? st.lo : x ? p[2] : 0xa29b : ~ ~ 0xf825;
+            }
+        } else {
+            sp->count = 753 ? st.lo << y : 0x3dc0 ? x : x * st.hi;
+        }
+    }
+    {
+        while ((n)) {
+            x |= - f20(y, n) * sp->lo;
+            n--;
+        }
+        p[1] = - 832 > 894 + - a8[8] ? 833 : 408;
+    }
+    return f14(g60, f20(g14, sp->lo));
+}
+
+long fn_205(long x, long y, long n, long *p)
+{
+    x ^= a13[12];
+    for (i = 0; i < 17; i++) {
+        while (793 + st.hi) {
+            a12[2] |= - 0xded7 || 0x11bc - 202 - x * st.lo;
+            n--;
+        }
+    }
+    while (((unsigned long) y)) {
+        a12[10] += ! (0x4971) <= st.hi >= a12[10];
+        n--;
+    }
+    a12[15] = a11[1] >= n > - sp->count & n ? x : st.hi;
+    a8[1] = ((unsigned long) 417) + 0x18a9 ? a14[6] : 593 ^ ~ 153 * g37;
+    {
+        for (i = 0; i < 32; i++) {
+            while (f17(961, 251)) {
+                switch (y) {
+                case 7:
+                    st.hi += y ? 175 - a14[2] : 0x6379 << g51 || sp->lo ? a7[8] : g40 - ((int) 871);
+                    break;
+                default:
+                    p[0] |= a2[6] <= 554 <= n >> st.hi && y;
+                }
+                n--;
+            }
+        }
+        a8[10] = x ? y : st.lo + 0x1468 & y == ~ (st.hi);
+    }
+    switch (y) {
+    case 6:
+        while (sp->lo ^ 513) {
+            while (((unsigned long) st.hi)) {
+                for (i = 0; i < 39; i++) {
+                    p[1] |= ~ 943;
+                }
+                n--;
+            }
+            n--;
+        }
+        break;
+    default:
+        while (! g51) {
+            for (i = 0; i < 63; i++) {
+                {
+                    sp->count = (f16(g0, a0[6]));
+                    p[1] += sp->count ? p[3] + 0xf80a : st.hi ? 400 : y != f27(p[0], a15[1]);
+                }
+            }
+            n--;
+        }
+    }
+    return f29(n, a1[8]) >> a15[10] ? n & n : f7(0x1590, 0x7783);
+}
+
+long fn_206(long x, long y, long n, long *p)
+{
+    while (x + 499) {
+        st.hi |= ((int) st.hi) ? n : x ? a13[3] : n >> - 512 && x >> g17;
+        n--;
+    }
+    for (i = 0; i < 99; i++) {
+        a6[8] |= st.hi > ((long) ~ 883);
+    }
+    while (0x7681) {
+        while (f13(a9[14], a5[14])) {
+            for (i = 0; i < 62; i++) {
+                for (i = 0; i < 22; i++) {
+                    st.hi -= g54;
+                }
+            }
+            n--;
+        }
+        n--;
+    }
+    p[3] |= 0x5910 < ((int) x) || ((short) 0x9798);
+    if (y) {
+        st.hi ^= st.hi;
+    } else {
+        if (f9(0x55f0, a2[5])) {
+            st.hi -= ! 0xa163 <= 0x1ba6 < x || sp->count ? 112 : g63 ? ((long) 0x761) : x;
+        } else {
+            g21 ^= a10[5];
+        }
+    }
+    p[3] |= ! y;
+    {
+        if (((short) n ? n : g26)) {
+            st.hi -= a13[1];
+        } else {
+            sp->count |= sp->count ? x : a5[14];
+        }
+        g23 |= f8(n, (y));
+    }
+    x += st.lo < 0x8989 && sp->count == a6[12] * y;
+    return f7(((unsigned long) g27), f5(a7[8], 0x5a65));
+}
+
+long fn_207(long x, long y, long n, long *p)
+{
+    while (g25 ? 852 : sp->count) {
+        switch (x) {
+        case 3:
+            while (((int) a0[10])) {
+                a9[8] |= st.lo | 0x8124 || y ? f13(218, 661) : n;
+                n--;
+            }
+            break;
+        default:
+            for (i = 0; i < 54; i++) {
+                {
+                    st.hi = st.lo;
+                    x += - y || ((int) 0x4fb9) | 120 ? a10[4] : 658 ^ sp->lo ? x : 0xb1b5;
+                }
+            }
+        }
+        n--;
+    }
+    st.hi += st.lo ^ 264 | a3[15] | a1[13];
+    if (sp->count + g50 * 0x2c4e + a7[11]) {
+        p[0] += n + (p[2]) ? 0x7761 << 936 : p[0];
+    } else {
+        g61 = (((long) x ? 0x48ac : y));
+    }
+    sp->count += 495 & 0x9fa3 ? y : sp->lo ^ f20(a13[13], n);
+    if ((0xbdb3 | n)) {
+        switch (g37) {
+        case 9:
+            switch (x) {
+            case 3:
+                a5[3] -= ((unsigned long) a15[0] | y) & ~ 0x1e5 != g36 + 373;
+                break;
+            default:
+                a6[10] |= ((long) ~ x || 0xdb6d);
+            }
+            break;
+        default:
+            p[1] ^= a8[5];
+        }
+    } else {
+        switch (y) {
+        case 6:
+            while (n) {
+                p[2] -= ~ (f16(0x77f2, 445));
+                n--;
+            }
+            break;
+        default:
+            st.hi += ! ~ ((short) a5[0]);
+        }
+    }
+    while (! a10[8]) {
+        sp->count -= a5[8];
+        n--;
+    }
+    a2[10] = a2[14];
+    for (i = 0; i < 48; i++) {
+        if (68 & 0x69d8 && f30(0xfaac, n)) {
+            a8[15] = f19(a13[1] <= 0x240a, y - a5[0]);
+        } else {
+            st.hi ^= n;
+        }
+    }
+    sp->count |= f12(n, a9[6]) | f29(n, n);
+    a3[7] |= f12(x == y, ~ a7[12]);
+    return (0xdd06);
+}
+
+long fn_208(long x, long y, long n, long *p)
+{
+    if (g53 << st.lo + a13[11]) {
+        a13[12] = ! p[3];
+    } else {
+        p[1] -= a1[12];
+    }
+    switch (y) {
+    case 3:
+        st.hi = (((int) g36));
+        break;
+    default:
+        a1[12] = a5[13] <= y && y ? f20(st.lo, x) : (a2[11]);
+    }
+    x -= 0x8769;
+    st.hi |= f19(0x24b7 || a3[15], ~ y);
+    {
+        if (sp->lo) {
+            sp->count -= a0[13];
+        } else {
+            x += a9[7];
+        }
+        st.hi |= p[1];
+    }
+    {
+        st.hi = ! ~ 0xf257 >> - ((unsigned long) n);
+        g15 -= a13[5] | g33 * f15(y, 918) ^ f8(0xdc9, 59);
+    }
+    for (i = 0; i < 18; i++) {
+        for (i = 0; i < 79; i++) {
+            switch (x) {
+            case 2:
+                x |= x;
+                break;
+            default:
+                p[2] |= sp->lo;
+            }
+        }
+    }
+    g33 = - 0x6f31;
+    while (f26(551, 256)) {
+        x = a10[11];
+        n--;
+    }
+    return f16(g46, n) ^ f21(y, x);
+}
+
+long fn_209(long x, long y, long n, long *p)
+{
+    while (0xf9f1 ? g11 : 0xc24f) {
+        if ((428 ? y : 524)) {
+            p[1] -= ((short) (y) | x | 0x5ef2);
+        } else {
+            if (a8[2]) {
+                x ^= a11[5];
+            } else {
+                sp->count += ((int) f17(a12[8], 0xfdd0));
+            }
+        }
+        n--;
+    }
+    sp->count = ((short) f5(sp->lo, 0xa39c)) ^ y;
+    for (i = 0; i < 80; i++) {
+        while (st.lo || st.hi) {
+            st.hi |= 925;
+            n--;
+        }
+    }
+    a5[2] -= (~ a4[2]) & 667 && 153 ^ a6[14];
+    while (541 ? 700 : y) {
+        st.hi ^= a0[14] != p[2] < g37 != sp->lo ? 0xe501 : y ? y : x << p[0];
+        n--;
+    }
+    {
+        y |= (- 0x45f4 ? x : 823);
+        a1[2] -= (0x5197 >= st.hi) ? ((int) x) != ! a0[1] : x;
+    }
+    while (a8[10] < n) {
+        {
+            st.hi = (a13[4]);
+            x += 0x747e | st.lo * sp->count + ((unsigned long) st.hi);
+        }
+        n--;
+    }
+    for (i = 0; i < 86; i++) {
+        switch (g44) {
+        case 1:
+            sp->count = f8(0xa4c, 461) || f7(0x8aa9, g41);
+            break;
+        default:
+            p[3] += f1(st.lo << p[0], x);
+        }
+    }
+    sp->count = (a4[11]) == 466 ? x : x + 751 & y;
+    return 269 != n && st.hi << 621 << ~ (0x6bfb);
+}
+
+long fn_210(long x, long y, long n, long *p)
+{
+    while (f21(814, sp->lo)) {
+        while (a2[11]) {
+            {
+                if (sp->lo == g55 + ((int) sp->count)) {
+                    y = (37) || st.hi + (f26(180, x));
+                } else {
+                    y ^= ((short) 54 && st.hi != p[0]);
+                }
+                sp->count |= f10(f27(n, 175), 0x8fc);
+            }
+            n--;
+        }
+        n--;
+    }
+    if (742 * f0(467, x)) {
+        a15[5] ^= a6[9] & (170) >= 0x2fff - g38;
+    } else {
+        p[1] |= st.hi;
+    }
+    for (i = 0; i < 74; i++) {
+        switch (g40) {
+        case 1:
+            st.hi = ~ ! x && 222;
+            break;
+        default:
+            while (0xfc75) {
+                a13[6] |= y;
+                n--;
+            }
+        }
+    }
+    if (0x532d) {
+        st.hi = sp->lo;
+    } else {
+        a3[12] |= ((long) n);
+    }
+    switch (g53) {
+    case 6:
+        if (~ 0x8b37 ^ y) {
+            for (i = 0; i < 66; i++) {
+                sp->count -= y * 548 != 0x3900;
+            }
+        } else {
+            switch (x) {
+            case 6:
+                p[1] += 202 ? 18 : y != (st.lo) == 477 << ! x;
+                break;
+            default:
+                a4[8] += ((unsigned long) (p[3]));
+            }
+        }
+        break;
+    default:
+        sp->count ^= (y);
+    }
+    return g44 | f12(a14[10], 0x748e) && ! 69;
+}
+
+long fn_211(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 93; i++) {
+        switch (n) {
+        case 2:
+            while (((long) x)) {
+                a6[5] -= ((int) ! 0x2448 > 0x1230 * p[1]);
+                n--;
+            }
+            break;
+        default:
+            if (((int) a10[3] * 459)) {
+                p[2] |= 0x127b;
+            } else {
+                p[1] += n == f8(n, st.lo);
+            }
+        }
+    }
+    switch (x) {
+    case 3:
+        st.hi += - ((unsigned long) 0x78b1) == f18(y, a6[15]);
+        break;
+    default:
+        for (i = 0; i < 28; i++) {
+            a7[4] ^= f9(374, 0x9ebb);
+        }
+    }
+    if (((short) 0xfc7f == 0xae9c)) {
+        for (i = 0; i < 84; i++) {
+            g44 ^= - (0x76b4) ? st.hi : (st.lo);
+        }
+    } else {
+        sp->count ^= f13(f7(0x1a28, p[2]), 107 == 394);
+    }
+    for (i = 0; i < 6; i++) {
+        x += g16 ^ ((short) 107) ? ((unsigned long) 0xd8e3) | n : g60;
+    }
+    if (~ y ? a0[12] : p[0]) {
+        sp->count += ~ a7[12] << sp->lo * x;
+    } else {
+        x -= 0xb357 || ~ 0x895f >= sp->count * y ? 0x4c30 + 0x1885 : n >> 695;
+    }
+    for (i = 0; i < 63; i++) {
+        a6[1] |= y << st.hi ? (p[1]) : (~ 0xdc9e);
+    }
+    st.hi ^= g33;
+    y |= ! ~ 162 + x;
+    for (i = 0; i < 17; i++) {
+        switch (g35) {
+        case 7:
+            n ^= f14(0x6923 ? 764 : 0xc07, (0xfeec));
+            break;
+        default:
+            a4[2] ^= (578) >> f22(0xbbe1, n) >= ((long) a12[0] - 0x53c4);
+        }
+    }
+    return a2[2];
+}
+
+long fn_212(long x, long y, long n, long *p)
+{
+    a1[6] |= p[3];
+    n = ~ sp->count ? 0x6f69 : p[1] * (g3);
+    switch (n) {
+    case 9:
+        switch (y) {
+        case 1:
+            n |= (a8[7] - n && ((short) a7[11]));
+            break;
+        default:
+            a6[9] |= 453 || y ? (y) : sp->lo < a13[9] ? a12[4] | ((int) 305) : ((int) f9(n, 0x20fd));
+        }
+        break;
+    default:
+        switch (y) {
+        case 4:
+            sp->count = ((short) ~ n) - a4[6] >> 0xe047;
+            break;
+        default:
+            sp->count -= (- 0x2ac1) >> f28(a2[15], 9);
+        }
+    }
+    {
+        a4[1] += ~ - g4 >> x >= a2[7] & y > x;
+        n |= x >= ((unsigned long) st.hi) ? (a11[11]) : (994);
+    }
+    if (((unsigned long) st.lo < n)) {
+        p[2] -= ((long) ((int) ! 672));
+    } else {
+        {
+            while (0x11ef >> x) {
+                a1[8] -= ((unsigned long) (n < a11[4]));
+                n--;
+            }
+            st.hi ^= n << x;
+        }
+    }
+    while (144 & 0x9e95) {
+        st.hi ^= 0xfb7 ? g22 : p[1] & ((short) st.hi) + a0[9] << 0x21c2 != 0x44f5 < sp->lo;
+        n--;
+    }
+    {
+        st.hi -= - p[0];
+        a10[11] = ((short) g21);
+    }
+    return f28(y * 0x17f7, a9[4]);
+}
+
+long fn_213(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 61; i++) {
+        while (0xd553) {
+            y -= a4[10] >> 0x62ff < 965 != ((unsigned long) 813);
+            n--;
+        }
+    }
+    if (a11[5]) {
+        sp->count = (240) ? y || a8[5] : ((unsigned long) 751) == a10[6];
+    } else {
+        st.hi ^= a2[14] ^ y != a11[3] ? st.lo : 635 < x;
+    }
+    for (i = 0; i < 52; i++) {
+        if (0x9cf2 == 0xd737 & 0xd2d7 ? sp->lo : n) {
+            a15[12] += f21(((short) 0xe706), st.hi);
+        } else {
+            st.hi |= n;
+        }
+    }
+    for (i = 0; i < 89; i++) {
+        if (((unsigned long) ~ 750)) {
+            p[1] += - ! 0x21e7;
+        } else {
+            st.hi = f3(590 <= a0[14], ((short) st.hi));
+        }
+    }
+    for (i = 0; i < 24; i++) {
+        a7[2] += x;
+    }
+    if (- n >> 0x4e03) {
+        st.hi |= 0xd8b4 < 0xc25f ? g19 : ((int) a11[15]) != n != 576 <= st.lo;
+    } else {
+        sp->count = (p[0]);
+    }
+    switch (g6) {
+    case 1:
+        sp->count -= ((short) (x));
+        break;
+    default:
+        st.hi -= ! (762 != 81);
+    }
+    return (- x) < (g18 - 0xfd42);
+}
+
+long fn_214(long x, long y, long n, long *p)
+{
+    if (f0(x, a15[8]) >> y) {
+        {
+            switch (g6) {
+            case 8:
+                g48 ^= f27(256, 0x7f45) ? f20(0xd8b1, 12) : n - (a1[3] >= 0xc9ab);
+                break;
+            default:
+                a7[6] ^= f24(sp->lo, n) < x + a3[11] * y >= 0x9c1a < (y);
+            }
+            a7[7] = ((f4(128, n)));
+        }
+    } else {
+        while (f26(0xa34e, g10)) {
+            if (f28(sp->count, n)) {
+                p[1] |= f2(((short) 578), 0xb944 * y);
+            } else {
+                st.hi ^= ~ g45 ? a0[1] + n : ((long) x) <= (y + 497);
+            }
+            n--;
+        }
+    }
+    for (i = 0; i < 88; i++) {
+        x -= (f21(x, a10[1])) ^ x == 885 == ~ 0x995a;
+    }
+    while (a3[13]) {
+        while (n ? p[2] : 781) {
+            p[3] = 0x23aa;
+            n--;
+        }
+        n--;
+    }
+    if (408 ? 632 : g51 && 0x8a9b) {
+        if ((g7 ^ sp->count)) {
+            {
+                switch (x) {
+                case 3:
+                    p[2] |= st.hi && ((long) 0x724b);
+                    break;
+                default:
+                    sp->count = ((unsigned long) a7[13] - y * (a4[2]));
+                }
+                st.hi += f2(n * 0x8b9d, ! a14[6]);
+            }
+        } else {
+            st.hi -= ((short) 0xda3f ^ 697);
+        }
+    } else {
+        p[3] = ~ 0x9d55;
+    }
+    a3[5] |= ((int) - g43 | n);
+    while (~ 0x5e63) {
+        if (f29(0xae13, sp->count)) {
+            while (a14[2]) {
+                switch (y) {
+                case 9:
+                    a3[14] |= f13(a9[10] & x, 0xfb74 << 0x3fee);
+                    break;
+                default:
+                    g15 += ((unsigned long) ((long) n) >= n);
+                }
+                n--;
+            }
+        } else {
+            st.hi = f21(0xe631 >= 11, f29(n, a14[5]));
+        }
+        n--;
+    }
+    return a2[3] - ! x <= n;
+}
+
+long fn_215(long x, long y, long n, long *p)
+{
+    sp->count -= 0x44b7 * g9 << ((long) 768) || st.lo;
+    p[3] |= 0x847d < x * (g55) ^ ((unsigned long) sp->lo);
+    if (f8(g12, g20) & st.lo >> 0x625a) {
+        p[2] += n | n | 0x93f2 >> a4[0];
+    } else {
+        sp->count |= 0xeea4;
+    }
+    for (i = 0; i < 11; i++) {
+        st.hi = f8(0xfda2, g42);
+    }
+    {
+        if (a10[0] | st.hi ? y : a6[14]) {
+            sp->count |= a4[12] ^ x || p[3] & f13(n, y);
+        } else {
+            p[2] = x;
+        }
+        sp->count = ! g50 << 0x1a57 != a13[13] ? y - n : x * 211;
+    }
+    while (631 | a4[6]) {
+        while (f5(g4, 0x20e)) {
+            st.hi -= 0x7506;
+            n--;
+        }
+        n--;
+    }
+    while (n) {
+        {
+            if (~ (a2[6])) {
+                a12[11] = sp->count;
+            } else {
+                p[3] += ((int) 335) >= a14[4];
+            }
+            a14[0] += ((long) f8(y, a0[7]) >> 0x3709);
+        }
+        n--;
+    }
+    while (0xb832 ? g0 : a6[12]) {
+        if (432) {
+            sp->count |= y ? ~ a7[0] : ~ a8[7] >= g35 > g38 > n;
+        } else {
+            p[2] ^= y == y + g58 <= y ^ 356 || n;
+        }
+        n--;
+    }
+    return ! 977 ? g62 : y <= ! a1[9];
+}
+
+long fn_216(long x, long y, long n, long *p)
+{
+    if (st.lo == ((short) n)) {
+        while (163) {
+            for (i = 0; i < 87; i++) {
+                a2[5] |= 624;
+            }
+            n--;
+        }
+    } else {
+        switch (g45) {
+        case 0:
+            while (sp->count) {
+                sp->count -= 0x2ecd;
+                n--;
+            }
+            break;
+        default:
+            sp->count |= a14[15];
+        }
+    }
+    sp->count = g21;
+    if (a8[6]) {
+        for (i = 0; i < 82; i++) {
+            switch (y) {
+            case 8:
+                for (i = 0; i < 97; i++) {
+                    st.hi -= - - n >> 167;
+                }
+                break;
+            default:
+                if (g18 == a5[12] == a10[3]) {
+                    sp->count -= y ? (y < 0x1041) : f14(368, 0x17ee) > n ? x : x;
+                } else {
+                    p[3] += f10(a15[10], n) & 960 ? f21(a9[9], a7[11]) : - 23 >= - g45;
+                }
+            }
+        }
+    } else {
+        switch (y) {
+        case 6:
+            sp->count = a10[5] - 0x4d5b || g23;
+            break;
+        default:
+            while (y - 75) {
+                a6[14] |= g34 == 515 == f13(a9[14], 643) ? a9[4] < 692 < a2[2] : ((int) f16(884, n));
+                n--;
+            }
+        }
+    }
+    for (i = 0; i < 21; i++) {
+        a2[4] -= ((unsigned long) f10(n, sp->lo) & sp->lo);
+    }
+    while ((a2[1])) {
+        sp->count += ! (296);
+        n--;
+    }
+    return g28 == 0xc4cc ? f7(st.lo, sp->count) : y >= sp->count || 959;
+}
+
+long fn_217(long x, long y, long n, long *p)
+{
+    switch (x) {
+    case 2:
+        {
+            {
+                st.hi |= ~ st.hi + f30(st.hi, a12[15]) ? st.lo : 0xac4 >> a8[1] & f10(0xf686, 322);
+                a12[10] |= ~ 394 & sp->lo + 0x525e & x;
+            }
+            sp->count |= st.lo - g53 << st.lo ? a0[11] == 0x213e : x == sp->lo;
+        }
+        break;
+    default:
+        while (sp->lo == n) {
+            n |= x ? ! 0x993e : (0xe767) > 234 ? 0xc847 : 0x1045 ? x | n : (0xf9cb);
+            n--;
+        }
+    }
+    if (((unsigned long) y)) {
+        st.hi += n & 0xccc8;
+    } else {
+        if (((unsigned long) p[1]) < f11(918, 0x760)) {
+            p[0] += (0xd858) + a10[9] > n & 245;
+        } else {
+            a10[0] |= (x && a1[6]) ? x ^ g57 ? ! 802 : 0x42a5 | y : 0x8af6 ? 0xaf9e : 0x284d >= 0x30f7 ^ 177;
+        }
+    }
+    a8[13] += a3[7] ? 0xa24b : 0x2d45 || 902 > (x);
+    if (x ? a15[10] : g15 ? g38 ? 109 : 809 : ! p[1]) {
+        while (a8[11]) {
+            {
+                g20 ^= - ! st.lo + x;
+                p[0] ^= - p[2] && 640 ? 0xdca5 : g46;
+            }
+            n--;
+        }
+    } else {
+        while (0x3270 ? a14[0] : 908) {
+            switch (x) {
+            case 4:
+                for (i = 0; i < 42; i++) {
+                    p[1] -= (a6[7]);
+                }
+                break;
+            default:
+                while (a10[6] & y) {
+                    x -= ((a13[0]) < f29(p[0], g26));
+                    n--;
+                }
+            }
+            n--;
+        }
+    }
+    st.hi -= ((long) sp->lo) ? 19 << 202 : g48 != 645 ^ ! st.lo <= 435;
+    while (((long) 806)) {
+        for (i = 0; i < 84; i++) {
+            p[3] ^= f3(g49 > 0x8934, a7[2] <= 0x6410);
+        }
+        n--;
+    }
+    return 449;
+}
+
+long fn_218(long x, long y, long n, long *p)
+{
+    if (a5[5]) {
+        for (i = 0; i < 84; i++) {
+            n = (a14[5]) ^ f27(894, a0[1]) != ! 603 ^ a1[11] >= 0x9c2;
+        }
+    } else {
+        {
+            st.hi |= 0x9ed ? ! g32 : (g7) >> y || a8[15];
+            p[1] |= (st.lo) != 0x8c56 != 100 | 99 >= ((short) x);
+        }
+    }
+    sp->count += f28(x, sp->lo) > y << ~ a9[7] == 926 + n;
+    {
+        a2[5] ^= st.hi;
+        st.hi |= ((unsigned long) st.hi);
+    }
+    switch (x) {
+    case 5:
+        while (! y) {
+            st.hi ^= n;
+            n--;
+        }
+        break;
+    default:
+        {
+            sp->count = g25 | f5(x, 0x969) && ~ 681 ^ g26 & g26;
+            a2[5] |= a11[8];
+        }
+    }
+    switch (x) {
+    case 6:
+        a10[6] = y;
+        break;
+    default:
+        a12[5] ^= f30(n, a1[1]) ^ y & 0x5869 && f18(g39, y);
+    }
+    for (i = 0; i < 53; i++) {
+        st.hi ^= y;
+    }
+    st.hi += 541;
+    return f2(729, y) >> - n ? st.lo : 0x46cb;
+}
+
+long fn_219(long x, long y, long n, long *p)
+{
+    sp->count -= p[3];
+    for (i = 0; i < 83; i++) {
+        if (n ^ 609 - n) {
+            while (y ? a7[5] : 0xde7) {
+                sp->count ^= x || (a14[13]) || ((298));
+                n--;
+            }
+        } else {
+            for (i = 0; i < 63; i++) {
+                sp->count -= n <= - n & a10[7] <= a2[0] ? a6[13] ? y : 50 : sp->count;
+            }
+        }
+    }
+    while ((x)) {
+        p[1] ^= - a1[15];
+        n--;
+    }
+    a10[12] += (- a4[4] >> g37);
+    for (i = 0; i < 64; i++) {
+        st.hi |= a9[9] << y > f24(a10[6], x);
+    }
+    while ((x)) {
+        if ((y >> p[3])) {
+            for (i = 0; i < 17; i++) {
+                st.hi += - 813 > a10[0] != ! x & y;
+            }
+        } else {
+            switch (g1) {
+            case 7:
+                p[1] |= (((short) ! 0xd0fd));
+                break;
+            default:
+                y = a10[10];
+            }
+        }
+        n--;
+    }
+    while (483) {
+        while (f29(st.lo, n)) {
+            p[0] += f19(~ g50, st.lo);
+            n--;
+        }
+        n--;
+    }
+    for (i = 0; i < 31; i++) {
+        {
+            while (n - 0x91ae) {
+                st.hi = f1(p[1], st.lo) & 0xddb8 * n ? 0xba87 ? sp->count : n * p[2] ? sp->count : x : ! y - f31(a13[0], 818);
+                n--;
+            }
+            p[2] ^= ((int) ((long) g47 >> a14[14]));
+        }
+    }
+    st.hi = f17(f7(n, 609), (x));
+    for (i = 0; i < 82; i++) {
+        y = n | - a3[10] ? a7[3] : a3[15];
+    }
+    return ~ (661 ? 0x7fd7 : 91);
+}
+
+long fn_220(long x, long y, long n, long *p)
+{
+    p[3] = 0xdd8a;
+    for (i = 0; i < 19; i++) {
+        while ((375)) {
+            if (a9[14] >= g8 >> x) {
+                p[0] = ! f4(x, n);
+            } else {
+                y = f10(a13[4] && a15[3], 0x18d9);
+            }
+            n--;
+        }
+    }
+    if ((0x6d4d ? a14[4] : a15[5])) {
+        st.hi += f4(0xe99f, x) ? y : (0xdc3);
+    } else {
+        a8[4] -= 0x81d7;
+    }
+    return ((unsigned long) ! ! a3[10]);
+}
+
+long fn_221(long x, long y, long n, long *p)
+{
+    p[2] |= x;
+    sp->count |= a13[10];
+    x += x;
+    for (i = 0; i < 63; i++) {
+        {
+            p[1] |= (f19(33, sp->count));
+            sp->count = ~ 0xe4d8 ? 721 : y ? f8(x, g43) : a5[11] >> y < st.lo != a7[14];
+        }
+    }
+    while (y) {
+        st.hi ^= 0x9954 - g3 * n & x;
+        n--;
+    }
+    for (i = 0; i < 79; i++) {
+        while (((short) a1[5])) {
+            a5[10] += f21(n, g46);
+            n--;
+        }
+    }
+    for (i = 0; i < 56; i++) {
+        while (292) {
+            {
+                {
+                    sp->count += ((long) p[0]) * sp->lo ? 0x4a98 : n <= g48 != a1[9] + y;
+                    g56 -= st.hi < 0x8fff;
+                }
+                st.hi += f14(n, g54) ? f16(x, 0x7f56) : ((short) 0x2020);
+            }
+            n--;
+        }
+    }
+    {
+        a9[9] -= 227 | 0xf004 & ((unsigned long) 6) < 0xf01a << y;
+        n = x | y >> ((short) y);
+    }
+    return (((long) 0x9902 - 0xcb0c));
+}
+
+long fn_222(long x, long y, long n, long *p)
+{
+    st.hi = f29(sp->lo == g43, g12 > a5[6]);
+    for (i = 0; i < 34; i++) {
+        n ^= ~ (g60) ? 0xba3 ? n : 0x71e7 : a13[15] >= sp->lo;
+    }
+    switch (x) {
+    case 4:
+        st.hi |= f17(0xf6a0, a6[15]) && y;
+        break;
+    default:
+        st.hi |= 0x670;
+    }
+    if (p[1] == a11[5] ? - sp->count : 0x18b8 * y) {
+        while (n >> a13[13]) {
+            while (f20(863, st.lo)) {
+                {
+                    a11[9] = ((int) g24 ? 736 : y) + a13[11];
+                    a4[4] |= f13(((unsigned long) 0x6da8), x > 0x5b95);
+                }
+                n--;
+            }
+            n--;
+        }
+    } else {
+        {
+            p[0] = sp->lo ? g47 == a8[13] : 0x6981 & - x;
+            st.hi ^= ~ ((unsigned long) 569) ? 492 != ((unsigned long) 0xfb8b) : 891 ? n : 353 >= sp->lo && y;
+        }
+    }
+    return f29(g31, 0xd323) != x != a1[1] << 0x704d;
+}
+
+long fn_223(long x, long y, long n, long *p)
+{
+    a5[14] ^= 600;
+    p[3] = 622;
+    for (i = 0; i < 41; i++) {
+        y += y > (g41) & 948 && st.lo;
+    }
+    if (! 788 << y) {
+        p[1] += (sp->lo) ? x - 0xd04e : ((unsigned long) a5[13]) || ((long) a2[1]);
+    } else {
+        n ^= ~ p[1] > x ^ st.hi == f7(n, g32) & x > st.lo;
+    }
+    while (p[0] | 240) {
+        while (x) {
+            if (y) {
+                p[2] = 971 | 538 << p[2] >= x || a4[1];
+            } else {
+                {
+                    st.hi ^= - (a4[1]) <= sp->count > sp->count;
+                    sp->count -= f11(st.hi ^ g54, 0x3a5f < 0xea15);
+                }
+            }
+            n--;
+        }
+        n--;
+    }
+    switch (n) {
+    case 2:
+        sp->count |= ((short) st.hi) << st.hi - p[1] & g35;
+        break;
+    default:
+        p[1] += f2(a1[14] ? a3[0] : x, ~ a2[13]);
+    }
+    {
+        while (g56) {
+            sp->count |= f17(402, ((short) 0xbd8f));
+            n--;
+        }
+        p[3] += (st.hi) ? ((unsigned long) a5[14]) : 0xf5d5 ? st.hi : 471 != sp->lo;
+    }
+    return - f8(0xa8fb, 0xf367) * a5[11];
+}
+
+long fn_224(long x, long y, long n, long *p)
+{
+    p[2] -= ! g31;
+    {
+        for (i = 0; i < 9; i++) {
+            while (((short) st.lo)) {
+                if (f16(232, st.lo)) {
+                    g25 += (n);
+                } else {
+                    n -= (f19(0xd776, a12[1]));
+                }
+                n--;
+            }
+        }
+        st.hi ^= ((unsigned long) a6[4]);
+    }
+    for (i = 0; i < 94; i++) {
+        g32 |= x + x == f31(a3[3], 643) == y - 506 ? g21 : p[3];
+    }
+    return (((long) y) >= 0x3bb5 + a15[12]);
+}
+
+long fn_225(long x, long y, long n, long *p)
+{
+    {
+        switch (x) {
+        case 8:
+            sp->count -= f18(y ? 309 : st.hi, (0xe45e));
+            break;
+        default:
+            x -= - ((unsigned long) (sp->count));
+        }
+        p[2] ^= st.hi;
+    }
+    x = 707;
+    {
+        if (a9[6] >> g49 ? ((int) g63) : ((int) n)) {
+            p[2] = f27(0xc72 == 549, y ? n : a13[15]);
+        } else {
+            a12[5] -= ~ 0x8cdb;
+        }
+        n |= n ? f0(769, x) > 0xa80c : - x;
+    }
+    while (sp->lo <= 0x7552) {
+        while ((y)) {
+            sp->count |= f25(((long) p[1]), x);
+            n--;
+        }
+        n--;
+    }
+    switch (n) {
+    case 7:
+        while (0x36ca << 13) {
+            a12[11] ^= g7;
+            n--;
+        }
+        break;
+    default:
+        if (x ^ y ? 815 : x) {
+            n ^= ! 0xe2b5 ? (p[2] ? 742 : 0x3e36) : y;
+        } else {
+            a1[8] -= 0xdf7f;
+        }
+    }
+    if (st.hi) {
+        p[0] += x & ~ 682;
+    } else {
+        sp->count += ((short) 0x7666 ? 0x9725 : ((short) a13[7]));
+    }
+    switch (n) {
+    case 1:
+        if (((short) st.lo)) {
+            {
+                for (i = 0; i < 38; i++) {
+                    p[2] ^= ~ g20 - 0x76d5 * - st.hi < 446 <= sp->count;
+                }
+                sp->count |= ((short) 0x6551) < a4[12] ^ x - n << st.lo && 697;
+            }
+        } else {
+            while (((long) 823)) {
+                while (sp->count) {
+                    y ^= f18(267 <= y, f10(g39, a2[6]));
+                    n--;
+                }
+                n--;
+            }
+        }
+        break;
+    default:
+        while (f4(sp->count, sp->count)) {
+            {
+                switch (x) {
+                case 8:
+                    a5[11] ^= 0xed96 ? y : y << a13[2] ? f23(0x8871, x) : ((long) 0x403);
+                    break;
+                default:
+                    st.hi -= ((unsigned long) 0x54c6 >= 0x784f - f21(322, 394));
+                }
+                sp->count -= - f7(0x393c, a4[6]);
+            }
+            n--;
+        }
+    }
+    switch (x) {
+    case 0:
+        for (i = 0; i < 38; i++) {
+            switch (g7) {
+            case 6:
+                sp->count |= ! (0xd38f ? 0x889b : x);
+                break;
+            default:
+                y += f25(a2[11] ? sp->lo : 308, 577 < 0x99ba);
+            }
+        }
+        break;
+    default:
+        if (0x5644 >> y << st.lo) {
+            a7[14] += 0x2b81;
+        } else {
+            switch (n) {
+            case 7:
+                st.hi ^= sp->lo > 977 > g14 && st.hi << st.hi - 0x6733 == ! 0xacf8;
+                break;
+            default:
+                p[1] += ((long) 0xda3a && 945);
+            }
+        }
+    }
+    return ((short) y) ? 676 : sp->count;
+}
+
+long fn_226(long x, long y, long n, long *p)
+{
+    while (f3(534, 0x8332)) {
+        if (st.lo ? 0xf1e9 : 0xbcaa && y <= st.hi) {
+            a14[8] |= (f27(a11[14], sp->count));
+        } else {
+            st.hi = x ? 0xa259 & y : sp->count + y + a4[10] ^ 436;
+        }
+        n--;
+    }
+    {
+        for (i = 0; i < 91; i++) {
+            while (g27) {
+                for (i = 0; i < 33; i++) {
+                    p[3] += ! n;
+                }
+                n--;
+            }
+        }
+        y ^= a2[9];
+    }
+    st.hi -= p[2];
+    g21 -= (x) || f11(0x5d58, x) && g5 != (g16);
+    if (444) {
+        y += 560 || 915 ? 0x1f25 : - g19 - a4[3];
+    } else {
+        sp->count = (! 0xe342);
+    }
+    return (133);
+}
+
+long fn_227(long x, long y, long n, long *p)
+{
+    while (p[1] ? a12[13] : n) {
+        a9[7] += sp->lo;
+        n--;
+    }
+    {
+        p[2] -= - 0x37f1 - a8[14] == 722;
+        st.hi |= (x) || g40;
+    }
+    {
+        switch (n) {
+        case 8:
+            sp->count += ((long) 855 - g13) ? 0x9ac0 << 832 != 703 : ((long) a6[2]) || y != g5;
+            break;
+        default:
+            a0[11] |= g30 ^ n << f26(a1[11], a15[10]) == - n * 139;
+        }
+        p[3] -= 433 ? a4[11] : st.hi && 14 > 581 >> g5;
+    }
+    for (i = 0; i < 49; i++) {
+        st.hi += n <= ((short) 673);
+    }
+    a8[9] = ((short) p[2]) - 787 && sp->count;
+    {
+        n ^= ((unsigned long) 0x4196 + n) > ((short) - x);
+        p[3] ^= a14[6];
+    }
+    if (sp->count) {
+        {
+            for (i = 0; i < 7; i++) {
+                if ((0x4945)) {
+                    p[0] ^= g60 & p[0] && sp->count ? f12(0x706b, a10[2]) : st.hi << 0x7136;
+                } else {
+                    g53 += (y) != (0x9e42) ? 0x9e3d : st.hi + st.lo ^ 375;
+                }
+            }
+            a7[13] ^= 0x99fc && sp->lo != st.lo;
+        }
+    } else {
+        st.hi |= ((unsigned long) st.hi && 0x1ee9 >> 210 ^ st.hi);
+    }
+    return x;
+}
+
+long fn_228(long x, long y, long n, long *p)
+{
+    switch (y) {
+    case 8:
+        a9[13] ^= n;
+        break;
+    default:
+        sp->count = g1 ? (862) : 0x548 > 913 - g29 <= a3[11];
+    }
+    for (i = 0; i < 59; i++) {
+        {
+            p[2] |= ~ sp->lo;
+            x ^= 0x5222 || sp->lo == 764 >= 141 ? st.lo : a12[8];
+        }
+    }
+    p[1] = f9(653, y) | sp->lo;
+    while (0x79b9) {
+        n = f13(sp->lo, sp->lo) == 812 <= a12[15] | a6[5] + n;
+        n--;
+    }
+    return 637 == 789 | ((long) st.hi) - st.lo;
+}
+
+long fn_229(long x, long y, long n, long *p)
+{
+    if (f4(g44, n)) {
+        while (a4[9]) {
+            switch (y) {
+            case 1:
+                p[2] -= f14(g59, a12[11]) + 471 + x != (a1[13]);
+                break;
+            default:
+                n ^= 285 ? ((unsigned long) 285) | a9[11] < x : - sp->count <= 849;
+            }
+            n--;
+        }
+    } else {
+        while (((long) 0x85c0)) {
+            switch (n) {
+            case 6:
+                p[2] += sp->lo != (a10[11]) >> a1[3];
+                break;
+            default:
+                sp->count = sp->count ? 0xae7c ? sp->count : sp->count : st.lo ? x : p[2] && 0x79c;
+            }
+            n--;
+        }
+    }
+    {
+        for (i = 0; i < 38; i++) {
+            switch (y) {
+            case 1:
+                while (f15(a15[12], sp->count)) {
+                    a7[12] = f26(n, a1[10]) && ! ~ a7[8];
+                    n--;
+                }
+                break;
+            default:
+                for (i = 0; i < 36; i++) {
+                    a6[15] ^= f1(a2[6], ((short) x));
+                }
+            }
+        }
+        p[3] = ((long) st.hi <= st.hi) && (y * y);
+    }
+    switch (g60) {
+    case 0:
+        n += 587 << 580 < p[2] && 209;
+        break;
+    default:
+        p[0] += a4[6];
+    }
+    g11 |= y;
+    switch (g56) {
+    case 9:
+        sp->count += f21((st.lo), (sp->count));
+        break;
+    default:
+        a10[5] -= ((unsigned long) g62 ? x : sp->lo) ? 0x7366 : x;
+    }
+    a13[10] += ((unsigned long) n) & g11 | a1[7] & 487;
+    while (111 && st.lo) {
+        {
+            if ((((int) 0xcef2))) {
+                if (~ x | y) {
+                    x = f9(sp->count, 839) + 0xdf62 ? g20 : sp->count - a13[6];
+                } else {
+                    st.hi |= - - sp->count - ~ a10[13] ? x : y;
+                }
+            } else {
+                {
+                    n ^= f12(908 ? 893 : y, g58);
+                    n += n;
+                }
+            }
+            p[2] = 381;
+        }
+        n--;
+    }
+    return a6[12] & 0xd948;
+}
+
+long fn_230(long x, long y, long n, long *p)
+{
+    if (a13[8]) {
+        a2[10] += - 834 || y >> f30(g30, n);
+    } else {
+        x += a11[7];
+    }
+    while (638 ? a14[11] : 0x6031) {
+        {
+            switch (x) {
+            case 1:
+                p[2] = 0xb56a;
+                break;
+            default:
+                a9[7] |= ((unsigned long) ((int) n)) - (73 << y);
+            }
+            p[2] += 0x9473 && a3[10] <= a8[11] > y ? ((short) x) : a0[7];
+        }
+        n--;
+    }
+    while (sp->lo > sp->count) {
+        while (f10(685, n)) {
+            for (i = 0; i < 44; i++) {
+                a15[12] |= x;
+            }
+            n--;
+        }
+        n--;
+    }
+    if (- 0xa795 | x) {
+        a13[7] += (a5[6] < sp->count ? a13[12] <= x : f16(st.lo, 373));
+    } else {
+        p[0] ^= - x;
+    }
+    if (339 | a11[4] == st.lo) {
+        st.hi = (st.hi * a8[7] != 0x29a1 == 882);
+    } else {
+        sp->count ^= f3(f23(g46, a14[13]), 452);
+    }
+    for (i = 0; i < 74; i++) {
+        switch (x) {
+        case 0:
+            st.hi -= ((short) (0x2bb6 - n));
+            break;
+        default:
+            for (i = 0; i < 87; i++) {
+                for (i = 0; i < 93; i++) {
+                    sp->count -= (! a4[11]);
+                }
+            }
+        }
+    }
+    if (0x15ed ? g26 : g42 * ~ 0xe360) {
+        st.hi |= f23(y, 302 >> y);
+    } else {
+        st.hi -= (g44) ^ a10[5] ? f31(0x1ad0, sp->lo) : ~ 0x871d >= 0xcf85 && 6;
+    }
+    switch (g31) {
+    case 8:
+        while ((143)) {
+            y ^= y < y;
+            n--;
+        }
+        break;
+    default:
+        switch (x) {
+        case 4:
+            while (627 >= a1[7]) {
+                {
+                    sp->count -= f25(st.hi, y) == f16(st.lo, 0x39eb);
+                    p[3] |= (((unsigned long) 731) >= n - p[1]);
+                }
+                n--;
+            }
+            break;
+        default:
+            while (0xac22) {
+                if ((489 || n)) {
+                    sp->count ^= ! a15[9];
+                } else {
+                    sp->count ^= 619;
+                }
+                n--;
+            }
+        }
+    }
+    switch (x) {
+    case 5:
+        p[1] ^= (p[0]);
+        break;
+    default:
+        x |= p[1] >= 128;
+    }
+    switch (n) {
+    case 0:
+        {
+            while (p[2] >= y) {
+                st.hi |= f1(a9[0], 0x259) <= a4[9] ? a11[0] : 0xe10d;
+                n--;
+            }
+            st.hi -= f5(g0, 0xf329) * f6(p[3], st.lo) > ~ a7[8];
+        }
+        break;
+    default:
+        a4[6] += a6[2] ^ y <= f5(n, sp->lo);
+    }
+    return n & x & 0x1052 - p[2] >> p[1] || a4[3] + 0x3d51 ? 0xfe20 : 352;
+}
+
+long fn_231(long x, long y, long n, long *p)
+{
+    while (n) {
+        n += 0xf64d;
+        n--;
+    }
+    if (x <= 384 ^ f0(0x42bc, a15[2])) {
+        for (i = 0; i < 87; i++) {
+            while (920) {
+                sp->count += f7(((unsigned long) n), f8(y, 176));
+                n--;
+            }
+        }
+    } else {
+        if (f26(0xa848, 967)) {
+            st.hi ^= a0[2] <= 0xf5a9 || 220 - y || x * a11[8];
+        } else {
+            if (f13(n, a2[7]) ? ((long) x) : ! 773) {
+                p[1] ^= st.lo <= a2[0] != sp->lo | n + a4[8];
+            } else {
+                a12[0] = 230;
+            }
+        }
+    }
+    sp->count ^= 0xaeb5;
+    for (i = 0; i < 15; i++) {
+        switch (g47) {
+        case 0:
+            sp->count ^= x >= 688 || x && f10(a10[12], sp->lo);
+            break;
+        default:
+            sp->count |= y;
+        }
+    }
+    st.hi |= (0x6bb <= st.lo) == ~ a9[3] == 881;
+    while (g8 ? a12[6] : g29) {
+        while (a1[7] | 0x387c) {
+            st.hi ^= st.hi * f28(a15[7], n);
+            n--;
+        }
+        n--;
+    }
+    while ((112)) {
+        while ((g34)) {
+            while (a11[5] * n) {
+                a8[15] += f28(((long) 0xdddd), a15[8] || 0x3942);
+                n--;
+            }
+            n--;
+        }
+        n--;
+    }
+    switch (g45) {
+    case 7:
+        x ^= ((unsigned long) y >> 0xb40b ? 615 ? a8[14] : g56 : ~ 924);
+        break;
+    default:
+        if (y * x ? g0 : x) {
+            sp->count += 0x45d9 * y != n >= g32 + 0x89db;
+        } else {
+            while (st.lo) {
+                if (n) {
+                    p[2] -= 218 ? st.lo == y * p[0] : ~ n | 0x2000;
+                } else {
+                    p[2] -= ~ sp->count ? y : 77 < a10[12] | a7[11];
+                }
+                n--;
+            }
+        }
+    }
+    for (i = 0; i < 78; i++) {
+        {
+            switch (n) {
+            case 1:
+                switch (n) {
+                case 9:
+                    p[2] = x == sp->lo ? f14(278, a12[4]) : x && st.hi;
+                    break;
+                default:
+                    sp->count ^= ! x & n || x;
+                }
+                break;
+            default:
+                if (x || a13[10] ^ ~ g38) {
+                    a0[14] ^= 82 | 789;
+                } else {
+                    st.hi += (f27(st.hi, a4[13])) ? ~ st.hi ? a14[3] : a6[5] : (y) ? ! g14 : 0xe292;
+                }
+            }
+            st.hi -= a10[4];
+        }
+    }
+    for (i = 0; i < 92; i++) {
+        p[1] |= - 0x567c * 287 >> f23(a0[14], y);
+    }
+    return f3(0xcd09, a0[8]) >= y;
+}
+
+long fn_232(long x, long y, long n, long *p)
+{
+    switch (x) {
+    case 5:
+        sp->count |= x || f23(105, sp->lo);
+        break;
+    default:
+        p[3] += n >> st.hi;
+    }
+    a2[7] |= ! f4(sp->count, 0xbc6);
+    {
+        for (i = 0; i < 11; i++) {
+            sp->count -= ~ sp->count * 794 ? y : ((int) g13 ? 446 : sp->count);
+        }
+        g49 += sp->lo;
+    }
+    g6 -= (((unsigned long) x) | x);
+    while (- g59) {
+        a10[12] |= (~ f17(805, y));
+        n--;
+    }
+    {
+        p[2] -= ((int) (y ? y : 0xec30));
+        a0[8] += ((short) f19(a15[11], g34));
+    }
+    y |= x;
+    while (a11[11]) {
+        switch (x) {
+        case 2:
+            p[2] = ((short) a2[12]);
+            break;
+        default:
+            st.hi = 466;
+        }
+        n--;
+    }
+    {
+        for (i = 0; i < 6; i++) {
+            sp->count += ! ! n - x;
+        }
+        n = ! 0x1081;
+    }
+    if (((int) n) << x) {
+        st.hi = g12;
+    } else {
+        a7[15] = 79 ^ ! a9[9] >> y;
+    }
+    return ((short) y) <= - a12[4] <= a3[11];
+}
+
+long fn_233(long x, long y, long n, long *p)
+{
+    while (x) {
+        p[1] ^= a3[3] >= - sp->count == ((int) ! g37);
+        n--;
+    }
+    for (i = 0; i < 35; i++) {
+        switch (x) {
+        case 0:
+            for (i = 0; i < 46; i++) {
+                p[2] |= f7(- a1[8], n);
+            }
+            break;
+        default:
+            while (237 || a9[5]) {
+                if ((sp->count <= a4[4])) {
+                    sp->count -= (g11) != (! x);
+                } else {
+                    a15[14] -= 0x2279 ? f23(0xf539, a6[15]) : x;
+                }
+                n--;
+            }
+        }
+    }
+    if (f21(124, a7[15]) != x || 0x1039) {
+        for (i = 0; i < 72; i++) {
+            if ((a14[3]) ? ~ a10[2] : (938)) {
+                p[3] += ((long) ((long) a2[0])) >> 959;
+            } else {
+                for (i = 0; i < 79; i++) {
+                    sp->count -= ! x < n;
+                }
+            }
+        }
+    } else {
+        st.hi |= 0xac4f == g9 & st.lo | ! ((unsigned long) a6[4]);
+    }
+    st.hi |= y;
+    {
+        a1[9] = f7(g1, g27) == - a9[2] ? f13(n, 0xaefe) : 0xdf41;
+        sp->count -= f16((653), (0x53e4));
+    }
+    g20 += 0x8356 == 101 ? (145) : 483 == a8[9] << f1(n, a15[2]);
+    switch (x) {
+    case 8:
+        for (i = 0; i < 40; i++) {
+            x -= 0x2454;
+        }
+        break;
+    default:
+        for (i = 0; i < 32; i++) {
+            sp->count -= f7(452, 0xa60f) * ((long) 0x6836);
+        }
+    }
+    return - a13[4] * ((long) 0x32a9) || ((int) x * 804);
+}
+
+long fn_234(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 40; i++) {
+        if (135 ? f6(y, 701) : f3(g54, a10[8])) {
+            for (i = 0; i < 25; i++) {
+                {
+                    p[3] ^= ((short) n >= y ? f3(a8[11], a12[13]) : a13[3] != a15[15]);
+                    st.hi ^= x || 383 - 0x4325 < g3;
+                }
+            }
+        } else {
+            n |= st.lo && (((long) 164));
+        }
+    }
+    {
+        for (i = 0; i < 44; i++) {
+            st.hi -= 0x5dd3;
+        }
+        n += f1(p[1], a1[0]);
+    }
+    for (i = 0; i < 80; i++) {
+        a6[4] = (((long) 0x2c2)) || ((int) p[2]) + st.lo || g0;
+    }
+    return (a15[2]) <= sp->lo * a9[9] >= a11[15] ? a2[12] : n ? g8 : ((int) g52);
+}
+
+long fn_235(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 54; i++) {
+        sp->count = f29(534 || a13[5], 0xf83a);
+    }
+    sp->count ^= - (y);
+    g55 -= (x) > 456 + 663 <= (sp->lo ? n : 869);
+    switch (g9) {
+    case 9:
+        y = p[1] ? x : y >= 0x86f6 && st.hi == ~ n >> ~ p[2];
+        break;
+    default:
+        st.hi |= (~ f12(n, x));
+    }
+    return ((long) ((short) y));
+}
+
+long fn_236(long x, long y, long n, long *p)
+{
+    p[2] = y;
+    if (0x2677) {
+        for (i = 0; i < 72; i++) {
+            while (f14(y, n)) {
+                n |= f5(((unsigned long) a6[11]), ((long) a15[7]));
+                n--;
+            }
+        }
+    } else {
+        {
+            for (i = 0; i < 81; i++) {
+                sp->count ^= st.hi >= 0xe9e9 ? 0x5a68 >= x : (sp->count) >= f22(p[1], a15[11]);
+            }
+            sp->count |= 0xf950;
+        }
+    }
+    while (f10(p[1], n)) {
+        p[2] += sp->lo;
+        n--;
+    }
+    {
+        switch (n) {
+        case 5:
+            g13 += (! 694);
+            break;
+        default:
+            x -= f12(((short) st.lo), 0x54a1 | n);
+        }
+        p[1] -= 664 ^ st.hi;
+    }
+    return a13[11] != y & st.hi < a7[4] >= sp->lo && a2[10] == 0xad94 < 0x70ec;
+}
+
+long fn_237(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 17; i++) {
+        for (i = 0; i < 32; i++) {
+            sp->count |= ((int) x << y) > y;
+        }
+    }
+    a10[13] -= f9(0x54ad == 718, ((long) x));
+    a12[12] ^= g48;
+    return 645;
+}
+
+long fn_238(long x, long y, long n, long *p)
+{
+    switch (x) {
+    case 4:
+        sp->count ^= ! f0(0xe4fa, p[1]);
+        break;
+    default:
+        st.hi = n == ! x;
+    }
+    for (i = 0; i < 98; i++) {
+        for (i = 0; i < 33; i++) {
+            if (g42) {
+                while (x | y) {
+                    a12[8] -= n;
+                    n--;
+                }
+            } else {
+                for (i = 0; i < 40; i++) {
+                    p[1] |= g14;
+                }
+            }
+        }
+    }
+    p[2] -= f4(y, 0x68b3) ? - 67 >= ~ n : ! 0xb780 ? 0x6dc2 : x;
+    p[3] += f30(st.hi && a2[10], 678);
+    st.hi -= 763;
+    while (x) {
+        switch (x) {
+        case 6:
+            st.hi -= ((long) 430) < g35 - ~ sp->count | x;
+            break;
+        default:
+            a1[12] ^= ((long) sp->count) >> 606;
+        }
+        n--;
+    }
+    for (i = 0; i < 43; i++) {
+        g17 -= 676;
+    }
+    if (a6[4] < a11[5] * 0x4a9f + x) {
+        p[0] |= ! 0x8ad8;
+    } else {
+        p[1] = - 582 < 0x6fb7;
+    }
+    p[2] = ! ((short) ((int) g31));
+    for (i = 0; i < 31; i++) {
+        p[1] |= 0x62a6 ? 334 : 0xd1f0 & (sp->count) == 473 >> 874 * ! n;
+    }
+    return y;
+}
+
+long fn_239(long x, long y, long n, long *p)
+{
+    p[1] ^= sp->count;
+    while (f19(sp->count, x)) {
+        sp->count ^= ((short) - - g5);
+        n--;
+    }
+    if (((unsigned long) y + y)) {
+        for (i = 0; i < 29; i++) {
+            a4[8] |= a8[14];
+        }
+    } else {
+        {
+            st.hi |= 6;
+            st.hi |= f5(f28(x, st.lo), g7 >> a0[11]);
+        }
+    }
+    switch (g30) {
+    case 6:
+        while (f30(st.hi, a0[0])) {
+            sp->count -= (a7[10]) != ((unsigned long) a14[2]) <= n;
+            n--;
+        }
+        break;
+    default:
+        st.hi |= x ? f8(g3, a10[1]) : ((unsigned long) ((long) 761));
+    }
+    if (sp->lo ? 654 : 0x43cd - y ? x : sp->count) {
+        for (i = 0; i < 56; i++) {
+            p[1] -= a10[15];
+        }
+    } else {
+        {
+            n ^= 0xd014 + 787 < 443 + 259 ? a8[7] : ((unsigned long) x);
+            p[3] += p[2];
+        }
+    }
+    while (f5(g25, x)) {
+        while (sp->lo >= g39) {
+            if (75) {
+                switch (n) {
+                case 8:
+                    p[3] |= ((0x56e6 > 0xfbee));
+                    break;
+                default:
+                    st.hi |= ! (f17(a7[11], y));
+                }
+            } else {
+                {
+                    sp->count += a3[10];
+                    y |= p[1];
+                }
+            }
+            n--;
+        }
+        n--;
+    }
+    while (468) {
+        {
+            if (842 & a13[9] && st.lo < a14[3]) {
+                n |= y;
+            } else {
+                p[0] ^= - g48;
+            }
+            st.hi += 0xd4fc;
+        }
+        n--;
+    }
+    for (i = 0; i < 98; i++) {
+        {
+            st.hi -= st.hi;
+            a0[5] ^= st.lo ? (st.hi <= x) : 0x80bd & 807 ^ 876;
+        }
+    }
+    a11[4] = ! ! y - 647 >> ((unsigned long) a9[9]);
+    return ((unsigned long) ((short) st.lo) ^ sp->count ? 784 : a15[13]);
+}
+
+long fn_240(long x, long y, long n, long *p)
+{
+    switch (g15) {
+    case 9:
+        {
+            st.hi -= ~ a8[9] | 289 || f1(y, y);
+            p[0] |= a14[11];
+        }
+        break;
+    default:
+        for (i = 0; i < 82; i++) {
+            if (915) {
+                st.hi |= p[0] == f19(sp->lo, 0xe6de) << a7[0] == st.hi;
+            } else {
+                a9[13] = ! ((long) 479) - a5[10];
+            }
+        }
+    }
+    for (i = 0; i < 47; i++) {
+        st.hi |= ((int) a3[1]) * 208 || sp->count;
+    }
+    if (a11[12] ? n : g18 & ((unsigned long) sp->lo)) {
+        p[3] = sp->count + a15[15] >> ((int) g55) + ((unsigned long) a7[13]);
+    } else {
+        st.hi = (y) & (st.lo) != (0xc31a);
+    }
+    for (i = 0; i < 55; i++) {
+        while (p[2] ? a15[9] : 466) {
+            y ^= (314 < a5[10]) > sp->lo << 0x1eaa <= 0x3cc;
+            n--;
+        }
+    }
+    for (i = 0; i < 5; i++) {
+        a14[15] += st.lo && a11[8] << g52 >> x;
+    }
+    switch (g54) {
+    case 1:
+        while (st.hi == 857) {
+            y += x | (x);
+            n--;
+        }
+        break;
+    default:
+        p[1] = f27(- x, n == x);
+    }
+    if (st.lo - x != ((long) n)) {
+        for (i = 0; i < 87; i++) {
+            for (i = 0; i < 21; i++) {
+                while (n > y) {
+                    a9[14] |= n;
+                    n--;
+                }
+            }
+        }
+    } else {
+        p[1] = f22(661 ? p[2] : g59, 37 - n);
+    }
+    return (st.hi) ? ! 0x1d9b : g40 && y >= (- y);
+}
+
+long fn_241(long x, long y, long n, long *p)
+{
+    if (g23 <= sp->lo < ! 0x3cc) {
+        switch (g14) {
+        case 7:
+            while (n <= a1[0]) {
+                switch (x) {
+                case 7:
+                    sp->count |= y == 14;
+                    break;
+                default:
+                    a8[1] = f0(sp->lo, sp->lo <= y);
+                }
+                n--;
+            }
+            break;
+        default:
+            for (i = 0; i < 89; i++) {
+                for (i = 0; i < 57; i++) {
+                    st.hi |= p[2] != n ? n << g28 : 0x2552 == g32;
+                }
+            }
+        }
+    } else {
+        switch (x) {
+        case 9:
+            for (i = 0; i < 13; i++) {
+                p[3] -= a4[11];
+            }
+            break;
+        default:
+            if (f6(x, sp->count) ^ n ? g2 : st.hi) {
+                for (i = 0; i < 91; i++) {
+                    st.hi ^= 0xfc69;
+                }
+            } else {
+                switch (n) {
+                case 2:
+                    a10[10] = n;
+                    break;
+                default:
+                    st.hi |= 421;
+                }
+            }
+        }
+    }
+    {
+        p[3] -= - 926 > y + ((int) p[0]) ? (a4[15]) : f2(g23, g12);
+        a15[1] -= a1[2];
+    }
+    switch (n) {
+    case 5:
+        while (a11[5]) {
+            a8[7] -= a0[1] && sp->lo && (0xe3d0) ? ~ ~ 244 : (st.hi) && n ? x : 0x17de;
+            n--;
+        }
+        break;
+    default:
+        if (x ? 44 || x : 0xd9dd) {
+            sp->count |= y;
+        } else {
+            g57 |= ! f17(803, n);
+        }
+    }
+    switch (x) {
+    case 4:
+        a6[10] -= st.hi < p[2] || 429 * n ? (~ p[3]) : f1(0xcf28, a5[2]);
+        break;
+    default:
+        for (i = 0; i < 32; i++) {
+            for (i = 0; i < 78; i++) {
+                for (i = 0; i < 38; i++) {
+                    st.hi ^= st.hi;
+                }
+            }
+        }
+    }
+    while (642 ? 834 : a11[5]) {
+        switch (g45) {
+        case 4:
+            st.hi += (0x976e) ? x == g15 + f28(n, 653) : ~ 374 <= ~ x;
+            break;
+        default:
+            p[2] ^= ! (0x3dc6) != p[3] ? x : n ? a8[2] != n : y;
+        }
+        n--;
+    }
+    for (i = 0; i < 29; i++) {
+        while (f23(x, 0xdeeb)) {
+            switch (x) {
+            case 2:
+                n ^= (g16);
+                break;
+            default:
+                p[1] |= f25(x << 0xafa, ((unsigned long) 0x5613));
+            }
+            n--;
+        }
+    }
+    a14[10] -= f2(239, 768 ? n : n);
+    return f4(a6[3], a0[5] != g26);
+}
+
+long fn_242(long x, long y, long n, long *p)
+{
+    while (! sp->count) {
+        {
+            while (a11[9]) {
+                st.hi ^= 949 >> n <= ((short) st.hi) ^ x ? - 664 : a5[9] || a14[13];
+                n--;
+            }
+            st.hi += 325;
+        }
+        n--;
+    }
+    while (sp->lo) {
+        switch (y) {
+        case 3:
+            switch (y) {
+            case 9:
+                while (y) {
+                    p[2] -= x != ((long) p[1]);
+                    n--;
+                }
+                break;
+            default:
+                for (i = 0; i < 95; i++) {
+                    a10[1] |= ((unsigned long) 891) != n << st.hi >> 781;
+                }
+            }
+            break;
+        default:
+            p[1] = ~ x + ((unsigned long) g40);
+        }
+        n--;
+    }
+    if ((((unsigned long) y))) {
+        a5[15] -= (a9[9] == g51) <= a2[3] <= a12[12] && n;
+    } else {
+        {
+            y ^= st.lo;
+            a15[13] |= a4[14] - 901 ? 0x75c9 : 0x4dfd & n;
+        }
+    }
+    while ((0x87c9)) {
+        sp->count ^= 0xa6d3 != g5 ? 0xbf80 : ((unsigned long) 685) != ! a1[11] >= g25 >> 142;
+        n--;
+    }
+    a13[3] |= (103 >= 0x23f2 < 0xe853 ? 801 : a7[0]);
+    switch (y) {
+    case 4:
+        a0[6] ^= f28(sp->lo, x) | - a2[4] << ((int) n) > 0xbd39;
+        break;
+    default:
+        while (n | a13[3]) {
+            for (i = 0; i < 83; i++) {
+                {
+                    st.hi |= (f16(y, a8[13])) || 228;
+                    a0[10] -= f4(989 <= y, 0x863c);
+                }
+            }
+            n--;
+        }
+    }
+    switch (x) {
+    case 1:
+        while (f23(467, g1)) {
+            p[1] += sp->lo && f20(n, 0x8cdc) ? a9[9] : g20;
+            n--;
+        }
+        break;
+    default:
+        switch (n) {
+        case 5:
+            switch (x) {
+            case 9:
+                if (g15) {
+                    st.hi = y == 293 < a5[15] - x != sp->lo < ((long) 862);
+                } else {
+                    a14[4] -= p[0];
+                }
+                break;
+            default:
+                for (i = 0; i < 36; i++) {
+                    sp->count += n;
+                }
+            }
+            break;
+        default:
+            switch (g51) {
+            case 4:
+                while (a1[13]) {
+                    a5[4] = y;
+                    n--;
+                }
+                break;
+            default:
+                y ^= (a2[13] != st.hi - y ? 0x1fa5 : n);
+            }
+        }
+    }
+    return x < 281 ? a1[8] : 730 ? (y >= 0xa713) : ((unsigned long) 270 * 0xd0bd);
+}
+
+long fn_243(long x, long y, long n, long *p)
+{
+    {
+        g43 ^= 908;
+        sp->count |= ((int) g47);
+    }
+    st.hi ^= - 481 + ((long) n) == ~ sp->count | f7(p[1], 493);
+    while (n ? 858 : 0xa188) {
+        sp->count ^= ((unsigned long) (523 <= 0x37c5));
+        n--;
+    }
+    p[3] |= ! a5[11];
+    switch (y) {
+    case 9:
+        y |= ~ a7[1];
+        break;
+    default:
+        a3[14] -= ~ 181 + 953 < n == (((short) 0xafaf));
+    }
+    if ((- a6[10])) {
+        switch (n) {
+        case 1:
+            {
+                a13[9] ^= y ? sp->lo : a2[1] && f10(0xd952, n);
+                sp->count ^= - (x) ? ((int) f20(sp->lo, sp->lo)) : f18(0x5a42, n) << 140 * st.lo;
+            }
+            break;
+        default:
+            while (379 - 0xf757) {
+                a0[1] |= (a13[3] + a9[2] <= n < 0x2b50);
+                n--;
+            }
+        }
+    } else {
+        switch (y) {
+        case 0:
+            p[2] = x;
+            break;
+        default:
+            sp->count ^= y >= ((long) 0xe917);
+        }
+    }
+    {
+        if (g48 | 116 * st.lo) {
+            st.hi = 0x781f == x + - st.hi <= 0x2e90 ? 0xbf7a : g57 >> g15;
+        } else {
+            st.hi -= 596 >= sp->count | sp->lo >= 0xee5a * ((int) a12[3] < 0xf415);
+        }
+        st.hi += sp->lo;
+    }
+    if (! x ? 0xa1ac : sp->count) {
+        {
+            for (i = 0; i < 2; i++) {
+                sp->count += ((unsigned long) y);
+            }
+            sp->count |= 0x96b8 ? y ? 859 : 278 | n : 99 & a15[14] > p[2] + 0x27aa;
+        }
+    } else {
+        {
+            a2[4] = ((g23 + g15));
+            sp->count -= 306 != a6[5] <= y >= 425;
+        }
+    }
+    for (i = 0; i < 45; i++) {
+        st.hi |= y;
+    }
+    return n;
+}
+
+long fn_244(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 85; i++) {
+        switch (x) {
+        case 3:
+            if (g6) {
+                st.hi += ! 0x89f1 && 0x4b74 ? (((unsigned long) a7[6])) : f28(0xe156, a0[6]);
+            } else {
+                a7[6] += ~ 0xbd9d < a3[7] != ~ st.lo != x;
+            }
+            break;
+        default:
+            x -= ((int) x) > 413 && ((short) sp->count) + ((short) x);
+        }
+    }
+    for (i = 0; i < 43; i++) {
+        if (0x3bd8) {
+            sp->count ^= (867);
+        } else {
+            sp->count ^= 0xee80 >> ! ((int) 110);
+        }
+    }
+    for (i = 0; i < 4; i++) {
+        sp->count = ((unsigned long) f7(n, 0x7176)) >= g28 ? a12[0] : sp->lo || 0xae02 >= 668;
+    }
+    p[2] += 105 ^ g60 <= n > ((int) a4[5]);
+    {
+        if (((unsigned long) n) + a7[9]) {
+            {
+                st.hi = (! sp->lo);
+                sp->count |= f23((843), g29 || 442);
+            }
+        } else {
+            sp->count |= - f27(y, a2[5]);
+        }
+        a15[1] -= (sp->count ? a4[10] : 598) - ! 0x34b3 >= g48;
+    }
+    return y;
+}
+
+long fn_245(long x, long y, long n, long *p)
+{
+    {
+        sp->count |= (n);
+        g23 += 369;
+    }
+    for (i = 0; i < 58; i++) {
+        y += n << a5[3] ^ f15(a9[5], sp->count) < 514;
+    }
+    a5[3] = n ? ~ 708 : g28 >> a3[12] + x;
+    for (i = 0; i < 21; i++) {
+        switch (g56) {
+        case 9:
+            for (i = 0; i < 72; i++) {
+                a11[7] -= st.hi ? (a1[6] ? x : 0x718c) : - 182;
+            }
+            break;
+        default:
+            p[2] = f12(g38 > 0x1f96, a2[3]);
+        }
+    }
+    return ((long) 0xeaa9) != - 0x1a59 && (x);
+}
+
+long fn_246(long x, long y, long n, long *p)
+{
+    if ((a6[3] | y)) {
+        switch (x) {
+        case 6:
+            {
+                sp->count += ((short) (g41) ? sp->count : a1[6] <= n);
+                sp->count -= ! (y) ? n : a10[15];
+            }
+            break;
+        default:
+            for (i = 0; i < 8; i++) {
+                {
+                    a10[13] ^= a6[6];
+                    sp->count += y >= p[1] || 0x3d49 | sp->lo <= 0x72c1 >> 517 >= n;
+                }
+            }
+        }
+    } else {
+        switch (g8) {
+        case 2:
+            x -= 307;
+            break;
+        default:
+            y += ((int) a11[13] ? 0x78e1 ^ x : 0xc529 ^ 0xc9a2);
+        }
+    }
+    a7[1] ^= f31(st.lo, 580) || x | ((short) 0xd07c != 0x2be5);
+    switch (n) {
+    case 6:
+        y |= ((long) a11[14]);
+        break;
+    default:
+        st.hi = p[1];
+    }
+    for (i = 0; i < 65; i++) {
+        if (a3[1]) {
+            p[3] += g37;
+        } else {
+            a1[12] ^= 994 && 823 ? x : 0x6627 + g8 >> a1[12] * 0xd6fc & 862;
+        }
+    }
+    {
+        while ((0xdc70)) {
+            st.hi ^= f14(a4[11] == x, ~ 0xfe92);
+            n--;
+        }
+        y -= ((long) (f6(a7[15], 0xec41)));
+    }
+    switch (g51) {
+    case 2:
+        switch (g45) {
+        case 7:
+            {
+                g9 -= f19(y, (y));
+                sp->count ^= f9(274, 877 > g62);
+            }
+            break;
+        default:
+            if ((0x615d) >= ((long) g26)) {
+                a6[9] |= (st.lo | st.hi + 959);
+            } else {
+                a4[4] ^= (y) < st.lo ? 109 : x || ((unsigned long) 0x5f22);
+            }
+        }
+        break;
+    default:
+        if (st.hi * 291 ? st.hi : 409) {
+            g19 |= 0x8946;
+        } else {
+            if (n) {
+                st.hi += 554 ? 0xabf5 : 0x99d2 | 466 ^ ! n & x;
+            } else {
+                g8 -= (sp->lo);
+            }
+        }
+    }
+    switch (y) {
+    case 8:
+        while (((unsigned long) n)) {
+            g36 += st.hi && x ? ((long) a3[7]) : 0xa82e > ((long) (g56));
+            n--;
+        }
+        break;
+    default:
+        if (y - 0x64a9 << a6[3] | y) {
+            a3[8] |= 635 ? x : p[0] ^ ((unsigned long) 175) * f21(x, 0xf67);
+        } else {
+            st.hi -= f26(a13[15], g11);
+        }
+    }
+    a5[3] = ((long) g46);
+    for (i = 0; i < 34; i++) {
+        a0[10] ^= ! - x + a8[13];
+    }
+    while (91) {
+        p[0] ^= ((short) 0x9b84);
+        n--;
+    }
+    return x > sp->lo | 0xdecf ? g56 : 0xad25 ^ y ^ g33 + ~ x;
+}
+
+long fn_247(long x, long y, long n, long *p)
+{
+    g9 -= f11(0x9379, sp->lo) != y;
+    while (sp->count ? a13[13] : 540) {
+        switch (g7) {
+        case 9:
+            {
+                sp->count -= 611;
+                p[0] += x;
+            }
+            break;
+        default:
+            n |= f8(0x1eac, a12[5]);
+        }
+        n--;
+    }
+    while (- sp->lo) {
+        switch (g59) {
+        case 6:
+            if (((int) a14[12]) >= y & 462) {
+                p[0] -= 758 << sp->lo || ~ n > 533;
+            } else {
+                if (a14[4]) {
+                    n = n;
+                } else {
+                    st.hi ^= ! n;
+                }
+            }
+            break;
+        default:
+            x += a12[2] & st.hi || g55 << p[2] || st.hi >= y;
+        }
+        n--;
+    }
+    g25 -= ((int) n) >= a7[6];
+    while (g31) {
+        {
+            for (i = 0; i < 12; i++) {
+                for (i = 0; i < 85; i++) {
+                    sp->count |= y;
+                }
+            }
+            a1[4] -= ((unsigned long) ((short) n)) - (g34 | a5[15]);
+        }
+        n--;
+    }
+    while (0xba0d ? n : 256) {
+        sp->count |= f18(0x3af2 & y, 539 < a11[2]);
+        n--;
+    }
+    switch (x) {
+    case 2:
+        {
+            {
+                st.hi ^= f25(f26(g21, p[2]), 46 && x);
+                a1[6] = 770;
+            }
+            a5[10] ^= (652 && sp->count * f15(0xdbd, a5[10]));
+        }
+        break;
+    default:
+        p[3] = ! ((short) ((long) 390));
+    }
+    return f25((a6[14]), ~ a11[0]);
+}
+
+long fn_248(long x, long y, long n, long *p)
+{
+    for (i = 0; i < 84; i++) {
+        a0[0] += ! p[3] >= 0x94f3 ? x : 0x3252 && 512;
+    }
+    a2[2] |= st.lo;
+    {
+        while (a11[0] ? g8 : g19) {
+            if (sp->count) {
+                a9[12] += (a8[0]) <= 829;
+            } else {
+                y ^= ((long) x && f0(a10[9], n));
+            }
+            n--;
+        }
+        a2[12] += - (f13(n, st.lo));
+    }
+    {
+        p[0] += sp->lo - f18(0xcd32, st.lo) > g43;
+        st.hi -= n;
+    }
+    if (809) {
+        switch (x) {
+        case 9:
+            n ^= (0x904e);
+            break;
+        default:
+            while (((int) y)) {
+                if (((long) a5[6])) {
+                    sp->count ^= ! 762 != a0[2] || 338 << 408 == st.hi ? y : st.hi;
+                } else {
+                    st.hi = - y ? a6[14] : x == f10(a12[8], a2[1]);
+                }
+                n--;
+            }
+        }
+    } else {
+        {
+            {
+                {
+                    p[0] -= (y);
+                    a7[12] += g36 & 804;
+                }
+                a9[0] = ((short) st.lo + sp->count ? (x) : 477 >= sp->count);
+            }
+            sp->count ^= y > 789 - g18 >> (a2[9]) * f20(248, a1[1]);
+        }
+    }
+    n += f26(g3 ? g62 : 0x5738, x - 163);
+    {
+        {
+            a7[11] += n;
+            p[2] -= ! st.hi;
+        }
+        x += ((int) a12[13]) ^ 0x18fa;
+    }
+    {
+        switch (n) {
+        case 8:
+            switch (x) {
+            case 1:
+                x += 177 & st.lo | a5[11] && ((unsigned long) y ? x : 568);
+                break;
+            default:
+                p[3] |= n;
+            }
+            break;
+        default:
+            for (i = 0; i < 76; i++) {
+                n += 638;
+            }
+        }
+        a14[15] |= a15[15] * n < a9[12] ? ((short) x) : f6(272, a3[2]);
+    }
+    sp->count |= y;
+    return sp->lo - 341 == x ? st.lo ? a10[4] : y | 538 : sp->count;
+}
+
+long fn_249(long x, long y, long n, long *p)
+{
+    a2[7] -= ((unsigned long) st.lo > x);
+    a13[6] = ((short) 104 << 0x433e ? 544 | x : g60);
+    {
+        st.hi |= ((unsigned long) a13[14] - 162) ? - n : x;
+        g51 ^= 0xb8c5;
+    }
+    while (366 != x) {
+        if (- a10[3]) {
+            st.hi = f4(y, ((short) 0x6992));
+        } else {
+            while (- a10[13]) {
+                p[2] += (a2[9]);
+                n--;
+            }
+        }
+        n--;
+    }
+    while (a2[9] ? 0x7bb6 : a13[7]) {
+        switch (n) {
+        case 9:
+            x += ((short) ((unsigned long) y) || a3[11] || 285);
+            break;
+        default:
+            st.hi = ((unsigned long) a14[11]);
+        }
+        n--;
+    }
+    switch (x) {
+    case 1:
+        st.hi = f21(st.lo != 801, g31 - a3[8]);
+        break;
+    default:
+        if (! 0xb51e && a8[10]) {
+            while (279 <= x) {
+                p[0] += - x & f5(0xe64e, 0xbccb) >> 908;
+                n--;
+            }
+        } else {
+            st.hi = g8;
+        }
+    }
+    switch (g19) {
+    case 5:
+        p[1] ^= ((long) 648) ? sp->lo ? a1[10] : g29 : 551 + st.lo - f4(37, sp->count);
+        break;
+    default:
+        a1[0] += 0x1bbe | g12 << (st.hi) * (0xfac9) != y;
+    }
+    {
+        p[1] += ((long) f2(n, g20)) << ((short) (a0[6]));
+        y += 603;
+    }
+    while (f19(x, a3[11])) {
+        while (! x) {
+            while (0xf9c2 <= a9[0]) {
+                y ^= - ~ g52 ? 0x105b : 0x6425;
+                n--;
+            }
+            n--;
+        }
+        n--;
+    }
+    return 0x1c82 ^ 353 ? sp->count : a3[0] ^ (x);
+}
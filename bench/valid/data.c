@@ -0,0 +1,120 @@
+long init_0[] = { 8151, 4360, 5965, 3972, 7752, 5407, 1395, 8822, 5199, 3676, 9120, 1396, 2511, 5688, 1613, 5693, 5232, 3643, 3096, 1126, 5389, 9892, 9953, 7026, 1457, 1048, 9894, 5476, 7049, 93, 3722, 5528, 4361, 7117, 1733, 3294, 7253, 4441, 9522, 7536, 2074, 4418, 3428, 8750, 9487, 2012, 6746, 1925, 8909, 8128, 6994, 8479, 8713, 2049, 8182, 9346, 8463, 4923, 1526, 6025, 8466, 2461, 110, 5871, 147, 9617, 6733, 7745, 8823, 3673, 2658, 9386, 1604, 2242, 4196, 6161, 4026, 5504, 548, 8484, 772, 1290, 3884, 4293, 8656, 6900, 7619, 9462, 6852, 6402, 7703, 1458, 6604, 1984, 5939, 845, 314, 1106, 7267, 9283, 144, 5037, 5190, 5681, 8839, 8510, 8156, 1455, 4939, 2620, 7041, 3216, 1839, 1440, 183, 2615, 2165, 821, 2343, 481, 5095, 5824, 259, 2930, 8194, 865, 3948, 9488, 5045, 9651, 435, 2437, 8094, 6621, 7079, 5699, 8844, 2509, 3663, 438, 8560, 9912, 4639, 5494, 6193, 5341, 728, 2381, 8735, 7870, 4662, 2064, 1866, 5158, 6216, 4184, 8430, 8938, 2009, 1629, 9169, 1118, 458, 1744, 4920, 7941, 7628, 4099, 4827, 4068, 4324, 3679, 9396, 3259, 4080, 4883, 4050, 807, 9202, 8161, 3027, 3959, 1882, 4530, 6224, 26, 4619, 9186, 1644, 2576, 7145, 3732, 7952, 6403, 8897, 799, 8599, 5017, 8103, 1926 };
+struct point { int x; int y; } pts_0[] = { { .x = 20, .y = 21 }, { .x = 98, .y = 42 }, { .x = 64, .y = 25 }, { .x = 3, .y = 29 }, { .x = 24, .y = 63 }, { .x = 36, .y = 90 }, { .x = 86, .y = 59 }, { .x = 81, .y = 81 }, { .x = 68, .y = 71 }, { .x = 14, .y = 27 }, { .x = 4, .y = 45 }, { .x = 3, .y = 24 }, { .x = 11, .y = 28 }, { .x = 18, .y = 13 }, { .x = 90, .y = 56 }, { .x = 15, .y = 32 }, { .x = 93, .y = 63 }, { .x = 27, .y = 21 }, { .x = 46, .y = 49 }, { .x = 79, .y = 7 }, { .x = 13, .y = 10 }, { .x = 97, .y = 46 }, { .x = 51, .y = 79 }, { .x = 3, .y = 5 }, { .x = 48, .y = 60 }, { .x = 76, .y = 40 }, { .x = 54, .y = 99 }, { .x = 15, .y = 67 }, { .x = 61, .y = 59 }, { .x = 31, .y = 58 }, { .x = 80, .y = 88 }, { .x = 70, .y = 67 }, { .x = 15, .y = 95 }, { .x = 15, .y = 31 }, { .x = 85, .y = 19 }, { .x = 68, .y = 1 }, { .x = 60, .y = 37 }, { .x = 38, .y = 67 }, { .x = 85, .y = 72 }, { .x = 49, .y = 93 } };
+long init_1[] = { 9167, 9913, 6189, 8655, 2509, 9702, 2247, 619, 8677, 3562, 6452, 6291, 4480, 5530, 6111, 5546, 5093, 5652, 5036, 7769, 2534, 1757, 1155, 8734, 8734, 5489, 8950, 7053, 6687, 7762, 8893, 361, 7010, 3451, 2330, 9409, 5006, 7447, 5436, 516, 5468, 4022, 2602, 4016, 8525, 5786, 32, 6058, 4056, 1593, 8197, 6575, 7013, 5503, 8635, 9841, 5608, 7418, 4630, 7309, 3189, 2939, 9243, 7022, 6418, 7540, 5386, 4562, 6131, 9493, 6990, 897, 6713, 5621, 4007, 1621, 703, 8829, 5713, 7475, 975, 5735, 8863, 7865, 2886, 4477, 6660, 8118, 4317, 3265, 500, 5066, 1431, 5587, 1153, 6038, 6015, 926, 6014, 1178, 217, 7178, 1049, 9591, 4786, 6478, 1902, 2090, 8155, 6859, 2696, 8942, 8523, 2178, 3769, 4646, 276, 783, 4103, 6998, 6957, 8538, 7385, 8793, 3775, 453, 2978, 3673, 4819, 4267, 5825, 5945, 3752, 9653, 7584, 8189, 6364, 3721, 7578, 4578, 6423, 9384, 9561, 5758, 3899, 2963, 8394, 7791, 8581, 8527, 4590, 9765, 9113, 3638, 1538, 2307, 9050, 6069, 8944, 1575, 4590, 1743, 6503, 8569, 6471, 4059, 4723, 2040, 5138, 1968, 5644, 8132, 2666, 2669, 150, 562, 4089, 392, 1407, 8829, 7270, 5369, 9026, 4127, 2760, 98, 8899, 5315, 9986, 5998, 8919, 897, 7962, 7098, 9007, 478, 8466, 81, 4865, 9660 };
+struct point pts_1[] = { { .x = 54, .y = 59 }, { .x = 92, .y = 49 }, { .x = 22, .y = 50 }, { .x = 15, .y = 57 }, { .x = 43, .y = 8 }, { .x = 93, .y = 36 }, { .x = 84, .y = 55 }, { .x = 43, .y = 69 }, { .x = 67, .y = 13 }, { .x = 63, .y = 90 }, { .x = 14, .y = 87 }, { .x = 24, .y = 21 }, { .x = 81, .y = 58 }, { .x = 25, .y = 77 }, { .x = 57, .y = 6 }, { .x = 76, .y = 99 }, { .x = 96, .y = 47 }, { .x = 17, .y = 92 }, { .x = 68, .y = 18 }, { .x = 5, .y = 70 }, { .x = 91, .y = 99 }, { .x = 53, .y = 47 }, { .x = 62, .y = 41 }, { .x = 56, .y = 79 }, { .x = 58, .y = 65 }, { .x = 50, .y = 56 }, { .x = 42, .y = 21 }, { .x = 60, .y = 67 }, { .x = 19, .y = 34 }, { .x = 7, .y = 7 }, { .x = 30, .y = 12 }, { .x = 36, .y = 10 }, { .x = 89, .y = 62 }, { .x = 25, .y = 62 }, { .x = 69, .y = 63 }, { .x = 66, .y = 18 }, { .x = 69, .y = 75 }, { .x = 49, .y = 51 }, { .x = 15, .y = 93 }, { .x = 13, .y = 50 } };
+long init_2[] = { 9464, 9629, 2885, 540, 2825, 6385, 6547, 8734, 5615, 4987, 4984, 9878, 2080, 4422, 8713, 5729, 7516, 7892, 940, 4136, 7546, 8177, 9241, 7324, 1157, 4360, 7948, 9558, 2940, 5598, 3798, 9425, 7309, 2286, 5039, 9894, 8814, 9462, 3805, 8106, 380, 6133, 5419, 3005, 99, 6527, 143, 9392, 1903, 6942, 2842, 9401, 1013, 9461, 9202, 1387, 7098, 7505, 4753, 1413, 6820, 2683, 3999, 7613, 8253, 1755, 8360, 6124, 998, 4715, 8670, 2321, 1942, 80, 1487, 6112, 3332, 5026, 4671, 7731, 5787, 2253, 3757, 8463, 7869, 8313, 9564, 9301, 4026, 9869, 5270, 8773, 2057, 3779, 4598, 1358, 2486, 1587, 4491, 4284, 8335, 5282, 3793, 864, 7165, 9303, 4425, 2727, 9568, 9173, 914, 2473, 7131, 8830, 7149, 3538, 6902, 1316, 8429, 4650, 750, 9458, 459, 6357, 4553, 8567, 564, 32, 798, 1116, 8441, 3405, 2892, 8890, 6346, 612, 6699, 3624, 9082, 6987, 2442, 3739, 3486, 9603, 5900, 2860, 9530, 7012, 6222, 8648, 3421, 973, 1421, 9087, 8422, 2206, 7849, 4110, 8941, 9310, 5132, 8329, 6138, 145, 6184, 6183, 3851, 8696, 635, 3373, 9760, 1216, 8099, 6820, 2538, 3129, 5044, 5132, 876, 5626, 9904, 9955, 6535, 8719, 6702, 7056, 9626, 4212, 6398, 5263, 8805, 7416, 5152, 6224, 6279, 5544, 2901, 2895, 1264, 2706 };
+struct point pts_2[] = { { .x = 54, .y = 40 }, { .x = 78, .y = 92 }, { .x = 59, .y = 34 }, { .x = 56, .y = 50 }, { .x = 66, .y = 57 }, { .x = 98, .y = 8 }, { .x = 9, .y = 93 }, { .x = 25, .y = 52 }, { .x = 10, .y = 12 }, { .x = 69, .y = 42 }, { .x = 67, .y = 47 }, { .x = 51, .y = 62 }, { .x = 13, .y = 74 }, { .x = 56, .y = 21 }, { .x = 74, .y = 74 }, { .x = 51, .y = 58 }, { .x = 54, .y = 6 }, { .x = 11, .y = 70 }, { .x = 15, .y = 18 }, { .x = 99, .y = 54 }, { .x = 57, .y = 11 }, { .x = 65, .y = 43 }, { .x = 16, .y = 18 }, { .x = 53, .y = 54 }, { .x = 58, .y = 9 }, { .x = 75, .y = 94 }, { .x = 20, .y = 91 }, { .x = 20, .y = 55 }, { .x = 87, .y = 58 }, { .x = 2, .y = 45 }, { .x = 28, .y = 55 }, { .x = 53, .y = 28 }, { .x = 61, .y = 35 }, { .x = 67, .y = 26 }, { .x = 31, .y = 89 }, { .x = 95, .y = 90 }, { .x = 11, .y = 91 }, { .x = 58, .y = 82 }, { .x = 42, .y = 46 }, { .x = 60, .y = 58 } };
+long init_3[] = { 6038, 8777, 2172, 8462, 3809, 9998, 9092, 4611, 2472, 936, 6419, 3116, 7086, 7637, 1495, 8108, 9990, 5048, 4669, 5641, 9037, 3699, 341, 2462, 5500, 9629, 6981, 5916, 8831, 1759, 1845, 665, 6892, 7652, 8450, 4251, 973, 2002, 4071, 1136, 9773, 2523, 1695, 9489, 8807, 811, 1598, 5785, 7623, 8736, 41, 2298, 3724, 6129, 3614, 2765, 9078, 3568, 9286, 9009, 4169, 6527, 1547, 8544, 2102, 5006, 8489, 1970, 814, 252, 5256, 9506, 9814, 555, 9159, 1443, 8638, 1403, 8161, 9029, 4710, 9136, 1993, 3147, 7507, 5304, 2559, 2243, 3351, 4938, 1287, 4878, 4831, 5987, 7420, 4117, 8522, 6163, 6046, 4417, 9131, 2604, 4415, 13, 8409, 7845, 2285, 4322, 5656, 666, 1225, 830, 9293, 2715, 8652, 7657, 5281, 2893, 3907, 2976, 3434, 5230, 6385, 6244, 2425, 2679, 9202, 7710, 8183, 6606, 8032, 333, 4667, 8508, 9906, 8553, 5687, 5073, 1766, 2575, 6494, 765, 4597, 2483, 3841, 1414, 1886, 3140, 9152, 9593, 1394, 1161, 9309, 6124, 3108, 6407, 9571, 1701, 8242, 2408, 8412, 2836, 8972, 5839, 916, 6455, 911, 9515, 3602, 9544, 3623, 8114, 8618, 5265, 3179, 2379, 9801, 6739, 4579, 7045, 784, 2141, 8054, 5530, 9026, 7857, 4848, 6858, 9429, 4500, 614, 2414, 4432, 7110, 3516, 5616, 276, 4782, 4898, 2439 };
+struct point pts_3[] = { { .x = 53, .y = 55 }, { .x = 98, .y = 65 }, { .x = 63, .y = 73 }, { .x = 0, .y = 99 }, { .x = 9, .y = 85 }, { .x = 74, .y = 49 }, { .x = 97, .y = 55 }, { .x = 81, .y = 4 }, { .x = 84, .y = 69 }, { .x = 60, .y = 89 }, { .x = 98, .y = 60 }, { .x = 24, .y = 7 }, { .x = 48, .y = 21 }, { .x = 24, .y = 14 }, { .x = 59, .y = 6 }, { .x = 94, .y = 25 }, { .x = 94, .y = 12 }, { .x = 26, .y = 77 }, { .x = 97, .y = 82 }, { .x = 52, .y = 25 }, { .x = 17, .y = 41 }, { .x = 46, .y = 48 }, { .x = 63, .y = 95 }, { .x = 43, .y = 8 }, { .x = 3, .y = 1 }, { .x = 42, .y = 80 }, { .x = 49, .y = 86 }, { .x = 66, .y = 67 }, { .x = 9, .y = 54 }, { .x = 77, .y = 61 }, { .x = 26, .y = 64 }, { .x = 27, .y = 92 }, { .x = 98, .y = 65 }, { .x = 75, .y = 31 }, { .x = 13, .y = 79 }, { .x = 52, .y = 99 }, { .x = 98, .y = 95 }, { .x = 4, .y = 96 }, { .x = 78, .y = 91 }, { .x = 44, .y = 46 } };
+long init_4[] = { 3744, 8927, 6823, 496, 8504, 2699, 9532, 9409, 3428, 8594, 6991, 364, 545, 2022, 236, 2574, 4502, 4748, 4203, 2786, 6983, 5632, 3443, 8769, 1730, 7018, 7204, 6923, 1806, 4675, 311, 5426, 3954, 9358, 8454, 3354, 6679, 9800, 3328, 4697, 4884, 6925, 6828, 5199, 9831, 6508, 7673, 5443, 255, 1618, 7866, 8720, 9437, 370, 7533, 2014, 8639, 6235, 1581, 7605, 8928, 9111, 5782, 8038, 5045, 2125, 1147, 4020, 618, 5042, 5322, 6684, 6865, 1577, 2687, 7957, 2858, 1344, 3145, 4736, 6725, 7811, 9811, 6347, 7051, 4274, 9749, 8536, 6299, 1678, 6458, 8755, 1031, 5938, 5906, 6052, 6510, 5276, 79, 9518, 2426, 1969, 1852, 942, 1713, 1426, 1429, 5317, 6090, 7586, 6466, 1882, 7754, 8268, 2083, 4736, 9845, 403, 6609, 8212, 5127, 7266, 8145, 4887, 3903, 3547, 2148, 2646, 1384, 1520, 6575, 3916, 8815, 8221, 6386, 3390, 5319, 5012, 5279, 5147, 7153, 9407, 8036, 6137, 4685, 1533, 8926, 1915, 4753, 3899, 5386, 1795, 1940, 6243, 9827, 2871, 9054, 9998, 2090, 8880, 155, 6004, 5005, 4870, 1943, 5762, 9274, 2368, 9839, 8084, 2999, 3362, 8582, 1025, 4356, 529, 5468, 1627, 7764, 265, 6944, 8652, 4552, 9075, 2786, 9558, 8763, 5444, 33, 8200, 6935, 5176, 3604, 6201, 4752, 5620, 6903, 7503, 4600, 3049 };
+struct point pts_4[] = { { .x = 62, .y = 10 }, { .x = 13, .y = 61 }, { .x = 45, .y = 63 }, { .x = 85, .y = 84 }, { .x = 34, .y = 17 }, { .x = 97, .y = 91 }, { .x = 22, .y = 71 }, { .x = 12, .y = 7 }, { .x = 22, .y = 96 }, { .x = 22, .y = 2 }, { .x = 9, .y = 60 }, { .x = 32, .y = 42 }, { .x = 46, .y = 41 }, { .x = 22, .y = 9 }, { .x = 56, .y = 95 }, { .x = 96, .y = 90 }, { .x = 8, .y = 3 }, { .x = 29, .y = 77 }, { .x = 72, .y = 10 }, { .x = 9, .y = 97 }, { .x = 30, .y = 10 }, { .x = 11, .y = 62 }, { .x = 33, .y = 14 }, { .x = 71, .y = 76 }, { .x = 36, .y = 81 }, { .x = 81, .y = 32 }, { .x = 66, .y = 83 }, { .x = 59, .y = 64 }, { .x = 75, .y = 23 }, { .x = 94, .y = 58 }, { .x = 39, .y = 78 }, { .x = 0, .y = 24 }, { .x = 82, .y = 68 }, { .x = 72, .y = 59 }, { .x = 24, .y = 21 }, { .x = 92, .y = 38 }, { .x = 93, .y = 38 }, { .x = 63, .y = 50 }, { .x = 26, .y = 87 }, { .x = 89, .y = 42 } };
+long init_5[] = { 6224, 9967, 5736, 4457, 2306, 5557, 2219, 5805, 4615, 2951, 55, 1281, 7779, 6935, 4393, 9636, 6944, 7634, 709, 457, 6386, 7651, 139, 6155, 2185, 653, 1899, 9849, 4790, 3968, 5409, 9194, 8021, 1551, 5225, 2806, 4126, 2191, 4336, 5052, 2824, 304, 9522, 534, 7199, 7711, 8602, 2091, 4643, 8076, 5836, 1688, 3225, 3165, 9475, 4028, 1011, 8410, 2316, 3316, 8390, 4213, 7132, 7443, 368, 2129, 1079, 5049, 6259, 8136, 1036, 7442, 5185, 9134, 9510, 6122, 9023, 7680, 4535, 4832, 8802, 2345, 6370, 2322, 1506, 7276, 4348, 4423, 9313, 8635, 8607, 6335, 8909, 3959, 5039, 29, 6742, 1434, 2284, 3528, 305, 2624, 2307, 7524, 2874, 5132, 5061, 6528, 148, 5608, 5029, 9157, 4407, 8948, 9241, 7289, 8917, 9623, 6468, 6549, 163, 6484, 2212, 1243, 2964, 2996, 8123, 6393, 7889, 5419, 3246, 313, 2613, 5395, 1389, 7742, 9515, 2366, 7327, 5499, 8242, 5566, 1263, 6469, 8288, 8740, 9400, 4551, 3125, 4529, 7126, 7437, 8599, 2797, 7800, 6654, 8408, 1152, 9703, 7793, 3143, 7103, 4613, 5832, 5698, 8242, 3145, 8900, 4800, 5860, 7074, 8208, 6419, 1316, 5826, 8825, 1974, 3216, 2485, 8248, 2605, 5008, 7006, 3803, 7450, 1863, 7352, 2151, 4780, 8677, 4876, 5988, 9688, 2511, 224, 6649, 3268, 3792, 6848, 2013 };
+struct point pts_5[] = { { .x = 71, .y = 4 }, { .x = 68, .y = 75 }, { .x = 42, .y = 25 }, { .x = 59, .y = 77 }, { .x = 60, .y = 78 }, { .x = 39, .y = 96 }, { .x = 17, .y = 44 }, { .x = 41, .y = 81 }, { .x = 44, .y = 93 }, { .x = 65, .y = 29 }, { .x = 80, .y = 32 }, { .x = 14, .y = 7 }, { .x = 99, .y = 95 }, { .x = 50, .y = 72 }, { .x = 23, .y = 99 }, { .x = 66, .y = 98 }, { .x = 86, .y = 78 }, { .x = 13, .y = 76 }, { .x = 42, .y = 32 }, { .x = 24, .y = 15 }, { .x = 10, .y = 19 }, { .x = 88, .y = 11 }, { .x = 94, .y = 94 }, { .x = 80, .y = 83 }, { .x = 73, .y = 26 }, { .x = 9, .y = 76 }, { .x = 83, .y = 74 }, { .x = 4, .y = 62 }, { .x = 35, .y = 31 }, { .x = 38, .y = 36 }, { .x = 69, .y = 88 }, { .x = 35, .y = 15 }, { .x = 98, .y = 54 }, { .x = 97, .y = 9 }, { .x = 93, .y = 37 }, { .x = 53, .y = 45 }, { .x = 78, .y = 67 }, { .x = 46, .y = 26 }, { .x = 78, .y = 78 }, { .x = 64, .y = 35 } };
+long init_6[] = { 1531, 2379, 363, 7867, 2588, 8515, 8600, 4552, 8012, 6988, 9712, 8659, 4604, 3878, 7866, 4543, 6601, 7025, 4341, 2281, 9944, 3628, 7286, 8364, 8471, 9836, 4215, 1747, 3152, 9969, 7268, 9623, 2610, 7795, 7125, 1614, 6046, 3929, 5058, 6377, 428, 7998, 7264, 6277, 4522, 5521, 4118, 1596, 6332, 7244, 1465, 7443, 3437, 5927, 8044, 5959, 6246, 6424, 1003, 9633, 701, 1372, 1450, 9891, 9425, 5716, 8191, 9206, 2058, 5155, 1147, 8692, 5500, 7582, 8668, 226, 9070, 3154, 6665, 4776, 9309, 9691, 7268, 4292, 7243, 3455, 378, 4592, 362, 4815, 1461, 1472, 9730, 5615, 8870, 7231, 6444, 5916, 7886, 4980, 5521, 7927, 3525, 194, 4519, 4533, 4810, 715, 596, 5765, 2669, 9233, 8319, 8100, 9985, 5084, 9908, 3883, 2759, 6107, 2556, 1320, 3916, 627, 1824, 262, 3147, 6750, 2391, 5178, 85, 654, 6151, 741, 1929, 5024, 4443, 4272, 3867, 5970, 7961, 6577, 9806, 2355, 491, 1228, 4312, 2530, 8639, 9116, 2192, 7446, 5899, 4247, 2012, 6959, 6734, 7894, 3851, 6455, 8432, 7543, 8253, 2931, 9704, 7655, 6991, 100, 7494, 4145, 6292, 8989, 9589, 9933, 7102, 5247, 7909, 7725, 2684, 1965, 8733, 5217, 5805, 1329, 3052, 5077, 6109, 700, 5229, 8131, 4844, 3203, 2673, 4715, 3270, 9173, 7918, 1818, 6296, 2215 };
+struct point pts_6[] = { { .x = 41, .y = 49 }, { .x = 44, .y = 38 }, { .x = 91, .y = 13 }, { .x = 45, .y = 58 }, { .x = 15, .y = 6 }, { .x = 37, .y = 33 }, { .x = 1, .y = 13 }, { .x = 2, .y = 15 }, { .x = 51, .y = 24 }, { .x = 67, .y = 35 }, { .x = 89, .y = 11 }, { .x = 16, .y = 17 }, { .x = 53, .y = 60 }, { .x = 76, .y = 66 }, { .x = 80, .y = 62 }, { .x = 93, .y = 70 }, { .x = 39, .y = 43 }, { .x = 42, .y = 73 }, { .x = 40, .y = 0 }, { .x = 73, .y = 76 }, { .x = 38, .y = 56 }, { .x = 22, .y = 74 }, { .x = 39, .y = 81 }, { .x = 86, .y = 60 }, { .x = 95, .y = 8 }, { .x = 22, .y = 89 }, { .x = 45, .y = 13 }, { .x = 79, .y = 30 }, { .x = 90, .y = 79 }, { .x = 25, .y = 52 }, { .x = 1, .y = 75 }, { .x = 5, .y = 64 }, { .x = 87, .y = 51 }, { .x = 85, .y = 48 }, { .x = 84, .y = 51 }, { .x = 19, .y = 19 }, { .x = 22, .y = 15 }, { .x = 28, .y = 80 }, { .x = 60, .y = 28 }, { .x = 32, .y = 45 } };
+long init_7[] = { 1488, 1984, 5732, 3817, 1759, 9430, 4547, 3973, 8014, 368, 3976, 753, 8435, 2233, 6460, 4668, 2875, 8900, 7411, 1223, 6913, 3964, 6032, 4220, 7212, 5621, 4694, 6158, 5019, 8390, 6003, 4926, 4394, 2062, 2380, 1655, 2802, 3640, 1295, 1029, 4484, 1491, 6548, 7424, 1675, 8987, 6528, 5608, 4937, 905, 9224, 3711, 6610, 1537, 1738, 1843, 9537, 3854, 6892, 8613, 2030, 3111, 2958, 8730, 547, 1074, 6964, 2235, 3757, 7106, 4823, 1329, 9484, 3210, 9825, 702, 3718, 2415, 7848, 740, 5231, 2611, 359, 3129, 1089, 3177, 452, 480, 7799, 2026, 4916, 8334, 4323, 7848, 23, 4244, 8107, 4690, 8451, 2818, 7426, 6885, 8150, 8963, 9118, 9808, 8550, 4989, 6850, 2117, 1239, 7133, 3469, 9583, 2823, 5743, 8864, 7995, 7387, 3160, 684, 4782, 9923, 7455, 5816, 5520, 4102, 6821, 3129, 4228, 3515, 5386, 7101, 8529, 3412, 7145, 298, 4237, 4195, 3436, 2113, 5470, 5968, 45, 7160, 472, 8920, 4980, 7861, 4412, 335, 5589, 786, 2330, 6193, 8964, 9808, 8639, 7732, 1067, 7741, 7280, 6132, 7259, 1224, 7809, 3035, 4327, 5360, 1037, 2821, 3274, 8874, 8955, 8818, 4762, 4709, 9917, 6511, 7691, 3118, 1717, 4452, 5444, 3734, 5698, 9244, 3635, 7743, 8793, 7747, 882, 6032, 7250, 1541, 5767, 82, 8613, 1009, 9780 };
+struct point pts_7[] = { { .x = 49, .y = 77 }, { .x = 0, .y = 33 }, { .x = 41, .y = 86 }, { .x = 79, .y = 3 }, { .x = 78, .y = 99 }, { .x = 46, .y = 36 }, { .x = 86, .y = 84 }, { .x = 44, .y = 55 }, { .x = 67, .y = 94 }, { .x = 9, .y = 68 }, { .x = 97, .y = 1 }, { .x = 0, .y = 48 }, { .x = 50, .y = 0 }, { .x = 96, .y = 91 }, { .x = 11, .y = 70 }, { .x = 43, .y = 31 }, { .x = 62, .y = 75 }, { .x = 36, .y = 78 }, { .x = 50, .y = 75 }, { .x = 85, .y = 92 }, { .x = 99, .y = 43 }, { .x = 11, .y = 11 }, { .x = 9, .y = 37 }, { .x = 95, .y = 43 }, { .x = 41, .y = 23 }, { .x = 66, .y = 37 }, { .x = 24, .y = 97 }, { .x = 57, .y = 50 }, { .x = 61, .y = 77 }, { .x = 59, .y = 59 }, { .x = 42, .y = 51 }, { .x = 36, .y = 81 }, { .x = 13, .y = 90 }, { .x = 25, .y = 51 }, { .x = 5, .y = 69 }, { .x = 96, .y = 71 }, { .x = 32, .y = 0 }, { .x = 85, .y = 7 }, { .x = 98, .y = 54 }, { .x = 34, .y = 98 } };
+long init_8[] = { 5090, 8954, 8392, 4249, 4017, 5163, 3433, 98, 631, 6264, 1437, 4099, 6982, 4354, 2927, 5143, 5979, 8999, 1183, 2699, 2764, 5444, 7801, 1771, 2809, 1930, 9533, 9303, 6388, 4895, 208, 5826, 6268, 9761, 3881, 4552, 7757, 4071, 1794, 9589, 5689, 2289, 4769, 9889, 1782, 2375, 1789, 4531, 514, 3063, 1031, 8558, 726, 1656, 6779, 3080, 4294, 4444, 4667, 4514, 4533, 7940, 3944, 1036, 600, 9859, 6479, 3423, 687, 3770, 8193, 1135, 8133, 9164, 2195, 669, 3347, 2469, 8499, 8336, 3311, 9900, 9332, 3246, 4578, 4615, 2951, 3566, 8480, 5466, 358, 5406, 2278, 2195, 3052, 2547, 6899, 9262, 4965, 9462, 736, 5164, 5520, 824, 9298, 7439, 3421, 4303, 1478, 5040, 7538, 3836, 1660, 281, 9355, 6147, 6121, 4008, 1012, 9527, 3376, 9946, 9214, 2283, 3878, 7813, 7268, 2661, 2596, 1574, 3395, 7895, 650, 9856, 3076, 6349, 1502, 3829, 477, 9144, 9232, 3778, 1705, 7340, 2821, 5461, 6143, 4132, 4508, 7880, 8789, 9948, 3369, 7417, 7645, 7757, 5978, 5439, 6710, 7613, 1103, 8192, 6264, 3084, 3566, 1818, 9228, 2138, 1678, 1050, 6609, 4220, 2299, 2881, 4608, 4408, 2563, 2102, 2176, 1452, 7899, 1154, 2527, 4029, 2368, 8204, 4077, 4003, 8588, 8678, 5824, 5286, 9579, 3178, 1268, 8425, 1552, 4286, 9111, 4013 };
+struct point pts_8[] = { { .x = 69, .y = 46 }, { .x = 45, .y = 53 }, { .x = 36, .y = 19 }, { .x = 58, .y = 28 }, { .x = 91, .y = 66 }, { .x = 96, .y = 17 }, { .x = 53, .y = 6 }, { .x = 86, .y = 91 }, { .x = 66, .y = 12 }, { .x = 7, .y = 70 }, { .x = 78, .y = 74 }, { .x = 73, .y = 82 }, { .x = 35, .y = 94 }, { .x = 34, .y = 84 }, { .x = 88, .y = 47 }, { .x = 78, .y = 80 }, { .x = 12, .y = 41 }, { .x = 80, .y = 45 }, { .x = 49, .y = 67 }, { .x = 85, .y = 96 }, { .x = 82, .y = 23 }, { .x = 97, .y = 88 }, { .x = 79, .y = 44 }, { .x = 39, .y = 3 }, { .x = 44, .y = 74 }, { .x = 54, .y = 53 }, { .x = 27, .y = 30 }, { .x = 58, .y = 71 }, { .x = 37, .y = 21 }, { .x = 1, .y = 4 }, { .x = 38, .y = 90 }, { .x = 25, .y = 65 }, { .x = 2, .y = 88 }, { .x = 65, .y = 96 }, { .x = 67, .y = 4 }, { .x = 83, .y = 10 }, { .x = 11, .y = 41 }, { .x = 6, .y = 51 }, { .x = 96, .y = 6 }, { .x = 18, .y = 7 } };
+long init_9[] = { 4520, 9835, 9732, 4806, 6827, 9415, 5791, 4710, 9146, 9845, 7137, 6877, 487, 6787, 93, 4998, 7447, 6435, 8449, 1421, 7684, 2002, 2176, 8698, 9227, 5946, 8584, 6083, 5380, 9245, 1583, 6033, 2800, 663, 8870, 8124, 2019, 506, 9064, 6777, 6226, 917, 7431, 7361, 8119, 6286, 5377, 431, 8057, 6879, 1406, 7185, 6371, 3298, 815, 8557, 8347, 8224, 8212, 104, 9535, 4383, 1451, 2356, 5527, 6470, 3584, 8534, 6450, 1058, 571, 5178, 2423, 3691, 3402, 3076, 5300, 8855, 1085, 2760, 7369, 9320, 434, 3177, 7776, 9571, 6680, 4493, 1855, 271, 5108, 2944, 3800, 6083, 6511, 8980, 2768, 7075, 8185, 8411, 560, 5178, 6623, 9360, 6179, 4299, 7456, 8014, 5147, 7802, 4569, 8985, 9020, 3241, 1375, 9770, 5452, 8803, 726, 757, 6053, 9151, 621, 2254, 4854, 9710, 3197, 7345, 8842, 8242, 6931, 6864, 1846, 939, 7637, 8603, 2103, 4524, 9286, 517, 9557, 2693, 4384, 1936, 5906, 1899, 1288, 488, 4709, 6285, 2218, 5013, 6875, 5322, 3898, 5908, 6488, 3643, 1587, 8331, 8321, 342, 4145, 555, 5897, 9706, 5277, 2131, 1236, 7694, 6064, 3826, 5877, 3519, 2977, 368, 6730, 8673, 9325, 9119, 8511, 401, 3913, 6383, 1404, 7290, 4861, 250, 8291, 7666, 8454, 7805, 417, 405, 3252, 538, 2150, 408, 8354, 2592 };
+struct point pts_9[] = { { .x = 29, .y = 80 }, { .x = 60, .y = 36 }, { .x = 64, .y = 92 }, { .x = 12, .y = 90 }, { .x = 82, .y = 11 }, { .x = 16, .y = 10 }, { .x = 71, .y = 7 }, { .x = 21, .y = 7 }, { .x = 53, .y = 7 }, { .x = 84, .y = 97 }, { .x = 22, .y = 54 }, { .x = 44, .y = 76 }, { .x = 21, .y = 85 }, { .x = 64, .y = 57 }, { .x = 53, .y = 66 }, { .x = 38, .y = 54 }, { .x = 87, .y = 34 }, { .x = 34, .y = 79 }, { .x = 78, .y = 93 }, { .x = 3, .y = 25 }, { .x = 24, .y = 60 }, { .x = 80, .y = 73 }, { .x = 29, .y = 58 }, { .x = 34, .y = 27 }, { .x = 97, .y = 34 }, { .x = 64, .y = 49 }, { .x = 91, .y = 92 }, { .x = 59, .y = 89 }, { .x = 47, .y = 81 }, { .x = 42, .y = 89 }, { .x = 95, .y = 88 }, { .x = 12, .y = 11 }, { .x = 0, .y = 91 }, { .x = 59, .y = 50 }, { .x = 40, .y = 33 }, { .x = 88, .y = 83 }, { .x = 20, .y = 81 }, { .x = 21, .y = 56 }, { .x = 15, .y = 19 }, { .x = 40, .y = 58 } };
+long init_10[] = { 2156, 3184, 9093, 9410, 124, 2154, 4577, 7246, 2089, 2232, 2229, 1319, 1616, 163, 7394, 3025, 7597, 7111, 851, 1127, 1722, 3003, 7500, 8871, 1198, 7977, 5946, 4935, 7936, 1171, 7110, 731, 9375, 4141, 864, 2542, 8927, 9165, 5049, 6495, 6177, 7153, 542, 4378, 574, 9527, 5447, 4794, 5548, 7290, 864, 7269, 1242, 943, 6425, 2684, 8598, 1660, 2442, 9720, 905, 6758, 1216, 4779, 209, 7044, 3372, 2426, 2305, 1331, 7120, 8136, 84, 9988, 6438, 374, 7279, 4074, 4969, 9639, 4206, 9334, 645, 5715, 8654, 3475, 3685, 2640, 7399, 5713, 575, 2872, 9723, 9837, 7367, 8082, 675, 6234, 3443, 7282, 299, 4262, 9200, 7519, 8937, 8490, 7556, 5155, 166, 486, 9432, 7420, 2064, 2184, 9243, 3223, 3296, 3893, 3537, 4656, 6446, 6034, 1797, 4078, 2388, 863, 5845, 2377, 476, 7283, 9945, 1678, 2672, 4741, 5139, 8561, 8954, 3262, 9292, 7941, 8904, 6633, 346, 8523, 3308, 7067, 6424, 2811, 4845, 1662, 1871, 5038, 5628, 9050, 7501, 3557, 3899, 1553, 9400, 9491, 9644, 1726, 3547, 8633, 4653, 7425, 5662, 8277, 7749, 3332, 5800, 5751, 8566, 5657, 5622, 2103, 3496, 9814, 5484, 8415, 4949, 8583, 4519, 4539, 7595, 5166, 1875, 5853, 5094, 9923, 2979, 5592, 5742, 1784, 5850, 9691, 7033, 3661, 2315, 3985 };
+struct point pts_10[] = { { .x = 21, .y = 36 }, { .x = 76, .y = 65 }, { .x = 16, .y = 77 }, { .x = 12, .y = 76 }, { .x = 37, .y = 78 }, { .x = 41, .y = 97 }, { .x = 48, .y = 47 }, { .x = 19, .y = 3 }, { .x = 68, .y = 3 }, { .x = 18, .y = 43 }, { .x = 18, .y = 3 }, { .x = 16, .y = 92 }, { .x = 46, .y = 19 }, { .x = 71, .y = 52 }, { .x = 30, .y = 56 }, { .x = 63, .y = 76 }, { .x = 27, .y = 54 }, { .x = 52, .y = 50 }, { .x = 78, .y = 47 }, { .x = 48, .y = 51 }, { .x = 98, .y = 21 }, { .x = 13, .y = 88 }, { .x = 95, .y = 2 }, { .x = 53, .y = 86 }, { .x = 75, .y = 4 }, { .x = 58, .y = 61 }, { .x = 2, .y = 79 }, { .x = 95, .y = 73 }, { .x = 37, .y = 13 }, { .x = 60, .y = 7 }, { .x = 75, .y = 77 }, { .x = 72, .y = 77 }, { .x = 38, .y = 90 }, { .x = 74, .y = 9 }, { .x = 39, .y = 90 }, { .x = 11, .y = 50 }, { .x = 41, .y = 85 }, { .x = 50, .y = 23 }, { .x = 95, .y = 66 }, { .x = 20, .y = 72 } };
+long init_11[] = { 1448, 6166, 5099, 8688, 4097, 3639, 8796, 4386, 9342, 7333, 2538, 6634, 9140, 8923, 8008, 3414, 8600, 5925, 5943, 2557, 7468, 4172, 9158, 7843, 3391, 9016, 5952, 1947, 9437, 19, 7162, 5959, 5965, 5597, 9005, 8537, 1811, 262, 6398, 3732, 3059, 6219, 7386, 200, 4350, 6427, 2617, 501, 7143, 6712, 2420, 7538, 4714, 6941, 8445, 1845, 4387, 3873, 9259, 1983, 6626, 4226, 2965, 2237, 7298, 3541, 7486, 6032, 5970, 9983, 6499, 3735, 133, 3459, 5111, 6260, 8586, 189, 1265, 9706, 9772, 1801, 3200, 2271, 9023, 353, 7989, 5737, 3879, 3794, 9568, 3717, 3704, 7026, 1343, 7809, 6305, 7625, 3185, 3034, 338, 7685, 2697, 1060, 1990, 2843, 175, 195, 3262, 7154, 4036, 9590, 290, 4262, 7787, 5741, 3724, 4780, 1262, 9376, 2321, 3884, 2692, 6019, 2342, 1942, 8570, 2608, 993, 7082, 3319, 9771, 541, 1211, 31, 1641, 6694, 387, 1766, 1128, 8380, 1489, 8285, 8206, 3590, 9869, 6948, 1497, 9505, 7265, 6217, 2646, 4808, 4991, 3788, 3797, 8633, 9046, 6585, 9011, 1892, 5450, 4942, 4486, 3065, 8884, 5197, 3505, 1183, 6825, 687, 5243, 5193, 430, 2317, 5377, 9998, 991, 7346, 2511, 4491, 357, 7776, 7749, 1598, 5133, 5026, 7301, 9392, 5936, 2229, 8297, 3990, 5550, 9173, 9957, 9517, 6817, 5511, 7286 };
+struct point pts_11[] = { { .x = 50, .y = 64 }, { .x = 82, .y = 5 }, { .x = 84, .y = 87 }, { .x = 5, .y = 36 }, { .x = 59, .y = 67 }, { .x = 15, .y = 14 }, { .x = 63, .y = 96 }, { .x = 66, .y = 8 }, { .x = 34, .y = 3 }, { .x = 69, .y = 67 }, { .x = 54, .y = 45 }, { .x = 55, .y = 62 }, { .x = 22, .y = 69 }, { .x = 43, .y = 66 }, { .x = 44, .y = 26 }, { .x = 35, .y = 20 }, { .x = 5, .y = 84 }, { .x = 7, .y = 89 }, { .x = 68, .y = 38 }, { .x = 40, .y = 89 }, { .x = 62, .y = 63 }, { .x = 79, .y = 88 }, { .x = 15, .y = 42 }, { .x = 61, .y = 51 }, { .x = 8, .y = 25 }, { .x = 90, .y = 4 }, { .x = 57, .y = 14 }, { .x = 9, .y = 38 }, { .x = 0, .y = 57 }, { .x = 29, .y = 99 }, { .x = 32, .y = 5 }, { .x = 38, .y = 58 }, { .x = 76, .y = 82 }, { .x = 39, .y = 97 }, { .x = 12, .y = 98 }, { .x = 59, .y = 96 }, { .x = 42, .y = 73 }, { .x = 34, .y = 74 }, { .x = 7, .y = 70 }, { .x = 61, .y = 88 } };
+long init_12[] = { 8465, 6710, 9241, 5734, 1202, 8350, 5306, 7538, 4811, 6278, 179, 9849, 5704, 4299, 2893, 2551, 2694, 2008, 4712, 9270, 3211, 246, 9175, 7366, 1294, 7058, 6284, 9500, 5659, 8588, 7337, 8335, 188, 3919, 5966, 7299, 1848, 2252, 8985, 5927, 7345, 3544, 6680, 7462, 5899, 9602, 7554, 4339, 1570, 4758, 2462, 1451, 5469, 736, 5758, 1237, 7135, 5887, 828, 2937, 6545, 1665, 9698, 4268, 2434, 2244, 2243, 6448, 2151, 413, 6130, 6804, 5579, 3733, 9585, 2689, 6923, 8204, 9311, 918, 8938, 624, 1407, 4169, 7099, 9624, 1060, 5317, 6601, 9023, 2277, 6334, 7641, 9788, 7602, 1647, 9748, 3230, 9628, 5915, 8481, 9387, 3477, 3298, 4539, 1188, 4854, 3135, 8279, 5132, 2679, 3058, 5452, 992, 2249, 9492, 4408, 448, 3129, 2036, 6334, 272, 5032, 2960, 2666, 9263, 5028, 7656, 8350, 648, 1844, 6933, 7969, 3176, 4669, 1186, 7183, 9191, 84, 4178, 3298, 5070, 342, 6182, 12, 8556, 7913, 9175, 3152, 2091, 8978, 9163, 7794, 7470, 7631, 5624, 7255, 6143, 4099, 3726, 5524, 7998, 4875, 8824, 8872, 3612, 743, 827, 433, 4649, 3912, 6236, 7377, 6108, 585, 6023, 3798, 6813, 1120, 6833, 2972, 2511, 8, 4855, 7413, 8619, 8925, 863, 1116, 3548, 6765, 1998, 4901, 2896, 1693, 3191, 4269, 6000, 3430, 5193 };
+struct point pts_12[] = { { .x = 91, .y = 64 }, { .x = 34, .y = 81 }, { .x = 27, .y = 77 }, { .x = 50, .y = 63 }, { .x = 69, .y = 69 }, { .x = 98, .y = 55 }, { .x = 83, .y = 31 }, { .x = 42, .y = 2 }, { .x = 26, .y = 97 }, { .x = 55, .y = 74 }, { .x = 18, .y = 64 }, { .x = 77, .y = 45 }, { .x = 65, .y = 57 }, { .x = 17, .y = 85 }, { .x = 89, .y = 76 }, { .x = 22, .y = 90 }, { .x = 70, .y = 50 }, { .x = 35, .y = 24 }, { .x = 26, .y = 37 }, { .x = 63, .y = 80 }, { .x = 39, .y = 17 }, { .x = 49, .y = 62 }, { .x = 23, .y = 24 }, { .x = 11, .y = 56 }, { .x = 23, .y = 12 }, { .x = 40, .y = 49 }, { .x = 64, .y = 12 }, { .x = 16, .y = 67 }, { .x = 28, .y = 62 }, { .x = 63, .y = 5 }, { .x = 21, .y = 48 }, { .x = 89, .y = 75 }, { .x = 82, .y = 79 }, { .x = 0, .y = 21 }, { .x = 28, .y = 86 }, { .x = 58, .y = 92 }, { .x = 34, .y = 57 }, { .x = 6, .y = 16 }, { .x = 28, .y = 2 }, { .x = 81, .y = 47 } };
+long init_13[] = { 5709, 9017, 7126, 6636, 418, 1821, 2202, 3427, 3100, 4488, 6648, 2018, 5215, 7815, 2337, 7252, 7879, 9117, 6474, 9292, 9969, 5889, 6419, 6800, 7391, 6729, 2543, 8052, 8763, 2536, 6982, 3244, 1845, 4155, 916, 7260, 4866, 3343, 8515, 258, 5155, 1160, 4198, 2538, 4133, 6384, 9911, 2313, 2560, 5675, 9186, 9110, 7906, 689, 8304, 735, 8692, 5493, 7698, 5174, 4576, 3900, 3129, 2013, 4482, 4110, 3358, 4674, 2023, 3662, 8121, 7072, 2509, 462, 7154, 5336, 4999, 4685, 7746, 9880, 4290, 9494, 162, 1668, 6471, 6906, 3639, 6293, 5301, 6884, 3040, 2548, 1417, 2157, 7356, 671, 3911, 5507, 9076, 5145, 7141, 6514, 4639, 9846, 457, 1508, 4430, 883, 274, 3452, 2023, 7653, 8611, 1896, 686, 3708, 3244, 4323, 6033, 4850, 1713, 2484, 1848, 7682, 8536, 6655, 5463, 5302, 3184, 3919, 7405, 4338, 4323, 555, 5001, 804, 9483, 1854, 1199, 3342, 2742, 119, 6108, 2244, 9988, 4838, 1840, 8578, 8436, 590, 6144, 4406, 1637, 5104, 9805, 8696, 7610, 1891, 2716, 9161, 1671, 764, 8740, 2851, 8928, 8892, 2155, 6076, 2298, 976, 3359, 6789, 289, 1516, 976, 4677, 1005, 8914, 8256, 4740, 4543, 5308, 9466, 296, 1289, 3350, 4120, 3079, 1783, 1393, 7069, 7950, 7257, 1433, 1499, 7779, 2634, 6655, 5864, 5296 };
+struct point pts_13[] = { { .x = 42, .y = 6 }, { .x = 44, .y = 63 }, { .x = 92, .y = 26 }, { .x = 60, .y = 60 }, { .x = 17, .y = 70 }, { .x = 11, .y = 82 }, { .x = 66, .y = 68 }, { .x = 63, .y = 75 }, { .x = 7, .y = 82 }, { .x = 89, .y = 90 }, { .x = 27, .y = 52 }, { .x = 53, .y = 73 }, { .x = 57, .y = 97 }, { .x = 69, .y = 20 }, { .x = 59, .y = 4 }, { .x = 62, .y = 52 }, { .x = 62, .y = 64 }, { .x = 97, .y = 82 }, { .x = 23, .y = 74 }, { .x = 1, .y = 78 }, { .x = 91, .y = 23 }, { .x = 6, .y = 43 }, { .x = 93, .y = 8 }, { .x = 46, .y = 79 }, { .x = 15, .y = 6 }, { .x = 29, .y = 40 }, { .x = 30, .y = 17 }, { .x = 87, .y = 71 }, { .x = 41, .y = 41 }, { .x = 87, .y = 80 }, { .x = 41, .y = 74 }, { .x = 28, .y = 28 }, { .x = 82, .y = 20 }, { .x = 1, .y = 41 }, { .x = 81, .y = 13 }, { .x = 17, .y = 46 }, { .x = 70, .y = 71 }, { .x = 29, .y = 6 }, { .x = 51, .y = 68 }, { .x = 63, .y = 58 } };
+long init_14[] = { 7989, 8658, 9360, 8440, 9379, 4360, 4512, 3199, 4746, 4882, 6026, 9136, 625, 7343, 7627, 2054, 3557, 5977, 7725, 7932, 2366, 8057, 5171, 1607, 260, 6382, 8876, 7955, 5179, 7250, 5239, 350, 5831, 1032, 2561, 1500, 1886, 2115, 1598, 4741, 498, 9620, 9106, 2563, 3284, 4828, 1485, 8958, 775, 9079, 6110, 5668, 3808, 9804, 1366, 7566, 6950, 2811, 903, 872, 5186, 2398, 5325, 36, 2206, 7383, 4812, 2418, 6521, 8899, 2791, 918, 2250, 8283, 4133, 943, 60, 7822, 2954, 3395, 1516, 3968, 4576, 5487, 2670, 2539, 855, 600, 8116, 5245, 8547, 119, 8810, 9179, 2906, 1616, 8312, 640, 8596, 8451, 5902, 3419, 4284, 4045, 1892, 3684, 3068, 6734, 2265, 3080, 615, 1055, 7827, 715, 5396, 2484, 6948, 457, 2340, 5826, 3013, 8900, 646, 8608, 7509, 1523, 4533, 2723, 8742, 5785, 2767, 8080, 4401, 3722, 3828, 9199, 2532, 9062, 6768, 4067, 5967, 9986, 263, 1765, 3639, 8740, 9694, 3458, 3470, 8293, 5029, 3400, 4521, 2890, 7323, 8347, 6922, 2276, 4490, 660, 34, 7325, 3400, 2291, 1735, 7467, 3132, 8381, 5735, 4905, 417, 4196, 9495, 4382, 7301, 6367, 396, 2887, 1578, 1122, 126, 1993, 7654, 4676, 8365, 645, 2363, 7537, 1325, 3260, 4409, 63, 8523, 3350, 651, 6684, 7665, 5411, 3326, 7118 };
+struct point pts_14[] = { { .x = 2, .y = 30 }, { .x = 75, .y = 6 }, { .x = 86, .y = 92 }, { .x = 68, .y = 1 }, { .x = 21, .y = 12 }, { .x = 76, .y = 81 }, { .x = 77, .y = 59 }, { .x = 51, .y = 91 }, { .x = 76, .y = 78 }, { .x = 76, .y = 38 }, { .x = 79, .y = 0 }, { .x = 31, .y = 0 }, { .x = 24, .y = 37 }, { .x = 65, .y = 78 }, { .x = 30, .y = 50 }, { .x = 63, .y = 97 }, { .x = 53, .y = 38 }, { .x = 26, .y = 90 }, { .x = 33, .y = 17 }, { .x = 69, .y = 67 }, { .x = 3, .y = 49 }, { .x = 67, .y = 59 }, { .x = 98, .y = 61 }, { .x = 27, .y = 81 }, { .x = 44, .y = 6 }, { .x = 95, .y = 0 }, { .x = 98, .y = 12 }, { .x = 22, .y = 32 }, { .x = 28, .y = 48 }, { .x = 46, .y = 71 }, { .x = 58, .y = 67 }, { .x = 49, .y = 68 }, { .x = 61, .y = 65 }, { .x = 4, .y = 27 }, { .x = 77, .y = 37 }, { .x = 78, .y = 73 }, { .x = 20, .y = 98 }, { .x = 85, .y = 40 }, { .x = 92, .y = 81 }, { .x = 46, .y = 47 } };
+long init_15[] = { 4205, 2400, 9148, 8882, 8485, 2498, 5925, 3911, 3782, 5353, 8468, 6019, 1070, 3088, 713, 6310, 6834, 9264, 8361, 9905, 770, 712, 4792, 2408, 6889, 9380, 2800, 1022, 4311, 8108, 5890, 9123, 7108, 9951, 3954, 9652, 918, 2697, 993, 4452, 1147, 5645, 8705, 5097, 269, 1147, 9415, 9183, 7124, 6021, 8505, 690, 5726, 155, 5738, 6401, 9128, 3635, 6385, 5168, 8626, 3825, 7902, 3799, 5018, 6647, 4713, 4607, 6668, 2694, 2923, 7871, 3287, 1926, 1929, 3636, 2639, 9237, 3452, 1081, 285, 8499, 585, 5148, 3890, 6939, 9343, 6054, 6154, 2855, 5299, 4826, 2715, 3612, 9455, 2308, 9031, 4239, 1599, 9798, 8780, 6997, 5680, 3250, 2318, 1938, 1549, 140, 7526, 4735, 5392, 4749, 8632, 3809, 4709, 3521, 1218, 4110, 7274, 9240, 1155, 260, 4799, 4470, 6413, 8352, 1351, 9097, 172, 9062, 3676, 4927, 2714, 5278, 7460, 6592, 195, 2038, 4853, 9377, 7443, 9438, 6861, 481, 4518, 5093, 7627, 2402, 6185, 3102, 6317, 7713, 1006, 3326, 557, 6268, 9325, 9794, 6704, 9961, 5665, 6503, 6566, 1098, 612, 9796, 5233, 1979, 1543, 9067, 1411, 479, 9642, 2765, 3257, 6301, 6138, 9484, 315, 6535, 7168, 4705, 2487, 8908, 4901, 8158, 4061, 142, 5636, 6000, 1788, 5704, 7181, 6218, 8058, 734, 9796, 3814, 2178, 636 };
+struct point pts_15[] = { { .x = 73, .y = 56 }, { .x = 61, .y = 42 }, { .x = 8, .y = 29 }, { .x = 71, .y = 57 }, { .x = 1, .y = 88 }, { .x = 24, .y = 37 }, { .x = 29, .y = 17 }, { .x = 60, .y = 41 }, { .x = 92, .y = 54 }, { .x = 73, .y = 93 }, { .x = 31, .y = 63 }, { .x = 37, .y = 37 }, { .x = 77, .y = 38 }, { .x = 51, .y = 95 }, { .x = 83, .y = 40 }, { .x = 37, .y = 25 }, { .x = 73, .y = 20 }, { .x = 13, .y = 4 }, { .x = 71, .y = 28 }, { .x = 83, .y = 57 }, { .x = 40, .y = 30 }, { .x = 57, .y = 1 }, { .x = 55, .y = 27 }, { .x = 7, .y = 50 }, { .x = 84, .y = 77 }, { .x = 29, .y = 76 }, { .x = 5, .y = 8 }, { .x = 10, .y = 47 }, { .x = 0, .y = 43 }, { .x = 22, .y = 64 }, { .x = 36, .y = 8 }, { .x = 26, .y = 44 }, { .x = 37, .y = 14 }, { .x = 76, .y = 80 }, { .x = 12, .y = 5 }, { .x = 25, .y = 67 }, { .x = 48, .y = 92 }, { .x = 78, .y = 71 }, { .x = 10, .y = 18 }, { .x = 94, .y = 6 } };
+long init_16[] = { 4644, 7094, 1400, 6388, 9246, 1154, 2655, 1333, 9255, 9349, 179, 7989, 2189, 6019, 5737, 4000, 2984, 512, 401, 7458, 4733, 308, 9451, 5184, 2959, 2150, 4243, 1101, 3041, 9390, 4641, 9421, 8083, 117, 1347, 7260, 7820, 9435, 8691, 8484, 8713, 678, 5443, 5814, 7947, 7807, 3483, 3081, 1691, 8468, 1052, 2177, 290, 6596, 1996, 4737, 1257, 3053, 4422, 2387, 8906, 1424, 1445, 4166, 9743, 6087, 3013, 9375, 9707, 5180, 1594, 6917, 6519, 5372, 9774, 3280, 5953, 688, 5847, 7854, 9433, 5530, 9310, 8581, 8338, 6087, 6416, 9314, 4460, 6966, 774, 1849, 1083, 2555, 2354, 1442, 5653, 9134, 7239, 4417, 1003, 4009, 302, 3434, 9235, 8978, 4608, 5172, 4840, 2036, 6754, 1102, 8178, 9717, 8568, 3778, 1219, 1853, 1479, 4780, 6874, 5389, 3528, 4319, 4455, 108, 4926, 7989, 6783, 4318, 2882, 3697, 5383, 1996, 8595, 819, 8750, 8164, 7226, 3148, 5496, 3708, 7956, 2385, 8957, 3836, 5757, 3981, 1067, 9271, 4761, 5114, 5254, 6772, 2035, 4415, 8515, 8125, 7635, 2290, 7673, 107, 5179, 770, 6933, 1763, 7299, 9915, 2793, 6707, 345, 6203, 7609, 8330, 766, 1328, 2128, 1698, 6563, 7179, 5469, 9159, 4363, 3392, 8074, 6439, 7692, 1134, 7988, 8426, 7720, 2216, 2299, 2826, 2362, 1524, 2362, 5684, 3262, 8766 };
+struct point pts_16[] = { { .x = 92, .y = 12 }, { .x = 46, .y = 58 }, { .x = 4, .y = 97 }, { .x = 91, .y = 99 }, { .x = 63, .y = 83 }, { .x = 87, .y = 48 }, { .x = 41, .y = 19 }, { .x = 6, .y = 79 }, { .x = 30, .y = 85 }, { .x = 0, .y = 73 }, { .x = 66, .y = 58 }, { .x = 57, .y = 37 }, { .x = 59, .y = 93 }, { .x = 49, .y = 93 }, { .x = 83, .y = 59 }, { .x = 2, .y = 18 }, { .x = 65, .y = 82 }, { .x = 21, .y = 11 }, { .x = 90, .y = 50 }, { .x = 72, .y = 25 }, { .x = 88, .y = 43 }, { .x = 89, .y = 25 }, { .x = 37, .y = 96 }, { .x = 16, .y = 57 }, { .x = 95, .y = 52 }, { .x = 13, .y = 1 }, { .x = 76, .y = 56 }, { .x = 80, .y = 56 }, { .x = 96, .y = 27 }, { .x = 26, .y = 90 }, { .x = 2, .y = 95 }, { .x = 34, .y = 99 }, { .x = 16, .y = 70 }, { .x = 15, .y = 84 }, { .x = 12, .y = 1 }, { .x = 29, .y = 84 }, { .x = 2, .y = 53 }, { .x = 46, .y = 37 }, { .x = 82, .y = 63 }, { .x = 17, .y = 54 } };
+long init_17[] = { 4768, 360, 3587, 3886, 4616, 7985, 7171, 9347, 5766, 1247, 1456, 3424, 3562, 9361, 5315, 8154, 6877, 6646, 4725, 8316, 4656, 9475, 4358, 8295, 6694, 8440, 5720, 6616, 1659, 4845, 2223, 575, 1875, 9279, 8522, 8430, 2441, 2601, 8261, 3111, 5525, 901, 2282, 8065, 9272, 2624, 5645, 5027, 914, 8140, 5441, 8172, 2349, 9889, 7132, 4252, 7570, 6802, 2756, 7085, 5785, 4653, 892, 9654, 8037, 4194, 2305, 8484, 9053, 1723, 5058, 3725, 5350, 3750, 5760, 9559, 6297, 6277, 2424, 489, 222, 2815, 1954, 3659, 6926, 6957, 363, 9431, 1051, 8002, 3878, 4275, 7930, 2123, 9180, 8306, 5526, 2650, 8725, 4487, 4667, 2445, 833, 8601, 3476, 2, 6148, 3845, 913, 8653, 4247, 6669, 2192, 3975, 4921, 6250, 7584, 6029, 9871, 4650, 2030, 6909, 6835, 4993, 8601, 8669, 6526, 6297, 9293, 6003, 235, 9917, 2682, 7747, 2191, 6165, 9879, 107, 8343, 8952, 483, 3356, 2502, 1121, 3923, 7245, 9799, 6437, 653, 2644, 6751, 1405, 3506, 1927, 869, 9393, 6769, 5373, 82, 2606, 2546, 9908, 9937, 9891, 2323, 1910, 2413, 5981, 2589, 4051, 3794, 6143, 9087, 2606, 3002, 9131, 5041, 682, 6833, 4247, 1561, 2700, 1522, 47, 3481, 6063, 2948, 3073, 6227, 7430, 2932, 1247, 6106, 6724, 9342, 8978, 1999, 377, 1347, 3813 };
+struct point pts_17[] = { { .x = 48, .y = 75 }, { .x = 55, .y = 51 }, { .x = 34, .y = 88 }, { .x = 95, .y = 63 }, { .x = 16, .y = 81 }, { .x = 93, .y = 54 }, { .x = 49, .y = 31 }, { .x = 3, .y = 80 }, { .x = 42, .y = 54 }, { .x = 98, .y = 53 }, { .x = 55, .y = 0 }, { .x = 7, .y = 86 }, { .x = 17, .y = 29 }, { .x = 13, .y = 45 }, { .x = 27, .y = 84 }, { .x = 81, .y = 74 }, { .x = 25, .y = 77 }, { .x = 29, .y = 74 }, { .x = 34, .y = 92 }, { .x = 47, .y = 0 }, { .x = 9, .y = 88 }, { .x = 13, .y = 93 }, { .x = 14, .y = 32 }, { .x = 62, .y = 37 }, { .x = 17, .y = 5 }, { .x = 28, .y = 18 }, { .x = 46, .y = 51 }, { .x = 37, .y = 2 }, { .x = 2, .y = 54 }, { .x = 29, .y = 3 }, { .x = 20, .y = 51 }, { .x = 20, .y = 17 }, { .x = 12, .y = 79 }, { .x = 48, .y = 50 }, { .x = 34, .y = 9 }, { .x = 41, .y = 27 }, { .x = 42, .y = 17 }, { .x = 93, .y = 60 }, { .x = 57, .y = 95 }, { .x = 30, .y = 83 } };
+long init_18[] = { 93, 9358, 9877, 1425, 1538, 4805, 2719, 2196, 2048, 4580, 6548, 7670, 2684, 9615, 8161, 542, 3157, 5618, 826, 1263, 9280, 3996, 1065, 6861, 5459, 6333, 3992, 7539, 9980, 9078, 8296, 693, 8404, 2905, 287, 9160, 7565, 7988, 2922, 3085, 8942, 9047, 2534, 1841, 1848, 8193, 6236, 9797, 839, 8209, 3524, 8233, 3904, 1033, 1420, 2317, 9606, 2271, 3381, 4312, 5861, 7858, 3278, 7205, 1073, 6138, 1166, 5849, 1636, 2966, 3830, 2125, 427, 2576, 5960, 1241, 6173, 803, 3371, 6195, 8150, 6392, 7597, 9939, 6168, 5345, 3258, 8155, 2463, 1912, 2421, 5207, 8308, 3366, 3078, 7395, 9259, 1949, 3456, 1491, 6990, 3234, 2891, 3906, 3916, 1074, 7048, 672, 4224, 1838, 3804, 1769, 1669, 6491, 4129, 662, 3894, 8769, 5168, 7955, 443, 7355, 5247, 5982, 3971, 337, 205, 642, 8312, 6050, 3483, 7217, 1876, 7096, 8921, 343, 3673, 6642, 8109, 73, 1636, 9609, 146, 2877, 8293, 8219, 2556, 2313, 6683, 9118, 9164, 3404, 2095, 9900, 747, 9886, 9195, 9770, 5975, 2963, 1381, 7091, 9005, 7134, 4217, 5016, 1169, 2306, 5948, 4346, 4113, 1570, 8679, 1640, 527, 3654, 9474, 8403, 4161, 4300, 8759, 108, 9134, 4435, 7933, 9972, 470, 4245, 2874, 465, 6535, 853, 820, 2553, 9034, 6362, 8106, 2719, 2624, 4655 };
+struct point pts_18[] = { { .x = 43, .y = 7 }, { .x = 46, .y = 92 }, { .x = 54, .y = 83 }, { .x = 2, .y = 51 }, { .x = 95, .y = 34 }, { .x = 46, .y = 76 }, { .x = 72, .y = 81 }, { .x = 82, .y = 17 }, { .x = 12, .y = 78 }, { .x = 45, .y = 39 }, { .x = 98, .y = 96 }, { .x = 65, .y = 55 }, { .x = 33, .y = 38 }, { .x = 99, .y = 47 }, { .x = 93, .y = 81 }, { .x = 57, .y = 41 }, { .x = 69, .y = 31 }, { .x = 65, .y = 16 }, { .x = 12, .y = 86 }, { .x = 61, .y = 35 }, { .x = 69, .y = 20 }, { .x = 20, .y = 2 }, { .x = 6, .y = 58 }, { .x = 72, .y = 41 }, { .x = 99, .y = 24 }, { .x = 67, .y = 28 }, { .x = 68, .y = 99 }, { .x = 99, .y = 97 }, { .x = 68, .y = 17 }, { .x = 17, .y = 37 }, { .x = 54, .y = 74 }, { .x = 45, .y = 96 }, { .x = 33, .y = 7 }, { .x = 72, .y = 30 }, { .x = 28, .y = 34 }, { .x = 22, .y = 11 }, { .x = 2, .y = 5 }, { .x = 66, .y = 16 }, { .x = 5, .y = 9 }, { .x = 42, .y = 12 } };
+long init_19[] = { 3961, 6703, 2612, 1041, 2218, 8038, 8728, 1161, 218, 3813, 253, 1042, 2913, 8407, 1384, 8461, 7963, 6442, 8890, 3264, 6621, 7250, 5161, 3386, 8621, 2922, 1146, 6728, 7690, 2593, 6495, 1408, 3253, 6674, 2097, 4486, 4564, 9963, 1083, 8273, 593, 6407, 2674, 7098, 1525, 6629, 8634, 7148, 3377, 4482, 4466, 6949, 3706, 2212, 7800, 9627, 9853, 2541, 7744, 2565, 9049, 2578, 6426, 1433, 9838, 1195, 6799, 6374, 7729, 9422, 9200, 4614, 4948, 2770, 6850, 5246, 5784, 2628, 6318, 5695, 1820, 3964, 7509, 4427, 1128, 8753, 1293, 4353, 5750, 8983, 9481, 9711, 773, 6681, 3125, 4, 3023, 7299, 9519, 9360, 997, 8313, 701, 7243, 2338, 377, 46, 6397, 8454, 647, 8350, 496, 4778, 2797, 6225, 1568, 59, 2031, 1651, 2287, 1192, 4176, 3238, 6446, 5011, 386, 102, 2589, 6997, 8583, 9473, 1385, 4207, 5159, 8431, 2445, 4976, 2911, 1315, 389, 8968, 1499, 9927, 3050, 2103, 8097, 9310, 7972, 515, 7468, 9139, 159, 9889, 1770, 8413, 2857, 3505, 7685, 3242, 8554, 5096, 35, 7505, 3937, 629, 8390, 78, 3187, 2819, 4116, 9670, 4423, 6816, 8838, 7447, 885, 9736, 5625, 1149, 2998, 1345, 7034, 6378, 2720, 7230, 7345, 4706, 3928, 2500, 3315, 9530, 536, 6546, 9883, 5278, 6022, 5492, 2249, 2299, 9706 };
+struct point pts_19[] = { { .x = 39, .y = 81 }, { .x = 76, .y = 42 }, { .x = 7, .y = 25 }, { .x = 75, .y = 99 }, { .x = 58, .y = 37 }, { .x = 10, .y = 10 }, { .x = 91, .y = 53 }, { .x = 77, .y = 9 }, { .x = 94, .y = 85 }, { .x = 87, .y = 8 }, { .x = 87, .y = 65 }, { .x = 28, .y = 79 }, { .x = 94, .y = 94 }, { .x = 17, .y = 39 }, { .x = 8, .y = 64 }, { .x = 20, .y = 37 }, { .x = 74, .y = 6 }, { .x = 49, .y = 96 }, { .x = 74, .y = 81 }, { .x = 47, .y = 90 }, { .x = 30, .y = 44 }, { .x = 32, .y = 20 }, { .x = 26, .y = 11 }, { .x = 48, .y = 37 }, { .x = 55, .y = 75 }, { .x = 53, .y = 89 }, { .x = 64, .y = 12 }, { .x = 82, .y = 29 }, { .x = 49, .y = 65 }, { .x = 88, .y = 87 }, { .x = 37, .y = 52 }, { .x = 6, .y = 98 }, { .x = 68, .y = 99 }, { .x = 25, .y = 72 }, { .x = 41, .y = 97 }, { .x = 69, .y = 92 }, { .x = 18, .y = 8 }, { .x = 8, .y = 87 }, { .x = 73, .y = 11 }, { .x = 0, .y = 35 } };
+long init_20[] = { 8063, 3022, 7629, 5814, 5611, 6460, 7938, 8062, 3918, 530, 7858, 9863, 7365, 5993, 9818, 6340, 5258, 6367, 6169, 9970, 7415, 8139, 8035, 3125, 6710, 3345, 7183, 8190, 6067, 4811, 8908, 6441, 8796, 9793, 1894, 6868, 4057, 1333, 2085, 1325, 587, 6059, 2830, 945, 7265, 9227, 7792, 9399, 909, 7643, 1182, 9077, 7211, 1352, 3527, 3088, 4835, 3706, 7280, 2836, 2884, 4217, 2454, 9913, 4971, 7160, 8752, 5836, 1358, 1143, 9956, 6521, 1127, 9706, 5797, 5696, 1651, 438, 467, 5408, 9830, 6617, 8195, 641, 5054, 2198, 6923, 8708, 537, 2079, 8777, 2875, 2325, 9400, 8857, 2578, 6573, 9832, 3109, 3557, 1147, 1018, 4892, 9582, 7387, 5926, 34, 3514, 1436, 7113, 7864, 2242, 3185, 8732, 2911, 4550, 7119, 4178, 3326, 4657, 5556, 7565, 7777, 8712, 3643, 2123, 8110, 9823, 6119, 1101, 1558, 6488, 4175, 2737, 4190, 8055, 9071, 9624, 1009, 6260, 5664, 3731, 2436, 2789, 9539, 5789, 2572, 8809, 4464, 6444, 3507, 1247, 4328, 8883, 4816, 8804, 5612, 5779, 221, 363, 1471, 3902, 6066, 1121, 1739, 2733, 1989, 1824, 8841, 9257, 6675, 991, 7357, 4914, 3316, 3254, 1063, 4786, 3176, 6271, 8310, 1858, 1393, 8995, 5038, 4247, 152, 860, 4708, 8291, 8771, 6923, 5251, 5970, 8500, 8846, 6745, 9808, 5760, 9431 };
+struct point pts_20[] = { { .x = 40, .y = 55 }, { .x = 96, .y = 16 }, { .x = 21, .y = 19 }, { .x = 45, .y = 61 }, { .x = 7, .y = 62 }, { .x = 58, .y = 91 }, { .x = 20, .y = 37 }, { .x = 40, .y = 68 }, { .x = 56, .y = 95 }, { .x = 90, .y = 57 }, { .x = 58, .y = 67 }, { .x = 61, .y = 33 }, { .x = 43, .y = 34 }, { .x = 93, .y = 97 }, { .x = 81, .y = 30 }, { .x = 12, .y = 79 }, { .x = 80, .y = 78 }, { .x = 95, .y = 20 }, { .x = 79, .y = 21 }, { .x = 60, .y = 87 }, { .x = 53, .y = 91 }, { .x = 2, .y = 66 }, { .x = 55, .y = 29 }, { .x = 27, .y = 29 }, { .x = 53, .y = 3 }, { .x = 19, .y = 82 }, { .x = 63, .y = 21 }, { .x = 38, .y = 15 }, { .x = 10, .y = 13 }, { .x = 81, .y = 90 }, { .x = 10, .y = 10 }, { .x = 56, .y = 50 }, { .x = 12, .y = 84 }, { .x = 34, .y = 5 }, { .x = 1, .y = 60 }, { .x = 60, .y = 21 }, { .x = 73, .y = 48 }, { .x = 63, .y = 78 }, { .x = 3, .y = 55 }, { .x = 79, .y = 25 } };
+long init_21[] = { 5835, 3024, 2467, 7959, 1092, 9423, 8883, 6255, 7804, 2129, 8682, 1874, 2959, 8071, 251, 7800, 805, 8350, 7607, 551, 9074, 1675, 8823, 4042, 5635, 4444, 1047, 5442, 3112, 7937, 9347, 7886, 3756, 4132, 5067, 2042, 9411, 7945, 4378, 9185, 2624, 4327, 2485, 1536, 9312, 7369, 9928, 8247, 7398, 7359, 300, 7435, 9755, 9840, 1675, 1216, 4419, 2993, 5630, 2340, 53, 3553, 8214, 4379, 3696, 5511, 3601, 2720, 8212, 1384, 7662, 8836, 309, 8257, 7257, 4711, 8723, 6998, 8012, 6384, 1555, 5465, 7476, 3621, 6327, 3447, 4001, 5889, 7656, 8648, 346, 4780, 9721, 8017, 2489, 9257, 3116, 5156, 8134, 2962, 1977, 4609, 5002, 7026, 8342, 983, 4853, 1553, 4689, 9269, 4496, 9567, 4194, 9826, 7306, 9872, 8690, 3652, 379, 4751, 8220, 1378, 8245, 6033, 2600, 8341, 466, 5074, 224, 2146, 6762, 9156, 3801, 4729, 4997, 488, 658, 5101, 9059, 1556, 6144, 4783, 103, 5206, 1322, 5391, 6071, 5843, 2291, 1004, 5314, 9514, 316, 2616, 5928, 8717, 97, 9171, 8711, 6630, 340, 5540, 7492, 3972, 2037, 8743, 303, 1138, 6978, 7089, 8373, 2964, 7399, 1820, 9625, 3238, 5967, 3974, 1062, 6643, 612, 2446, 3264, 6958, 2632, 6979, 4811, 2906, 9826, 4349, 2657, 7921, 100, 4529, 9519, 514, 4363, 5890, 2219, 7901 };
+struct point pts_21[] = { { .x = 58, .y = 17 }, { .x = 54, .y = 41 }, { .x = 74, .y = 87 }, { .x = 4, .y = 33 }, { .x = 23, .y = 48 }, { .x = 78, .y = 52 }, { .x = 11, .y = 95 }, { .x = 90, .y = 22 }, { .x = 85, .y = 1 }, { .x = 45, .y = 83 }, { .x = 95, .y = 5 }, { .x = 33, .y = 46 }, { .x = 0, .y = 7 }, { .x = 59, .y = 4 }, { .x = 97, .y = 72 }, { .x = 65, .y = 98 }, { .x = 40, .y = 58 }, { .x = 70, .y = 92 }, { .x = 54, .y = 47 }, { .x = 37, .y = 87 }, { .x = 33, .y = 29 }, { .x = 98, .y = 98 }, { .x = 32, .y = 33 }, { .x = 21, .y = 50 }, { .x = 4, .y = 14 }, { .x = 36, .y = 33 }, { .x = 13, .y = 35 }, { .x = 13, .y = 41 }, { .x = 83, .y = 30 }, { .x = 70, .y = 59 }, { .x = 98, .y = 34 }, { .x = 5, .y = 35 }, { .x = 3, .y = 99 }, { .x = 74, .y = 69 }, { .x = 11, .y = 24 }, { .x = 41, .y = 5 }, { .x = 2, .y = 12 }, { .x = 96, .y = 1 }, { .x = 68, .y = 44 }, { .x = 32, .y = 46 } };
+long init_22[] = { 5734, 6274, 5365, 9352, 9113, 4522, 4244, 739, 7853, 2107, 4685, 4055, 1103, 5291, 7802, 981, 6650, 3538, 9042, 4761, 370, 2302, 3171, 8106, 9598, 1437, 4600, 2069, 4296, 107, 6178, 632, 1809, 7321, 1918, 8999, 3688, 1629, 6801, 2506, 5529, 9628, 2320, 5354, 7547, 6401, 6262, 6546, 8306, 3364, 3395, 222, 8052, 6169, 1974, 7190, 9530, 4693, 6085, 3133, 9858, 3871, 1419, 1953, 4191, 1662, 6879, 4454, 5665, 5770, 8838, 788, 1055, 2264, 4540, 3586, 7105, 7142, 1966, 8173, 5492, 4657, 818, 6403, 4469, 3934, 8944, 8230, 7995, 1566, 9282, 9876, 249, 7459, 7567, 3349, 5081, 9684, 9945, 3237, 6488, 5847, 5890, 9182, 1417, 3778, 7157, 2894, 3241, 3457, 1579, 6014, 3969, 7117, 1818, 4817, 7639, 6517, 4203, 4020, 9745, 5099, 3972, 2599, 3488, 2291, 3612, 8018, 1046, 6924, 4351, 2056, 6699, 2577, 4341, 2079, 1517, 7147, 6396, 4269, 5240, 8178, 3831, 8854, 4329, 1002, 4912, 4824, 3776, 4993, 8234, 9561, 1867, 9254, 1857, 1212, 4783, 8424, 1740, 9044, 3294, 4230, 1218, 8079, 4022, 8765, 3907, 8120, 1150, 6265, 3200, 8967, 5930, 2352, 2224, 1464, 3864, 3939, 9358, 9632, 987, 5731, 3730, 8907, 1021, 6436, 8453, 325, 8789, 5488, 6593, 6307, 1859, 2106, 8207, 3707, 3274, 2329, 757, 1569 };
+struct point pts_22[] = { { .x = 47, .y = 88 }, { .x = 98, .y = 49 }, { .x = 60, .y = 50 }, { .x = 27, .y = 0 }, { .x = 15, .y = 97 }, { .x = 52, .y = 79 }, { .x = 18, .y = 44 }, { .x = 14, .y = 0 }, { .x = 23, .y = 79 }, { .x = 26, .y = 5 }, { .x = 14, .y = 29 }, { .x = 14, .y = 79 }, { .x = 53, .y = 21 }, { .x = 53, .y = 99 }, { .x = 97, .y = 21 }, { .x = 97, .y = 69 }, { .x = 94, .y = 6 }, { .x = 16, .y = 73 }, { .x = 83, .y = 1 }, { .x = 53, .y = 83 }, { .x = 26, .y = 21 }, { .x = 97, .y = 31 }, { .x = 34, .y = 87 }, { .x = 69, .y = 67 }, { .x = 24, .y = 33 }, { .x = 97, .y = 10 }, { .x = 26, .y = 75 }, { .x = 26, .y = 80 }, { .x = 12, .y = 93 }, { .x = 11, .y = 78 }, { .x = 15, .y = 90 }, { .x = 15, .y = 82 }, { .x = 25, .y = 45 }, { .x = 71, .y = 49 }, { .x = 25, .y = 92 }, { .x = 86, .y = 85 }, { .x = 67, .y = 9 }, { .x = 18, .y = 36 }, { .x = 27, .y = 32 }, { .x = 12, .y = 7 } };
+long init_23[] = { 9308, 9127, 4136, 7859, 5818, 1466, 3420, 7553, 9904, 6298, 5331, 8497, 9265, 3591, 3568, 4368, 1944, 6229, 4868, 792, 7051, 4863, 2268, 9309, 1309, 6796, 4254, 1415, 1540, 2305, 8327, 6153, 6118, 3999, 4763, 5985, 5274, 6158, 43, 1219, 4390, 7055, 7480, 4631, 9099, 6875, 5191, 7839, 1988, 4012, 1125, 2420, 3743, 132, 4529, 2688, 7452, 4246, 8254, 4428, 2682, 9877, 423, 3607, 1778, 4899, 937, 8646, 4678, 8568, 4420, 2033, 3265, 8886, 247, 2479, 3763, 9872, 2358, 5839, 8329, 3059, 7098, 4605, 2639, 3999, 1828, 1851, 5574, 6870, 4592, 8865, 1049, 6207, 7881, 9755, 4353, 7706, 2762, 8380, 3656, 1486, 8739, 9287, 2595, 166, 9960, 6209, 9482, 4448, 4056, 5363, 3934, 2413, 7247, 3017, 7758, 4672, 331, 7194, 7711, 2536, 3111, 5812, 7408, 7896, 3134, 962, 7443, 1428, 8180, 7734, 9692, 207, 6414, 4710, 8810, 7424, 3692, 3952, 9500, 3221, 4760, 4542, 3089, 1550, 7682, 1654, 2049, 4870, 3209, 7627, 4183, 4170, 4533, 3960, 5082, 3428, 1958, 5069, 7684, 584, 6121, 9282, 4629, 715, 707, 6710, 9434, 2947, 2002, 8064, 8367, 4954, 6592, 4313, 5805, 9514, 5966, 1678, 1494, 7332, 6156, 2734, 6224, 7802, 3887, 8879, 4324, 3912, 3789, 5673, 2144, 6432, 2224, 4357, 659, 5755, 5784, 466 };
+struct point pts_23[] = { { .x = 27, .y = 14 }, { .x = 11, .y = 55 }, { .x = 59, .y = 51 }, { .x = 94, .y = 35 }, { .x = 17, .y = 97 }, { .x = 30, .y = 73 }, { .x = 15, .y = 47 }, { .x = 74, .y = 45 }, { .x = 34, .y = 67 }, { .x = 54, .y = 38 }, { .x = 34, .y = 4 }, { .x = 99, .y = 37 }, { .x = 17, .y = 71 }, { .x = 12, .y = 90 }, { .x = 43, .y = 86 }, { .x = 86, .y = 79 }, { .x = 69, .y = 20 }, { .x = 45, .y = 70 }, { .x = 11, .y = 69 }, { .x = 87, .y = 11 }, { .x = 33, .y = 35 }, { .x = 1, .y = 24 }, { .x = 41, .y = 11 }, { .x = 30, .y = 9 }, { .x = 56, .y = 85 }, { .x = 47, .y = 76 }, { .x = 90, .y = 53 }, { .x = 15, .y = 65 }, { .x = 35, .y = 85 }, { .x = 75, .y = 9 }, { .x = 23, .y = 34 }, { .x = 70, .y = 85 }, { .x = 15, .y = 88 }, { .x = 4, .y = 7 }, { .x = 32, .y = 83 }, { .x = 49, .y = 73 }, { .x = 93, .y = 6 }, { .x = 79, .y = 94 }, { .x = 91, .y = 56 }, { .x = 77, .y = 7 } };
+long init_24[] = { 5845, 6583, 6152, 827, 3462, 8733, 3423, 2707, 1724, 6380, 2120, 9952, 6134, 2759, 6810, 8210, 4194, 8995, 1461, 9284, 151, 2566, 5649, 4847, 494, 5614, 8926, 1485, 1454, 9189, 6031, 8143, 5302, 8437, 366, 5050, 8874, 6146, 3805, 3361, 1120, 1345, 8528, 7262, 7269, 6675, 3667, 3358, 4511, 187, 2126, 1852, 2643, 7805, 1230, 9884, 8356, 6258, 1214, 3304, 478, 9606, 4645, 6941, 3930, 9644, 1227, 7709, 7118, 8016, 8187, 5809, 3354, 1979, 4506, 5615, 3704, 5742, 7529, 5847, 8792, 9286, 3758, 6937, 4403, 9864, 6679, 8327, 5777, 5516, 1950, 8521, 3003, 2664, 597, 5618, 8959, 2307, 2344, 5329, 6801, 4369, 335, 6053, 3554, 2340, 2698, 7323, 3575, 4305, 3310, 6170, 4049, 8791, 5919, 4224, 9901, 4112, 9719, 3067, 5895, 9290, 9758, 6625, 4881, 2882, 8064, 5907, 7463, 2000, 374, 4070, 7234, 1121, 5994, 199, 6316, 5494, 4889, 8278, 1376, 5720, 316, 7193, 9748, 648, 1707, 3661, 5378, 5078, 8463, 4858, 3041, 3300, 204, 6446, 1914, 9197, 3847, 3296, 3689, 3166, 2390, 6549, 4461, 2209, 8226, 3870, 3812, 828, 8183, 8497, 2229, 7945, 2429, 2259, 2313, 1216, 7706, 1085, 7022, 7922, 194, 1692, 1635, 2349, 995, 6679, 6360, 9783, 2079, 4153, 683, 5702, 9378, 7656, 2605, 6114, 5001, 5266 };
+struct point pts_24[] = { { .x = 99, .y = 80 }, { .x = 73, .y = 86 }, { .x = 21, .y = 66 }, { .x = 91, .y = 12 }, { .x = 72, .y = 49 }, { .x = 86, .y = 33 }, { .x = 55, .y = 70 }, { .x = 53, .y = 4 }, { .x = 24, .y = 24 }, { .x = 15, .y = 98 }, { .x = 95, .y = 49 }, { .x = 17, .y = 54 }, { .x = 43, .y = 4 }, { .x = 9, .y = 9 }, { .x = 81, .y = 49 }, { .x = 11, .y = 65 }, { .x = 0, .y = 41 }, { .x = 67, .y = 98 }, { .x = 26, .y = 27 }, { .x = 83, .y = 53 }, { .x = 96, .y = 80 }, { .x = 35, .y = 79 }, { .x = 49, .y = 23 }, { .x = 75, .y = 2 }, { .x = 82, .y = 54 }, { .x = 2, .y = 41 }, { .x = 46, .y = 87 }, { .x = 11, .y = 95 }, { .x = 90, .y = 44 }, { .x = 80, .y = 99 }, { .x = 71, .y = 47 }, { .x = 84, .y = 36 }, { .x = 22, .y = 13 }, { .x = 25, .y = 22 }, { .x = 7, .y = 86 }, { .x = 73, .y = 52 }, { .x = 69, .y = 56 }, { .x = 66, .y = 86 }, { .x = 12, .y = 80 }, { .x = 46, .y = 43 } };
+long init_25[] = { 5285, 246, 6742, 4960, 1586, 7561, 6961, 8076, 6669, 6954, 7887, 6085, 1438, 6228, 5606, 5235, 5228, 6050, 3857, 9895, 6970, 8623, 7971, 6315, 7421, 9626, 6605, 759, 9420, 1445, 3352, 5070, 939, 625, 2253, 9402, 7065, 1283, 9520, 5922, 6059, 5001, 3650, 2122, 9097, 286, 8098, 89, 5706, 7805, 7780, 8977, 7245, 1830, 7217, 7686, 3613, 9585, 2626, 7421, 2511, 7791, 3416, 3202, 6992, 3357, 5950, 1555, 7259, 6925, 549, 6197, 9364, 5206, 1292, 5036, 3246, 6243, 1543, 7161, 6270, 5178, 5353, 7446, 9783, 396, 8172, 2335, 5221, 4537, 3119, 9489, 4284, 7615, 9528, 6110, 1853, 9155, 6355, 5308, 1984, 9182, 3456, 3591, 9728, 85, 671, 702, 3378, 8056, 6826, 3075, 2539, 1769, 7542, 763, 5368, 4616, 9108, 4094, 2901, 6642, 9847, 2451, 4688, 7396, 1536, 1155, 9793, 7432, 8112, 4330, 9649, 5700, 3950, 2645, 6126, 885, 875, 1789, 5902, 17, 4778, 2408, 5629, 3947, 4243, 1544, 2375, 6745, 8376, 9835, 5505, 7546, 9925, 4208, 724, 3137, 2995, 6839, 220, 1953, 2192, 3389, 6582, 2648, 3669, 9463, 6536, 413, 9114, 1216, 8330, 9159, 9317, 6471, 2678, 6162, 9453, 4765, 5612, 693, 6331, 5242, 6637, 4345, 4453, 5522, 1335, 6718, 2836, 5072, 1132, 3437, 752, 1462, 513, 8731, 3717, 2094 };
+struct point pts_25[] = { { .x = 39, .y = 31 }, { .x = 33, .y = 40 }, { .x = 61, .y = 30 }, { .x = 72, .y = 35 }, { .x = 5, .y = 75 }, { .x = 34, .y = 77 }, { .x = 18, .y = 80 }, { .x = 80, .y = 13 }, { .x = 46, .y = 41 }, { .x = 78, .y = 56 }, { .x = 81, .y = 15 }, { .x = 18, .y = 66 }, { .x = 49, .y = 53 }, { .x = 50, .y = 79 }, { .x = 16, .y = 54 }, { .x = 8, .y = 36 }, { .x = 1, .y = 26 }, { .x = 28, .y = 11 }, { .x = 75, .y = 45 }, { .x = 22, .y = 76 }, { .x = 66, .y = 94 }, { .x = 19, .y = 82 }, { .x = 55, .y = 94 }, { .x = 64, .y = 0 }, { .x = 74, .y = 40 }, { .x = 61, .y = 12 }, { .x = 74, .y = 59 }, { .x = 32, .y = 69 }, { .x = 34, .y = 47 }, { .x = 41, .y = 50 }, { .x = 52, .y = 79 }, { .x = 63, .y = 8 }, { .x = 40, .y = 46 }, { .x = 94, .y = 63 }, { .x = 46, .y = 65 }, { .x = 30, .y = 76 }, { .x = 85, .y = 83 }, { .x = 57, .y = 32 }, { .x = 54, .y = 68 }, { .x = 7, .y = 86 } };
+long init_26[] = { 4324, 2439, 7700, 1347, 5188, 4416, 4841, 6026, 684, 7975, 3243, 5932, 2424, 3938, 3406, 9763, 946, 6497, 6005, 5722, 9142, 3526, 2612, 9872, 1729, 1752, 498, 3074, 9154, 4414, 4458, 3220, 2373, 6629, 1725, 7924, 2147, 6891, 6725, 2668, 6877, 8155, 4340, 2826, 9888, 7863, 1806, 291, 8491, 2992, 4961, 4222, 3894, 4252, 282, 1112, 6696, 8681, 1063, 4325, 9295, 3266, 9120, 2768, 751, 8465, 9730, 7452, 4624, 2365, 6283, 4845, 2521, 5054, 3712, 519, 6101, 7922, 1989, 2132, 3608, 6405, 7982, 5887, 7263, 1500, 5025, 6874, 8428, 8812, 5293, 2094, 5733, 3825, 4520, 7447, 9553, 5198, 9241, 2966, 1112, 9372, 8818, 328, 4516, 5433, 1613, 3399, 414, 7032, 9994, 4034, 979, 2629, 9551, 8487, 5965, 6716, 9427, 786, 4298, 6766, 5893, 3224, 4923, 2450, 1808, 7115, 3660, 735, 5158, 4101, 7939, 4178, 6444, 8825, 3010, 3991, 1565, 4754, 7074, 9529, 1763, 3351, 4661, 9165, 3210, 2338, 4248, 9202, 7642, 772, 1220, 613, 8353, 362, 4437, 6328, 2216, 2935, 1502, 3338, 9820, 5881, 9962, 5326, 9398, 2699, 9693, 4352, 8121, 9434, 8418, 954, 2610, 9544, 7245, 5617, 3495, 3853, 5391, 4805, 7886, 4865, 1101, 9972, 8012, 1572, 8214, 6667, 8396, 5059, 9473, 9292, 5033, 3719, 4813, 9260, 8450, 8973 };
+struct point pts_26[] = { { .x = 94, .y = 27 }, { .x = 6, .y = 13 }, { .x = 54, .y = 62 }, { .x = 36, .y = 72 }, { .x = 11, .y = 72 }, { .x = 46, .y = 13 }, { .x = 41, .y = 61 }, { .x = 12, .y = 17 }, { .x = 95, .y = 45 }, { .x = 7, .y = 27 }, { .x = 75, .y = 33 }, { .x = 89, .y = 93 }, { .x = 99, .y = 29 }, { .x = 17, .y = 4 }, { .x = 27, .y = 35 }, { .x = 10, .y = 10 }, { .x = 6, .y = 98 }, { .x = 11, .y = 61 }, { .x = 49, .y = 43 }, { .x = 62, .y = 44 }, { .x = 75, .y = 87 }, { .x = 39, .y = 23 }, { .x = 98, .y = 80 }, { .x = 71, .y = 41 }, { .x = 61, .y = 93 }, { .x = 90, .y = 67 }, { .x = 25, .y = 51 }, { .x = 48, .y = 45 }, { .x = 29, .y = 61 }, { .x = 85, .y = 63 }, { .x = 81, .y = 31 }, { .x = 8, .y = 77 }, { .x = 41, .y = 73 }, { .x = 66, .y = 3 }, { .x = 78, .y = 23 }, { .x = 83, .y = 26 }, { .x = 56, .y = 33 }, { .x = 99, .y = 38 }, { .x = 15, .y = 57 }, { .x = 73, .y = 62 } };
+long init_27[] = { 4476, 6772, 5259, 217, 448, 3069, 5859, 6881, 586, 5413, 4868, 2016, 5942, 9933, 5786, 6774, 7423, 1465, 5155, 9520, 6643, 7204, 8004, 6755, 1490, 8643, 6757, 6180, 676, 771, 7154, 1599, 9584, 8654, 1517, 3172, 3636, 3039, 7871, 6828, 5594, 7495, 4912, 3812, 961, 6685, 8034, 970, 1770, 1662, 1917, 8642, 673, 7519, 7577, 872, 5989, 4897, 5622, 8009, 9411, 7056, 8874, 6994, 3244, 1790, 9989, 2991, 1736, 8814, 4075, 5367, 3429, 7014, 2453, 9443, 3166, 7620, 4799, 4288, 1773, 4415, 3797, 6008, 472, 1767, 6521, 5201, 8241, 30, 7754, 3447, 563, 2919, 7443, 3223, 1003, 4094, 7661, 6991, 5751, 6238, 321, 1153, 8945, 9057, 1194, 3886, 6764, 9090, 40, 8513, 393, 8512, 3353, 4050, 390, 4745, 5877, 957, 3550, 4045, 7122, 8734, 2827, 1292, 1571, 2623, 2389, 3883, 2531, 1061, 1026, 1133, 4249, 593, 7770, 6365, 984, 2962, 7674, 1355, 5570, 3087, 1013, 635, 5216, 9484, 2767, 6966, 9921, 6048, 6230, 5429, 3559, 1192, 9306, 8302, 9845, 9710, 6259, 8145, 7427, 2103, 6345, 9320, 9580, 5251, 43, 9113, 1708, 239, 3430, 7513, 8037, 3467, 1984, 8108, 4180, 5925, 1799, 7231, 6669, 5785, 9636, 490, 76, 5613, 5266, 1563, 9865, 8036, 7312, 637, 9860, 4170, 6815, 8035, 3644, 2177 };
+struct point pts_27[] = { { .x = 55, .y = 97 }, { .x = 67, .y = 8 }, { .x = 22, .y = 7 }, { .x = 55, .y = 0 }, { .x = 98, .y = 84 }, { .x = 98, .y = 5 }, { .x = 9, .y = 33 }, { .x = 15, .y = 70 }, { .x = 73, .y = 33 }, { .x = 90, .y = 88 }, { .x = 3, .y = 12 }, { .x = 56, .y = 47 }, { .x = 90, .y = 82 }, { .x = 39, .y = 72 }, { .x = 26, .y = 76 }, { .x = 75, .y = 22 }, { .x = 13, .y = 27 }, { .x = 45, .y = 55 }, { .x = 85, .y = 29 }, { .x = 28, .y = 81 }, { .x = 63, .y = 44 }, { .x = 15, .y = 6 }, { .x = 69, .y = 38 }, { .x = 71, .y = 39 }, { .x = 57, .y = 30 }, { .x = 86, .y = 93 }, { .x = 75, .y = 51 }, { .x = 84, .y = 95 }, { .x = 99, .y = 52 }, { .x = 37, .y = 84 }, { .x = 83, .y = 40 }, { .x = 87, .y = 54 }, { .x = 68, .y = 25 }, { .x = 93, .y = 74 }, { .x = 80, .y = 54 }, { .x = 38, .y = 25 }, { .x = 61, .y = 64 }, { .x = 60, .y = 6 }, { .x = 72, .y = 64 }, { .x = 45, .y = 49 } };
+long init_28[] = { 6752, 2198, 2236, 165, 4437, 4236, 5574, 2617, 3567, 9039, 4935, 5722, 4832, 7086, 2447, 6071, 6520, 7202, 7520, 4254, 5788, 6696, 5327, 4887, 8171, 5712, 8868, 5236, 1685, 776, 4674, 5156, 6717, 6112, 5225, 2973, 2319, 9681, 4892, 3381, 9530, 3820, 4046, 8136, 2223, 7081, 9727, 7879, 1128, 806, 340, 2177, 5024, 1140, 4669, 3845, 8699, 2696, 8481, 2066, 7360, 9954, 9133, 9817, 8853, 821, 6113, 8154, 3535, 9519, 4529, 2691, 5410, 6043, 6418, 3500, 9015, 36, 4090, 1790, 4693, 5607, 3332, 4785, 708, 4443, 2053, 9373, 3137, 1472, 5968, 8064, 5258, 4787, 4441, 5467, 7071, 9017, 6542, 1460, 5080, 7659, 4679, 5565, 4064, 4265, 16, 8816, 509, 9664, 2142, 2146, 9077, 5302, 4284, 5350, 8732, 2139, 8468, 2313, 9959, 4409, 5119, 834, 5305, 5884, 5900, 1162, 500, 6737, 9626, 7694, 6809, 9586, 8242, 1896, 9638, 4423, 707, 517, 1343, 3226, 7616, 897, 1097, 8191, 6229, 86, 2191, 614, 6160, 3877, 5587, 2191, 5406, 2242, 4497, 6754, 5648, 9388, 1688, 6991, 2353, 7121, 5271, 326, 1592, 6926, 9209, 1624, 7903, 7567, 4342, 3217, 3370, 2059, 3458, 9508, 7858, 8190, 2990, 5742, 9912, 5496, 1689, 2034, 6199, 3182, 6619, 1197, 5803, 2015, 919, 5464, 8591, 8132, 9432, 7670, 2756, 2564 };
+struct point pts_28[] = { { .x = 48, .y = 56 }, { .x = 75, .y = 7 }, { .x = 71, .y = 3 }, { .x = 74, .y = 36 }, { .x = 25, .y = 32 }, { .x = 36, .y = 61 }, { .x = 13, .y = 90 }, { .x = 84, .y = 27 }, { .x = 79, .y = 94 }, { .x = 27, .y = 15 }, { .x = 74, .y = 37 }, { .x = 6, .y = 15 }, { .x = 55, .y = 9 }, { .x = 97, .y = 77 }, { .x = 2, .y = 39 }, { .x = 17, .y = 53 }, { .x = 97, .y = 33 }, { .x = 81, .y = 44 }, { .x = 35, .y = 71 }, { .x = 12, .y = 68 }, { .x = 8, .y = 88 }, { .x = 17, .y = 37 }, { .x = 47, .y = 16 }, { .x = 36, .y = 83 }, { .x = 49, .y = 15 }, { .x = 37, .y = 33 }, { .x = 99, .y = 46 }, { .x = 97, .y = 94 }, { .x = 70, .y = 93 }, { .x = 73, .y = 38 }, { .x = 85, .y = 83 }, { .x = 58, .y = 49 }, { .x = 29, .y = 96 }, { .x = 55, .y = 9 }, { .x = 92, .y = 34 }, { .x = 9, .y = 84 }, { .x = 14, .y = 5 }, { .x = 8, .y = 93 }, { .x = 3, .y = 49 }, { .x = 10, .y = 61 } };
+long init_29[] = { 319, 2484, 5608, 1357, 4816, 10, 7505, 8839, 610, 9121, 9854, 9541, 8334, 8038, 9360, 8550, 648, 7083, 8334, 1023, 7088, 7888, 3993, 3214, 1755, 2831, 2708, 4524, 7166, 9062, 8057, 1791, 3075, 2118, 411, 592, 8169, 373, 8459, 7104, 4473, 1439, 8254, 8432, 7566, 4630, 8694, 8227, 3883, 8504, 7805, 3337, 5456, 2456, 7091, 3245, 5693, 8736, 2009, 6745, 9690, 745, 5246, 8627, 2115, 7770, 1043, 3912, 6180, 1342, 5356, 5173, 4252, 307, 1634, 6961, 6373, 4487, 4143, 8437, 5393, 3297, 8160, 5717, 6749, 5495, 7694, 4629, 1103, 7391, 7018, 1498, 7988, 2497, 4523, 181, 5699, 8158, 2578, 7136, 5359, 8912, 2986, 6301, 8885, 405, 3222, 7380, 1494, 1662, 4202, 3864, 934, 5673, 1060, 7582, 411, 2336, 1316, 2729, 497, 3907, 8420, 3624, 1318, 5620, 6638, 300, 7077, 9430, 2092, 6147, 474, 9648, 809, 3768, 2325, 9081, 300, 3465, 6094, 5438, 689, 3791, 3, 8374, 217, 5184, 518, 1120, 5230, 7213, 488, 5542, 7812, 8192, 8463, 1243, 6615, 1381, 6652, 4613, 5133, 8289, 415, 706, 6337, 7544, 2136, 9298, 622, 845, 530, 2911, 7231, 8749, 778, 8103, 3499, 9808, 2188, 7153, 2031, 4530, 190, 6654, 5261, 6278, 7339, 216, 416, 6376, 9830, 1997, 3864, 9743, 1607, 5406, 6449, 7928 };
+struct point pts_29[] = { { .x = 43, .y = 18 }, { .x = 62, .y = 2 }, { .x = 4, .y = 53 }, { .x = 40, .y = 48 }, { .x = 58, .y = 75 }, { .x = 30, .y = 57 }, { .x = 2, .y = 69 }, { .x = 25, .y = 16 }, { .x = 33, .y = 87 }, { .x = 76, .y = 42 }, { .x = 24, .y = 20 }, { .x = 98, .y = 20 }, { .x = 36, .y = 49 }, { .x = 96, .y = 58 }, { .x = 64, .y = 2 }, { .x = 58, .y = 32 }, { .x = 46, .y = 27 }, { .x = 78, .y = 47 }, { .x = 28, .y = 77 }, { .x = 78, .y = 16 }, { .x = 99, .y = 60 }, { .x = 45, .y = 79 }, { .x = 69, .y = 63 }, { .x = 26, .y = 7 }, { .x = 66, .y = 68 }, { .x = 3, .y = 53 }, { .x = 71, .y = 89 }, { .x = 11, .y = 52 }, { .x = 52, .y = 11 }, { .x = 93, .y = 71 }, { .x = 93, .y = 52 }, { .x = 69, .y = 16 }, { .x = 47, .y = 23 }, { .x = 62, .y = 70 }, { .x = 39, .y = 59 }, { .x = 12, .y = 13 }, { .x = 66, .y = 35 }, { .x = 23, .y = 69 }, { .x = 93, .y = 54 }, { .x = 45, .y = 61 } };
+long init_30[] = { 4962, 7611, 393, 1324, 8241, 2410, 7265, 72, 5654, 8989, 3133, 9090, 7288, 229, 9430, 2213, 9826, 9408, 2876, 1860, 4005, 7757, 2593, 8296, 3041, 5131, 3888, 4530, 1657, 6160, 9071, 7094, 3355, 4364, 9554, 5534, 3369, 4052, 986, 3570, 1667, 1612, 1108, 4221, 2377, 7879, 4416, 2479, 3912, 3394, 9552, 41, 451, 278, 550, 7840, 3117, 8358, 3653, 143, 2038, 2223, 1333, 9868, 233, 8841, 2118, 6114, 9759, 6078, 2396, 1570, 8785, 3194, 1088, 2338, 6745, 74, 7752, 9473, 2164, 7230, 3779, 3236, 8398, 219, 621, 2159, 5059, 7763, 6668, 8580, 3120, 9758, 113, 5208, 2524, 2998, 4944, 3258, 8244, 684, 9181, 281, 9481, 6796, 8947, 6725, 3896, 1922, 6813, 1769, 2569, 2650, 9734, 2968, 1542, 977, 2675, 4528, 1335, 330, 2545, 9200, 6317, 7370, 7884, 5165, 781, 2926, 3356, 2692, 2080, 9157, 7214, 3399, 2222, 9006, 5484, 9246, 6074, 3195, 6957, 1658, 7558, 4404, 1330, 1063, 4391, 5900, 1752, 6435, 1959, 1684, 8867, 4970, 7704, 1420, 6742, 3299, 2236, 8807, 5354, 455, 8876, 6071, 1758, 4453, 1398, 7258, 7994, 7485, 8884, 6993, 5501, 4892, 7722, 4559, 1077, 2587, 8869, 6603, 4056, 748, 6153, 8017, 3510, 6780, 658, 4739, 4470, 4906, 2989, 4187, 5715, 5939, 2316, 3867, 9058, 5405 };
+struct point pts_30[] = { { .x = 91, .y = 97 }, { .x = 91, .y = 53 }, { .x = 42, .y = 19 }, { .x = 75, .y = 62 }, { .x = 41, .y = 3 }, { .x = 75, .y = 4 }, { .x = 87, .y = 91 }, { .x = 50, .y = 83 }, { .x = 56, .y = 37 }, { .x = 10, .y = 67 }, { .x = 23, .y = 6 }, { .x = 45, .y = 99 }, { .x = 73, .y = 83 }, { .x = 78, .y = 54 }, { .x = 15, .y = 95 }, { .x = 40, .y = 42 }, { .x = 39, .y = 49 }, { .x = 5, .y = 96 }, { .x = 31, .y = 82 }, { .x = 13, .y = 51 }, { .x = 90, .y = 26 }, { .x = 28, .y = 13 }, { .x = 76, .y = 33 }, { .x = 55, .y = 47 }, { .x = 98, .y = 96 }, { .x = 37, .y = 92 }, { .x = 29, .y = 2 }, { .x = 73, .y = 95 }, { .x = 58, .y = 92 }, { .x = 46, .y = 20 }, { .x = 67, .y = 73 }, { .x = 2, .y = 8 }, { .x = 34, .y = 29 }, { .x = 51, .y = 67 }, { .x = 36, .y = 89 }, { .x = 42, .y = 73 }, { .x = 34, .y = 14 }, { .x = 12, .y = 70 }, { .x = 40, .y = 33 }, { .x = 74, .y = 61 } };
+long init_31[] = { 7036, 3780, 4523, 3463, 1438, 853, 3852, 3015, 8084, 9857, 9163, 8098, 8252, 6802, 1967, 9634, 6460, 8050, 8357, 174, 333, 5267, 6851, 8119, 1399, 1006, 4827, 9877, 4875, 54, 9869, 3694, 3642, 1734, 2458, 7178, 5936, 6178, 3379, 7709, 5489, 1321, 644, 4305, 9677, 2255, 4288, 1902, 480, 5040, 399, 3516, 4016, 3677, 2318, 6718, 4028, 3657, 289, 8776, 2042, 3839, 668, 3876, 2171, 6525, 621, 1427, 4387, 7870, 2623, 7806, 6735, 5918, 2453, 5084, 6944, 9887, 3393, 2656, 8918, 3696, 1508, 9956, 6715, 6372, 321, 6017, 400, 5451, 5019, 359, 732, 3429, 1325, 5450, 9408, 6626, 8321, 6723, 6607, 6750, 9450, 2765, 3609, 9716, 8859, 4030, 3218, 8112, 4340, 2175, 178, 2968, 4288, 7217, 8530, 9788, 3713, 8679, 8100, 7219, 2407, 4158, 9862, 2640, 2986, 1557, 8926, 1393, 8085, 3644, 5172, 7616, 3584, 382, 4766, 4113, 9525, 4169, 1261, 4226, 7465, 1003, 4283, 3954, 4392, 8999, 8221, 2019, 2018, 3377, 5776, 5441, 8335, 9971, 9385, 934, 349, 8397, 4060, 4624, 3911, 2891, 7026, 8999, 844, 6953, 48, 3376, 8623, 8362, 6424, 4815, 3371, 4866, 6466, 242, 3944, 2842, 4651, 7187, 550, 435, 887, 8285, 8752, 4221, 7543, 7835, 2444, 182, 5106, 2762, 7321, 1266, 3192, 6558, 6616, 1770 };
+struct point pts_31[] = { { .x = 14, .y = 63 }, { .x = 25, .y = 51 }, { .x = 34, .y = 95 }, { .x = 31, .y = 50 }, { .x = 26, .y = 95 }, { .x = 54, .y = 99 }, { .x = 50, .y = 92 }, { .x = 33, .y = 72 }, { .x = 35, .y = 43 }, { .x = 82, .y = 19 }, { .x = 73, .y = 59 }, { .x = 48, .y = 42 }, { .x = 70, .y = 12 }, { .x = 52, .y = 19 }, { .x = 92, .y = 22 }, { .x = 50, .y = 77 }, { .x = 83, .y = 82 }, { .x = 84, .y = 89 }, { .x = 98, .y = 74 }, { .x = 90, .y = 19 }, { .x = 12, .y = 90 }, { .x = 22, .y = 5 }, { .x = 58, .y = 84 }, { .x = 38, .y = 95 }, { .x = 70, .y = 53 }, { .x = 77, .y = 72 }, { .x = 93, .y = 97 }, { .x = 49, .y = 46 }, { .x = 82, .y = 48 }, { .x = 32, .y = 36 }, { .x = 98, .y = 60 }, { .x = 48, .y = 86 }, { .x = 57, .y = 75 }, { .x = 57, .y = 92 }, { .x = 12, .y = 66 }, { .x = 31, .y = 54 }, { .x = 74, .y = 61 }, { .x = 98, .y = 92 }, { .x = 59, .y = 67 }, { .x = 14, .y = 38 } };
+long init_32[] = { 7903, 7759, 1793, 4107, 8498, 7774, 331, 2667, 2181, 1239, 1392, 4656, 4522, 5004, 8047, 574, 8754, 3149, 8084, 2641, 5515, 8283, 1167, 979, 4113, 5402, 3189, 5222, 4732, 7700, 3507, 7785, 7131, 5350, 2532, 258, 9962, 7661, 686, 1729, 5452, 7823, 7406, 6663, 6409, 3665, 5412, 8910, 10, 2107, 2357, 5180, 6088, 4917, 294, 6424, 3522, 5264, 6456, 6418, 9610, 5299, 9266, 3865, 5680, 1470, 5049, 8518, 9185, 4712, 7602, 5674, 8580, 4342, 38, 2118, 6211, 3735, 707, 1284, 8453, 5248, 4718, 3890, 1492, 3568, 4471, 2278, 847, 8215, 2858, 5640, 42, 381, 2189, 304, 4829, 9476, 182, 2029, 342, 8298, 9937, 224, 60, 9537, 5130, 4332, 6650, 7750, 1455, 2586, 9357, 612, 6581, 1862, 9989, 6817, 8090, 5106, 6111, 896, 105, 8549, 5896, 4749, 8943, 741, 5965, 408, 2307, 8946, 3653, 2652, 9063, 1631, 3985, 5503, 1949, 6417, 3909, 2971, 7770, 2408, 214, 1097, 1573, 6785, 5739, 6716, 8150, 3548, 3129, 7843, 2471, 8657, 7091, 115, 3271, 1251, 7768, 8240, 9007, 7793, 7392, 4618, 9103, 7689, 8022, 1238, 3431, 9493, 3672, 5079, 3806, 3728, 8803, 2250, 6743, 2501, 4974, 9870, 8204, 6478, 1680, 5502, 5136, 8186, 1071, 5376, 2802, 1681, 1499, 8593, 811, 3093, 3976, 6415, 6574, 2026 };
+struct point pts_32[] = { { .x = 8, .y = 74 }, { .x = 57, .y = 21 }, { .x = 59, .y = 84 }, { .x = 87, .y = 94 }, { .x = 36, .y = 36 }, { .x = 6, .y = 97 }, { .x = 58, .y = 54 }, { .x = 5, .y = 52 }, { .x = 33, .y = 15 }, { .x = 29, .y = 98 }, { .x = 82, .y = 50 }, { .x = 66, .y = 11 }, { .x = 84, .y = 93 }, { .x = 93, .y = 92 }, { .x = 92, .y = 38 }, { .x = 95, .y = 49 }, { .x = 49, .y = 73 }, { .x = 69, .y = 39 }, { .x = 8, .y = 70 }, { .x = 50, .y = 34 }, { .x = 44, .y = 19 }, { .x = 12, .y = 65 }, { .x = 84, .y = 86 }, { .x = 22, .y = 17 }, { .x = 92, .y = 73 }, { .x = 23, .y = 68 }, { .x = 78, .y = 70 }, { .x = 35, .y = 53 }, { .x = 34, .y = 10 }, { .x = 3, .y = 76 }, { .x = 61, .y = 4 }, { .x = 24, .y = 66 }, { .x = 95, .y = 98 }, { .x = 5, .y = 19 }, { .x = 0, .y = 83 }, { .x = 64, .y = 61 }, { .x = 58, .y = 74 }, { .x = 41, .y = 23 }, { .x = 51, .y = 55 }, { .x = 17, .y = 64 } };
+long init_33[] = { 8457, 3284, 8113, 8974, 2670, 351, 8773, 2598, 5151, 9456, 8809, 5268, 3878, 2520, 1880, 1309, 201, 2648, 6590, 1333, 7923, 9252, 3094, 2319, 3162, 6608, 8254, 2524, 8998, 9874, 4326, 5574, 489, 3234, 5202, 6653, 1740, 2661, 7425, 6390, 1534, 2116, 4146, 1816, 1159, 82, 1646, 1166, 4386, 4167, 5320, 9179, 5720, 3235, 235, 8648, 5589, 2110, 3499, 3736, 6039, 8909, 3121, 2662, 2573, 6338, 5944, 6117, 6245, 4536, 5449, 9591, 6771, 1064, 9783, 8546, 3774, 8490, 227, 5899, 6672, 3198, 6233, 961, 6808, 7358, 5102, 1028, 4237, 7241, 8984, 3124, 336, 9910, 933, 6574, 5345, 780, 1518, 4591, 4281, 333, 3821, 430, 5183, 1112, 3761, 7784, 8496, 1437, 9998, 2874, 9670, 3300, 6593, 459, 4526, 4784, 155, 7459, 8641, 9854, 2960, 1924, 380, 9873, 4080, 2934, 3635, 1537, 3911, 7262, 7942, 3018, 8862, 9216, 139, 2933, 3452, 552, 7161, 7091, 550, 5089, 9445, 3672, 719, 6787, 9197, 291, 25, 6475, 2334, 7989, 7215, 6650, 4967, 995, 5165, 8082, 1780, 1374, 6623, 3580, 3877, 2195, 9142, 5049, 6998, 2213, 6022, 8813, 9326, 7705, 7832, 3523, 3154, 2903, 789, 9337, 1052, 4100, 715, 6134, 7872, 5572, 3804, 2901, 3227, 5547, 7940, 3323, 7692, 6921, 532, 2953, 2653, 3976, 5083, 173 };
+struct point pts_33[] = { { .x = 43, .y = 21 }, { .x = 64, .y = 71 }, { .x = 61, .y = 24 }, { .x = 58, .y = 48 }, { .x = 48, .y = 43 }, { .x = 5, .y = 1 }, { .x = 7, .y = 55 }, { .x = 46, .y = 91 }, { .x = 34, .y = 41 }, { .x = 35, .y = 32 }, { .x = 78, .y = 5 }, { .x = 54, .y = 23 }, { .x = 28, .y = 58 }, { .x = 76, .y = 20 }, { .x = 5, .y = 6 }, { .x = 87, .y = 9 }, { .x = 11, .y = 36 }, { .x = 37, .y = 83 }, { .x = 51, .y = 79 }, { .x = 38, .y = 71 }, { .x = 31, .y = 98 }, { .x = 16, .y = 59 }, { .x = 33, .y = 67 }, { .x = 16, .y = 70 }, { .x = 30, .y = 84 }, { .x = 56, .y = 46 }, { .x = 94, .y = 84 }, { .x = 24, .y = 59 }, { .x = 10, .y = 10 }, { .x = 60, .y = 46 }, { .x = 50, .y = 43 }, { .x = 84, .y = 3 }, { .x = 28, .y = 97 }, { .x = 26, .y = 71 }, { .x = 4, .y = 98 }, { .x = 49, .y = 37 }, { .x = 83, .y = 19 }, { .x = 23, .y = 67 }, { .x = 60, .y = 2 }, { .x = 76, .y = 94 } };
+long init_34[] = { 6851, 1660, 2387, 503, 3063, 770, 7956, 3391, 5016, 596, 8192, 1192, 1709, 2045, 1932, 6739, 3270, 1823, 1493, 9777, 5248, 7206, 5113, 7993, 7320, 2771, 5286, 6415, 9365, 1507, 4926, 5432, 2682, 1675, 9311, 358, 723, 5657, 519, 4378, 9475, 2706, 9514, 5539, 1060, 2032, 7610, 8592, 92, 8552, 2494, 500, 5550, 9791, 6374, 2155, 7397, 2673, 3231, 6987, 8387, 2435, 23, 5480, 8688, 7547, 4948, 3123, 60, 2378, 7093, 7386, 8941, 321, 1504, 7037, 5071, 8702, 2359, 4809, 7128, 731, 6572, 4075, 8314, 3692, 8506, 8025, 4126, 7786, 7307, 1443, 5326, 1957, 4293, 6427, 2019, 5312, 8247, 1490, 6798, 8808, 4840, 805, 6938, 933, 6697, 8311, 3312, 3113, 1541, 8090, 2273, 3458, 7701, 2746, 79, 5617, 7706, 6391, 4480, 5144, 3061, 7269, 4432, 9374, 8664, 3159, 3012, 6404, 2691, 9798, 3228, 4074, 727, 3098, 6891, 2016, 1624, 8982, 6992, 6299, 3473, 9238, 3404, 3903, 5842, 1018, 6589, 5411, 39, 902, 838, 7760, 9656, 775, 8638, 3905, 2668, 9529, 1296, 9571, 1239, 9141, 7614, 5947, 3474, 7553, 5874, 7155, 2483, 2648, 9372, 9467, 4073, 9772, 8024, 6184, 4613, 7507, 8719, 2450, 2228, 6783, 5393, 3181, 8155, 9578, 730, 6073, 8833, 7645, 7095, 3060, 4569, 594, 1564, 3005, 1430, 9039 };
+struct point pts_34[] = { { .x = 63, .y = 91 }, { .x = 8, .y = 52 }, { .x = 28, .y = 16 }, { .x = 27, .y = 93 }, { .x = 90, .y = 21 }, { .x = 66, .y = 59 }, { .x = 2, .y = 4 }, { .x = 20, .y = 74 }, { .x = 40, .y = 50 }, { .x = 30, .y = 88 }, { .x = 53, .y = 91 }, { .x = 58, .y = 87 }, { .x = 73, .y = 43 }, { .x = 54, .y = 74 }, { .x = 70, .y = 7 }, { .x = 38, .y = 64 }, { .x = 33, .y = 96 }, { .x = 91, .y = 84 }, { .x = 71, .y = 5 }, { .x = 79, .y = 38 }, { .x = 88, .y = 15 }, { .x = 88, .y = 69 }, { .x = 1, .y = 38 }, { .x = 29, .y = 36 }, { .x = 5, .y = 87 }, { .x = 93, .y = 18 }, { .x = 47, .y = 62 }, { .x = 74, .y = 21 }, { .x = 14, .y = 73 }, { .x = 40, .y = 58 }, { .x = 7, .y = 33 }, { .x = 61, .y = 74 }, { .x = 3, .y = 79 }, { .x = 40, .y = 71 }, { .x = 40, .y = 60 }, { .x = 58, .y = 23 }, { .x = 55, .y = 18 }, { .x = 80, .y = 18 }, { .x = 8, .y = 16 }, { .x = 60, .y = 7 } };
+long init_35[] = { 9705, 5818, 5808, 9324, 6458, 4075, 5953, 652, 377, 2910, 3094, 8453, 5137, 8082, 6576, 9499, 5659, 6923, 3232, 1149, 3748, 4806, 8446, 5466, 8149, 2401, 2096, 4472, 5244, 6169, 1881, 686, 6551, 4752, 8917, 7655, 6434, 8770, 2874, 5526, 7304, 8902, 2264, 2900, 4264, 3174, 2244, 3410, 9374, 5711, 9129, 83, 9116, 6018, 9402, 6159, 1810, 9745, 25, 8461, 1371, 1126, 9879, 1448, 8059, 4378, 3683, 6821, 8792, 3860, 7911, 5528, 7185, 412, 9860, 1962, 3778, 2181, 840, 2036, 4739, 4006, 4742, 8001, 9210, 7663, 6801, 7757, 9312, 186, 3975, 7959, 4003, 7229, 4658, 9300, 3810, 9228, 7477, 8344, 438, 970, 3371, 3816, 7958, 8720, 5449, 7977, 2515, 4258, 9590, 308, 4447, 9284, 9905, 8935, 1582, 7384, 2890, 8785, 9255, 6420, 4824, 5149, 8239, 2580, 2437, 4365, 4831, 5955, 1850, 670, 89, 8991, 6821, 3709, 1066, 2570, 1348, 1030, 346, 9602, 3644, 4179, 5961, 1353, 6025, 8965, 8008, 5752, 3511, 5358, 8083, 4396, 8080, 9133, 8193, 1417, 2416, 5282, 5698, 2134, 9253, 1741, 5415, 6127, 811, 7408, 7828, 4510, 5996, 3127, 9302, 6075, 2023, 158, 6268, 2402, 4776, 568, 2004, 7953, 5042, 9630, 5791, 7597, 6901, 5064, 6429, 113, 6945, 3255, 2734, 7324, 3206, 7765, 5658, 7793, 7982, 2669 };
+struct point pts_35[] = { { .x = 97, .y = 12 }, { .x = 81, .y = 39 }, { .x = 68, .y = 10 }, { .x = 38, .y = 11 }, { .x = 0, .y = 27 }, { .x = 14, .y = 32 }, { .x = 53, .y = 48 }, { .x = 28, .y = 38 }, { .x = 85, .y = 5 }, { .x = 37, .y = 43 }, { .x = 84, .y = 85 }, { .x = 61, .y = 79 }, { .x = 92, .y = 95 }, { .x = 38, .y = 36 }, { .x = 67, .y = 52 }, { .x = 73, .y = 86 }, { .x = 88, .y = 88 }, { .x = 53, .y = 13 }, { .x = 13, .y = 45 }, { .x = 45, .y = 75 }, { .x = 89, .y = 26 }, { .x = 30, .y = 74 }, { .x = 75, .y = 44 }, { .x = 34, .y = 38 }, { .x = 17, .y = 56 }, { .x = 92, .y = 38 }, { .x = 66, .y = 62 }, { .x = 79, .y = 27 }, { .x = 53, .y = 4 }, { .x = 25, .y = 67 }, { .x = 63, .y = 53 }, { .x = 76, .y = 8 }, { .x = 79, .y = 35 }, { .x = 38, .y = 34 }, { .x = 27, .y = 67 }, { .x = 21, .y = 20 }, { .x = 35, .y = 48 }, { .x = 28, .y = 92 }, { .x = 4, .y = 43 }, { .x = 43, .y = 66 } };
+long init_36[] = { 9252, 2492, 341, 1850, 2377, 3077, 7674, 3776, 1924, 3235, 4991, 7301, 1857, 6161, 9972, 3510, 8062, 8066, 6137, 2461, 4776, 5260, 6744, 3925, 8939, 3175, 2195, 6949, 8229, 6042, 4983, 8353, 2405, 9954, 5939, 899, 217, 5089, 9544, 4885, 6922, 6659, 8570, 9810, 9553, 4081, 6905, 1934, 7087, 9739, 4643, 8817, 344, 8478, 9562, 1974, 5587, 569, 342, 3167, 6603, 1549, 4560, 5044, 7775, 9132, 4092, 1147, 621, 373, 6886, 3730, 7523, 1581, 6889, 231, 4826, 7970, 6309, 291, 6336, 5565, 2983, 2845, 3005, 4263, 831, 4595, 4020, 9891, 7738, 4784, 4079, 8475, 5308, 1007, 4956, 6198, 2485, 7894, 2222, 8517, 6001, 9242, 9037, 2599, 627, 9779, 1666, 7315, 5705, 8480, 5846, 3951, 480, 1568, 7286, 6966, 1908, 7431, 8071, 8589, 344, 6132, 5015, 8867, 1306, 4366, 2707, 2122, 5908, 7177, 59, 5029, 3100, 4043, 2130, 8838, 295, 7280, 8826, 7661, 7152, 4948, 4560, 8529, 5360, 6779, 9168, 1684, 9673, 486, 4277, 7055, 3629, 410, 7403, 3977, 6453, 8837, 1649, 660, 2176, 9898, 5787, 6359, 5363, 7015, 5771, 968, 7557, 3910, 9440, 848, 5452, 7269, 1377, 8125, 4608, 4330, 2421, 4850, 2349, 70, 1084, 5142, 1640, 7250, 4059, 1624, 342, 8914, 1750, 1143, 1844, 5088, 3560, 2522, 4619, 1134 };
+struct point pts_36[] = { { .x = 94, .y = 14 }, { .x = 45, .y = 34 }, { .x = 43, .y = 68 }, { .x = 81, .y = 22 }, { .x = 53, .y = 48 }, { .x = 51, .y = 81 }, { .x = 70, .y = 27 }, { .x = 47, .y = 58 }, { .x = 39, .y = 9 }, { .x = 81, .y = 12 }, { .x = 70, .y = 12 }, { .x = 39, .y = 73 }, { .x = 3, .y = 54 }, { .x = 66, .y = 19 }, { .x = 71, .y = 40 }, { .x = 61, .y = 89 }, { .x = 56, .y = 13 }, { .x = 16, .y = 5 }, { .x = 45, .y = 24 }, { .x = 12, .y = 0 }, { .x = 90, .y = 49 }, { .x = 9, .y = 8 }, { .x = 17, .y = 59 }, { .x = 22, .y = 83 }, { .x = 91, .y = 23 }, { .x = 94, .y = 13 }, { .x = 89, .y = 92 }, { .x = 45, .y = 87 }, { .x = 59, .y = 63 }, { .x = 20, .y = 78 }, { .x = 26, .y = 76 }, { .x = 53, .y = 19 }, { .x = 99, .y = 28 }, { .x = 31, .y = 56 }, { .x = 71, .y = 20 }, { .x = 5, .y = 65 }, { .x = 67, .y = 70 }, { .x = 48, .y = 64 }, { .x = 34, .y = 58 }, { .x = 95, .y = 18 } };
+long init_37[] = { 2729, 3890, 781, 2549, 8344, 2363, 8931, 1367, 4169, 8283, 1652, 2654, 6113, 9535, 2781, 2380, 180, 9677, 1007, 7991, 4399, 2025, 3903, 4672, 7198, 8579, 5170, 3668, 5129, 2843, 9276, 6571, 2144, 1057, 8369, 4536, 6282, 2298, 7444, 7056, 6358, 6125, 2886, 2920, 5448, 6112, 9716, 7436, 1541, 3337, 3906, 7484, 2863, 5170, 3801, 7571, 6541, 6036, 4587, 2296, 500, 2809, 4293, 826, 3581, 317, 6032, 3330, 3745, 4079, 3091, 1892, 9073, 5055, 4414, 7186, 2453, 3162, 6422, 6533, 8415, 965, 1922, 3056, 8085, 1264, 4476, 6117, 539, 7212, 8817, 1311, 935, 8719, 9037, 5576, 557, 2455, 1915, 7329, 9993, 6093, 4432, 9126, 3691, 4646, 6918, 3063, 8162, 1708, 7954, 304, 3647, 934, 8967, 9849, 1511, 7149, 6545, 6971, 2011, 5575, 6387, 6077, 7962, 5926, 284, 2928, 6780, 7516, 1992, 7965, 2449, 1150, 1824, 5044, 3074, 2361, 8080, 4295, 9287, 6245, 3762, 3205, 8681, 6858, 184, 5956, 972, 8723, 8908, 6245, 2858, 4074, 2704, 2652, 4177, 5648, 380, 2510, 9736, 3621, 9757, 8308, 1579, 7526, 5097, 6491, 2490, 6068, 3105, 5897, 3697, 5147, 3251, 2623, 3452, 375, 3271, 4095, 1459, 6457, 4970, 4743, 4800, 6962, 1376, 6164, 7334, 419, 7811, 3953, 5093, 7348, 7700, 8816, 5282, 9304, 9646, 8087 };
+struct point pts_37[] = { { .x = 55, .y = 11 }, { .x = 24, .y = 9 }, { .x = 80, .y = 41 }, { .x = 60, .y = 32 }, { .x = 94, .y = 97 }, { .x = 40, .y = 56 }, { .x = 7, .y = 55 }, { .x = 28, .y = 38 }, { .x = 29, .y = 9 }, { .x = 97, .y = 20 }, { .x = 26, .y = 85 }, { .x = 50, .y = 42 }, { .x = 39, .y = 73 }, { .x = 89, .y = 63 }, { .x = 66, .y = 38 }, { .x = 55, .y = 38 }, { .x = 37, .y = 76 }, { .x = 11, .y = 10 }, { .x = 32, .y = 66 }, { .x = 66, .y = 8 }, { .x = 76, .y = 85 }, { .x = 80, .y = 14 }, { .x = 93, .y = 55 }, { .x = 29, .y = 1 }, { .x = 99, .y = 58 }, { .x = 42, .y = 57 }, { .x = 45, .y = 65 }, { .x = 48, .y = 21 }, { .x = 91, .y = 97 }, { .x = 87, .y = 19 }, { .x = 47, .y = 58 }, { .x = 25, .y = 99 }, { .x = 53, .y = 15 }, { .x = 37, .y = 96 }, { .x = 77, .y = 18 }, { .x = 35, .y = 82 }, { .x = 5, .y = 89 }, { .x = 1, .y = 13 }, { .x = 9, .y = 55 }, { .x = 98, .y = 89 } };
+long init_38[] = { 4792, 2528, 4535, 9573, 9772, 9685, 7278, 9008, 5281, 6618, 1227, 2461, 3927, 2495, 4447, 6244, 5017, 1756, 8331, 9715, 6849, 8860, 2136, 1077, 7011, 1864, 500, 600, 6704, 2640, 706, 1724, 8563, 3138, 2321, 8120, 1564, 2111, 4986, 3573, 285, 4171, 7838, 7584, 6755, 2843, 7233, 4620, 4483, 8817, 9927, 5549, 6095, 4898, 9948, 2026, 287, 1056, 2245, 6469, 6727, 5992, 9230, 4493, 8538, 1708, 2917, 1425, 4695, 2766, 6676, 7889, 5073, 7280, 9642, 5871, 1852, 5132, 7106, 9131, 445, 6349, 1051, 7441, 7073, 4335, 6633, 4377, 5695, 5680, 2050, 1904, 5012, 3956, 6365, 9033, 9512, 4514, 9756, 9830, 163, 3636, 9618, 1068, 7770, 528, 6630, 8276, 4572, 8626, 1441, 364, 9714, 5068, 6449, 5202, 8870, 1947, 794, 1812, 1532, 5178, 4412, 1474, 1760, 9436, 9617, 7166, 440, 9298, 5737, 9742, 8279, 7463, 3123, 7274, 5230, 6522, 6783, 8231, 5088, 8180, 3747, 1267, 1960, 5491, 7968, 3344, 8676, 5018, 6466, 5930, 7513, 4325, 3462, 1242, 614, 608, 5669, 5328, 9586, 2912, 429, 5089, 4678, 9875, 6191, 8891, 5009, 6812, 4162, 5850, 9255, 7167, 8157, 6891, 314, 78, 4432, 4355, 9178, 7275, 3036, 5482, 3835, 5848, 5468, 9498, 6767, 1988, 7973, 3591, 62, 8749, 3912, 8786, 5108, 6789, 9485, 2061 };
+struct point pts_38[] = { { .x = 68, .y = 39 }, { .x = 38, .y = 85 }, { .x = 59, .y = 30 }, { .x = 33, .y = 51 }, { .x = 63, .y = 90 }, { .x = 16, .y = 73 }, { .x = 34, .y = 37 }, { .x = 83, .y = 85 }, { .x = 40, .y = 27 }, { .x = 27, .y = 71 }, { .x = 27, .y = 50 }, { .x = 51, .y = 47 }, { .x = 59, .y = 16 }, { .x = 25, .y = 49 }, { .x = 60, .y = 26 }, { .x = 69, .y = 36 }, { .x = 1, .y = 60 }, { .x = 44, .y = 54 }, { .x = 64, .y = 35 }, { .x = 23, .y = 22 }, { .x = 3, .y = 20 }, { .x = 16, .y = 40 }, { .x = 65, .y = 2 }, { .x = 9, .y = 26 }, { .x = 0, .y = 36 }, { .x = 90, .y = 93 }, { .x = 93, .y = 59 }, { .x = 7, .y = 85 }, { .x = 51, .y = 8 }, { .x = 3, .y = 82 }, { .x = 0, .y = 46 }, { .x = 1, .y = 58 }, { .x = 4, .y = 32 }, { .x = 33, .y = 49 }, { .x = 66, .y = 76 }, { .x = 79, .y = 13 }, { .x = 69, .y = 88 }, { .x = 72, .y = 87 }, { .x = 50, .y = 60 }, { .x = 19, .y = 22 } };
+long init_39[] = { 6269, 8228, 3652, 3652, 9367, 1487, 1953, 3420, 8858, 8166, 8395, 343, 5029, 9355, 9385, 5259, 7454, 895, 1475, 5838, 100, 628, 8669, 1792, 2357, 2194, 8131, 9869, 2157, 192, 9654, 2359, 7967, 8809, 7304, 3788, 8744, 9118, 2127, 2064, 9050, 1457, 5355, 3582, 5450, 6219, 8038, 1398, 1566, 4963, 6908, 6858, 4964, 8904, 3976, 4936, 4245, 6980, 8927, 9991, 1156, 8055, 8232, 4550, 2448, 7858, 3642, 1995, 4769, 4638, 4857, 1112, 825, 1999, 5648, 7479, 6720, 1992, 5680, 4893, 7556, 8840, 8957, 8640, 980, 5201, 4507, 1613, 7649, 6171, 5724, 5472, 5177, 1337, 2564, 4310, 231, 332, 1393, 903, 6304, 7723, 2446, 1565, 5435, 9150, 8796, 8231, 5234, 9520, 4961, 3687, 2658, 3313, 2144, 9881, 6699, 7776, 9290, 7952, 6820, 4339, 5658, 5026, 5512, 4373, 1247, 1895, 8824, 1022, 3827, 4606, 3275, 1281, 676, 6203, 4564, 5798, 5358, 8239, 8166, 6122, 6395, 5580, 8727, 375, 2652, 9094, 299, 3438, 9874, 4351, 9743, 2279, 8423, 1737, 4592, 1052, 7139, 3461, 5814, 4673, 7641, 7805, 778, 2811, 2716, 7371, 4709, 8357, 2172, 6478, 3752, 9546, 6361, 7458, 2625, 2657, 9975, 5827, 8818, 9724, 8766, 8673, 97, 6677, 7281, 1355, 2573, 6413, 4894, 7785, 4935, 303, 9224, 1149, 9529, 8561, 2250, 4747 };
+struct point pts_39[] = { { .x = 68, .y = 68 }, { .x = 38, .y = 72 }, { .x = 9, .y = 43 }, { .x = 59, .y = 92 }, { .x = 77, .y = 15 }, { .x = 35, .y = 58 }, { .x = 89, .y = 49 }, { .x = 66, .y = 99 }, { .x = 50, .y = 96 }, { .x = 19, .y = 21 }, { .x = 93, .y = 35 }, { .x = 34, .y = 85 }, { .x = 72, .y = 45 }, { .x = 61, .y = 35 }, { .x = 64, .y = 39 }, { .x = 58, .y = 83 }, { .x = 28, .y = 88 }, { .x = 22, .y = 9 }, { .x = 96, .y = 15 }, { .x = 6, .y = 53 }, { .x = 17, .y = 35 }, { .x = 85, .y = 64 }, { .x = 26, .y = 62 }, { .x = 30, .y = 47 }, { .x = 73, .y = 7 }, { .x = 98, .y = 5 }, { .x = 82, .y = 91 }, { .x = 84, .y = 75 }, { .x = 12, .y = 17 }, { .x = 40, .y = 37 }, { .x = 64, .y = 96 }, { .x = 98, .y = 5 }, { .x = 6, .y = 1 }, { .x = 89, .y = 67 }, { .x = 79, .y = 84 }, { .x = 87, .y = 78 }, { .x = 56, .y = 54 }, { .x = 91, .y = 23 }, { .x = 9, .y = 78 }, { .x = 0, .y = 89 } };
+long init_40[] = { 8014, 2410, 2153, 7822, 4973, 235, 8400, 1459, 1891, 4560, 4088, 9546, 3692, 2469, 4648, 6316, 4101, 1381, 1978, 8318, 4666, 1508, 6956, 8835, 1265, 7085, 8419, 4422, 1158, 1734, 4389, 8374, 9792, 5475, 6906, 7243, 8964, 9185, 8873, 2600, 473, 5433, 6898, 5686, 6933, 7349, 2755, 1493, 2938, 4705, 5498, 1565, 2915, 3533, 9466, 9953, 4789, 1176, 9062, 5995, 8207, 8506, 6039, 3136, 2315, 5363, 8705, 6178, 3889, 7428, 9847, 1527, 9405, 1444, 4770, 9187, 9118, 5889, 6403, 9795, 3086, 4362, 4412, 8108, 6223, 377, 1225, 2265, 1126, 7522, 7224, 2468, 495, 8710, 7469, 2111, 3338, 4172, 2416, 9087, 1003, 6561, 8274, 7003, 7603, 9380, 8362, 7645, 7263, 8752, 9578, 8100, 5715, 2142, 9254, 6151, 701, 7448, 3066, 625, 1840, 2334, 260, 6765, 2825, 7105, 5793, 9387, 6006, 8747, 6475, 3784, 4560, 973, 7010, 9955, 7307, 6607, 737, 678, 3041, 3647, 1508, 5161, 6655, 6722, 6913, 7692, 863, 2149, 388, 8849, 6186, 9294, 3895, 7775, 3067, 523, 6570, 2085, 1703, 9771, 1671, 280, 710, 596, 3000, 3385, 9202, 9453, 1163, 5021, 643, 6281, 6559, 1706, 6950, 2681, 4882, 5691, 6990, 3904, 3425, 155, 6788, 666, 7292, 339, 9538, 5009, 4735, 3000, 7045, 7256, 3134, 732, 510, 4758, 3760, 8015 };
+struct point pts_40[] = { { .x = 3, .y = 43 }, { .x = 62, .y = 28 }, { .x = 31, .y = 50 }, { .x = 72, .y = 73 }, { .x = 20, .y = 65 }, { .x = 91, .y = 54 }, { .x = 69, .y = 35 }, { .x = 19, .y = 45 }, { .x = 71, .y = 79 }, { .x = 64, .y = 15 }, { .x = 87, .y = 2 }, { .x = 53, .y = 40 }, { .x = 77, .y = 12 }, { .x = 35, .y = 53 }, { .x = 66, .y = 97 }, { .x = 35, .y = 60 }, { .x = 34, .y = 29 }, { .x = 77, .y = 65 }, { .x = 39, .y = 24 }, { .x = 43, .y = 56 }, { .x = 24, .y = 18 }, { .x = 26, .y = 33 }, { .x = 24, .y = 52 }, { .x = 97, .y = 16 }, { .x = 73, .y = 38 }, { .x = 94, .y = 69 }, { .x = 1, .y = 42 }, { .x = 86, .y = 78 }, { .x = 93, .y = 74 }, { .x = 51, .y = 64 }, { .x = 42, .y = 4 }, { .x = 93, .y = 62 }, { .x = 36, .y = 52 }, { .x = 46, .y = 3 }, { .x = 86, .y = 82 }, { .x = 21, .y = 3 }, { .x = 68, .y = 83 }, { .x = 56, .y = 79 }, { .x = 53, .y = 14 }, { .x = 71, .y = 41 } };
+long init_41[] = { 6263, 1714, 1024, 9770, 2625, 3544, 2178, 6274, 5051, 1922, 4631, 6108, 7067, 9327, 2535, 3945, 8724, 305, 3806, 9147, 3409, 6310, 4893, 9861, 2309, 5722, 3610, 4402, 6690, 5172, 8699, 9212, 1549, 1359, 7623, 837, 2329, 5505, 3379, 362, 6866, 8486, 8106, 5058, 8835, 9219, 7552, 8424, 5652, 137, 5372, 5575, 8202, 154, 7850, 2458, 6635, 4792, 8627, 5226, 4474, 770, 7620, 3447, 5382, 9820, 5324, 4553, 1404, 4015, 7762, 6801, 1113, 3870, 7577, 2529, 1187, 3596, 9936, 8718, 3299, 6569, 3015, 2529, 850, 8906, 2637, 8699, 2928, 3606, 7182, 4131, 971, 2222, 842, 346, 9304, 489, 3083, 7595, 7742, 7590, 8724, 7587, 1254, 6782, 936, 7012, 5450, 9571, 9070, 9496, 8003, 4067, 1107, 2339, 9119, 5912, 1441, 7817, 2169, 1490, 3653, 5242, 6393, 1782, 5703, 7394, 6074, 2414, 9105, 3105, 4587, 3070, 6626, 8044, 4883, 5705, 8617, 5344, 8262, 6152, 9764, 4281, 6086, 1284, 178, 2261, 9740, 2659, 286, 6132, 9371, 2883, 4712, 1340, 9326, 7309, 2534, 5532, 9809, 8976, 6179, 7335, 3280, 1116, 4745, 1814, 3893, 7187, 1528, 4695, 543, 8423, 2507, 9764, 6121, 5294, 9360, 5327, 6008, 3414, 1257, 2565, 8650, 2250, 4254, 7850, 1862, 2610, 1408, 5812, 1159, 9539, 4530, 9102, 2908, 7169, 5515, 3005 };
+struct point pts_41[] = { { .x = 16, .y = 24 }, { .x = 3, .y = 74 }, { .x = 54, .y = 18 }, { .x = 90, .y = 39 }, { .x = 99, .y = 39 }, { .x = 5, .y = 17 }, { .x = 12, .y = 90 }, { .x = 0, .y = 13 }, { .x = 88, .y = 67 }, { .x = 45, .y = 69 }, { .x = 66, .y = 61 }, { .x = 88, .y = 22 }, { .x = 28, .y = 75 }, { .x = 92, .y = 90 }, { .x = 75, .y = 88 }, { .x = 84, .y = 71 }, { .x = 16, .y = 65 }, { .x = 39, .y = 20 }, { .x = 91, .y = 57 }, { .x = 19, .y = 83 }, { .x = 3, .y = 79 }, { .x = 25, .y = 13 }, { .x = 44, .y = 17 }, { .x = 10, .y = 29 }, { .x = 93, .y = 41 }, { .x = 28, .y = 18 }, { .x = 53, .y = 69 }, { .x = 95, .y = 60 }, { .x = 70, .y = 96 }, { .x = 30, .y = 78 }, { .x = 76, .y = 59 }, { .x = 8, .y = 37 }, { .x = 47, .y = 54 }, { .x = 90, .y = 14 }, { .x = 75, .y = 52 }, { .x = 41, .y = 84 }, { .x = 69, .y = 88 }, { .x = 75, .y = 1 }, { .x = 77, .y = 9 }, { .x = 43, .y = 21 } };
+long init_42[] = { 2762, 4737, 4839, 240, 984, 6301, 9944, 9226, 5962, 5816, 1384, 8530, 4984, 5691, 8348, 8911, 3970, 7363, 8117, 4847, 6616, 8417, 4468, 4080, 1266, 1473, 1378, 6758, 6864, 5749, 7924, 3284, 1175, 8919, 6356, 2990, 8707, 91, 857, 5881, 1884, 7287, 2067, 8142, 1783, 9495, 6738, 3221, 6149, 2569, 1989, 9934, 6221, 1515, 7022, 9660, 9717, 1180, 9209, 1954, 3221, 5761, 8914, 2531, 4900, 4538, 9944, 1339, 8278, 3749, 3958, 3769, 3365, 3976, 9328, 7428, 5938, 3362, 9706, 2051, 4077, 3798, 7558, 1532, 8509, 8776, 6659, 6881, 2373, 4167, 3957, 9525, 7597, 8033, 4208, 9615, 879, 3129, 5838, 8338, 9104, 9830, 4894, 2476, 4689, 8766, 958, 5131, 7117, 5602, 6033, 98, 5502, 8144, 9661, 2363, 7572, 6656, 4461, 267, 1241, 7416, 8277, 2518, 4503, 3233, 4590, 4268, 428, 2838, 4900, 9225, 9559, 8917, 1893, 8241, 2839, 4506, 6872, 4947, 2009, 3713, 5567, 9519, 775, 4506, 9832, 4964, 2411, 5220, 7716, 8629, 4202, 8148, 6961, 2476, 7824, 7517, 7605, 3105, 1502, 9771, 9930, 2640, 5770, 5734, 2125, 8449, 5465, 5984, 1401, 7488, 8832, 330, 4224, 1298, 9913, 3496, 7358, 6395, 6086, 5579, 4538, 8154, 5511, 9870, 6639, 735, 1032, 2524, 9982, 5011, 3173, 2333, 7823, 8326, 8708, 6262, 1144, 8996 };
+struct point pts_42[] = { { .x = 17, .y = 89 }, { .x = 1, .y = 36 }, { .x = 10, .y = 17 }, { .x = 21, .y = 56 }, { .x = 8, .y = 6 }, { .x = 14, .y = 79 }, { .x = 28, .y = 79 }, { .x = 51, .y = 90 }, { .x = 36, .y = 17 }, { .x = 6, .y = 21 }, { .x = 21, .y = 66 }, { .x = 87, .y = 59 }, { .x = 20, .y = 95 }, { .x = 80, .y = 61 }, { .x = 60, .y = 82 }, { .x = 7, .y = 50 }, { .x = 76, .y = 85 }, { .x = 22, .y = 90 }, { .x = 62, .y = 33 }, { .x = 51, .y = 93 }, { .x = 81, .y = 92 }, { .x = 3, .y = 93 }, { .x = 2, .y = 0 }, { .x = 86, .y = 14 }, { .x = 92, .y = 61 }, { .x = 87, .y = 74 }, { .x = 41, .y = 0 }, { .x = 73, .y = 27 }, { .x = 99, .y = 3 }, { .x = 68, .y = 52 }, { .x = 21, .y = 63 }, { .x = 81, .y = 4 }, { .x = 38, .y = 21 }, { .x = 46, .y = 54 }, { .x = 14, .y = 8 }, { .x = 77, .y = 37 }, { .x = 71, .y = 80 }, { .x = 32, .y = 41 }, { .x = 21, .y = 60 }, { .x = 24, .y = 86 } };
+long init_43[] = { 5227, 4180, 6736, 6975, 6543, 2642, 8386, 503, 5542, 9166, 1616, 664, 9260, 3825, 3061, 6148, 8418, 8679, 3991, 2879, 6590, 1729, 3792, 2131, 669, 6587, 5860, 9513, 8191, 180, 2570, 1259, 9261, 5813, 9711, 8655, 9659, 2936, 683, 5131, 6605, 3217, 6901, 6570, 5652, 9868, 811, 8310, 6997, 4666, 4366, 6393, 2813, 1895, 3228, 6864, 107, 6421, 614, 6734, 7733, 4662, 4947, 9342, 9350, 642, 4036, 8124, 7143, 9612, 7489, 189, 6429, 2975, 3739, 2983, 1989, 9566, 2723, 4211, 6540, 9056, 5763, 176, 1207, 6352, 7394, 9841, 6348, 4187, 5696, 383, 5131, 7811, 1229, 3419, 2100, 2882, 9509, 1177, 6232, 1968, 2418, 7578, 5988, 5578, 5361, 9893, 3932, 9977, 9349, 2654, 9720, 3040, 5349, 9425, 6200, 8430, 3908, 6167, 2682, 9819, 1431, 7965, 8164, 9793, 9263, 1591, 3144, 9021, 7998, 9840, 5451, 5248, 6576, 2147, 3521, 5393, 7436, 4440, 2069, 2841, 7733, 874, 6379, 7815, 4065, 9210, 9130, 8810, 6694, 5584, 3583, 4860, 8854, 1157, 7934, 4964, 1606, 8989, 6139, 7375, 310, 7500, 8024, 5322, 2243, 1597, 1279, 67, 1433, 5985, 2266, 8449, 2757, 8233, 6616, 9344, 6614, 3011, 9112, 6575, 6443, 177, 589, 9307, 8607, 5067, 6368, 5827, 5895, 6206, 2496, 5497, 7170, 6967, 8042, 3623, 4286, 9821 };
+struct point pts_43[] = { { .x = 1, .y = 28 }, { .x = 92, .y = 8 }, { .x = 98, .y = 93 }, { .x = 65, .y = 80 }, { .x = 23, .y = 60 }, { .x = 44, .y = 38 }, { .x = 58, .y = 90 }, { .x = 87, .y = 88 }, { .x = 44, .y = 45 }, { .x = 40, .y = 56 }, { .x = 14, .y = 62 }, { .x = 39, .y = 84 }, { .x = 14, .y = 81 }, { .x = 68, .y = 52 }, { .x = 89, .y = 28 }, { .x = 18, .y = 63 }, { .x = 74, .y = 1 }, { .x = 51, .y = 27 }, { .x = 72, .y = 45 }, { .x = 79, .y = 48 }, { .x = 98, .y = 97 }, { .x = 65, .y = 40 }, { .x = 22, .y = 48 }, { .x = 41, .y = 96 }, { .x = 62, .y = 95 }, { .x = 45, .y = 85 }, { .x = 87, .y = 3 }, { .x = 69, .y = 80 }, { .x = 65, .y = 59 }, { .x = 83, .y = 0 }, { .x = 54, .y = 94 }, { .x = 42, .y = 12 }, { .x = 73, .y = 95 }, { .x = 93, .y = 50 }, { .x = 30, .y = 37 }, { .x = 16, .y = 19 }, { .x = 49, .y = 44 }, { .x = 45, .y = 49 }, { .x = 7, .y = 55 }, { .x = 36, .y = 54 } };
+long init_44[] = { 9876, 691, 2983, 9640, 1306, 5555, 1699, 3433, 4326, 5003, 6225, 7005, 8874, 6230, 6374, 4322, 8093, 2707, 7599, 9326, 9325, 6405, 5086, 415, 1816, 2377, 1813, 6773, 8798, 4832, 4284, 5135, 3634, 4371, 1082, 1780, 8983, 2323, 3698, 2688, 8639, 7999, 6936, 8125, 8297, 4083, 6420, 6459, 8256, 9504, 129, 8733, 5424, 1924, 5451, 7587, 6379, 7192, 9580, 1293, 8959, 3915, 2784, 4744, 7590, 648, 8491, 7049, 318, 3982, 4482, 7794, 4977, 393, 4931, 7073, 6001, 1242, 9101, 3844, 3017, 4391, 5934, 2525, 7289, 3355, 6238, 6962, 9251, 4304, 2976, 4618, 4972, 8509, 7351, 9565, 2266, 1690, 3500, 5156, 6650, 8927, 4940, 9077, 7675, 9108, 5897, 8473, 3880, 8710, 2241, 3458, 1263, 9745, 9352, 5860, 4552, 2377, 3323, 3242, 9387, 4776, 7023, 2724, 1470, 2544, 2567, 6559, 9923, 1715, 2322, 9713, 3652, 1841, 2307, 1235, 1109, 537, 1366, 8073, 1005, 5076, 1294, 2043, 3914, 732, 5063, 7464, 7181, 233, 2342, 9083, 4147, 3722, 7061, 4357, 9112, 7598, 4081, 5621, 2348, 7868, 29, 4626, 3518, 812, 7650, 8615, 5906, 9795, 18, 5529, 899, 107, 4964, 7741, 7519, 1880, 9009, 9896, 2499, 7363, 5089, 9065, 2009, 9189, 1176, 9055, 9358, 1130, 7644, 3354, 2560, 9799, 2901, 8644, 5652, 7775, 8705, 2829 };
+struct point pts_44[] = { { .x = 82, .y = 29 }, { .x = 51, .y = 5 }, { .x = 2, .y = 94 }, { .x = 40, .y = 7 }, { .x = 93, .y = 29 }, { .x = 87, .y = 89 }, { .x = 42, .y = 49 }, { .x = 83, .y = 50 }, { .x = 37, .y = 17 }, { .x = 46, .y = 8 }, { .x = 11, .y = 27 }, { .x = 0, .y = 1 }, { .x = 18, .y = 45 }, { .x = 96, .y = 84 }, { .x = 57, .y = 72 }, { .x = 95, .y = 54 }, { .x = 72, .y = 8 }, { .x = 30, .y = 6 }, { .x = 75, .y = 42 }, { .x = 10, .y = 16 }, { .x = 32, .y = 83 }, { .x = 29, .y = 49 }, { .x = 7, .y = 28 }, { .x = 43, .y = 84 }, { .x = 11, .y = 6 }, { .x = 72, .y = 11 }, { .x = 15, .y = 86 }, { .x = 32, .y = 95 }, { .x = 87, .y = 35 }, { .x = 66, .y = 41 }, { .x = 83, .y = 56 }, { .x = 22, .y = 58 }, { .x = 11, .y = 28 }, { .x = 49, .y = 5 }, { .x = 15, .y = 45 }, { .x = 40, .y = 10 }, { .x = 12, .y = 17 }, { .x = 4, .y = 74 }, { .x = 6, .y = 25 }, { .x = 35, .y = 31 } };
+long init_45[] = { 2165, 8082, 7185, 7459, 4294, 3202, 2418, 3052, 5727, 2879, 5459, 5352, 3248, 3108, 9226, 4295, 6157, 6148, 3693, 6898, 39, 2075, 8990, 6729, 2937, 7327, 59, 9930, 324, 8781, 9714, 3203, 9499, 732, 6734, 6360, 6311, 3260, 6710, 9553, 4187, 7727, 8763, 4078, 4197, 8498, 2032, 2590, 1406, 5369, 6280, 8045, 4939, 275, 7826, 934, 619, 718, 8591, 5935, 5449, 1548, 8651, 6032, 3724, 3698, 2993, 909, 324, 6038, 2030, 6489, 2211, 411, 9589, 4327, 4510, 1758, 8136, 8954, 5598, 8982, 5252, 4587, 6323, 4111, 632, 8261, 5231, 3514, 8820, 115, 5921, 8382, 4640, 1400, 6539, 5025, 894, 8938, 9009, 5407, 1082, 2857, 9867, 5565, 7828, 2424, 4117, 9040, 5335, 7712, 7058, 780, 3399, 9276, 1, 2329, 7871, 2299, 7446, 6956, 5630, 2346, 2763, 43, 1154, 5684, 702, 8014, 17, 6972, 9685, 4222, 6630, 1676, 4554, 2780, 5113, 1976, 9619, 2071, 7265, 4605, 2248, 1624, 9754, 5250, 2521, 4044, 8433, 4258, 5638, 4326, 7908, 3492, 6126, 5071, 9212, 1413, 4941, 7202, 4722, 6061, 5160, 3724, 8866, 6328, 3239, 156, 1330, 4005, 4320, 5228, 3476, 351, 7122, 513, 6197, 7423, 4235, 8360, 1076, 8191, 5730, 5097, 5042, 7461, 4007, 3610, 4822, 6992, 6592, 3036, 9165, 7645, 3581, 8613, 408, 4446 };
+struct point pts_45[] = { { .x = 0, .y = 2 }, { .x = 14, .y = 83 }, { .x = 70, .y = 50 }, { .x = 37, .y = 51 }, { .x = 77, .y = 78 }, { .x = 74, .y = 72 }, { .x = 41, .y = 94 }, { .x = 47, .y = 8 }, { .x = 59, .y = 36 }, { .x = 32, .y = 21 }, { .x = 34, .y = 39 }, { .x = 28, .y = 17 }, { .x = 82, .y = 47 }, { .x = 74, .y = 69 }, { .x = 40, .y = 27 }, { .x = 7, .y = 89 }, { .x = 83, .y = 23 }, { .x = 45, .y = 71 }, { .x = 75, .y = 32 }, { .x = 2, .y = 63 }, { .x = 8, .y = 67 }, { .x = 87, .y = 72 }, { .x = 76, .y = 37 }, { .x = 80, .y = 44 }, { .x = 60, .y = 32 }, { .x = 22, .y = 98 }, { .x = 39, .y = 53 }, { .x = 35, .y = 51 }, { .x = 88, .y = 62 }, { .x = 28, .y = 43 }, { .x = 20, .y = 56 }, { .x = 1, .y = 7 }, { .x = 76, .y = 49 }, { .x = 58, .y = 81 }, { .x = 44, .y = 83 }, { .x = 1, .y = 64 }, { .x = 51, .y = 92 }, { .x = 10, .y = 83 }, { .x = 44, .y = 77 }, { .x = 89, .y = 12 } };
+long init_46[] = { 6460, 8880, 3142, 9078, 8723, 1612, 6107, 7396, 8918, 4853, 5920, 2821, 2192, 8969, 5552, 5135, 6411, 9447, 6696, 2814, 8008, 1438, 3335, 1912, 7843, 219, 9600, 5346, 8296, 2532, 1131, 4961, 3549, 1684, 3773, 752, 8774, 4333, 6108, 1732, 7787, 3990, 9610, 1397, 3501, 9803, 9745, 1870, 9321, 2506, 798, 1303, 8536, 7887, 6615, 2494, 8193, 5317, 6315, 2670, 6539, 7844, 6139, 9936, 1027, 4594, 5217, 566, 2389, 8128, 4317, 2107, 1536, 9861, 5917, 6843, 6754, 2539, 3022, 8783, 5293, 5916, 1614, 9849, 1675, 8318, 2158, 8757, 3127, 2515, 8757, 9663, 571, 516, 9037, 6772, 3926, 3963, 9465, 5963, 806, 3053, 6496, 4967, 2014, 8285, 5225, 2457, 7200, 1631, 5927, 1139, 5623, 7890, 7205, 5128, 9820, 3633, 964, 5722, 355, 889, 7219, 9561, 6542, 7184, 1631, 2321, 9577, 6953, 3657, 6377, 4982, 1820, 8827, 1081, 6847, 8727, 2598, 3998, 5243, 5149, 4980, 4900, 6990, 7484, 6558, 5068, 213, 4649, 9093, 3580, 7540, 1553, 2707, 2516, 4650, 3254, 5459, 5481, 1195, 9978, 6534, 9454, 5111, 6238, 6428, 6889, 8700, 5767, 3179, 6297, 2412, 7619, 1323, 9802, 9077, 6195, 3425, 5219, 9362, 394, 3389, 9555, 1760, 7312, 9190, 4605, 2982, 415, 774, 1536, 9629, 8435, 7238, 5379, 4756, 4618, 5060, 9603 };
+struct point pts_46[] = { { .x = 89, .y = 19 }, { .x = 69, .y = 96 }, { .x = 26, .y = 75 }, { .x = 58, .y = 89 }, { .x = 86, .y = 13 }, { .x = 94, .y = 56 }, { .x = 35, .y = 38 }, { .x = 46, .y = 40 }, { .x = 74, .y = 69 }, { .x = 13, .y = 20 }, { .x = 51, .y = 38 }, { .x = 28, .y = 56 }, { .x = 48, .y = 62 }, { .x = 55, .y = 18 }, { .x = 49, .y = 60 }, { .x = 57, .y = 69 }, { .x = 56, .y = 62 }, { .x = 82, .y = 62 }, { .x = 5, .y = 40 }, { .x = 98, .y = 62 }, { .x = 24, .y = 23 }, { .x = 24, .y = 70 }, { .x = 67, .y = 9 }, { .x = 70, .y = 93 }, { .x = 20, .y = 45 }, { .x = 91, .y = 54 }, { .x = 35, .y = 76 }, { .x = 62, .y = 1 }, { .x = 87, .y = 66 }, { .x = 99, .y = 79 }, { .x = 85, .y = 57 }, { .x = 74, .y = 56 }, { .x = 81, .y = 29 }, { .x = 25, .y = 61 }, { .x = 99, .y = 48 }, { .x = 75, .y = 0 }, { .x = 42, .y = 22 }, { .x = 1, .y = 91 }, { .x = 79, .y = 25 }, { .x = 61, .y = 46 } };
+long init_47[] = { 2019, 786, 5925, 3440, 9617, 7816, 8903, 1619, 6518, 5300, 6479, 5816, 331, 4466, 5386, 5201, 1463, 4798, 1306, 3764, 8075, 4502, 5824, 5566, 5193, 3017, 5722, 986, 2562, 5706, 244, 5464, 4136, 4109, 1104, 8192, 2971, 381, 9275, 6894, 1578, 3760, 6487, 2894, 1183, 5357, 7148, 4055, 40, 9761, 7911, 2277, 6708, 3171, 6019, 8625, 8286, 406, 6737, 2541, 7795, 8598, 5221, 9577, 2666, 7148, 7633, 6310, 3677, 4656, 7397, 7974, 3699, 3378, 6837, 6514, 5173, 7688, 6206, 3699, 5459, 5723, 713, 1913, 8865, 5143, 4406, 2145, 4599, 2801, 230, 2898, 8388, 6641, 4368, 6732, 4247, 8864, 8082, 9165, 8100, 6855, 5997, 5003, 1884, 4732, 9367, 5693, 8282, 5413, 3894, 7484, 2575, 9782, 2899, 1675, 4241, 5542, 7843, 4851, 8728, 8776, 5419, 7832, 2116, 4112, 4585, 8836, 416, 7482, 9682, 4023, 9487, 2535, 9831, 7797, 6783, 2334, 33, 3444, 8450, 6851, 4085, 9286, 1121, 4730, 3311, 3618, 2276, 8073, 5240, 3109, 1606, 6577, 315, 4336, 1297, 2074, 2945, 7166, 9691, 5026, 5312, 5955, 9879, 9343, 7945, 9225, 7811, 3992, 4860, 5045, 2941, 4470, 3065, 9099, 3813, 9542, 7460, 1879, 5949, 9650, 1957, 4848, 3723, 8928, 1072, 6316, 8089, 9379, 9967, 8155, 3165, 7742, 7429, 4400, 1470, 2601, 2493, 3380 };
+struct point pts_47[] = { { .x = 97, .y = 53 }, { .x = 63, .y = 32 }, { .x = 19, .y = 62 }, { .x = 96, .y = 73 }, { .x = 54, .y = 54 }, { .x = 12, .y = 27 }, { .x = 65, .y = 69 }, { .x = 31, .y = 98 }, { .x = 55, .y = 8 }, { .x = 76, .y = 20 }, { .x = 92, .y = 92 }, { .x = 75, .y = 35 }, { .x = 83, .y = 3 }, { .x = 44, .y = 16 }, { .x = 57, .y = 15 }, { .x = 70, .y = 75 }, { .x = 27, .y = 28 }, { .x = 72, .y = 36 }, { .x = 50, .y = 94 }, { .x = 57, .y = 63 }, { .x = 83, .y = 13 }, { .x = 22, .y = 57 }, { .x = 63, .y = 40 }, { .x = 69, .y = 84 }, { .x = 63, .y = 55 }, { .x = 82, .y = 56 }, { .x = 49, .y = 45 }, { .x = 89, .y = 26 }, { .x = 25, .y = 88 }, { .x = 77, .y = 47 }, { .x = 35, .y = 4 }, { .x = 84, .y = 37 }, { .x = 27, .y = 67 }, { .x = 73, .y = 83 }, { .x = 65, .y = 17 }, { .x = 96, .y = 31 }, { .x = 16, .y = 43 }, { .x = 49, .y = 21 }, { .x = 70, .y = 19 }, { .x = 34, .y = 37 } };
+long init_48[] = { 9764, 1668, 7432, 7068, 1173, 4002, 7610, 3388, 5001, 1757, 7219, 4513, 4452, 7040, 2052, 9408, 9956, 6365, 4105, 4147, 4097, 4977, 4989, 8697, 8325, 7622, 2296, 140, 3873, 7739, 4426, 4861, 1303, 4439, 9596, 5867, 4638, 5254, 9622, 2612, 8065, 5491, 9298, 9100, 6197, 7762, 6342, 9195, 6462, 6021, 9451, 6002, 7159, 9207, 8073, 814, 2123, 6981, 3686, 3602, 3520, 6561, 4626, 4923, 8862, 9873, 1170, 1691, 2724, 5345, 9452, 8203, 5942, 9308, 4757, 923, 3535, 1807, 9583, 4517, 6131, 2617, 9961, 2483, 572, 3394, 4959, 6427, 8698, 4210, 4391, 7500, 2919, 5054, 3097, 6576, 1003, 4131, 8191, 8537, 5475, 1525, 1911, 4435, 7883, 5822, 8493, 4616, 6552, 7681, 2052, 4583, 279, 6885, 4645, 4633, 4848, 4030, 5628, 3872, 3866, 6194, 1152, 6594, 6104, 7834, 128, 7025, 9987, 3815, 1909, 2782, 9876, 3999, 4292, 4054, 7451, 3704, 2268, 5958, 8961, 34, 5378, 743, 5294, 4517, 7422, 1169, 7918, 3091, 97, 4922, 5764, 2877, 5238, 2149, 7358, 5686, 73, 9595, 8211, 9219, 2791, 2634, 391, 1439, 1531, 9242, 4298, 3702, 3603, 5733, 2914, 3832, 4367, 1308, 5837, 6294, 8883, 1233, 7041, 9608, 7104, 4293, 6307, 3756, 5987, 7280, 7222, 7721, 405, 316, 9891, 6499, 7935, 411, 3016, 7413, 2046, 7590 };
+struct point pts_48[] = { { .x = 60, .y = 15 }, { .x = 82, .y = 47 }, { .x = 54, .y = 40 }, { .x = 91, .y = 2 }, { .x = 17, .y = 4 }, { .x = 15, .y = 51 }, { .x = 67, .y = 95 }, { .x = 40, .y = 44 }, { .x = 18, .y = 64 }, { .x = 73, .y = 63 }, { .x = 43, .y = 2 }, { .x = 59, .y = 23 }, { .x = 4, .y = 23 }, { .x = 11, .y = 96 }, { .x = 54, .y = 39 }, { .x = 40, .y = 34 }, { .x = 31, .y = 37 }, { .x = 94, .y = 72 }, { .x = 93, .y = 37 }, { .x = 60, .y = 64 }, { .x = 70, .y = 35 }, { .x = 87, .y = 90 }, { .x = 31, .y = 22 }, { .x = 66, .y = 41 }, { .x = 60, .y = 70 }, { .x = 38, .y = 61 }, { .x = 40, .y = 25 }, { .x = 8, .y = 16 }, { .x = 1, .y = 55 }, { .x = 47, .y = 50 }, { .x = 41, .y = 3 }, { .x = 85, .y = 39 }, { .x = 58, .y = 73 }, { .x = 60, .y = 9 }, { .x = 43, .y = 75 }, { .x = 27, .y = 72 }, { .x = 61, .y = 22 }, { .x = 58, .y = 71 }, { .x = 19, .y = 82 }, { .x = 91, .y = 78 } };
+long init_49[] = { 741, 751, 8773, 3080, 1723, 5609, 233, 6154, 6383, 2777, 3936, 36, 7855, 7120, 3509, 3087, 4285, 4792, 4542, 2244, 565, 5616, 9463, 4403, 1412, 347, 2320, 1263, 6702, 3471, 4863, 7611, 517, 7747, 6649, 9979, 3785, 6727, 1349, 8767, 5109, 8575, 3960, 1975, 8732, 4903, 9162, 6768, 3017, 6716, 4820, 1399, 889, 8473, 2686, 6546, 3660, 8368, 5461, 8865, 9826, 8804, 8978, 2134, 9839, 6495, 3763, 3068, 8513, 5997, 9507, 3337, 6260, 9635, 1550, 3207, 5881, 2252, 1764, 1110, 511, 2755, 6370, 1179, 8653, 4895, 658, 5019, 8944, 6434, 609, 940, 8243, 9913, 5800, 7352, 8035, 1164, 3916, 5269, 9249, 1988, 6276, 212, 4178, 250, 2705, 4401, 9587, 6946, 2293, 2191, 5988, 8683, 2616, 4323, 1090, 3345, 8185, 2530, 472, 2104, 9841, 9805, 863, 5074, 6082, 8417, 1857, 9071, 9958, 740, 5459, 541, 9264, 6863, 5192, 5219, 8440, 5206, 9326, 2905, 6977, 6388, 8496, 7801, 4507, 930, 1801, 2070, 5634, 3036, 7746, 7407, 9090, 5908, 3020, 4117, 7829, 5200, 5301, 777, 3190, 6343, 9509, 9768, 2241, 5968, 3208, 6078, 2740, 6971, 9525, 2063, 4375, 7756, 6194, 5309, 3385, 4403, 2325, 3082, 6484, 6655, 7495, 1295, 8414, 5951, 9264, 7461, 8435, 3157, 6753, 5144, 6708, 7537, 6452, 2599, 6814, 3031 };
+struct point pts_49[] = { { .x = 31, .y = 16 }, { .x = 71, .y = 11 }, { .x = 20, .y = 19 }, { .x = 73, .y = 70 }, { .x = 88, .y = 29 }, { .x = 39, .y = 97 }, { .x = 20, .y = 67 }, { .x = 36, .y = 78 }, { .x = 9, .y = 3 }, { .x = 6, .y = 56 }, { .x = 46, .y = 85 }, { .x = 91, .y = 50 }, { .x = 70, .y = 86 }, { .x = 66, .y = 31 }, { .x = 57, .y = 83 }, { .x = 94, .y = 81 }, { .x = 59, .y = 80 }, { .x = 65, .y = 50 }, { .x = 72, .y = 47 }, { .x = 86, .y = 33 }, { .x = 0, .y = 89 }, { .x = 0, .y = 49 }, { .x = 6, .y = 91 }, { .x = 18, .y = 66 }, { .x = 75, .y = 80 }, { .x = 24, .y = 60 }, { .x = 77, .y = 77 }, { .x = 37, .y = 94 }, { .x = 20, .y = 89 }, { .x = 48, .y = 22 }, { .x = 65, .y = 14 }, { .x = 94, .y = 31 }, { .x = 94, .y = 90 }, { .x = 97, .y = 1 }, { .x = 60, .y = 8 }, { .x = 82, .y = 46 }, { .x = 39, .y = 32 }, { .x = 80, .y = 56 }, { .x = 81, .y = 57 }, { .x = 3, .y = 59 } };
+long init_50[] = { 8967, 7527, 7683, 1603, 2686, 9551, 3437, 5271, 3757, 7719, 1698, 992, 7326, 6875, 7572, 2097, 2940, 910, 1244, 5351, 551, 5002, 5729, 6763, 8503, 9843, 3537, 2341, 1743, 525, 4839, 9047, 8076, 6461, 9033, 4331, 5521, 65, 5745, 9004, 9089, 693, 8751, 8084, 6439, 365, 6356, 1666, 36, 6396, 3365, 7723, 3962, 7135, 9763, 6121, 273, 4841, 4312, 308, 4036, 7673, 6196, 7903, 2099, 7217, 2684, 3168, 2346, 4367, 9942, 3832, 5280, 3880, 3654, 2651, 7435, 6045, 3367, 3504, 1928, 1455, 6161, 8264, 2329, 9818, 412, 2819, 3256, 2418, 1122, 4897, 6310, 2630, 7594, 1444, 4106, 8664, 1151, 8918, 9394, 5067, 3759, 3909, 5062, 991, 705, 1062, 3868, 3065, 3067, 9712, 1527, 5897, 5599, 6925, 5396, 729, 9667, 7489, 9889, 878, 1481, 9539, 2873, 5006, 6820, 7819, 9942, 7760, 1348, 3920, 587, 4749, 1556, 1725, 9216, 7409, 7440, 51, 7281, 4611, 4037, 536, 3222, 2755, 2010, 1349, 8757, 5339, 5701, 9880, 7926, 2507, 5972, 9496, 8013, 4958, 6895, 5197, 6671, 6962, 4586, 9941, 6381, 6859, 6776, 7065, 7072, 9468, 7198, 4270, 418, 5839, 3955, 290, 6715, 6110, 766, 5088, 1237, 5022, 2990, 5398, 3365, 2886, 8908, 8642, 3097, 3720, 1000, 676, 4212, 6506, 422, 9936, 9023, 717, 4761, 5118 };
+struct point pts_50[] = { { .x = 21, .y = 95 }, { .x = 24, .y = 6 }, { .x = 62, .y = 29 }, { .x = 18, .y = 46 }, { .x = 9, .y = 53 }, { .x = 16, .y = 95 }, { .x = 59, .y = 50 }, { .x = 46, .y = 70 }, { .x = 64, .y = 45 }, { .x = 16, .y = 68 }, { .x = 7, .y = 16 }, { .x = 66, .y = 98 }, { .x = 60, .y = 11 }, { .x = 66, .y = 45 }, { .x = 94, .y = 30 }, { .x = 35, .y = 16 }, { .x = 66, .y = 6 }, { .x = 16, .y = 22 }, { .x = 14, .y = 20 }, { .x = 36, .y = 4 }, { .x = 10, .y = 41 }, { .x = 80, .y = 62 }, { .x = 14, .y = 28 }, { .x = 70, .y = 32 }, { .x = 84, .y = 29 }, { .x = 42, .y = 36 }, { .x = 20, .y = 30 }, { .x = 92, .y = 82 }, { .x = 18, .y = 94 }, { .x = 28, .y = 18 }, { .x = 20, .y = 10 }, { .x = 61, .y = 67 }, { .x = 30, .y = 20 }, { .x = 45, .y = 73 }, { .x = 75, .y = 42 }, { .x = 88, .y = 93 }, { .x = 9, .y = 75 }, { .x = 24, .y = 59 }, { .x = 86, .y = 35 }, { .x = 17, .y = 44 } };
+long init_51[] = { 2610, 8323, 2211, 273, 5779, 7984, 460, 7982, 1299, 478, 2327, 5393, 4781, 1747, 6545, 1729, 9150, 7199, 8503, 5719, 2474, 9622, 4005, 1732, 7557, 9776, 4160, 7124, 2352, 7544, 5097, 8079, 8979, 3981, 5515, 9672, 6377, 6262, 1846, 3926, 2035, 7049, 4968, 8230, 5815, 2845, 1177, 4308, 1579, 3699, 8735, 3974, 6372, 7394, 1045, 5448, 5043, 7780, 7861, 8756, 6608, 913, 6671, 7468, 5390, 9830, 5628, 3556, 1850, 9905, 1614, 1886, 6204, 195, 1813, 1341, 697, 4234, 9535, 5890, 6443, 4265, 9915, 4863, 773, 1781, 5311, 2237, 9927, 8486, 4815, 3381, 3539, 6575, 8946, 1867, 3399, 3014, 2486, 700, 3411, 647, 259, 9004, 5953, 2213, 6333, 8401, 7895, 9559, 2162, 4277, 4211, 1842, 3304, 2838, 9819, 9425, 8264, 6353, 2169, 3761, 1062, 9316, 6869, 6624, 7448, 6839, 394, 8638, 87, 2571, 814, 285, 8396, 6109, 4415, 4087, 4078, 274, 2850, 2388, 5093, 3199, 3574, 3133, 2885, 1375, 8833, 5381, 9520, 9694, 9013, 2397, 9873, 339, 9792, 4053, 7900, 2368, 4104, 5700, 9880, 6669, 1130, 2267, 849, 70, 5207, 4243, 1178, 35, 6696, 3141, 1652, 5840, 3892, 636, 314, 1814, 5815, 2318, 9289, 831, 7176, 2968, 8762, 1400, 9877, 8144, 7747, 5339, 2507, 3329, 6253, 5060, 7602, 1569, 2853, 2598 };
+struct point pts_51[] = { { .x = 39, .y = 24 }, { .x = 99, .y = 67 }, { .x = 48, .y = 77 }, { .x = 47, .y = 33 }, { .x = 57, .y = 13 }, { .x = 26, .y = 82 }, { .x = 3, .y = 93 }, { .x = 97, .y = 30 }, { .x = 66, .y = 83 }, { .x = 9, .y = 65 }, { .x = 65, .y = 4 }, { .x = 17, .y = 61 }, { .x = 51, .y = 10 }, { .x = 69, .y = 62 }, { .x = 47, .y = 58 }, { .x = 42, .y = 55 }, { .x = 61, .y = 53 }, { .x = 12, .y = 65 }, { .x = 32, .y = 65 }, { .x = 55, .y = 59 }, { .x = 26, .y = 73 }, { .x = 9, .y = 70 }, { .x = 21, .y = 98 }, { .x = 34, .y = 54 }, { .x = 87, .y = 53 }, { .x = 52, .y = 55 }, { .x = 64, .y = 74 }, { .x = 72, .y = 72 }, { .x = 20, .y = 9 }, { .x = 77, .y = 15 }, { .x = 78, .y = 77 }, { .x = 56, .y = 19 }, { .x = 47, .y = 46 }, { .x = 12, .y = 52 }, { .x = 90, .y = 2 }, { .x = 26, .y = 2 }, { .x = 93, .y = 7 }, { .x = 83, .y = 32 }, { .x = 84, .y = 99 }, { .x = 6, .y = 7 } };
+long init_52[] = { 9605, 7416, 8558, 4777, 1630, 5590, 7976, 3372, 8246, 776, 9008, 5457, 9529, 9902, 5432, 5286, 8770, 5610, 7580, 4980, 9064, 2818, 6191, 5823, 5638, 6022, 37, 2291, 8202, 2176, 5804, 6196, 4147, 8146, 2854, 6860, 1616, 1962, 6987, 7943, 1116, 4420, 7280, 9622, 4138, 6107, 7751, 3032, 7017, 3797, 4736, 1717, 9826, 6961, 8638, 6288, 4584, 3183, 6138, 3176, 7736, 2210, 3661, 3603, 5326, 2371, 3556, 9802, 5323, 7773, 8509, 376, 2119, 9972, 2482, 9961, 3712, 1270, 9435, 4449, 7505, 7575, 9984, 5112, 3500, 250, 3094, 8631, 3048, 7963, 2813, 5224, 9650, 1888, 3236, 1426, 1418, 2995, 6989, 8465, 5793, 9989, 9993, 8741, 1923, 8795, 5387, 6264, 4572, 6268, 2300, 100, 8603, 8808, 7664, 8576, 3369, 7077, 3984, 7884, 268, 5688, 2228, 9321, 5980, 8990, 4299, 3001, 4245, 3734, 9300, 6377, 2073, 1909, 4065, 6333, 9041, 43, 7861, 6556, 2563, 4428, 3787, 8815, 9972, 8065, 3488, 9391, 8709, 5685, 4386, 460, 8026, 9533, 438, 5287, 5666, 8128, 7933, 8123, 7667, 2718, 4364, 6051, 6889, 2024, 9135, 5734, 4325, 5769, 1722, 272, 9500, 3015, 8767, 704, 4544, 8009, 8639, 8311, 3849, 2808, 1265, 5578, 1867, 3634, 9885, 4936, 5786, 1857, 7559, 3003, 9164, 7818, 8867, 7184, 6502, 4724, 1312, 6239 };
+struct point pts_52[] = { { .x = 36, .y = 81 }, { .x = 44, .y = 93 }, { .x = 25, .y = 57 }, { .x = 20, .y = 84 }, { .x = 25, .y = 76 }, { .x = 62, .y = 24 }, { .x = 90, .y = 54 }, { .x = 81, .y = 38 }, { .x = 95, .y = 1 }, { .x = 50, .y = 83 }, { .x = 37, .y = 83 }, { .x = 1, .y = 80 }, { .x = 8, .y = 95 }, { .x = 34, .y = 1 }, { .x = 86, .y = 7 }, { .x = 94, .y = 90 }, { .x = 48, .y = 98 }, { .x = 44, .y = 49 }, { .x = 15, .y = 99 }, { .x = 97, .y = 23 }, { .x = 24, .y = 86 }, { .x = 59, .y = 48 }, { .x = 33, .y = 21 }, { .x = 68, .y = 62 }, { .x = 49, .y = 27 }, { .x = 84, .y = 66 }, { .x = 54, .y = 4 }, { .x = 92, .y = 35 }, { .x = 54, .y = 71 }, { .x = 68, .y = 63 }, { .x = 25, .y = 14 }, { .x = 95, .y = 73 }, { .x = 18, .y = 35 }, { .x = 83, .y = 17 }, { .x = 95, .y = 66 }, { .x = 56, .y = 74 }, { .x = 1, .y = 65 }, { .x = 62, .y = 63 }, { .x = 68, .y = 71 }, { .x = 74, .y = 64 } };
+long init_53[] = { 9704, 2577, 2345, 1756, 9292, 5750, 8150, 7197, 2944, 7472, 2371, 1237, 3865, 713, 8827, 1034, 9745, 7122, 1975, 6640, 5461, 8131, 8264, 2518, 399, 6940, 7546, 2860, 5194, 7932, 3513, 1700, 9611, 6274, 9603, 9616, 4183, 4846, 7017, 8300, 8193, 6594, 422, 9375, 7056, 605, 4672, 6298, 621, 7735, 830, 702, 525, 7923, 8124, 6967, 3389, 9329, 1195, 8315, 76, 2653, 2438, 4151, 2443, 6814, 7623, 6152, 4044, 1130, 6053, 742, 2238, 9033, 3454, 569, 7463, 3114, 1442, 518, 361, 3354, 8342, 6105, 6752, 6485, 7590, 397, 9014, 2274, 647, 5539, 6812, 4608, 5930, 8203, 5118, 1695, 7563, 1060, 7910, 1402, 7990, 6074, 7475, 3608, 4726, 3456, 7844, 6337, 4381, 5903, 4560, 2448, 1967, 5641, 8893, 5809, 6035, 3961, 5155, 2910, 5700, 9650, 7806, 9529, 498, 8374, 982, 1643, 5302, 163, 4420, 9732, 5822, 5184, 2380, 2837, 1440, 5024, 1546, 8192, 73, 66, 7956, 5211, 1447, 8479, 7689, 8337, 5489, 7542, 2008, 9910, 3535, 5571, 7252, 7068, 7818, 520, 3698, 8589, 6736, 8051, 6080, 1271, 1478, 1149, 1478, 5764, 426, 8291, 5361, 603, 1810, 8335, 4926, 159, 3034, 250, 7013, 5476, 7311, 6704, 9142, 157, 1733, 1847, 630, 1083, 9486, 4902, 3888, 6475, 6706, 121, 4648, 1279, 9385, 8508 };
+struct point pts_53[] = { { .x = 51, .y = 64 }, { .x = 39, .y = 37 }, { .x = 81, .y = 27 }, { .x = 66, .y = 6 }, { .x = 11, .y = 86 }, { .x = 42, .y = 6 }, { .x = 91, .y = 20 }, { .x = 65, .y = 1 }, { .x = 42, .y = 67 }, { .x = 82, .y = 8 }, { .x = 44, .y = 12 }, { .x = 56, .y = 12 }, { .x = 41, .y = 53 }, { .x = 10, .y = 71 }, { .x = 32, .y = 33 }, { .x = 37, .y = 47 }, { .x = 84, .y = 92 }, { .x = 80, .y = 99 }, { .x = 35, .y = 3 }, { .x = 68, .y = 26 }, { .x = 4, .y = 19 }, { .x = 99, .y = 38 }, { .x = 41, .y = 32 }, { .x = 80, .y = 37 }, { .x = 15, .y = 60 }, { .x = 70, .y = 90 }, { .x = 53, .y = 41 }, { .x = 35, .y = 58 }, { .x = 8, .y = 14 }, { .x = 6, .y = 11 }, { .x = 10, .y = 27 }, { .x = 77, .y = 56 }, { .x = 95, .y = 54 }, { .x = 2, .y = 63 }, { .x = 13, .y = 53 }, { .x = 0, .y = 15 }, { .x = 79, .y = 84 }, { .x = 5, .y = 86 }, { .x = 48, .y = 7 }, { .x = 33, .y = 45 } };
+long init_54[] = { 443, 6608, 9250, 5477, 8903, 1046, 2742, 9768, 5716, 955, 4762, 6501, 1952, 1261, 9775, 3721, 6673, 6618, 9543, 5127, 4631, 9785, 270, 5521, 3833, 5662, 8060, 1518, 7085, 4508, 8196, 7105, 8540, 2316, 3997, 7616, 755, 2023, 2877, 5820, 760, 1379, 5123, 6184, 9996, 6990, 3604, 8256, 6698, 5392, 577, 8721, 8260, 7674, 2681, 4757, 2418, 4106, 5990, 3616, 2941, 860, 8661, 8968, 3986, 9168, 3325, 7354, 3454, 5898, 3618, 9858, 3741, 2190, 5176, 5924, 4116, 6719, 3601, 9637, 7630, 2316, 980, 8578, 9139, 6955, 7466, 993, 7495, 9633, 4569, 90, 9518, 5574, 6841, 2000, 9035, 2132, 1280, 4282, 694, 9312, 8348, 2017, 3929, 7354, 4570, 8886, 8016, 1482, 9861, 5021, 2852, 7665, 4948, 2216, 8827, 9747, 5451, 5285, 4497, 1086, 34, 2164, 4017, 4415, 8206, 3660, 7500, 1962, 93, 8557, 7363, 5976, 9962, 4113, 8690, 6383, 9426, 4717, 5229, 7648, 7171, 7292, 7385, 9323, 7133, 1441, 372, 2915, 2462, 3649, 2489, 8654, 3678, 5570, 3929, 8827, 3316, 7996, 2192, 5749, 2550, 1577, 8664, 6846, 6272, 1985, 1536, 3359, 1995, 3023, 6354, 8607, 4653, 8279, 9340, 5756, 8678, 450, 1356, 9790, 8105, 6053, 98, 4352, 4121, 4496, 8801, 9682, 3018, 4186, 8350, 5763, 2260, 4621, 9885, 7709, 5735, 8886 };
+struct point pts_54[] = { { .x = 11, .y = 47 }, { .x = 97, .y = 13 }, { .x = 98, .y = 29 }, { .x = 35, .y = 7 }, { .x = 6, .y = 11 }, { .x = 60, .y = 21 }, { .x = 34, .y = 66 }, { .x = 76, .y = 7 }, { .x = 46, .y = 80 }, { .x = 89, .y = 32 }, { .x = 57, .y = 50 }, { .x = 63, .y = 28 }, { .x = 70, .y = 39 }, { .x = 15, .y = 55 }, { .x = 72, .y = 7 }, { .x = 31, .y = 47 }, { .x = 75, .y = 42 }, { .x = 33, .y = 10 }, { .x = 98, .y = 57 }, { .x = 86, .y = 81 }, { .x = 5, .y = 56 }, { .x = 24, .y = 53 }, { .x = 45, .y = 49 }, { .x = 83, .y = 74 }, { .x = 39, .y = 48 }, { .x = 68, .y = 15 }, { .x = 3, .y = 84 }, { .x = 26, .y = 81 }, { .x = 90, .y = 47 }, { .x = 83, .y = 75 }, { .x = 4, .y = 67 }, { .x = 56, .y = 26 }, { .x = 25, .y = 15 }, { .x = 12, .y = 27 }, { .x = 76, .y = 10 }, { .x = 5, .y = 13 }, { .x = 43, .y = 64 }, { .x = 63, .y = 46 }, { .x = 75, .y = 27 }, { .x = 98, .y = 53 } };
+long init_55[] = { 9270, 2693, 2713, 8560, 496, 7149, 4862, 7154, 383, 1772, 4994, 8548, 5648, 7875, 119, 6884, 5569, 8597, 9059, 8951, 4976, 5206, 273, 605, 6251, 5162, 154, 8039, 1285, 5356, 3198, 6145, 9739, 1569, 806, 2942, 4479, 1160, 5555, 8226, 537, 7887, 8682, 3472, 5465, 9288, 9454, 2772, 855, 3082, 9534, 7799, 55, 8157, 939, 7510, 5555, 2223, 7582, 7723, 4067, 9591, 6875, 6882, 8162, 6821, 2232, 5233, 650, 6517, 2099, 2347, 1889, 6416, 3063, 5106, 2336, 9160, 1927, 2627, 8776, 9434, 1220, 6056, 9601, 6251, 9922, 2683, 1374, 7576, 4908, 4916, 2822, 2720, 5714, 8317, 6463, 5356, 6225, 5813, 5360, 5541, 7571, 9379, 1601, 9856, 3525, 2293, 6507, 9107, 7760, 582, 7781, 4551, 6099, 7471, 7218, 9765, 4018, 6732, 6543, 2806, 3726, 9998, 804, 9757, 6173, 8589, 5045, 2517, 5263, 7372, 1975, 9277, 4348, 8305, 9271, 4657, 8816, 4641, 8740, 3306, 148, 8930, 2068, 3575, 1138, 8918, 1849, 5534, 9800, 1327, 2116, 2023, 2379, 8601, 2137, 6386, 1040, 823, 2409, 6322, 3476, 5333, 9927, 666, 7300, 5189, 1965, 3987, 7571, 5042, 1920, 9986, 3775, 6723, 5710, 3862, 2167, 2253, 1262, 9768, 4162, 4329, 9702, 4132, 7638, 7825, 2429, 5236, 3914, 6079, 9629, 8395, 1592, 1701, 1393, 3238, 3737, 879 };
+struct point pts_55[] = { { .x = 86, .y = 33 }, { .x = 33, .y = 71 }, { .x = 28, .y = 84 }, { .x = 96, .y = 86 }, { .x = 91, .y = 26 }, { .x = 61, .y = 72 }, { .x = 27, .y = 7 }, { .x = 88, .y = 28 }, { .x = 64, .y = 45 }, { .x = 69, .y = 76 }, { .x = 64, .y = 55 }, { .x = 76, .y = 99 }, { .x = 84, .y = 55 }, { .x = 72, .y = 80 }, { .x = 96, .y = 49 }, { .x = 92, .y = 69 }, { .x = 61, .y = 64 }, { .x = 95, .y = 30 }, { .x = 62, .y = 0 }, { .x = 60, .y = 38 }, { .x = 9, .y = 74 }, { .x = 8, .y = 14 }, { .x = 92, .y = 16 }, { .x = 78, .y = 24 }, { .x = 36, .y = 40 }, { .x = 8, .y = 13 }, { .x = 68, .y = 22 }, { .x = 57, .y = 13 }, { .x = 38, .y = 66 }, { .x = 21, .y = 41 }, { .x = 38, .y = 16 }, { .x = 7, .y = 23 }, { .x = 19, .y = 16 }, { .x = 59, .y = 56 }, { .x = 72, .y = 24 }, { .x = 33, .y = 71 }, { .x = 95, .y = 2 }, { .x = 66, .y = 58 }, { .x = 32, .y = 24 }, { .x = 40, .y = 47 } };
+long init_56[] = { 5449, 4738, 4195, 9235, 2263, 6977, 6387, 1746, 4774, 8282, 7843, 3529, 3351, 6577, 3343, 7823, 6078, 7421, 9093, 1140, 6259, 3466, 4538, 2170, 4562, 5496, 1853, 5677, 1190, 6478, 6752, 4003, 5827, 3029, 5062, 1769, 6098, 3034, 345, 1134, 9157, 3638, 83, 3188, 7192, 6228, 3654, 3937, 7521, 6997, 7663, 9699, 4874, 3885, 7712, 5945, 8516, 4202, 2426, 7260, 4597, 531, 9848, 9566, 590, 5184, 8396, 4540, 9343, 7530, 7953, 3019, 3961, 7040, 4348, 4987, 9325, 976, 8920, 9004, 2156, 2480, 626, 9665, 4049, 5993, 3716, 8078, 4320, 1447, 3660, 3422, 8272, 2558, 4541, 6726, 1358, 6060, 8495, 5309, 3532, 4007, 2511, 787, 6939, 1325, 1340, 2442, 8201, 7925, 9739, 9452, 4829, 6037, 1532, 2361, 8916, 7133, 3916, 7583, 4174, 3739, 8114, 5371, 6427, 6155, 493, 6383, 6234, 5672, 8875, 92, 6633, 7711, 9076, 6453, 9710, 9543, 2853, 613, 7830, 4393, 5809, 7409, 1980, 8326, 2423, 3974, 1062, 3726, 6976, 7294, 8363, 4221, 6830, 3385, 234, 8344, 8267, 6727, 3927, 3168, 1663, 7881, 1611, 8692, 8463, 3423, 1120, 9431, 2675, 5397, 1332, 8114, 7287, 3814, 8336, 3089, 8616, 4931, 8601, 844, 5067, 1260, 2391, 2082, 1724, 6580, 9580, 6276, 3446, 8802, 8421, 2668, 4023, 8156, 8154, 4946, 674, 1508 };
+struct point pts_56[] = { { .x = 67, .y = 99 }, { .x = 65, .y = 73 }, { .x = 65, .y = 73 }, { .x = 61, .y = 52 }, { .x = 68, .y = 80 }, { .x = 55, .y = 57 }, { .x = 77, .y = 47 }, { .x = 17, .y = 99 }, { .x = 32, .y = 19 }, { .x = 80, .y = 35 }, { .x = 5, .y = 83 }, { .x = 4, .y = 57 }, { .x = 44, .y = 54 }, { .x = 10, .y = 80 }, { .x = 95, .y = 13 }, { .x = 79, .y = 36 }, { .x = 10, .y = 55 }, { .x = 85, .y = 96 }, { .x = 68, .y = 34 }, { .x = 12, .y = 90 }, { .x = 62, .y = 9 }, { .x = 90, .y = 67 }, { .x = 50, .y = 81 }, { .x = 65, .y = 41 }, { .x = 48, .y = 11 }, { .x = 69, .y = 67 }, { .x = 9, .y = 25 }, { .x = 66, .y = 93 }, { .x = 83, .y = 67 }, { .x = 82, .y = 50 }, { .x = 62, .y = 38 }, { .x = 0, .y = 96 }, { .x = 5, .y = 71 }, { .x = 97, .y = 29 }, { .x = 21, .y = 78 }, { .x = 49, .y = 20 }, { .x = 16, .y = 80 }, { .x = 78, .y = 84 }, { .x = 22, .y = 87 }, { .x = 51, .y = 60 } };
+long init_57[] = { 1461, 8616, 5568, 2144, 9219, 1068, 8041, 874, 9715, 578, 1720, 1710, 9376, 6565, 957, 4230, 2986, 5776, 2470, 7071, 5638, 5892, 7424, 5168, 6231, 6212, 1451, 3923, 178, 204, 6675, 6668, 8265, 5464, 6437, 6013, 6349, 4868, 704, 6167, 8486, 7637, 2339, 2172, 8856, 8389, 3124, 8182, 5103, 7464, 1642, 7325, 760, 8632, 4082, 5070, 7487, 4063, 3330, 7510, 5695, 4920, 7219, 5500, 2546, 2748, 6260, 7113, 1203, 7723, 506, 5114, 6113, 5182, 5432, 9704, 2918, 7881, 6920, 5268, 9620, 2312, 5540, 5498, 3641, 1589, 4425, 9775, 1882, 789, 8264, 311, 6404, 3033, 2701, 9761, 5971, 4923, 9123, 3683, 149, 770, 8136, 3371, 1289, 6015, 4669, 4517, 4231, 8067, 3865, 9938, 9932, 9294, 4648, 8134, 1385, 1972, 6090, 5370, 3353, 7031, 5943, 7308, 35, 3199, 8492, 4110, 4710, 1623, 7009, 3703, 3408, 3391, 6675, 3902, 6554, 551, 9279, 6818, 3815, 5475, 6969, 5921, 2893, 2775, 7777, 2499, 9354, 2070, 2477, 757, 6517, 3933, 5369, 522, 6003, 9218, 975, 6541, 4605, 5154, 9618, 7403, 9022, 167, 7430, 2535, 1114, 1717, 3952, 2745, 5203, 4667, 8515, 5707, 9269, 6569, 6104, 4755, 2178, 6787, 1276, 1172, 4454, 3839, 3052, 9027, 4147, 4686, 5186, 6893, 8977, 2890, 9543, 8464, 2840, 3171, 8424, 2622 };
+struct point pts_57[] = { { .x = 8, .y = 43 }, { .x = 35, .y = 12 }, { .x = 70, .y = 5 }, { .x = 58, .y = 44 }, { .x = 77, .y = 48 }, { .x = 3, .y = 28 }, { .x = 31, .y = 40 }, { .x = 16, .y = 60 }, { .x = 44, .y = 96 }, { .x = 21, .y = 93 }, { .x = 32, .y = 78 }, { .x = 56, .y = 64 }, { .x = 34, .y = 76 }, { .x = 38, .y = 99 }, { .x = 91, .y = 97 }, { .x = 56, .y = 53 }, { .x = 22, .y = 79 }, { .x = 57, .y = 19 }, { .x = 25, .y = 3 }, { .x = 89, .y = 68 }, { .x = 53, .y = 3 }, { .x = 88, .y = 73 }, { .x = 96, .y = 42 }, { .x = 19, .y = 2 }, { .x = 53, .y = 97 }, { .x = 36, .y = 19 }, { .x = 37, .y = 33 }, { .x = 93, .y = 77 }, { .x = 13, .y = 0 }, { .x = 50, .y = 56 }, { .x = 52, .y = 81 }, { .x = 83, .y = 66 }, { .x = 5, .y = 80 }, { .x = 71, .y = 47 }, { .x = 4, .y = 73 }, { .x = 32, .y = 52 }, { .x = 83, .y = 10 }, { .x = 30, .y = 87 }, { .x = 46, .y = 30 }, { .x = 65, .y = 82 } };
+long init_58[] = { 4187, 8321, 5100, 5493, 1966, 3862, 2870, 3011, 9468, 6021, 2818, 1991, 3162, 544, 9318, 8003, 2230, 3976, 954, 7925, 6340, 3019, 1171, 6380, 4264, 1910, 9526, 1707, 431, 2854, 2673, 9893, 7158, 3074, 6744, 2055, 4000, 6062, 6782, 7430, 7462, 2364, 507, 4640, 9563, 5045, 703, 6221, 8908, 814, 5201, 3286, 4295, 8839, 1290, 945, 8829, 2911, 319, 7693, 8141, 712, 8316, 2557, 7786, 8005, 7339, 1615, 1975, 3683, 3819, 8482, 3347, 9337, 8491, 3170, 4922, 2366, 8720, 5591, 4146, 4944, 1095, 4020, 1282, 8402, 8882, 8225, 1937, 4467, 6423, 4642, 2043, 4212, 6522, 4113, 9146, 3264, 7194, 7184, 7451, 9490, 34, 3165, 6240, 7458, 7342, 5889, 6933, 4315, 841, 9515, 9492, 5103, 457, 8721, 2888, 1208, 7701, 3157, 3546, 1162, 9635, 4212, 1970, 4350, 3816, 6515, 2064, 823, 9225, 4805, 6881, 6406, 2614, 391, 3668, 7267, 9783, 7060, 1122, 3137, 3789, 259, 8876, 1449, 4119, 3290, 1557, 8748, 110, 693, 1077, 3494, 9023, 2848, 5881, 5729, 6651, 2675, 3851, 5816, 9521, 11, 3429, 4557, 6500, 1018, 2942, 5942, 2161, 3243, 3139, 3243, 8328, 9518, 3296, 6622, 3716, 6474, 3965, 2719, 5590, 1513, 8010, 640, 4943, 785, 4892, 9512, 3384, 431, 9775, 4112, 2464, 6779, 8531, 1028, 2772, 9799 };
+struct point pts_58[] = { { .x = 95, .y = 9 }, { .x = 80, .y = 85 }, { .x = 58, .y = 78 }, { .x = 81, .y = 17 }, { .x = 44, .y = 3 }, { .x = 51, .y = 33 }, { .x = 74, .y = 44 }, { .x = 34, .y = 4 }, { .x = 77, .y = 80 }, { .x = 24, .y = 46 }, { .x = 41, .y = 87 }, { .x = 99, .y = 48 }, { .x = 33, .y = 87 }, { .x = 54, .y = 36 }, { .x = 27, .y = 78 }, { .x = 38, .y = 28 }, { .x = 3, .y = 89 }, { .x = 81, .y = 51 }, { .x = 96, .y = 78 }, { .x = 28, .y = 83 }, { .x = 32, .y = 74 }, { .x = 33, .y = 84 }, { .x = 29, .y = 82 }, { .x = 42, .y = 73 }, { .x = 4, .y = 68 }, { .x = 27, .y = 74 }, { .x = 26, .y = 3 }, { .x = 31, .y = 68 }, { .x = 34, .y = 60 }, { .x = 41, .y = 38 }, { .x = 73, .y = 76 }, { .x = 38, .y = 92 }, { .x = 14, .y = 0 }, { .x = 97, .y = 89 }, { .x = 12, .y = 5 }, { .x = 12, .y = 10 }, { .x = 44, .y = 80 }, { .x = 17, .y = 91 }, { .x = 52, .y = 4 }, { .x = 8, .y = 78 } };
+long init_59[] = { 7764, 2460, 4256, 2881, 6783, 6005, 2280, 5290, 7498, 9938, 2667, 1766, 7405, 1, 6484, 471, 2033, 5923, 1757, 6561, 8580, 8741, 4450, 5863, 3648, 9059, 9070, 6900, 7774, 2502, 7623, 6680, 6068, 3702, 4104, 2317, 7056, 5018, 4670, 1784, 3662, 7262, 3915, 8811, 9342, 3046, 4830, 7558, 2168, 8378, 711, 244, 8805, 1546, 9561, 2020, 4680, 2001, 7474, 1218, 4193, 5608, 8824, 5838, 8067, 2704, 3452, 7752, 4808, 7715, 8414, 4648, 1837, 1813, 5171, 3993, 5536, 7818, 4914, 9999, 8009, 9125, 5153, 9036, 5975, 4037, 4897, 245, 2635, 3367, 2276, 7699, 8596, 6291, 4391, 3210, 1212, 1629, 8898, 1591, 3409, 9928, 4323, 8893, 960, 4868, 8841, 6748, 5723, 2666, 1713, 3789, 5807, 8909, 7130, 304, 6038, 4407, 8433, 2633, 8957, 9582, 6804, 870, 1882, 9425, 8483, 6027, 5387, 1141, 6310, 7129, 5853, 3731, 5105, 8365, 1028, 1758, 222, 6687, 6353, 2584, 3644, 587, 4949, 5202, 58, 3375, 4562, 5512, 4500, 8470, 8628, 9859, 8106, 2529, 8614, 3775, 2700, 7595, 4148, 8816, 7095, 8747, 966, 1554, 539, 7855, 9050, 9173, 8850, 3237, 9905, 3916, 9302, 8995, 9176, 8403, 8326, 8141, 589, 7220, 1810, 2925, 7307, 2204, 9797, 7228, 224, 1856, 6389, 9081, 36, 9942, 2509, 9192, 4216, 144, 2527, 4923 };
+struct point pts_59[] = { { .x = 50, .y = 68 }, { .x = 52, .y = 13 }, { .x = 87, .y = 6 }, { .x = 5, .y = 36 }, { .x = 9, .y = 54 }, { .x = 13, .y = 55 }, { .x = 35, .y = 74 }, { .x = 72, .y = 97 }, { .x = 94, .y = 7 }, { .x = 72, .y = 57 }, { .x = 98, .y = 22 }, { .x = 48, .y = 68 }, { .x = 30, .y = 81 }, { .x = 96, .y = 20 }, { .x = 27, .y = 6 }, { .x = 23, .y = 36 }, { .x = 12, .y = 51 }, { .x = 90, .y = 59 }, { .x = 44, .y = 76 }, { .x = 19, .y = 78 }, { .x = 40, .y = 96 }, { .x = 16, .y = 5 }, { .x = 50, .y = 75 }, { .x = 29, .y = 71 }, { .x = 66, .y = 79 }, { .x = 37, .y = 10 }, { .x = 50, .y = 36 }, { .x = 74, .y = 12 }, { .x = 92, .y = 85 }, { .x = 29, .y = 89 }, { .x = 85, .y = 35 }, { .x = 94, .y = 69 }, { .x = 63, .y = 67 }, { .x = 90, .y = 50 }, { .x = 80, .y = 40 }, { .x = 69, .y = 30 }, { .x = 64, .y = 53 }, { .x = 95, .y = 59 }, { .x = 49, .y = 72 }, { .x = 73, .y = 22 } };
@@ -0,0 +1,3182 @@
+static char (*handler0)(int, const char *);
+static const unsigned long long *const v1 = 0, w1 = 88;
+static const char (*handler2)(int, unsigned int *);
+long table3[29][7] = { { 71, 10 } };
+enum { E4_0 = 0, E4_1 = 4, E4_2 = 8, E4_3 = 12, E4_4 = 16, E4_5 = 20, E4_6 = 24 } e4;
+struct s5 {
+    const char f0;
+    unsigned long long f1;
+    const char **f2;
+    signed char *f3;
+} s5_default, *s5_list;
+static const unsigned int *const v6 = 0, w6 = 8;
+static const signed char *const v7 = 0, w7 = 42;
+static const short *const v8 = 0, w8 = 0;
+enum { E9_0 = 0, E9_1 = 4, E9_2 = 8, E9_3 = 12, E9_4 = 16, E9_5 = 20, E9_6 = 24 } e9;
+extern short proto10(unsigned int arg0, double *arg1, signed char *arg2, long *arg3, signed char arg4);
+short table11[16][5] = { { 87, 79 } };
+static const unsigned int *const v12 = 0, w12 = 80;
+long table13[55][6] = { { 68, 86 } };
+enum { E14_0 = 0, E14_1 = 4, E14_2 = 8, E14_3 = 12, E14_4 = 16, E14_5 = 20, E14_6 = 24, E14_7 = 28, E14_8 = 32 } e14;
+short table15[39][2] = { { 47, 97 } };
+int table16[1][4] = { { 1, 75 } };
+static const short *const v17 = 0, w17 = 60;
+static const float *const v18 = 0, w18 = 28;
+enum { E19_0 = 0, E19_1 = 4, E19_2 = 8 } e19;
+enum { E20_0 = 0, E20_1 = 4, E20_2 = 8, E20_3 = 12, E20_4 = 16, E20_5 = 20 } e20;
+static unsigned long long (*handler21)(int, const char *);
+struct s22 {
+    float f0;
+    unsigned int **f1;
+    unsigned long long **f2;
+    char **f3;
+    short *f4;
+    signed char *f5;
+    short *f6;
+} s22_default, *s22_list;
+struct s23 {
+    unsigned int *f0;
+    int f1;
+    unsigned int *f2;
+    signed char f3;
+    char *f4;
+} s23_default, *s23_list;
+extern float proto24(float *arg0, unsigned int *arg1, long *arg2, unsigned long long arg3, unsigned int arg4);
+enum { E25_0 = 0, E25_1 = 4, E25_2 = 8, E25_3 = 12 } e25;
+struct s26 {
+    int *f0;
+    const char f1;
+    long **f2;
+} s26_default, *s26_list;
+struct s27 {
+    signed char **f0;
+    char **f1;
+    signed char f2;
+} s27_default, *s27_list;
+enum { E28_0 = 0, E28_1 = 4, E28_2 = 8, E28_3 = 12, E28_4 = 16, E28_5 = 20, E28_6 = 24, E28_7 = 28, E28_8 = 32 } e28;
+static short (*handler29)(int, const char *);
+int table30[29][8] = { { 3, 66 } };
+long table31[43][5] = { { 41, 5 } };
+enum { E32_0 = 0, E32_1 = 4, E32_2 = 8, E32_3 = 12, E32_4 = 16, E32_5 = 20, E32_6 = 24, E32_7 = 28, E32_8 = 32, E32_9 = 36 } e32;
+static char (*handler33)(int, long *);
+struct s34 {
+    short **f0;
+    char **f1;
+    float f2;
+    unsigned int **f3;
+} s34_default, *s34_list;
+struct s35 {
+    unsigned int *f0;
+    double *f1;
+} s35_default, *s35_list;
+extern char proto36(signed char arg0, char arg1, signed char arg2, unsigned long long *arg3, unsigned long long arg4);
+long table37[24][3] = { { 14, 89 } };
+extern short proto38(void);
+static const char *const v39 = 0, w39 = 71;
+struct s40 {
+    long **f0;
+    short f1;
+    double *f2;
+    float f3;
+    float *f4;
+    double f5;
+    long f6;
+    const char **f7;
+} s40_default, *s40_list;
+enum { E41_0 = 0, E41_1 = 4 } e41;
+enum { E42_0 = 0, E42_1 = 4, E42_2 = 8, E42_3 = 12, E42_4 = 16 } e42;
+static char (*handler43)(int, double *);
+static const float *const v44 = 0, w44 = 71;
+struct s45 {
+    int *f0;
+    int f1;
+    unsigned int f2;
+} s45_default, *s45_list;
+enum { E46_0 = 0, E46_1 = 4, E46_2 = 8 } e46;
+static const double *const v47 = 0, w47 = 15;
+extern double proto48(long *arg0);
+static signed char (*handler49)(int, int *);
+struct s50 {
+    const char *f0;
+    signed char f1;
+} s50_default, *s50_list;
+struct s51 {
+    double **f0;
+    const char *f1;
+    unsigned int **f2;
+    double *f3;
+    unsigned long long *f4;
+} s51_default, *s51_list;
+static const float *const v52 = 0, w52 = 67;
+struct s53 {
+    unsigned int f0;
+    long **f1;
+    int *f2;
+    char *f3;
+    float **f4;
+    signed char *f5;
+    float **f6;
+    short **f7;
+} s53_default, *s53_list;
+enum { E54_0 = 0, E54_1 = 4, E54_2 = 8, E54_3 = 12 } e54;
+struct s55 {
+    unsigned long long *f0;
+    short *f1;
+    const char **f2;
+    const char *f3;
+    char *f4;
+    char *f5;
+} s55_default, *s55_list;
+enum { E56_0 = 0, E56_1 = 4, E56_2 = 8 } e56;
+struct s57 {
+    float **f0;
+    const char **f1;
+    short *f2;
+    double **f3;
+    int *f4;
+    unsigned long long f5;
+    signed char *f6;
+} s57_default, *s57_list;
+static const char (*handler58)(int, int *);
+extern unsigned long long proto59(unsigned long long *arg0);
+struct s60 {
+    const char f0;
+    unsigned int **f1;
+    short **f2;
+    short *f3;
+    float **f4;
+    signed char *f5;
+    double *f6;
+    double **f7;
+} s60_default, *s60_list;
+static const unsigned long long *const v61 = 0, w61 = 22;
+long table62[51][8] = { { 58, 96 } };
+static const const char *const v63 = 0, w63 = 35;
+extern signed char proto64(int *arg0, const char arg1, unsigned int arg2);
+long table65[59][2] = { { 44, 82 } };
+long table66[23][4] = { { 52, 63 } };
+extern unsigned long long proto67(void);
+extern signed char proto68(unsigned int *arg0, unsigned int *arg1, const char arg2, const char arg3);
+struct s69 {
+    unsigned int **f0;
+    char *f1;
+    unsigned int **f2;
+    long *f3;
+    short f4;
+} s69_default, *s69_list;
+short table70[18][3] = { { 36, 2 } };
+static const int *const v71 = 0, w71 = 32;
+static short (*handler72)(int, float *);
+static float (*handler73)(int, unsigned long long *);
+struct s74 {
+    unsigned long long *f0;
+    char **f1;
+    const char *f2;
+} s74_default, *s74_list;
+static const unsigned long long *const v75 = 0, w75 = 75;
+static signed char (*handler76)(int, double *);
+static unsigned long long (*handler77)(int, signed char *);
+static char (*handler78)(int, short *);
+short table79[45][8] = { { 84, 30 } };
+static const long *const v80 = 0, w80 = 65;
+static float (*handler81)(int, float *);
+extern signed char proto82(unsigned long long arg0, long *arg1, float arg2, char arg3);
+static const short *const v83 = 0, w83 = 66;
+static unsigned long long (*handler84)(int, char *);
+struct s85 {
+    unsigned int *f0;
+    double f1;
+    long f2;
+    int f3;
+} s85_default, *s85_list;
+struct s86 {
+    unsigned int **f0;
+    double *f1;
+    float *f2;
+    long f3;
+    float *f4;
+    signed char *f5;
+    float **f6;
+} s86_default, *s86_list;
+static const int *const v87 = 0, w87 = 91;
+short table88[63][5] = { { 96, 70 } };
+static const int *const v89 = 0, w89 = 66;
+struct s90 {
+    signed char *f0;
+    double **f1;
+    short f2;
+    short f3;
+} s90_default, *s90_list;
+static const char (*handler91)(int, unsigned int *);
+static const char *const v92 = 0, w92 = 84;
+static const char (*handler93)(int, float *);
+int table94[64][8] = { { 90, 14 } };
+static const unsigned long long *const v95 = 0, w95 = 21;
+static const double *const v96 = 0, w96 = 25;
+long table97[7][8] = { { 76, 99 } };
+extern long proto98(float arg0, int *arg1, const char *arg2, const char *arg3, signed char *arg4);
+long table99[57][4] = { { 21, 60 } };
+int table100[35][2] = { { 7, 30 } };
+struct s101 {
+    unsigned int **f0;
+    double f1;
+    double **f2;
+    double **f3;
+} s101_default, *s101_list;
+enum { E102_0 = 0, E102_1 = 4, E102_2 = 8, E102_3 = 12, E102_4 = 16, E102_5 = 20, E102_6 = 24, E102_7 = 28, E102_8 = 32, E102_9 = 36 } e102;
+long table103[52][2] = { { 93, 13 } };
+static signed char (*handler104)(int, signed char *);
+enum { E105_0 = 0, E105_1 = 4 } e105;
+enum { E106_0 = 0, E106_1 = 4, E106_2 = 8, E106_3 = 12, E106_4 = 16, E106_5 = 20, E106_6 = 24, E106_7 = 28 } e106;
+static float (*handler107)(int, const char *);
+extern char proto108(long *arg0, float *arg1, double *arg2, int *arg3);
+static double (*handler109)(int, signed char *);
+static unsigned int (*handler110)(int, char *);
+static signed char (*handler111)(int, long *);
+extern unsigned long long proto112(double arg0, char arg1, double arg2, const char *arg3);
+static const long *const v113 = 0, w113 = 0;
+static int (*handler114)(int, signed char *);
+struct s115 {
+    long **f0;
+    int **f1;
+    float f2;
+    short *f3;
+    signed char *f4;
+} s115_default, *s115_list;
+struct s116 {
+    signed char *f0;
+    long **f1;
+    unsigned long long *f2;
+    float **f3;
+    signed char f4;
+    float *f5;
+    int *f6;
+    float **f7;
+} s116_default, *s116_list;
+enum { E117_0 = 0, E117_1 = 4, E117_2 = 8 } e117;
+struct s118 {
+    unsigned int *f0;
+    unsigned long long *f1;
+    char *f2;
+    const char f3;
+    unsigned long long **f4;
+    double **f5;
+    float **f6;
+} s118_default, *s118_list;
+short table119[32][6] = { { 41, 68 } };
+int table120[30][4] = { { 10, 19 } };
+struct s121 {
+    char **f0;
+    const char f1;
+    int *f2;
+    signed char *f3;
+} s121_default, *s121_list;
+enum { E122_0 = 0, E122_1 = 4, E122_2 = 8, E122_3 = 12, E122_4 = 16, E122_5 = 20, E122_6 = 24, E122_7 = 28, E122_8 = 32, E122_9 = 36 } e122;
+struct s123 {
+    long *f0;
+    float *f1;
+    unsigned long long *f2;
+    unsigned int **f3;
+    char f4;
+    signed char f5;
+    short **f6;
+} s123_default, *s123_list;
+extern float proto124(void);
+static const int *const v125 = 0, w125 = 6;
+struct s126 {
+    unsigned long long f0;
+    float *f1;
+    int *f2;
+    unsigned long long **f3;
+    float *f4;
+    long f5;
+} s126_default, *s126_list;
+enum { E127_0 = 0, E127_1 = 4, E127_2 = 8, E127_3 = 12, E127_4 = 16, E127_5 = 20, E127_6 = 24 } e127;
+enum { E128_0 = 0, E128_1 = 4, E128_2 = 8, E128_3 = 12, E128_4 = 16, E128_5 = 20, E128_6 = 24, E128_7 = 28 } e128;
+static float (*handler129)(int, unsigned long long *);
+struct s130 {
+    float **f0;
+    long *f1;
+} s130_default, *s130_list;
+static const char *const v131 = 0, w131 = 69;
+short table132[41][8] = { { 65, 47 } };
+struct s133 {
+    short f0;
+    float **f1;
+    int f2;
+    signed char **f3;
+    unsigned int *f4;
+} s133_default, *s133_list;
+static long (*handler134)(int, unsigned long long *);
+extern const char proto135(void);
+extern signed char proto136(short *arg0, short *arg1, short *arg2, float *arg3);
+extern short proto137(short *arg0, long arg1, unsigned int arg2, short *arg3, signed char *arg4);
+extern double proto138(float *arg0, unsigned int arg1, unsigned long long *arg2);
+struct s139 {
+    unsigned int **f0;
+    const char **f1;
+    const char *f2;
+    double f3;
+    signed char *f4;
+    long **f5;
+    signed char *f6;
+    double *f7;
+} s139_default, *s139_list;
+struct s140 {
+    float f0;
+    long *f1;
+} s140_default, *s140_list;
+static unsigned int (*handler141)(int, float *);
+extern long proto142(short *arg0);
+static unsigned int (*handler143)(int, signed char *);
+static const long *const v144 = 0, w144 = 91;
+enum { E145_0 = 0, E145_1 = 4, E145_2 = 8, E145_3 = 12, E145_4 = 16, E145_5 = 20, E145_6 = 24, E145_7 = 28 } e145;
+static const double *const v146 = 0, w146 = 2;
+extern unsigned long long proto147(short arg0, double *arg1, float arg2);
+enum { E148_0 = 0, E148_1 = 4, E148_2 = 8 } e148;
+static const double *const v149 = 0, w149 = 82;
+extern const char proto150(double *arg0, float arg1, float arg2);
+short table151[37][7] = { { 19, 7 } };
+static const short *const v152 = 0, w152 = 24;
+static double (*handler153)(int, unsigned int *);
+static signed char (*handler154)(int, char *);
+extern const char proto155(float arg0, int arg1, const char *arg2, const char arg3, unsigned int arg4);
+static double (*handler156)(int, float *);
+extern int proto157(void);
+enum { E158_0 = 0, E158_1 = 4, E158_2 = 8 } e158;
+static const signed char *const v159 = 0, w159 = 19;
+struct s160 {
+    float **f0;
+    int f1;
+    const char *f2;
+    float f3;
+    long f4;
+    const char f5;
+} s160_default, *s160_list;
+static const long *const v161 = 0, w161 = 70;
+enum { E162_0 = 0, E162_1 = 4, E162_2 = 8, E162_3 = 12, E162_4 = 16, E162_5 = 20, E162_6 = 24, E162_7 = 28, E162_8 = 32, E162_9 = 36 } e162;
+long table163[51][2] = { { 89, 66 } };
+enum { E164_0 = 0, E164_1 = 4, E164_2 = 8, E164_3 = 12, E164_4 = 16, E164_5 = 20 } e164;
+short table165[16][2] = { { 1, 41 } };
+short table166[5][6] = { { 11, 67 } };
+struct s167 {
+    float **f0;
+    char **f1;
+    unsigned int **f2;
+    unsigned long long *f3;
+    const char f4;
+} s167_default, *s167_list;
+enum { E168_0 = 0, E168_1 = 4, E168_2 = 8, E168_3 = 12, E168_4 = 16 } e168;
+extern unsigned int proto169(char *arg0, double *arg1);
+long table170[48][4] = { { 71, 94 } };
+int table171[35][6] = { { 0, 65 } };
+static long (*handler172)(int, char *);
+extern int proto173(void);
+struct s174 {
+    signed char f0;
+    float *f1;
+    const char f2;
+    unsigned long long **f3;
+    long f4;
+    const char *f5;
+    short f6;
+    long **f7;
+} s174_default, *s174_list;
+static double (*handler175)(int, short *);
+static const double *const v176 = 0, w176 = 2;
+static const char *const v177 = 0, w177 = 66;
+short table178[45][4] = { { 13, 20 } };
+static const short *const v179 = 0, w179 = 5;
+static const char *const v180 = 0, w180 = 19;
+enum { E181_0 = 0, E181_1 = 4, E181_2 = 8 } e181;
+struct s182 {
+    float **f0;
+    unsigned int f1;
+    signed char *f2;
+} s182_default, *s182_list;
+static const unsigned long long *const v183 = 0, w183 = 50;
+int table184[19][6] = { { 22, 80 } };
+long table185[8][5] = { { 87, 7 } };
+static const signed char *const v186 = 0, w186 = 89;
+enum { E187_0 = 0, E187_1 = 4, E187_2 = 8, E187_3 = 12, E187_4 = 16 } e187;
+static float (*handler188)(int, const char *);
+enum { E189_0 = 0, E189_1 = 4, E189_2 = 8, E189_3 = 12 } e189;
+long table190[36][5] = { { 6, 16 } };
+static const char (*handler191)(int, float *);
+static char (*handler192)(int, short *);
+long table193[5][8] = { { 18, 34 } };
+static unsigned long long (*handler194)(int, const char *);
+struct s195 {
+    char f0;
+    short *f1;
+    float *f2;
+    signed char f3;
+} s195_default, *s195_list;
+struct s196 {
+    signed char *f0;
+    short **f1;
+    int **f2;
+    float *f3;
+    double f4;
+    int *f5;
+    long f6;
+} s196_default, *s196_list;
+struct s197 {
+    int **f0;
+    unsigned long long **f1;
+    unsigned int f2;
+    signed char **f3;
+    short f4;
+} s197_default, *s197_list;
+enum { E198_0 = 0, E198_1 = 4, E198_2 = 8, E198_3 = 12, E198_4 = 16, E198_5 = 20, E198_6 = 24 } e198;
+extern short proto199(const char arg0, int arg1, const char *arg2);
+static const float *const v200 = 0, w200 = 67;
+struct s201 {
+    signed char *f0;
+    unsigned long long **f1;
+    unsigned long long **f2;
+    float **f3;
+    unsigned long long f4;
+} s201_default, *s201_list;
+long table202[5][8] = { { 78, 91 } };
+extern const char proto203(float *arg0);
+struct s204 {
+    long **f0;
+    signed char **f1;
+    unsigned long long **f2;
+    short f3;
+    int f4;
+    int **f5;
+} s204_default, *s204_list;
+enum { E205_0 = 0, E205_1 = 4, E205_2 = 8, E205_3 = 12, E205_4 = 16, E205_5 = 20 } e205;
+static const char *const v206 = 0, w206 = 93;
+static const char *const v207 = 0, w207 = 21;
+static const char (*handler208)(int, unsigned long long *);
+int table209[55][5] = { { 90, 94 } };
+static unsigned int (*handler210)(int, char *);
+struct s211 {
+    unsigned long long **f0;
+    float f1;
+    short **f2;
+    unsigned long long *f3;
+} s211_default, *s211_list;
+static const char *const v212 = 0, w212 = 54;
+static const char (*handler213)(int, signed char *);
+static double (*handler214)(int, const char *);
+struct s215 {
+    unsigned int *f0;
+    float **f1;
+    int **f2;
+    double **f3;
+    unsigned int **f4;
+    short **f5;
+    unsigned int *f6;
+} s215_default, *s215_list;
+short table216[46][5] = { { 39, 83 } };
+enum { E217_0 = 0, E217_1 = 4, E217_2 = 8 } e217;
+enum { E218_0 = 0, E218_1 = 4 } e218;
+extern const char proto219(short arg0, long *arg1, long arg2);
+static const unsigned long long *const v220 = 0, w220 = 37;
+static double (*handler221)(int, signed char *);
+static short (*handler222)(int, char *);
+static const signed char *const v223 = 0, w223 = 83;
+long table224[14][5] = { { 68, 8 } };
+extern const char proto225(short *arg0, int arg1);
+struct s226 {
+    unsigned int **f0;
+    int f1;
+    unsigned int f2;
+    const char *f3;
+    double *f4;
+    unsigned int *f5;
+    float **f6;
+} s226_default, *s226_list;
+enum { E227_0 = 0, E227_1 = 4, E227_2 = 8, E227_3 = 12, E227_4 = 16, E227_5 = 20 } e227;
+static const signed char *const v228 = 0, w228 = 3;
+static float (*handler229)(int, const char *);
+static double (*handler230)(int, char *);
+enum { E231_0 = 0, E231_1 = 4, E231_2 = 8, E231_3 = 12, E231_4 = 16 } e231;
+enum { E232_0 = 0, E232_1 = 4, E232_2 = 8, E232_3 = 12 } e232;
+struct s233 {
+    short f0;
+    float **f1;
+} s233_default, *s233_list;
+static unsigned long long (*handler234)(int, const char *);
+extern const char proto235(const char *arg0, signed char *arg1, const char *arg2, unsigned int arg3, char arg4);
+extern unsigned int proto236(unsigned int *arg0, signed char arg1, float arg2, float arg3);
+extern char proto237(unsigned int *arg0, signed char arg1);
+long table238[24][3] = { { 67, 95 } };
+static const unsigned int *const v239 = 0, w239 = 34;
+static const int *const v240 = 0, w240 = 42;
+struct s241 {
+    double f0;
+    short **f1;
+    char **f2;
+    long **f3;
+    signed char **f4;
+    const char f5;
+    float *f6;
+} s241_default, *s241_list;
+extern unsigned long long proto242(short *arg0, const char *arg1, double *arg2, long *arg3, unsigned int arg4);
+static const char (*handler243)(int, double *);
+static const char *const v244 = 0, w244 = 17;
+static const long *const v245 = 0, w245 = 100;
+int table246[8][3] = { { 96, 22 } };
+struct s247 {
+    double *f0;
+    const char *f1;
+} s247_default, *s247_list;
+extern long proto248(void);
+static unsigned int (*handler249)(int, int *);
+enum { E250_0 = 0, E250_1 = 4, E250_2 = 8 } e250;
+struct s251 {
+    unsigned long long f0;
+    unsigned int *f1;
+    char f2;
+    float **f3;
+    char **f4;
+    char **f5;
+    double **f6;
+    signed char f7;
+} s251_default, *s251_list;
+static const double *const v252 = 0, w252 = 39;
+int table253[25][7] = { { 68, 72 } };
+static unsigned long long (*handler254)(int, long *);
+static const char *const v255 = 0, w255 = 93;
+extern double proto256(unsigned long long *arg0, short *arg1, char arg2);
+extern long proto257(char arg0, int arg1);
+static const double *const v258 = 0, w258 = 54;
+extern signed char proto259(double arg0, int *arg1, double arg2);
+static long (*handler260)(int, int *);
+struct s261 {
+    char f0;
+    const char **f1;
+    double f2;
+    const char f3;
+    char f4;
+    char *f5;
+} s261_default, *s261_list;
+enum { E262_0 = 0, E262_1 = 4 } e262;
+int table263[57][8] = { { 60, 67 } };
+enum { E264_0 = 0, E264_1 = 4, E264_2 = 8, E264_3 = 12, E264_4 = 16, E264_5 = 20 } e264;
+static const char (*handler265)(int, unsigned int *);
+enum { E266_0 = 0, E266_1 = 4, E266_2 = 8, E266_3 = 12, E266_4 = 16 } e266;
+static const signed char *const v267 = 0, w267 = 31;
+struct s268 {
+    float f0;
+    unsigned long long **f1;
+    char *f2;
+    double f3;
+    long **f4;
+    unsigned int *f5;
+    short *f6;
+} s268_default, *s268_list;
+struct s269 {
+    const char **f0;
+    signed char *f1;
+    float **f2;
+    double *f3;
+    char **f4;
+} s269_default, *s269_list;
+enum { E270_0 = 0, E270_1 = 4, E270_2 = 8, E270_3 = 12, E270_4 = 16, E270_5 = 20, E270_6 = 24, E270_7 = 28 } e270;
+enum { E271_0 = 0, E271_1 = 4, E271_2 = 8 } e271;
+static char (*handler272)(int, char *);
+short table273[50][6] = { { 85, 30 } };
+extern int proto274(unsigned int arg0, unsigned long long arg1, long arg2);
+static const double *const v275 = 0, w275 = 80;
+enum { E276_0 = 0, E276_1 = 4, E276_2 = 8, E276_3 = 12, E276_4 = 16, E276_5 = 20, E276_6 = 24 } e276;
+extern short proto277(void);
+extern char proto278(char *arg0, float *arg1, short arg2, short arg3);
+struct s279 {
+    long f0;
+    double *f1;
+    double *f2;
+    unsigned long long **f3;
+    int f4;
+    const char f5;
+    double **f6;
+    long *f7;
+} s279_default, *s279_list;
+extern float proto280(unsigned int *arg0, float *arg1);
+static const unsigned long long *const v281 = 0, w281 = 35;
+static double (*handler282)(int, float *);
+static const long *const v283 = 0, w283 = 60;
+static const short *const v284 = 0, w284 = 65;
+static const unsigned int *const v285 = 0, w285 = 75;
+long table286[25][5] = { { 36, 93 } };
+extern const char proto287(unsigned long long *arg0, const char *arg1, float *arg2, unsigned int *arg3);
+short table288[16][3] = { { 19, 64 } };
+enum { E289_0 = 0, E289_1 = 4, E289_2 = 8, E289_3 = 12, E289_4 = 16, E289_5 = 20 } e289;
+static unsigned long long (*handler290)(int, double *);
+struct s291 {
+    long *f0;
+    float *f1;
+    const char **f2;
+    long f3;
+    short **f4;
+} s291_default, *s291_list;
+enum { E292_0 = 0, E292_1 = 4, E292_2 = 8, E292_3 = 12, E292_4 = 16 } e292;
+static unsigned int (*handler293)(int, float *);
+struct s294 {
+    signed char *f0;
+    unsigned long long *f1;
+    signed char *f2;
+    signed char *f3;
+    long *f4;
+    const char **f5;
+} s294_default, *s294_list;
+extern float proto295(char arg0);
+struct s296 {
+    short **f0;
+    long **f1;
+    signed char f2;
+    signed char *f3;
+    char f4;
+    unsigned int f5;
+    long **f6;
+    unsigned int **f7;
+} s296_default, *s296_list;
+static const signed char *const v297 = 0, w297 = 26;
+struct s298 {
+    signed char f0;
+    double *f1;
+    unsigned long long *f2;
+    char **f3;
+    char f4;
+    short f5;
+} s298_default, *s298_list;
+static const char *const v299 = 0, w299 = 53;
+extern signed char proto300(const char arg0, signed char *arg1, unsigned int arg2, int *arg3);
+enum { E301_0 = 0, E301_1 = 4, E301_2 = 8, E301_3 = 12, E301_4 = 16, E301_5 = 20, E301_6 = 24, E301_7 = 28, E301_8 = 32, E301_9 = 36 } e301;
+short table302[36][5] = { { 54, 75 } };
+static const float *const v303 = 0, w303 = 83;
+extern unsigned long long proto304(char *arg0, signed char *arg1, char arg2);
+int table305[57][6] = { { 66, 76 } };
+extern unsigned int proto306(signed char *arg0);
+int table307[61][5] = { { 12, 93 } };
+extern unsigned long long proto308(short arg0, double *arg1);
+static char (*handler309)(int, const char *);
+extern unsigned int proto310(double arg0, double arg1, const char *arg2);
+long table311[49][5] = { { 92, 7 } };
+static const signed char *const v312 = 0, w312 = 5;
+struct s313 {
+    unsigned int **f0;
+    signed char **f1;
+    const char **f2;
+    double **f3;
+    float f4;
+    const char f5;
+    float *f6;
+    double **f7;
+} s313_default, *s313_list;
+static const int *const v314 = 0, w314 = 70;
+static const unsigned long long *const v315 = 0, w315 = 52;
+extern signed char proto316(double *arg0, double arg1, int *arg2, int *arg3);
+struct s317 {
+    signed char *f0;
+    float *f1;
+} s317_default, *s317_list;
+static const char (*handler318)(int, double *);
+static const char *const v319 = 0, w319 = 88;
+extern double proto320(int *arg0);
+extern char proto321(void);
+struct s322 {
+    const char f0;
+    signed char **f1;
+    double **f2;
+    char **f3;
+    signed char **f4;
+    unsigned long long f5;
+    const char f6;
+} s322_default, *s322_list;
+int table323[31][8] = { { 4, 14 } };
+static const int *const v324 = 0, w324 = 24;
+static long (*handler325)(int, const char *);
+struct s326 {
+    int *f0;
+    int f1;
+    char **f2;
+    char *f3;
+    unsigned long long *f4;
+    double *f5;
+    signed char f6;
+    int **f7;
+} s326_default, *s326_list;
+struct s327 {
+    char f0;
+    float **f1;
+    float f2;
+    double *f3;
+    char f4;
+    short **f5;
+    short *f6;
+    unsigned long long **f7;
+} s327_default, *s327_list;
+static float (*handler328)(int, double *);
+int table329[60][7] = { { 96, 54 } };
+static const int *const v330 = 0, w330 = 95;
+static char (*handler331)(int, short *);
+short table332[56][7] = { { 40, 61 } };
+static long (*handler333)(int, unsigned int *);
+long table334[46][2] = { { 96, 23 } };
+extern const char proto335(void);
+extern double proto336(unsigned long long arg0, char arg1);
+long table337[15][5] = { { 92, 17 } };
+extern short proto338(char arg0, const char *arg1);
+struct s339 {
+    char *f0;
+    int f1;
+} s339_default, *s339_list;
+struct s340 {
+    short f0;
+    float *f1;
+} s340_default, *s340_list;
+static const unsigned int *const v341 = 0, w341 = 16;
+enum { E342_0 = 0, E342_1 = 4, E342_2 = 8, E342_3 = 12, E342_4 = 16, E342_5 = 20, E342_6 = 24, E342_7 = 28 } e342;
+static signed char (*handler343)(int, float *);
+static const double *const v344 = 0, w344 = 93;
+long table345[44][4] = { { 73, 40 } };
+struct s346 {
+    signed char *f0;
+    double f1;
+    signed char *f2;
+    double **f3;
+    unsigned int f4;
+    const char f5;
+} s346_default, *s346_list;
+int table347[26][5] = { { 1, 75 } };
+struct s348 {
+    short **f0;
+    short **f1;
+    short f2;
+    long f3;
+    unsigned int f4;
+    double f5;
+} s348_default, *s348_list;
+extern const char proto349(void);
+struct s350 {
+    unsigned long long f0;
+    signed char *f1;
+    unsigned long long *f2;
+    int **f3;
+} s350_default, *s350_list;
+enum { E351_0 = 0, E351_1 = 4 } e351;
+int table352[51][4] = { { 22, 83 } };
+long table353[10][5] = { { 30, 47 } };
+extern double proto354(char *arg0, char *arg1);
+extern char proto355(long arg0);
+enum { E356_0 = 0, E356_1 = 4, E356_2 = 8, E356_3 = 12, E356_4 = 16 } e356;
+struct s357 {
+    char f0;
+    short *f1;
+} s357_default, *s357_list;
+struct s358 {
+    float *f0;
+    const char *f1;
+    int **f2;
+    unsigned long long *f3;
+    unsigned int f4;
+    unsigned int **f5;
+} s358_default, *s358_list;
+static const unsigned long long *const v359 = 0, w359 = 53;
+short table360[16][3] = { { 23, 68 } };
+struct s361 {
+    short f0;
+    unsigned long long *f1;
+} s361_default, *s361_list;
+extern unsigned int proto362(unsigned long long arg0, unsigned long long arg1, double arg2, const char arg3);
+struct s363 {
+    unsigned int f0;
+    int f1;
+    double f2;
+} s363_default, *s363_list;
+extern float proto364(double arg0, char *arg1);
+static const char *const v365 = 0, w365 = 66;
+enum { E366_0 = 0, E366_1 = 4, E366_2 = 8, E366_3 = 12, E366_4 = 16, E366_5 = 20, E366_6 = 24, E366_7 = 28, E366_8 = 32 } e366;
+static const short *const v367 = 0, w367 = 100;
+short table368[64][6] = { { 71, 78 } };
+static const signed char *const v369 = 0, w369 = 66;
+extern short proto370(long arg0, short arg1, signed char arg2, const char *arg3, double arg4);
+struct s371 {
+    signed char **f0;
+    double *f1;
+    const char *f2;
+    short f3;
+} s371_default, *s371_list;
+extern unsigned long long proto372(signed char *arg0, float arg1);
+static int (*handler373)(int, char *);
+extern unsigned long long proto374(const char *arg0);
+struct s375 {
+    int **f0;
+    char *f1;
+    char **f2;
+    int *f3;
+    int f4;
+} s375_default, *s375_list;
+static float (*handler376)(int, signed char *);
+short table377[61][7] = { { 8, 60 } };
+static const char (*handler378)(int, double *);
+struct s379 {
+    long *f0;
+    const char f1;
+    long f2;
+    float **f3;
+    float *f4;
+} s379_default, *s379_list;
+extern signed char proto380(double arg0, unsigned int *arg1, const char arg2);
+static const const char *const v381 = 0, w381 = 80;
+int table382[61][6] = { { 60, 6 } };
+extern double proto383(unsigned int *arg0, signed char arg1, float arg2, signed char *arg3, signed char arg4);
+extern const char proto384(signed char arg0, signed char *arg1, char *arg2, short arg3, float arg4);
+struct s385 {
+    short f0;
+    unsigned int **f1;
+    const char f2;
+    double **f3;
+    char **f4;
+} s385_default, *s385_list;
+static signed char (*handler386)(int, const char *);
+struct s387 {
+    unsigned int *f0;
+    const char *f1;
+} s387_default, *s387_list;
+enum { E388_0 = 0, E388_1 = 4, E388_2 = 8, E388_3 = 12, E388_4 = 16, E388_5 = 20, E388_6 = 24, E388_7 = 28, E388_8 = 32, E388_9 = 36 } e388;
+extern unsigned long long proto389(short *arg0, signed char *arg1, double *arg2);
+static char (*handler390)(int, unsigned int *);
+static const unsigned long long *const v391 = 0, w391 = 51;
+struct s392 {
+    float *f0;
+    int **f1;
+    int *f2;
+    char *f3;
+    float **f4;
+    char f5;
+} s392_default, *s392_list;
+static const const char *const v393 = 0, w393 = 26;
+struct s394 {
+    int *f0;
+    unsigned int *f1;
+    short *f2;
+    long *f3;
+    const char **f4;
+    unsigned int f5;
+    long *f6;
+} s394_default, *s394_list;
+static const double *const v395 = 0, w395 = 13;
+enum { E396_0 = 0, E396_1 = 4, E396_2 = 8 } e396;
+short table397[50][4] = { { 91, 78 } };
+struct s398 {
+    short **f0;
+    unsigned long long *f1;
+    double f2;
+    unsigned int **f3;
+} s398_default, *s398_list;
+extern signed char proto399(char arg0);
+enum { E400_0 = 0, E400_1 = 4, E400_2 = 8 } e400;
+extern int proto401(unsigned int arg0);
+struct s402 {
+    unsigned long long *f0;
+    char **f1;
+    char *f2;
+    char *f3;
+    unsigned long long **f4;
+} s402_default, *s402_list;
+struct s403 {
+    signed char *f0;
+    unsigned long long f1;
+} s403_default, *s403_list;
+enum { E404_0 = 0, E404_1 = 4, E404_2 = 8, E404_3 = 12, E404_4 = 16, E404_5 = 20, E404_6 = 24, E404_7 = 28, E404_8 = 32, E404_9 = 36 } e404;
+struct s405 {
+    float f0;
+    int f1;
+    long **f2;
+    float f3;
+    signed char **f4;
+} s405_default, *s405_list;
+enum { E406_0 = 0, E406_1 = 4, E406_2 = 8, E406_3 = 12, E406_4 = 16, E406_5 = 20 } e406;
+extern long proto407(float *arg0);
+struct s408 {
+    long f0;
+    long f1;
+    short **f2;
+    char **f3;
+} s408_default, *s408_list;
+struct s409 {
+    const char f0;
+    signed char *f1;
+    unsigned long long *f2;
+    unsigned int *f3;
+} s409_default, *s409_list;
+static unsigned long long (*handler410)(int, unsigned int *);
+struct s411 {
+    short *f0;
+    unsigned long long f1;
+    signed char f2;
+    signed char **f3;
+    long f4;
+    double *f5;
+} s411_default, *s411_list;
+enum { E412_0 = 0, E412_1 = 4, E412_2 = 8, E412_3 = 12 } e412;
+struct s413 {
+    double f0;
+    signed char f1;
+    short f2;
+} s413_default, *s413_list;
+enum { E414_0 = 0, E414_1 = 4 } e414;
+short table415[30][7] = { { 13, 57 } };
+enum { E416_0 = 0, E416_1 = 4, E416_2 = 8, E416_3 = 12, E416_4 = 16, E416_5 = 20, E416_6 = 24 } e416;
+extern char proto417(double arg0, double *arg1);
+static const char (*handler418)(int, const char *);
+static double (*handler419)(int, unsigned int *);
+long table420[25][3] = { { 14, 91 } };
+static const signed char *const v421 = 0, w421 = 16;
+struct s422 {
+    unsigned int **f0;
+    short *f1;
+    long f2;
+    char *f3;
+    long f4;
+    long f5;
+    double f6;
+    long f7;
+} s422_default, *s422_list;
+enum { E423_0 = 0, E423_1 = 4, E423_2 = 8, E423_3 = 12, E423_4 = 16, E423_5 = 20, E423_6 = 24, E423_7 = 28, E423_8 = 32, E423_9 = 36 } e423;
+enum { E424_0 = 0, E424_1 = 4, E424_2 = 8, E424_3 = 12, E424_4 = 16 } e424;
+short table425[46][7] = { { 41, 74 } };
+enum { E426_0 = 0, E426_1 = 4, E426_2 = 8 } e426;
+short table427[13][4] = { { 71, 31 } };
+long table428[46][5] = { { 36, 19 } };
+static unsigned long long (*handler429)(int, float *);
+enum { E430_0 = 0, E430_1 = 4, E430_2 = 8, E430_3 = 12, E430_4 = 16, E430_5 = 20, E430_6 = 24, E430_7 = 28 } e430;
+struct s431 {
+    float f0;
+    int **f1;
+    signed char **f2;
+    signed char **f3;
+    char **f4;
+    char **f5;
+    const char **f6;
+} s431_default, *s431_list;
+static const unsigned int *const v432 = 0, w432 = 41;
+static const const char *const v433 = 0, w433 = 49;
+short table434[24][8] = { { 88, 79 } };
+extern char proto435(void);
+extern signed char proto436(short arg0, unsigned long long *arg1, float *arg2);
+enum { E437_0 = 0, E437_1 = 4 } e437;
+struct s438 {
+    unsigned long long **f0;
+    int **f1;
+    float **f2;
+    int **f3;
+} s438_default, *s438_list;
+struct s439 {
+    const char f0;
+    short f1;
+} s439_default, *s439_list;
+enum { E440_0 = 0, E440_1 = 4 } e440;
+static const char *const v441 = 0, w441 = 76;
+long table442[54][7] = { { 73, 45 } };
+extern float proto443(short *arg0, int *arg1, int *arg2, double *arg3);
+static const float *const v444 = 0, w444 = 84;
+struct s445 {
+    unsigned int f0;
+    float **f1;
+    const char **f2;
+    const char *f3;
+    signed char f4;
+} s445_default, *s445_list;
+extern long proto446(int *arg0, unsigned int arg1, float *arg2, short arg3, double *arg4);
+static short (*handler447)(int, const char *);
+struct s448 {
+    short **f0;
+    unsigned int *f1;
+    short f2;
+    int **f3;
+    float **f4;
+} s448_default, *s448_list;
+int table449[35][7] = { { 11, 18 } };
+extern short proto450(float *arg0);
+struct s451 {
+    const char f0;
+    unsigned long long **f1;
+} s451_default, *s451_list;
+enum { E452_0 = 0, E452_1 = 4, E452_2 = 8, E452_3 = 12, E452_4 = 16 } e452;
+extern float proto453(void);
+enum { E454_0 = 0, E454_1 = 4, E454_2 = 8, E454_3 = 12, E454_4 = 16, E454_5 = 20, E454_6 = 24, E454_7 = 28, E454_8 = 32 } e454;
+short table455[4][3] = { { 60, 74 } };
+static char (*handler456)(int, unsigned int *);
+struct s457 {
+    long f0;
+    const char *f1;
+    float f2;
+    short *f3;
+} s457_default, *s457_list;
+short table458[5][4] = { { 51, 73 } };
+static const signed char *const v459 = 0, w459 = 48;
+extern double proto460(const char *arg0, char arg1, unsigned int *arg2);
+int table461[6][8] = { { 47, 71 } };
+static const int *const v462 = 0, w462 = 17;
+extern signed char proto463(double *arg0);
+static unsigned int (*handler464)(int, int *);
+static float (*handler465)(int, long *);
+extern signed char proto466(void);
+int table467[35][8] = { { 80, 15 } };
+extern unsigned int proto468(unsigned int arg0, char *arg1, signed char arg2, char *arg3, const char arg4);
+extern short proto469(unsigned int arg0);
+static const char *const v470 = 0, w470 = 86;
+struct s471 {
+    const char **f0;
+    const char f1;
+    unsigned int *f2;
+    const char **f3;
+    unsigned long long *f4;
+    unsigned long long f5;
+    int *f6;
+    float **f7;
+} s471_default, *s471_list;
+short table472[4][7] = { { 95, 30 } };
+static unsigned int (*handler473)(int, double *);
+static const char *const v474 = 0, w474 = 1;
+static const float *const v475 = 0, w475 = 94;
+static float (*handler476)(int, double *);
+struct s477 {
+    unsigned long long f0;
+    long f1;
+} s477_default, *s477_list;
+int table478[30][7] = { { 60, 36 } };
+short table479[13][7] = { { 82, 11 } };
+enum { E480_0 = 0, E480_1 = 4, E480_2 = 8 } e480;
+int table481[22][2] = { { 53, 7 } };
+static const long *const v482 = 0, w482 = 54;
+extern signed char proto483(float *arg0);
+static float (*handler484)(int, char *);
+static char (*handler485)(int, char *);
+short table486[4][3] = { { 24, 60 } };
+static const signed char *const v487 = 0, w487 = 29;
+static char (*handler488)(int, unsigned long long *);
+extern float proto489(double *arg0, const char arg1, unsigned int arg2);
+static const double *const v490 = 0, w490 = 50;
+extern char proto491(long arg0, double arg1, long *arg2, double arg3, unsigned long long arg4);
+enum { E492_0 = 0, E492_1 = 4, E492_2 = 8, E492_3 = 12, E492_4 = 16, E492_5 = 20 } e492;
+static long (*handler493)(int, long *);
+enum { E494_0 = 0, E494_1 = 4, E494_2 = 8 } e494;
+struct s495 {
+    int **f0;
+    double f1;
+    double *f2;
+    int f3;
+    unsigned int **f4;
+    signed char f5;
+    double **f6;
+} s495_default, *s495_list;
+static const unsigned int *const v496 = 0, w496 = 62;
+extern char proto497(unsigned int *arg0, int *arg1, int arg2);
+static const float *const v498 = 0, w498 = 71;
+extern short proto499(short *arg0, int *arg1, signed char arg2, signed char *arg3, char *arg4);
+static int (*handler500)(int, double *);
+struct s501 {
+    short f0;
+    float **f1;
+} s501_default, *s501_list;
+struct s502 {
+    signed char f0;
+    short f1;
+    char f2;
+} s502_default, *s502_list;
+static unsigned long long (*handler503)(int, long *);
+enum { E504_0 = 0, E504_1 = 4, E504_2 = 8 } e504;
+static const short *const v505 = 0, w505 = 63;
+struct s506 {
+    short f0;
+    double f1;
+    char **f2;
+    signed char *f3;
+    signed char f4;
+    const char **f5;
+} s506_default, *s506_list;
+enum { E507_0 = 0, E507_1 = 4, E507_2 = 8, E507_3 = 12, E507_4 = 16 } e507;
+static const long *const v508 = 0, w508 = 57;
+extern int proto509(signed char *arg0);
+static const double *const v510 = 0, w510 = 5;
+static unsigned long long (*handler511)(int, double *);
+struct s512 {
+    char **f0;
+    double **f1;
+    float **f2;
+    double *f3;
+    int f4;
+    signed char *f5;
+    long f6;
+} s512_default, *s512_list;
+int table513[26][3] = { { 93, 27 } };
+extern short proto514(const char arg0, unsigned long long arg1, int *arg2, signed char arg3, int *arg4);
+int table515[21][4] = { { 40, 66 } };
+int table516[63][8] = { { 69, 51 } };
+struct s517 {
+    unsigned long long **f0;
+    short *f1;
+    long *f2;
+    unsigned int f3;
+    char *f4;
+    float **f5;
+} s517_default, *s517_list;
+static unsigned long long (*handler518)(int, unsigned long long *);
+static const unsigned int *const v519 = 0, w519 = 73;
+short table520[14][3] = { { 67, 36 } };
+static const char (*handler521)(int, float *);
+static unsigned long long (*handler522)(int, const char *);
+extern float proto523(const char arg0, unsigned long long *arg1);
+long table524[36][4] = { { 59, 40 } };
+struct s525 {
+    const char *f0;
+    signed char f1;
+    const char *f2;
+    unsigned int *f3;
+    signed char *f4;
+    unsigned long long f5;
+    unsigned long long f6;
+    char **f7;
+} s525_default, *s525_list;
+int table526[13][6] = { { 37, 78 } };
+extern short proto527(long arg0, float arg1);
+enum { E528_0 = 0, E528_1 = 4, E528_2 = 8, E528_3 = 12, E528_4 = 16, E528_5 = 20, E528_6 = 24 } e528;
+enum { E529_0 = 0, E529_1 = 4 } e529;
+enum { E530_0 = 0, E530_1 = 4, E530_2 = 8, E530_3 = 12, E530_4 = 16, E530_5 = 20, E530_6 = 24 } e530;
+enum { E531_0 = 0, E531_1 = 4, E531_2 = 8, E531_3 = 12, E531_4 = 16, E531_5 = 20, E531_6 = 24, E531_7 = 28, E531_8 = 32, E531_9 = 36 } e531;
+static unsigned long long (*handler532)(int, double *);
+static signed char (*handler533)(int, unsigned long long *);
+static short (*handler534)(int, short *);
+long table535[49][5] = { { 98, 21 } };
+struct s536 {
+    int *f0;
+    signed char f1;
+    double *f2;
+    int **f3;
+    signed char *f4;
+    unsigned int *f5;
+    int **f6;
+    signed char **f7;
+} s536_default, *s536_list;
+long table537[10][4] = { { 90, 11 } };
+static const char (*handler538)(int, short *);
+enum { E539_0 = 0, E539_1 = 4, E539_2 = 8, E539_3 = 12, E539_4 = 16, E539_5 = 20, E539_6 = 24, E539_7 = 28, E539_8 = 32, E539_9 = 36 } e539;
+enum { E540_0 = 0, E540_1 = 4, E540_2 = 8 } e540;
+static char (*handler541)(int, float *);
+static const char *const v542 = 0, w542 = 28;
+long table543[58][8] = { { 84, 19 } };
+static float (*handler544)(int, float *);
+static unsigned long long (*handler545)(int, float *);
+long table546[47][3] = { { 58, 32 } };
+static const float *const v547 = 0, w547 = 61;
+enum { E548_0 = 0, E548_1 = 4, E548_2 = 8, E548_3 = 12, E548_4 = 16, E548_5 = 20, E548_6 = 24, E548_7 = 28, E548_8 = 32, E548_9 = 36 } e548;
+static const const char *const v549 = 0, w549 = 15;
+short table550[1][5] = { { 46, 46 } };
+extern float proto551(unsigned int arg0, short arg1, long *arg2, double arg3);
+extern short proto552(long arg0, short *arg1, long *arg2, char *arg3, float arg4);
+extern unsigned long long proto553(unsigned int *arg0, char arg1, signed char arg2, double arg3);
+static const char (*handler554)(int, const char *);
+long table555[30][8] = { { 1, 27 } };
+extern short proto556(int arg0, signed char arg1, unsigned long long arg2, float arg3);
+static const double *const v557 = 0, w557 = 98;
+extern unsigned long long proto558(signed char arg0);
+enum { E559_0 = 0, E559_1 = 4, E559_2 = 8, E559_3 = 12, E559_4 = 16, E559_5 = 20, E559_6 = 24, E559_7 = 28 } e559;
+struct s560 {
+    short **f0;
+    double f1;
+    long f2;
+    double f3;
+    unsigned int f4;
+} s560_default, *s560_list;
+enum { E561_0 = 0, E561_1 = 4 } e561;
+struct s562 {
+    short f0;
+    signed char f1;
+    char *f2;
+} s562_default, *s562_list;
+extern unsigned long long proto563(signed char arg0, signed char arg1);
+enum { E564_0 = 0, E564_1 = 4, E564_2 = 8, E564_3 = 12 } e564;
+extern long proto565(void);
+int table566[8][5] = { { 25, 76 } };
+struct s567 {
+    unsigned int f0;
+    unsigned int *f1;
+    int **f2;
+    unsigned int f3;
+    float f4;
+    float **f5;
+    unsigned long long **f6;
+    short f7;
+} s567_default, *s567_list;
+short table568[57][5] = { { 20, 37 } };
+extern unsigned long long proto569(float *arg0);
+int table570[43][8] = { { 38, 35 } };
+enum { E571_0 = 0, E571_1 = 4, E571_2 = 8, E571_3 = 12, E571_4 = 16, E571_5 = 20, E571_6 = 24, E571_7 = 28, E571_8 = 32, E571_9 = 36 } e571;
+extern unsigned long long proto572(void);
+static int (*handler573)(int, const char *);
+extern int proto574(const char arg0);
+static long (*handler575)(int, char *);
+struct s576 {
+    double f0;
+    const char *f1;
+    double **f2;
+    signed char *f3;
+    long **f4;
+} s576_default, *s576_list;
+int table577[44][6] = { { 96, 77 } };
+long table578[44][5] = { { 50, 64 } };
+static const int *const v579 = 0, w579 = 84;
+static const int *const v580 = 0, w580 = 36;
+static float (*handler581)(int, unsigned int *);
+struct s582 {
+    float f0;
+    char f1;
+    float **f2;
+    short *f3;
+    short *f4;
+} s582_default, *s582_list;
+enum { E583_0 = 0, E583_1 = 4, E583_2 = 8, E583_3 = 12, E583_4 = 16, E583_5 = 20, E583_6 = 24, E583_7 = 28, E583_8 = 32, E583_9 = 36 } e583;
+extern float proto584(unsigned long long *arg0, long arg1);
+static const int *const v585 = 0, w585 = 89;
+long table586[41][7] = { { 62, 63 } };
+short table587[16][4] = { { 61, 51 } };
+struct s588 {
+    int *f0;
+    unsigned int f1;
+    char f2;
+} s588_default, *s588_list;
+static unsigned long long (*handler589)(int, char *);
+struct s590 {
+    double **f0;
+    char f1;
+    double *f2;
+    signed char *f3;
+} s590_default, *s590_list;
+int table591[62][7] = { { 66, 52 } };
+long table592[10][7] = { { 65, 41 } };
+static char (*handler593)(int, short *);
+struct s594 {
+    const char *f0;
+    long f1;
+    long f2;
+    char **f3;
+    unsigned long long f4;
+    float *f5;
+} s594_default, *s594_list;
+struct s595 {
+    short **f0;
+    const char **f1;
+    double **f2;
+    int f3;
+    const char *f4;
+} s595_default, *s595_list;
+struct s596 {
+    long **f0;
+    const char *f1;
+    unsigned long long **f2;
+    short *f3;
+    const char **f4;
+    double *f5;
+    unsigned int **f6;
+    char f7;
+} s596_default, *s596_list;
+struct s597 {
+    int *f0;
+    unsigned int **f1;
+    short *f2;
+    int **f3;
+} s597_default, *s597_list;
+enum { E598_0 = 0, E598_1 = 4, E598_2 = 8, E598_3 = 12, E598_4 = 16, E598_5 = 20, E598_6 = 24, E598_7 = 28 } e598;
+short table599[14][6] = { { 33, 19 } };
+enum { E600_0 = 0, E600_1 = 4, E600_2 = 8, E600_3 = 12 } e600;
+static long (*handler601)(int, int *);
+extern short proto602(unsigned long long arg0, signed char *arg1);
+short table603[8][6] = { { 4, 10 } };
+static const char *const v604 = 0, w604 = 55;
+short table605[9][4] = { { 51, 81 } };
+static const float *const v606 = 0, w606 = 17;
+static double (*handler607)(int, signed char *);
+static unsigned int (*handler608)(int, signed char *);
+enum { E609_0 = 0, E609_1 = 4, E609_2 = 8, E609_3 = 12, E609_4 = 16, E609_5 = 20, E609_6 = 24 } e609;
+short table610[28][3] = { { 35, 9 } };
+extern unsigned long long proto611(const char arg0, long *arg1, int arg2, signed char *arg3);
+struct s612 {
+    unsigned int **f0;
+    short **f1;
+    int *f2;
+} s612_default, *s612_list;
+enum { E613_0 = 0, E613_1 = 4, E613_2 = 8, E613_3 = 12 } e613;
+static const signed char *const v614 = 0, w614 = 39;
+static float (*handler615)(int, int *);
+struct s616 {
+    short *f0;
+    unsigned long long *f1;
+    unsigned int *f2;
+    float f3;
+    char f4;
+    char f5;
+    short f6;
+} s616_default, *s616_list;
+long table617[25][3] = { { 70, 71 } };
+static double (*handler618)(int, double *);
+extern double proto619(char arg0, const char *arg1);
+static const char *const v620 = 0, w620 = 68;
+int table621[6][2] = { { 3, 36 } };
+static const unsigned long long *const v622 = 0, w622 = 98;
+static double (*handler623)(int, const char *);
+static const int *const v624 = 0, w624 = 47;
+enum { E625_0 = 0, E625_1 = 4, E625_2 = 8, E625_3 = 12, E625_4 = 16, E625_5 = 20, E625_6 = 24, E625_7 = 28 } e625;
+struct s626 {
+    short **f0;
+    long f1;
+    int *f2;
+    double **f3;
+    signed char **f4;
+    float f5;
+    unsigned int **f6;
+    unsigned long long *f7;
+} s626_default, *s626_list;
+struct s627 {
+    long f0;
+    unsigned long long *f1;
+    const char f2;
+    const char **f3;
+} s627_default, *s627_list;
+long table628[28][8] = { { 77, 50 } };
+static float (*handler629)(int, float *);
+static unsigned long long (*handler630)(int, const char *);
+struct s631 {
+    short **f0;
+    long **f1;
+    signed char *f2;
+} s631_default, *s631_list;
+long table632[18][8] = { { 85, 89 } };
+int table633[51][4] = { { 24, 26 } };
+extern double proto634(char arg0, short *arg1, long arg2, unsigned int *arg3, long arg4);
+extern short proto635(unsigned int arg0, float arg1, double *arg2, int arg3);
+static signed char (*handler636)(int, signed char *);
+struct s637 {
+    long f0;
+    double **f1;
+    char *f2;
+    int f3;
+    unsigned long long f4;
+    const char **f5;
+    const char **f6;
+    short *f7;
+} s637_default, *s637_list;
+struct s638 {
+    long f0;
+    unsigned long long *f1;
+} s638_default, *s638_list;
+static unsigned int (*handler639)(int, const char *);
+static long (*handler640)(int, double *);
+static float (*handler641)(int, short *);
+short table642[47][5] = { { 53, 57 } };
+static long (*handler643)(int, double *);
+short table644[20][5] = { { 25, 14 } };
+extern int proto645(char arg0, float arg1, const char arg2);
+extern long proto646(short arg0, long *arg1);
+short table647[62][2] = { { 64, 92 } };
+struct s648 {
+    const char **f0;
+    double *f1;
+    char **f2;
+    unsigned long long f3;
+    unsigned int *f4;
+    char f5;
+} s648_default, *s648_list;
+static const char *const v649 = 0, w649 = 15;
+enum { E650_0 = 0, E650_1 = 4, E650_2 = 8, E650_3 = 12, E650_4 = 16, E650_5 = 20, E650_6 = 24, E650_7 = 28, E650_8 = 32 } e650;
+static long (*handler651)(int, int *);
+static const short *const v652 = 0, w652 = 41;
+extern char proto653(double *arg0, signed char arg1, unsigned int *arg2, short arg3, short *arg4);
+static long (*handler654)(int, long *);
+struct s655 {
+    long **f0;
+    double f1;
+    unsigned long long **f2;
+    const char **f3;
+    const char *f4;
+    short *f5;
+    signed char f6;
+    unsigned int *f7;
+} s655_default, *s655_list;
+struct s656 {
+    unsigned long long f0;
+    double **f1;
+} s656_default, *s656_list;
+struct s657 {
+    unsigned long long f0;
+    char *f1;
+} s657_default, *s657_list;
+extern unsigned int proto658(unsigned int *arg0);
+long table659[43][4] = { { 24, 30 } };
+static char (*handler660)(int, char *);
+static const int *const v661 = 0, w661 = 39;
+struct s662 {
+    unsigned int f0;
+    unsigned long long f1;
+    int *f2;
+    long **f3;
+    signed char *f4;
+    unsigned int **f5;
+} s662_default, *s662_list;
+short table663[5][5] = { { 34, 12 } };
+extern signed char proto664(double arg0, long arg1, int arg2, float arg3);
+static const const char *const v665 = 0, w665 = 17;
+struct s666 {
+    signed char *f0;
+    int f1;
+    int *f2;
+} s666_default, *s666_list;
+static const int *const v667 = 0, w667 = 69;
+short table668[38][7] = { { 83, 35 } };
+long table669[3][8] = { { 10, 26 } };
+long table670[25][2] = { { 10, 82 } };
+static double (*handler671)(int, double *);
+struct s672 {
+    double **f0;
+    long *f1;
+} s672_default, *s672_list;
+extern const char proto673(int *arg0, double arg1);
+static double (*handler674)(int, long *);
+int table675[64][6] = { { 7, 82 } };
+static const unsigned long long *const v676 = 0, w676 = 52;
+static signed char (*handler677)(int, double *);
+int table678[60][2] = { { 62, 52 } };
+static float (*handler679)(int, long *);
+int table680[24][2] = { { 43, 93 } };
+struct s681 {
+    signed char f0;
+    int f1;
+    const char f2;
+    long **f3;
+} s681_default, *s681_list;
+long table682[42][7] = { { 80, 41 } };
+int table683[29][7] = { { 20, 1 } };
+extern unsigned int proto684(const char arg0);
+struct s685 {
+    float *f0;
+    double *f1;
+    float **f2;
+    float **f3;
+    char *f4;
+} s685_default, *s685_list;
+enum { E686_0 = 0, E686_1 = 4, E686_2 = 8, E686_3 = 12, E686_4 = 16, E686_5 = 20 } e686;
+static const char *const v687 = 0, w687 = 47;
+static const float *const v688 = 0, w688 = 4;
+static double (*handler689)(int, long *);
+enum { E690_0 = 0, E690_1 = 4, E690_2 = 8, E690_3 = 12, E690_4 = 16, E690_5 = 20, E690_6 = 24 } e690;
+static double (*handler691)(int, long *);
+static const char (*handler692)(int, unsigned int *);
+struct s693 {
+    short **f0;
+    double *f1;
+    double *f2;
+    int *f3;
+    unsigned int f4;
+    unsigned int f5;
+    long **f6;
+    unsigned int *f7;
+} s693_default, *s693_list;
+static const int *const v694 = 0, w694 = 88;
+static const signed char *const v695 = 0, w695 = 71;
+enum { E696_0 = 0, E696_1 = 4, E696_2 = 8, E696_3 = 12, E696_4 = 16 } e696;
+extern unsigned int proto697(float arg0, float *arg1, const char arg2, signed char arg3, double *arg4);
+enum { E698_0 = 0, E698_1 = 4 } e698;
+struct s699 {
+    const char f0;
+    const char f1;
+    long *f2;
+    char f3;
+    short **f4;
+    long **f5;
+    signed char f6;
+    long **f7;
+} s699_default, *s699_list;
+extern int proto700(void);
+static long (*handler701)(int, unsigned long long *);
+struct s702 {
+    char *f0;
+    long f1;
+    int f2;
+} s702_default, *s702_list;
+static const char (*handler703)(int, float *);
+struct s704 {
+    float **f0;
+    long f1;
+    float f2;
+    float **f3;
+    const char f4;
+    char f5;
+    unsigned int f6;
+} s704_default, *s704_list;
+enum { E705_0 = 0, E705_1 = 4, E705_2 = 8, E705_3 = 12, E705_4 = 16, E705_5 = 20, E705_6 = 24, E705_7 = 28 } e705;
+enum { E706_0 = 0, E706_1 = 4, E706_2 = 8, E706_3 = 12, E706_4 = 16 } e706;
+struct s707 {
+    double f0;
+    const char f1;
+} s707_default, *s707_list;
+short table708[55][2] = { { 18, 45 } };
+enum { E709_0 = 0, E709_1 = 4, E709_2 = 8, E709_3 = 12, E709_4 = 16, E709_5 = 20, E709_6 = 24, E709_7 = 28, E709_8 = 32, E709_9 = 36 } e709;
+struct s710 {
+    double f0;
+    char f1;
+    float *f2;
+    long *f3;
+    char f4;
+    unsigned long long **f5;
+} s710_default, *s710_list;
+enum { E711_0 = 0, E711_1 = 4, E711_2 = 8, E711_3 = 12, E711_4 = 16, E711_5 = 20, E711_6 = 24, E711_7 = 28, E711_8 = 32, E711_9 = 36 } e711;
+static unsigned long long (*handler712)(int, const char *);
+int table713[14][8] = { { 84, 84 } };
+enum { E714_0 = 0, E714_1 = 4, E714_2 = 8, E714_3 = 12, E714_4 = 16, E714_5 = 20, E714_6 = 24, E714_7 = 28, E714_8 = 32, E714_9 = 36 } e714;
+int table715[28][6] = { { 39, 26 } };
+extern long proto716(double *arg0, long *arg1, int arg2, double arg3, long arg4);
+static unsigned long long (*handler717)(int, float *);
+extern char proto718(void);
+extern signed char proto719(double *arg0, int arg1);
+struct s720 {
+    int f0;
+    double **f1;
+} s720_default, *s720_list;
+extern float proto721(void);
+enum { E722_0 = 0, E722_1 = 4, E722_2 = 8, E722_3 = 12, E722_4 = 16, E722_5 = 20, E722_6 = 24, E722_7 = 28, E722_8 = 32 } e722;
+struct s723 {
+    char f0;
+    float f1;
+    int *f2;
+} s723_default, *s723_list;
+static const char (*handler724)(int, unsigned long long *);
+static const short *const v725 = 0, w725 = 2;
+enum { E726_0 = 0, E726_1 = 4 } e726;
+static const float *const v727 = 0, w727 = 1;
+enum { E728_0 = 0, E728_1 = 4, E728_2 = 8 } e728;
+short table729[60][5] = { { 91, 76 } };
+short table730[39][6] = { { 0, 31 } };
+struct s731 {
+    char **f0;
+    signed char f1;
+    short *f2;
+} s731_default, *s731_list;
+static char (*handler732)(int, unsigned long long *);
+static const char *const v733 = 0, w733 = 17;
+short table734[4][5] = { { 67, 59 } };
+static unsigned long long (*handler735)(int, const char *);
+struct s736 {
+    int f0;
+    long *f1;
+    unsigned long long *f2;
+    const char **f3;
+    double **f4;
+    short **f5;
+    double **f6;
+} s736_default, *s736_list;
+struct s737 {
+    signed char *f0;
+    signed char **f1;
+    long **f2;
+} s737_default, *s737_list;
+extern const char proto738(char arg0, float arg1);
+extern signed char proto739(unsigned long long *arg0);
+long table740[9][3] = { { 5, 49 } };
+static signed char (*handler741)(int, float *);
+short table742[7][7] = { { 5, 37 } };
+enum { E743_0 = 0, E743_1 = 4, E743_2 = 8, E743_3 = 12, E743_4 = 16, E743_5 = 20, E743_6 = 24, E743_7 = 28 } e743;
+int table744[8][4] = { { 63, 46 } };
+long table745[31][6] = { { 96, 7 } };
+enum { E746_0 = 0, E746_1 = 4 } e746;
+extern unsigned int proto747(const char *arg0, int arg1, signed char *arg2, const char arg3, const char arg4);
+extern short proto748(unsigned long long *arg0, const char arg1, double arg2, char *arg3);
+extern char proto749(short arg0, long *arg1, unsigned long long arg2, unsigned int arg3, long arg4);
+static const unsigned int *const v750 = 0, w750 = 2;
+int table751[41][8] = { { 80, 30 } };
+static signed char (*handler752)(int, const char *);
+static const short *const v753 = 0, w753 = 22;
+extern char proto754(long arg0, signed char arg1, float *arg2, unsigned int *arg3, const char arg4);
+enum { E755_0 = 0, E755_1 = 4, E755_2 = 8 } e755;
+struct s756 {
+    double *f0;
+    const char *f1;
+} s756_default, *s756_list;
+int table757[37][7] = { { 27, 9 } };
+static const char *const v758 = 0, w758 = 56;
+int table759[3][4] = { { 34, 50 } };
+static const signed char *const v760 = 0, w760 = 65;
+struct s761 {
+    int **f0;
+    unsigned long long *f1;
+    long *f2;
+    double **f3;
+    short f4;
+    unsigned int *f5;
+} s761_default, *s761_list;
+long table762[54][2] = { { 91, 35 } };
+extern double proto763(long *arg0, unsigned long long *arg1, double arg2, unsigned long long arg3, short *arg4);
+static const signed char *const v764 = 0, w764 = 44;
+static short (*handler765)(int, unsigned int *);
+struct s766 {
+    const char f0;
+    unsigned int **f1;
+    unsigned int f2;
+    signed char f3;
+    unsigned long long **f4;
+    short *f5;
+} s766_default, *s766_list;
+short table767[3][5] = { { 56, 89 } };
+extern long proto768(char *arg0, unsigned long long arg1, const char *arg2, unsigned int *arg3);
+static short (*handler769)(int, double *);
+struct s770 {
+    signed char f0;
+    long f1;
+    signed char *f2;
+    double *f3;
+    unsigned int f4;
+    float *f5;
+    int **f6;
+} s770_default, *s770_list;
+enum { E771_0 = 0, E771_1 = 4, E771_2 = 8, E771_3 = 12, E771_4 = 16, E771_5 = 20 } e771;
+enum { E772_0 = 0, E772_1 = 4, E772_2 = 8, E772_3 = 12 } e772;
+static const char (*handler773)(int, short *);
+short table774[32][5] = { { 37, 37 } };
+long table775[52][7] = { { 83, 40 } };
+extern unsigned long long proto776(long arg0, int arg1, double *arg2, unsigned long long *arg3);
+struct s777 {
+    unsigned long long f0;
+    short **f1;
+    signed char f2;
+    signed char f3;
+    unsigned int f4;
+} s777_default, *s777_list;
+extern int proto778(long *arg0, unsigned int arg1);
+extern char proto779(void);
+short table780[13][2] = { { 25, 67 } };
+static signed char (*handler781)(int, float *);
+struct s782 {
+    int *f0;
+    short **f1;
+    unsigned int *f2;
+} s782_default, *s782_list;
+static const signed char *const v783 = 0, w783 = 9;
+enum { E784_0 = 0, E784_1 = 4, E784_2 = 8 } e784;
+static const signed char *const v785 = 0, w785 = 73;
+struct s786 {
+    double **f0;
+    long *f1;
+    const char f2;
+    long f3;
+    int *f4;
+    char f5;
+    signed char *f6;
+} s786_default, *s786_list;
+enum { E787_0 = 0, E787_1 = 4, E787_2 = 8, E787_3 = 12 } e787;
+extern unsigned int proto788(long *arg0, signed char *arg1, int arg2, double *arg3, signed char arg4);
+extern const char proto789(double arg0, unsigned long long arg1, float arg2);
+enum { E790_0 = 0, E790_1 = 4 } e790;
+static unsigned int (*handler791)(int, char *);
+struct s792 {
+    char f0;
+    float f1;
+    unsigned int *f2;
+} s792_default, *s792_list;
+static const signed char *const v793 = 0, w793 = 47;
+static const long *const v794 = 0, w794 = 73;
+long table795[13][5] = { { 50, 41 } };
+int table796[47][2] = { { 45, 94 } };
+static signed char (*handler797)(int, const char *);
+short table798[48][5] = { { 72, 78 } };
+extern short proto799(int arg0, unsigned int arg1, long arg2, const char *arg3, char arg4);
+enum { E800_0 = 0, E800_1 = 4 } e800;
+enum { E801_0 = 0, E801_1 = 4, E801_2 = 8, E801_3 = 12, E801_4 = 16, E801_5 = 20, E801_6 = 24, E801_7 = 28, E801_8 = 32, E801_9 = 36 } e801;
+extern const char proto802(unsigned int *arg0, unsigned int *arg1);
+short table803[30][7] = { { 9, 80 } };
+struct s804 {
+    unsigned int *f0;
+    short *f1;
+    unsigned long long *f2;
+    char f3;
+    char *f4;
+    short *f5;
+    long f6;
+    const char f7;
+} s804_default, *s804_list;
+int table805[64][8] = { { 56, 24 } };
+extern unsigned long long proto806(long arg0, const char arg1, unsigned int *arg2);
+static const char *const v807 = 0, w807 = 41;
+static const short *const v808 = 0, w808 = 15;
+extern float proto809(double arg0, double arg1, const char arg2);
+static unsigned int (*handler810)(int, double *);
+int table811[53][2] = { { 48, 59 } };
+short table812[6][2] = { { 16, 13 } };
+static double (*handler813)(int, const char *);
+long table814[27][5] = { { 50, 60 } };
+struct s815 {
+    float **f0;
+    double **f1;
+    long f2;
+    long f3;
+    unsigned int f4;
+} s815_default, *s815_list;
+static const const char *const v816 = 0, w816 = 25;
+static const float *const v817 = 0, w817 = 92;
+struct s818 {
+    double f0;
+    double **f1;
+    short *f2;
+    long f3;
+} s818_default, *s818_list;
+int table819[1][6] = { { 66, 58 } };
+static char (*handler820)(int, double *);
+static const short *const v821 = 0, w821 = 93;
+static const double *const v822 = 0, w822 = 2;
+enum { E823_0 = 0, E823_1 = 4, E823_2 = 8, E823_3 = 12, E823_4 = 16, E823_5 = 20, E823_6 = 24, E823_7 = 28, E823_8 = 32, E823_9 = 36 } e823;
+static const long *const v824 = 0, w824 = 11;
+static const short *const v825 = 0, w825 = 72;
+enum { E826_0 = 0, E826_1 = 4, E826_2 = 8, E826_3 = 12, E826_4 = 16, E826_5 = 20, E826_6 = 24 } e826;
+static const unsigned long long *const v827 = 0, w827 = 37;
+enum { E828_0 = 0, E828_1 = 4, E828_2 = 8, E828_3 = 12, E828_4 = 16, E828_5 = 20, E828_6 = 24, E828_7 = 28, E828_8 = 32 } e828;
+static const short *const v829 = 0, w829 = 13;
+struct s830 {
+    double **f0;
+    double f1;
+    unsigned long long **f2;
+    int **f3;
+    char f4;
+    float f5;
+} s830_default, *s830_list;
+static const unsigned int *const v831 = 0, w831 = 1;
+enum { E832_0 = 0, E832_1 = 4 } e832;
+static const char (*handler833)(int, char *);
+static const double *const v834 = 0, w834 = 17;
+static char (*handler835)(int, signed char *);
+struct s836 {
+    unsigned long long f0;
+    char *f1;
+    double **f2;
+    const char **f3;
+    unsigned int f4;
+    unsigned long long f5;
+    signed char *f6;
+} s836_default, *s836_list;
+static short (*handler837)(int, short *);
+extern float proto838(signed char *arg0, float *arg1);
+long table839[52][7] = { { 12, 98 } };
+extern long proto840(int arg0, signed char arg1, long arg2, const char arg3, long *arg4);
+int table841[45][4] = { { 7, 63 } };
+extern double proto842(signed char *arg0);
+extern double proto843(long *arg0, const char *arg1, signed char arg2);
+long table844[33][8] = { { 18, 66 } };
+static const float *const v845 = 0, w845 = 13;
+extern unsigned long long proto846(const char arg0, const char *arg1, short arg2, int arg3, long arg4);
+enum { E847_0 = 0, E847_1 = 4, E847_2 = 8, E847_3 = 12, E847_4 = 16, E847_5 = 20, E847_6 = 24, E847_7 = 28 } e847;
+static int (*handler848)(int, signed char *);
+struct s849 {
+    double f0;
+    char *f1;
+    long **f2;
+    float **f3;
+    const char f4;
+    float *f5;
+    char f6;
+} s849_default, *s849_list;
+struct s850 {
+    unsigned long long f0;
+    short f1;
+    int **f2;
+    char **f3;
+    short **f4;
+    long f5;
+} s850_default, *s850_list;
+extern short proto851(const char *arg0, unsigned int *arg1, signed char *arg2);
+extern float proto852(short *arg0, signed char *arg1, int arg2, double arg3);
+static const short *const v853 = 0, w853 = 84;
+int table854[4][8] = { { 26, 87 } };
+static const long *const v855 = 0, w855 = 8;
+static const unsigned long long *const v856 = 0, w856 = 56;
+long table857[6][3] = { { 52, 10 } };
+enum { E858_0 = 0, E858_1 = 4, E858_2 = 8 } e858;
+struct s859 {
+    short *f0;
+    int f1;
+    long **f2;
+    signed char **f3;
+    signed char f4;
+    unsigned int f5;
+} s859_default, *s859_list;
+extern long proto860(unsigned long long arg0, const char arg1, long *arg2, int *arg3, char arg4);
+enum { E861_0 = 0, E861_1 = 4, E861_2 = 8 } e861;
+struct s862 {
+    const char **f0;
+    long **f1;
+    unsigned long long *f2;
+} s862_default, *s862_list;
+static long (*handler863)(int, unsigned int *);
+extern short proto864(float arg0, int arg1, unsigned long long *arg2, signed char *arg3);
+static char (*handler865)(int, double *);
+enum { E866_0 = 0, E866_1 = 4, E866_2 = 8, E866_3 = 12, E866_4 = 16, E866_5 = 20, E866_6 = 24, E866_7 = 28 } e866;
+static unsigned long long (*handler867)(int, int *);
+static const const char *const v868 = 0, w868 = 54;
+static short (*handler869)(int, int *);
+struct s870 {
+    long f0;
+    unsigned int *f1;
+    unsigned long long **f2;
+    signed char f3;
+    signed char f4;
+    signed char *f5;
+    const char f6;
+    unsigned int **f7;
+} s870_default, *s870_list;
+struct s871 {
+    unsigned int *f0;
+    double *f1;
+    long f2;
+    unsigned long long f3;
+    const char *f4;
+    char f5;
+    int *f6;
+} s871_default, *s871_list;
+enum { E872_0 = 0, E872_1 = 4 } e872;
+enum { E873_0 = 0, E873_1 = 4, E873_2 = 8, E873_3 = 12, E873_4 = 16, E873_5 = 20, E873_6 = 24, E873_7 = 28 } e873;
+enum { E874_0 = 0, E874_1 = 4, E874_2 = 8, E874_3 = 12 } e874;
+struct s875 {
+    short *f0;
+    char f1;
+    const char f2;
+    const char f3;
+    double *f4;
+    unsigned long long **f5;
+} s875_default, *s875_list;
+struct s876 {
+    signed char **f0;
+    signed char f1;
+    unsigned int *f2;
+    long **f3;
+    long f4;
+    char *f5;
+    double f6;
+    signed char **f7;
+} s876_default, *s876_list;
+static int (*handler877)(int, unsigned long long *);
+extern int proto878(void);
+int table879[9][5] = { { 42, 49 } };
+enum { E880_0 = 0, E880_1 = 4, E880_2 = 8, E880_3 = 12, E880_4 = 16, E880_5 = 20, E880_6 = 24, E880_7 = 28, E880_8 = 32 } e880;
+short table881[6][6] = { { 81, 22 } };
+struct s882 {
+    double **f0;
+    double f1;
+    signed char f2;
+    float **f3;
+    long f4;
+    unsigned int **f5;
+} s882_default, *s882_list;
+static signed char (*handler883)(int, int *);
+int table884[31][2] = { { 11, 18 } };
+int table885[27][4] = { { 45, 61 } };
+static const unsigned long long *const v886 = 0, w886 = 56;
+struct s887 {
+    unsigned int *f0;
+    unsigned int f1;
+    unsigned long long f2;
+    int f3;
+} s887_default, *s887_list;
+extern unsigned int proto888(short arg0, unsigned long long *arg1, double *arg2, double *arg3, const char arg4);
+static long (*handler889)(int, unsigned int *);
+enum { E890_0 = 0, E890_1 = 4, E890_2 = 8, E890_3 = 12, E890_4 = 16, E890_5 = 20, E890_6 = 24 } e890;
+int table891[25][5] = { { 72, 15 } };
+static const unsigned long long *const v892 = 0, w892 = 96;
+static const unsigned int *const v893 = 0, w893 = 92;
+static unsigned long long (*handler894)(int, long *);
+enum { E895_0 = 0, E895_1 = 4, E895_2 = 8, E895_3 = 12, E895_4 = 16 } e895;
+struct s896 {
+    int *f0;
+    unsigned int f1;
+    unsigned int f2;
+    short **f3;
+    char f4;
+} s896_default, *s896_list;
+enum { E897_0 = 0, E897_1 = 4, E897_2 = 8, E897_3 = 12, E897_4 = 16, E897_5 = 20, E897_6 = 24, E897_7 = 28, E897_8 = 32, E897_9 = 36 } e897;
+extern double proto898(void);
+static const char (*handler899)(int, const char *);
+enum { E900_0 = 0, E900_1 = 4 } e900;
+struct s901 {
+    int **f0;
+    float **f1;
+    const char f2;
+    double f3;
+    short **f4;
+    float f5;
+    unsigned long long *f6;
+} s901_default, *s901_list;
+static int (*handler902)(int, unsigned int *);
+int table903[23][7] = { { 64, 64 } };
+enum { E904_0 = 0, E904_1 = 4, E904_2 = 8, E904_3 = 12 } e904;
+static float (*handler905)(int, float *);
+enum { E906_0 = 0, E906_1 = 4, E906_2 = 8, E906_3 = 12 } e906;
+short table907[6][6] = { { 71, 76 } };
+extern long proto908(void);
+static float (*handler909)(int, short *);
+extern char proto910(void);
+enum { E911_0 = 0, E911_1 = 4, E911_2 = 8, E911_3 = 12, E911_4 = 16, E911_5 = 20, E911_6 = 24 } e911;
+extern char proto912(void);
+int table913[5][3] = { { 74, 65 } };
+extern char proto914(int *arg0, double arg1, char arg2, int *arg3);
+struct s915 {
+    long **f0;
+    float **f1;
+} s915_default, *s915_list;
+static double (*handler916)(int, long *);
+enum { E917_0 = 0, E917_1 = 4, E917_2 = 8, E917_3 = 12, E917_4 = 16, E917_5 = 20 } e917;
+extern int proto918(short arg0, short *arg1);
+extern signed char proto919(long arg0, signed char *arg1, char *arg2, char *arg3);
+extern double proto920(float arg0, float arg1);
+struct s921 {
+    double *f0;
+    float f1;
+    long f2;
+    int *f3;
+    signed char *f4;
+    unsigned long long **f5;
+    unsigned long long **f6;
+} s921_default, *s921_list;
+int table922[18][4] = { { 54, 74 } };
+extern char proto923(void);
+int table924[29][4] = { { 22, 11 } };
+struct s925 {
+    float f0;
+    int f1;
+} s925_default, *s925_list;
+extern unsigned int proto926(short arg0);
+struct s927 {
+    double **f0;
+    unsigned int f1;
+    unsigned long long f2;
+} s927_default, *s927_list;
+struct s928 {
+    long **f0;
+    unsigned int **f1;
+    double *f2;
+    float f3;
+    short *f4;
+    const char f5;
+    float f6;
+    unsigned int *f7;
+} s928_default, *s928_list;
+static long (*handler929)(int, short *);
+struct s930 {
+    short f0;
+    char *f1;
+    signed char f2;
+} s930_default, *s930_list;
+static const float *const v931 = 0, w931 = 4;
+static long (*handler932)(int, short *);
+struct s933 {
+    float *f0;
+    unsigned long long *f1;
+    char *f2;
+    unsigned long long f3;
+    double **f4;
+} s933_default, *s933_list;
+int table934[61][8] = { { 20, 84 } };
+int table935[51][7] = { { 11, 90 } };
+int table936[54][5] = { { 60, 73 } };
+long table937[39][3] = { { 93, 53 } };
+extern const char proto938(short *arg0);
+struct s939 {
+    double *f0;
+    unsigned int **f1;
+    unsigned int *f2;
+} s939_default, *s939_list;
+extern float proto940(signed char arg0, short arg1, int arg2, double arg3);
+int table941[57][3] = { { 2, 0 } };
+static const short *const v942 = 0, w942 = 66;
+struct s943 {
+    signed char f0;
+    char f1;
+    short f2;
+    int f3;
+    unsigned int f4;
+    unsigned int **f5;
+} s943_default, *s943_list;
+extern unsigned long long proto944(char arg0, int arg1, short arg2);
+extern const char proto945(long *arg0, long arg1, int arg2, signed char arg3);
+static const long *const v946 = 0, w946 = 63;
+long table947[5][8] = { { 58, 71 } };
+struct s948 {
+    unsigned int **f0;
+    float f1;
+    unsigned long long *f2;
+    unsigned long long **f3;
+    char f4;
+    double **f5;
+} s948_default, *s948_list;
+enum { E949_0 = 0, E949_1 = 4 } e949;
+int table950[25][8] = { { 22, 32 } };
+long table951[54][6] = { { 58, 6 } };
+short table952[44][2] = { { 23, 10 } };
+static short (*handler953)(int, long *);
+long table954[58][4] = { { 30, 19 } };
+enum { E955_0 = 0, E955_1 = 4 } e955;
+static signed char (*handler956)(int, const char *);
+static const const char *const v957 = 0, w957 = 42;
+enum { E958_0 = 0, E958_1 = 4, E958_2 = 8, E958_3 = 12 } e958;
+long table959[43][2] = { { 25, 75 } };
+static char (*handler960)(int, unsigned int *);
+struct s961 {
+    short **f0;
+    unsigned int **f1;
+    unsigned int **f2;
+    float f3;
+    signed char **f4;
+    long *f5;
+    unsigned int **f6;
+} s961_default, *s961_list;
+enum { E962_0 = 0, E962_1 = 4, E962_2 = 8, E962_3 = 12, E962_4 = 16, E962_5 = 20 } e962;
+int table963[50][8] = { { 74, 81 } };
+extern unsigned long long proto964(char arg0, unsigned long long arg1);
+static char (*handler965)(int, short *);
+long table966[13][7] = { { 29, 49 } };
+short table967[38][5] = { { 6, 98 } };
+int table968[42][8] = { { 69, 92 } };
+enum { E969_0 = 0, E969_1 = 4, E969_2 = 8 } e969;
+struct s970 {
+    signed char f0;
+    int *f1;
+    double f2;
+    double *f3;
+    const char *f4;
+    double **f5;
+    double f6;
+} s970_default, *s970_list;
+struct s971 {
+    signed char *f0;
+    const char **f1;
+    signed char *f2;
+    const char *f3;
+    short **f4;
+} s971_default, *s971_list;
+static const double *const v972 = 0, w972 = 63;
+static unsigned long long (*handler973)(int, short *);
+enum { E974_0 = 0, E974_1 = 4, E974_2 = 8, E974_3 = 12, E974_4 = 16, E974_5 = 20, E974_6 = 24, E974_7 = 28, E974_8 = 32 } e974;
+static const signed char *const v975 = 0, w975 = 63;
+extern char proto976(short arg0, short arg1, unsigned int arg2, unsigned int arg3);
+extern long proto977(int *arg0, signed char *arg1, signed char arg2, double arg3, float *arg4);
+struct s978 {
+    unsigned long long f0;
+    char **f1;
+    unsigned long long *f2;
+    long f3;
+    char f4;
+    signed char *f5;
+    short **f6;
+} s978_default, *s978_list;
+static const const char *const v979 = 0, w979 = 10;
+struct s980 {
+    signed char *f0;
+    unsigned int **f1;
+    const char **f2;
+    const char f3;
+    int f4;
+    const char **f5;
+    short **f6;
+} s980_default, *s980_list;
+struct s981 {
+    long *f0;
+    float **f1;
+    int f2;
+    float f3;
+} s981_default, *s981_list;
+enum { E982_0 = 0, E982_1 = 4, E982_2 = 8, E982_3 = 12, E982_4 = 16, E982_5 = 20, E982_6 = 24, E982_7 = 28, E982_8 = 32, E982_9 = 36 } e982;
+enum { E983_0 = 0, E983_1 = 4, E983_2 = 8, E983_3 = 12, E983_4 = 16, E983_5 = 20, E983_6 = 24, E983_7 = 28 } e983;
+int table984[28][2] = { { 7, 38 } };
+long table985[47][2] = { { 94, 27 } };
+struct s986 {
+    double f0;
+    unsigned long long **f1;
+    long *f2;
+    short *f3;
+    unsigned long long *f4;
+} s986_default, *s986_list;
+extern double proto987(float arg0, long *arg1, signed char *arg2);
+struct s988 {
+    unsigned int *f0;
+    char f1;
+    char *f2;
+    float **f3;
+    int *f4;
+    const char f5;
+    long **f6;
+} s988_default, *s988_list;
+enum { E989_0 = 0, E989_1 = 4, E989_2 = 8, E989_3 = 12, E989_4 = 16, E989_5 = 20, E989_6 = 24 } e989;
+static const long *const v990 = 0, w990 = 68;
+extern short proto991(unsigned int *arg0);
+static const float *const v992 = 0, w992 = 37;
+short table993[44][4] = { { 79, 1 } };
+struct s994 {
+    unsigned int f0;
+    const char f1;
+    unsigned int f2;
+    unsigned int f3;
+    float **f4;
+    short f5;
+    double *f6;
+} s994_default, *s994_list;
+enum { E995_0 = 0, E995_1 = 4, E995_2 = 8, E995_3 = 12, E995_4 = 16 } e995;
+struct s996 {
+    unsigned long long *f0;
+    float f1;
+    unsigned int **f2;
+    char *f3;
+} s996_default, *s996_list;
+struct s997 {
+    char **f0;
+    float *f1;
+} s997_default, *s997_list;
+extern const char proto998(float *arg0, signed char *arg1, signed char *arg2, short arg3);
+enum { E999_0 = 0, E999_1 = 4, E999_2 = 8, E999_3 = 12 } e999;
+extern double proto1000(void);
+static double (*handler1001)(int, long *);
+extern const char proto1002(double *arg0, double *arg1, char *arg2, char arg3);
+struct s1003 {
+    signed char **f0;
+    long **f1;
+    long *f2;
+    short **f3;
+    int **f4;
+    short f5;
+} s1003_default, *s1003_list;
+enum { E1004_0 = 0, E1004_1 = 4, E1004_2 = 8, E1004_3 = 12, E1004_4 = 16 } e1004;
+static int (*handler1005)(int, long *);
+static const double *const v1006 = 0, w1006 = 21;
+extern unsigned int proto1007(void);
+struct s1008 {
+    unsigned int f0;
+    double *f1;
+    unsigned int **f2;
+    char f3;
+    int *f4;
+    double f5;
+    signed char *f6;
+    double **f7;
+} s1008_default, *s1008_list;
+struct s1009 {
+    signed char f0;
+    const char f1;
+    long **f2;
+    double f3;
+    signed char **f4;
+} s1009_default, *s1009_list;
+static double (*handler1010)(int, long *);
+int table1011[24][5] = { { 93, 1 } };
+static int (*handler1012)(int, float *);
+static int (*handler1013)(int, float *);
+struct s1014 {
+    unsigned long long *f0;
+    char f1;
+    const char f2;
+    double **f3;
+    double f4;
+    char **f5;
+} s1014_default, *s1014_list;
+extern unsigned int proto1015(double *arg0, signed char arg1, signed char *arg2, long arg3);
+long table1016[58][5] = { { 2, 58 } };
+short table1017[14][2] = { { 34, 23 } };
+extern long proto1018(void);
+enum { E1019_0 = 0, E1019_1 = 4, E1019_2 = 8, E1019_3 = 12, E1019_4 = 16, E1019_5 = 20, E1019_6 = 24, E1019_7 = 28, E1019_8 = 32, E1019_9 = 36 } e1019;
+extern unsigned long long proto1020(unsigned long long arg0, float arg1);
+static const double *const v1021 = 0, w1021 = 69;
+int table1022[57][4] = { { 83, 79 } };
+short table1023[55][5] = { { 49, 12 } };
+extern double proto1024(short arg0);
+enum { E1025_0 = 0, E1025_1 = 4, E1025_2 = 8, E1025_3 = 12, E1025_4 = 16, E1025_5 = 20, E1025_6 = 24 } e1025;
+static float (*handler1026)(int, int *);
+extern signed char proto1027(signed char arg0, signed char arg1, const char *arg2);
+enum { E1028_0 = 0, E1028_1 = 4, E1028_2 = 8 } e1028;
+extern char proto1029(float arg0, char arg1, char *arg2);
+long table1030[58][6] = { { 67, 28 } };
+struct s1031 {
+    float **f0;
+    unsigned int **f1;
+    const char f2;
+    float f3;
+} s1031_default, *s1031_list;
+extern int proto1032(short arg0);
+extern char proto1033(int arg0, char arg1, short *arg2, int *arg3, unsigned int *arg4);
+extern const char proto1034(int *arg0);
+int table1035[21][4] = { { 68, 0 } };
+short table1036[52][2] = { { 96, 43 } };
+long table1037[32][2] = { { 68, 2 } };
+struct s1038 {
+    short **f0;
+    short **f1;
+    long *f2;
+    unsigned int **f3;
+    unsigned long long *f4;
+    unsigned long long **f5;
+    unsigned int *f6;
+    int f7;
+} s1038_default, *s1038_list;
+enum { E1039_0 = 0, E1039_1 = 4, E1039_2 = 8, E1039_3 = 12, E1039_4 = 16, E1039_5 = 20, E1039_6 = 24, E1039_7 = 28 } e1039;
+enum { E1040_0 = 0, E1040_1 = 4, E1040_2 = 8, E1040_3 = 12, E1040_4 = 16, E1040_5 = 20, E1040_6 = 24, E1040_7 = 28 } e1040;
+extern long proto1041(char arg0, double arg1, char arg2, char *arg3);
+enum { E1042_0 = 0, E1042_1 = 4, E1042_2 = 8, E1042_3 = 12, E1042_4 = 16, E1042_5 = 20, E1042_6 = 24, E1042_7 = 28, E1042_8 = 32 } e1042;
+static long (*handler1043)(int, short *);
+extern signed char proto1044(int *arg0, long *arg1, signed char *arg2, unsigned int arg3, int *arg4);
+static const int *const v1045 = 0, w1045 = 33;
+extern int proto1046(void);
+static int (*handler1047)(int, signed char *);
+long table1048[59][8] = { { 70, 92 } };
+static const char (*handler1049)(int, char *);
+static const char *const v1050 = 0, w1050 = 29;
+extern char proto1051(short arg0);
+struct s1052 {
+    char f0;
+    char f1;
+    const char **f2;
+    unsigned long long **f3;
+} s1052_default, *s1052_list;
+static char (*handler1053)(int, int *);
+extern int proto1054(float arg0, unsigned long long *arg1, int arg2, unsigned int arg3);
+long table1055[33][4] = { { 44, 78 } };
+static const char (*handler1056)(int, signed char *);
+long table1057[34][2] = { { 61, 16 } };
+extern unsigned long long proto1058(unsigned int *arg0, double arg1, short arg2, float *arg3, int arg4);
+enum { E1059_0 = 0, E1059_1 = 4, E1059_2 = 8, E1059_3 = 12, E1059_4 = 16, E1059_5 = 20, E1059_6 = 24, E1059_7 = 28, E1059_8 = 32 } e1059;
+int table1060[36][3] = { { 81, 33 } };
+struct s1061 {
+    int f0;
+    double f1;
+    float f2;
+    unsigned int *f3;
+    long *f4;
+} s1061_default, *s1061_list;
+int table1062[42][5] = { { 83, 80 } };
+long table1063[49][6] = { { 51, 64 } };
+enum { E1064_0 = 0, E1064_1 = 4, E1064_2 = 8, E1064_3 = 12, E1064_4 = 16 } e1064;
+struct s1065 {
+    short f0;
+    double **f1;
+    signed char *f2;
+    const char **f3;
+    unsigned long long **f4;
+} s1065_default, *s1065_list;
+short table1066[31][2] = { { 15, 84 } };
+extern unsigned int proto1067(short *arg0, const char *arg1, float arg2, unsigned int arg3, char arg4);
+static short (*handler1068)(int, unsigned int *);
+static const double *const v1069 = 0, w1069 = 96;
+extern char proto1070(void);
+static const short *const v1071 = 0, w1071 = 91;
+extern unsigned long long proto1072(float *arg0, unsigned int arg1, double *arg2, unsigned long long *arg3, signed char arg4);
+static const char (*handler1073)(int, const char *);
+static const float *const v1074 = 0, w1074 = 11;
+enum { E1075_0 = 0, E1075_1 = 4, E1075_2 = 8, E1075_3 = 12, E1075_4 = 16, E1075_5 = 20, E1075_6 = 24, E1075_7 = 28 } e1075;
+enum { E1076_0 = 0, E1076_1 = 4, E1076_2 = 8, E1076_3 = 12, E1076_4 = 16 } e1076;
+enum { E1077_0 = 0, E1077_1 = 4, E1077_2 = 8 } e1077;
+extern unsigned long long proto1078(unsigned int *arg0, double *arg1, char arg2);
+long table1079[32][3] = { { 27, 17 } };
+enum { E1080_0 = 0, E1080_1 = 4, E1080_2 = 8, E1080_3 = 12, E1080_4 = 16, E1080_5 = 20, E1080_6 = 24, E1080_7 = 28, E1080_8 = 32 } e1080;
+struct s1081 {
+    short *f0;
+    long **f1;
+    short **f2;
+    long *f3;
+    long f4;
+    short **f5;
+    short *f6;
+} s1081_default, *s1081_list;
+extern double proto1082(float *arg0);
+struct s1083 {
+    char **f0;
+    char f1;
+    char **f2;
+    signed char f3;
+    signed char f4;
+    unsigned int *f5;
+    float f6;
+} s1083_default, *s1083_list;
+static const float *const v1084 = 0, w1084 = 83;
+enum { E1085_0 = 0, E1085_1 = 4, E1085_2 = 8, E1085_3 = 12, E1085_4 = 16, E1085_5 = 20 } e1085;
+static const unsigned int *const v1086 = 0, w1086 = 63;
+enum { E1087_0 = 0, E1087_1 = 4, E1087_2 = 8, E1087_3 = 12, E1087_4 = 16, E1087_5 = 20, E1087_6 = 24, E1087_7 = 28, E1087_8 = 32, E1087_9 = 36 } e1087;
+enum { E1088_0 = 0, E1088_1 = 4, E1088_2 = 8, E1088_3 = 12, E1088_4 = 16, E1088_5 = 20, E1088_6 = 24, E1088_7 = 28, E1088_8 = 32 } e1088;
+struct s1089 {
+    short **f0;
+    unsigned long long **f1;
+    const char f2;
+    long **f3;
+    unsigned int f4;
+    unsigned long long **f5;
+    signed char **f6;
+} s1089_default, *s1089_list;
+struct s1090 {
+    const char **f0;
+    unsigned long long **f1;
+    float f2;
+    short **f3;
+    int **f4;
+    const char *f5;
+    short f6;
+    long **f7;
+} s1090_default, *s1090_list;
+static const float *const v1091 = 0, w1091 = 28;
+enum { E1092_0 = 0, E1092_1 = 4, E1092_2 = 8, E1092_3 = 12 } e1092;
+static const int *const v1093 = 0, w1093 = 94;
+struct s1094 {
+    short *f0;
+    short f1;
+    int f2;
+    short **f3;
+} s1094_default, *s1094_list;
+enum { E1095_0 = 0, E1095_1 = 4, E1095_2 = 8, E1095_3 = 12, E1095_4 = 16, E1095_5 = 20, E1095_6 = 24 } e1095;
+struct s1096 {
+    long **f0;
+    unsigned long long f1;
+} s1096_default, *s1096_list;
+struct s1097 {
+    unsigned int **f0;
+    short f1;
+    short f2;
+} s1097_default, *s1097_list;
+short table1098[7][3] = { { 73, 83 } };
+struct s1099 {
+    unsigned long long f0;
+    unsigned long long *f1;
+    float **f2;
+    unsigned long long *f3;
+    unsigned int f4;
+} s1099_default, *s1099_list;
+int table1100[13][7] = { { 11, 78 } };
+struct s1101 {
+    unsigned int **f0;
+    unsigned long long *f1;
+    float *f2;
+    unsigned long long **f3;
+    float f4;
+    long *f5;
+    unsigned long long *f6;
+} s1101_default, *s1101_list;
+struct s1102 {
+    signed char **f0;
+    float *f1;
+} s1102_default, *s1102_list;
+static const char (*handler1103)(int, unsigned int *);
+static const unsigned long long *const v1104 = 0, w1104 = 88;
+static signed char (*handler1105)(int, short *);
+extern float proto1106(unsigned long long arg0, char arg1, short *arg2, int *arg3);
+extern long proto1107(unsigned int *arg0, char arg1, unsigned int arg2, float *arg3);
+extern unsigned long long proto1108(char *arg0, const char *arg1, int arg2, char *arg3, double *arg4);
+long table1109[41][5] = { { 15, 31 } };
+short table1110[9][3] = { { 29, 1 } };
+extern long proto1111(double *arg0, float *arg1, long arg2, unsigned long long arg3, char arg4);
+long table1112[35][2] = { { 25, 69 } };
+struct s1113 {
+    unsigned long long **f0;
+    long **f1;
+    const char **f2;
+} s1113_default, *s1113_list;
+enum { E1114_0 = 0, E1114_1 = 4, E1114_2 = 8, E1114_3 = 12, E1114_4 = 16, E1114_5 = 20, E1114_6 = 24, E1114_7 = 28 } e1114;
+extern long proto1115(unsigned long long arg0, unsigned int *arg1, signed char *arg2, char arg3, short *arg4);
+long table1116[61][3] = { { 65, 28 } };
+struct s1117 {
+    float **f0;
+    long f1;
+    signed char *f2;
+    signed char *f3;
+    unsigned long long *f4;
+    unsigned long long f5;
+    double f6;
+    double *f7;
+} s1117_default, *s1117_list;
+struct s1118 {
+    double **f0;
+    long f1;
+    const char *f2;
+    double **f3;
+    unsigned long long f4;
+} s1118_default, *s1118_list;
+static unsigned int (*handler1119)(int, double *);
+static signed char (*handler1120)(int, int *);
+static char (*handler1121)(int, float *);
+static unsigned long long (*handler1122)(int, unsigned long long *);
+int table1123[38][4] = { { 24, 99 } };
+struct s1124 {
+    unsigned int f0;
+    char f1;
+    double *f2;
+    char *f3;
+    unsigned long long **f4;
+} s1124_default, *s1124_list;
+extern unsigned long long proto1125(void);
+extern double proto1126(void);
+extern signed char proto1127(int arg0, short arg1);
+struct s1128 {
+    float *f0;
+    short *f1;
+    const char **f2;
+    const char f3;
+    unsigned int *f4;
+} s1128_default, *s1128_list;
+static const short *const v1129 = 0, w1129 = 21;
+static double (*handler1130)(int, unsigned long long *);
+long table1131[31][3] = { { 95, 44 } };
+static const long *const v1132 = 0, w1132 = 50;
+enum { E1133_0 = 0, E1133_1 = 4, E1133_2 = 8, E1133_3 = 12, E1133_4 = 16, E1133_5 = 20 } e1133;
+static const int *const v1134 = 0, w1134 = 44;
+extern int proto1135(unsigned int arg0);
+static double (*handler1136)(int, short *);
+static const char *const v1137 = 0, w1137 = 17;
+enum { E1138_0 = 0, E1138_1 = 4, E1138_2 = 8 } e1138;
+extern signed char proto1139(char *arg0, char *arg1);
+struct s1140 {
+    char f0;
+    float f1;
+    const char **f2;
+    signed char **f3;
+    long *f4;
+    float f5;
+    float **f6;
+    unsigned int *f7;
+} s1140_default, *s1140_list;
+extern int proto1141(const char arg0);
+enum { E1142_0 = 0, E1142_1 = 4, E1142_2 = 8 } e1142;
+static const char (*handler1143)(int, signed char *);
+static const short *const v1144 = 0, w1144 = 15;
+long table1145[10][3] = { { 34, 70 } };
+static const unsigned int *const v1146 = 0, w1146 = 88;
+struct s1147 {
+    char **f0;
+    short **f1;
+} s1147_default, *s1147_list;
+static const int *const v1148 = 0, w1148 = 79;
+static const double *const v1149 = 0, w1149 = 77;
+struct s1150 {
+    short *f0;
+    int f1;
+    float f2;
+    long **f3;
+} s1150_default, *s1150_list;
+struct s1151 {
+    long **f0;
+    const char f1;
+    short **f2;
+    char **f3;
+    unsigned int **f4;
+} s1151_default, *s1151_list;
+struct s1152 {
+    const char *f0;
+    int **f1;
+    const char **f2;
+} s1152_default, *s1152_list;
+struct s1153 {
+    float *f0;
+    double *f1;
+} s1153_default, *s1153_list;
+int table1154[40][6] = { { 48, 29 } };
+enum { E1155_0 = 0, E1155_1 = 4, E1155_2 = 8 } e1155;
+struct s1156 {
+    float *f0;
+    double **f1;
+    short f2;
+    unsigned long long *f3;
+    int f4;
+    unsigned int f5;
+} s1156_default, *s1156_list;
+static unsigned int (*handler1157)(int, signed char *);
+long table1158[10][3] = { { 3, 88 } };
+long table1159[55][3] = { { 75, 9 } };
+static short (*handler1160)(int, double *);
+static const char (*handler1161)(int, unsigned long long *);
+static const unsigned int *const v1162 = 0, w1162 = 35;
+static const const char *const v1163 = 0, w1163 = 28;
+short table1164[45][5] = { { 45, 68 } };
+int table1165[55][4] = { { 77, 52 } };
+long table1166[44][2] = { { 66, 80 } };
+enum { E1167_0 = 0, E1167_1 = 4, E1167_2 = 8, E1167_3 = 12 } e1167;
+struct s1168 {
+    float f0;
+    long **f1;
+    const char *f2;
+    char f3;
+} s1168_default, *s1168_list;
+extern unsigned long long proto1169(long *arg0);
+enum { E1170_0 = 0, E1170_1 = 4, E1170_2 = 8, E1170_3 = 12, E1170_4 = 16, E1170_5 = 20 } e1170;
+enum { E1171_0 = 0, E1171_1 = 4, E1171_2 = 8, E1171_3 = 12, E1171_4 = 16, E1171_5 = 20, E1171_6 = 24, E1171_7 = 28 } e1171;
+static const unsigned long long *const v1172 = 0, w1172 = 68;
+extern char proto1173(char arg0, const char *arg1, char arg2, double *arg3);
+static const double *const v1174 = 0, w1174 = 96;
+struct s1175 {
+    unsigned long long *f0;
+    unsigned int *f1;
+} s1175_default, *s1175_list;
+struct s1176 {
+    short **f0;
+    const char *f1;
+    float f2;
+    const char f3;
+    double **f4;
+    int f5;
+    unsigned long long *f6;
+} s1176_default, *s1176_list;
+extern float proto1177(long arg0, int *arg1);
+struct s1178 {
+    float **f0;
+    signed char **f1;
+    unsigned long long f2;
+    unsigned long long f3;
+    long **f4;
+    short *f5;
+    long **f6;
+} s1178_default, *s1178_list;
+int table1179[30][2] = { { 63, 66 } };
+static const long *const v1180 = 0, w1180 = 62;
+static const long *const v1181 = 0, w1181 = 84;
+enum { E1182_0 = 0, E1182_1 = 4, E1182_2 = 8, E1182_3 = 12 } e1182;
+struct s1183 {
+    double f0;
+    short **f1;
+    double **f2;
+    int f3;
+    unsigned int **f4;
+    long **f5;
+    int *f6;
+    short **f7;
+} s1183_default, *s1183_list;
+static const long *const v1184 = 0, w1184 = 32;
+struct s1185 {
+    signed char *f0;
+    long **f1;
+    const char *f2;
+    const char **f3;
+} s1185_default, *s1185_list;
+short table1186[22][8] = { { 66, 91 } };
+struct s1187 {
+    signed char *f0;
+    char *f1;
+    float *f2;
+    int f3;
+    unsigned long long f4;
+    short f5;
+    short *f6;
+    int f7;
+} s1187_default, *s1187_list;
+struct s1188 {
+    short f0;
+    float f1;
+    const char **f2;
+    unsigned long long f3;
+    short **f4;
+    char **f5;
+    short f6;
+} s1188_default, *s1188_list;
+int table1189[55][2] = { { 41, 46 } };
+static const unsigned int *const v1190 = 0, w1190 = 95;
+static const const char *const v1191 = 0, w1191 = 80;
+long table1192[37][3] = { { 13, 25 } };
+enum { E1193_0 = 0, E1193_1 = 4 } e1193;
+static const signed char *const v1194 = 0, w1194 = 52;
+long table1195[13][7] = { { 46, 43 } };
+extern int proto1196(char arg0, double *arg1, double *arg2);
+static double (*handler1197)(int, const char *);
+struct s1198 {
+    short *f0;
+    const char *f1;
+    const char f2;
+    signed char *f3;
+    float *f4;
+    short *f5;
+    signed char *f6;
+    int **f7;
+} s1198_default, *s1198_list;
+static const unsigned int *const v1199 = 0, w1199 = 26;
+extern int proto1200(void);
+enum { E1201_0 = 0, E1201_1 = 4, E1201_2 = 8, E1201_3 = 12, E1201_4 = 16, E1201_5 = 20, E1201_6 = 24, E1201_7 = 28 } e1201;
+struct s1202 {
+    const char *f0;
+    char **f1;
+    unsigned long long **f2;
+    long **f3;
+    int *f4;
+    int *f5;
+} s1202_default, *s1202_list;
+static double (*handler1203)(int, float *);
+static unsigned int (*handler1204)(int, double *);
+static unsigned long long (*handler1205)(int, signed char *);
+enum { E1206_0 = 0, E1206_1 = 4, E1206_2 = 8, E1206_3 = 12, E1206_4 = 16, E1206_5 = 20, E1206_6 = 24, E1206_7 = 28, E1206_8 = 32 } e1206;
+enum { E1207_0 = 0, E1207_1 = 4, E1207_2 = 8, E1207_3 = 12, E1207_4 = 16, E1207_5 = 20, E1207_6 = 24, E1207_7 = 28, E1207_8 = 32 } e1207;
+enum { E1208_0 = 0, E1208_1 = 4, E1208_2 = 8, E1208_3 = 12, E1208_4 = 16 } e1208;
+static const short *const v1209 = 0, w1209 = 91;
+enum { E1210_0 = 0, E1210_1 = 4, E1210_2 = 8, E1210_3 = 12, E1210_4 = 16, E1210_5 = 20, E1210_6 = 24 } e1210;
+struct s1211 {
+    short f0;
+    short **f1;
+    const char f2;
+    char f3;
+    short **f4;
+} s1211_default, *s1211_list;
+struct s1212 {
+    short *f0;
+    const char *f1;
+    signed char **f2;
+    int **f3;
+    double f4;
+} s1212_default, *s1212_list;
+extern char proto1213(unsigned long long *arg0, double *arg1, unsigned int *arg2, const char arg3, float arg4);
+enum { E1214_0 = 0, E1214_1 = 4 } e1214;
+static const int *const v1215 = 0, w1215 = 5;
+static const unsigned long long *const v1216 = 0, w1216 = 62;
+static unsigned long long (*handler1217)(int, long *);
+struct s1218 {
+    int *f0;
+    char **f1;
+    unsigned long long f2;
+    short **f3;
+    long *f4;
+} s1218_default, *s1218_list;
+static unsigned int (*handler1219)(int, unsigned int *);
+long table1220[64][4] = { { 83, 75 } };
+static const const char *const v1221 = 0, w1221 = 81;
+enum { E1222_0 = 0, E1222_1 = 4, E1222_2 = 8, E1222_3 = 12 } e1222;
+extern int proto1223(void);
+static const unsigned int *const v1224 = 0, w1224 = 46;
+struct s1225 {
+    char **f0;
+    long *f1;
+    unsigned long long *f2;
+    unsigned int f3;
+    short **f4;
+    signed char *f5;
+    double **f6;
+    char f7;
+} s1225_default, *s1225_list;
+enum { E1226_0 = 0, E1226_1 = 4, E1226_2 = 8, E1226_3 = 12 } e1226;
+static int (*handler1227)(int, unsigned int *);
+static const long *const v1228 = 0, w1228 = 26;
+static long (*handler1229)(int, unsigned long long *);
+long table1230[4][6] = { { 9, 65 } };
+short table1231[51][3] = { { 48, 73 } };
+static const char *const v1232 = 0, w1232 = 43;
+struct s1233 {
+    const char *f0;
+    char *f1;
+    const char f2;
+    short f3;
+    char f4;
+} s1233_default, *s1233_list;
+enum { E1234_0 = 0, E1234_1 = 4 } e1234;
+static const unsigned int *const v1235 = 0, w1235 = 4;
+int table1236[17][4] = { { 31, 33 } };
+extern double proto1237(signed char *arg0);
+struct s1238 {
+    char **f0;
+    long **f1;
+    unsigned int *f2;
+    const char **f3;
+    double **f4;
+    unsigned int f5;
+} s1238_default, *s1238_list;
+long table1239[54][5] = { { 79, 16 } };
+static unsigned int (*handler1240)(int, char *);
+struct s1241 {
+    unsigned long long f0;
+    signed char *f1;
+    long **f2;
+} s1241_default, *s1241_list;
+short table1242[20][7] = { { 55, 94 } };
+int table1243[41][5] = { { 12, 74 } };
+static char (*handler1244)(int, float *);
+extern const char proto1245(short *arg0, signed char *arg1);
+struct s1246 {
+    const char **f0;
+    double *f1;
+    float f2;
+    signed char **f3;
+} s1246_default, *s1246_list;
+static const double *const v1247 = 0, w1247 = 32;
+static float (*handler1248)(int, int *);
+static const char *const v1249 = 0, w1249 = 19;
+static unsigned int (*handler1250)(int, const char *);
+extern char proto1251(int *arg0, unsigned long long *arg1);
+static const long *const v1252 = 0, w1252 = 91;
+static const unsigned long long *const v1253 = 0, w1253 = 100;
+short table1254[27][6] = { { 7, 50 } };
+extern const char proto1255(unsigned long long arg0, signed char arg1, unsigned int arg2, unsigned long long *arg3);
+extern unsigned long long proto1256(long *arg0, unsigned int *arg1, long *arg2, short arg3, short *arg4);
+static const char *const v1257 = 0, w1257 = 22;
+long table1258[15][2] = { { 66, 92 } };
+enum { E1259_0 = 0, E1259_1 = 4, E1259_2 = 8, E1259_3 = 12, E1259_4 = 16, E1259_5 = 20 } e1259;
+extern unsigned long long proto1260(signed char arg0, unsigned int *arg1);
+short table1261[9][4] = { { 72, 25 } };
+int table1262[6][6] = { { 76, 58 } };
+static const char *const v1263 = 0, w1263 = 18;
+static char (*handler1264)(int, long *);
+extern unsigned long long proto1265(void);
+extern double proto1266(void);
+enum { E1267_0 = 0, E1267_1 = 4, E1267_2 = 8, E1267_3 = 12, E1267_4 = 16 } e1267;
+static double (*handler1268)(int, signed char *);
+extern double proto1269(void);
+extern short proto1270(float *arg0, long *arg1, unsigned long long *arg2, double *arg3);
+static const signed char *const v1271 = 0, w1271 = 85;
+enum { E1272_0 = 0, E1272_1 = 4, E1272_2 = 8 } e1272;
+short table1273[3][7] = { { 35, 42 } };
+struct s1274 {
+    unsigned long long **f0;
+    int **f1;
+    short **f2;
+    unsigned long long f3;
+    long **f4;
+    float *f5;
+    signed char *f6;
+    signed char **f7;
+} s1274_default, *s1274_list;
+struct s1275 {
+    short *f0;
+    unsigned long long **f1;
+    char **f2;
+    long f3;
+} s1275_default, *s1275_list;
+static unsigned long long (*handler1276)(int, int *);
+extern char proto1277(double *arg0, short arg1, unsigned long long arg2, char *arg3, signed char arg4);
+static const unsigned long long *const v1278 = 0, w1278 = 36;
+int table1279[19][4] = { { 71, 59 } };
+struct s1280 {
+    int **f0;
+    int *f1;
+} s1280_default, *s1280_list;
+static long (*handler1281)(int, long *);
+struct s1282 {
+    signed char *f0;
+    signed char *f1;
+    signed char f2;
+} s1282_default, *s1282_list;
+short table1283[35][5] = { { 86, 73 } };
+int table1284[21][6] = { { 56, 43 } };
+enum { E1285_0 = 0, E1285_1 = 4, E1285_2 = 8, E1285_3 = 12, E1285_4 = 16 } e1285;
+static const const char *const v1286 = 0, w1286 = 37;
+static const double *const v1287 = 0, w1287 = 38;
+static const unsigned int *const v1288 = 0, w1288 = 92;
+long table1289[13][8] = { { 64, 52 } };
+static const float *const v1290 = 0, w1290 = 39;
+short table1291[40][3] = { { 37, 93 } };
+static const signed char *const v1292 = 0, w1292 = 66;
+short table1293[28][2] = { { 13, 54 } };
+static char (*handler1294)(int, signed char *);
+struct s1295 {
+    const char f0;
+    const char *f1;
+    unsigned int f2;
+    const char f3;
+    unsigned long long **f4;
+    char **f5;
+} s1295_default, *s1295_list;
+static const unsigned long long *const v1296 = 0, w1296 = 17;
+struct s1297 {
+    char f0;
+    unsigned int f1;
+    unsigned int *f2;
+} s1297_default, *s1297_list;
+static const char (*handler1298)(int, double *);
+extern signed char proto1299(char arg0, float *arg1, double arg2, short *arg3, const char arg4);
+static double (*handler1300)(int, unsigned long long *);
+struct s1301 {
+    const char **f0;
+    float f1;
+    signed char f2;
+    unsigned long long *f3;
+    char *f4;
+    unsigned int *f5;
+} s1301_default, *s1301_list;
+long table1302[35][5] = { { 41, 1 } };
+struct s1303 {
+    const char *f0;
+    int **f1;
+    const char *f2;
+} s1303_default, *s1303_list;
+static const unsigned int *const v1304 = 0, w1304 = 46;
+long table1305[53][5] = { { 11, 40 } };
+long table1306[57][7] = { { 62, 52 } };
+struct s1307 {
+    short *f0;
+    int **f1;
+    int *f2;
+    unsigned int **f3;
+    float f4;
+    unsigned long long f5;
+} s1307_default, *s1307_list;
+enum { E1308_0 = 0, E1308_1 = 4, E1308_2 = 8, E1308_3 = 12, E1308_4 = 16, E1308_5 = 20, E1308_6 = 24, E1308_7 = 28, E1308_8 = 32 } e1308;
+static const short *const v1309 = 0, w1309 = 43;
+static char (*handler1310)(int, unsigned long long *);
+struct s1311 {
+    short *f0;
+    int **f1;
+    unsigned int f2;
+    unsigned int **f3;
+    int *f4;
+    double f5;
+    const char **f6;
+} s1311_default, *s1311_list;
+extern const char proto1312(signed char *arg0, float *arg1, unsigned long long arg2);
+short table1313[24][2] = { { 68, 31 } };
+extern unsigned long long proto1314(long arg0, double *arg1, char arg2);
+extern unsigned long long proto1315(int arg0, short *arg1);
+int table1316[61][3] = { { 87, 4 } };
+enum { E1317_0 = 0, E1317_1 = 4, E1317_2 = 8, E1317_3 = 12, E1317_4 = 16, E1317_5 = 20, E1317_6 = 24, E1317_7 = 28, E1317_8 = 32 } e1317;
+static const unsigned long long *const v1318 = 0, w1318 = 7;
+enum { E1319_0 = 0, E1319_1 = 4, E1319_2 = 8, E1319_3 = 12, E1319_4 = 16, E1319_5 = 20, E1319_6 = 24, E1319_7 = 28, E1319_8 = 32 } e1319;
+static const short *const v1320 = 0, w1320 = 44;
+static const short *const v1321 = 0, w1321 = 100;
+static const int *const v1322 = 0, w1322 = 9;
+short table1323[10][3] = { { 52, 71 } };
+static const int *const v1324 = 0, w1324 = 66;
+static const int *const v1325 = 0, w1325 = 89;
+int table1326[32][2] = { { 37, 85 } };
+static const const char *const v1327 = 0, w1327 = 7;
+enum { E1328_0 = 0, E1328_1 = 4, E1328_2 = 8, E1328_3 = 12, E1328_4 = 16 } e1328;
+static float (*handler1329)(int, long *);
+struct s1330 {
+    long f0;
+    unsigned long long f1;
+} s1330_default, *s1330_list;
+struct s1331 {
+    unsigned int **f0;
+    char **f1;
+} s1331_default, *s1331_list;
+struct s1332 {
+    short f0;
+    long *f1;
+    unsigned int *f2;
+    unsigned long long f3;
+    int *f4;
+} s1332_default, *s1332_list;
+int table1333[55][6] = { { 47, 48 } };
+extern unsigned long long proto1334(void);
+static const signed char *const v1335 = 0, w1335 = 64;
+short table1336[49][7] = { { 97, 63 } };
+static const double *const v1337 = 0, w1337 = 16;
+static const short *const v1338 = 0, w1338 = 72;
+long table1339[1][6] = { { 13, 1 } };
+static const unsigned long long *const v1340 = 0, w1340 = 58;
+static unsigned long long (*handler1341)(int, unsigned int *);
+static char (*handler1342)(int, const char *);
+static const unsigned int *const v1343 = 0, w1343 = 78;
+static const double *const v1344 = 0, w1344 = 91;
+static const char (*handler1345)(int, signed char *);
+struct s1346 {
+    int *f0;
+    const char f1;
+    signed char *f2;
+    double f3;
+    signed char *f4;
+    short *f5;
+    unsigned long long f6;
+    short **f7;
+} s1346_default, *s1346_list;
+struct s1347 {
+    int *f0;
+    int **f1;
+    int f2;
+} s1347_default, *s1347_list;
+extern unsigned int proto1348(signed char *arg0, int arg1, double *arg2, char arg3);
+short table1349[23][2] = { { 27, 45 } };
+static unsigned long long (*handler1350)(int, unsigned long long *);
+static const double *const v1351 = 0, w1351 = 44;
+struct s1352 {
+    float *f0;
+    float *f1;
+} s1352_default, *s1352_list;
+static unsigned long long (*handler1353)(int, signed char *);
+static short (*handler1354)(int, char *);
+static const const char *const v1355 = 0, w1355 = 87;
+static float (*handler1356)(int, unsigned long long *);
+static const signed char *const v1357 = 0, w1357 = 80;
+static char (*handler1358)(int, unsigned long long *);
+static float (*handler1359)(int, double *);
+struct s1360 {
+    float *f0;
+    short *f1;
+    long **f2;
+    long f3;
+    char **f4;
+    char **f5;
+} s1360_default, *s1360_list;
+extern long proto1361(float *arg0);
+extern char proto1362(long *arg0, short *arg1, double *arg2);
+extern short proto1363(char *arg0, const char *arg1);
+struct s1364 {
+    int *f0;
+    const char *f1;
+    const char *f2;
+    long **f3;
+    long **f4;
+    char f5;
+    signed char f6;
+    unsigned long long *f7;
+} s1364_default, *s1364_list;
+enum { E1365_0 = 0, E1365_1 = 4, E1365_2 = 8, E1365_3 = 12, E1365_4 = 16, E1365_5 = 20, E1365_6 = 24, E1365_7 = 28 } e1365;
+long table1366[9][2] = { { 2, 17 } };
+extern unsigned int proto1367(unsigned long long arg0, float arg1);
+static signed char (*handler1368)(int, float *);
+static const signed char *const v1369 = 0, w1369 = 83;
+int table1370[48][5] = { { 27, 83 } };
+short table1371[36][8] = { { 21, 42 } };
+extern short proto1372(unsigned long long arg0, unsigned long long arg1, char *arg2, unsigned long long *arg3, int *arg4);
+static const signed char *const v1373 = 0, w1373 = 88;
+enum { E1374_0 = 0, E1374_1 = 4, E1374_2 = 8, E1374_3 = 12, E1374_4 = 16 } e1374;
+struct s1375 {
+    double *f0;
+    char *f1;
+    const char *f2;
+    float *f3;
+} s1375_default, *s1375_list;
+struct s1376 {
+    double *f0;
+    const char **f1;
+    unsigned long long *f2;
+    int **f3;
+} s1376_default, *s1376_list;
+struct s1377 {
+    signed char f0;
+    long **f1;
+    const char *f2;
+    const char **f3;
+    float f4;
+    float f5;
+    signed char *f6;
+    char f7;
+} s1377_default, *s1377_list;
+extern const char proto1378(unsigned int arg0, short *arg1);
+static signed char (*handler1379)(int, float *);
+struct s1380 {
+    char **f0;
+    int f1;
+    unsigned int f2;
+    double f3;
+    unsigned int *f4;
+    short f5;
+} s1380_default, *s1380_list;
+enum { E1381_0 = 0, E1381_1 = 4 } e1381;
+static unsigned long long (*handler1382)(int, const char *);
+enum { E1383_0 = 0, E1383_1 = 4, E1383_2 = 8, E1383_3 = 12, E1383_4 = 16, E1383_5 = 20, E1383_6 = 24 } e1383;
+enum { E1384_0 = 0, E1384_1 = 4, E1384_2 = 8, E1384_3 = 12, E1384_4 = 16, E1384_5 = 20 } e1384;
+static const char (*handler1385)(int, signed char *);
+int table1386[55][3] = { { 55, 41 } };
+static const int *const v1387 = 0, w1387 = 12;
+static float (*handler1388)(int, unsigned int *);
+static double (*handler1389)(int, char *);
+enum { E1390_0 = 0, E1390_1 = 4, E1390_2 = 8, E1390_3 = 12, E1390_4 = 16 } e1390;
+short table1391[17][3] = { { 84, 90 } };
+long table1392[64][3] = { { 44, 82 } };
+long table1393[14][8] = { { 15, 48 } };
+enum { E1394_0 = 0, E1394_1 = 4, E1394_2 = 8, E1394_3 = 12, E1394_4 = 16, E1394_5 = 20, E1394_6 = 24, E1394_7 = 28 } e1394;
+static const unsigned int *const v1395 = 0, w1395 = 87;
+extern unsigned int proto1396(void);
+extern float proto1397(signed char *arg0, long arg1, short *arg2);
+int table1398[4][6] = { { 36, 25 } };
+extern char proto1399(unsigned int arg0, signed char arg1, unsigned int *arg2);
+struct s1400 {
+    unsigned int *f0;
+    unsigned int **f1;
+    int *f2;
+    long *f3;
+    char **f4;
+    const char *f5;
+    float f6;
+    float f7;
+} s1400_default, *s1400_list;
+static const long *const v1401 = 0, w1401 = 37;
+extern long proto1402(short arg0, char *arg1);
+extern float proto1403(signed char *arg0, double *arg1, unsigned long long *arg2, unsigned int *arg3, unsigned int arg4);
+struct s1404 {
+    int *f0;
+    unsigned int *f1;
+} s1404_default, *s1404_list;
+struct s1405 {
+    const char **f0;
+    unsigned int *f1;
+    int *f2;
+} s1405_default, *s1405_list;
+int table1406[63][8] = { { 73, 96 } };
+int table1407[56][6] = { { 7, 92 } };
+static double (*handler1408)(int, unsigned long long *);
+enum { E1409_0 = 0, E1409_1 = 4, E1409_2 = 8 } e1409;
+enum { E1410_0 = 0, E1410_1 = 4, E1410_2 = 8, E1410_3 = 12 } e1410;
+extern short proto1411(double arg0, unsigned long long arg1, int arg2, double arg3);
+static const float *const v1412 = 0, w1412 = 87;
+static char (*handler1413)(int, unsigned int *);
+short table1414[60][4] = { { 67, 85 } };
+int table1415[61][3] = { { 42, 99 } };
+enum { E1416_0 = 0, E1416_1 = 4, E1416_2 = 8, E1416_3 = 12, E1416_4 = 16, E1416_5 = 20, E1416_6 = 24, E1416_7 = 28 } e1416;
+enum { E1417_0 = 0, E1417_1 = 4, E1417_2 = 8, E1417_3 = 12, E1417_4 = 16, E1417_5 = 20, E1417_6 = 24 } e1417;
+int table1418[53][7] = { { 75, 93 } };
+struct s1419 {
+    float **f0;
+    long *f1;
+    unsigned int f2;
+    short f3;
+} s1419_default, *s1419_list;
+extern const char proto1420(int arg0, short *arg1);
+extern char proto1421(float *arg0, unsigned long long *arg1, const char *arg2, const char *arg3, char arg4);
+long table1422[55][2] = { { 62, 19 } };
+extern int proto1423(double arg0, short *arg1);
+short table1424[24][5] = { { 69, 3 } };
+enum { E1425_0 = 0, E1425_1 = 4, E1425_2 = 8, E1425_3 = 12, E1425_4 = 16, E1425_5 = 20, E1425_6 = 24, E1425_7 = 28, E1425_8 = 32 } e1425;
+struct s1426 {
+    unsigned int *f0;
+    unsigned long long f1;
+    const char f2;
+    double f3;
+    long f4;
+    long f5;
+    unsigned long long **f6;
+} s1426_default, *s1426_list;
+enum { E1427_0 = 0, E1427_1 = 4, E1427_2 = 8 } e1427;
+extern short proto1428(int *arg0, signed char arg1, short arg2, signed char arg3, unsigned long long arg4);
+int table1429[28][4] = { { 42, 5 } };
+enum { E1430_0 = 0, E1430_1 = 4 } e1430;
+int table1431[41][6] = { { 87, 4 } };
+struct s1432 {
+    const char **f0;
+    double f1;
+    const char *f2;
+    float **f3;
+    float **f4;
+    unsigned int **f5;
+    short **f6;
+} s1432_default, *s1432_list;
+struct s1433 {
+    char *f0;
+    signed char **f1;
+    int f2;
+    short *f3;
+    long **f4;
+} s1433_default, *s1433_list;
+struct s1434 {
+    int f0;
+    double **f1;
+} s1434_default, *s1434_list;
+struct s1435 {
+    double **f0;
+    unsigned long long **f1;
+    long **f2;
+    short **f3;
+    unsigned int *f4;
+    int *f5;
+} s1435_default, *s1435_list;
+extern short proto1436(int arg0, short arg1, unsigned long long arg2);
+extern short proto1437(const char arg0, double arg1, int *arg2);
+extern short proto1438(signed char arg0, double arg1, float arg2);
+enum { E1439_0 = 0, E1439_1 = 4, E1439_2 = 8, E1439_3 = 12, E1439_4 = 16, E1439_5 = 20 } e1439;
+static const signed char *const v1440 = 0, w1440 = 42;
+enum { E1441_0 = 0, E1441_1 = 4, E1441_2 = 8, E1441_3 = 12 } e1441;
+enum { E1442_0 = 0, E1442_1 = 4, E1442_2 = 8, E1442_3 = 12, E1442_4 = 16, E1442_5 = 20 } e1442;
+static double (*handler1443)(int, float *);
+struct s1444 {
+    char *f0;
+    unsigned long long **f1;
+    const char f2;
+    signed char **f3;
+    long *f4;
+} s1444_default, *s1444_list;
+extern signed char proto1445(double arg0, int arg1, short arg2, short *arg3);
+struct s1446 {
+    float **f0;
+    short **f1;
+    long *f2;
+    long *f3;
+    float *f4;
+    double f5;
+    unsigned int **f6;
+} s1446_default, *s1446_list;
+extern long proto1447(short *arg0, double *arg1, double arg2, unsigned int arg3);
+static const double *const v1448 = 0, w1448 = 0;
+extern float proto1449(float *arg0);
+struct s1450 {
+    long **f0;
+    signed char **f1;
+    signed char f2;
+    unsigned int **f3;
+    unsigned long long *f4;
+    long **f5;
+} s1450_default, *s1450_list;
+enum { E1451_0 = 0, E1451_1 = 4, E1451_2 = 8, E1451_3 = 12, E1451_4 = 16, E1451_5 = 20, E1451_6 = 24 } e1451;
+enum { E1452_0 = 0, E1452_1 = 4, E1452_2 = 8, E1452_3 = 12, E1452_4 = 16, E1452_5 = 20 } e1452;
+struct s1453 {
+    float **f0;
+    short f1;
+    char **f2;
+    signed char *f3;
+    unsigned long long f4;
+} s1453_default, *s1453_list;
+struct s1454 {
+    unsigned int f0;
+    unsigned int *f1;
+    long **f2;
+} s1454_default, *s1454_list;
+static char (*handler1455)(int, long *);
+enum { E1456_0 = 0, E1456_1 = 4, E1456_2 = 8, E1456_3 = 12, E1456_4 = 16 } e1456;
+int table1457[4][2] = { { 4, 61 } };
+int table1458[29][8] = { { 1, 15 } };
+enum { E1459_0 = 0, E1459_1 = 4, E1459_2 = 8 } e1459;
+int table1460[17][4] = { { 83, 76 } };
+extern long proto1461(unsigned int arg0, unsigned int arg1, short arg2, double arg3, double arg4);
+enum { E1462_0 = 0, E1462_1 = 4, E1462_2 = 8, E1462_3 = 12, E1462_4 = 16, E1462_5 = 20, E1462_6 = 24, E1462_7 = 28, E1462_8 = 32, E1462_9 = 36 } e1462;
+struct s1463 {
+    int f0;
+    char *f1;
+    short **f2;
+    unsigned long long **f3;
+    int *f4;
+    long f5;
+    char f6;
+} s1463_default, *s1463_list;
+int table1464[3][6] = { { 53, 69 } };
+static unsigned long long (*handler1465)(int, unsigned int *);
+static unsigned int (*handler1466)(int, long *);
+static const long *const v1467 = 0, w1467 = 100;
+int table1468[13][2] = { { 20, 99 } };
+extern unsigned int proto1469(int arg0, signed char *arg1, double *arg2, const char arg3);
+enum { E1470_0 = 0, E1470_1 = 4, E1470_2 = 8, E1470_3 = 12, E1470_4 = 16 } e1470;
+enum { E1471_0 = 0, E1471_1 = 4, E1471_2 = 8, E1471_3 = 12 } e1471;
+long table1472[27][8] = { { 78, 17 } };
+long table1473[48][3] = { { 54, 12 } };
+static char (*handler1474)(int, unsigned int *);
+static const unsigned int *const v1475 = 0, w1475 = 34;
+extern unsigned int proto1476(unsigned int arg0, float *arg1, double arg2);
+static unsigned long long (*handler1477)(int, long *);
+long table1478[4][6] = { { 47, 79 } };
+struct s1479 {
+    unsigned int *f0;
+    double *f1;
+    float *f2;
+    const char **f3;
+} s1479_default, *s1479_list;
+extern double proto1480(unsigned int arg0, float *arg1);
+enum { E1481_0 = 0, E1481_1 = 4 } e1481;
+static double (*handler1482)(int, unsigned long long *);
+static int (*handler1483)(int, char *);
+extern char proto1484(long *arg0, const char *arg1, long arg2, float *arg3, short *arg4);
+enum { E1485_0 = 0, E1485_1 = 4, E1485_2 = 8, E1485_3 = 12, E1485_4 = 16, E1485_5 = 20, E1485_6 = 24, E1485_7 = 28, E1485_8 = 32 } e1485;
+extern int proto1486(int *arg0, double *arg1, unsigned int arg2, int *arg3);
+short table1487[55][2] = { { 95, 40 } };
+extern char proto1488(int arg0, unsigned int *arg1, unsigned long long arg2);
+struct s1489 {
+    char *f0;
+    const char *f1;
+    unsigned long long f2;
+    signed char **f3;
+    double **f4;
+    const char f5;
+} s1489_default, *s1489_list;
+short table1490[3][2] = { { 34, 29 } };
+static float (*handler1491)(int, char *);
+static const const char *const v1492 = 0, w1492 = 73;
+extern unsigned int proto1493(void);
+long table1494[34][6] = { { 61, 54 } };
+static const unsigned long long *const v1495 = 0, w1495 = 35;
+enum { E1496_0 = 0, E1496_1 = 4, E1496_2 = 8 } e1496;
+struct s1497 {
+    long **f0;
+    double **f1;
+    float *f2;
+} s1497_default, *s1497_list;
+long table1498[16][7] = { { 75, 50 } };
+static float (*handler1499)(int, int *);
@@ -0,0 +1,81 @@
+#include <string.h>
+
+#include <workload.h>
+
+const char *workload_names[workload_count] = {
+    "parens",
+    "casts",
+    "args",
+    "decls",
+    "inits",
+};
+
+const int workload_max_n[workload_count] = {
+    4096,
+    4096,
+    1 << 18,
+    1 << 18,
+    1 << 18,
+};
+
+int workload_shape_parse(const char *name, workload_shape *shape) {
+    for (int i = 0; i < workload_count; i++) {
+        if (strcmp(name, workload_names[i]) == 0) {
+            *shape = i;
+            return 0;
+        }
+    }
+    return 1;
+}
+
+void workload_generate(ciwic_sink *sink, workload_shape shape, int n) {
+    switch (shape) {
+        case workload_parens:
+            ciwic_sink_str(sink, "int x = ");
+            for (int i = 0; i < n; i++) {
+                ciwic_sink_char(sink, '(');
+            }
+            ciwic_sink_char(sink, '1');
+            for (int i = 0; i < n; i++) {
+                ciwic_sink_char(sink, ')');
+            }
+            ciwic_sink_str(sink, ";\n");
+            break;
+        case workload_casts:
+            ciwic_sink_str(sink, "long x = ");
+            for (int i = 0; i < n; i++) {
+                ciwic_sink_str(sink, i % 2 ? "(long)" : "(int)");
+            }
+            ciwic_sink_str(sink, "1;\n");
+            break;
+        case workload_args:
+            ciwic_sink_str(sink, "void f(void)\n{\n    g(");
+            for (int i = 0; i < n; i++) {
+                if (i > 0) {
+                    ciwic_sink_str(sink, i % 8 ? ", " : ",\n        ");
+                }
+                ciwic_sink_str(sink, "a");
+                ciwic_sink_int(sink, i);
+            }
+            ciwic_sink_str(sink, ");\n}\n");
+            break;
+        case workload_decls:
+            for (int i = 0; i < n; i++) {
+                ciwic_sink_str(sink, i % 3 ? "int v" : "static unsigned long *p");
+                ciwic_sink_int(sink, i);
+                ciwic_sink_str(sink, i % 2 ? ";\n" : " = 0;\n");
+            }
+            break;
+        case workload_inits:
+            ciwic_sink_str(sink, "int x[] = {");
+            for (int i = 0; i < n; i++) {
+                ciwic_sink_str(sink, i % 8 ? " " : "\n    ");
+                ciwic_sink_int(sink, i);
+                ciwic_sink_char(sink, ',');
+            }
+            ciwic_sink_str(sink, "\n};\n");
+            break;
+        default:
+            break;
+    }
+}
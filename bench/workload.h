@@ -0,0 +1,24 @@
+#pragma once
+
+#include <sink.h>
+
+// Synthetic inputs that stress one shape of C each, at a size n
+
+typedef enum {
+    workload_parens, // An initializer in n nested parentheses
+    workload_casts, // An initializer behind n casts
+    workload_args, // A call with n arguments
+    workload_decls, // n top-level declarations
+    workload_inits, // An initializer list of n elements
+    workload_count,
+} workload_shape;
+
+extern const char *workload_names[workload_count];
+
+// Nesting shapes recurse once per level in the parser, so they are only
+// scaled up to a smaller n
+extern const int workload_max_n[workload_count];
+
+int workload_shape_parse(const char *name, workload_shape *shape);
+
+void workload_generate(ciwic_sink *sink, workload_shape shape, int n);
@@ -0,0 +1,394 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <hash.h>
+#include <parser.h>
+#include <profile.h>
+
+// Fuzzer for slow inputs
+//
+// Parses inputs with the rule counters of the profiling build and measures
+// the work they take as rule calls per input byte. The feedback is which
+// rules reached which power of two of calls per byte, so inputs that make
+// any rule do more work per byte than seen before are kept and mutated
+// further. Inputs over a threshold of calls per byte are saved.
+//
+// Built with CIWIC_LIBFUZZER this is a libFuzzer target that reports the
+// same feedback as extra counters. Otherwise it has its own mutation loop:
+//
+//   fuzz [-n iterations] [-m max len] [-t calls per byte] [-o dir] [seed...]
+//
+// and with -c it only reports the calls per byte of each file given. With -b
+// it also fails if a file takes more than the bound recorded for it in the
+// bounds file, whose lines are a file name and its calls per byte.
+//
+// fuzz/slow holds the slow inputs found so far. Most are unbalanced
+// parentheses, where every level is tried as a cast, a parenthesized
+// expression and a call before failing, so the work grows exponentially
+// with the nesting depth.
+
+#define FUZZ_BUCKETS 16
+#define FUZZ_THRESHOLD 100.0
+// Steps after which a parse is stopped, so exponential inputs are still
+// found but do not hang the fuzzer
+#define FUZZ_MAX_STEPS (1L << 24)
+
+static ciwic_parser parser;
+static ciwic_profile profile;
+static int initialized;
+
+#ifdef CIWIC_LIBFUZZER
+__attribute__((used, section("__libfuzzer_extra_counters")))
+#endif
+static uint8_t features[ciwic_rule_count * FUZZ_BUCKETS];
+
+// Parses data and returns its rule calls per byte, setting a feature for
+// every rule at the log2 of its calls per byte
+double fuzz_run(const uint8_t *data, size_t size) {
+    if (!initialized) {
+        parser = ciwic_parser_new(NULL, 0);
+        parser.limits.max_steps = FUZZ_MAX_STEPS;
+        initialized = 1;
+    }
+
+    char *text = malloc(size + 1);
+    memcpy(text, data, size);
+    text[size] = 0;
+
+    ciwic_translation_unit translation_unit;
+    ciwic_profile_init(&profile);
+    parser.profile = &profile;
+    ciwic_parser_reset(&parser, text, size);
+    ciwic_parser_translation_unit(&parser, &translation_unit);
+
+    uint64_t calls = 0;
+    size_t bytes = size > 0 ? size : 1;
+
+    for (int rule = 0; rule < ciwic_rule_count; rule++) {
+        uint64_t per_byte = profile.rules[rule].calls / bytes;
+        int bucket = 0;
+        while (per_byte > 0 && bucket < FUZZ_BUCKETS - 1) {
+            per_byte >>= 1;
+            bucket++;
+        }
+        if (profile.rules[rule].calls > 0) {
+            features[rule * FUZZ_BUCKETS + bucket] = 1;
+        }
+        calls += profile.rules[rule].calls;
+    }
+
+    free(text);
+    return (double) calls / bytes;
+}
+
+#ifdef CIWIC_LIBFUZZER
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    double work = fuzz_run(data, size);
+    const char *threshold = getenv("CIWIC_FUZZ_THRESHOLD");
+
+    if (work > (threshold != NULL ? atof(threshold) : FUZZ_THRESHOLD)) {
+        fprintf(stderr, "slow input: %.1f calls per byte\n", work);
+        abort();
+    }
+    return 0;
+}
+
+#else
+
+typedef struct {
+    char *data;
+    int len;
+} fuzz_input;
+
+static const char *fuzz_tokens[] = {
+    "(", ")", "(int)", "(long *)", "[", "]", "{", "}", ",", ";", "*", "&",
+    "int", "x", "1", "0x1f", "?", ":", "=", "==", "->", ".", "sizeof",
+    "struct s", "if (x)", "else", "while (1)", "f(", "/*", "*/", "//\n",
+    "\\\n", "?\?(", "?\?)", "<:", ":>", "<%", "%>", " ", "\n", "a b", "++",
+};
+
+int fuzz_random(int n) {
+    return rand() % n;
+}
+
+// Applies one random change to input, keeping it under max_len bytes
+void fuzz_mutate(fuzz_input *input, fuzz_input *corpus, int corpus_len, int max_len) {
+    int pos = fuzz_random(input->len + 1);
+    int kind = fuzz_random(5);
+
+    if (kind == 0 && input->len > 0) {
+        // Delete a range
+        int len = 1 + fuzz_random(input->len - pos + 1 < 8 ? input->len - pos + 1 : 8);
+        if (pos + len > input->len) {
+            len = input->len - pos;
+        }
+        memmove(&input->data[pos], &input->data[pos + len], input->len - pos - len);
+        input->len -= len;
+        return;
+    }
+
+    const char *insert;
+    int len;
+    char c;
+
+    if (kind == 1 && input->len > 0) {
+        // Duplicate a range
+        int start = fuzz_random(input->len);
+        len = 1 + fuzz_random(input->len - start);
+        insert = &input->data[start];
+    } else if (kind == 2) {
+        // Splice in part of another input
+        fuzz_input *other = &corpus[fuzz_random(corpus_len)];
+        if (other->len == 0) {
+            return;
+        }
+        int start = fuzz_random(other->len);
+        len = 1 + fuzz_random(other->len - start);
+        insert = &other->data[start];
+    } else if (kind == 3) {
+        c = 32 + fuzz_random(95);
+        insert = &c;
+        len = 1;
+    } else {
+        insert = fuzz_tokens[fuzz_random(sizeof(fuzz_tokens) / sizeof(fuzz_tokens[0]))];
+        len = strlen(insert);
+    }
+
+    if (input->len + len > max_len) {
+        return;
+    }
+
+    // insert may point into input itself
+    char *copy = malloc(len);
+    memcpy(copy, insert, len);
+    memmove(&input->data[pos + len], &input->data[pos], input->len - pos);
+    memcpy(&input->data[pos], copy, len);
+    input->len += len;
+    free(copy);
+}
+
+int fuzz_save(const char *dir, fuzz_input *input, double work) {
+    char path[4096];
+    uint64_t hash = ciwic_hash64(input->data, input->len, 0);
+    snprintf(path, sizeof(path), "%s/slow-%.0f-%016llx.c", dir, work, (unsigned long long) hash);
+
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) {
+        return 1;
+    }
+    fwrite(input->data, 1, input->len, file);
+    fclose(file);
+
+    printf("saved %s\n", path);
+    return 0;
+}
+
+int fuzz_read(const char *path, fuzz_input *input, int max_len) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return 1;
+    }
+
+    input->data = malloc(max_len);
+    input->len = fread(input->data, 1, max_len, file);
+    fclose(file);
+    return 0;
+}
+
+typedef struct {
+    char name[256];
+    double calls;
+} fuzz_bound;
+
+// Reads the bounds file at path. Returns 0 on success.
+int fuzz_read_bounds(const char *path, fuzz_bound **bounds, int *len) {
+    FILE *file = fopen(path, "r");
+    if (file == NULL) {
+        return 1;
+    }
+
+    char line[512];
+    int cap = 16;
+    *bounds = malloc(sizeof(fuzz_bound) * cap);
+    *len = 0;
+
+    while (fgets(line, sizeof(line), file) != NULL) {
+        if (line[0] == '#' || line[0] == '\n') {
+            continue;
+        }
+        if (*len == cap) {
+            cap *= 2;
+            *bounds = realloc(*bounds, sizeof(fuzz_bound) * cap);
+        }
+        fuzz_bound *bound = &(*bounds)[*len];
+        if (sscanf(line, "%255s %lf", bound->name, &bound->calls) != 2) {
+            fclose(file);
+            return 1;
+        }
+        (*len)++;
+    }
+
+    fclose(file);
+    return 0;
+}
+
+// Returns the bound recorded for the file at path, or -1 if there is none
+double fuzz_find_bound(fuzz_bound *bounds, int len, const char *path) {
+    const char *name = strrchr(path, '/');
+    name = name != NULL ? name + 1 : path;
+
+    for (int i = 0; i < len; i++) {
+        if (strcmp(bounds[i].name, name) == 0) {
+            return bounds[i].calls;
+        }
+    }
+    return -1;
+}
+
+int main(int argc, char **argv) {
+    long iterations = 1000000;
+    int max_len = 4096;
+    double threshold = FUZZ_THRESHOLD;
+    const char *dir = "fuzz/slow";
+    int check = 0;
+    fuzz_bound *bounds = NULL;
+    int bounds_len = 0;
+    int res = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:m:t:o:cb:")) != -1) {
+        switch (opt) {
+            case 'n':
+                iterations = atol(optarg);
+                break;
+            case 'm':
+                max_len = atoi(optarg);
+                break;
+            case 't':
+                threshold = atof(optarg);
+                break;
+            case 'o':
+                dir = optarg;
+                break;
+            case 'c':
+                check = 1;
+                break;
+            case 'b':
+                if (fuzz_read_bounds(optarg, &bounds, &bounds_len)) {
+                    fprintf(stderr, "Error: could not read bounds from %s\n", optarg);
+                    return 1;
+                }
+                break;
+            default:
+                fprintf(stderr, "Usage: %s [-n iterations] [-m max len] [-t calls per byte] [-o dir] [-c [-b bounds]] [seed...]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    int corpus_cap = 1024;
+    int corpus_len = 0;
+    fuzz_input *corpus = malloc(sizeof(fuzz_input) * corpus_cap);
+
+    for (int i = optind; i < argc; i++) {
+        if (fuzz_read(argv[i], &corpus[corpus_len], max_len)) {
+            fprintf(stderr, "Error: could not read %s\n", argv[i]);
+            return 1;
+        }
+
+        double work = fuzz_run((uint8_t *) corpus[corpus_len].data, corpus[corpus_len].len);
+        if (check) {
+            double bound = fuzz_find_bound(bounds, bounds_len, argv[i]);
+            if (bound >= 0 && work > bound) {
+                printf("%s: %.1f calls per byte, over the bound of %.0f\n", argv[i], work, bound);
+                res = 1;
+            } else {
+                printf("%s: %.1f calls per byte\n", argv[i], work);
+            }
+            free(corpus[corpus_len].data);
+            continue;
+        }
+
+        if (++corpus_len == corpus_cap) {
+            corpus_cap *= 2;
+            corpus = realloc(corpus, sizeof(fuzz_input) * corpus_cap);
+        }
+    }
+
+    if (check) {
+        return res;
+    }
+
+    if (corpus_len == 0) {
+        corpus[0].data = malloc(max_len);
+        corpus[0].len = sprintf(corpus[0].data, "int f(void) { x = (1); }\n");
+        fuzz_run((uint8_t *) corpus[0].data, corpus[0].len);
+        corpus_len = 1;
+    }
+
+    mkdir(dir, 0755);
+    srand(time(NULL));
+
+    uint8_t seen[sizeof(features)];
+    memcpy(seen, features, sizeof(seen));
+    double best = 0;
+
+    fuzz_input input;
+    input.data = malloc(max_len);
+
+    for (long i = 0; i < iterations; i++) {
+        fuzz_input *parent = &corpus[fuzz_random(corpus_len)];
+        memcpy(input.data, parent->data, parent->len);
+        input.len = parent->len;
+
+        int mutations = 1 + fuzz_random(4);
+        for (int j = 0; j < mutations; j++) {
+            fuzz_mutate(&input, corpus, corpus_len, max_len);
+        }
+
+        memset(features, 0, sizeof(features));
+        double work = fuzz_run((uint8_t *) input.data, input.len);
+
+        int interesting = 0;
+        for (size_t j = 0; j < sizeof(features); j++) {
+            if (features[j] && !seen[j]) {
+                seen[j] = 1;
+                interesting = 1;
+            }
+        }
+
+        if (work > threshold && work > best) {
+            fuzz_save(dir, &input, work);
+        }
+
+        if (work > best) {
+            best = work;
+            interesting = 1;
+        }
+
+        if (interesting) {
+            if (corpus_len == corpus_cap) {
+                corpus_cap *= 2;
+                corpus = realloc(corpus, sizeof(fuzz_input) * corpus_cap);
+            }
+            corpus[corpus_len].data = malloc(max_len);
+            memcpy(corpus[corpus_len].data, input.data, input.len);
+            corpus[corpus_len].len = input.len;
+            corpus_len++;
+        }
+
+        if ((i + 1) % 10000 == 0) {
+            printf("%ld runs, corpus %d, most calls per byte %.1f\n", i + 1, corpus_len, best);
+            fflush(stdout);
+        }
+    }
+
+    return 0;
+}
+
+#endif
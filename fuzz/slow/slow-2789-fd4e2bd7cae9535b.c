@@ -0,0 +1 @@
+int f{(((((((()(11
\ No newline at end of file
@@ -0,0 +1 @@
+int f{(((((l((((l<:ong ((((l((((long *song *;sizweo*so;sizweo*song *;sizweof) (1ng *;sizweof) (1
\ No newline at end of file
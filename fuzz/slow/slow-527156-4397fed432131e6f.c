@@ -0,0 +1 @@
+int f{(((((l(((n((((((((g *soweol((((loning fHint) (1(1
\ No newline at end of file
@@ -0,0 +1,75 @@
+#include <stdalign.h>
+#include <stdlib.h>
+
+#include <arena.h>
+
+#define CIWIC_ARENA_ALIGN alignof(max_align_t)
+#define CIWIC_ARENA_MIN_CHUNK (64 * 1024)
+
+void ciwic_arena_init(ciwic_arena *arena) {
+    arena->first = NULL;
+    arena->current = NULL;
+    arena->used = 0;
+}
+
+void ciwic_arena_free(ciwic_arena *arena) {
+    ciwic_arena_chunk *chunk = arena->first;
+    while (chunk != NULL) {
+        ciwic_arena_chunk *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    ciwic_arena_init(arena);
+}
+
+void ciwic_arena_reset(ciwic_arena *arena) {
+    arena->current = arena->first;
+    arena->used = 0;
+}
+
+// Moves to the next chunk with room for size bytes, adding one at the end of
+// the chain if there is none
+void ciwic_arena_grow(ciwic_arena *arena, size_t size) {
+    ciwic_arena_chunk *last = arena->current;
+    ciwic_arena_chunk *chunk = last != NULL ? last->next : arena->first;
+
+    while (chunk != NULL) {
+        if (chunk->size >= size) {
+            arena->current = chunk;
+            arena->used = 0;
+            return;
+        }
+        last = chunk;
+        chunk = chunk->next;
+    }
+
+    size_t chunk_size = last != NULL ? last->size * 2 : CIWIC_ARENA_MIN_CHUNK;
+    if (chunk_size < size) {
+        chunk_size = size;
+    }
+
+    chunk = malloc(sizeof(ciwic_arena_chunk) + chunk_size);
+    chunk->next = NULL;
+    chunk->size = chunk_size;
+
+    if (last != NULL) {
+        last->next = chunk;
+    } else {
+        arena->first = chunk;
+    }
+
+    arena->current = chunk;
+    arena->used = 0;
+}
+
+void *ciwic_arena_alloc(ciwic_arena *arena, size_t size) {
+    size = (size + CIWIC_ARENA_ALIGN - 1) & ~(CIWIC_ARENA_ALIGN - 1);
+
+    if (arena->current == NULL || arena->current->size - arena->used < size) {
+        ciwic_arena_grow(arena, size);
+    }
+
+    void *res = &arena->current->data[arena->used];
+    arena->used += size;
+    return res;
+}
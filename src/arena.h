@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stddef.h>
+
+// Bump allocator
+//
+// Memory comes from a chain of chunks that are only freed all at once.
+// Resetting the arena keeps the chunks, so once it has grown to the size a
+// workload needs it stops allocating.
+
+typedef struct ciwic_arena_chunk ciwic_arena_chunk;
+
+struct ciwic_arena_chunk {
+    ciwic_arena_chunk *next; // Can be null
+    size_t size;
+    char data[];
+};
+
+typedef struct {
+    ciwic_arena_chunk *first; // Can be null
+    ciwic_arena_chunk *current; // Can be null
+    size_t used; // Bytes used in current
+} ciwic_arena;
+
+void ciwic_arena_init(ciwic_arena *arena);
+void ciwic_arena_free(ciwic_arena *arena);
+
+// Makes every chunk available again. Anything allocated before is invalid.
+void ciwic_arena_reset(ciwic_arena *arena);
+
+void *ciwic_arena_alloc(ciwic_arena *arena, size_t size);
@@ -1,6 +1,8 @@
 #include <ast.h>
 #include <parser.h>
-#include <stdio.h>
+#include <sink.h>
+#include <stdlib.h>
+#include <string.h>
 
 const char* ciwic_expr_unary_op_table[] = {
     "post dec", "post inc", "pre dec", "pre inc", "ref", "deref", "pos", "neg",
@@ -11,6 +13,13 @@ const char* ciwic_expr_binary_op_table[] = { "mul", "div", "mod", "add",
     "less or eq", "greater or eq", "eq", "neq", "and", "xor", "or", "land",
     "lor", "comma" };
 
+const char* ciwic_node_kind_names[ciwic_node_kind_count] = {
+    "translation unit", "function definition", "declaration",
+    "declaration list", "declaration specifiers", "init declarator list",
+    "declarator", "param list", "type name", "initializer",
+    "initializer list", "designator list", "struct list",
+    "struct declarator list", "enum list", "expr", "arg list", "statement" };
+
 int ciwic_declarator_is_abstract(ciwic_declarator *declarator) {
     if (declarator->type == ciwic_declarator_identifier) {
         return 0;
@@ -22,204 +31,330 @@ int ciwic_declarator_is_abstract(ciwic_declarator *declarator) {
     return 1;
 }
 
-void ciwic_print_constant(ciwic_constant *constant, int indent) {
-    printf("%*cconstant:\n", indent, ' ');
+ciwic_expr *ciwic_expr_chain_operand(ciwic_expr *expr) {
+    switch (expr->type) {
+        case ciwic_expr_type_binary_op:
+            return expr->binary_op.op == ciwic_expr_op_comma ? expr->binary_op.snd : expr->binary_op.fst;
+        case ciwic_expr_type_call:
+            return expr->call.fun;
+        case ciwic_expr_type_subscript:
+            return expr->subscript.val;
+        case ciwic_expr_type_member:
+        case ciwic_expr_type_member_deref:
+            return expr->member.expr;
+        case ciwic_expr_type_unary_op:
+            if (expr->unary_op.op == ciwic_expr_op_post_dec || expr->unary_op.op == ciwic_expr_op_post_inc) {
+                return expr->unary_op.inner;
+            }
+            return NULL;
+        default:
+            return NULL;
+    }
+}
+
+void ciwic_expr_chain_init(ciwic_expr_chain *chain, ciwic_expr *expr) {
+    int cap = sizeof(chain->buf) / sizeof(chain->buf[0]);
+    ciwic_expr *operand;
+
+    chain->links = chain->buf;
+    chain->len = 0;
+
+    while ((operand = ciwic_expr_chain_operand(expr)) != NULL) {
+        if (chain->len == cap) {
+            cap *= 2;
+            if (chain->links == chain->buf) {
+                chain->links = malloc(sizeof(ciwic_expr *) * cap);
+                memcpy(chain->links, chain->buf, sizeof(chain->buf));
+            } else {
+                chain->links = realloc(chain->links, sizeof(ciwic_expr *) * cap);
+            }
+        }
+        chain->links[chain->len++] = expr;
+        expr = operand;
+    }
+
+    chain->leaf = expr;
+}
+
+void ciwic_expr_chain_free(ciwic_expr_chain *chain) {
+    if (chain->links != chain->buf) {
+        free(chain->links);
+    }
+    chain->links = NULL;
+    chain->len = 0;
+}
+
+// Lines nested deeper than this show their indentation as a number, so long
+// lists and chains, which nest one level per item, print in linear space
+#define CIWIC_PRINT_MAX_INDENT 256
+
+// Every line starts with at least one space
+void ciwic_print_label(ciwic_sink *sink, int indent, const char *label) {
+    if (indent > CIWIC_PRINT_MAX_INDENT) {
+        ciwic_sink_indent(sink, CIWIC_PRINT_MAX_INDENT);
+        ciwic_sink_char(sink, '[');
+        ciwic_sink_int(sink, indent);
+        ciwic_sink_str(sink, "] ");
+    } else {
+        ciwic_sink_indent(sink, indent > 0 ? indent : 1);
+    }
+    ciwic_sink_str(sink, label);
+}
 
-    printf("%*ctype: ", indent+4, ' ');
+void ciwic_print_text(ciwic_sink *sink, const char *text, int len) {
+    ciwic_sink_write(sink, text, len);
+    ciwic_sink_char(sink, '\n');
+}
+
+void ciwic_print_field(ciwic_sink *sink, int indent, const char *label, const char *text, int len) {
+    ciwic_print_label(sink, indent, label);
+    ciwic_print_text(sink, text, len);
+}
+
+void ciwic_print_constant(ciwic_sink *sink, ciwic_constant *constant, int indent) {
+    ciwic_print_label(sink, indent, "constant:\n");
+
+    ciwic_print_label(sink, indent+4, "type: ");
     switch (constant->type) {
         case ciwic_constant_integer:
-            printf("integer\n");
+            ciwic_sink_str(sink, "integer\n");
             break;
         case ciwic_constant_float:
-            printf("float\n");
+            ciwic_sink_str(sink, "float\n");
             break;
         case ciwic_constant_char:
-            printf("char\n");
+            ciwic_sink_str(sink, "char\n");
             break;
     }
-    printf("%*ctext: %s\n", indent+4, ' ', constant->raw_text);
+    ciwic_print_field(sink, indent+4, "text: ", constant->raw_text, strlen(constant->raw_text));
 }
 
-void ciwic_print_arg_list(ciwic_expr_arg_list *list, int indent) {
-    printf("%*carg list:\n", indent, ' ');
-    ciwic_print_expr(&list->head, indent+4);
-    if (list->rest != NULL) {
-        ciwic_print_arg_list(list->rest, indent+4);
+void ciwic_print_arg_list(ciwic_sink *sink, ciwic_expr_arg_list *list, int indent) {
+    for (; list != NULL; list = list->rest) {
+        ciwic_print_label(sink, indent, "arg list:\n");
+        ciwic_print_expr(sink, &list->head, indent+4);
+        indent += 4;
     }
 }
 
-void ciwic_print_type_name(ciwic_type_name *name, int indent) {
-    printf("%*ctype name: \n", indent, ' ');
-    ciwic_print_declaration_specifiers(&name->specifiers, indent+4);
+void ciwic_print_type_name(ciwic_sink *sink, ciwic_type_name *name, int indent) {
+    ciwic_print_label(sink, indent, "type name: \n");
+    ciwic_print_declaration_specifiers(sink, &name->specifiers, indent+4);
     if (name->declarator != NULL) 
-        ciwic_print_declarator(name->declarator, indent+4);
+        ciwic_print_declarator(sink, name->declarator, indent+4);
 }
 
-void ciwic_print_designator_list(ciwic_designator_list *list, int indent) {
-    printf("%*cdesignator list: ", indent, ' ');
-
-    switch (list->type) {
-        case ciwic_designator_expr:
-            printf("expr\n");
-            ciwic_print_expr(&list->expr, indent+4);
-            break;
-        case ciwic_designator_ident:
-            printf("ident\n");
-            printf("%*cidentifier: %.*s\n", indent+4, ' ', list->ident.len, list->ident.text);
-            break;
-    }
+void ciwic_print_designator_list(ciwic_sink *sink, ciwic_designator_list *list, int indent) {
+    for (; list != NULL; list = list->rest) {
+        ciwic_print_label(sink, indent, "designator list: ");
+
+        switch (list->type) {
+            case ciwic_designator_expr:
+                ciwic_sink_str(sink, "expr\n");
+                ciwic_print_expr(sink, &list->expr, indent+4);
+                break;
+            case ciwic_designator_ident:
+                ciwic_sink_str(sink, "ident\n");
+                ciwic_print_field(sink, indent+4, "identifier: ", list->ident.text, list->ident.len);
+                break;
+        }
 
-    if (list->rest != NULL) {
-        ciwic_print_designator_list(list->rest, indent+4);
+        indent += 4;
     }
 }
 
-void ciwic_print_initializer_list(ciwic_initializer_list *list, int indent) {
-    printf("%*cinitializer list: \n", indent, ' ');
+void ciwic_print_initializer_list(ciwic_sink *sink, ciwic_initializer_list *list, int indent) {
+    for (; list != NULL; list = list->rest) {
+        ciwic_print_label(sink, indent, "initializer list: \n");
 
-    if (list->designation != NULL) {
-        ciwic_print_designator_list(list->designation, indent+4);
-    }
-
-    ciwic_print_initializer(list->initializer, indent+4);
+        if (list->designation != NULL) {
+            ciwic_print_designator_list(sink, list->designation, indent+4);
+        }
 
-    if (list->rest != NULL) {
-        ciwic_print_initializer_list(list->rest, indent+4);
+        ciwic_print_initializer(sink, list->initializer, indent+4);
+        indent += 4;
     }
 }
 
-void ciwic_print_expr(ciwic_expr *expr, int indent) {
+// Prints the part of a chain link that comes before its chain operand
+void ciwic_print_expr_head(ciwic_sink *sink, ciwic_expr *expr, int indent) {
     const char *op;
     switch (expr->type) {
-        case ciwic_expr_type_identifier:
-            printf("%*cidentifier: ", indent, ' ');
-            printf("%.*s\n", expr->identifier.len, expr->identifier.text);
-            break;
-        case ciwic_expr_type_constant:
-            //printf("%*cconstant:\n", indent, ' ');
-            ciwic_print_constant(&expr->constant, indent);
-            break;
         case ciwic_expr_type_unary_op:
             op = ciwic_expr_unary_op_table[expr->unary_op.op];
-            printf("%*cunary_op: %s\n", indent, ' ', op);
-            ciwic_print_expr(expr->unary_op.inner, indent+4);
+            ciwic_print_field(sink, indent, "unary_op: ", op, strlen(op));
             break;
         case ciwic_expr_type_binary_op:
             op = ciwic_expr_binary_op_table[expr->binary_op.op];
-            printf("%*cbinary_op: %s\n", indent, ' ', op);
-            ciwic_print_expr(expr->binary_op.fst, indent+4);
-            ciwic_print_expr(expr->binary_op.snd, indent+4);
-            break;
-        case ciwic_expr_type_call:
-            printf("%*ccall: \n", indent, ' ');
-            ciwic_print_expr(expr->call.fun, indent+4);
-            if (expr->call.args != NULL) {
-                ciwic_print_arg_list(expr->call.args, indent+4);
+            ciwic_print_field(sink, indent, "binary_op: ", op, strlen(op));
+            if (expr->binary_op.op == ciwic_expr_op_comma) {
+                ciwic_print_expr(sink, expr->binary_op.fst, indent+4);
             }
             break;
-        case ciwic_expr_type_initialize:
-            printf("%*cinitialize: \n", indent, ' ');
-            // TODO: print initializer list
+        case ciwic_expr_type_call:
+            ciwic_print_label(sink, indent, "call: \n");
             break;
         case ciwic_expr_type_subscript:
-            printf("%*csubscript: \n", indent, ' ');
-            ciwic_print_expr(expr->subscript.val, indent+4);
-            ciwic_print_expr(expr->subscript.pos, indent+4);
+            ciwic_print_label(sink, indent, "subscript: \n");
             break;
         case ciwic_expr_type_member:
-            printf("%*cmember: ", indent, ' ');
-            printf("%*s\n", expr->member.identifier.len, expr->member.identifier.text);
-            ciwic_print_expr(expr->member.expr, indent+4);
+            ciwic_print_label(sink, indent, "member: ");
+            ciwic_print_text(sink, expr->member.identifier.text, expr->member.identifier.len);
             break;
         case ciwic_expr_type_member_deref:
-            printf("%*cmember deref: ", indent, ' ');
-            printf("%*s\n", expr->member.identifier.len, expr->member.identifier.text);
-            ciwic_print_expr(expr->member.expr, indent+4);
+            ciwic_print_label(sink, indent, "member deref: ");
+            ciwic_print_text(sink, expr->member.identifier.text, expr->member.identifier.len);
+            break;
+        default:
+            break;
+    }
+}
+
+// Prints the part of a chain link that comes after its chain operand
+void ciwic_print_expr_tail(ciwic_sink *sink, ciwic_expr *expr, int indent) {
+    switch (expr->type) {
+        case ciwic_expr_type_binary_op:
+            if (expr->binary_op.op != ciwic_expr_op_comma) {
+                ciwic_print_expr(sink, expr->binary_op.snd, indent+4);
+            }
+            break;
+        case ciwic_expr_type_call:
+            if (expr->call.args != NULL) {
+                ciwic_print_arg_list(sink, expr->call.args, indent+4);
+            }
+            break;
+        case ciwic_expr_type_subscript:
+            ciwic_print_expr(sink, expr->subscript.pos, indent+4);
+            break;
+        default:
+            break;
+    }
+}
+
+// Prints an expression that is not a chain link
+void ciwic_print_expr_leaf(ciwic_sink *sink, ciwic_expr *expr, int indent) {
+    const char *op;
+    switch (expr->type) {
+        case ciwic_expr_type_identifier:
+            ciwic_print_label(sink, indent, "identifier: ");
+            ciwic_print_text(sink, expr->identifier.text, expr->identifier.len);
+            break;
+        case ciwic_expr_type_constant:
+            //printf("%*cconstant:\n", indent, ' ');
+            ciwic_print_constant(sink, &expr->constant, indent);
+            break;
+        case ciwic_expr_type_unary_op:
+            op = ciwic_expr_unary_op_table[expr->unary_op.op];
+            ciwic_print_field(sink, indent, "unary_op: ", op, strlen(op));
+            ciwic_print_expr(sink, expr->unary_op.inner, indent+4);
+            break;
+        case ciwic_expr_type_initialize:
+            ciwic_print_label(sink, indent, "initialize: \n");
+            // TODO: print initializer list
             break;
         case ciwic_expr_type_sizeof_expr:
-            printf("%*csizeof expr: \n", indent, ' ');
-            ciwic_print_expr(expr->sizeof_expr, indent+4);
+            ciwic_print_label(sink, indent, "sizeof expr: \n");
+            ciwic_print_expr(sink, expr->sizeof_expr, indent+4);
             break;
         case ciwic_expr_type_sizeof_type:
-            printf("%*csizeof type: \n", indent, ' ');
-            ciwic_print_type_name(&expr->sizeof_type, indent+4);
+            ciwic_print_label(sink, indent, "sizeof type: \n");
+            ciwic_print_type_name(sink, &expr->sizeof_type, indent+4);
             break;
         case ciwic_expr_type_cast:
-            printf("%*ccast: \n", indent, ' ');
-            ciwic_print_type_name(&expr->cast.type_name, indent+4);
-            ciwic_print_expr(expr->cast.expr, indent+4);
+            ciwic_print_label(sink, indent, "cast: \n");
+            ciwic_print_type_name(sink, &expr->cast.type_name, indent+4);
+            ciwic_print_expr(sink, expr->cast.expr, indent+4);
             break;
         case ciwic_expr_type_conditional:
-            printf("%*cconditional: \n", indent, ' ');
-            ciwic_print_expr(expr->conditional.cond, indent+4);
-            ciwic_print_expr(expr->conditional.left, indent+4);
-            ciwic_print_expr(expr->conditional.right, indent+4);
+            ciwic_print_label(sink, indent, "conditional: \n");
+            ciwic_print_expr(sink, expr->conditional.cond, indent+4);
+            ciwic_print_expr(sink, expr->conditional.left, indent+4);
+            ciwic_print_expr(sink, expr->conditional.right, indent+4);
             break;
         case ciwic_expr_type_assignment:
             op = ciwic_expr_binary_op_table[expr->binary_op.op];
-            printf("%*cassignment: %s\n", indent, ' ', op);
-            ciwic_print_expr(expr->assignment.left, indent+4);
-            ciwic_print_expr(expr->assignment.right, indent+4);
+            ciwic_print_field(sink, indent, "assignment: ", op, strlen(op));
+            ciwic_print_expr(sink, expr->assignment.left, indent+4);
+            ciwic_print_expr(sink, expr->assignment.right, indent+4);
+            break;
+        default:
             break;
     }
 }
 
-void ciwic_print_type_qualifiers(int type_qualifiers, int indent) {
+void ciwic_print_expr(ciwic_sink *sink, ciwic_expr *expr, int indent) {
+    ciwic_expr_chain chain;
+    ciwic_expr_chain_init(&chain, expr);
+
+    for (int i = 0; i < chain.len; i++) {
+        ciwic_print_expr_head(sink, chain.links[i], indent + i*4);
+    }
+
+    ciwic_print_expr_leaf(sink, chain.leaf, indent + chain.len*4);
+
+    for (int i = chain.len - 1; i >= 0; i--) {
+        ciwic_print_expr_tail(sink, chain.links[i], indent + i*4);
+    }
+
+    ciwic_expr_chain_free(&chain);
+}
+
+void ciwic_print_type_qualifiers(ciwic_sink *sink, int type_qualifiers, int indent) {
     if (type_qualifiers & ciwic_type_qualifier_const)
-        printf("%*ctype qualifier: const\n", indent, ' ');
+        ciwic_print_label(sink, indent, "type qualifier: const\n");
 
     if (type_qualifiers & ciwic_type_qualifier_restrict)
-        printf("%*ctype qualifier: restrict\n", indent, ' ');
+        ciwic_print_label(sink, indent, "type qualifier: restrict\n");
 
     if (type_qualifiers & ciwic_type_qualifier_volatile)
-        printf("%*ctype qualifier: volatile\n", indent, ' ');
+        ciwic_print_label(sink, indent, "type qualifier: volatile\n");
 }
 
-void ciwic_print_declaration_specifiers(ciwic_declaration_specifiers *specs, int indent) {
-    printf("%*cdeclaration specifiers: \n", indent, ' ');
+void ciwic_print_declaration_specifiers(ciwic_sink *sink, ciwic_declaration_specifiers *specs, int indent) {
+    ciwic_print_label(sink, indent, "declaration specifiers: \n");
     
     if (specs->storage_class & ciwic_specifier_typedef)
-        printf("%*cstorage class: typedef\n", indent+4, ' ');
+        ciwic_print_label(sink, indent+4, "storage class: typedef\n");
 
     if (specs->storage_class & ciwic_specifier_extern)
-        printf("%*cstorage class: extern\n", indent+4, ' ');
+        ciwic_print_label(sink, indent+4, "storage class: extern\n");
 
     if (specs->storage_class & ciwic_specifier_static)
-        printf("%*cstorage class: static\n", indent+4, ' ');
+        ciwic_print_label(sink, indent+4, "storage class: static\n");
 
     if (specs->storage_class & ciwic_specifier_auto)
-        printf("%*cstorage class: auto\n", indent+4, ' ');
+        ciwic_print_label(sink, indent+4, "storage class: auto\n");
 
     if (specs->storage_class & ciwic_specifier_register)
-        printf("%*cstorage class: register\n", indent+4, ' ');
+        ciwic_print_label(sink, indent+4, "storage class: register\n");
 
     if (specs->func_specifiers & ciwic_function_specifier_inline)
-        printf("%*cfunction specifier: inline\n", indent+4, ' ');
+        ciwic_print_label(sink, indent+4, "function specifier: inline\n");
 
-    ciwic_print_type_qualifiers(specs->type_qualifiers, indent+4);
+    ciwic_print_type_qualifiers(sink, specs->type_qualifiers, indent+4);
 
     if (specs->type_spec == ciwic_type_spec_prim) {
         for (int i = 0; i < 12; i++) {
             if (specs->prim_type & ciwic_prim_types_list[i])
-                printf("%*ctype specifier: %s\n", indent+4, ' ', ciwic_prim_types_keywords[i]);
+                ciwic_print_field(sink, indent+4, "type specifier: ", ciwic_prim_types_keywords[i], strlen(ciwic_prim_types_keywords[i]));
         }
     }
 
     if (specs->type_spec == ciwic_type_spec_enum) {
-        printf("%*ctype specifier: enum\n", indent+4, ' ');
+        ciwic_print_label(sink, indent+4, "type specifier: enum\n");
         if (specs->enum_.identifier != NULL) {
-            printf("%*cident: ", indent+8, ' ');
-            printf("%.*s\n", specs->enum_.identifier->len, specs->enum_.identifier->text);
+            ciwic_print_label(sink, indent+8, "ident: ");
+            ciwic_print_text(sink, specs->enum_.identifier->text, specs->enum_.identifier->len);
         }
         if (specs->enum_.decl != NULL) {
             int di = 8;
             ciwic_enum_list *decl = specs->enum_.decl;
 
             while (decl != NULL) {
-                printf("%*cenum list: ", indent+di, ' ');
-                printf("%.*s\n", decl->name.len, decl->name.text);
+                ciwic_print_label(sink, indent+di, "enum list: ");
+                ciwic_print_text(sink, decl->name.text, decl->name.len);
                 if (decl->expr != NULL) {
-                    ciwic_print_expr(decl->expr, indent+di+4);
+                    ciwic_print_expr(sink, decl->expr, indent+di+4);
                 }
                 di += 4;
                 decl = decl->rest;
@@ -228,31 +363,31 @@ void ciwic_print_declaration_specifiers(ciwic_declaration_specifiers *specs, int
     }
 
     if (specs->type_spec == ciwic_type_spec_struct || specs->type_spec == ciwic_type_spec_union) {
-        printf("%*ctype specifier: ", indent+4, ' ');
+        ciwic_print_label(sink, indent+4, "type specifier: ");
         if (specs->type_spec == ciwic_type_spec_struct)
-            printf("struct\n");
+            ciwic_sink_str(sink, "struct\n");
         else
-            printf("union\n");
+            ciwic_sink_str(sink, "union\n");
         if (specs->struct_or_union.identifier != NULL) {
-            printf("%*cident: ", indent+8, ' ');
-            printf("%.*s\n", specs->struct_or_union.identifier->len, specs->struct_or_union.identifier->text);
+            ciwic_print_label(sink, indent+8, "ident: ");
+            ciwic_print_text(sink, specs->struct_or_union.identifier->text, specs->struct_or_union.identifier->len);
         }
         if (specs->struct_or_union.decl != NULL) {
             int di = 8;
             ciwic_struct_list *decl = specs->struct_or_union.decl;
 
             while (decl != NULL) {
-                printf("%*cstruct list: \n", indent+di, ' ');
-                ciwic_print_declaration_specifiers(&decl->specifiers, indent+di+4);
+                ciwic_print_label(sink, indent+di, "struct list: \n");
+                ciwic_print_declaration_specifiers(sink, &decl->specifiers, indent+di+4);
                 ciwic_struct_declarator_list *list = &decl->declarator_list;
                 int dj = di+4;
 
                 while (list != NULL) {
-                    printf("%*cstruct declarator list: \n", indent+dj, ' ');
+                    ciwic_print_label(sink, indent+dj, "struct declarator list: \n");
                     if (list->declarator != NULL)
-                        ciwic_print_declarator(list->declarator, indent+dj+4);
+                        ciwic_print_declarator(sink, list->declarator, indent+dj+4);
                     if (list->expr != NULL)
-                        ciwic_print_expr(list->expr, indent+dj+4);
+                        ciwic_print_expr(sink, list->expr, indent+dj+4);
 
                     dj += 4;
                     list = list->rest;
@@ -265,45 +400,45 @@ void ciwic_print_declaration_specifiers(ciwic_declaration_specifiers *specs, int
     }
 
     if (specs->type_spec == ciwic_type_spec_typedef_name) {
-        printf("%*ctypedef name: ", indent+4, ' ');
-        printf("%.*s\n", specs->typedef_name.len, specs->typedef_name.text);
+        ciwic_print_label(sink, indent+4, "typedef name: ");
+        ciwic_print_text(sink, specs->typedef_name.text, specs->typedef_name.len);
     }
 }
 
-void ciwic_print_declarator(ciwic_declarator *decl, int indent) {
+void ciwic_print_declarator(ciwic_sink *sink, ciwic_declarator *decl, int indent) {
     switch (decl->type) {
         case ciwic_declarator_pointer:
-            printf("%*cdeclarator: pointer\n", indent, ' ');
-            ciwic_print_type_qualifiers(decl->pointer_qualifiers, indent+4);
+            ciwic_print_label(sink, indent, "declarator: pointer\n");
+            ciwic_print_type_qualifiers(sink, decl->pointer_qualifiers, indent+4);
             break;
         case ciwic_declarator_identifier:
-            printf("%*cdeclarator: identifier\n", indent, ' ');
-            printf("%*cident: %.*s\n", indent+4, ' ', decl->ident.len, decl->ident.text);
+            ciwic_print_label(sink, indent, "declarator: identifier\n");
+            ciwic_print_field(sink, indent+4, "ident: ", decl->ident.text, decl->ident.len);
             break;
         case ciwic_declarator_array:
-            printf("%*cdeclarator: array\n", indent, ' ');
+            ciwic_print_label(sink, indent, "declarator: array\n");
             if (decl->array.is_static) {
-                printf("%*cstorage class: static\n", indent+4, ' ');
+                ciwic_print_label(sink, indent+4, "storage class: static\n");
             }
-            ciwic_print_type_qualifiers(decl->array.type_qualifiers, indent+4);
+            ciwic_print_type_qualifiers(sink, decl->array.type_qualifiers, indent+4);
             if (decl->array.is_var_len) {
-                printf("%*cvar len\n", indent+4, ' ');
+                ciwic_print_label(sink, indent+4, "var len\n");
             }
             if (decl->array.expr != NULL)
-                ciwic_print_expr(decl->array.expr, indent+4);
+                ciwic_print_expr(sink, decl->array.expr, indent+4);
             break;
         case ciwic_declarator_func:
-            printf("%*cdeclarator: func\n", indent, ' ');
+            ciwic_print_label(sink, indent, "declarator: func\n");
             ciwic_param_list *list = decl->func.param_list;
             int di = 4;
 
             while (list != NULL) {
-                printf("%*cparam list: \n", indent+di, ' ');
+                ciwic_print_label(sink, indent+di, "param list: \n");
 
-                ciwic_print_declaration_specifiers(&list->specifiers, indent+di+4);
+                ciwic_print_declaration_specifiers(sink, &list->specifiers, indent+di+4);
 
                 if (list->declarator != NULL) {
-                    ciwic_print_declarator(list->declarator, indent+di+4);
+                    ciwic_print_declarator(sink, list->declarator, indent+di+4);
                 }
 
                 di += 4;
@@ -311,42 +446,42 @@ void ciwic_print_declarator(ciwic_declarator *decl, int indent) {
             }
 
             if (decl->func.has_ellipsis) {
-                printf("%*cellipsis\n", indent, ' ');
+                ciwic_print_label(sink, indent, "ellipsis\n");
             }
             break;
     }
     
     if (decl->inner != NULL) {
-        ciwic_print_declarator(decl->inner, indent+4);
+        ciwic_print_declarator(sink, decl->inner, indent+4);
     }
 }
 
-void ciwic_print_initializer(ciwic_initializer *init, int indent) {
-    printf("%*cinitializer: ", indent, ' ');
+void ciwic_print_initializer(ciwic_sink *sink, ciwic_initializer *init, int indent) {
+    ciwic_print_label(sink, indent, "initializer: ");
     switch (init->type) {
         case ciwic_initializer_init_expr:
-            printf("expr\n");
-            ciwic_print_expr(&init->expr, indent + 4);
+            ciwic_sink_str(sink, "expr\n");
+            ciwic_print_expr(sink, &init->expr, indent + 4);
             break;
         case ciwic_initializer_init_list:
-            printf("list\n");
-            ciwic_print_initializer_list(&init->list, indent + 4);
+            ciwic_sink_str(sink, "list\n");
+            ciwic_print_initializer_list(sink, &init->list, indent + 4);
             break;
     }
 }
 
-void ciwic_print_declaration(ciwic_declaration *decl, int indent) {
-    printf("%*cdeclaration: \n", indent, ' ');
-    ciwic_print_declaration_specifiers(&decl->specifiers, indent+4);
+void ciwic_print_declaration(ciwic_sink *sink, ciwic_declaration *decl, int indent) {
+    ciwic_print_label(sink, indent, "declaration: \n");
+    ciwic_print_declaration_specifiers(sink, &decl->specifiers, indent+4);
 
     ciwic_init_declarator_list *list = &decl->list;
     int nindent = indent + 4;
 
     while (list != NULL) {
-        printf("%*cinit declarator list: \n", nindent, ' ');
-        ciwic_print_declarator(&list->declarator, nindent+4);
+        ciwic_print_label(sink, nindent, "init declarator list: \n");
+        ciwic_print_declarator(sink, &list->declarator, nindent+4);
         if (list->initializer != NULL) {
-            ciwic_print_initializer(list->initializer, nindent+4);
+            ciwic_print_initializer(sink, list->initializer, nindent+4);
         }
 
         nindent = nindent + 4;
@@ -354,124 +489,129 @@ void ciwic_print_declaration(ciwic_declaration *decl, int indent) {
     }
 }
 
-void ciwic_print_statement(ciwic_statement *stmt, int indent) {
-    printf("%*cstatement: ", indent, ' ');
+void ciwic_print_statement(ciwic_sink *sink, ciwic_statement *stmt, int indent) {
+    ciwic_print_label(sink, indent, "statement: ");
 
     switch (stmt->type) {
         case ciwic_statement_label:
-            printf("label\n");
-            printf("%*cident: %.*s\n", indent+4, ' ', stmt->labeled.label_ident.len, stmt->labeled.label_ident.text);
-            ciwic_print_statement(stmt->labeled.stmt, indent+4);
+            ciwic_sink_str(sink, "label\n");
+            ciwic_print_field(sink, indent+4, "ident: ", stmt->labeled.label_ident.text, stmt->labeled.label_ident.len);
+            ciwic_print_statement(sink, stmt->labeled.stmt, indent+4);
             break;
         case ciwic_statement_case:
-            printf("case\n");
-            ciwic_print_expr(&stmt->labeled.case_expr, indent+4);
-            ciwic_print_statement(stmt->labeled.stmt, indent+4);
+            ciwic_sink_str(sink, "case\n");
+            ciwic_print_expr(sink, &stmt->labeled.case_expr, indent+4);
+            ciwic_print_statement(sink, stmt->labeled.stmt, indent+4);
             break;
         case ciwic_statement_default:
-            printf("default\n");
-            ciwic_print_statement(stmt->labeled.stmt, indent+4);
+            ciwic_sink_str(sink, "default\n");
+            ciwic_print_statement(sink, stmt->labeled.stmt, indent+4);
             break;
         case ciwic_statement_block:
-            printf("block\n");
-            ciwic_print_statement(stmt->block.head, indent+4);
-            if (stmt->block.rest != NULL)
-                ciwic_print_statement(stmt->block.rest, indent+4);
+            ciwic_sink_str(sink, "block\n");
+            ciwic_print_statement(sink, stmt->block.head, indent+4);
+            // Every further cell is printed as the rest of the one before
+            for (ciwic_statement *block = stmt->block.rest; block != NULL; block = block->block.rest) {
+                indent += 4;
+                ciwic_print_label(sink, indent, "statement: block\n");
+                ciwic_print_statement(sink, block->block.head, indent+4);
+            }
             break;
         case ciwic_statement_expr:
-            printf("expr\n");
-            ciwic_print_expr(&stmt->expr, indent+4);
+            ciwic_sink_str(sink, "expr\n");
+            ciwic_print_expr(sink, &stmt->expr, indent+4);
             break;
         case ciwic_statement_if:
-            printf("if\n");
-            ciwic_print_expr(&stmt->if_stmt.expr, indent+4);
-            ciwic_print_statement(stmt->if_stmt.if_then, indent+4);
+            ciwic_sink_str(sink, "if\n");
+            ciwic_print_expr(sink, &stmt->if_stmt.expr, indent+4);
+            ciwic_print_statement(sink, stmt->if_stmt.if_then, indent+4);
             if (stmt->if_stmt.if_else != NULL)
-                ciwic_print_statement(stmt->if_stmt.if_else, indent+4);
+                ciwic_print_statement(sink, stmt->if_stmt.if_else, indent+4);
             break;
         case ciwic_statement_switch:
-            printf("switch\n");
-            ciwic_print_expr(&stmt->switch_stmt.expr, indent+4);
-            ciwic_print_statement(stmt->switch_stmt.stmt, indent+4);
+            ciwic_sink_str(sink, "switch\n");
+            ciwic_print_expr(sink, &stmt->switch_stmt.expr, indent+4);
+            ciwic_print_statement(sink, stmt->switch_stmt.stmt, indent+4);
             break;
         case ciwic_statement_while:
-            printf("while\n");
-            ciwic_print_expr(&stmt->while_stmt.expr, indent+4);
-            ciwic_print_statement(stmt->while_stmt.stmt, indent+4);
+            ciwic_sink_str(sink, "while\n");
+            ciwic_print_expr(sink, &stmt->while_stmt.expr, indent+4);
+            ciwic_print_statement(sink, stmt->while_stmt.stmt, indent+4);
             break;
         case ciwic_statement_do_while:
-            printf("do while\n");
-            ciwic_print_statement(stmt->while_stmt.stmt, indent+4);
-            ciwic_print_expr(&stmt->while_stmt.expr, indent+4);
+            ciwic_sink_str(sink, "do while\n");
+            ciwic_print_statement(sink, stmt->while_stmt.stmt, indent+4);
+            ciwic_print_expr(sink, &stmt->while_stmt.expr, indent+4);
             break;
         case ciwic_statement_for:
-            printf("for\n");
-            printf("%*cpre decl:\n", indent+4, ' ');
+            ciwic_sink_str(sink, "for\n");
+            ciwic_print_label(sink, indent+4, "pre decl:\n");
             if (stmt->for_stmt.pre_decl != NULL)
-                ciwic_print_declaration(stmt->for_stmt.pre_decl, indent+8);
+                ciwic_print_declaration(sink, stmt->for_stmt.pre_decl, indent+8);
 
-            printf("%*cpre expr:\n", indent+4, ' ');
+            ciwic_print_label(sink, indent+4, "pre expr:\n");
             if (stmt->for_stmt.pre_expr != NULL)
-                ciwic_print_expr(stmt->for_stmt.pre_expr, indent+8);
+                ciwic_print_expr(sink, stmt->for_stmt.pre_expr, indent+8);
 
-            printf("%*ctest expr:\n", indent+4, ' ');
+            ciwic_print_label(sink, indent+4, "test expr:\n");
             if (stmt->for_stmt.test_expr != NULL)
-                ciwic_print_expr(stmt->for_stmt.test_expr, indent+8);
+                ciwic_print_expr(sink, stmt->for_stmt.test_expr, indent+8);
 
-            printf("%*cpost expr:\n", indent+4, ' ');
+            ciwic_print_label(sink, indent+4, "post expr:\n");
             if (stmt->for_stmt.post_expr != NULL)
-                ciwic_print_expr(stmt->for_stmt.post_expr, indent+8);
+                ciwic_print_expr(sink, stmt->for_stmt.post_expr, indent+8);
 
-            ciwic_print_statement(stmt->for_stmt.stmt, indent+4);
+            ciwic_print_statement(sink, stmt->for_stmt.stmt, indent+4);
             break;
         case ciwic_statement_goto:
-            printf("goto\n");
-            printf("%*cident: %.*s\n", indent+4, ' ', stmt->goto_ident.len, stmt->goto_ident.text);
+            ciwic_sink_str(sink, "goto\n");
+            ciwic_print_field(sink, indent+4, "ident: ", stmt->goto_ident.text, stmt->goto_ident.len);
             break;
         case ciwic_statement_continue:
-            printf("continue\n");
+            ciwic_sink_str(sink, "continue\n");
             break;
         case ciwic_statement_break:
-            printf("break\n");
+            ciwic_sink_str(sink, "break\n");
             break;
         case ciwic_statement_return:
-            printf("return\n");
+            ciwic_sink_str(sink, "return\n");
             if (stmt->return_expr != NULL)
-                ciwic_print_expr(stmt->return_expr, indent+4);
+                ciwic_print_expr(sink, stmt->return_expr, indent+4);
             break;
         case ciwic_statement_null:
-            printf("null\n");
+            ciwic_sink_str(sink, "null\n");
             break;
     }
 }
 
-void ciwic_print_declaration_list(ciwic_declaration_list *decl_list, int indent) {
-    printf("%*cdeclaration list: \n", indent, ' ');
-    ciwic_print_declaration(&decl_list->head, indent+4);
-    if (decl_list->rest != NULL)
-        ciwic_print_declaration_list(decl_list->rest, indent+4);
+void ciwic_print_declaration_list(ciwic_sink *sink, ciwic_declaration_list *decl_list, int indent) {
+    for (; decl_list != NULL; decl_list = decl_list->rest) {
+        ciwic_print_label(sink, indent, "declaration list: \n");
+        ciwic_print_declaration(sink, &decl_list->head, indent+4);
+        indent += 4;
+    }
 }
 
-void ciwic_print_func_definition(ciwic_func_definition *func_def, int indent) {
-    printf("%*cfunction definition: \n", indent, ' ');
-    ciwic_print_declaration_specifiers(&func_def->specifiers, indent+4);
-    ciwic_print_declarator(&func_def->declarator, indent+4);
+void ciwic_print_func_definition(ciwic_sink *sink, ciwic_func_definition *func_def, int indent) {
+    ciwic_print_label(sink, indent, "function definition: \n");
+    ciwic_print_declaration_specifiers(sink, &func_def->specifiers, indent+4);
+    ciwic_print_declarator(sink, &func_def->declarator, indent+4);
     if (func_def->decl_list != NULL)
-        ciwic_print_declaration_list(func_def->decl_list, indent+4);
-    ciwic_print_statement(&func_def->statement, indent+4);
+        ciwic_print_declaration_list(sink, func_def->decl_list, indent+4);
+    ciwic_print_statement(sink, &func_def->statement, indent+4);
 }
 
-void ciwic_print_translation_unit(ciwic_translation_unit *translation_unit, int indent) {
-    printf("%*ctranslation unit: \n", indent, ' ');
-    switch (translation_unit->def_type) {
-        case ciwic_definition_func:
-            ciwic_print_func_definition(&translation_unit->func, indent+4);
-            break;
-        case ciwic_definition_decl:
-            ciwic_print_declaration(&translation_unit->decl, indent+4);
-            break;
+void ciwic_print_translation_unit(ciwic_sink *sink, ciwic_translation_unit *translation_unit, int indent) {
+    for (; translation_unit != NULL; translation_unit = translation_unit->rest) {
+        ciwic_print_label(sink, indent, "translation unit: \n");
+        switch (translation_unit->def_type) {
+            case ciwic_definition_func:
+                ciwic_print_func_definition(sink, &translation_unit->func, indent+4);
+                break;
+            case ciwic_definition_decl:
+                ciwic_print_declaration(sink, &translation_unit->decl, indent+4);
+                break;
+        }
+        indent += 4;
     }
-
-    if (translation_unit->rest != NULL)
-        ciwic_print_translation_unit(translation_unit->rest, indent+4);
 }
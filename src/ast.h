@@ -1,6 +1,9 @@
 #pragma once
 
+#include <stdint.h>
+
 #include <parselib.h>
+#include <sink.h>
 
 // Constant
 
@@ -146,6 +149,8 @@ typedef struct ciwic_initializer_list {
 
 typedef struct ciwic_expr {
     ciwic_expr_type type;
+    ciwic_span span;
+    uint64_t hash; // Structural hash, set by ciwic_ast_hash
     union {
         string identifier;
         ciwic_constant constant;
@@ -212,6 +217,7 @@ typedef enum {
 
 typedef struct ciwic_declarator {
     ciwic_declarator_type type;
+    ciwic_span span;
     struct ciwic_declarator *inner; // Can be null
     union {
         int pointer_qualifiers;
@@ -282,6 +288,8 @@ typedef struct ciwic_init_declarator_list {
 } ciwic_init_declarator_list;
 
 typedef struct ciwic_declaration {
+    ciwic_span span;
+    uint64_t hash; // Structural hash, set by ciwic_ast_hash
     ciwic_declaration_specifiers specifiers;
     ciwic_init_declarator_list list;
 } ciwic_declaration;
@@ -313,6 +321,7 @@ typedef enum {
 
 typedef struct ciwic_statement {
     ciwic_statement_type type;
+    ciwic_span span;
     union {
         struct {
             union {
@@ -358,6 +367,7 @@ typedef struct ciwic_declaration_list {
 } ciwic_declaration_list;
 
 typedef struct ciwic_func_definition {
+    uint64_t hash; // Structural hash, set by ciwic_ast_hash
     ciwic_declaration_specifiers specifiers;
     ciwic_declarator declarator;
     ciwic_declaration_list *decl_list; // Can be null
@@ -371,6 +381,7 @@ typedef enum {
 
 typedef struct ciwic_translation_unit {
     ciwic_definition_type def_type;
+    ciwic_span span; // Span of this definition only
     union {
         ciwic_func_definition func;
         ciwic_declaration decl;
@@ -378,13 +389,56 @@ typedef struct ciwic_translation_unit {
     struct ciwic_translation_unit *rest; // Can be null
 } ciwic_translation_unit;
 
+// Node kinds, one per AST struct
+
+typedef enum {
+    ciwic_node_translation_unit,
+    ciwic_node_func_definition,
+    ciwic_node_declaration,
+    ciwic_node_declaration_list,
+    ciwic_node_declaration_specifiers,
+    ciwic_node_init_declarator_list,
+    ciwic_node_declarator,
+    ciwic_node_param_list,
+    ciwic_node_type_name,
+    ciwic_node_initializer,
+    ciwic_node_initializer_list,
+    ciwic_node_designator_list,
+    ciwic_node_struct_list,
+    ciwic_node_struct_declarator_list,
+    ciwic_node_enum_list,
+    ciwic_node_expr,
+    ciwic_node_expr_arg_list,
+    ciwic_node_statement,
+    ciwic_node_kind_count,
+} ciwic_node_kind;
+
+extern const char* ciwic_node_kind_names[ciwic_node_kind_count];
 
 int ciwic_declarator_is_abstract(ciwic_declarator *declarator);
 
-void ciwic_print_expr(ciwic_expr *expr, int indent);
-void ciwic_print_declaration_specifiers(ciwic_declaration_specifiers *specs, int indent);
-void ciwic_print_declarator(ciwic_declarator *decl, int indent);
-void ciwic_print_declaration(ciwic_declaration *decl, int indent);
-void ciwic_print_initializer(ciwic_initializer *init, int indent);
-void ciwic_print_statement(ciwic_statement *stmt, int indent);
-void ciwic_print_translation_unit(ciwic_translation_unit *translation_unit, int indent);
+// Chains such as a + b + c, a[i][j], f(x)(y) or a, b, c are built by the
+// parser in a loop and can be as long as the input, so code walking the AST
+// follows them in a loop too. The chain operand of an expression is the one
+// such a chain continues in: the right operand of a comma, which nests to
+// the right, the left operand of any other binary operator, the function of
+// a call, the array of a subscript, the object of a member access and the
+// operand of a postfix operator.
+typedef struct {
+    ciwic_expr **links; // Outermost first, each the chain operand of the one before
+    int len;
+    ciwic_expr *leaf; // Chain operand of the last link, or the expression itself if len is 0
+    ciwic_expr *buf[16];
+} ciwic_expr_chain;
+
+ciwic_expr *ciwic_expr_chain_operand(ciwic_expr *expr); // Can be null
+void ciwic_expr_chain_init(ciwic_expr_chain *chain, ciwic_expr *expr);
+void ciwic_expr_chain_free(ciwic_expr_chain *chain);
+
+void ciwic_print_expr(ciwic_sink *sink, ciwic_expr *expr, int indent);
+void ciwic_print_declaration_specifiers(ciwic_sink *sink, ciwic_declaration_specifiers *specs, int indent);
+void ciwic_print_declarator(ciwic_sink *sink, ciwic_declarator *decl, int indent);
+void ciwic_print_declaration(ciwic_sink *sink, ciwic_declaration *decl, int indent);
+void ciwic_print_initializer(ciwic_sink *sink, ciwic_initializer *init, int indent);
+void ciwic_print_statement(ciwic_sink *sink, ciwic_statement *stmt, int indent);
+void ciwic_print_translation_unit(ciwic_sink *sink, ciwic_translation_unit *translation_unit, int indent);
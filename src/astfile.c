@@ -0,0 +1,746 @@
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <astfile.h>
+#include <hash.h>
+
+typedef struct {
+    char *buf;
+    size_t len;
+    size_t cap;
+
+    char *strings;
+    size_t strings_len;
+    size_t strings_cap;
+
+    // Open addressing table of string table offsets plus one
+    uint32_t *intern;
+    size_t intern_len;
+    size_t intern_cap;
+
+    // Child offsets of the nodes currently being written
+    uint32_t *stack;
+    size_t stack_len;
+    size_t stack_cap;
+
+    uint32_t node_count;
+} ciwic_astfile_writer;
+
+void *ciwic_astfile_grow(void *buf, size_t *cap, size_t needed, size_t elem) {
+    if (needed <= *cap) {
+        return buf;
+    }
+    while (*cap < needed) {
+        *cap = *cap ? *cap * 2 : 1024;
+    }
+    return realloc(buf, *cap * elem);
+}
+
+uint32_t ciwic_astfile_alloc(ciwic_astfile_writer *w, size_t size) {
+    size = (size + 3) & ~(size_t) 3;
+    w->buf = ciwic_astfile_grow(w->buf, &w->cap, w->len + size, 1);
+    uint32_t offset = w->len;
+    memset(&w->buf[offset], 0, size);
+    w->len += size;
+    return offset;
+}
+
+void ciwic_astfile_push(ciwic_astfile_writer *w, uint32_t offset) {
+    w->stack = ciwic_astfile_grow(w->stack, &w->stack_cap, w->stack_len + 1, sizeof(uint32_t));
+    w->stack[w->stack_len++] = offset;
+}
+
+// Turns every offset pushed since base into a child list
+uint32_t ciwic_astfile_pop_children(ciwic_astfile_writer *w, size_t base) {
+    uint32_t count = w->stack_len - base;
+    if (count == 0) {
+        return 0;
+    }
+
+    uint32_t offset = ciwic_astfile_alloc(w, sizeof(uint32_t) * (count + 1));
+    uint32_t *list = (uint32_t *) &w->buf[offset];
+    list[0] = count;
+    memcpy(&list[1], &w->stack[base], sizeof(uint32_t) * count);
+
+    w->stack_len = base;
+    return offset;
+}
+
+uint32_t ciwic_astfile_intern(ciwic_astfile_writer *w, const char *text, int len) {
+    if (w->intern_len * 2 >= w->intern_cap) {
+        size_t old_cap = w->intern_cap;
+        uint32_t *old = w->intern;
+
+        w->intern_cap = old_cap ? old_cap * 2 : 256;
+        w->intern = calloc(w->intern_cap, sizeof(uint32_t));
+
+        for (size_t i = 0; i < old_cap; i++) {
+            if (old[i] == 0) {
+                continue;
+            }
+            uint32_t *entry = (uint32_t *) &w->strings[old[i] - 1];
+            size_t slot = ciwic_hash64(&entry[1], entry[0], 0) & (w->intern_cap - 1);
+            while (w->intern[slot] != 0) {
+                slot = (slot + 1) & (w->intern_cap - 1);
+            }
+            w->intern[slot] = old[i];
+        }
+        free(old);
+    }
+
+    size_t slot = ciwic_hash64(text, len, 0) & (w->intern_cap - 1);
+
+    while (w->intern[slot] != 0) {
+        uint32_t *entry = (uint32_t *) &w->strings[w->intern[slot] - 1];
+        if (entry[0] == (uint32_t) len && memcmp(&entry[1], text, len) == 0) {
+            return w->intern[slot] - 1;
+        }
+        slot = (slot + 1) & (w->intern_cap - 1);
+    }
+
+    // Length, text and a terminating zero, padded to 4 bytes
+    size_t size = (sizeof(uint32_t) + len + 1 + 3) & ~(size_t) 3;
+    w->strings = ciwic_astfile_grow(w->strings, &w->strings_cap, w->strings_len + size, 1);
+
+    uint32_t offset = w->strings_len;
+    memset(&w->strings[offset], 0, size);
+    memcpy(&w->strings[offset], &(uint32_t){ len }, sizeof(uint32_t));
+    memcpy(&w->strings[offset + sizeof(uint32_t)], text, len);
+    w->strings_len += size;
+
+    w->intern[slot] = offset + 1;
+    w->intern_len++;
+
+    return offset;
+}
+
+uint32_t ciwic_astfile_node_new(ciwic_astfile_writer *w, ciwic_node_kind kind, int type, ciwic_span *span, size_t base) {
+    uint32_t children = ciwic_astfile_pop_children(w, base);
+    uint32_t offset = ciwic_astfile_alloc(w, sizeof(ciwic_astfile_node));
+    ciwic_astfile_node *node = (ciwic_astfile_node *) &w->buf[offset];
+
+    node->kind = kind;
+    node->type = type;
+    node->start = span != NULL ? span->start : -1;
+    node->end = span != NULL ? span->end : -1;
+    node->string = CIWIC_ASTFILE_NONE;
+    node->children = children;
+
+    w->node_count++;
+    return offset;
+}
+
+ciwic_astfile_node *ciwic_astfile_node_ptr(ciwic_astfile_writer *w, uint32_t offset) {
+    return (ciwic_astfile_node *) &w->buf[offset];
+}
+
+void ciwic_astfile_node_string(ciwic_astfile_writer *w, uint32_t offset, const char *text, int len) {
+    uint32_t str = ciwic_astfile_intern(w, text, len);
+    ciwic_astfile_node_ptr(w, offset)->string = str;
+}
+
+uint32_t ciwic_astfile_write_expr(ciwic_astfile_writer *w, ciwic_expr *expr);
+uint32_t ciwic_astfile_write_declarator(ciwic_astfile_writer *w, ciwic_declarator *decl);
+uint32_t ciwic_astfile_write_declaration(ciwic_astfile_writer *w, ciwic_declaration *decl);
+uint32_t ciwic_astfile_write_initializer(ciwic_astfile_writer *w, ciwic_initializer *init);
+uint32_t ciwic_astfile_write_statement(ciwic_astfile_writer *w, ciwic_statement *stmt);
+
+void ciwic_astfile_push_optional_expr(ciwic_astfile_writer *w, ciwic_expr *expr) {
+    ciwic_astfile_push(w, expr != NULL ? ciwic_astfile_write_expr(w, expr) : 0);
+}
+
+void ciwic_astfile_push_optional_declarator(ciwic_astfile_writer *w, ciwic_declarator *decl) {
+    ciwic_astfile_push(w, decl != NULL ? ciwic_astfile_write_declarator(w, decl) : 0);
+}
+
+uint32_t ciwic_astfile_write_specifiers(ciwic_astfile_writer *w, ciwic_declaration_specifiers *specs) {
+    size_t base = w->stack_len;
+    string *tag = NULL;
+
+    if (specs->type_spec == ciwic_type_spec_struct || specs->type_spec == ciwic_type_spec_union) {
+        tag = specs->struct_or_union.identifier;
+
+        for (ciwic_struct_list *list = specs->struct_or_union.decl; list != NULL; list = list->rest) {
+            size_t list_base = w->stack_len;
+            ciwic_astfile_push(w, ciwic_astfile_write_specifiers(w, &list->specifiers));
+
+            for (ciwic_struct_declarator_list *decl = &list->declarator_list; decl != NULL; decl = decl->rest) {
+                size_t decl_base = w->stack_len;
+                ciwic_astfile_push_optional_declarator(w, decl->declarator);
+                ciwic_astfile_push_optional_expr(w, decl->expr);
+                ciwic_astfile_push(w, ciwic_astfile_node_new(w, ciwic_node_struct_declarator_list, 0, NULL, decl_base));
+            }
+
+            ciwic_astfile_push(w, ciwic_astfile_node_new(w, ciwic_node_struct_list, 0, NULL, list_base));
+        }
+    } else if (specs->type_spec == ciwic_type_spec_enum) {
+        tag = specs->enum_.identifier;
+
+        for (ciwic_enum_list *list = specs->enum_.decl; list != NULL; list = list->rest) {
+            size_t list_base = w->stack_len;
+            ciwic_astfile_push_optional_expr(w, list->expr);
+            uint32_t node = ciwic_astfile_node_new(w, ciwic_node_enum_list, 0, NULL, list_base);
+            ciwic_astfile_node_string(w, node, list->name.text, list->name.len);
+            ciwic_astfile_push(w, node);
+        }
+    } else if (specs->type_spec == ciwic_type_spec_typedef_name) {
+        tag = &specs->typedef_name;
+    }
+
+    uint32_t node = ciwic_astfile_node_new(w, ciwic_node_declaration_specifiers, specs->type_spec, NULL, base);
+    ciwic_astfile_node *ptr = ciwic_astfile_node_ptr(w, node);
+    ptr->values[0] = specs->storage_class;
+    ptr->values[1] = specs->func_specifiers;
+    ptr->values[2] = specs->type_qualifiers;
+    ptr->values[3] = specs->type_spec == ciwic_type_spec_prim ? specs->prim_type : 0;
+
+    if (tag != NULL) {
+        ciwic_astfile_node_string(w, node, tag->text, tag->len);
+    }
+
+    return node;
+}
+
+uint32_t ciwic_astfile_write_type_name(ciwic_astfile_writer *w, ciwic_type_name *name) {
+    size_t base = w->stack_len;
+    ciwic_astfile_push(w, ciwic_astfile_write_specifiers(w, &name->specifiers));
+    ciwic_astfile_push_optional_declarator(w, name->declarator);
+    return ciwic_astfile_node_new(w, ciwic_node_type_name, 0, NULL, base);
+}
+
+uint32_t ciwic_astfile_write_declarator(ciwic_astfile_writer *w, ciwic_declarator *decl) {
+    size_t base = w->stack_len;
+
+    ciwic_astfile_push_optional_declarator(w, decl->inner);
+
+    if (decl->type == ciwic_declarator_array) {
+        ciwic_astfile_push_optional_expr(w, decl->array.expr);
+    } else if (decl->type == ciwic_declarator_func) {
+        for (ciwic_param_list *param = decl->func.param_list; param != NULL; param = param->rest) {
+            size_t param_base = w->stack_len;
+            ciwic_astfile_push(w, ciwic_astfile_write_specifiers(w, &param->specifiers));
+            ciwic_astfile_push_optional_declarator(w, param->declarator);
+            ciwic_astfile_push(w, ciwic_astfile_node_new(w, ciwic_node_param_list, 0, NULL, param_base));
+        }
+    }
+
+    uint32_t node = ciwic_astfile_node_new(w, ciwic_node_declarator, decl->type, &decl->span, base);
+    ciwic_astfile_node *ptr = ciwic_astfile_node_ptr(w, node);
+
+    switch (decl->type) {
+        case ciwic_declarator_pointer:
+            ptr->values[0] = decl->pointer_qualifiers;
+            break;
+        case ciwic_declarator_identifier:
+            ciwic_astfile_node_string(w, node, decl->ident.text, decl->ident.len);
+            break;
+        case ciwic_declarator_array:
+            ptr->values[0] = decl->array.is_static;
+            ptr->values[1] = decl->array.is_var_len;
+            ptr->values[2] = decl->array.type_qualifiers;
+            break;
+        case ciwic_declarator_func:
+            ptr->values[0] = decl->func.has_ellipsis;
+            break;
+        case ciwic_declarator_func_old:
+            break;
+    }
+
+    return node;
+}
+
+void ciwic_astfile_push_initializer_list(ciwic_astfile_writer *w, ciwic_initializer_list *list) {
+    for (; list != NULL; list = list->rest) {
+        size_t base = w->stack_len;
+
+        ciwic_astfile_push(w, ciwic_astfile_write_initializer(w, list->initializer));
+
+        for (ciwic_designator_list *desig = list->designation; desig != NULL; desig = desig->rest) {
+            size_t desig_base = w->stack_len;
+            if (desig->type == ciwic_designator_expr) {
+                ciwic_astfile_push(w, ciwic_astfile_write_expr(w, &desig->expr));
+            }
+            uint32_t node = ciwic_astfile_node_new(w, ciwic_node_designator_list, desig->type, NULL, desig_base);
+            if (desig->type == ciwic_designator_ident) {
+                ciwic_astfile_node_string(w, node, desig->ident.text, desig->ident.len);
+            }
+            ciwic_astfile_push(w, node);
+        }
+
+        ciwic_astfile_push(w, ciwic_astfile_node_new(w, ciwic_node_initializer_list, 0, NULL, base));
+    }
+}
+
+uint32_t ciwic_astfile_write_initializer(ciwic_astfile_writer *w, ciwic_initializer *init) {
+    size_t base = w->stack_len;
+
+    switch (init->type) {
+        case ciwic_initializer_init_expr:
+            ciwic_astfile_push(w, ciwic_astfile_write_expr(w, &init->expr));
+            break;
+        case ciwic_initializer_init_list:
+            ciwic_astfile_push_initializer_list(w, &init->list);
+            break;
+    }
+
+    return ciwic_astfile_node_new(w, ciwic_node_initializer, init->type, NULL, base);
+}
+
+// Writes expr with operand as the offset of its chain operand, which is
+// written before it
+uint32_t ciwic_astfile_write_expr_node(ciwic_astfile_writer *w, ciwic_expr *expr, uint32_t operand) {
+    size_t base = w->stack_len;
+    uint32_t value = 0;
+    string *str = NULL;
+    string constant;
+
+    switch (expr->type) {
+        case ciwic_expr_type_identifier:
+            str = &expr->identifier;
+            break;
+        case ciwic_expr_type_constant:
+            value = expr->constant.type;
+            constant.text = expr->constant.raw_text;
+            constant.len = strlen(expr->constant.raw_text);
+            str = &constant;
+            break;
+        case ciwic_expr_type_unary_op:
+            value = expr->unary_op.op;
+            if (ciwic_expr_chain_operand(expr) == NULL) {
+                operand = ciwic_astfile_write_expr(w, expr->unary_op.inner);
+            }
+            ciwic_astfile_push(w, operand);
+            break;
+        case ciwic_expr_type_binary_op:
+            value = expr->binary_op.op;
+            if (expr->binary_op.op == ciwic_expr_op_comma) {
+                ciwic_astfile_push(w, ciwic_astfile_write_expr(w, expr->binary_op.fst));
+                ciwic_astfile_push(w, operand);
+            } else {
+                ciwic_astfile_push(w, operand);
+                ciwic_astfile_push(w, ciwic_astfile_write_expr(w, expr->binary_op.snd));
+            }
+            break;
+        case ciwic_expr_type_call:
+            ciwic_astfile_push(w, operand);
+            for (ciwic_expr_arg_list *arg = expr->call.args; arg != NULL; arg = arg->rest) {
+                ciwic_astfile_push(w, ciwic_astfile_write_expr(w, &arg->head));
+            }
+            break;
+        case ciwic_expr_type_initialize:
+            ciwic_astfile_push(w, ciwic_astfile_write_type_name(w, &expr->initialize.type_name));
+            ciwic_astfile_push_initializer_list(w, &expr->initialize.initializer_list);
+            break;
+        case ciwic_expr_type_subscript:
+            ciwic_astfile_push(w, operand);
+            ciwic_astfile_push(w, ciwic_astfile_write_expr(w, expr->subscript.pos));
+            break;
+        case ciwic_expr_type_member:
+        case ciwic_expr_type_member_deref:
+            str = &expr->member.identifier;
+            ciwic_astfile_push(w, operand);
+            break;
+        case ciwic_expr_type_sizeof_expr:
+            ciwic_astfile_push(w, ciwic_astfile_write_expr(w, expr->sizeof_expr));
+            break;
+        case ciwic_expr_type_sizeof_type:
+            ciwic_astfile_push(w, ciwic_astfile_write_type_name(w, &expr->sizeof_type));
+            break;
+        case ciwic_expr_type_cast:
+            ciwic_astfile_push(w, ciwic_astfile_write_type_name(w, &expr->cast.type_name));
+            ciwic_astfile_push(w, ciwic_astfile_write_expr(w, expr->cast.expr));
+            break;
+        case ciwic_expr_type_conditional:
+            ciwic_astfile_push(w, ciwic_astfile_write_expr(w, expr->conditional.cond));
+            ciwic_astfile_push(w, ciwic_astfile_write_expr(w, expr->conditional.left));
+            ciwic_astfile_push(w, ciwic_astfile_write_expr(w, expr->conditional.right));
+            break;
+        case ciwic_expr_type_assignment:
+            value = expr->assignment.op;
+            ciwic_astfile_push(w, ciwic_astfile_write_expr(w, expr->assignment.left));
+            ciwic_astfile_push(w, ciwic_astfile_write_expr(w, expr->assignment.right));
+            break;
+    }
+
+    uint32_t node = ciwic_astfile_node_new(w, ciwic_node_expr, expr->type, &expr->span, base);
+    ciwic_astfile_node_ptr(w, node)->values[0] = value;
+
+    if (str != NULL) {
+        ciwic_astfile_node_string(w, node, str->text, str->len);
+    }
+
+    return node;
+}
+
+uint32_t ciwic_astfile_write_expr(ciwic_astfile_writer *w, ciwic_expr *expr) {
+    ciwic_expr_chain chain;
+    ciwic_expr_chain_init(&chain, expr);
+
+    // Writing from the leaf outward keeps every child before its parent
+    uint32_t node = ciwic_astfile_write_expr_node(w, chain.leaf, 0);
+    for (int i = chain.len - 1; i >= 0; i--) {
+        node = ciwic_astfile_write_expr_node(w, chain.links[i], node);
+    }
+
+    ciwic_expr_chain_free(&chain);
+    return node;
+}
+
+uint32_t ciwic_astfile_write_statement(ciwic_astfile_writer *w, ciwic_statement *stmt) {
+    size_t base = w->stack_len;
+    string *str = NULL;
+
+    switch (stmt->type) {
+        case ciwic_statement_label:
+            str = &stmt->labeled.label_ident;
+            ciwic_astfile_push(w, ciwic_astfile_write_statement(w, stmt->labeled.stmt));
+            break;
+        case ciwic_statement_case:
+            ciwic_astfile_push(w, ciwic_astfile_write_expr(w, &stmt->labeled.case_expr));
+            ciwic_astfile_push(w, ciwic_astfile_write_statement(w, stmt->labeled.stmt));
+            break;
+        case ciwic_statement_default:
+            ciwic_astfile_push(w, ciwic_astfile_write_statement(w, stmt->labeled.stmt));
+            break;
+        case ciwic_statement_block:
+            for (ciwic_statement *block = stmt; block != NULL; block = block->block.rest) {
+                ciwic_astfile_push(w, ciwic_astfile_write_statement(w, block->block.head));
+            }
+            break;
+        case ciwic_statement_expr:
+            ciwic_astfile_push(w, ciwic_astfile_write_expr(w, &stmt->expr));
+            break;
+        case ciwic_statement_if:
+            ciwic_astfile_push(w, ciwic_astfile_write_expr(w, &stmt->if_stmt.expr));
+            ciwic_astfile_push(w, ciwic_astfile_write_statement(w, stmt->if_stmt.if_then));
+            ciwic_astfile_push(w, stmt->if_stmt.if_else != NULL
+                    ? ciwic_astfile_write_statement(w, stmt->if_stmt.if_else) : 0);
+            break;
+        case ciwic_statement_switch:
+        case ciwic_statement_while:
+        case ciwic_statement_do_while:
+            // switch_stmt and while_stmt share their layout
+            ciwic_astfile_push(w, ciwic_astfile_write_expr(w, &stmt->while_stmt.expr));
+            ciwic_astfile_push(w, ciwic_astfile_write_statement(w, stmt->while_stmt.stmt));
+            break;
+        case ciwic_statement_for:
+            ciwic_astfile_push(w, stmt->for_stmt.pre_decl != NULL
+                    ? ciwic_astfile_write_declaration(w, stmt->for_stmt.pre_decl) : 0);
+            ciwic_astfile_push_optional_expr(w, stmt->for_stmt.pre_expr);
+            ciwic_astfile_push_optional_expr(w, stmt->for_stmt.test_expr);
+            ciwic_astfile_push_optional_expr(w, stmt->for_stmt.post_expr);
+            ciwic_astfile_push(w, ciwic_astfile_write_statement(w, stmt->for_stmt.stmt));
+            break;
+        case ciwic_statement_goto:
+            str = &stmt->goto_ident;
+            break;
+        case ciwic_statement_return:
+            ciwic_astfile_push_optional_expr(w, stmt->return_expr);
+            break;
+        case ciwic_statement_continue:
+        case ciwic_statement_break:
+        case ciwic_statement_null:
+            break;
+    }
+
+    uint32_t node = ciwic_astfile_node_new(w, ciwic_node_statement, stmt->type, &stmt->span, base);
+
+    if (str != NULL) {
+        ciwic_astfile_node_string(w, node, str->text, str->len);
+    }
+
+    return node;
+}
+
+uint32_t ciwic_astfile_write_declaration(ciwic_astfile_writer *w, ciwic_declaration *decl) {
+    size_t base = w->stack_len;
+
+    ciwic_astfile_push(w, ciwic_astfile_write_specifiers(w, &decl->specifiers));
+
+    for (ciwic_init_declarator_list *list = &decl->list; list != NULL; list = list->rest) {
+        size_t list_base = w->stack_len;
+        ciwic_astfile_push(w, ciwic_astfile_write_declarator(w, &list->declarator));
+        ciwic_astfile_push(w, list->initializer != NULL
+                ? ciwic_astfile_write_initializer(w, list->initializer) : 0);
+        ciwic_astfile_push(w, ciwic_astfile_node_new(w, ciwic_node_init_declarator_list, 0, NULL, list_base));
+    }
+
+    return ciwic_astfile_node_new(w, ciwic_node_declaration, 0, &decl->span, base);
+}
+
+uint32_t ciwic_astfile_write_func_definition(ciwic_astfile_writer *w, ciwic_func_definition *def) {
+    size_t base = w->stack_len;
+
+    ciwic_astfile_push(w, ciwic_astfile_write_specifiers(w, &def->specifiers));
+    ciwic_astfile_push(w, ciwic_astfile_write_declarator(w, &def->declarator));
+    ciwic_astfile_push(w, ciwic_astfile_write_statement(w, &def->statement));
+
+    for (ciwic_declaration_list *list = def->decl_list; list != NULL; list = list->rest) {
+        ciwic_astfile_push(w, ciwic_astfile_write_declaration(w, &list->head));
+    }
+
+    return ciwic_astfile_node_new(w, ciwic_node_func_definition, 0, NULL, base);
+}
+
+int ciwic_astfile_serialize(ciwic_translation_unit *translation_unit, uint64_t content_hash, char **data, size_t *size) {
+    ciwic_astfile_writer w = {0};
+
+    ciwic_astfile_alloc(&w, sizeof(ciwic_astfile_header));
+
+    for (ciwic_translation_unit *def = translation_unit; def != NULL; def = def->rest) {
+        size_t base = w.stack_len;
+        switch (def->def_type) {
+            case ciwic_definition_func:
+                ciwic_astfile_push(&w, ciwic_astfile_write_func_definition(&w, &def->func));
+                break;
+            case ciwic_definition_decl:
+                ciwic_astfile_push(&w, ciwic_astfile_write_declaration(&w, &def->decl));
+                break;
+        }
+        uint32_t node = ciwic_astfile_node_new(&w, ciwic_node_translation_unit, def->def_type, &def->span, base);
+        ciwic_astfile_push(&w, node);
+    }
+
+    uint32_t definitions = ciwic_astfile_pop_children(&w, 0);
+    if (definitions == 0) {
+        // An empty list still gets a count
+        definitions = ciwic_astfile_alloc(&w, sizeof(uint32_t));
+    }
+
+    uint32_t strings = ciwic_astfile_alloc(&w, w.strings_len);
+    if (w.strings_len != 0) {
+        memcpy(&w.buf[strings], w.strings, w.strings_len);
+    }
+
+    ciwic_astfile_header *header = (ciwic_astfile_header *) w.buf;
+    memcpy(header->magic, CIWIC_ASTFILE_MAGIC, sizeof(header->magic));
+    header->version = CIWIC_ASTFILE_VERSION;
+    header->size = w.len;
+    header->content_hash = content_hash;
+    header->definitions = definitions;
+    header->node_count = w.node_count;
+    header->strings = strings;
+    header->strings_size = w.strings_len;
+
+    free(w.strings);
+    free(w.intern);
+    free(w.stack);
+
+    *data = w.buf;
+    *size = w.len;
+    return 0;
+}
+
+int ciwic_astfile_write(const char *path, ciwic_translation_unit *translation_unit, uint64_t content_hash) {
+    char *data;
+    size_t size;
+
+    if (ciwic_astfile_serialize(translation_unit, content_hash, &data, &size)) {
+        return 1;
+    }
+
+    // Write to a temporary file first so readers never map a partial file
+    size_t path_len = strlen(path);
+    char *tmp = malloc(path_len + 32);
+    snprintf(tmp, path_len + 32, "%s.tmp.%ld", path, (long) getpid());
+
+    FILE *file = fopen(tmp, "wb");
+    if (file == NULL) {
+        free(tmp);
+        free(data);
+        return 1;
+    }
+
+    int res = fwrite(data, 1, size, file) != size;
+    res |= fclose(file) != 0;
+    res = res || rename(tmp, path) != 0;
+
+    if (res) {
+        unlink(tmp);
+    }
+
+    free(tmp);
+    free(data);
+    return res;
+}
+
+// Returns 1 unless the child list at offset lies within [min, max) of data
+// and every offset in it is below offset, the list's own offset. A node's
+// list is written after its children and before the node, whose offset is
+// passed as max, so every child lies below its parent and there is no cycle.
+int ciwic_astfile_check_list(char *data, uint32_t offset, uint32_t min, uint32_t max) {
+    if (offset % 4 != 0 || offset < min || (uint64_t) offset + sizeof(uint32_t) > max) {
+        return 1;
+    }
+
+    uint32_t *list = (uint32_t *) &data[offset];
+    if ((uint64_t) offset + sizeof(uint32_t) * ((uint64_t) list[0] + 1) > max) {
+        return 1;
+    }
+
+    for (uint32_t i = 1; i <= list[0]; i++) {
+        if (list[i] >= offset) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+// Checks that every node reachable from the definitions, its child list and
+// its string lie within the file. Children are written before the list that
+// refers to them, so requiring lower offsets also rules out cycles, and a
+// node shared by several lists shows up as more nodes than were written.
+// Returns 0 if the file is valid.
+int ciwic_astfile_check(char *data) {
+    ciwic_astfile_header *header = (ciwic_astfile_header *) data;
+    uint32_t nodes_start = sizeof(ciwic_astfile_header);
+    uint32_t nodes_end = header->strings;
+
+    if (header->strings % 4 != 0 || header->strings < nodes_start
+            || header->node_count > (nodes_end - nodes_start) / sizeof(ciwic_astfile_node)
+            || ciwic_astfile_check_list(data, header->definitions, nodes_start, nodes_end)) {
+        return 1;
+    }
+
+    uint32_t *definitions = (uint32_t *) &data[header->definitions];
+    uint32_t *stack = malloc(sizeof(uint32_t) * ((size_t) definitions[0] + 1));
+    size_t stack_len = 0;
+    size_t stack_cap = definitions[0] + 1;
+    uint32_t visited = 0;
+    int res = 0;
+
+    for (uint32_t i = 1; i <= definitions[0]; i++) {
+        stack[stack_len++] = definitions[i];
+    }
+
+    while (stack_len > 0 && !res) {
+        uint32_t offset = stack[--stack_len];
+        if (offset == 0) {
+            continue;
+        }
+
+        ciwic_astfile_node *node = (ciwic_astfile_node *) &data[offset];
+        if (offset % 4 != 0 || offset < nodes_start || (uint64_t) offset + sizeof(ciwic_astfile_node) > nodes_end
+                || node->kind >= ciwic_node_kind_count || ++visited > header->node_count) {
+            res = 1;
+            break;
+        }
+
+        if (node->string != CIWIC_ASTFILE_NONE) {
+            if (node->string % 4 != 0 || (uint64_t) node->string + sizeof(uint32_t) > header->strings_size) {
+                res = 1;
+                break;
+            }
+            uint32_t len = *(uint32_t *) &data[header->strings + node->string];
+            if ((uint64_t) node->string + sizeof(uint32_t) + len + 1 > header->strings_size) {
+                res = 1;
+                break;
+            }
+        }
+
+        if (node->children == 0) {
+            continue;
+        }
+
+        if (ciwic_astfile_check_list(data, node->children, nodes_start, offset)) {
+            res = 1;
+            break;
+        }
+
+        uint32_t *list = (uint32_t *) &data[node->children];
+        stack = ciwic_astfile_grow(stack, &stack_cap, stack_len + list[0], sizeof(uint32_t));
+        for (uint32_t i = 1; i <= list[0]; i++) {
+            stack[stack_len++] = list[i];
+        }
+    }
+
+    free(stack);
+    return res || visited != header->node_count;
+}
+
+int ciwic_astfile_open(ciwic_astfile *file, const char *path, uint64_t content_hash) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return 1;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) || (size_t) st.st_size < sizeof(ciwic_astfile_header)) {
+        close(fd);
+        return 1;
+    }
+
+    char *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (data == MAP_FAILED) {
+        return 1;
+    }
+
+    ciwic_astfile_header *header = (ciwic_astfile_header *) data;
+
+    if (memcmp(header->magic, CIWIC_ASTFILE_MAGIC, sizeof(header->magic)) != 0
+            || header->version != CIWIC_ASTFILE_VERSION
+            || header->size != (size_t) st.st_size
+            || header->content_hash != content_hash
+            || (uint64_t) header->strings + header->strings_size > header->size
+            || ciwic_astfile_check(data)) {
+        munmap(data, st.st_size);
+        return 1;
+    }
+
+    file->data = data;
+    file->size = st.st_size;
+    return 0;
+}
+
+void ciwic_astfile_close(ciwic_astfile *file) {
+    munmap(file->data, file->size);
+    file->data = NULL;
+    file->size = 0;
+}
+
+int ciwic_astfile_definition_count(ciwic_astfile *file) {
+    ciwic_astfile_header *header = (ciwic_astfile_header *) file->data;
+    return *(uint32_t *) &file->data[header->definitions];
+}
+
+ciwic_astfile_node *ciwic_astfile_definition(ciwic_astfile *file, int i) {
+    ciwic_astfile_header *header = (ciwic_astfile_header *) file->data;
+    uint32_t *list = (uint32_t *) &file->data[header->definitions];
+    return (ciwic_astfile_node *) &file->data[list[i + 1]];
+}
+
+int ciwic_astfile_child_count(ciwic_astfile *file, ciwic_astfile_node *node) {
+    if (node->children == 0) {
+        return 0;
+    }
+    return *(uint32_t *) &file->data[node->children];
+}
+
+ciwic_astfile_node *ciwic_astfile_child(ciwic_astfile *file, ciwic_astfile_node *node, int i) {
+    uint32_t *list = (uint32_t *) &file->data[node->children];
+    if (list[i + 1] == 0) {
+        return NULL;
+    }
+    return (ciwic_astfile_node *) &file->data[list[i + 1]];
+}
+
+int ciwic_astfile_string(ciwic_astfile *file, ciwic_astfile_node *node, string *res) {
+    if (node->string == CIWIC_ASTFILE_NONE) {
+        return 1;
+    }
+
+    ciwic_astfile_header *header = (ciwic_astfile_header *) file->data;
+    char *entry = &file->data[header->strings + node->string];
+
+    res->len = *(uint32_t *) entry;
+    res->text = entry + sizeof(uint32_t);
+    return 0;
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <parselib.h>
+#include <ast.h>
+
+// Binary AST files
+//
+// A relocatable form of a ciwic_translation_unit that can be memory mapped
+// and read in place. All references are byte offsets from the start of the
+// file, all values are in native byte order and every structure is 4 byte
+// aligned. The file consists of a header, the nodes and their child lists,
+// and a table of interned strings.
+//
+// Child lists are a uint32_t count followed by that many node offsets, where
+// 0 marks an absent optional child. Lists in the AST (parameters, arguments,
+// the statements of a block, ...) are flattened into the child list of their
+// owner. The children and values of each node kind are:
+//
+//   translation unit        type: ciwic_definition_type
+//                           children: function definition or declaration
+//   function definition     children: specifiers, declarator, statement,
+//                           then one declaration per old style parameter
+//   declaration             children: specifiers, init declarators...
+//   declaration specifiers  type: ciwic_type_spec
+//                           values: storage class, function specifiers,
+//                           type qualifiers, primitive type
+//                           string: struct, union or enum tag, or typedef name
+//                           children: struct lists... or enum lists...
+//   init declarator list    children: declarator, initializer?
+//   declarator              type: ciwic_declarator_type
+//                           values: pointer: qualifiers; array: is static,
+//                           is var len, type qualifiers; func: has ellipsis
+//                           string: identifier
+//                           children: inner?, then array size? or params...
+//   param list              children: specifiers, declarator?
+//   type name               children: specifiers, declarator?
+//   initializer             type: ciwic_initializer_type
+//                           children: expr, or initializer lists...
+//   initializer list        children: initializer, designators...
+//   designator list         type: ciwic_designator_type
+//                           string: identifier; children: expr
+//   struct list             children: specifiers, struct declarators...
+//   struct declarator list  children: declarator?, width?
+//   enum list               string: name; children: value?
+//   expr                    type: ciwic_expr_type
+//                           values: operator, or ciwic_constant_type
+//                           string: identifier, member or constant text
+//                           children: operands in source order; a call has
+//                           the function followed by its arguments, and
+//                           initialize has the type name followed by the
+//                           initializer lists
+//   statement               type: ciwic_statement_type
+//                           string: label or goto target
+//                           children: as in ciwic_statement; a block has one
+//                           child per statement, for has pre decl?, pre
+//                           expr?, test?, post? and the body
+
+#define CIWIC_ASTFILE_MAGIC "CIWICAST"
+#define CIWIC_ASTFILE_VERSION 1
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t size; // Size of the whole file
+    uint64_t content_hash; // Hash of the source the AST was parsed from
+    uint32_t definitions; // Offset of the child list of top-level definitions
+    uint32_t node_count;
+    uint32_t strings; // Offset of the string table
+    uint32_t strings_size;
+} ciwic_astfile_header;
+
+typedef struct {
+    uint16_t kind; // ciwic_node_kind
+    uint16_t type;
+    int32_t start; // Span, or -1 if the node has none
+    int32_t end;
+    uint32_t values[4];
+    uint32_t string; // Offset into the string table, or CIWIC_ASTFILE_NONE
+    uint32_t children; // Offset of the child list, or 0 if there is none
+} ciwic_astfile_node;
+
+#define CIWIC_ASTFILE_NONE 0xffffffffu
+
+typedef struct {
+    char *data;
+    size_t size;
+} ciwic_astfile;
+
+// Serializes translation_unit into a newly malloced buffer. Returns 0 on
+// success.
+int ciwic_astfile_serialize(ciwic_translation_unit *translation_unit, uint64_t content_hash, char **data, size_t *size);
+
+// Writes translation_unit to path, replacing it atomically
+int ciwic_astfile_write(const char *path, ciwic_translation_unit *translation_unit, uint64_t content_hash);
+
+// Maps the AST file at path. Fails if it is not a valid AST file or was
+// written for a source with a different content hash.
+int ciwic_astfile_open(ciwic_astfile *file, const char *path, uint64_t content_hash);
+void ciwic_astfile_close(ciwic_astfile *file);
+
+int ciwic_astfile_definition_count(ciwic_astfile *file);
+ciwic_astfile_node *ciwic_astfile_definition(ciwic_astfile *file, int i);
+
+int ciwic_astfile_child_count(ciwic_astfile *file, ciwic_astfile_node *node);
+ciwic_astfile_node *ciwic_astfile_child(ciwic_astfile *file, ciwic_astfile_node *node, int i); // Can be null
+int ciwic_astfile_string(ciwic_astfile *file, ciwic_astfile_node *node, string *res);
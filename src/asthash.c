@@ -0,0 +1,256 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include <asthash.h>
+#include <hash.h>
+#include <visit.h>
+
+typedef struct {
+    // Hashes of the finished children of every node being visited
+    uint64_t *hashes;
+    int hashes_len;
+    int hashes_cap;
+
+    // Where the children of each node being visited start in hashes
+    int *bases;
+    int bases_len;
+    int bases_cap;
+} ciwic_ast_hasher;
+
+uint64_t ciwic_ast_hash_string(uint64_t h, string *str) {
+    return ciwic_hash_combine(h, ciwic_hash64(str->text, str->len, 0));
+}
+
+// Mixes in which optional children are present, since children are only
+// told apart by their position
+uint64_t ciwic_ast_hash_present(uint64_t h, const void *a, const void *b, const void *c, const void *d) {
+    return ciwic_hash_combine(h, (a != NULL) | (b != NULL) << 1 | (c != NULL) << 2 | (d != NULL) << 3);
+}
+
+uint64_t ciwic_ast_hash_expr(uint64_t h, ciwic_expr *expr) {
+    h = ciwic_hash_combine(h, expr->type);
+
+    switch (expr->type) {
+        case ciwic_expr_type_identifier:
+            return ciwic_ast_hash_string(h, &expr->identifier);
+        case ciwic_expr_type_constant:
+            h = ciwic_hash_combine(h, expr->constant.type);
+            return ciwic_hash_combine(h, ciwic_hash64(expr->constant.raw_text, strlen(expr->constant.raw_text), 0));
+        case ciwic_expr_type_unary_op:
+            return ciwic_hash_combine(h, expr->unary_op.op);
+        case ciwic_expr_type_binary_op:
+            return ciwic_hash_combine(h, expr->binary_op.op);
+        case ciwic_expr_type_assignment:
+            return ciwic_hash_combine(h, expr->assignment.op);
+        case ciwic_expr_type_member:
+        case ciwic_expr_type_member_deref:
+            return ciwic_ast_hash_string(h, &expr->member.identifier);
+        case ciwic_expr_type_call:
+            return ciwic_ast_hash_present(h, expr->call.args, NULL, NULL, NULL);
+        default:
+            return h;
+    }
+}
+
+uint64_t ciwic_ast_hash_specifiers(uint64_t h, ciwic_declaration_specifiers *specs) {
+    h = ciwic_hash_combine(h, specs->storage_class);
+    h = ciwic_hash_combine(h, specs->func_specifiers);
+    h = ciwic_hash_combine(h, specs->type_qualifiers);
+    h = ciwic_hash_combine(h, specs->type_spec);
+
+    switch (specs->type_spec) {
+        case ciwic_type_spec_prim:
+            return ciwic_hash_combine(h, specs->prim_type);
+        case ciwic_type_spec_struct:
+        case ciwic_type_spec_union:
+            h = ciwic_ast_hash_present(h, specs->struct_or_union.identifier, specs->struct_or_union.decl, NULL, NULL);
+            if (specs->struct_or_union.identifier != NULL) {
+                h = ciwic_ast_hash_string(h, specs->struct_or_union.identifier);
+            }
+            return h;
+        case ciwic_type_spec_enum:
+            h = ciwic_ast_hash_present(h, specs->enum_.identifier, specs->enum_.decl, NULL, NULL);
+            if (specs->enum_.identifier != NULL) {
+                h = ciwic_ast_hash_string(h, specs->enum_.identifier);
+            }
+            return h;
+        case ciwic_type_spec_typedef_name:
+            return ciwic_ast_hash_string(h, &specs->typedef_name);
+        default:
+            return h;
+    }
+}
+
+uint64_t ciwic_ast_hash_declarator(uint64_t h, ciwic_declarator *decl) {
+    h = ciwic_hash_combine(h, decl->type);
+    h = ciwic_ast_hash_present(h, decl->inner, NULL, NULL, NULL);
+
+    switch (decl->type) {
+        case ciwic_declarator_pointer:
+            return ciwic_hash_combine(h, decl->pointer_qualifiers);
+        case ciwic_declarator_identifier:
+            return ciwic_ast_hash_string(h, &decl->ident);
+        case ciwic_declarator_array:
+            h = ciwic_hash_combine(h, decl->array.is_static);
+            h = ciwic_hash_combine(h, decl->array.is_var_len);
+            h = ciwic_hash_combine(h, decl->array.type_qualifiers);
+            return ciwic_ast_hash_present(h, decl->array.expr, NULL, NULL, NULL);
+        case ciwic_declarator_func:
+            h = ciwic_hash_combine(h, decl->func.has_ellipsis);
+            return ciwic_ast_hash_present(h, decl->func.param_list, NULL, NULL, NULL);
+        default:
+            return h;
+    }
+}
+
+uint64_t ciwic_ast_hash_statement(uint64_t h, ciwic_statement *stmt) {
+    h = ciwic_hash_combine(h, stmt->type);
+
+    switch (stmt->type) {
+        case ciwic_statement_label:
+            return ciwic_ast_hash_string(h, &stmt->labeled.label_ident);
+        case ciwic_statement_goto:
+            return ciwic_ast_hash_string(h, &stmt->goto_ident);
+        case ciwic_statement_if:
+            return ciwic_ast_hash_present(h, stmt->if_stmt.if_else, NULL, NULL, NULL);
+        case ciwic_statement_for:
+            return ciwic_ast_hash_present(h, stmt->for_stmt.pre_decl, stmt->for_stmt.pre_expr,
+                    stmt->for_stmt.test_expr, stmt->for_stmt.post_expr);
+        case ciwic_statement_return:
+            return ciwic_ast_hash_present(h, stmt->return_expr, NULL, NULL, NULL);
+        default:
+            return h;
+    }
+}
+
+// Hashes the values a node holds itself
+uint64_t ciwic_ast_hash_local(ciwic_node_kind kind, void *node) {
+    uint64_t h = ciwic_hash_combine(0, kind);
+
+    switch (kind) {
+        case ciwic_node_translation_unit:
+            return ciwic_hash_combine(h, ((ciwic_translation_unit *) node)->def_type);
+        case ciwic_node_func_definition:
+            return ciwic_ast_hash_present(h, ((ciwic_func_definition *) node)->decl_list, NULL, NULL, NULL);
+        case ciwic_node_declaration_specifiers:
+            return ciwic_ast_hash_specifiers(h, node);
+        case ciwic_node_init_declarator_list:
+            return ciwic_ast_hash_present(h, ((ciwic_init_declarator_list *) node)->initializer, NULL, NULL, NULL);
+        case ciwic_node_declarator:
+            return ciwic_ast_hash_declarator(h, node);
+        case ciwic_node_param_list:
+            return ciwic_ast_hash_present(h, ((ciwic_param_list *) node)->declarator, NULL, NULL, NULL);
+        case ciwic_node_type_name:
+            return ciwic_ast_hash_present(h, ((ciwic_type_name *) node)->declarator, NULL, NULL, NULL);
+        case ciwic_node_initializer:
+            return ciwic_hash_combine(h, ((ciwic_initializer *) node)->type);
+        case ciwic_node_initializer_list:
+            return ciwic_ast_hash_present(h, ((ciwic_initializer_list *) node)->designation, NULL, NULL, NULL);
+        case ciwic_node_designator_list: {
+            ciwic_designator_list *list = node;
+            h = ciwic_hash_combine(h, list->type);
+            if (list->type == ciwic_designator_ident) {
+                h = ciwic_ast_hash_string(h, &list->ident);
+            }
+            return h;
+        }
+        case ciwic_node_struct_declarator_list: {
+            ciwic_struct_declarator_list *list = node;
+            return ciwic_ast_hash_present(h, list->declarator, list->expr, NULL, NULL);
+        }
+        case ciwic_node_enum_list: {
+            ciwic_enum_list *list = node;
+            h = ciwic_ast_hash_string(h, &list->name);
+            return ciwic_ast_hash_present(h, list->expr, NULL, NULL, NULL);
+        }
+        case ciwic_node_expr:
+            return ciwic_ast_hash_expr(h, node);
+        case ciwic_node_statement:
+            return ciwic_ast_hash_statement(h, node);
+        default:
+            return h;
+    }
+}
+
+void ciwic_ast_hasher_push(ciwic_ast_hasher *hasher, uint64_t h) {
+    if (hasher->hashes_len == hasher->hashes_cap) {
+        hasher->hashes_cap = hasher->hashes_cap ? hasher->hashes_cap * 2 : 64;
+        hasher->hashes = realloc(hasher->hashes, sizeof(uint64_t) * hasher->hashes_cap);
+    }
+    hasher->hashes[hasher->hashes_len++] = h;
+}
+
+ciwic_visit_result ciwic_ast_hash_pre(void *data, ciwic_node_kind kind, void *node) {
+    ciwic_ast_hasher *hasher = data;
+
+    if (hasher->bases_len == hasher->bases_cap) {
+        hasher->bases_cap = hasher->bases_cap ? hasher->bases_cap * 2 : 64;
+        hasher->bases = realloc(hasher->bases, sizeof(int) * hasher->bases_cap);
+    }
+    hasher->bases[hasher->bases_len++] = hasher->hashes_len;
+
+    return ciwic_visit_continue;
+}
+
+ciwic_visit_result ciwic_ast_hash_post(void *data, ciwic_node_kind kind, void *node) {
+    ciwic_ast_hasher *hasher = data;
+    int base = hasher->bases[--hasher->bases_len];
+    uint64_t h = ciwic_ast_hash_local(kind, node);
+
+    for (int i = base; i < hasher->hashes_len; i++) {
+        h = ciwic_hash_combine(h, hasher->hashes[i]);
+    }
+    h = ciwic_hash_combine(h, hasher->hashes_len - base);
+
+    hasher->hashes_len = base;
+    ciwic_ast_hasher_push(hasher, h);
+
+    switch (kind) {
+        case ciwic_node_func_definition:
+            ((ciwic_func_definition *) node)->hash = h;
+            break;
+        case ciwic_node_declaration:
+            ((ciwic_declaration *) node)->hash = h;
+            break;
+        case ciwic_node_expr:
+            ((ciwic_expr *) node)->hash = h;
+            break;
+        default:
+            break;
+    }
+
+    return ciwic_visit_continue;
+}
+
+uint64_t ciwic_ast_hash_node(ciwic_node_kind kind, void *node) {
+    ciwic_ast_hasher hasher = {0};
+    ciwic_visitor visitor;
+
+    ciwic_visitor_init(&visitor, &hasher);
+
+    for (int i = 0; i < ciwic_node_kind_count; i++) {
+        visitor.pre[i] = ciwic_ast_hash_pre;
+        visitor.post[i] = ciwic_ast_hash_post;
+    }
+
+    ciwic_visit(&visitor, kind, node);
+
+    // One hash is left per cell of a list
+    uint64_t h = ciwic_hash_combine(0, kind);
+    for (int i = 0; i < hasher.hashes_len; i++) {
+        h = ciwic_hash_combine(h, hasher.hashes[i]);
+    }
+    if (hasher.hashes_len == 1) {
+        h = hasher.hashes[0];
+    }
+
+    ciwic_visitor_free(&visitor);
+    free(hasher.hashes);
+    free(hasher.bases);
+
+    return h;
+}
+
+uint64_t ciwic_ast_hash(ciwic_translation_unit *translation_unit) {
+    return ciwic_ast_hash_node(ciwic_node_translation_unit, translation_unit);
+}
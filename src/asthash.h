@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <ast.h>
+
+// Merkle hashing of the AST
+//
+// The hash of a node mixes its kind, its own values (operators, names,
+// constant text, qualifiers, ...) and the hashes of its children in order.
+// Spans are ignored, so two subtrees hash the same exactly when they are
+// the same code up to white-space and comments. The hash of every function
+// definition, declaration and expression is stored in its hash field.
+
+// Hashes every definition in translation_unit and returns the hash of the
+// whole list
+uint64_t ciwic_ast_hash(ciwic_translation_unit *translation_unit);
+
+// Hashes node, which is of the given kind, and for list kinds every cell
+// after it
+uint64_t ciwic_ast_hash_node(ciwic_node_kind kind, void *node);
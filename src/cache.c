@@ -0,0 +1,184 @@
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cache.h>
+#include <hash.h>
+#include <parser.h>
+
+typedef struct {
+    char *path;
+    struct timespec used;
+    size_t size;
+} ciwic_cache_entry;
+
+int ciwic_cache_is_entry(const char *name) {
+    size_t len = strlen(name);
+    return len > 4 && strcmp(&name[len - 4], ".ast") == 0;
+}
+
+char *ciwic_cache_path(ciwic_cache *cache, const char *name) {
+    size_t len = strlen(cache->dir) + strlen(name) + 2;
+    char *path = malloc(len);
+    snprintf(path, len, "%s/%s", cache->dir, name);
+    return path;
+}
+
+char *ciwic_cache_entry_path(ciwic_cache *cache, uint64_t key) {
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.ast", (unsigned long long) key);
+    return ciwic_cache_path(cache, name);
+}
+
+// Lists all entries in the cache directory and sums their sizes
+int ciwic_cache_scan(ciwic_cache *cache, ciwic_cache_entry **entries, int *len) {
+    DIR *dir = opendir(cache->dir);
+    if (dir == NULL) {
+        return 1;
+    }
+
+    int cap = 0;
+    struct dirent *ent;
+
+    *entries = NULL;
+    *len = 0;
+    cache->size = 0;
+
+    while ((ent = readdir(dir)) != NULL) {
+        if (!ciwic_cache_is_entry(ent->d_name)) {
+            continue;
+        }
+
+        char *path = ciwic_cache_path(cache, ent->d_name);
+        struct stat st;
+        if (stat(path, &st)) {
+            free(path);
+            continue;
+        }
+
+        if (*len == cap) {
+            cap = cap ? cap * 2 : 64;
+            *entries = realloc(*entries, sizeof(ciwic_cache_entry) * cap);
+        }
+
+        (*entries)[*len].path = path;
+        (*entries)[*len].used = st.st_mtim;
+        (*entries)[*len].size = st.st_size;
+        (*len)++;
+
+        cache->size += st.st_size;
+    }
+
+    closedir(dir);
+    return 0;
+}
+
+void ciwic_cache_free_entries(ciwic_cache_entry *entries, int len) {
+    for (int i = 0; i < len; i++) {
+        free(entries[i].path);
+    }
+    free(entries);
+}
+
+int ciwic_cache_init(ciwic_cache *cache, const char *dir, size_t max_size) {
+    if (mkdir(dir, 0777) && errno != EEXIST) {
+        return 1;
+    }
+
+    cache->dir = strdup(dir);
+    cache->max_size = max_size;
+    cache->size = 0;
+
+    ciwic_cache_entry *entries;
+    int len;
+
+    if (ciwic_cache_scan(cache, &entries, &len)) {
+        free(cache->dir);
+        return 1;
+    }
+
+    ciwic_cache_free_entries(entries, len);
+    return 0;
+}
+
+void ciwic_cache_free(ciwic_cache *cache) {
+    free(cache->dir);
+    cache->dir = NULL;
+}
+
+uint64_t ciwic_cache_key(const char *text, int len, int flags) {
+    uint64_t seed = ciwic_hash_combine(CIWIC_PARSER_VERSION, CIWIC_ASTFILE_VERSION);
+    seed = ciwic_hash_combine(seed, flags);
+    return ciwic_hash64(text, len, seed);
+}
+
+int ciwic_cache_lookup(ciwic_cache *cache, uint64_t key, ciwic_astfile *file) {
+    char *path = ciwic_cache_entry_path(cache, key);
+    int res = ciwic_astfile_open(file, path, key);
+
+    // The modification time doubles as the time of last use
+    if (!res) {
+        utimensat(AT_FDCWD, path, NULL, 0);
+    }
+
+    free(path);
+    return res;
+}
+
+int ciwic_cache_store(ciwic_cache *cache, uint64_t key, ciwic_translation_unit *translation_unit) {
+    char *path = ciwic_cache_entry_path(cache, key);
+    int res = ciwic_astfile_write(path, translation_unit, key);
+
+    struct stat st;
+    if (!res && !stat(path, &st)) {
+        cache->size += st.st_size;
+    }
+
+    free(path);
+
+    if (cache->size > cache->max_size) {
+        ciwic_cache_evict(cache);
+    }
+
+    return res;
+}
+
+int ciwic_cache_entry_cmp(const void *a, const void *b) {
+    const ciwic_cache_entry *x = a;
+    const ciwic_cache_entry *y = b;
+
+    if (x->used.tv_sec != y->used.tv_sec) {
+        return x->used.tv_sec < y->used.tv_sec ? -1 : 1;
+    }
+    if (x->used.tv_nsec != y->used.tv_nsec) {
+        return x->used.tv_nsec < y->used.tv_nsec ? -1 : 1;
+    }
+    return 0;
+}
+
+void ciwic_cache_evict(ciwic_cache *cache) {
+    ciwic_cache_entry *entries;
+    int len;
+
+    if (ciwic_cache_scan(cache, &entries, &len)) {
+        return;
+    }
+
+    // Evict down to 90% so the next few stores do not rescan the directory
+    size_t target = cache->max_size / 10 * 9;
+
+    qsort(entries, len, sizeof(ciwic_cache_entry), ciwic_cache_entry_cmp);
+
+    for (int i = 0; i < len && cache->size > target; i++) {
+        if (!unlink(entries[i].path)) {
+            cache->size -= entries[i].size;
+        }
+    }
+
+    ciwic_cache_free_entries(entries, len);
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ast.h>
+#include <astfile.h>
+
+// Content addressed cache of parse results
+//
+// Every entry is an AST file in the cache directory named after the hash of
+// the source text, the parser and file format versions and the parser flags,
+// so an entry can never be used for input it was not parsed from. Looking an
+// entry up marks it as recently used, and storing one evicts the least
+// recently used entries once the directory grows beyond max_size bytes.
+
+typedef struct {
+    char *dir;
+    size_t max_size;
+    size_t size; // Total size of the entries, as far as we know
+} ciwic_cache;
+
+// Creates dir if it does not exist. Returns 0 on success.
+int ciwic_cache_init(ciwic_cache *cache, const char *dir, size_t max_size);
+void ciwic_cache_free(ciwic_cache *cache);
+
+uint64_t ciwic_cache_key(const char *text, int len, int flags);
+
+// Maps the entry for key into file. Returns 1 on a miss.
+int ciwic_cache_lookup(ciwic_cache *cache, uint64_t key, ciwic_astfile *file);
+int ciwic_cache_store(ciwic_cache *cache, uint64_t key, ciwic_translation_unit *translation_unit);
+
+// Removes least recently used entries until the cache fits in max_size
+void ciwic_cache_evict(ciwic_cache *cache);
@@ -0,0 +1,117 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include <ciwic.h>
+#include <emit.h>
+#include <export.h>
+#include <parser.h>
+
+struct ciwic_context {
+    char *text;
+    int cap;
+    int flags;
+    ciwic_parser parser;
+    ciwic_translation_unit translation_unit;
+    int parsed;
+    int error; // Offset where the last parse stopped, or -1
+};
+
+const char *ciwic_version(void) {
+    return CIWIC_VERSION;
+}
+
+ciwic_context *ciwic_context_new(void) {
+    ciwic_context *ctx = malloc(sizeof(ciwic_context));
+    ctx->text = NULL;
+    ctx->cap = 0;
+    ctx->parser = ciwic_parser_new(NULL, 0);
+    ctx->flags = ctx->parser.flags;
+    ctx->parsed = 0;
+    ctx->error = -1;
+    return ctx;
+}
+
+void ciwic_context_free(ciwic_context *ctx) {
+    ciwic_parser_free(&ctx->parser);
+    free(ctx->text);
+    free(ctx);
+}
+
+void ciwic_context_set_flags(ciwic_context *ctx, int flags) {
+    ctx->flags = flags;
+}
+
+void ciwic_context_set_limits(ciwic_context *ctx, ciwic_parser_limits limits) {
+    ctx->parser.limits = limits;
+}
+
+ciwic_translation_unit *ciwic_parse(ciwic_context *ctx, const char *text, int len) {
+    if (ctx->cap < len + 1) {
+        ctx->cap = len + 1;
+        ctx->text = realloc(ctx->text, ctx->cap);
+    }
+    memcpy(ctx->text, text, len);
+    ctx->text[len] = 0;
+
+    ciwic_parser_reset(&ctx->parser, ctx->text, len);
+    ctx->parser.flags = ctx->flags;
+    ctx->parsed = 0;
+    ctx->error = -1;
+
+    if (ciwic_parser_translation_unit(&ctx->parser, &ctx->translation_unit)) {
+        ctx->error = 0;
+        return NULL;
+    }
+
+    ciwic_parser_whitespace(&ctx->parser);
+    if (ctx->parser.pos != len) {
+        ctx->error = ctx->parser.pos;
+        return NULL;
+    }
+
+    ctx->parsed = 1;
+    return &ctx->translation_unit;
+}
+
+int ciwic_context_error(ciwic_context *ctx, int *offset, ciwic_location *loc) {
+    if (ctx->error < 0) {
+        return 1;
+    }
+
+    *offset = ctx->error;
+    return ciwic_parser_location(&ctx->parser, ctx->error, loc);
+}
+
+ciwic_parser_stop ciwic_context_stopped(ciwic_context *ctx) {
+    return ctx->parser.stop;
+}
+
+int ciwic_context_location(ciwic_context *ctx, int offset, ciwic_location *loc) {
+    return ciwic_parser_location(&ctx->parser, offset, loc);
+}
+
+int ciwic_context_write(ciwic_context *ctx, ciwic_format format, ciwic_sink *sink) {
+    if (!ctx->parsed) {
+        return 1;
+    }
+
+    switch (format) {
+        case ciwic_format_text:
+            ciwic_print_translation_unit(sink, &ctx->translation_unit, 0);
+            ciwic_sink_char(sink, '\n');
+            break;
+        case ciwic_format_json:
+            ciwic_export_translation_unit(sink, ciwic_export_json, &ctx->translation_unit);
+            break;
+        case ciwic_format_sexpr:
+            ciwic_export_translation_unit(sink, ciwic_export_sexpr, &ctx->translation_unit);
+            break;
+        case ciwic_format_c:
+            ciwic_emit_c(sink, &ctx->translation_unit);
+            break;
+        default:
+            return 1;
+    }
+
+    return sink->error;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <ast.h>
+#include <parselib.h>
+#include <sink.h>
+
+// Public interface of libciwic
+//
+// Everything needed to parse C in-process: a context owns the source text,
+// the parser state and the resulting AST, so a program can parse one buffer
+// after another through the same context. Buffers are kept between parses,
+// so parsing many files through one context soon stops allocating. The AST
+// types are those of ast.h.
+
+#define CIWIC_VERSION_MAJOR 0
+#define CIWIC_VERSION_MINOR 1
+#define CIWIC_VERSION_PATCH 0
+#define CIWIC_VERSION "0.1.0"
+
+typedef struct ciwic_context ciwic_context;
+
+typedef enum {
+    ciwic_format_text,
+    ciwic_format_json,
+    ciwic_format_sexpr,
+    ciwic_format_c,
+} ciwic_format;
+
+// Version of the library that is linked, which may differ from CIWIC_VERSION
+const char *ciwic_version(void);
+
+ciwic_context *ciwic_context_new(void);
+void ciwic_context_free(ciwic_context *ctx);
+
+// Sets the ciwic_parser_flags used by following parses
+void ciwic_context_set_flags(ciwic_context *ctx, int flags);
+
+// Sets the limits on the work of following parses. The defaults are
+// those of ciwic_parser_default_limits. The cancel flag may be set from
+// another thread while a parse runs.
+void ciwic_context_set_limits(ciwic_context *ctx, ciwic_parser_limits limits);
+
+// Parses text as a translation unit. The text is copied, so it need not
+// outlive the call. Returns null if it could not be parsed; the AST is valid
+// until the next parse with ctx or until ctx is freed.
+ciwic_translation_unit *ciwic_parse(ciwic_context *ctx, const char *text, int len);
+
+// Offset and location of the first definition the last parse could not
+// parse. Returns 1 if the last parse succeeded.
+int ciwic_context_error(ciwic_context *ctx, int *offset, ciwic_location *loc);
+
+// Why the last parse was stopped by a limit, or ciwic_parser_running if it
+// was not
+ciwic_parser_stop ciwic_context_stopped(ciwic_context *ctx);
+
+// Location of an offset into the last parsed text
+int ciwic_context_location(ciwic_context *ctx, int offset, ciwic_location *loc);
+
+// Writes the AST of the last successful parse to sink
+int ciwic_context_write(ciwic_context *ctx, ciwic_format format, ciwic_sink *sink);
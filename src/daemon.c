@@ -0,0 +1,464 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <daemon.h>
+#include <emit.h>
+#include <export.h>
+#include <parser.h>
+#include <sink.h>
+#include <workspace.h>
+
+#define CIWIC_DAEMON_MAX_REQUEST (1 << 20)
+// A file taking more steps than this is reported as unparseable rather than
+// holding up every other client
+#define CIWIC_DAEMON_MAX_STEPS (1L << 26)
+
+typedef struct {
+    int fd;
+    char *buf;
+    int len;
+    int cap;
+
+    // Responses not yet taken by the client, which is not read from until
+    // they all are
+    char *out;
+    int out_pos;
+    int out_len;
+    int out_cap;
+} ciwic_daemon_client;
+
+typedef struct {
+    int listen_fd;
+    ciwic_workspace ws;
+    ciwic_sink out;
+
+    ciwic_daemon_client *clients;
+    int clients_len;
+    int clients_cap;
+} ciwic_daemon;
+
+int ciwic_daemon_write_all(int fd, const char *data, int len) {
+    while (len > 0) {
+        ssize_t n = write(fd, data, len);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return 1;
+        }
+        data += n;
+        len -= n;
+    }
+    return 0;
+}
+
+int ciwic_daemon_read_all(int fd, char *data, int len) {
+    while (len > 0) {
+        ssize_t n = read(fd, data, len);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return 1;
+        }
+        data += n;
+        len -= n;
+    }
+    return 0;
+}
+
+int ciwic_daemon_write_frame(int fd, const char *data, int len) {
+    unsigned char header[4] = { len >> 24, len >> 16, len >> 8, len };
+    return ciwic_daemon_write_all(fd, (char *) header, 4) || ciwic_daemon_write_all(fd, data, len);
+}
+
+int ciwic_daemon_frame_len(const char *header) {
+    const unsigned char *h = (const unsigned char *) header;
+    return (int) ((unsigned) h[0] << 24 | h[1] << 16 | h[2] << 8 | h[3]);
+}
+
+int ciwic_daemon_connect(const char *socket_path) {
+    struct sockaddr_un addr = { .sun_family = AF_UNIX };
+
+    if (strlen(socket_path) >= sizeof(addr.sun_path)) {
+        return -1;
+    }
+    strcpy(addr.sun_path, socket_path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return -1;
+    }
+
+    if (connect(fd, (struct sockaddr *) &addr, sizeof(addr))) {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+int ciwic_daemon_request(const char *socket_path, const char *request, char **response, int *len) {
+    int fd = ciwic_daemon_connect(socket_path);
+    if (fd < 0) {
+        return 1;
+    }
+
+    char header[4];
+
+    if (ciwic_daemon_write_frame(fd, request, strlen(request)) || ciwic_daemon_read_all(fd, header, 4)) {
+        close(fd);
+        return 1;
+    }
+
+    *len = ciwic_daemon_frame_len(header);
+    *response = malloc(*len + 1);
+
+    if (ciwic_daemon_read_all(fd, *response, *len)) {
+        free(*response);
+        close(fd);
+        return 1;
+    }
+
+    (*response)[*len] = 0;
+    close(fd);
+    return 0;
+}
+
+void ciwic_daemon_error(ciwic_daemon *daemon, const char *message, const char *arg) {
+    daemon->out.len = 0;
+    ciwic_sink_str(&daemon->out, "error\n");
+    ciwic_sink_str(&daemon->out, message);
+    if (arg != NULL) {
+        ciwic_sink_str(&daemon->out, arg);
+    }
+    ciwic_sink_char(&daemon->out, '\n');
+}
+
+// Returns the parsed file at path, or writes an error and returns null
+ciwic_workspace_file *ciwic_daemon_file(ciwic_daemon *daemon, const char *path) {
+    char real[PATH_MAX];
+
+    if (path == NULL) {
+        ciwic_daemon_error(daemon, "missing path", NULL);
+        return NULL;
+    }
+
+    ciwic_workspace_file *file = NULL;
+    if (realpath(path, real) != NULL) {
+        file = ciwic_workspace_load(&daemon->ws, real);
+    }
+
+    if (file == NULL) {
+        ciwic_daemon_error(daemon, "could not read ", path);
+        return NULL;
+    }
+
+    if (!file->parsed) {
+        if (file->stop != ciwic_parser_running) {
+            char message[64];
+            snprintf(message, sizeof(message), "parse stopped (%s): ", ciwic_parser_stop_message(file->stop));
+            ciwic_daemon_error(daemon, message, path);
+        } else {
+            ciwic_daemon_error(daemon, "could not parse ", path);
+        }
+        return NULL;
+    }
+
+    return file;
+}
+
+// Returns the identifier a declarator declares, if any
+string *ciwic_daemon_declarator_name(ciwic_declarator *decl) {
+    while (decl != NULL && decl->type != ciwic_declarator_identifier) {
+        decl = decl->inner;
+    }
+    return decl != NULL ? &decl->ident : NULL;
+}
+
+void ciwic_daemon_functions(ciwic_daemon *daemon, ciwic_workspace_file *file) {
+    ciwic_parser parser = ciwic_parser_new(file->text, file->len);
+
+    for (ciwic_translation_unit *def = &file->translation_unit; def != NULL; def = def->rest) {
+        if (def->def_type != ciwic_definition_func) {
+            continue;
+        }
+
+        string *name = ciwic_daemon_declarator_name(&def->func.declarator);
+        ciwic_location loc;
+
+        if (name == NULL || ciwic_parser_location(&parser, def->span.start, &loc)) {
+            continue;
+        }
+
+        ciwic_sink_write(&daemon->out, name->text, name->len);
+        ciwic_sink_char(&daemon->out, ' ');
+        ciwic_sink_int(&daemon->out, loc.line);
+        ciwic_sink_char(&daemon->out, '\n');
+    }
+
+    ciwic_parser_free(&parser);
+}
+
+// Handles one request, leaving the response in daemon->out
+void ciwic_daemon_handle(ciwic_daemon *daemon, char *request) {
+    char *save;
+    char *command = strtok_r(request, " \n", &save);
+    char *path = strtok_r(NULL, " \n", &save);
+    char *arg = strtok_r(NULL, " \n", &save);
+    ciwic_workspace_file *file;
+
+    daemon->out.len = 0;
+    ciwic_sink_str(&daemon->out, "ok\n");
+
+    if (command == NULL) {
+        ciwic_daemon_error(daemon, "empty request", NULL);
+    } else if (strcmp(command, "parse") == 0) {
+        if ((file = ciwic_daemon_file(daemon, path)) != NULL) {
+            int count = 0;
+            for (ciwic_translation_unit *def = &file->translation_unit; def != NULL; def = def->rest) {
+                count++;
+            }
+            ciwic_sink_int(&daemon->out, count);
+            ciwic_sink_char(&daemon->out, '\n');
+        }
+    } else if (strcmp(command, "functions") == 0) {
+        if ((file = ciwic_daemon_file(daemon, path)) != NULL) {
+            ciwic_daemon_functions(daemon, file);
+        }
+    } else if (strcmp(command, "dump") == 0) {
+        if ((file = ciwic_daemon_file(daemon, path)) == NULL) {
+            return;
+        }
+        if (arg == NULL || strcmp(arg, "text") == 0) {
+            ciwic_print_translation_unit(&daemon->out, &file->translation_unit, 0);
+        } else if (strcmp(arg, "json") == 0) {
+            ciwic_export_translation_unit(&daemon->out, ciwic_export_json, &file->translation_unit);
+        } else if (strcmp(arg, "sexpr") == 0) {
+            ciwic_export_translation_unit(&daemon->out, ciwic_export_sexpr, &file->translation_unit);
+        } else if (strcmp(arg, "c") == 0) {
+            ciwic_emit_c(&daemon->out, &file->translation_unit);
+        } else {
+            ciwic_daemon_error(daemon, "unknown format ", arg);
+        }
+    } else if (strcmp(command, "stats") == 0) {
+        ciwic_sink_str(&daemon->out, "files ");
+        ciwic_sink_int(&daemon->out, daemon->ws.files_len);
+        ciwic_sink_str(&daemon->out, "\ngeneration ");
+        ciwic_sink_int(&daemon->out, daemon->ws.generation);
+        ciwic_sink_char(&daemon->out, '\n');
+    } else {
+        ciwic_daemon_error(daemon, "unknown command ", command);
+    }
+}
+
+void ciwic_daemon_drop_client(ciwic_daemon *daemon, int i) {
+    close(daemon->clients[i].fd);
+    free(daemon->clients[i].buf);
+    free(daemon->clients[i].out);
+    daemon->clients[i] = daemon->clients[--daemon->clients_len];
+}
+
+// Appends the response in daemon->out to the output of client as a frame
+void ciwic_daemon_queue(ciwic_daemon *daemon, ciwic_daemon_client *client) {
+    int len = daemon->out.len;
+
+    if (client->out_cap < client->out_len + 4 + len) {
+        client->out_cap = (client->out_len + 4 + len) * 2;
+        client->out = realloc(client->out, client->out_cap);
+    }
+
+    unsigned char *header = (unsigned char *) &client->out[client->out_len];
+    header[0] = len >> 24;
+    header[1] = len >> 16;
+    header[2] = len >> 8;
+    header[3] = len;
+    memcpy(&client->out[client->out_len + 4], daemon->out.buf, len);
+    client->out_len += 4 + len;
+}
+
+// Sends as much of the output of client as its socket takes without
+// blocking. Returns 1 if the client is gone.
+int ciwic_daemon_flush_client(ciwic_daemon_client *client) {
+    while (client->out_pos < client->out_len) {
+        // MSG_NOSIGNAL so a client that hung up does not raise SIGPIPE
+        ssize_t n = send(client->fd, &client->out[client->out_pos], client->out_len - client->out_pos, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return 0;
+        }
+        if (n <= 0) {
+            return 1;
+        }
+        client->out_pos += n;
+    }
+
+    client->out_pos = 0;
+    client->out_len = 0;
+    return 0;
+}
+
+// Reads from client i and answers every complete request. Returns 1 if the
+// client is gone.
+int ciwic_daemon_serve_client(ciwic_daemon *daemon, int i) {
+    ciwic_daemon_client *client = &daemon->clients[i];
+
+    if (client->len == client->cap) {
+        client->cap = client->cap ? client->cap * 2 : 4096;
+        client->buf = realloc(client->buf, client->cap);
+    }
+
+    ssize_t n = read(client->fd, &client->buf[client->len], client->cap - client->len);
+    if (n < 0 && (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK)) {
+        return 0;
+    }
+    if (n <= 0) {
+        return 1;
+    }
+    client->len += n;
+
+    int pos = 0;
+
+    while (client->len - pos >= 4) {
+        int len = ciwic_daemon_frame_len(&client->buf[pos]);
+        if (len < 0 || len > CIWIC_DAEMON_MAX_REQUEST) {
+            return 1;
+        }
+        if (client->len - pos - 4 < len) {
+            // Make sure the whole frame fits
+            if (client->cap < len + 5) {
+                client->cap = len + 5;
+                client->buf = realloc(client->buf, client->cap);
+            }
+            break;
+        }
+
+        char *request = &client->buf[pos + 4];
+        char last = request[len];
+        request[len] = 0;
+        ciwic_daemon_handle(daemon, request);
+        request[len] = last;
+        ciwic_daemon_queue(daemon, client);
+
+        pos += 4 + len;
+    }
+
+    memmove(client->buf, &client->buf[pos], client->len - pos);
+    client->len -= pos;
+    return ciwic_daemon_flush_client(client);
+}
+
+int ciwic_daemon_run(const char *socket_path) {
+    ciwic_daemon daemon;
+    struct sockaddr_un addr = { .sun_family = AF_UNIX };
+
+    if (strlen(socket_path) >= sizeof(addr.sun_path)) {
+        return 1;
+    }
+    strcpy(addr.sun_path, socket_path);
+
+    daemon.listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (daemon.listen_fd < 0) {
+        return 1;
+    }
+
+    unlink(socket_path);
+
+    if (bind(daemon.listen_fd, (struct sockaddr *) &addr, sizeof(addr)) || listen(daemon.listen_fd, 64)
+            || ciwic_workspace_init(&daemon.ws)) {
+        close(daemon.listen_fd);
+        return 1;
+    }
+
+    daemon.ws.limits.max_steps = CIWIC_DAEMON_MAX_STEPS;
+    ciwic_sink_init_memory(&daemon.out);
+    daemon.clients = NULL;
+    daemon.clients_len = 0;
+    daemon.clients_cap = 0;
+
+    struct pollfd *fds = NULL;
+    int fds_cap = 0;
+
+    for (;;) {
+        if (fds_cap < daemon.clients_len + 1) {
+            fds_cap = (daemon.clients_len + 1) * 2;
+            fds = realloc(fds, sizeof(struct pollfd) * fds_cap);
+        }
+
+        fds[0].fd = daemon.listen_fd;
+        fds[0].events = POLLIN;
+        for (int i = 0; i < daemon.clients_len; i++) {
+            fds[i+1].fd = daemon.clients[i].fd;
+            fds[i+1].events = daemon.clients[i].out_len > 0 ? POLLOUT : POLLIN;
+        }
+
+        int nfds = daemon.clients_len + 1;
+
+        if (poll(fds, nfds, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+
+        // Walk backwards so dropping a client does not skip another
+        for (int i = nfds - 2; i >= 0; i--) {
+            if (fds[i+1].revents == 0) {
+                continue;
+            }
+
+            int gone = daemon.clients[i].out_len > 0
+                ? ciwic_daemon_flush_client(&daemon.clients[i])
+                : ciwic_daemon_serve_client(&daemon, i);
+
+            if (gone) {
+                ciwic_daemon_drop_client(&daemon, i);
+            }
+        }
+
+        if (fds[0].revents & POLLIN) {
+            int fd = accept(daemon.listen_fd, NULL, NULL);
+            // Writes must not block, or one client that stops reading
+            // would stall every other
+            if (fd >= 0 && fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK)) {
+                close(fd);
+            } else if (fd >= 0) {
+                if (daemon.clients_len == daemon.clients_cap) {
+                    daemon.clients_cap = daemon.clients_cap ? daemon.clients_cap * 2 : 16;
+                    daemon.clients = realloc(daemon.clients, sizeof(ciwic_daemon_client) * daemon.clients_cap);
+                }
+                ciwic_daemon_client *client = &daemon.clients[daemon.clients_len++];
+                client->fd = fd;
+                client->buf = NULL;
+                client->len = 0;
+                client->cap = 0;
+                client->out = NULL;
+                client->out_pos = 0;
+                client->out_len = 0;
+                client->out_cap = 0;
+            }
+        }
+    }
+
+    while (daemon.clients_len > 0) {
+        ciwic_daemon_drop_client(&daemon, daemon.clients_len - 1);
+    }
+
+    free(fds);
+    free(daemon.clients);
+    ciwic_sink_close(&daemon.out);
+    ciwic_workspace_close(&daemon.ws);
+    close(daemon.listen_fd);
+    unlink(socket_path);
+    return 1;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+// Parse daemon
+//
+// Serves queries over a Unix domain socket and keeps every file it has
+// parsed in a ciwic_workspace, so a file is only parsed again after it
+// changes, and then only in the definitions that changed.
+//
+// Every message is a 4 byte big-endian length followed by that many bytes.
+// A request is a command and its arguments separated by spaces:
+//
+//   parse PATH            number of definitions in the file
+//   functions PATH        one "name line" per function definition
+//   dump PATH [FORMAT]    the AST as text (the default), json, sexpr or c
+//   stats                 number of files held and the workspace generation
+//
+// The response is "ok\n" followed by the result, or "error\n" followed by a
+// message. Relative paths are resolved against the daemon's directory.
+
+// Serves requests on socket_path until an error occurs
+int ciwic_daemon_run(const char *socket_path);
+
+// Sends one request to the daemon at socket_path and waits for the response,
+// which is returned in a malloced buffer. Returns 0 on success.
+int ciwic_daemon_request(const char *socket_path, const char *request, char **response, int *len);
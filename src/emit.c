@@ -0,0 +1,747 @@
+#include <string.h>
+
+#include <emit.h>
+
+// Operator precedence, higher binds tighter
+typedef enum {
+    ciwic_prec_comma = 1,
+    ciwic_prec_assignment,
+    ciwic_prec_conditional,
+    ciwic_prec_lor,
+    ciwic_prec_land,
+    ciwic_prec_or,
+    ciwic_prec_xor,
+    ciwic_prec_and,
+    ciwic_prec_eq,
+    ciwic_prec_rel,
+    ciwic_prec_shift,
+    ciwic_prec_add,
+    ciwic_prec_mul,
+    // Below unary, as the operand of sizeof, ++ and -- cannot be a cast
+    // without parentheses, while that of & * + - ~ ! can
+    ciwic_prec_cast,
+    ciwic_prec_unary,
+    ciwic_prec_postfix,
+    ciwic_prec_primary,
+} ciwic_prec;
+
+const char *ciwic_emit_unary_ops[] = { "--", "++", "--", "++", "&", "*", "+",
+    "-", "~", "!" };
+
+const char *ciwic_emit_binary_ops[] = { "*", "/", "%", "+", "-", ">>", "<<",
+    "<", ">", "<=", ">=", "==", "!=", "&", "^", "|", "&&", "||", "," };
+
+const ciwic_prec ciwic_emit_binary_prec[] = { ciwic_prec_mul, ciwic_prec_mul,
+    ciwic_prec_mul, ciwic_prec_add, ciwic_prec_add, ciwic_prec_shift,
+    ciwic_prec_shift, ciwic_prec_rel, ciwic_prec_rel, ciwic_prec_rel,
+    ciwic_prec_rel, ciwic_prec_eq, ciwic_prec_eq, ciwic_prec_and,
+    ciwic_prec_xor, ciwic_prec_or, ciwic_prec_land, ciwic_prec_lor,
+    ciwic_prec_comma };
+
+// Type specifier keywords in the order they are conventionally written
+const char *ciwic_emit_prim_keywords[] = { "signed", "unsigned", "short",
+    "long", "long", "void", "char", "int", "float", "double", "_Bool",
+    "_Complex" };
+
+const int ciwic_emit_prim_bits[] = { ciwic_type_signed, ciwic_type_unsigned,
+    ciwic_type_short, ciwic_type_long, ciwic_type_long_long, ciwic_type_void,
+    ciwic_type_char, ciwic_type_int, ciwic_type_float, ciwic_type_double,
+    ciwic_type_bool, ciwic_type_complex };
+
+int ciwic_emit_is_postfix_op(ciwic_expr_unary_op op) {
+    return op == ciwic_expr_op_post_dec || op == ciwic_expr_op_post_inc;
+}
+
+ciwic_prec ciwic_emit_expr_prec(ciwic_expr *expr) {
+    switch (expr->type) {
+        case ciwic_expr_type_identifier:
+        case ciwic_expr_type_constant:
+            return ciwic_prec_primary;
+        case ciwic_expr_type_call:
+        case ciwic_expr_type_initialize:
+        case ciwic_expr_type_subscript:
+        case ciwic_expr_type_member:
+        case ciwic_expr_type_member_deref:
+            return ciwic_prec_postfix;
+        case ciwic_expr_type_unary_op:
+            return ciwic_emit_is_postfix_op(expr->unary_op.op) ? ciwic_prec_postfix : ciwic_prec_unary;
+        case ciwic_expr_type_sizeof_expr:
+        case ciwic_expr_type_sizeof_type:
+            return ciwic_prec_unary;
+        case ciwic_expr_type_cast:
+            return ciwic_prec_cast;
+        case ciwic_expr_type_binary_op:
+            return ciwic_emit_binary_prec[expr->binary_op.op];
+        case ciwic_expr_type_conditional:
+            return ciwic_prec_conditional;
+        case ciwic_expr_type_assignment:
+            return ciwic_prec_assignment;
+    }
+
+    return ciwic_prec_primary;
+}
+
+void ciwic_emit_string(ciwic_sink *sink, string *str) {
+    ciwic_sink_write(sink, str->text, str->len);
+}
+
+void ciwic_emit_qualifiers(ciwic_sink *sink, int qualifiers, int *first) {
+    const char *names[] = { "const", "restrict", "volatile" };
+    const int bits[] = { ciwic_type_qualifier_const,
+        ciwic_type_qualifier_restrict, ciwic_type_qualifier_volatile };
+
+    for (int i = 0; i < 3; i++) {
+        if (qualifiers & bits[i]) {
+            if (!*first) {
+                ciwic_sink_char(sink, ' ');
+            }
+            ciwic_sink_str(sink, names[i]);
+            *first = 0;
+        }
+    }
+}
+
+void ciwic_emit_prec_expr(ciwic_sink *sink, ciwic_expr *expr, ciwic_prec min);
+void ciwic_emit_declarator(ciwic_sink *sink, ciwic_declarator *decl);
+void ciwic_emit_specifiers(ciwic_sink *sink, ciwic_declaration_specifiers *specs);
+void ciwic_emit_initializer(ciwic_sink *sink, ciwic_initializer *init);
+
+void ciwic_emit_initializer_list(ciwic_sink *sink, ciwic_initializer_list *list) {
+    ciwic_sink_str(sink, "{ ");
+
+    for (ciwic_initializer_list *item = list; item != NULL; item = item->rest) {
+        if (item != list) {
+            ciwic_sink_str(sink, ", ");
+        }
+
+        for (ciwic_designator_list *desig = item->designation; desig != NULL; desig = desig->rest) {
+            if (desig->type == ciwic_designator_expr) {
+                ciwic_sink_char(sink, '[');
+                ciwic_emit_prec_expr(sink, &desig->expr, ciwic_prec_conditional);
+                ciwic_sink_char(sink, ']');
+            } else {
+                ciwic_sink_char(sink, '.');
+                ciwic_emit_string(sink, &desig->ident);
+            }
+        }
+
+        if (item->designation != NULL) {
+            ciwic_sink_str(sink, " = ");
+        }
+
+        ciwic_emit_initializer(sink, item->initializer);
+    }
+
+    ciwic_sink_str(sink, " }");
+}
+
+void ciwic_emit_initializer(ciwic_sink *sink, ciwic_initializer *init) {
+    switch (init->type) {
+        case ciwic_initializer_init_expr:
+            ciwic_emit_prec_expr(sink, &init->expr, ciwic_prec_assignment);
+            break;
+        case ciwic_initializer_init_list:
+            ciwic_emit_initializer_list(sink, &init->list);
+            break;
+    }
+}
+
+// Writes an expression that is not a chain link, in parentheses if it binds
+// less tightly than min
+void ciwic_emit_expr_leaf(ciwic_sink *sink, ciwic_expr *expr, ciwic_prec min) {
+    ciwic_prec prec = ciwic_emit_expr_prec(expr);
+    const char *op;
+
+    if (prec < min) {
+        ciwic_sink_char(sink, '(');
+    }
+
+    switch (expr->type) {
+        case ciwic_expr_type_identifier:
+            ciwic_emit_string(sink, &expr->identifier);
+            break;
+        case ciwic_expr_type_constant:
+            ciwic_sink_str(sink, expr->constant.raw_text);
+            break;
+        case ciwic_expr_type_unary_op:
+            op = ciwic_emit_unary_ops[expr->unary_op.op];
+            ciwic_sink_str(sink, op);
+
+            // Keep - -x and & &x from being read as -- and &&
+            ciwic_expr *inner = expr->unary_op.inner;
+            if (inner->type == ciwic_expr_type_unary_op && !ciwic_emit_is_postfix_op(inner->unary_op.op)
+                    && strchr("+-&", op[0]) && ciwic_emit_unary_ops[inner->unary_op.op][0] == op[0]) {
+                ciwic_sink_char(sink, ' ');
+            }
+
+            if (expr->unary_op.op == ciwic_expr_op_pre_dec || expr->unary_op.op == ciwic_expr_op_pre_inc) {
+                ciwic_emit_prec_expr(sink, inner, ciwic_prec_unary);
+            } else {
+                ciwic_emit_prec_expr(sink, inner, ciwic_prec_cast);
+            }
+            break;
+        case ciwic_expr_type_initialize:
+            ciwic_sink_char(sink, '(');
+            ciwic_emit_type_name(sink, &expr->initialize.type_name);
+            ciwic_sink_char(sink, ')');
+            ciwic_emit_initializer_list(sink, &expr->initialize.initializer_list);
+            break;
+        case ciwic_expr_type_sizeof_expr:
+            ciwic_sink_str(sink, "sizeof ");
+            ciwic_emit_prec_expr(sink, expr->sizeof_expr, ciwic_prec_unary);
+            break;
+        case ciwic_expr_type_sizeof_type:
+            ciwic_sink_str(sink, "sizeof(");
+            ciwic_emit_type_name(sink, &expr->sizeof_type);
+            ciwic_sink_char(sink, ')');
+            break;
+        case ciwic_expr_type_cast:
+            ciwic_sink_char(sink, '(');
+            ciwic_emit_type_name(sink, &expr->cast.type_name);
+            ciwic_sink_char(sink, ')');
+            ciwic_emit_prec_expr(sink, expr->cast.expr, ciwic_prec_cast);
+            break;
+        case ciwic_expr_type_conditional:
+            ciwic_emit_prec_expr(sink, expr->conditional.cond, ciwic_prec_lor);
+            ciwic_sink_str(sink, " ? ");
+            ciwic_emit_prec_expr(sink, expr->conditional.left, ciwic_prec_comma);
+            ciwic_sink_str(sink, " : ");
+            ciwic_emit_prec_expr(sink, expr->conditional.right, ciwic_prec_conditional);
+            break;
+        case ciwic_expr_type_assignment:
+            ciwic_emit_prec_expr(sink, expr->assignment.left, ciwic_prec_unary);
+            ciwic_sink_char(sink, ' ');
+            // Plain assignment is stored with the comma operator
+            if (expr->assignment.op != ciwic_expr_op_comma) {
+                ciwic_sink_str(sink, ciwic_emit_binary_ops[expr->assignment.op]);
+            }
+            ciwic_sink_str(sink, "= ");
+            ciwic_emit_prec_expr(sink, expr->assignment.right, ciwic_prec_assignment);
+            break;
+        default:
+            break;
+    }
+
+    if (prec < min) {
+        ciwic_sink_char(sink, ')');
+    }
+}
+
+// Returns how tightly the chain operand of a chain link has to bind
+ciwic_prec ciwic_emit_operand_min(ciwic_expr *expr) {
+    if (expr->type != ciwic_expr_type_binary_op) {
+        return ciwic_prec_postfix;
+    }
+    return ciwic_emit_expr_prec(expr) + (expr->binary_op.op == ciwic_expr_op_comma);
+}
+
+// Writes the part of a chain link that comes before its chain operand
+void ciwic_emit_expr_head(ciwic_sink *sink, ciwic_expr *expr) {
+    if (expr->type == ciwic_expr_type_binary_op && expr->binary_op.op == ciwic_expr_op_comma) {
+        ciwic_emit_prec_expr(sink, expr->binary_op.fst, ciwic_prec_comma);
+        ciwic_sink_str(sink, ", ");
+    }
+}
+
+// Writes the part of a chain link that comes after its chain operand
+void ciwic_emit_expr_tail(ciwic_sink *sink, ciwic_expr *expr) {
+    switch (expr->type) {
+        case ciwic_expr_type_unary_op:
+            ciwic_sink_str(sink, ciwic_emit_unary_ops[expr->unary_op.op]);
+            break;
+        case ciwic_expr_type_binary_op:
+            if (expr->binary_op.op != ciwic_expr_op_comma) {
+                ciwic_sink_char(sink, ' ');
+                ciwic_sink_str(sink, ciwic_emit_binary_ops[expr->binary_op.op]);
+                ciwic_sink_char(sink, ' ');
+                ciwic_emit_prec_expr(sink, expr->binary_op.snd, ciwic_emit_expr_prec(expr) + 1);
+            }
+            break;
+        case ciwic_expr_type_call:
+            ciwic_sink_char(sink, '(');
+            for (ciwic_expr_arg_list *arg = expr->call.args; arg != NULL; arg = arg->rest) {
+                if (arg != expr->call.args) {
+                    ciwic_sink_str(sink, ", ");
+                }
+                ciwic_emit_prec_expr(sink, &arg->head, ciwic_prec_assignment);
+            }
+            ciwic_sink_char(sink, ')');
+            break;
+        case ciwic_expr_type_subscript:
+            ciwic_sink_char(sink, '[');
+            ciwic_emit_prec_expr(sink, expr->subscript.pos, ciwic_prec_comma);
+            ciwic_sink_char(sink, ']');
+            break;
+        case ciwic_expr_type_member:
+        case ciwic_expr_type_member_deref:
+            ciwic_sink_str(sink, expr->type == ciwic_expr_type_member ? "." : "->");
+            ciwic_emit_string(sink, &expr->member.identifier);
+            break;
+        default:
+            break;
+    }
+}
+
+// Writes expr, in parentheses if it binds less tightly than min
+void ciwic_emit_prec_expr(ciwic_sink *sink, ciwic_expr *expr, ciwic_prec min) {
+    ciwic_expr_chain chain;
+    ciwic_expr_chain_init(&chain, expr);
+
+    for (int i = 0; i < chain.len; i++) {
+        ciwic_prec link_min = i == 0 ? min : ciwic_emit_operand_min(chain.links[i - 1]);
+        if (ciwic_emit_expr_prec(chain.links[i]) < link_min) {
+            ciwic_sink_char(sink, '(');
+        }
+        ciwic_emit_expr_head(sink, chain.links[i]);
+    }
+
+    ciwic_emit_expr_leaf(sink, chain.leaf, chain.len == 0 ? min : ciwic_emit_operand_min(chain.links[chain.len - 1]));
+
+    for (int i = chain.len - 1; i >= 0; i--) {
+        ciwic_prec link_min = i == 0 ? min : ciwic_emit_operand_min(chain.links[i - 1]);
+        ciwic_emit_expr_tail(sink, chain.links[i]);
+        if (ciwic_emit_expr_prec(chain.links[i]) < link_min) {
+            ciwic_sink_char(sink, ')');
+        }
+    }
+
+    ciwic_expr_chain_free(&chain);
+}
+
+void ciwic_emit_expr(ciwic_sink *sink, ciwic_expr *expr) {
+    ciwic_emit_prec_expr(sink, expr, ciwic_prec_comma);
+}
+
+void ciwic_emit_params(ciwic_sink *sink, ciwic_declarator *decl) {
+    ciwic_sink_char(sink, '(');
+
+    for (ciwic_param_list *param = decl->func.param_list; param != NULL; param = param->rest) {
+        if (param != decl->func.param_list) {
+            ciwic_sink_str(sink, ", ");
+        }
+        ciwic_emit_specifiers(sink, &param->specifiers);
+        if (param->declarator != NULL) {
+            ciwic_sink_char(sink, ' ');
+            ciwic_emit_declarator(sink, param->declarator);
+        }
+    }
+
+    if (decl->func.has_ellipsis) {
+        ciwic_sink_str(sink, decl->func.param_list != NULL ? ", ..." : "...");
+    }
+
+    ciwic_sink_char(sink, ')');
+}
+
+// Writes the declarator an array or function suffix applies to. A pointer
+// has to be grouped, since the suffix would bind to it first otherwise.
+void ciwic_emit_suffix_inner(ciwic_sink *sink, ciwic_declarator *inner) {
+    if (inner == NULL) {
+        return;
+    }
+
+    if (inner->type == ciwic_declarator_pointer) {
+        ciwic_sink_char(sink, '(');
+        ciwic_emit_declarator(sink, inner);
+        ciwic_sink_char(sink, ')');
+    } else {
+        ciwic_emit_declarator(sink, inner);
+    }
+}
+
+void ciwic_emit_declarator(ciwic_sink *sink, ciwic_declarator *decl) {
+    int first = 1;
+
+    switch (decl->type) {
+        case ciwic_declarator_pointer:
+            ciwic_sink_char(sink, '*');
+            ciwic_emit_qualifiers(sink, decl->pointer_qualifiers, &first);
+            if (decl->inner != NULL) {
+                if (!first) {
+                    ciwic_sink_char(sink, ' ');
+                }
+                ciwic_emit_declarator(sink, decl->inner);
+            }
+            break;
+        case ciwic_declarator_identifier:
+            ciwic_emit_string(sink, &decl->ident);
+            break;
+        case ciwic_declarator_array:
+            ciwic_emit_suffix_inner(sink, decl->inner);
+            ciwic_sink_char(sink, '[');
+            if (decl->array.is_static) {
+                ciwic_sink_str(sink, "static");
+                first = 0;
+            }
+            ciwic_emit_qualifiers(sink, decl->array.type_qualifiers, &first);
+            if (decl->array.is_var_len) {
+                ciwic_sink_str(sink, first ? "*" : " *");
+            } else if (decl->array.expr != NULL) {
+                if (!first) {
+                    ciwic_sink_char(sink, ' ');
+                }
+                ciwic_emit_prec_expr(sink, decl->array.expr, ciwic_prec_assignment);
+            }
+            ciwic_sink_char(sink, ']');
+            break;
+        case ciwic_declarator_func:
+            ciwic_emit_suffix_inner(sink, decl->inner);
+            ciwic_emit_params(sink, decl);
+            break;
+        case ciwic_declarator_func_old:
+            ciwic_emit_suffix_inner(sink, decl->inner);
+            ciwic_sink_str(sink, "()");
+            break;
+    }
+}
+
+void ciwic_emit_specifiers(ciwic_sink *sink, ciwic_declaration_specifiers *specs) {
+    const char *storage_names[] = { "typedef", "extern", "static", "auto", "register" };
+    const int storage_bits[] = { ciwic_specifier_typedef, ciwic_specifier_extern,
+        ciwic_specifier_static, ciwic_specifier_auto, ciwic_specifier_register };
+
+    int first = 1;
+
+    for (int i = 0; i < 5; i++) {
+        if (specs->storage_class & storage_bits[i]) {
+            ciwic_sink_str(sink, storage_names[i]);
+            ciwic_sink_char(sink, ' ');
+        }
+    }
+
+    if (specs->func_specifiers & ciwic_function_specifier_inline) {
+        ciwic_sink_str(sink, "inline ");
+    }
+
+    ciwic_emit_qualifiers(sink, specs->type_qualifiers, &first);
+    if (!first) {
+        ciwic_sink_char(sink, ' ');
+    }
+
+    first = 1;
+
+    switch (specs->type_spec) {
+        case ciwic_type_spec_none:
+            break;
+        case ciwic_type_spec_prim:
+            for (int i = 0; i < 12; i++) {
+                if (specs->prim_type & ciwic_emit_prim_bits[i]) {
+                    if (!first) {
+                        ciwic_sink_char(sink, ' ');
+                    }
+                    ciwic_sink_str(sink, ciwic_emit_prim_keywords[i]);
+                    first = 0;
+                }
+            }
+            break;
+        case ciwic_type_spec_enum:
+            ciwic_sink_str(sink, "enum");
+            if (specs->enum_.identifier != NULL) {
+                ciwic_sink_char(sink, ' ');
+                ciwic_emit_string(sink, specs->enum_.identifier);
+            }
+            if (specs->enum_.decl != NULL) {
+                ciwic_sink_str(sink, " { ");
+                for (ciwic_enum_list *list = specs->enum_.decl; list != NULL; list = list->rest) {
+                    if (list != specs->enum_.decl) {
+                        ciwic_sink_str(sink, ", ");
+                    }
+                    ciwic_emit_string(sink, &list->name);
+                    if (list->expr != NULL) {
+                        ciwic_sink_str(sink, " = ");
+                        ciwic_emit_prec_expr(sink, list->expr, ciwic_prec_conditional);
+                    }
+                }
+                ciwic_sink_str(sink, " }");
+            }
+            break;
+        case ciwic_type_spec_struct:
+        case ciwic_type_spec_union:
+            ciwic_sink_str(sink, specs->type_spec == ciwic_type_spec_struct ? "struct" : "union");
+            if (specs->struct_or_union.identifier != NULL) {
+                ciwic_sink_char(sink, ' ');
+                ciwic_emit_string(sink, specs->struct_or_union.identifier);
+            }
+            if (specs->struct_or_union.decl != NULL) {
+                ciwic_sink_str(sink, " { ");
+                for (ciwic_struct_list *list = specs->struct_or_union.decl; list != NULL; list = list->rest) {
+                    ciwic_emit_specifiers(sink, &list->specifiers);
+                    for (ciwic_struct_declarator_list *decl = &list->declarator_list; decl != NULL; decl = decl->rest) {
+                        ciwic_sink_str(sink, decl == &list->declarator_list ? " " : ", ");
+                        if (decl->declarator != NULL) {
+                            ciwic_emit_declarator(sink, decl->declarator);
+                        }
+                        if (decl->expr != NULL) {
+                            ciwic_sink_str(sink, decl->declarator != NULL ? " : " : ": ");
+                            ciwic_emit_prec_expr(sink, decl->expr, ciwic_prec_conditional);
+                        }
+                    }
+                    ciwic_sink_str(sink, "; ");
+                }
+                ciwic_sink_char(sink, '}');
+            }
+            break;
+        case ciwic_type_spec_typedef_name:
+            ciwic_emit_string(sink, &specs->typedef_name);
+            break;
+    }
+}
+
+void ciwic_emit_type_name(ciwic_sink *sink, ciwic_type_name *name) {
+    ciwic_emit_specifiers(sink, &name->specifiers);
+    if (name->declarator != NULL) {
+        ciwic_sink_char(sink, ' ');
+        ciwic_emit_declarator(sink, name->declarator);
+    }
+}
+
+void ciwic_emit_declaration(ciwic_sink *sink, ciwic_declaration *decl) {
+    ciwic_emit_specifiers(sink, &decl->specifiers);
+
+    for (ciwic_init_declarator_list *list = &decl->list; list != NULL; list = list->rest) {
+        ciwic_sink_str(sink, list == &decl->list ? " " : ", ");
+        ciwic_emit_declarator(sink, &list->declarator);
+        if (list->initializer != NULL) {
+            ciwic_sink_str(sink, " = ");
+            ciwic_emit_initializer(sink, list->initializer);
+        }
+    }
+
+    ciwic_sink_char(sink, ';');
+}
+
+// Returns 1 if stmt ends in an if without an else, which would take an
+// else that follows it
+int ciwic_emit_is_open_if(ciwic_statement *stmt) {
+    switch (stmt->type) {
+        case ciwic_statement_if:
+            if (stmt->if_stmt.if_else == NULL) {
+                return 1;
+            }
+            return ciwic_emit_is_open_if(stmt->if_stmt.if_else);
+        case ciwic_statement_label:
+        case ciwic_statement_case:
+        case ciwic_statement_default:
+            return ciwic_emit_is_open_if(stmt->labeled.stmt);
+        case ciwic_statement_switch:
+        case ciwic_statement_while:
+            return ciwic_emit_is_open_if(stmt->while_stmt.stmt);
+        case ciwic_statement_for:
+            return ciwic_emit_is_open_if(stmt->for_stmt.stmt);
+        default:
+            return 0;
+    }
+}
+
+void ciwic_emit_line(ciwic_sink *sink, int indent) {
+    ciwic_sink_char(sink, '\n');
+    ciwic_sink_indent(sink, indent);
+}
+
+void ciwic_emit_block(ciwic_sink *sink, ciwic_statement *stmt, int indent) {
+    ciwic_sink_char(sink, '{');
+
+    for (ciwic_statement *block = stmt; block != NULL; block = block->block.rest) {
+        ciwic_emit_line(sink, indent + 4);
+        ciwic_emit_statement(sink, block->block.head, indent + 4);
+    }
+
+    ciwic_emit_line(sink, indent);
+    ciwic_sink_char(sink, '}');
+}
+
+// Writes the body of a compound statement, either after a space if it is a
+// block or indented on the next line. Returns 1 if it was a block.
+int ciwic_emit_body(ciwic_sink *sink, ciwic_statement *stmt, int indent) {
+    if (stmt->type == ciwic_statement_block) {
+        ciwic_sink_char(sink, ' ');
+        ciwic_emit_block(sink, stmt, indent);
+        return 1;
+    }
+
+    ciwic_emit_line(sink, indent + 4);
+    ciwic_emit_statement(sink, stmt, indent + 4);
+    return 0;
+}
+
+// Writes stmt from the current position in the line. Lines after the first
+// are indented by indent.
+void ciwic_emit_statement(ciwic_sink *sink, ciwic_statement *stmt, int indent) {
+    int is_block;
+
+    switch (stmt->type) {
+        case ciwic_statement_label:
+            ciwic_emit_string(sink, &stmt->labeled.label_ident);
+            ciwic_sink_char(sink, ':');
+            ciwic_emit_line(sink, indent);
+            ciwic_emit_statement(sink, stmt->labeled.stmt, indent);
+            break;
+        case ciwic_statement_case:
+            ciwic_sink_str(sink, "case ");
+            ciwic_emit_prec_expr(sink, &stmt->labeled.case_expr, ciwic_prec_conditional);
+            ciwic_sink_char(sink, ':');
+            ciwic_emit_line(sink, indent);
+            ciwic_emit_statement(sink, stmt->labeled.stmt, indent);
+            break;
+        case ciwic_statement_default:
+            ciwic_sink_str(sink, "default:");
+            ciwic_emit_line(sink, indent);
+            ciwic_emit_statement(sink, stmt->labeled.stmt, indent);
+            break;
+        case ciwic_statement_block:
+            ciwic_emit_block(sink, stmt, indent);
+            break;
+        case ciwic_statement_expr:
+            ciwic_emit_expr(sink, &stmt->expr);
+            ciwic_sink_char(sink, ';');
+            break;
+        case ciwic_statement_if:
+            ciwic_sink_str(sink, "if (");
+            ciwic_emit_expr(sink, &stmt->if_stmt.expr);
+            ciwic_sink_char(sink, ')');
+
+            if (stmt->if_stmt.if_else == NULL) {
+                ciwic_emit_body(sink, stmt->if_stmt.if_then, indent);
+                break;
+            }
+
+            // An open if in the then branch would take our else
+            if (ciwic_emit_is_open_if(stmt->if_stmt.if_then)) {
+                ciwic_sink_str(sink, " {");
+                ciwic_emit_line(sink, indent + 4);
+                ciwic_emit_statement(sink, stmt->if_stmt.if_then, indent + 4);
+                ciwic_emit_line(sink, indent);
+                ciwic_sink_char(sink, '}');
+                is_block = 1;
+            } else {
+                is_block = ciwic_emit_body(sink, stmt->if_stmt.if_then, indent);
+            }
+
+            if (is_block) {
+                ciwic_sink_str(sink, " else");
+            } else {
+                ciwic_emit_line(sink, indent);
+                ciwic_sink_str(sink, "else");
+            }
+
+            if (stmt->if_stmt.if_else->type == ciwic_statement_if) {
+                ciwic_sink_char(sink, ' ');
+                ciwic_emit_statement(sink, stmt->if_stmt.if_else, indent);
+            } else {
+                ciwic_emit_body(sink, stmt->if_stmt.if_else, indent);
+            }
+            break;
+        case ciwic_statement_switch:
+        case ciwic_statement_while:
+            ciwic_sink_str(sink, stmt->type == ciwic_statement_switch ? "switch (" : "while (");
+            ciwic_emit_expr(sink, &stmt->while_stmt.expr);
+            ciwic_sink_char(sink, ')');
+            ciwic_emit_body(sink, stmt->while_stmt.stmt, indent);
+            break;
+        case ciwic_statement_do_while:
+            ciwic_sink_str(sink, "do");
+            if (ciwic_emit_body(sink, stmt->while_stmt.stmt, indent)) {
+                ciwic_sink_char(sink, ' ');
+            } else {
+                ciwic_emit_line(sink, indent);
+            }
+            ciwic_sink_str(sink, "while (");
+            ciwic_emit_expr(sink, &stmt->while_stmt.expr);
+            ciwic_sink_str(sink, ");");
+            break;
+        case ciwic_statement_for:
+            ciwic_sink_str(sink, "for (");
+            if (stmt->for_stmt.pre_decl != NULL) {
+                ciwic_emit_declaration(sink, stmt->for_stmt.pre_decl);
+            } else {
+                if (stmt->for_stmt.pre_expr != NULL) {
+                    ciwic_emit_expr(sink, stmt->for_stmt.pre_expr);
+                }
+                ciwic_sink_char(sink, ';');
+            }
+            if (stmt->for_stmt.test_expr != NULL) {
+                ciwic_sink_char(sink, ' ');
+                ciwic_emit_expr(sink, stmt->for_stmt.test_expr);
+            }
+            ciwic_sink_char(sink, ';');
+            if (stmt->for_stmt.post_expr != NULL) {
+                ciwic_sink_char(sink, ' ');
+                ciwic_emit_expr(sink, stmt->for_stmt.post_expr);
+            }
+            ciwic_sink_char(sink, ')');
+            ciwic_emit_body(sink, stmt->for_stmt.stmt, indent);
+            break;
+        case ciwic_statement_goto:
+            ciwic_sink_str(sink, "goto ");
+            ciwic_emit_string(sink, &stmt->goto_ident);
+            ciwic_sink_char(sink, ';');
+            break;
+        case ciwic_statement_continue:
+            ciwic_sink_str(sink, "continue;");
+            break;
+        case ciwic_statement_break:
+            ciwic_sink_str(sink, "break;");
+            break;
+        case ciwic_statement_return:
+            ciwic_sink_str(sink, "return");
+            if (stmt->return_expr != NULL) {
+                ciwic_sink_char(sink, ' ');
+                ciwic_emit_expr(sink, stmt->return_expr);
+            }
+            ciwic_sink_char(sink, ';');
+            break;
+        case ciwic_statement_null:
+            ciwic_sink_char(sink, ';');
+            break;
+    }
+}
+
+void ciwic_emit_func_definition(ciwic_sink *sink, ciwic_func_definition *func) {
+    ciwic_emit_specifiers(sink, &func->specifiers);
+    ciwic_sink_char(sink, ' ');
+    ciwic_emit_declarator(sink, &func->declarator);
+
+    for (ciwic_declaration_list *list = func->decl_list; list != NULL; list = list->rest) {
+        ciwic_emit_line(sink, 4);
+        ciwic_emit_declaration(sink, &list->head);
+    }
+
+    ciwic_sink_char(sink, '\n');
+
+    // An empty body is parsed as a null statement
+    switch (func->statement.type) {
+        case ciwic_statement_block:
+            ciwic_emit_block(sink, &func->statement, 0);
+            break;
+        case ciwic_statement_null:
+            ciwic_sink_str(sink, "{\n}");
+            break;
+        default:
+            ciwic_sink_str(sink, "{\n    ");
+            ciwic_emit_statement(sink, &func->statement, 4);
+            ciwic_sink_str(sink, "\n}");
+            break;
+    }
+}
+
+void ciwic_emit_definition(ciwic_sink *sink, ciwic_translation_unit *def) {
+    switch (def->def_type) {
+        case ciwic_definition_func:
+            ciwic_emit_func_definition(sink, &def->func);
+            break;
+        case ciwic_definition_decl:
+            ciwic_emit_declaration(sink, &def->decl);
+            break;
+    }
+
+    ciwic_sink_char(sink, '\n');
+}
+
+void ciwic_emit_c(ciwic_sink *sink, ciwic_translation_unit *translation_unit) {
+    for (ciwic_translation_unit *def = translation_unit; def != NULL; def = def->rest) {
+        if (def != translation_unit) {
+            ciwic_sink_char(sink, '\n');
+        }
+        ciwic_emit_definition(sink, def);
+    }
+}
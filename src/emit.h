@@ -0,0 +1,16 @@
+#pragma once
+
+#include <ast.h>
+#include <sink.h>
+
+// Writes the AST back out as C source. Expressions get only the parentheses
+// that their precedence requires, and statements are laid out one per line
+// with four spaces of indentation per level.
+
+void ciwic_emit_c(ciwic_sink *sink, ciwic_translation_unit *translation_unit);
+
+void ciwic_emit_expr(ciwic_sink *sink, ciwic_expr *expr);
+void ciwic_emit_type_name(ciwic_sink *sink, ciwic_type_name *name);
+void ciwic_emit_declaration(ciwic_sink *sink, ciwic_declaration *decl);
+void ciwic_emit_statement(ciwic_sink *sink, ciwic_statement *stmt, int indent);
+void ciwic_emit_definition(ciwic_sink *sink, ciwic_translation_unit *def);
@@ -0,0 +1,756 @@
+#include <string.h>
+
+#include <export.h>
+#include <parser.h>
+
+const char *ciwic_export_unary_ops[] = { "post_dec", "post_inc", "pre_dec",
+    "pre_inc", "ref", "deref", "pos", "neg", "bitneg", "boolneg" };
+
+const char *ciwic_export_binary_ops[] = { "mul", "div", "mod", "add", "sub",
+    "shr", "shl", "lt", "gt", "le", "ge", "eq", "ne", "and", "xor", "or",
+    "land", "lor", "comma" };
+
+const char *ciwic_export_constant_types[] = { "integer", "float", "char" };
+
+const char *ciwic_export_statement_types[] = { "label", "case", "default",
+    "block", "expr", "if", "switch", "while", "do_while", "for", "goto",
+    "continue", "break", "return", "null" };
+
+const char *ciwic_export_declarator_types[] = { "pointer", "identifier",
+    "array", "function", "function_old" };
+
+const char *ciwic_export_type_specs[] = { "none", "prim", "enum", "struct",
+    "union", "typedef_name" };
+
+void ciwic_export_open(ciwic_exporter *e, const char *kind) {
+    if (e->format == ciwic_export_json) {
+        ciwic_sink_str(e->sink, "{\"kind\":\"");
+        ciwic_sink_str(e->sink, kind);
+        ciwic_sink_char(e->sink, '"');
+    } else {
+        ciwic_sink_char(e->sink, '(');
+        ciwic_sink_str(e->sink, kind);
+    }
+}
+
+void ciwic_export_close(ciwic_exporter *e) {
+    ciwic_sink_char(e->sink, e->format == ciwic_export_json ? '}' : ')');
+}
+
+void ciwic_export_key(ciwic_exporter *e, const char *key) {
+    if (e->format == ciwic_export_json) {
+        ciwic_sink_str(e->sink, ",\"");
+        ciwic_sink_str(e->sink, key);
+        ciwic_sink_str(e->sink, "\":");
+    } else {
+        ciwic_sink_str(e->sink, " :");
+        ciwic_sink_str(e->sink, key);
+        ciwic_sink_char(e->sink, ' ');
+    }
+}
+
+void ciwic_export_list_open(ciwic_exporter *e) {
+    ciwic_sink_char(e->sink, e->format == ciwic_export_json ? '[' : '(');
+}
+
+void ciwic_export_list_close(ciwic_exporter *e) {
+    ciwic_sink_char(e->sink, e->format == ciwic_export_json ? ']' : ')');
+}
+
+// Separates the i-th list item from the one before it
+void ciwic_export_item(ciwic_exporter *e, int i) {
+    if (i > 0) {
+        ciwic_sink_char(e->sink, e->format == ciwic_export_json ? ',' : ' ');
+    }
+}
+
+void ciwic_export_symbol(ciwic_exporter *e, const char *name) {
+    if (e->format == ciwic_export_json) {
+        ciwic_sink_char(e->sink, '"');
+        ciwic_sink_str(e->sink, name);
+        ciwic_sink_char(e->sink, '"');
+    } else {
+        ciwic_sink_str(e->sink, name);
+    }
+}
+
+void ciwic_export_string(ciwic_exporter *e, const char *text, int len) {
+    const char *hex = "0123456789abcdef";
+    int start = 0;
+
+    ciwic_sink_char(e->sink, '"');
+
+    for (int i = 0; i < len; i++) {
+        unsigned char c = text[i];
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+
+        ciwic_sink_write(e->sink, &text[start], i - start);
+        start = i + 1;
+
+        if (c == '"' || c == '\\') {
+            ciwic_sink_char(e->sink, '\\');
+            ciwic_sink_char(e->sink, c);
+        } else if (c == '\n') {
+            ciwic_sink_str(e->sink, "\\n");
+        } else {
+            char escape[] = { '\\', 'u', '0', '0', hex[c >> 4], hex[c & 15] };
+            ciwic_sink_write(e->sink, escape, sizeof(escape));
+        }
+    }
+
+    ciwic_sink_write(e->sink, &text[start], len - start);
+    ciwic_sink_char(e->sink, '"');
+}
+
+void ciwic_export_int(ciwic_exporter *e, long value) {
+    ciwic_sink_int(e->sink, value);
+}
+
+void ciwic_export_null(ciwic_exporter *e) {
+    ciwic_sink_str(e->sink, e->format == ciwic_export_json ? "null" : "nil");
+}
+
+void ciwic_export_bool(ciwic_exporter *e, int value) {
+    if (e->format == ciwic_export_json) {
+        ciwic_sink_str(e->sink, value ? "true" : "false");
+    } else {
+        ciwic_sink_str(e->sink, value ? "t" : "nil");
+    }
+}
+
+void ciwic_export_span(ciwic_exporter *e, ciwic_span span) {
+    ciwic_export_key(e, "span");
+    ciwic_export_list_open(e);
+    ciwic_export_int(e, span.start + e->offset);
+    ciwic_export_item(e, 1);
+    ciwic_export_int(e, span.end + e->offset);
+    ciwic_export_list_close(e);
+}
+
+// Writes the names of the bits set in value as a list
+void ciwic_export_flags(ciwic_exporter *e, const char *key, int value, const char **names, const int *bits, int n) {
+    int count = 0;
+
+    ciwic_export_key(e, key);
+    ciwic_export_list_open(e);
+
+    for (int i = 0; i < n; i++) {
+        if (value & bits[i]) {
+            ciwic_export_item(e, count++);
+            ciwic_export_symbol(e, names[i]);
+        }
+    }
+
+    ciwic_export_list_close(e);
+}
+
+void ciwic_export_qualifiers(ciwic_exporter *e, int qualifiers) {
+    const char *names[] = { "const", "restrict", "volatile" };
+    const int bits[] = { ciwic_type_qualifier_const,
+        ciwic_type_qualifier_restrict, ciwic_type_qualifier_volatile };
+
+    ciwic_export_flags(e, "qualifiers", qualifiers, names, bits, 3);
+}
+
+void ciwic_export_expr(ciwic_exporter *e, ciwic_expr *expr);
+void ciwic_export_declarator(ciwic_exporter *e, ciwic_declarator *decl);
+void ciwic_export_declaration(ciwic_exporter *e, ciwic_declaration *decl);
+void ciwic_export_initializer(ciwic_exporter *e, ciwic_initializer *init);
+void ciwic_export_statement(ciwic_exporter *e, ciwic_statement *stmt);
+
+void ciwic_export_opt_expr(ciwic_exporter *e, ciwic_expr *expr) {
+    if (expr != NULL) {
+        ciwic_export_expr(e, expr);
+    } else {
+        ciwic_export_null(e);
+    }
+}
+
+void ciwic_export_opt_declarator(ciwic_exporter *e, ciwic_declarator *decl) {
+    if (decl != NULL) {
+        ciwic_export_declarator(e, decl);
+    } else {
+        ciwic_export_null(e);
+    }
+}
+
+void ciwic_export_specifiers(ciwic_exporter *e, ciwic_declaration_specifiers *specs) {
+    const char *storage_names[] = { "typedef", "extern", "static", "auto", "register" };
+    const int storage_bits[] = { ciwic_specifier_typedef, ciwic_specifier_extern,
+        ciwic_specifier_static, ciwic_specifier_auto, ciwic_specifier_register };
+    const char *func_names[] = { "inline" };
+    const int func_bits[] = { ciwic_function_specifier_inline };
+
+    ciwic_export_open(e, "specifiers");
+    ciwic_export_flags(e, "storage", specs->storage_class, storage_names, storage_bits, 5);
+    ciwic_export_flags(e, "function", specs->func_specifiers, func_names, func_bits, 1);
+    ciwic_export_qualifiers(e, specs->type_qualifiers);
+    ciwic_export_key(e, "type");
+    ciwic_export_symbol(e, ciwic_export_type_specs[specs->type_spec]);
+
+    int i = 0;
+
+    switch (specs->type_spec) {
+        case ciwic_type_spec_none:
+            break;
+        case ciwic_type_spec_prim:
+            ciwic_export_flags(e, "prim", specs->prim_type, ciwic_prim_types_keywords,
+                    (const int *) ciwic_prim_types_list, 12);
+            break;
+        case ciwic_type_spec_enum:
+            ciwic_export_key(e, "tag");
+            if (specs->enum_.identifier != NULL) {
+                ciwic_export_string(e, specs->enum_.identifier->text, specs->enum_.identifier->len);
+            } else {
+                ciwic_export_null(e);
+            }
+
+            ciwic_export_key(e, "values");
+            if (specs->enum_.decl == NULL) {
+                ciwic_export_null(e);
+                break;
+            }
+            ciwic_export_list_open(e);
+            for (ciwic_enum_list *list = specs->enum_.decl; list != NULL; list = list->rest) {
+                ciwic_export_item(e, i++);
+                ciwic_export_open(e, "enumerator");
+                ciwic_export_key(e, "name");
+                ciwic_export_string(e, list->name.text, list->name.len);
+                ciwic_export_key(e, "value");
+                ciwic_export_opt_expr(e, list->expr);
+                ciwic_export_close(e);
+            }
+            ciwic_export_list_close(e);
+            break;
+        case ciwic_type_spec_struct:
+        case ciwic_type_spec_union:
+            ciwic_export_key(e, "tag");
+            if (specs->struct_or_union.identifier != NULL) {
+                ciwic_export_string(e, specs->struct_or_union.identifier->text,
+                        specs->struct_or_union.identifier->len);
+            } else {
+                ciwic_export_null(e);
+            }
+
+            ciwic_export_key(e, "fields");
+            if (specs->struct_or_union.decl == NULL) {
+                ciwic_export_null(e);
+                break;
+            }
+            ciwic_export_list_open(e);
+            for (ciwic_struct_list *list = specs->struct_or_union.decl; list != NULL; list = list->rest) {
+                ciwic_export_item(e, i++);
+                ciwic_export_open(e, "field");
+                ciwic_export_key(e, "specifiers");
+                ciwic_export_specifiers(e, &list->specifiers);
+                ciwic_export_key(e, "declarators");
+                ciwic_export_list_open(e);
+
+                int j = 0;
+                for (ciwic_struct_declarator_list *decl = &list->declarator_list; decl != NULL; decl = decl->rest) {
+                    ciwic_export_item(e, j++);
+                    ciwic_export_open(e, "field_declarator");
+                    ciwic_export_key(e, "declarator");
+                    ciwic_export_opt_declarator(e, decl->declarator);
+                    ciwic_export_key(e, "width");
+                    ciwic_export_opt_expr(e, decl->expr);
+                    ciwic_export_close(e);
+                }
+
+                ciwic_export_list_close(e);
+                ciwic_export_close(e);
+            }
+            ciwic_export_list_close(e);
+            break;
+        case ciwic_type_spec_typedef_name:
+            ciwic_export_key(e, "name");
+            ciwic_export_string(e, specs->typedef_name.text, specs->typedef_name.len);
+            break;
+    }
+
+    ciwic_export_close(e);
+}
+
+void ciwic_export_type_name(ciwic_exporter *e, ciwic_type_name *name) {
+    ciwic_export_open(e, "type_name");
+    ciwic_export_key(e, "specifiers");
+    ciwic_export_specifiers(e, &name->specifiers);
+    ciwic_export_key(e, "declarator");
+    ciwic_export_opt_declarator(e, name->declarator);
+    ciwic_export_close(e);
+}
+
+void ciwic_export_params(ciwic_exporter *e, ciwic_param_list *list) {
+    int i = 0;
+
+    ciwic_export_list_open(e);
+
+    for (; list != NULL; list = list->rest) {
+        ciwic_export_item(e, i++);
+        ciwic_export_open(e, "param");
+        ciwic_export_key(e, "specifiers");
+        ciwic_export_specifiers(e, &list->specifiers);
+        ciwic_export_key(e, "declarator");
+        ciwic_export_opt_declarator(e, list->declarator);
+        ciwic_export_close(e);
+    }
+
+    ciwic_export_list_close(e);
+}
+
+void ciwic_export_declarator(ciwic_exporter *e, ciwic_declarator *decl) {
+    ciwic_export_open(e, ciwic_export_declarator_types[decl->type]);
+    ciwic_export_span(e, decl->span);
+
+    switch (decl->type) {
+        case ciwic_declarator_pointer:
+            ciwic_export_qualifiers(e, decl->pointer_qualifiers);
+            break;
+        case ciwic_declarator_identifier:
+            ciwic_export_key(e, "name");
+            ciwic_export_string(e, decl->ident.text, decl->ident.len);
+            break;
+        case ciwic_declarator_array:
+            ciwic_export_key(e, "static");
+            ciwic_export_bool(e, decl->array.is_static);
+            ciwic_export_key(e, "var_len");
+            ciwic_export_bool(e, decl->array.is_var_len);
+            ciwic_export_qualifiers(e, decl->array.type_qualifiers);
+            ciwic_export_key(e, "size");
+            ciwic_export_opt_expr(e, decl->array.expr);
+            break;
+        case ciwic_declarator_func:
+            ciwic_export_key(e, "params");
+            ciwic_export_params(e, decl->func.param_list);
+            ciwic_export_key(e, "ellipsis");
+            ciwic_export_bool(e, decl->func.has_ellipsis);
+            break;
+        case ciwic_declarator_func_old:
+            break;
+    }
+
+    ciwic_export_key(e, "inner");
+    ciwic_export_opt_declarator(e, decl->inner);
+    ciwic_export_close(e);
+}
+
+void ciwic_export_initializer_list(ciwic_exporter *e, ciwic_initializer_list *list) {
+    int i = 0;
+
+    ciwic_export_list_open(e);
+
+    for (; list != NULL; list = list->rest) {
+        ciwic_export_item(e, i++);
+        ciwic_export_open(e, "item");
+        ciwic_export_key(e, "designators");
+        ciwic_export_list_open(e);
+
+        int j = 0;
+        for (ciwic_designator_list *desig = list->designation; desig != NULL; desig = desig->rest) {
+            ciwic_export_item(e, j++);
+            if (desig->type == ciwic_designator_expr) {
+                ciwic_export_open(e, "index");
+                ciwic_export_key(e, "expr");
+                ciwic_export_expr(e, &desig->expr);
+            } else {
+                ciwic_export_open(e, "member");
+                ciwic_export_key(e, "name");
+                ciwic_export_string(e, desig->ident.text, desig->ident.len);
+            }
+            ciwic_export_close(e);
+        }
+
+        ciwic_export_list_close(e);
+        ciwic_export_key(e, "initializer");
+        ciwic_export_initializer(e, list->initializer);
+        ciwic_export_close(e);
+    }
+
+    ciwic_export_list_close(e);
+}
+
+void ciwic_export_initializer(ciwic_exporter *e, ciwic_initializer *init) {
+    switch (init->type) {
+        case ciwic_initializer_init_expr:
+            ciwic_export_open(e, "init_expr");
+            ciwic_export_key(e, "expr");
+            ciwic_export_expr(e, &init->expr);
+            break;
+        case ciwic_initializer_init_list:
+            ciwic_export_open(e, "init_list");
+            ciwic_export_key(e, "items");
+            ciwic_export_initializer_list(e, &init->list);
+            break;
+    }
+
+    ciwic_export_close(e);
+}
+
+// Writes the part of a chain link that comes before its chain operand
+void ciwic_export_expr_head(ciwic_exporter *e, ciwic_expr *expr) {
+    switch (expr->type) {
+        case ciwic_expr_type_unary_op:
+            ciwic_export_open(e, "unary");
+            ciwic_export_span(e, expr->span);
+            ciwic_export_key(e, "op");
+            ciwic_export_symbol(e, ciwic_export_unary_ops[expr->unary_op.op]);
+            ciwic_export_key(e, "operand");
+            break;
+        case ciwic_expr_type_binary_op:
+            ciwic_export_open(e, "binary");
+            ciwic_export_span(e, expr->span);
+            ciwic_export_key(e, "op");
+            ciwic_export_symbol(e, ciwic_export_binary_ops[expr->binary_op.op]);
+            ciwic_export_key(e, "left");
+            if (expr->binary_op.op == ciwic_expr_op_comma) {
+                ciwic_export_expr(e, expr->binary_op.fst);
+                ciwic_export_key(e, "right");
+            }
+            break;
+        case ciwic_expr_type_call:
+            ciwic_export_open(e, "call");
+            ciwic_export_span(e, expr->span);
+            ciwic_export_key(e, "function");
+            break;
+        case ciwic_expr_type_subscript:
+            ciwic_export_open(e, "subscript");
+            ciwic_export_span(e, expr->span);
+            ciwic_export_key(e, "array");
+            break;
+        case ciwic_expr_type_member:
+        case ciwic_expr_type_member_deref:
+            ciwic_export_open(e, expr->type == ciwic_expr_type_member ? "member" : "member_deref");
+            ciwic_export_span(e, expr->span);
+            ciwic_export_key(e, "object");
+            break;
+        default:
+            break;
+    }
+}
+
+// Writes the part of a chain link that comes after its chain operand
+void ciwic_export_expr_tail(ciwic_exporter *e, ciwic_expr *expr) {
+    int i = 0;
+
+    switch (expr->type) {
+        case ciwic_expr_type_binary_op:
+            if (expr->binary_op.op != ciwic_expr_op_comma) {
+                ciwic_export_key(e, "right");
+                ciwic_export_expr(e, expr->binary_op.snd);
+            }
+            break;
+        case ciwic_expr_type_call:
+            ciwic_export_key(e, "args");
+            ciwic_export_list_open(e);
+            for (ciwic_expr_arg_list *arg = expr->call.args; arg != NULL; arg = arg->rest) {
+                ciwic_export_item(e, i++);
+                ciwic_export_expr(e, &arg->head);
+            }
+            ciwic_export_list_close(e);
+            break;
+        case ciwic_expr_type_subscript:
+            ciwic_export_key(e, "index");
+            ciwic_export_expr(e, expr->subscript.pos);
+            break;
+        case ciwic_expr_type_member:
+        case ciwic_expr_type_member_deref:
+            ciwic_export_key(e, "name");
+            ciwic_export_string(e, expr->member.identifier.text, expr->member.identifier.len);
+            break;
+        default:
+            break;
+    }
+
+    ciwic_export_close(e);
+}
+
+// Writes an expression that is not a chain link
+void ciwic_export_expr_leaf(ciwic_exporter *e, ciwic_expr *expr) {
+    switch (expr->type) {
+        case ciwic_expr_type_unary_op:
+            ciwic_export_open(e, "unary");
+            ciwic_export_span(e, expr->span);
+            ciwic_export_key(e, "op");
+            ciwic_export_symbol(e, ciwic_export_unary_ops[expr->unary_op.op]);
+            ciwic_export_key(e, "operand");
+            ciwic_export_expr(e, expr->unary_op.inner);
+            break;
+        case ciwic_expr_type_identifier:
+            ciwic_export_open(e, "identifier");
+            ciwic_export_span(e, expr->span);
+            ciwic_export_key(e, "name");
+            ciwic_export_string(e, expr->identifier.text, expr->identifier.len);
+            break;
+        case ciwic_expr_type_constant:
+            ciwic_export_open(e, "constant");
+            ciwic_export_span(e, expr->span);
+            ciwic_export_key(e, "type");
+            ciwic_export_symbol(e, ciwic_export_constant_types[expr->constant.type]);
+            ciwic_export_key(e, "text");
+            ciwic_export_string(e, expr->constant.raw_text, strlen(expr->constant.raw_text));
+            break;
+        case ciwic_expr_type_initialize:
+            ciwic_export_open(e, "compound_literal");
+            ciwic_export_span(e, expr->span);
+            ciwic_export_key(e, "type");
+            ciwic_export_type_name(e, &expr->initialize.type_name);
+            ciwic_export_key(e, "items");
+            ciwic_export_initializer_list(e, &expr->initialize.initializer_list);
+            break;
+        case ciwic_expr_type_sizeof_expr:
+            ciwic_export_open(e, "sizeof_expr");
+            ciwic_export_span(e, expr->span);
+            ciwic_export_key(e, "operand");
+            ciwic_export_expr(e, expr->sizeof_expr);
+            break;
+        case ciwic_expr_type_sizeof_type:
+            ciwic_export_open(e, "sizeof_type");
+            ciwic_export_span(e, expr->span);
+            ciwic_export_key(e, "type");
+            ciwic_export_type_name(e, &expr->sizeof_type);
+            break;
+        case ciwic_expr_type_cast:
+            ciwic_export_open(e, "cast");
+            ciwic_export_span(e, expr->span);
+            ciwic_export_key(e, "type");
+            ciwic_export_type_name(e, &expr->cast.type_name);
+            ciwic_export_key(e, "operand");
+            ciwic_export_expr(e, expr->cast.expr);
+            break;
+        case ciwic_expr_type_conditional:
+            ciwic_export_open(e, "conditional");
+            ciwic_export_span(e, expr->span);
+            ciwic_export_key(e, "cond");
+            ciwic_export_expr(e, expr->conditional.cond);
+            ciwic_export_key(e, "then");
+            ciwic_export_expr(e, expr->conditional.left);
+            ciwic_export_key(e, "else");
+            ciwic_export_expr(e, expr->conditional.right);
+            break;
+        case ciwic_expr_type_assignment:
+            ciwic_export_open(e, "assignment");
+            ciwic_export_span(e, expr->span);
+            // Plain assignment is stored with the comma operator
+            ciwic_export_key(e, "op");
+            ciwic_export_symbol(e, expr->assignment.op == ciwic_expr_op_comma
+                    ? "assign" : ciwic_export_binary_ops[expr->assignment.op]);
+            ciwic_export_key(e, "left");
+            ciwic_export_expr(e, expr->assignment.left);
+            ciwic_export_key(e, "right");
+            ciwic_export_expr(e, expr->assignment.right);
+            break;
+        default:
+            break;
+    }
+
+    ciwic_export_close(e);
+}
+
+void ciwic_export_expr(ciwic_exporter *e, ciwic_expr *expr) {
+    ciwic_expr_chain chain;
+    ciwic_expr_chain_init(&chain, expr);
+
+    for (int i = 0; i < chain.len; i++) {
+        ciwic_export_expr_head(e, chain.links[i]);
+    }
+
+    ciwic_export_expr_leaf(e, chain.leaf);
+
+    for (int i = chain.len - 1; i >= 0; i--) {
+        ciwic_export_expr_tail(e, chain.links[i]);
+    }
+
+    ciwic_expr_chain_free(&chain);
+}
+
+void ciwic_export_statement(ciwic_exporter *e, ciwic_statement *stmt) {
+    int i = 0;
+
+    ciwic_export_open(e, ciwic_export_statement_types[stmt->type]);
+    ciwic_export_span(e, stmt->span);
+
+    switch (stmt->type) {
+        case ciwic_statement_label:
+            ciwic_export_key(e, "label");
+            ciwic_export_string(e, stmt->labeled.label_ident.text, stmt->labeled.label_ident.len);
+            ciwic_export_key(e, "body");
+            ciwic_export_statement(e, stmt->labeled.stmt);
+            break;
+        case ciwic_statement_case:
+            ciwic_export_key(e, "expr");
+            ciwic_export_expr(e, &stmt->labeled.case_expr);
+            ciwic_export_key(e, "body");
+            ciwic_export_statement(e, stmt->labeled.stmt);
+            break;
+        case ciwic_statement_default:
+            ciwic_export_key(e, "body");
+            ciwic_export_statement(e, stmt->labeled.stmt);
+            break;
+        case ciwic_statement_block:
+            ciwic_export_key(e, "items");
+            ciwic_export_list_open(e);
+            for (ciwic_statement *block = stmt; block != NULL; block = block->block.rest) {
+                ciwic_export_item(e, i++);
+                ciwic_export_statement(e, block->block.head);
+            }
+            ciwic_export_list_close(e);
+            break;
+        case ciwic_statement_expr:
+            ciwic_export_key(e, "expr");
+            ciwic_export_expr(e, &stmt->expr);
+            break;
+        case ciwic_statement_if:
+            ciwic_export_key(e, "cond");
+            ciwic_export_expr(e, &stmt->if_stmt.expr);
+            ciwic_export_key(e, "then");
+            ciwic_export_statement(e, stmt->if_stmt.if_then);
+            ciwic_export_key(e, "else");
+            if (stmt->if_stmt.if_else != NULL) {
+                ciwic_export_statement(e, stmt->if_stmt.if_else);
+            } else {
+                ciwic_export_null(e);
+            }
+            break;
+        case ciwic_statement_switch:
+        case ciwic_statement_while:
+        case ciwic_statement_do_while:
+            ciwic_export_key(e, "cond");
+            ciwic_export_expr(e, &stmt->while_stmt.expr);
+            ciwic_export_key(e, "body");
+            ciwic_export_statement(e, stmt->while_stmt.stmt);
+            break;
+        case ciwic_statement_for:
+            ciwic_export_key(e, "init");
+            if (stmt->for_stmt.pre_decl != NULL) {
+                ciwic_export_declaration(e, stmt->for_stmt.pre_decl);
+            } else {
+                ciwic_export_opt_expr(e, stmt->for_stmt.pre_expr);
+            }
+            ciwic_export_key(e, "cond");
+            ciwic_export_opt_expr(e, stmt->for_stmt.test_expr);
+            ciwic_export_key(e, "step");
+            ciwic_export_opt_expr(e, stmt->for_stmt.post_expr);
+            ciwic_export_key(e, "body");
+            ciwic_export_statement(e, stmt->for_stmt.stmt);
+            break;
+        case ciwic_statement_goto:
+            ciwic_export_key(e, "label");
+            ciwic_export_string(e, stmt->goto_ident.text, stmt->goto_ident.len);
+            break;
+        case ciwic_statement_return:
+            ciwic_export_key(e, "expr");
+            ciwic_export_opt_expr(e, stmt->return_expr);
+            break;
+        case ciwic_statement_continue:
+        case ciwic_statement_break:
+        case ciwic_statement_null:
+            break;
+    }
+
+    ciwic_export_close(e);
+}
+
+void ciwic_export_declaration(ciwic_exporter *e, ciwic_declaration *decl) {
+    int i = 0;
+
+    ciwic_export_open(e, "declaration");
+    ciwic_export_span(e, decl->span);
+    ciwic_export_key(e, "specifiers");
+    ciwic_export_specifiers(e, &decl->specifiers);
+    ciwic_export_key(e, "declarators");
+    ciwic_export_list_open(e);
+
+    for (ciwic_init_declarator_list *list = &decl->list; list != NULL; list = list->rest) {
+        ciwic_export_item(e, i++);
+        ciwic_export_open(e, "init_declarator");
+        ciwic_export_key(e, "declarator");
+        ciwic_export_declarator(e, &list->declarator);
+        ciwic_export_key(e, "initializer");
+        if (list->initializer != NULL) {
+            ciwic_export_initializer(e, list->initializer);
+        } else {
+            ciwic_export_null(e);
+        }
+        ciwic_export_close(e);
+    }
+
+    ciwic_export_list_close(e);
+    ciwic_export_close(e);
+}
+
+void ciwic_export_func_definition(ciwic_exporter *e, ciwic_func_definition *func, ciwic_span span) {
+    int i = 0;
+
+    ciwic_export_open(e, "function");
+    ciwic_export_span(e, span);
+    ciwic_export_key(e, "specifiers");
+    ciwic_export_specifiers(e, &func->specifiers);
+    ciwic_export_key(e, "declarator");
+    ciwic_export_declarator(e, &func->declarator);
+    ciwic_export_key(e, "old_params");
+    ciwic_export_list_open(e);
+
+    for (ciwic_declaration_list *list = func->decl_list; list != NULL; list = list->rest) {
+        ciwic_export_item(e, i++);
+        ciwic_export_declaration(e, &list->head);
+    }
+
+    ciwic_export_list_close(e);
+    ciwic_export_key(e, "body");
+    ciwic_export_statement(e, &func->statement);
+    ciwic_export_close(e);
+}
+
+void ciwic_exporter_init(ciwic_exporter *exporter, ciwic_sink *sink, ciwic_export_format format) {
+    exporter->sink = sink;
+    exporter->format = format;
+    exporter->count = 0;
+    exporter->offset = 0;
+
+    if (format == ciwic_export_json) {
+        ciwic_sink_str(sink, "[\n");
+    } else {
+        ciwic_sink_str(sink, "(translation_unit\n");
+    }
+}
+
+void ciwic_export_definition(ciwic_exporter *exporter, ciwic_translation_unit *def) {
+    if (exporter->count > 0 && exporter->format == ciwic_export_json) {
+        ciwic_sink_str(exporter->sink, ",\n");
+    } else if (exporter->count > 0) {
+        ciwic_sink_char(exporter->sink, '\n');
+    }
+
+    switch (def->def_type) {
+        case ciwic_definition_func:
+            ciwic_export_func_definition(exporter, &def->func, def->span);
+            break;
+        case ciwic_definition_decl:
+            ciwic_export_declaration(exporter, &def->decl);
+            break;
+    }
+
+    exporter->count++;
+}
+
+void ciwic_exporter_finish(ciwic_exporter *exporter) {
+    if (exporter->format == ciwic_export_json) {
+        ciwic_sink_str(exporter->sink, "\n]\n");
+    } else {
+        ciwic_sink_str(exporter->sink, ")\n");
+    }
+}
+
+void ciwic_export_translation_unit(ciwic_sink *sink, ciwic_export_format format, ciwic_translation_unit *translation_unit) {
+    ciwic_exporter exporter;
+
+    ciwic_exporter_init(&exporter, sink, format);
+
+    for (ciwic_translation_unit *def = translation_unit; def != NULL; def = def->rest) {
+        ciwic_export_definition(&exporter, def);
+    }
+
+    ciwic_exporter_finish(&exporter);
+}
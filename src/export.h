@@ -0,0 +1,36 @@
+#pragma once
+
+#include <ast.h>
+#include <sink.h>
+
+// Machine readable AST output
+//
+// Every node is written as an object (JSON) or list (S-expression) whose
+// first element names its kind, followed by named fields:
+//
+//   {"kind":"binary","span":[4,9],"op":"add","left":{...},"right":{...}}
+//   (binary :span (4 9) :op add :left (...) :right (...))
+//
+// Absent optional fields are null or nil. Output goes straight to the sink,
+// so nothing but the current path through the tree is held in memory.
+
+typedef enum {
+    ciwic_export_json,
+    ciwic_export_sexpr,
+} ciwic_export_format;
+
+typedef struct {
+    ciwic_sink *sink;
+    ciwic_export_format format;
+    int count; // Definitions written so far
+    int offset; // Added to every span
+} ciwic_exporter;
+
+// Starts the list of definitions
+void ciwic_exporter_init(ciwic_exporter *exporter, ciwic_sink *sink, ciwic_export_format format);
+// Writes one definition, ignoring def->rest
+void ciwic_export_definition(ciwic_exporter *exporter, ciwic_translation_unit *def);
+// Ends the list of definitions
+void ciwic_exporter_finish(ciwic_exporter *exporter);
+
+void ciwic_export_translation_unit(ciwic_sink *sink, ciwic_export_format format, ciwic_translation_unit *translation_unit);
@@ -0,0 +1,98 @@
+#include <string.h>
+
+#include <hash.h>
+
+#define CIWIC_PRIME1 0x9E3779B185EBCA87ULL
+#define CIWIC_PRIME2 0xC2B2AE3D27D4EB4FULL
+#define CIWIC_PRIME3 0x165667B19E3779F9ULL
+#define CIWIC_PRIME4 0x85EBCA77C2B2AE63ULL
+#define CIWIC_PRIME5 0x27D4EB2F165667C5ULL
+
+uint64_t ciwic_hash_rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+uint64_t ciwic_hash_read64(const unsigned char *p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+uint32_t ciwic_hash_read32(const unsigned char *p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+uint64_t ciwic_hash_round(uint64_t acc, uint64_t input) {
+    acc += input * CIWIC_PRIME2;
+    acc = ciwic_hash_rotl(acc, 31);
+    return acc * CIWIC_PRIME1;
+}
+
+uint64_t ciwic_hash_merge(uint64_t acc, uint64_t val) {
+    acc ^= ciwic_hash_round(0, val);
+    return acc * CIWIC_PRIME1 + CIWIC_PRIME4;
+}
+
+uint64_t ciwic_hash64(const void *data, uint64_t len, uint64_t seed) {
+    const unsigned char *p = data;
+    const unsigned char *end = p + len;
+    uint64_t h;
+
+    if (len >= 32) {
+        uint64_t v1 = seed + CIWIC_PRIME1 + CIWIC_PRIME2;
+        uint64_t v2 = seed + CIWIC_PRIME2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - CIWIC_PRIME1;
+
+        do {
+            v1 = ciwic_hash_round(v1, ciwic_hash_read64(p));
+            v2 = ciwic_hash_round(v2, ciwic_hash_read64(p + 8));
+            v3 = ciwic_hash_round(v3, ciwic_hash_read64(p + 16));
+            v4 = ciwic_hash_round(v4, ciwic_hash_read64(p + 24));
+            p += 32;
+        } while (p + 32 <= end);
+
+        h = ciwic_hash_rotl(v1, 1) + ciwic_hash_rotl(v2, 7)
+            + ciwic_hash_rotl(v3, 12) + ciwic_hash_rotl(v4, 18);
+        h = ciwic_hash_merge(h, v1);
+        h = ciwic_hash_merge(h, v2);
+        h = ciwic_hash_merge(h, v3);
+        h = ciwic_hash_merge(h, v4);
+    } else {
+        h = seed + CIWIC_PRIME5;
+    }
+
+    h += len;
+
+    for (; p + 8 <= end; p += 8) {
+        h ^= ciwic_hash_round(0, ciwic_hash_read64(p));
+        h = ciwic_hash_rotl(h, 27) * CIWIC_PRIME1 + CIWIC_PRIME4;
+    }
+
+    if (p + 4 <= end) {
+        h ^= (uint64_t) ciwic_hash_read32(p) * CIWIC_PRIME1;
+        h = ciwic_hash_rotl(h, 23) * CIWIC_PRIME2 + CIWIC_PRIME3;
+        p += 4;
+    }
+
+    for (; p < end; p++) {
+        h ^= *p * CIWIC_PRIME5;
+        h = ciwic_hash_rotl(h, 11) * CIWIC_PRIME1;
+    }
+
+    h ^= h >> 33;
+    h *= CIWIC_PRIME2;
+    h ^= h >> 29;
+    h *= CIWIC_PRIME3;
+    h ^= h >> 32;
+
+    return h;
+}
+
+uint64_t ciwic_hash_combine(uint64_t h, uint64_t value) {
+    h = ciwic_hash_round(h, value);
+    h ^= h >> 29;
+    return h * CIWIC_PRIME3;
+}
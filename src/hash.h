@@ -0,0 +1,9 @@
+#pragma once
+
+#include <stdint.h>
+
+// 64-bit non-cryptographic hash of len bytes at data (the XXH64 algorithm)
+uint64_t ciwic_hash64(const void *data, uint64_t len, uint64_t seed);
+
+// Mixes value into the running hash h
+uint64_t ciwic_hash_combine(uint64_t h, uint64_t value);
@@ -1,25 +1,424 @@
 #include <stdio.h>
-//#include "parser.h"
-//#include "expr.h"
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 #include <ast.h>
 #include <parser.h>
+#include <push.h>
+#include <cache.h>
+#include <export.h>
+#include <emit.h>
+#include <workspace.h>
+#include <daemon.h>
+#include <profile.h>
+#include <trace.h>
 
-char buf[100];
+typedef enum {
+    output_text,
+    output_json,
+    output_sexpr,
+    output_c,
+} output_format;
 
-int main() {
-    printf("Write a declaration: ");
-    fgets(buf, 100, stdin);
+typedef struct {
+    output_format format;
+    ciwic_sink sink;
+    ciwic_exporter exporter;
+    int interactive;
+} output;
 
-    ciwic_parser parser = ciwic_parser_new(buf, 100);
-    ciwic_translation_unit translation_unit;
+void print_definition(void *data, ciwic_translation_unit *def, char *text, int offset) {
+    output *out = data;
 
-    if (ciwic_parser_translation_unit(&parser, &translation_unit)) {
-        printf("Error: could not parse\n");
+    if (out->format == output_text) {
+        ciwic_print_translation_unit(&out->sink, def, 0);
+        ciwic_sink_char(&out->sink, '\n');
+    } else if (out->format == output_c) {
+        ciwic_emit_definition(&out->sink, def);
     } else {
-        printf("Successfully parsed:\n");
-        ciwic_print_translation_unit(&translation_unit, 0);
-        printf("\n");
+        out->exporter.offset = offset;
+        ciwic_export_definition(&out->exporter, def);
+    }
+
+    if (out->interactive) {
+        ciwic_sink_flush(&out->sink);
+    }
+}
+
+int parse_stdin(output_format format) {
+    char chunk[4096];
+    ssize_t len;
+    ciwic_push_parser push;
+    output out;
+
+    out.format = format;
+    out.interactive = isatty(STDIN_FILENO);
+
+    if (out.interactive && format == output_text) {
+        printf("Write a declaration: ");
+        fflush(stdout);
+    }
+
+    ciwic_sink_init_file(&out.sink, stdout);
+    if (format == output_json || format == output_sexpr) {
+        ciwic_exporter_init(&out.exporter, &out.sink,
+                format == output_json ? ciwic_export_json : ciwic_export_sexpr);
+    }
+
+    ciwic_push_parser_init(&push, print_definition, &out);
+
+    while ((len = read(STDIN_FILENO, chunk, sizeof(chunk))) > 0) {
+        if (ciwic_push_parser_feed(&push, chunk, len)) {
+            break;
+        }
+    }
+
+    int res = ciwic_push_parser_finish(&push);
+    ciwic_push_parser_free(&push);
+
+    if (format == output_json || format == output_sexpr) {
+        ciwic_exporter_finish(&out.exporter);
+    }
+    ciwic_sink_close(&out.sink);
+
+    if (res) {
+        printf("Error: could not parse\n");
+        return 1;
+    }
+
+    return 0;
+}
+
+int read_file(const char *path, char **buf, int *len) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return 1;
+    }
+
+    int cap = 4096;
+    *buf = malloc(cap);
+    *len = 0;
+
+    size_t n;
+    while ((n = fread(&(*buf)[*len], 1, cap - *len, file)) > 0) {
+        *len += n;
+        if (*len == cap) {
+            cap *= 2;
+            *buf = realloc(*buf, cap);
+        }
+    }
+
+    int res = ferror(file);
+    fclose(file);
+    return res;
+}
+
+int count_definitions(ciwic_translation_unit *translation_unit) {
+    int count = 0;
+    for (ciwic_translation_unit *def = translation_unit; def != NULL; def = def->rest) {
+        count++;
+    }
+    return count;
+}
+
+// Start of a phase of parse_file, or 0 when it is not traced
+uint64_t phase_start(ciwic_parser *parser) {
+    return parser->trace != NULL ? ciwic_trace_now() : 0;
+}
+
+void phase_end(ciwic_parser *parser, const char *name, uint64_t start, const char *path) {
+    if (parser->trace != NULL) {
+        ciwic_trace_event_add(parser->trace, name, start, ciwic_trace_now(), path, -1);
+    }
+}
+
+// Parses one file, or takes its AST from the cache, and reports how many
+// definitions it has. The parser is reused from file to file.
+int parse_file(ciwic_parser *parser, const char *path, ciwic_cache *cache) {
+    char *buf;
+    int len;
+    uint64_t start = phase_start(parser);
+
+    if (read_file(path, &buf, &len)) {
+        printf("%s: Error: could not read\n", path);
+        return 1;
+    }
+
+    phase_end(parser, "read", start, path);
+
+    ciwic_parser_reset(parser, buf, len);
+    uint64_t key = ciwic_cache_key(buf, len, parser->flags);
+    ciwic_astfile file;
+
+    start = phase_start(parser);
+    if (cache != NULL && !ciwic_cache_lookup(cache, key, &file)) {
+        phase_end(parser, "cache", start, path);
+        printf("%s: %d definitions (cached)\n", path, ciwic_astfile_definition_count(&file));
+        ciwic_astfile_close(&file);
+        free(buf);
+        return 0;
+    }
+
+    ciwic_translation_unit translation_unit;
+
+    start = phase_start(parser);
+    int res = ciwic_parser_translation_unit(parser, &translation_unit);
+    if (res == CIWIC_PARSER_STOPPED) {
+        printf("%s: Error: parse stopped: %s\n", path, ciwic_parser_stop_message(parser->stop));
+        free(buf);
+        return 1;
+    }
+
+    if (res || (ciwic_parser_whitespace(parser), parser->pos != len)) {
+        printf("%s: Error: could not parse\n", path);
+        free(buf);
+        return 1;
+    }
+    phase_end(parser, "parse", start, path);
+
+    start = phase_start(parser);
+    printf("%s: %d definitions\n", path, count_definitions(&translation_unit));
+    phase_end(parser, "print", start, path);
+
+    if (parser->profile != NULL) {
+        parser->profile->bytes += len;
+        fprintf(stderr, "%s: %llu bytes of AST\n", path, (unsigned long long) parser->profile->current);
+    }
+
+    if (cache != NULL) {
+        start = phase_start(parser);
+        ciwic_cache_store(cache, key, &translation_unit);
+        phase_end(parser, "cache", start, path);
     }
 
+    free(buf);
     return 0;
 }
+
+void print_file(void *data, ciwic_workspace_file *file) {
+    if (!file->exists) {
+        printf("%s: deleted\n", file->path);
+    } else if (!file->parsed) {
+        printf("%s: Error: could not parse\n", file->path);
+    } else {
+        printf("%s: %d definitions\n", file->path, count_definitions(&file->translation_unit));
+    }
+    fflush(stdout);
+}
+
+// Keeps every source file below root parsed and reports each change
+int watch(const char *root) {
+    ciwic_workspace ws;
+
+    if (ciwic_workspace_open(&ws, root)) {
+        fprintf(stderr, "Error: could not watch %s\n", root);
+        return 1;
+    }
+
+    int parsed = 0;
+    for (int i = 0; i < ws.files_len; i++) {
+        parsed += ws.files[i].parsed;
+    }
+
+    printf("Watching %s: parsed %d of %d files\n", root, parsed, ws.files_len);
+    fflush(stdout);
+
+    while (ciwic_workspace_poll(&ws, -1, print_file, NULL) >= 0) {
+    }
+
+    ciwic_workspace_close(&ws);
+    return 1;
+}
+
+// Sends the words of request to the daemon at socket_path as one request
+int query(const char *socket_path, char **request, int count) {
+    int len = 0;
+    for (int i = 0; i < count; i++) {
+        len += strlen(request[i]) + 1;
+    }
+
+    char *buf = malloc(len + 1);
+    buf[0] = 0;
+    for (int i = 0; i < count; i++) {
+        if (i > 0) {
+            strcat(buf, " ");
+        }
+        strcat(buf, request[i]);
+    }
+
+    char *response;
+    int response_len;
+    int res = ciwic_daemon_request(socket_path, buf, &response, &response_len);
+    free(buf);
+
+    if (res) {
+        fprintf(stderr, "Error: could not query daemon at %s\n", socket_path);
+        return 1;
+    }
+
+    fwrite(response, 1, response_len, stdout);
+    res = strncmp(response, "ok\n", 3) != 0;
+    free(response);
+    return res;
+}
+
+void usage(const char *name) {
+    fprintf(stderr, "Usage: %s [-f text|json|sexpr|c] [-c cache dir] [-s cache size in MB] [-w dir] [file...]\n", name);
+    fprintf(stderr, "       %s -b steps file...\n", name);
+    fprintf(stderr, "       %s -p file...\n", name);
+    fprintf(stderr, "       %s -t trace.json file...\n", name);
+    fprintf(stderr, "       %s -d socket\n", name);
+    fprintf(stderr, "       %s -q socket command [args...]\n", name);
+    fprintf(stderr, "Without files a translation unit is read from stdin and its AST printed\n");
+    fprintf(stderr, "in the format given by -f. With -w the source files below a directory are\n");
+    fprintf(stderr, "parsed and parsed again whenever they change. With -d a daemon keeping parsed\n");
+    fprintf(stderr, "files in memory serves requests on a Unix socket, and -q sends it one.\n");
+    fprintf(stderr, "With -p the memory taken by the AST of each kind of node is reported and, in\n");
+    fprintf(stderr, "a build made by make profile, the parser rules are ranked by how much input\n");
+    fprintf(stderr, "they parsed before backtracking. With -t the time spent in\n");
+    fprintf(stderr, "each phase and definition is written as a Chrome trace. With -b a file is\n");
+    fprintf(stderr, "given up on once the parser rules have been called that many times.\n");
+}
+
+int main(int argc, char **argv) {
+    const char *cache_dir = NULL;
+    const char *watch_dir = NULL;
+    const char *daemon_socket = NULL;
+    const char *query_socket = NULL;
+    const char *trace_path = NULL;
+    int profile = 0;
+    long max_steps = 0;
+    size_t cache_size = 256;
+    output_format format = output_text;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "c:s:f:w:d:q:pt:b:h")) != -1) {
+        switch (opt) {
+            case 'f':
+                if (strcmp(optarg, "text") == 0) {
+                    format = output_text;
+                } else if (strcmp(optarg, "json") == 0) {
+                    format = output_json;
+                } else if (strcmp(optarg, "sexpr") == 0) {
+                    format = output_sexpr;
+                } else if (strcmp(optarg, "c") == 0) {
+                    format = output_c;
+                } else {
+                    usage(argv[0]);
+                    return 2;
+                }
+                break;
+            case 'c':
+                cache_dir = optarg;
+                break;
+            case 'w':
+                watch_dir = optarg;
+                break;
+            case 'd':
+                daemon_socket = optarg;
+                break;
+            case 'q':
+                query_socket = optarg;
+                break;
+            case 'p':
+                profile = 1;
+                break;
+            case 't':
+                trace_path = optarg;
+                break;
+            case 'b':
+                max_steps = strtol(optarg, NULL, 10);
+                break;
+            case 's':
+                cache_size = strtoul(optarg, NULL, 10);
+                break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : 2;
+        }
+    }
+
+    if (daemon_socket != NULL) {
+        if (ciwic_daemon_run(daemon_socket)) {
+            fprintf(stderr, "Error: could not serve on %s\n", daemon_socket);
+        }
+        return 1;
+    }
+
+    if (query_socket != NULL) {
+        if (optind == argc) {
+            usage(argv[0]);
+            return 2;
+        }
+        return query(query_socket, &argv[optind], argc - optind);
+    }
+
+    if (watch_dir != NULL) {
+        return watch(watch_dir);
+    }
+
+    if (optind == argc) {
+        return parse_stdin(format);
+    }
+
+    ciwic_cache cache;
+
+    if (cache_dir != NULL && ciwic_cache_init(&cache, cache_dir, cache_size << 20)) {
+        fprintf(stderr, "Error: could not open cache %s\n", cache_dir);
+        return 1;
+    }
+
+    ciwic_parser parser = ciwic_parser_new(NULL, 0);
+    ciwic_profile counters;
+    ciwic_trace trace;
+    int res = 0;
+
+    parser.limits.max_steps = max_steps;
+
+    if (trace_path != NULL) {
+        ciwic_trace_init(&trace, 0, "main");
+        parser.trace = &trace;
+    }
+
+    if (profile) {
+#ifndef CIWIC_PROFILE
+        fprintf(stderr, "Warning: rule counters need a build made by make profile\n");
+#endif
+        ciwic_profile_init(&counters);
+        parser.profile = &counters;
+    }
+
+    for (int i = optind; i < argc; i++) {
+        res |= parse_file(&parser, argv[i], cache_dir != NULL ? &cache : NULL);
+    }
+
+    if (trace_path != NULL) {
+        FILE *file = fopen(trace_path, "w");
+        if (file == NULL) {
+            fprintf(stderr, "Error: could not write %s\n", trace_path);
+            res = 1;
+        } else {
+            ciwic_sink sink;
+            ciwic_sink_init_file(&sink, file);
+            ciwic_trace_write(&sink, &trace, 1);
+            res |= ciwic_sink_close(&sink);
+            fclose(file);
+        }
+        ciwic_trace_free(&trace);
+    }
+
+    if (profile) {
+        ciwic_sink sink;
+        ciwic_sink_init_file(&sink, stderr);
+        ciwic_profile_report(&counters, &sink);
+        ciwic_sink_close(&sink);
+    }
+
+    ciwic_parser_free(&parser);
+
+    if (cache_dir != NULL) {
+        ciwic_cache_free(&cache);
+    }
+
+    return res;
+}
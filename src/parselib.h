@@ -1,12 +1,67 @@
-#pragma once 
+#pragma once
+
+#include <arena.h>
+
+typedef enum {
+    // Replace trigraphs in translation phase 1
+    ciwic_parser_trigraphs = 1 << 0,
+} ciwic_parser_flags;
+
+// Why a parse was stopped before it could finish
+typedef enum {
+    ciwic_parser_running,
+    ciwic_parser_out_of_steps,
+    ciwic_parser_out_of_stack,
+    ciwic_parser_cancelled,
+} ciwic_parser_stop;
+
+// Bounds on the work of one parse, for input that cannot be trusted. Once
+// one is hit every rule fails and the parse returns CIWIC_PARSER_STOPPED.
+typedef struct {
+    long max_steps; // Calls of recursive rules, 0 for no limit
+    long max_stack; // Bytes of stack the parse may use, 0 for no limit
+    volatile int *cancel; // Can be null, the parse stops once it is nonzero
+} ciwic_parser_limits;
+
+typedef struct ciwic_profile ciwic_profile;
+typedef struct ciwic_trace ciwic_trace;
 
 typedef struct {
     int pos;
     char* text;
     int len;
-} ciwic_parser; 
+    int flags;
+    // Offsets of the first byte of every line, built on first use by
+    // ciwic_parser_location
+    int *lines; // Can be null
+    int lines_len;
+    int lines_cap;
+    // Holds every AST node and string the parser allocates
+    ciwic_arena arena;
+    // Rule counters, only updated when built with CIWIC_PROFILE
+    ciwic_profile *profile; // Can be null
+    // Records an event for every top-level definition
+    ciwic_trace *trace; // Can be null
+
+    ciwic_parser_limits limits;
+    ciwic_parser_stop stop;
+    long steps;
+    char *stack_base; // Can be null, set by the first check of the limits
+} ciwic_parser;
 
 typedef struct {
     char *text;
     int len;
 } string;
+
+// Byte range [start, end) in the parsed buffer
+typedef struct {
+    int start;
+    int end;
+} ciwic_span;
+
+// 1-based line and column (in bytes)
+typedef struct {
+    int line;
+    int column;
+} ciwic_location;
@@ -2,9 +2,77 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <sys/resource.h>
 
 #include <parser.h>
 #include <ast.h>
+#include <scan.h>
+#include <profile.h>
+#include <trace.h>
+
+// In a profiling build every call of a rule goes through
+// ciwic_profile_enter and ciwic_profile_exit. The rules are defined with
+// their names in parentheses so these macros only apply to calls.
+#ifdef CIWIC_PROFILE
+#define CIWIC_PROFILE_CALL(rule, parser, ...) ({ \
+    ciwic_profile_frame frame__; \
+    ciwic_profile_enter(parser, ciwic_rule_##rule, &frame__); \
+    int res__ = ciwic_parser_##rule(parser, __VA_ARGS__); \
+    ciwic_profile_exit(parser, ciwic_rule_##rule, &frame__, res__); \
+    res__; \
+})
+
+#define ciwic_parser_ident(...) CIWIC_PROFILE_CALL(ident, __VA_ARGS__)
+#define ciwic_parser_keyword(...) CIWIC_PROFILE_CALL(keyword, __VA_ARGS__)
+#define ciwic_parser_identifier(...) CIWIC_PROFILE_CALL(identifier, __VA_ARGS__)
+#define ciwic_parser_punctuation(...) CIWIC_PROFILE_CALL(punctuation, __VA_ARGS__)
+#define ciwic_parser_constant_integer(...) CIWIC_PROFILE_CALL(constant_integer, __VA_ARGS__)
+#define ciwic_parser_constant(...) CIWIC_PROFILE_CALL(constant, __VA_ARGS__)
+#define ciwic_parser_primary_expr(...) CIWIC_PROFILE_CALL(primary_expr, __VA_ARGS__)
+#define ciwic_parser_postfix_expr(...) CIWIC_PROFILE_CALL(postfix_expr, __VA_ARGS__)
+#define ciwic_parser_expr_arg_list(...) CIWIC_PROFILE_CALL(expr_arg_list, __VA_ARGS__)
+#define ciwic_parser_unary_expr(...) CIWIC_PROFILE_CALL(unary_expr, __VA_ARGS__)
+#define ciwic_parser_cast_expr(...) CIWIC_PROFILE_CALL(cast_expr, __VA_ARGS__)
+#define ciwic_parser_binop_expr(...) CIWIC_PROFILE_CALL(binop_expr, __VA_ARGS__)
+#define ciwic_parser_logical_or_expr(...) CIWIC_PROFILE_CALL(logical_or_expr, __VA_ARGS__)
+#define ciwic_parser_conditional_expr(...) CIWIC_PROFILE_CALL(conditional_expr, __VA_ARGS__)
+#define ciwic_parser_const_expr(...) CIWIC_PROFILE_CALL(const_expr, __VA_ARGS__)
+#define ciwic_parser_conditional_expr_with_unary(...) CIWIC_PROFILE_CALL(conditional_expr_with_unary, __VA_ARGS__)
+#define ciwic_parser_assignment_expr(...) CIWIC_PROFILE_CALL(assignment_expr, __VA_ARGS__)
+#define ciwic_parser_expr(...) CIWIC_PROFILE_CALL(expr, __VA_ARGS__)
+#define ciwic_parser_storage_class(...) CIWIC_PROFILE_CALL(storage_class, __VA_ARGS__)
+#define ciwic_parser_type_qualifier(...) CIWIC_PROFILE_CALL(type_qualifier, __VA_ARGS__)
+#define ciwic_parser_function_specifier(...) CIWIC_PROFILE_CALL(function_specifier, __VA_ARGS__)
+#define ciwic_parser_type_prim(...) CIWIC_PROFILE_CALL(type_prim, __VA_ARGS__)
+#define ciwic_parser_enum_list_inner(...) CIWIC_PROFILE_CALL(enum_list_inner, __VA_ARGS__)
+#define ciwic_parser_enum_list(...) CIWIC_PROFILE_CALL(enum_list, __VA_ARGS__)
+#define ciwic_parser_struct_declarator_list(...) CIWIC_PROFILE_CALL(struct_declarator_list, __VA_ARGS__)
+#define ciwic_parser_specifier_qualifier_list(...) CIWIC_PROFILE_CALL(specifier_qualifier_list, __VA_ARGS__)
+#define ciwic_parser_struct_list_inner(...) CIWIC_PROFILE_CALL(struct_list_inner, __VA_ARGS__)
+#define ciwic_parser_struct_list(...) CIWIC_PROFILE_CALL(struct_list, __VA_ARGS__)
+#define ciwic_parser_declaration_specifiers(...) CIWIC_PROFILE_CALL(declaration_specifiers, __VA_ARGS__)
+#define ciwic_parser_type_qualifiers(...) CIWIC_PROFILE_CALL(type_qualifiers, __VA_ARGS__)
+#define ciwic_parser_param_list(...) CIWIC_PROFILE_CALL(param_list, __VA_ARGS__)
+#define ciwic_parser_declarator(...) CIWIC_PROFILE_CALL(declarator, __VA_ARGS__)
+#define ciwic_parser_type_name(...) CIWIC_PROFILE_CALL(type_name, __VA_ARGS__)
+#define ciwic_parser_designation(...) CIWIC_PROFILE_CALL(designation, __VA_ARGS__)
+#define ciwic_parser_initializer(...) CIWIC_PROFILE_CALL(initializer, __VA_ARGS__)
+#define ciwic_parser_initializer_list(...) CIWIC_PROFILE_CALL(initializer_list, __VA_ARGS__)
+#define ciwic_parser_init_declarator_list(...) CIWIC_PROFILE_CALL(init_declarator_list, __VA_ARGS__)
+#define ciwic_parser_declaration(...) CIWIC_PROFILE_CALL(declaration, __VA_ARGS__)
+#define ciwic_parser_labeled_statement(...) CIWIC_PROFILE_CALL(labeled_statement, __VA_ARGS__)
+#define ciwic_parser_block_list(...) CIWIC_PROFILE_CALL(block_list, __VA_ARGS__)
+#define ciwic_parser_compound_statement(...) CIWIC_PROFILE_CALL(compound_statement, __VA_ARGS__)
+#define ciwic_parser_expr_statement(...) CIWIC_PROFILE_CALL(expr_statement, __VA_ARGS__)
+#define ciwic_parser_selection_statement(...) CIWIC_PROFILE_CALL(selection_statement, __VA_ARGS__)
+#define ciwic_parser_iteration_statement(...) CIWIC_PROFILE_CALL(iteration_statement, __VA_ARGS__)
+#define ciwic_parser_jump_statement(...) CIWIC_PROFILE_CALL(jump_statement, __VA_ARGS__)
+#define ciwic_parser_statement(...) CIWIC_PROFILE_CALL(statement, __VA_ARGS__)
+#define ciwic_parser_declaration_list(...) CIWIC_PROFILE_CALL(declaration_list, __VA_ARGS__)
+#define ciwic_parser_func_definition(...) CIWIC_PROFILE_CALL(func_definition, __VA_ARGS__)
+#define ciwic_parser_external_declaration(...) CIWIC_PROFILE_CALL(external_declaration, __VA_ARGS__)
+#define ciwic_parser_translation_unit(...) CIWIC_PROFILE_CALL(translation_unit, __VA_ARGS__)
+#endif
 
 /* Based on C99 standard N1256 draft from:
  * http://www.open-std.org/jtc1/sc22/WG14/www/docs/n1256.pdf
@@ -29,33 +97,279 @@ const ciwic_type_prim ciwic_prim_types_list[12] = {ciwic_type_void,
     ciwic_type_complex};
 
 
+ciwic_parser_limits ciwic_parser_default_limits(void) {
+    ciwic_parser_limits limits = { 0, CIWIC_PARSER_MAX_STACK, NULL };
+    struct rlimit stack;
+
+    if (!getrlimit(RLIMIT_STACK, &stack) && stack.rlim_cur != RLIM_INFINITY
+            && stack.rlim_cur > 2 * CIWIC_PARSER_STACK_RESERVE) {
+        limits.max_stack = stack.rlim_cur - CIWIC_PARSER_STACK_RESERVE;
+    }
+
+    return limits;
+}
+
 ciwic_parser ciwic_parser_new(char *buf, int len) {
     ciwic_parser res;
     res.text = buf;
     res.pos = 0;
     res.len = len;
+    res.lines = NULL;
+    res.lines_len = 0;
+    res.lines_cap = 0;
+    res.flags = ciwic_parser_trigraphs;
+    ciwic_arena_init(&res.arena);
+    res.profile = NULL;
+    res.trace = NULL;
+    res.limits = ciwic_parser_default_limits();
+    res.stop = ciwic_parser_running;
+    res.steps = 0;
+    res.stack_base = NULL;
     return res;
 }
 
-int ciwic_parser_char(ciwic_parser *parser, char *res) {
-    if (parser->pos >= parser->len) {
+void ciwic_parser_reset(ciwic_parser *parser, char *buf, int len) {
+    parser->text = buf;
+    parser->pos = 0;
+    parser->len = len;
+    parser->lines_len = 0;
+    ciwic_arena_reset(&parser->arena);
+    parser->stop = ciwic_parser_running;
+    parser->steps = 0;
+    parser->stack_base = NULL;
+    if (parser->profile != NULL) {
+        parser->profile->current = 0;
+    }
+}
+
+void ciwic_parser_free(ciwic_parser *parser) {
+    free(parser->lines);
+    parser->lines = NULL;
+    parser->lines_len = 0;
+    parser->lines_cap = 0;
+    ciwic_arena_free(&parser->arena);
+}
+
+int ciwic_parser_limit(ciwic_parser *parser) {
+    char here;
+
+    if (parser->stop != ciwic_parser_running) {
         return 1;
     }
-    *res = parser->text[parser->pos];
-    parser->pos += 1;
 
+    if (parser->stack_base == NULL) {
+        parser->stack_base = &here;
+    }
+
+    long stack = parser->stack_base - &here;
+    if (stack < 0) {
+        stack = -stack;
+    }
+
+    if (++parser->steps > parser->limits.max_steps && parser->limits.max_steps > 0) {
+        parser->stop = ciwic_parser_out_of_steps;
+    } else if (stack > parser->limits.max_stack && parser->limits.max_stack > 0) {
+        parser->stop = ciwic_parser_out_of_stack;
+    } else if (parser->limits.cancel != NULL && *parser->limits.cancel) {
+        parser->stop = ciwic_parser_cancelled;
+    }
+
+    return parser->stop != ciwic_parser_running;
+}
+
+const char *ciwic_parser_stop_message(ciwic_parser_stop stop) {
+    switch (stop) {
+        case ciwic_parser_out_of_steps:
+            return "step budget exhausted";
+        case ciwic_parser_out_of_stack:
+            return "nested too deeply";
+        case ciwic_parser_cancelled:
+            return "cancelled";
+        default:
+            return "not stopped";
+    }
+}
+
+void *ciwic_parser_alloc(ciwic_parser *parser, int kind, size_t size) {
+    if (parser->profile != NULL) {
+        ciwic_profile_alloc(parser->profile, kind, size);
+    }
+    return ciwic_arena_alloc(&parser->arena, size);
+}
+
+int ciwic_parser_location(ciwic_parser *parser, int offset, ciwic_location *loc) {
+    if (offset < 0 || offset > parser->len) {
+        return 1;
+    }
+
+    if (parser->lines_len == 0) {
+        parser->lines_len = 0;
+        ciwic_scan_push_line(&parser->lines, &parser->lines_len, &parser->lines_cap, 0);
+        ciwic_scan_newlines(parser->text, parser->len, &parser->lines, &parser->lines_len, &parser->lines_cap);
+    }
+
+    // Find the last line starting at or before offset
+    int lo = 0, hi = parser->lines_len - 1;
+    while (lo < hi) {
+        int mid = lo + (hi - lo + 1) / 2;
+        if (parser->lines[mid] <= offset) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+
+    loc->line = lo + 1;
+    loc->column = offset - parser->lines[lo] + 1;
     return 0;
 }
 
-int ciwic_parser_lookahead(ciwic_parser *parser, char *res) {
-    if (parser->pos >= parser->len) {
+ciwic_span ciwic_parser_span(ciwic_parser *parser, int start) {
+    ciwic_span span = { start, parser->pos };
+    return span;
+}
+
+// Translation phases 1 and 2 are applied lazily while reading characters:
+// trigraphs are replaced and backslash-newline splices skipped without making
+// a rewritten copy of the buffer. Only a backslash or a '?' leaves the fast
+// path.
+
+char ciwic_parser_trigraph(char c) {
+    switch (c) {
+        case '=': return '#';
+        case '(': return '[';
+        case '/': return '\\';
+        case ')': return ']';
+        case '\'': return '^';
+        case '<': return '{';
+        case '!': return '|';
+        case '>': return '}';
+        case '-': return '~';
+    }
+
+    return 0;
+}
+
+// Returns the position after any line splices starting at pos
+int ciwic_parser_splice(ciwic_parser *parser, int pos) {
+    char *text = parser->text;
+    int len = parser->len;
+
+    for (;;) {
+        int next = pos;
+
+        if (next < len && text[next] == '\\') {
+            next += 1;
+        } else if ((parser->flags & ciwic_parser_trigraphs) && next + 2 < len
+                && text[next] == '?' && text[next+1] == '?' && text[next+2] == '/') {
+            next += 3;
+        } else {
+            return pos;
+        }
+
+        if (next < len && text[next] == '\r') {
+            next += 1;
+        }
+
+        if (next >= len || text[next] != '\n') {
+            return pos;
+        }
+
+        pos = next + 1;
+    }
+}
+
+int ciwic_parser_peek_slow(ciwic_parser *parser, int pos, char *res, int *next) {
+    char *text = parser->text;
+
+    pos = ciwic_parser_splice(parser, pos);
+
+    if (pos >= parser->len) {
         return 1;
     }
-    *res = parser->text[parser->pos];
 
+    char c = text[pos];
+    char trigraph;
+
+    if (c == '?' && (parser->flags & ciwic_parser_trigraphs) && pos + 2 < parser->len
+            && text[pos+1] == '?' && (trigraph = ciwic_parser_trigraph(text[pos+2]))) {
+        *res = trigraph;
+        *next = pos + 3;
+        return 0;
+    }
+
+    *res = c;
+    *next = pos + 1;
     return 0;
 }
 
+// Reads the character at pos after translation phases 1 and 2, storing the
+// position following it in next
+int ciwic_parser_peek(ciwic_parser *parser, int pos, char *res, int *next) {
+    if (pos >= parser->len) {
+        return 1;
+    }
+
+    char c = parser->text[pos];
+
+    if (c == '\\' || c == '?') {
+        return ciwic_parser_peek_slow(parser, pos, res, next);
+    }
+
+    *res = c;
+    *next = pos + 1;
+    return 0;
+}
+
+int ciwic_parser_char(ciwic_parser *parser, char *res) {
+    return ciwic_parser_peek(parser, parser->pos, res, &parser->pos);
+}
+
+int ciwic_parser_lookahead(ciwic_parser *parser, char *res) {
+    int next;
+    return ciwic_parser_peek(parser, parser->pos, res, &next);
+}
+
+// Scans a token with scan starting at start, continuing through line
+// splices. res points into the buffer unless the token contained a splice,
+// in which case it is a copy with the splices removed.
+int ciwic_parser_spliced_token(ciwic_parser *parser, int start, int (*scan)(const char *, int, int), string *res) {
+    char *text = parser->text;
+    int len = parser->len;
+    int end = scan(text, start, len);
+    int spliced = 0;
+
+    while (end < len && (text[end] == '\\' || text[end] == '?')) {
+        int next = ciwic_parser_splice(parser, end);
+        if (next == end || next >= len
+                || scan(text, next, len) == next) {
+            break;
+        }
+        spliced = 1;
+        end = scan(text, next, len);
+    }
+
+    if (!spliced) {
+        res->text = &text[start];
+        res->len = end - start;
+        return end;
+    }
+
+    res->text = ciwic_parser_alloc(parser, CIWIC_ALLOC_TEXT, end - start);
+    res->len = 0;
+
+    for (int pos = start; pos < end;) {
+        int next = ciwic_parser_splice(parser, pos);
+        if (next != pos) {
+            pos = next;
+            continue;
+        }
+        res->text[res->len++] = text[pos++];
+    }
+
+    return end;
+}
+
 int ciwic_parser_match_char(ciwic_parser *parser, const char match) {
     char res;
     if (ciwic_parser_lookahead(parser, &res)) {
@@ -90,21 +404,87 @@ int ciwic_parser_match_string(ciwic_parser *parser, const char* str) {
     return 0;
 }
 
+int ciwic_parser_line_comment_end(ciwic_parser *parser, int pos) {
+    char *text = parser->text;
+
+    for (;;) {
+        pos = ciwic_scan_char(text, pos, parser->len, '\n');
+        if (pos >= parser->len) {
+            return pos;
+        }
+
+        // A line splice continues the comment on the next line
+        int line_end = pos > 0 && text[pos-1] == '\r' ? pos - 1 : pos;
+        int spliced = (line_end >= 1 && text[line_end-1] == '\\')
+            || ((parser->flags & ciwic_parser_trigraphs) && line_end >= 3
+                && text[line_end-3] == '?' && text[line_end-2] == '?'
+                && text[line_end-1] == '/');
+        if (!spliced) {
+            return pos;
+        }
+        pos++;
+    }
+}
+
+int ciwic_parser_block_comment_end(ciwic_parser *parser, int pos) {
+    char *text = parser->text;
+
+    for (;;) {
+        pos = ciwic_scan_char(text, pos, parser->len, '*');
+        if (pos >= parser->len) {
+            return pos;
+        }
+
+        int next = ciwic_parser_splice(parser, pos + 1);
+        if (next < parser->len && text[next] == '/') {
+            return next + 1;
+        }
+        pos++;
+    }
+}
+
 int ciwic_parser_whitespace(ciwic_parser *parser) {
-    char c;
-    int len = 0;
+    // Comments are replaced by a single space in translation phase 3, so we
+    // treat them as white-space here.
+    int start = parser->pos;
+    char *text = parser->text;
+    int len = parser->len;
+    int pos = parser->pos;
+
+    for (;;) {
+        pos = ciwic_scan_space(text, pos, len);
 
-    while (!ciwic_parser_lookahead(parser, &c)) {
-        if (c != ' ' && c != '\n' && c != '\t') {
+        if (pos >= len) {
             break;
         }
-        if (!ciwic_parser_char(parser, &c)) {
+
+        if (text[pos] == '\\' || text[pos] == '?') {
+            int next = ciwic_parser_splice(parser, pos);
+            if (next != pos) {
+                pos = next;
+                continue;
+            }
+        }
+
+        char c;
+        int next;
+
+        if (text[pos] != '/' || ciwic_parser_peek(parser, pos + 1, &c, &next)) {
+            break;
+        }
+
+        if (c == '/') {
+            pos = ciwic_parser_line_comment_end(parser, next);
+        } else if (c == '*') {
+            pos = ciwic_parser_block_comment_end(parser, next);
+        } else {
             break;
         }
-        len += 1;
     }
 
-    if (len == 0) {
+    parser->pos = pos;
+
+    if (pos == start) {
         return 1;
     }
 
@@ -112,24 +492,11 @@ int ciwic_parser_whitespace(ciwic_parser *parser) {
 }
 
 int ciwic_parser_is_letter(char l) {
-    return (l >= 'a' && l <= 'z') || (l >= 'A' && l <= 'Z') || l == '_';
+    return ciwic_char_class[(unsigned char) l] & ciwic_class_letter;
 }
 
 int ciwic_parser_is_digit(char l) {
-    return l >= '0' && l <= '9';
-}
-
-int ciwic_parser_letter(ciwic_parser *parser, char *res) {
-    char letter;
-    if (ciwic_parser_lookahead(parser, &letter)) {
-        return 1;
-    }
-
-    if (!ciwic_parser_is_letter(letter)) {
-        return 1;
-    }
-
-    return ciwic_parser_char(parser, res);
+    return ciwic_char_class[(unsigned char) l] & ciwic_class_digit;
 }
 
 int ciwic_parser_digit(ciwic_parser *parser, char *res) {
@@ -145,29 +512,16 @@ int ciwic_parser_digit(ciwic_parser *parser, char *res) {
     return ciwic_parser_char(parser, res);
 }
 
-int ciwic_parser_letterdigit(ciwic_parser *parser, char *res) {
-    if (!ciwic_parser_letter(parser, res)) {
-        return 0;
-    }
-
-    if (!ciwic_parser_digit(parser, res)) {
-        return 0;
-    }
-
-    return 1;
-}
-
 int ciwic_parser_digits(ciwic_parser *parser, string *res) {
-    char digit;
-    int len = 0;
-    char *start = &parser->text[parser->pos];
+    int pos = parser->pos;
 
-    while (!ciwic_parser_digit(parser, &digit)) {
-        len += 1;
+    while (pos < parser->len && ciwic_parser_is_digit(parser->text[pos])) {
+        pos++;
     }
 
-    res->text = start;
-    res->len  = len;
+    res->text = &parser->text[parser->pos];
+    res->len  = pos - parser->pos;
+    parser->pos = pos;
 
     return 0;
 }
@@ -222,28 +576,19 @@ int ciwic_parser_int(ciwic_parser *parser, int *res) {
     return 0;
 }
 
-int ciwic_parser_ident(ciwic_parser *parser, string *ident) {
-    char c;
-    int len = 0;
-    char *start = &parser->text[parser->pos];
+int (ciwic_parser_ident)(ciwic_parser *parser, string *ident) {
+    int start = parser->pos;
 
-    if (ciwic_parser_letter(parser, &c)) {
+    if (start >= parser->len || !ciwic_parser_is_letter(parser->text[start])) {
         return 1;
     }
 
-    len += 1;
-
-    while (!ciwic_parser_letterdigit(parser, &c)) {
-        len += 1;
-    }
+    parser->pos = ciwic_parser_spliced_token(parser, start, ciwic_scan_ident, ident);
 
-    ident->text = start;
-    ident->len  = len;
-    
     return 0;
 }
 
-int ciwic_parser_keyword(ciwic_parser *parser, const char *keyword) {
+int (ciwic_parser_keyword)(ciwic_parser *parser, const char *keyword) {
     char c;
     int pos = parser->pos;
 
@@ -259,7 +604,7 @@ int ciwic_parser_keyword(ciwic_parser *parser, const char *keyword) {
         return 0;
     }
 
-    if (ciwic_parser_is_letter(c) || ciwic_parser_is_digit(c)) {
+    if (ciwic_char_class[(unsigned char) c] & ciwic_class_ident) {
         // We have not reached the end of the identifier
         parser->pos = pos;
         return 1;
@@ -268,7 +613,7 @@ int ciwic_parser_keyword(ciwic_parser *parser, const char *keyword) {
     return 0;
 }
 
-int ciwic_parser_identifier(ciwic_parser *parser, string *identifier) {
+int (ciwic_parser_identifier)(ciwic_parser *parser, string *identifier) {
     // TODO: check for typename
 
     string ident;
@@ -277,6 +622,7 @@ int ciwic_parser_identifier(ciwic_parser *parser, string *identifier) {
     ciwic_parser_whitespace(parser);
 
     if (ciwic_parser_ident(parser, &ident)) {
+        parser->pos = pos;
         return 1;
     }
 
@@ -296,138 +642,135 @@ int ciwic_parser_identifier(ciwic_parser *parser, string *identifier) {
     return 0;
 }
 
-int ciwic_parser_punctuation(ciwic_parser *parser, const char* punct) {
+int (ciwic_parser_punctuation)(ciwic_parser *parser, const char* punct) {
     const char* punctuators[55] = {"%:%:", "%:", "%>", "<%", ":>", "<:", "##",
         "#", ",", "|=", "^=", "&=", ">>=", "<<=", "-=", "+=", "%=", "/=", "*=",
         "==", "=", "...", ";", ":", "?", "||", "&&", "|", "^", "!=", "<=",
         ">=", "<<", ">>", "<", ">", "&", "/", "!", "~", "->", "--", "++", "-",
         "+", "*", "%", "&", ".", "{", "}", "(", ")", "[", "]"};
 
-    int pos = parser->pos;
+    // Digraphs are matched as themselves and then mapped to the punctuator
+    // they stand for
+    const char* digraphs[6] = {"##", "#", "}", "{", "]", "["};
+
+    // Punctuators are at most four characters long, so read that many
+    // characters after phase 1 and 2 up front
+    char chars[4];
+    int ends[4];
+    int n = 0;
+    int start = parser->pos;
 
     ciwic_parser_whitespace(parser);
 
+    int pos = parser->pos;
+    while (n < 4 && !ciwic_parser_peek(parser, pos, &chars[n], &ends[n])) {
+        pos = ends[n];
+        n++;
+    }
+
     for (int i = 0; i < 55; i++) {
-        if (!ciwic_parser_match_string(parser, punctuators[i])) {
-            if (strcmp(punct, punctuators[i]) != 0) {
-                parser->pos = pos;
-                return 1;
-            }
+        const char *candidate = punctuators[i];
 
-            return 0;
+        if (n == 0 || candidate[0] != chars[0]) {
+            continue;
         }
-    }
 
-    return 1;
-}
+        int j = 1;
+        while (candidate[j] != 0 && j < n && candidate[j] == chars[j]) {
+            j++;
+        }
 
-int ciwic_parser_oct_digit(ciwic_parser *parser, char *digit) {
-    char c;
+        if (candidate[j] != 0) {
+            continue;
+        }
 
-    int pos = parser->pos;
+        if (i < 6) {
+            candidate = digraphs[i];
+        }
 
-    if (ciwic_parser_char(parser, &c)) {
-        pos = parser->pos;
-        return 1;
-    }
+        if (strcmp(punct, candidate) != 0) {
+            break;
+        }
 
-    if (c < '0' || c > '7') {
-        parser->pos = pos;
-        return 1;
+        parser->pos = ends[j-1];
+        return 0;
     }
 
-    *digit = c;
-    return 0;
+    parser->pos = start;
+    return 1;
 }
 
-int ciwic_parser_dec_digit(ciwic_parser *parser, char *digit) {
-    char c;
-
+int (ciwic_parser_constant_integer)(ciwic_parser *parser, ciwic_constant *constant) {
     int pos = parser->pos;
 
-    if (ciwic_parser_char(parser, &c)) {
-        pos = parser->pos;
-        return 1;
-    }
+    ciwic_parser_whitespace(parser);
 
-    if (c < '0' || c > '9') {
+    int start_pos = parser->pos;
+
+    if (start_pos >= parser->len || !ciwic_parser_is_digit(parser->text[start_pos])) {
         parser->pos = pos;
         return 1;
     }
 
-    *digit = c;
-    return 0;
-}
-
-int ciwic_parser_hex_digit(ciwic_parser *parser, char *digit) {
-    char c;
-
-    int pos = parser->pos;
+    // The whole preprocessing number has to form a valid integer constant
+    string number;
+    int number_end = ciwic_parser_spliced_token(parser, start_pos, ciwic_scan_ppnumber, &number);
+    char *text = number.text;
+    int end = number.len;
+    int i = 0;
+    int digits_class = ciwic_class_digit;
 
-    if (ciwic_parser_char(parser, &c)) {
-        pos = parser->pos;
-        return 1;
+    if (text[i] == '0' && i + 1 < end && (text[i+1] == 'x' || text[i+1] == 'X')) {
+        i += 2;
+        if (i >= end || !(ciwic_char_class[(unsigned char) text[i]] & ciwic_class_hex)) {
+            parser->pos = pos;
+            return 1;
+        }
+        digits_class = ciwic_class_hex;
+    } else if (text[i] == '0') {
+        digits_class = ciwic_class_oct;
     }
 
-    if ((c < '0' || c > '9') && (c < 'a' || c > 'f')) {
-        parser->pos = pos;
-        return 1;
+    while (i < end && ciwic_char_class[(unsigned char) text[i]] & digits_class) {
+        i++;
     }
 
-    *digit = c;
-    return 0;
-}
-
-int ciwic_parser_constant_integer(ciwic_parser *parser, ciwic_constant *constant) {
-    char c;
-
-    int pos = parser->pos;
-
-    ciwic_parser_whitespace(parser);
-
-    int start_pos = parser->pos;
+    int has_unsigned = 0;
+    if (i < end && (text[i] == 'u' || text[i] == 'U')) {
+        has_unsigned = 1;
+        i++;
+    }
 
-    if (!ciwic_parser_match_string(parser, "0x")) {
-        if (ciwic_parser_hex_digit(parser, &c)) {
-            parser->pos = pos;
-            return 1;
-        }
-        while (!ciwic_parser_hex_digit(parser, &c));
-    } else if (!ciwic_parser_match_string(parser, "0")) {
-        while (!ciwic_parser_oct_digit(parser, &c));
-    } else {
-        if (ciwic_parser_dec_digit(parser, &c)) {
-            parser->pos = pos;
-            return 1;
+    if (i < end && (text[i] == 'l' || text[i] == 'L')) {
+        // ll and LL, but not lL or Ll
+        if (i + 1 < end && text[i+1] == text[i]) {
+            i++;
         }
-        while (!ciwic_parser_dec_digit(parser, &c));
+        i++;
     }
 
-    int unsigned = !ciwic_parser_match_string(parser, "u")
-        || !ciwic_parser_match_string(parser, "U"));
-
-    !ciwic_parser_match_string(parser, "ll")
-        || !ciwic_parser_match_string(parser, "LL")
-        || !ciwic_parser_match_string(parser, "l")
-        || !ciwic_parser_match_string(parser, "L");
+    if (!has_unsigned && i < end && (text[i] == 'u' || text[i] == 'U')) {
+        i++;
+    }
 
-    if (!unsigned) {
-        !ciwic_parser_match_string(parser, "u")
-            || !ciwic_parser_match_string(parser, "U"));
+    if (i != end) {
+        parser->pos = pos;
+        return 1;
     }
 
-    int len = parser->pos - start_pos;
+    parser->pos = number_end;
 
-    char *res = malloc(len+1);
+    char *res = ciwic_parser_alloc(parser, CIWIC_ALLOC_TEXT, end+1);
 
-    memcpy(res, &parser->text[start_pos], len);
+    memcpy(res, text, end);
+    res[end] = 0;
 
     constant->type = ciwic_constant_integer;
     constant->raw_text = res;
     return 0;
 }
 
-int ciwic_parser_constant(ciwic_parser *parser, ciwic_constant *constant) {
+int (ciwic_parser_constant)(ciwic_parser *parser, ciwic_constant *constant) {
     if (!ciwic_parser_constant_integer(parser, constant)) {
         return 0;
     }
@@ -435,20 +778,28 @@ int ciwic_parser_constant(ciwic_parser *parser, ciwic_constant *constant) {
     return 1;
 }
 
-int ciwic_parser_primary_expr(ciwic_parser *parser, ciwic_expr *res) {
+int (ciwic_parser_primary_expr)(ciwic_parser *parser, ciwic_expr *res) {
+    if (ciwic_parser_limit(parser)) {
+        return 1;
+    }
+
     string identifier;
     ciwic_constant constant;
 
+    ciwic_parser_whitespace(parser);
+
     int pos = parser->pos;
 
     if (!ciwic_parser_identifier(parser, &identifier)) {
         res->type = ciwic_expr_type_identifier;
+        res->span = ciwic_parser_span(parser, pos);
         res->identifier = identifier;
         return 0;
     }
 
     if (!ciwic_parser_constant(parser, &constant)) {
         res->type = ciwic_expr_type_constant;
+        res->span = ciwic_parser_span(parser, pos);
         res->constant = constant;
         return 0;
     }
@@ -464,13 +815,20 @@ int ciwic_parser_primary_expr(ciwic_parser *parser, ciwic_expr *res) {
             parser->pos = pos;
             return 1;
         }
+        res->span = ciwic_parser_span(parser, pos);
         return 0;
     }
 
     return 1;
 }
 
-int ciwic_parser_postfix_expr(ciwic_parser *parser, ciwic_expr *inner, ciwic_expr *res) {
+int (ciwic_parser_postfix_expr)(ciwic_parser *parser, ciwic_expr *inner, ciwic_expr *res) {
+    if (ciwic_parser_limit(parser)) {
+        return 1;
+    }
+
+    ciwic_parser_whitespace(parser);
+
     int pos = parser->pos;
 
     if (inner == NULL) {
@@ -514,6 +872,7 @@ int ciwic_parser_postfix_expr(ciwic_parser *parser, ciwic_expr *inner, ciwic_exp
             }
 
             res->type = ciwic_expr_type_initialize;
+            res->span = ciwic_parser_span(parser, pos);
             res->initialize.type_name = type_name;
             res->initialize.initializer_list = initializer_list;
             return 0;
@@ -521,9 +880,20 @@ int ciwic_parser_postfix_expr(ciwic_parser *parser, ciwic_expr *inner, ciwic_exp
 
         parser->pos = pos;
         return 1;
-    } else {
+    }
+
+    // Suffixes are applied in a loop rather than by recursion so long
+    // chains of them do not grow the stack
+    ciwic_expr current = *inner;
+
+    for (;;) {
+        ciwic_expr next;
+        int deref = 0, dec = 0;
+
+        ciwic_parser_whitespace(parser);
+
         if (!ciwic_parser_punctuation(parser, "[")) {
-            ciwic_expr subscript, expr;
+            ciwic_expr expr;
             if (ciwic_parser_expr(parser, &expr)) {
                 parser->pos = pos;
                 return 1;
@@ -534,33 +904,24 @@ int ciwic_parser_postfix_expr(ciwic_parser *parser, ciwic_expr *inner, ciwic_exp
                 return 1;
             }
 
-            subscript.type = ciwic_expr_type_subscript;
-            subscript.subscript.val = malloc(sizeof(ciwic_expr));
-            *subscript.subscript.val = *inner;
-            subscript.subscript.pos = malloc(sizeof(ciwic_expr));
-            *subscript.subscript.pos = expr;
-
-            if (ciwic_parser_postfix_expr(parser, &subscript, res)) {
-                parser->pos = pos;
-                return 1;
-            }
-
-            return 0;
-        }
-
-        if (!ciwic_parser_punctuation(parser, "(")) {
-            ciwic_expr call;
+            next.type = ciwic_expr_type_subscript;
+            next.span = ciwic_parser_span(parser, current.span.start);
+            next.subscript.val = ciwic_parser_alloc(parser, ciwic_node_expr, sizeof(ciwic_expr));
+            *next.subscript.val = current;
+            next.subscript.pos = ciwic_parser_alloc(parser, ciwic_node_expr, sizeof(ciwic_expr));
+            *next.subscript.pos = expr;
+        } else if (!ciwic_parser_punctuation(parser, "(")) {
             ciwic_expr_arg_list arg_list;
 
-            call.type = ciwic_expr_type_call;
-            call.call.fun = malloc(sizeof(ciwic_expr));
-            *call.call.fun = *inner;
+            next.type = ciwic_expr_type_call;
+            next.call.fun = ciwic_parser_alloc(parser, ciwic_node_expr, sizeof(ciwic_expr));
+            *next.call.fun = current;
 
             if (!ciwic_parser_expr_arg_list(parser, &arg_list)) {
-                call.call.args = malloc(sizeof(ciwic_expr_arg_list));
-                *call.call.args = arg_list;
+                next.call.args = ciwic_parser_alloc(parser, ciwic_node_expr_arg_list, sizeof(ciwic_expr_arg_list));
+                *next.call.args = arg_list;
             } else {
-                call.call.args = NULL;
+                next.call.args = NULL;
             }
 
             if (ciwic_parser_punctuation(parser, ")")) {
@@ -568,11 +929,8 @@ int ciwic_parser_postfix_expr(ciwic_parser *parser, ciwic_expr *inner, ciwic_exp
                 return 1;
             }
 
-            return ciwic_parser_postfix_expr(parser, &call, res);
-        }
-
-        if (!ciwic_parser_punctuation(parser, ".")) {
-            ciwic_expr member;
+            next.span = ciwic_parser_span(parser, current.span.start);
+        } else if (!ciwic_parser_punctuation(parser, ".") || (deref = !ciwic_parser_punctuation(parser, "->"))) {
             string identifier;
 
             if (ciwic_parser_identifier(parser, &identifier)) {
@@ -580,76 +938,32 @@ int ciwic_parser_postfix_expr(ciwic_parser *parser, ciwic_expr *inner, ciwic_exp
                 return 1;
             }
 
-            member.type = ciwic_expr_type_member;
-            member.member.expr = malloc(sizeof(ciwic_expr));
-            *member.member.expr = *inner;
-            member.member.identifier = identifier;
-
-            if (ciwic_parser_postfix_expr(parser, &member, res)) {
-                parser->pos = pos;
-                return 1;
-            }
-            return 0;
-        }
-
-        if (!ciwic_parser_punctuation(parser, "->")) {
-            ciwic_expr member;
-            string identifier;
-
-            if (ciwic_parser_identifier(parser, &identifier)) {
-                parser->pos = pos;
-                return 1;
-            }
-
-            member.type = ciwic_expr_type_member_deref;
-            member.member.expr = malloc(sizeof(ciwic_expr));
-            *member.member.expr = *inner;
-            member.member.identifier = identifier;
-
-            if (ciwic_parser_postfix_expr(parser, &member, res)) {
-                parser->pos = pos;
-                return 1;
-            }
-            return 0;
-        }
-
-        if (!ciwic_parser_punctuation(parser, "++")) {
-            ciwic_expr expr;
-            expr.type = ciwic_expr_type_unary_op;
-            expr.unary_op.op = ciwic_expr_op_post_inc;
-            expr.unary_op.inner = malloc(sizeof(ciwic_expr));
-            *expr.unary_op.inner = *inner;
-
-            if (ciwic_parser_postfix_expr(parser, &expr, res)) {
-                parser->pos = pos;
-                return 1;
-            }
-            return 0;
-        }
-
-        if (!ciwic_parser_punctuation(parser, "--")) {
-            ciwic_expr expr;
-            expr.type = ciwic_expr_type_unary_op;
-            expr.unary_op.op = ciwic_expr_op_post_dec;
-            expr.unary_op.inner = malloc(sizeof(ciwic_expr));
-            *expr.unary_op.inner = *inner;
-
-            if (ciwic_parser_postfix_expr(parser, &expr, res)) {
-                parser->pos = pos;
-                return 1;
-            }
+            next.type = deref ? ciwic_expr_type_member_deref : ciwic_expr_type_member;
+            next.member.expr = ciwic_parser_alloc(parser, ciwic_node_expr, sizeof(ciwic_expr));
+            *next.member.expr = current;
+            next.member.identifier = identifier;
+            next.span = ciwic_parser_span(parser, current.span.start);
+        } else if (!ciwic_parser_punctuation(parser, "++") || (dec = !ciwic_parser_punctuation(parser, "--"))) {
+            next.type = ciwic_expr_type_unary_op;
+            next.unary_op.op = dec ? ciwic_expr_op_post_dec : ciwic_expr_op_post_inc;
+            next.unary_op.inner = ciwic_parser_alloc(parser, ciwic_node_expr, sizeof(ciwic_expr));
+            *next.unary_op.inner = current;
+            next.span = ciwic_parser_span(parser, current.span.start);
+        } else {
+            *res = current;
             return 0;
         }
 
-        *res = *inner;
-
-        return 0;
+        current = next;
     }
 }
 
-int ciwic_parser_expr_arg_list(ciwic_parser *parser, ciwic_expr_arg_list *res) {
+int (ciwic_parser_expr_arg_list)(ciwic_parser *parser, ciwic_expr_arg_list *res) {
+    if (ciwic_parser_limit(parser)) {
+        return 1;
+    }
+
     ciwic_expr arg;
-    ciwic_expr_arg_list rest;
 
     int pos = parser->pos;
 
@@ -658,25 +972,33 @@ int ciwic_parser_expr_arg_list(ciwic_parser *parser, ciwic_expr_arg_list *res) {
         return 1;
     }
 
-    if (ciwic_parser_punctuation(parser, ",")) {
-        res->head = arg;
-        res->rest = NULL;
-        return 0;
-    }
+    res->head = arg;
+    res->rest = NULL;
 
-    if (ciwic_parser_expr_arg_list(parser, &rest)) {
-        parser->pos = pos;
-        return 1;
-    }
+    // Arguments are collected in a loop rather than by recursion so long
+    // lists do not grow the stack
+    ciwic_expr_arg_list *last = res;
 
-    res->head = arg;
-    res->rest = malloc(sizeof(ciwic_expr_arg_list));
-    *res->rest = rest;
+    while (!ciwic_parser_punctuation(parser, ",")) {
+        if (ciwic_parser_assignment_expr(parser, &arg)) {
+            parser->pos = pos;
+            return 1;
+        }
+
+        last->rest = ciwic_parser_alloc(parser, ciwic_node_expr_arg_list, sizeof(ciwic_expr_arg_list));
+        last = last->rest;
+        last->head = arg;
+        last->rest = NULL;
+    }
 
     return 0;
 }
 
-int ciwic_parser_unary_expr(ciwic_parser *parser, ciwic_expr *res) {
+int (ciwic_parser_unary_expr)(ciwic_parser *parser, ciwic_expr *res) {
+    if (ciwic_parser_limit(parser)) {
+        return 1;
+    }
+
     const char* unary_ops_punct[8] = {"++", "--", "&", "*", "+", "-", "~", "!"};
 
     ciwic_expr_unary_op unary_ops_op[8] = {ciwic_expr_op_pre_inc,
@@ -684,18 +1006,23 @@ int ciwic_parser_unary_expr(ciwic_parser *parser, ciwic_expr *res) {
         ciwic_expr_op_pos, ciwic_expr_op_neg, ciwic_expr_op_bitneg,
         ciwic_expr_op_boolneg};
 
+    ciwic_parser_whitespace(parser);
+
     int pos = parser->pos;
 
     for (int i = 0; i < 8; i++) {
         if (!ciwic_parser_punctuation(parser, unary_ops_punct[i])) {
             ciwic_expr inner;
-            if (ciwic_parser_unary_expr(parser, &inner)) {
+            // ++ and -- take a unary expression, the other operators a cast
+            // expression
+            if (i < 2 ? ciwic_parser_unary_expr(parser, &inner) : ciwic_parser_cast_expr(parser, &inner)) {
                 parser->pos = pos;
                 return 1;
             }
             res->type = ciwic_expr_type_unary_op;
+            res->span = ciwic_parser_span(parser, pos);
             res->unary_op.op = unary_ops_op[i];
-            res->unary_op.inner = malloc(sizeof(ciwic_expr));
+            res->unary_op.inner = ciwic_parser_alloc(parser, ciwic_node_expr, sizeof(ciwic_expr));
             *res->unary_op.inner = inner;
             return 0;
         }
@@ -706,7 +1033,8 @@ int ciwic_parser_unary_expr(ciwic_parser *parser, ciwic_expr *res) {
         ciwic_type_name type_name;
         if (!ciwic_parser_unary_expr(parser, &expr)) {
             res->type = ciwic_expr_type_sizeof_expr;
-            res->sizeof_expr = malloc(sizeof(ciwic_expr));
+            res->span = ciwic_parser_span(parser, pos);
+            res->sizeof_expr = ciwic_parser_alloc(parser, ciwic_node_expr, sizeof(ciwic_expr));
             *res->sizeof_expr = expr;
             return 0;
         }
@@ -722,6 +1050,7 @@ int ciwic_parser_unary_expr(ciwic_parser *parser, ciwic_expr *res) {
             }
 
             res->type = ciwic_expr_type_sizeof_type;
+            res->span = ciwic_parser_span(parser, pos);
             res->sizeof_type = type_name;
             return 0;
         }
@@ -738,10 +1067,16 @@ int ciwic_parser_unary_expr(ciwic_parser *parser, ciwic_expr *res) {
     return 1;
 }
 
-int ciwic_parser_cast_expr(ciwic_parser *parser, ciwic_expr *res) {
+int (ciwic_parser_cast_expr)(ciwic_parser *parser, ciwic_expr *res) {
+    if (ciwic_parser_limit(parser)) {
+        return 1;
+    }
+
     ciwic_expr expr;
     ciwic_type_name type_name;
 
+    ciwic_parser_whitespace(parser);
+
     int pos = parser->pos;
 
     if (!ciwic_parser_unary_expr(parser, res)) {
@@ -763,8 +1098,9 @@ int ciwic_parser_cast_expr(ciwic_parser *parser, ciwic_expr *res) {
         }
 
         res->type = ciwic_expr_type_cast;
+        res->span = ciwic_parser_span(parser, pos);
         res->cast.type_name = type_name;
-        res->cast.expr = malloc(sizeof(ciwic_expr));
+        res->cast.expr = ciwic_parser_alloc(parser, ciwic_node_expr, sizeof(ciwic_expr));
         *res->cast.expr = expr;
 
         return 0;
@@ -774,7 +1110,11 @@ int ciwic_parser_cast_expr(ciwic_parser *parser, ciwic_expr *res) {
     return 1;
 }
 
-int ciwic_parser_binop_expr(ciwic_parser *parser, int level, ciwic_expr *inner, ciwic_expr *res) {
+int (ciwic_parser_binop_expr)(ciwic_parser *parser, int level, ciwic_expr *inner, ciwic_expr *res) {
+    if (ciwic_parser_limit(parser)) {
+        return 1;
+    }
+
     const int op_table_lens[10] = {3, 2, 2, 4, 2, 1, 1, 1, 1, 1};
 
     const char* op_table_punct[10][4] = {
@@ -812,21 +1152,22 @@ int ciwic_parser_binop_expr(ciwic_parser *parser, int level, ciwic_expr *inner,
 
     ciwic_expr expr, outer;
     ciwic_expr_binary_op op;
-    int found_op = 0;
-    
+
     if (inner == NULL) {
         if (ciwic_parser_binop_expr(parser, level, NULL, &expr)) {
             parser->pos = pos;
             return 1;
         }
+        inner = &expr;
+    }
 
-        if (ciwic_parser_binop_expr(parser, level+1, &expr, res)) {
-            parser->pos = pos;
-            return 1;
-        }
+    // The operators of a level associate to the left, so a chain of them is
+    // collected in a loop rather than by recursion
+    ciwic_expr left = *inner;
+
+    for (;;) {
+        int found_op = 0;
 
-        return 0;
-    } else {
         for (int i = 0; i < op_table_lens[level]; i++) {
             if (!ciwic_parser_punctuation(parser, op_table_punct[level][i])) {
                 op = op_table_vals[level][i];
@@ -836,37 +1177,35 @@ int ciwic_parser_binop_expr(ciwic_parser *parser, int level, ciwic_expr *inner,
         }
 
         if (!found_op) {
-            *res = *inner;
+            *res = left;
             return 0;
         }
 
-
         if (ciwic_parser_binop_expr(parser, level, NULL, &expr)) {
             parser->pos = pos;
             return 1;
         }
 
         outer.type = ciwic_expr_type_binary_op;
+        outer.span = ciwic_parser_span(parser, left.span.start);
         outer.binary_op.op = op;
-        outer.binary_op.fst = malloc(sizeof(ciwic_expr));
-        *outer.binary_op.fst = *inner;
-        outer.binary_op.snd = malloc(sizeof(ciwic_expr));
+        outer.binary_op.fst = ciwic_parser_alloc(parser, ciwic_node_expr, sizeof(ciwic_expr));
+        *outer.binary_op.fst = left;
+        outer.binary_op.snd = ciwic_parser_alloc(parser, ciwic_node_expr, sizeof(ciwic_expr));
         *outer.binary_op.snd = expr;
-
-        if (ciwic_parser_binop_expr(parser, level+1, &outer, res)) {
-            parser->pos = pos;
-            return 1;
-        }
-
-        return 0;
+        left = outer;
     }
- }
+}
 
-int ciwic_parser_logical_or_expr(ciwic_parser *parser, ciwic_expr *res) {
+int (ciwic_parser_logical_or_expr)(ciwic_parser *parser, ciwic_expr *res) {
     return ciwic_parser_binop_expr(parser, 10, NULL, res);
 }
 
-int ciwic_parser_conditional_expr(ciwic_parser *parser, ciwic_expr *cond, ciwic_expr *res) {
+int (ciwic_parser_conditional_expr)(ciwic_parser *parser, ciwic_expr *cond, ciwic_expr *res) {
+    if (ciwic_parser_limit(parser)) {
+        return 1;
+    }
+
     ciwic_expr first, left, right;
 
     int pos = parser->pos;
@@ -900,21 +1239,22 @@ int ciwic_parser_conditional_expr(ciwic_parser *parser, ciwic_expr *cond, ciwic_
     }
 
     res->type = ciwic_expr_type_conditional;
-    res->conditional.cond = malloc(sizeof(ciwic_expr));
+    res->span = ciwic_parser_span(parser, cond->span.start);
+    res->conditional.cond = ciwic_parser_alloc(parser, ciwic_node_expr, sizeof(ciwic_expr));
     *res->conditional.cond = *cond;
-    res->conditional.left = malloc(sizeof(ciwic_expr));
+    res->conditional.left = ciwic_parser_alloc(parser, ciwic_node_expr, sizeof(ciwic_expr));
     *res->conditional.left = left;
-    res->conditional.right = malloc(sizeof(ciwic_expr));
+    res->conditional.right = ciwic_parser_alloc(parser, ciwic_node_expr, sizeof(ciwic_expr));
     *res->conditional.right = right;
 
     return 0;
 }
 
-int ciwic_parser_const_expr(ciwic_parser *parser, ciwic_expr *expr) {
+int (ciwic_parser_const_expr)(ciwic_parser *parser, ciwic_expr *expr) {
     return ciwic_parser_conditional_expr(parser, NULL, expr);
 }
 
-int ciwic_parser_conditional_expr_with_unary(ciwic_parser *parser, ciwic_expr *unary, ciwic_expr *res) {
+int (ciwic_parser_conditional_expr_with_unary)(ciwic_parser *parser, ciwic_expr *unary, ciwic_expr *res) {
     ciwic_expr inner, next;
     int pos = parser->pos;
 
@@ -940,7 +1280,11 @@ int ciwic_parser_conditional_expr_with_unary(ciwic_parser *parser, ciwic_expr *u
     return 0;
 }
 
-int ciwic_parser_assignment_expr(ciwic_parser *parser, ciwic_expr *res) {
+int (ciwic_parser_assignment_expr)(ciwic_parser *parser, ciwic_expr *res) {
+    if (ciwic_parser_limit(parser)) {
+        return 1;
+    }
+
     const char* op_table_punct[11] = {"=", "*=", "/=", "%=", "+=", "-=", "<<=",
         ">>=", "&=", "^=", "|="};
 
@@ -967,10 +1311,11 @@ int ciwic_parser_assignment_expr(ciwic_parser *parser, ciwic_expr *res) {
             }
 
             res->type = ciwic_expr_type_assignment;
+            res->span = ciwic_parser_span(parser, left.span.start);
             res->assignment.op = op_table_val[i];
-            res->assignment.left = malloc(sizeof(ciwic_expr));
+            res->assignment.left = ciwic_parser_alloc(parser, ciwic_node_expr, sizeof(ciwic_expr));
             *res->assignment.left = left;
-            res->assignment.right = malloc(sizeof(ciwic_expr));
+            res->assignment.right = ciwic_parser_alloc(parser, ciwic_node_expr, sizeof(ciwic_expr));
             *res->assignment.right = right;
 
             return 0;
@@ -985,7 +1330,11 @@ int ciwic_parser_assignment_expr(ciwic_parser *parser, ciwic_expr *res) {
     return 0;
 }
 
-int ciwic_parser_expr(ciwic_parser *parser, ciwic_expr *res) {
+int (ciwic_parser_expr)(ciwic_parser *parser, ciwic_expr *res) {
+    if (ciwic_parser_limit(parser)) {
+        return 1;
+    }
+
     ciwic_expr fst, snd;
 
     int pos = parser->pos;
@@ -995,29 +1344,39 @@ int ciwic_parser_expr(ciwic_parser *parser, ciwic_expr *res) {
         return 1;
     }
 
-    if (ciwic_parser_punctuation(parser, ",")) {
-        *res = fst;
-        return 0;
-    }
+    // The comma operator nests to the right: every operand after the first
+    // replaces the last one with a comma of the two
+    ciwic_expr *last = res;
+    *last = fst;
 
-    if (ciwic_parser_expr(parser, &snd)) {
-        parser->pos = pos;
-        return 1;
+    while (!ciwic_parser_punctuation(parser, ",")) {
+        if (ciwic_parser_assignment_expr(parser, &snd)) {
+            parser->pos = pos;
+            return 1;
+        }
+
+        fst = *last;
+        last->type = ciwic_expr_type_binary_op;
+        last->span.start = fst.span.start;
+        last->binary_op.op = ciwic_expr_op_comma;
+        last->binary_op.fst = ciwic_parser_alloc(parser, ciwic_node_expr, sizeof(ciwic_expr));
+        *last->binary_op.fst = fst;
+        last->binary_op.snd = ciwic_parser_alloc(parser, ciwic_node_expr, sizeof(ciwic_expr));
+        *last->binary_op.snd = snd;
+        last = last->binary_op.snd;
     }
 
-    res->type = ciwic_expr_type_binary_op;
-    res->binary_op.op = ciwic_expr_op_comma;
-    res->binary_op.fst = malloc(sizeof(ciwic_expr));
-    *res->binary_op.fst = fst;
-    res->binary_op.snd = malloc(sizeof(ciwic_expr));
-    *res->binary_op.snd = snd;
+    // Each comma ends where the whole expression does
+    for (ciwic_expr *comma = res; comma != last; comma = comma->binary_op.snd) {
+        comma->span.end = parser->pos;
+    }
 
     return 0;
 }
 
 // Declarations
 
-int ciwic_parser_storage_class(ciwic_parser *parser, ciwic_storage_class *storage) {
+int (ciwic_parser_storage_class)(ciwic_parser *parser, ciwic_storage_class *storage) {
     if (!ciwic_parser_keyword(parser, "typedef")) {
         *storage = ciwic_specifier_typedef;
         return 0;
@@ -1042,7 +1401,7 @@ int ciwic_parser_storage_class(ciwic_parser *parser, ciwic_storage_class *storag
     return 1;
 }
 
-int ciwic_parser_type_qualifier(ciwic_parser *parser, ciwic_type_qualifier *qualifier) {
+int (ciwic_parser_type_qualifier)(ciwic_parser *parser, ciwic_type_qualifier *qualifier) {
     if (!ciwic_parser_keyword(parser, "const")) {
         *qualifier = ciwic_type_qualifier_const;
         return 0;
@@ -1059,7 +1418,7 @@ int ciwic_parser_type_qualifier(ciwic_parser *parser, ciwic_type_qualifier *qual
     return 1;
 }
 
-int ciwic_parser_function_specifier(ciwic_parser *parser, ciwic_function_specifier *specifier) {
+int (ciwic_parser_function_specifier)(ciwic_parser *parser, ciwic_function_specifier *specifier) {
     if (!ciwic_parser_keyword(parser, "inline")) {
         *specifier = ciwic_function_specifier_inline;
         return 0;
@@ -1068,7 +1427,7 @@ int ciwic_parser_function_specifier(ciwic_parser *parser, ciwic_function_specifi
     return 1;
 }
 
-int ciwic_parser_type_prim(ciwic_parser *parser, ciwic_type_prim *type) {
+int (ciwic_parser_type_prim)(ciwic_parser *parser, ciwic_type_prim *type) {
     for (int i = 0; i < 12; i++) {
         if(!ciwic_parser_keyword(parser, ciwic_prim_types_keywords[i])) {
             *type = ciwic_prim_types_list[i];
@@ -1079,16 +1438,16 @@ int ciwic_parser_type_prim(ciwic_parser *parser, ciwic_type_prim *type) {
     return 1;
 }
 
-int ciwic_parser_enum_list_inner(ciwic_parser *parser, ciwic_enum_list *list) {
+// One enumerator and its value, with rest unset
+int ciwic_parser_enumerator(ciwic_parser *parser, ciwic_enum_list *item) {
     string name;
     ciwic_expr expr;
     ciwic_expr *expr_ptr = NULL;
-    ciwic_enum_list inner;
 
     int pos = parser->pos;
 
     if (ciwic_parser_identifier(parser, &name)) {
-        return 0;
+        return 1;
     }
 
     if (!ciwic_parser_punctuation(parser, "=")) {
@@ -1096,27 +1455,40 @@ int ciwic_parser_enum_list_inner(ciwic_parser *parser, ciwic_enum_list *list) {
             parser->pos = pos;
             return 1;
         }
-        expr_ptr = malloc(sizeof(ciwic_expr));
+        expr_ptr = ciwic_parser_alloc(parser, ciwic_node_expr, sizeof(ciwic_expr));
         *expr_ptr = expr;
     }
 
-    list->name = name;
-    list->expr = expr_ptr;
+    item->name = name;
+    item->expr = expr_ptr;
+    item->rest = NULL;
+    return 0;
+}
+
+int (ciwic_parser_enum_list_inner)(ciwic_parser *parser, ciwic_enum_list *list) {
+    if (ciwic_parser_limit(parser)) {
+        return 1;
+    }
 
-    int comma_res = ciwic_parser_punctuation(parser, ",");
+    ciwic_enum_list item;
 
-    if (comma_res || ciwic_parser_enum_list_inner(parser, &inner)) {
-        list->rest = NULL;
-        return 0;
+    if (ciwic_parser_enumerator(parser, list)) {
+        return 1;
     }
 
-    list->rest = malloc(sizeof(ciwic_enum_list));
-    *list->rest = inner;
+    // A trailing comma ends the list
+    ciwic_enum_list *last = list;
+
+    while (!ciwic_parser_punctuation(parser, ",") && !ciwic_parser_enumerator(parser, &item)) {
+        last->rest = ciwic_parser_alloc(parser, ciwic_node_enum_list, sizeof(ciwic_enum_list));
+        *last->rest = item;
+        last = last->rest;
+    }
 
     return 0;
 }
 
-int ciwic_parser_enum_list(ciwic_parser *parser, ciwic_enum_list *list) {
+int (ciwic_parser_enum_list)(ciwic_parser *parser, ciwic_enum_list *list) {
     ciwic_enum_list inner;
     int pos = parser->pos;
 
@@ -1139,11 +1511,11 @@ int ciwic_parser_enum_list(ciwic_parser *parser, ciwic_enum_list *list) {
     return 0;
 }
 
-int ciwic_parser_struct_declarator_list(ciwic_parser *parser, ciwic_struct_declarator_list *list) {
+// One declarator and bit width of a struct declaration, with rest unset
+int ciwic_parser_struct_declarator(ciwic_parser *parser, ciwic_struct_declarator_list *item) {
     ciwic_declarator decl;
     ciwic_expr expr;
-    ciwic_struct_declarator_list rest;
-    int expr_res = 1, rest_res = 1;
+    int expr_res = 1;
 
     int pos = parser->pos;
 
@@ -1151,7 +1523,7 @@ int ciwic_parser_struct_declarator_list(ciwic_parser *parser, ciwic_struct_decla
 
     if (!ciwic_parser_punctuation(parser, ":")) {
         if ((expr_res = ciwic_parser_const_expr(parser, &expr))) {
-           parser->pos = pos;
+            parser->pos = pos;
             return 1;
         }
     }
@@ -1161,38 +1533,54 @@ int ciwic_parser_struct_declarator_list(ciwic_parser *parser, ciwic_struct_decla
         return 1;
     }
 
-    if (!ciwic_parser_punctuation(parser, ",")) {
-        if ((rest_res = ciwic_parser_struct_declarator_list(parser, &rest))) {
-            parser->pos = pos;
-            return 1;
-        }
-    }
-
     if (!decl_res) {
-        list->declarator = malloc(sizeof(ciwic_declarator));
-        *list->declarator = decl;
+        item->declarator = ciwic_parser_alloc(parser, ciwic_node_declarator, sizeof(ciwic_declarator));
+        *item->declarator = decl;
     } else {
-        list->declarator = NULL;
+        item->declarator = NULL;
     }
 
     if (!expr_res) {
-        list->expr = malloc(sizeof(ciwic_expr));
-        *list->expr = expr;
+        item->expr = ciwic_parser_alloc(parser, ciwic_node_expr, sizeof(ciwic_expr));
+        *item->expr = expr;
     } else {
-        list->expr = NULL;
+        item->expr = NULL;
     }
 
-    if (!rest_res) {
-        list->rest = malloc(sizeof(ciwic_struct_declarator_list));
-        *list->rest = rest;
-    } else {
-        list->rest = NULL;
+    item->rest = NULL;
+    return 0;
+}
+
+int (ciwic_parser_struct_declarator_list)(ciwic_parser *parser, ciwic_struct_declarator_list *list) {
+    if (ciwic_parser_limit(parser)) {
+        return 1;
+    }
+
+    ciwic_struct_declarator_list item;
+
+    int pos = parser->pos;
+
+    if (ciwic_parser_struct_declarator(parser, list)) {
+        return 1;
+    }
+
+    ciwic_struct_declarator_list *last = list;
+
+    while (!ciwic_parser_punctuation(parser, ",")) {
+        if (ciwic_parser_struct_declarator(parser, &item)) {
+            parser->pos = pos;
+            return 1;
+        }
+
+        last->rest = ciwic_parser_alloc(parser, ciwic_node_struct_declarator_list, sizeof(ciwic_struct_declarator_list));
+        *last->rest = item;
+        last = last->rest;
     }
 
     return 0;
 }
 
-int ciwic_parser_specifier_qualifier_list(ciwic_parser *parser, ciwic_declaration_specifiers* specifiers) {
+int (ciwic_parser_specifier_qualifier_list)(ciwic_parser *parser, ciwic_declaration_specifiers* specifiers) {
     ciwic_declaration_specifiers specs;
 
     int pos = parser->pos;
@@ -1216,10 +1604,10 @@ int ciwic_parser_specifier_qualifier_list(ciwic_parser *parser, ciwic_declaratio
     return 0;
 }
 
-int ciwic_parser_struct_list_inner(ciwic_parser *parser, ciwic_struct_list *list) {
+// One member declaration of a struct or union, with rest unset
+int ciwic_parser_struct_declaration(ciwic_parser *parser, ciwic_struct_list *item) {
     ciwic_declaration_specifiers specifiers;
     ciwic_struct_declarator_list decl_list;
-    ciwic_struct_list rest;
 
     int pos = parser->pos;
 
@@ -1238,21 +1626,35 @@ int ciwic_parser_struct_list_inner(ciwic_parser *parser, ciwic_struct_list *list
         return 1;
     }
 
-    if (ciwic_parser_struct_list_inner(parser, &rest)) {
-        list->specifiers = specifiers;
-        list->declarator_list = decl_list;
-        list->rest = NULL;
-        return 0;
+    item->specifiers = specifiers;
+    item->declarator_list = decl_list;
+    item->rest = NULL;
+    return 0;
+}
+
+int (ciwic_parser_struct_list_inner)(ciwic_parser *parser, ciwic_struct_list *list) {
+    if (ciwic_parser_limit(parser)) {
+        return 1;
+    }
+
+    ciwic_struct_list item;
+
+    if (ciwic_parser_struct_declaration(parser, list)) {
+        return 1;
+    }
+
+    ciwic_struct_list *last = list;
+
+    while (!ciwic_parser_struct_declaration(parser, &item)) {
+        last->rest = ciwic_parser_alloc(parser, ciwic_node_struct_list, sizeof(ciwic_struct_list));
+        *last->rest = item;
+        last = last->rest;
     }
 
-    list->specifiers = specifiers;
-    list->declarator_list = decl_list;
-    list->rest = malloc(sizeof(ciwic_struct_list));
-    *list->rest = rest;
     return 0;
 }
 
-int ciwic_parser_struct_list(ciwic_parser *parser, ciwic_struct_list *list) {
+int (ciwic_parser_struct_list)(ciwic_parser *parser, ciwic_struct_list *list) {
     ciwic_struct_list inner;
     int pos = parser->pos;
 
@@ -1275,7 +1677,11 @@ int ciwic_parser_struct_list(ciwic_parser *parser, ciwic_struct_list *list) {
     return 0;
 }
 
-int ciwic_parser_declaration_specifiers(ciwic_parser *parser, ciwic_declaration_specifiers* specifiers) {
+int (ciwic_parser_declaration_specifiers)(ciwic_parser *parser, ciwic_declaration_specifiers* specifiers) {
+    if (ciwic_parser_limit(parser)) {
+        return 1;
+    }
+
     ciwic_storage_class storage_class;
     ciwic_function_specifier function_specifier;
     ciwic_type_qualifier type_qualifier;
@@ -1363,11 +1769,11 @@ int ciwic_parser_declaration_specifiers(ciwic_parser *parser, ciwic_declaration_
 
         inner.type_spec = ciwic_type_spec_enum;
         if (!ident_res) {
-            inner.enum_.identifier  = malloc(sizeof(string));
+            inner.enum_.identifier  = ciwic_parser_alloc(parser, CIWIC_ALLOC_TEXT, sizeof(string));
             *inner.enum_.identifier = identifier;
         }
         if (!decl_res) {
-            inner.enum_.decl  = malloc(sizeof(ciwic_enum_list));
+            inner.enum_.decl  = ciwic_parser_alloc(parser, ciwic_node_enum_list, sizeof(ciwic_enum_list));
             *inner.enum_.decl = decl;
         }
 
@@ -1400,11 +1806,11 @@ int ciwic_parser_declaration_specifiers(ciwic_parser *parser, ciwic_declaration_
             inner.type_spec = ciwic_type_spec_union;
 
         if (!ident_res) {
-            inner.struct_or_union.identifier  = malloc(sizeof(string));
+            inner.struct_or_union.identifier  = ciwic_parser_alloc(parser, CIWIC_ALLOC_TEXT, sizeof(string));
             *inner.struct_or_union.identifier = identifier;
         }
         if (!decl_res) {
-            inner.struct_or_union.decl  = malloc(sizeof(ciwic_struct_list));
+            inner.struct_or_union.decl  = ciwic_parser_alloc(parser, ciwic_node_struct_list, sizeof(ciwic_struct_list));
             *inner.struct_or_union.decl = decl;
         }
 
@@ -1417,27 +1823,30 @@ int ciwic_parser_declaration_specifiers(ciwic_parser *parser, ciwic_declaration_
     return 1;
 }
 
-int ciwic_parser_type_qualifiers(ciwic_parser *parser, int *type_qualifiers) {
+int (ciwic_parser_type_qualifiers)(ciwic_parser *parser, int *type_qualifiers) {
+    if (ciwic_parser_limit(parser)) {
+        return 1;
+    }
+
     ciwic_type_qualifier type_qual;
 
     if (ciwic_parser_type_qualifier(parser, &type_qual)) {
         return 1;
     }
 
-    if (ciwic_parser_type_qualifiers(parser, type_qualifiers)) {
-        *type_qualifiers = type_qual;
-        return 0;
+    *type_qualifiers = type_qual;
+
+    while (!ciwic_parser_type_qualifier(parser, &type_qual)) {
+        *type_qualifiers |= type_qual;
     }
 
-    *type_qualifiers |= type_qual;
     return 0;
 }
 
-int ciwic_parser_param_list(ciwic_parser *parser, ciwic_param_list *params) {
+// One parameter declaration, with rest unset
+int ciwic_parser_param(ciwic_parser *parser, ciwic_param_list *item) {
     ciwic_declaration_specifiers specifiers;
     ciwic_declarator declarator;
-    ciwic_param_list rest;
-    int has_rest = 0;
 
     int pos = parser->pos;
 
@@ -1448,39 +1857,65 @@ int ciwic_parser_param_list(ciwic_parser *parser, ciwic_param_list *params) {
 
     int has_declarator = !ciwic_parser_declarator(parser, NULL, &declarator);
 
-    int last_pos = parser->pos;
-    if (!ciwic_parser_punctuation(parser, ",")) {
-        if (ciwic_parser_param_list(parser, &rest)) {
-            parser->pos = last_pos;
-        } else {
-            has_rest = 1;
-        }
-    }
-
-    params->specifiers = specifiers;
+    item->specifiers = specifiers;
 
     if (has_declarator) {
-        params->declarator = malloc(sizeof(ciwic_declarator));
-        *params->declarator = declarator;
+        item->declarator = ciwic_parser_alloc(parser, ciwic_node_declarator, sizeof(ciwic_declarator));
+        *item->declarator = declarator;
     } else {
-        params->declarator = NULL;
+        item->declarator = NULL;
     }
 
-    if (has_rest) {
-        params->rest = malloc(sizeof(ciwic_param_list));
-        *params->rest = rest;
-    } else {
-        params->rest = NULL;
+    item->rest = NULL;
+    return 0;
+}
+
+int (ciwic_parser_param_list)(ciwic_parser *parser, ciwic_param_list *params) {
+    if (ciwic_parser_limit(parser)) {
+        return 1;
+    }
+
+    ciwic_param_list item;
+
+    if (ciwic_parser_param(parser, params)) {
+        return 1;
+    }
+
+    ciwic_param_list *last = params;
+
+    for (;;) {
+        // The comma before an ellipsis is left to the caller
+        int last_pos = parser->pos;
+
+        if (ciwic_parser_punctuation(parser, ",")) {
+            break;
+        }
+
+        if (ciwic_parser_param(parser, &item)) {
+            parser->pos = last_pos;
+            break;
+        }
+
+        last->rest = ciwic_parser_alloc(parser, ciwic_node_param_list, sizeof(ciwic_param_list));
+        *last->rest = item;
+        last = last->rest;
     }
 
     return 0;
 }
 
-int ciwic_parser_declarator(ciwic_parser *parser, ciwic_declarator *prev, ciwic_declarator *decl) {
+int (ciwic_parser_declarator)(ciwic_parser *parser, ciwic_declarator *prev, ciwic_declarator *decl) {
+    if (ciwic_parser_limit(parser)) {
+        return 1;
+    }
+
     ciwic_declarator outer, inner;
     string ident;
 
+    ciwic_parser_whitespace(parser);
+
     int pos = parser->pos;
+    int start = prev != NULL ? prev->span.start : pos;
 
     if (prev == NULL) {
         if (!ciwic_parser_punctuation(parser, "*")) {
@@ -1491,12 +1926,13 @@ int ciwic_parser_declarator(ciwic_parser *parser, ciwic_declarator *prev, ciwic_
 
             outer.type = ciwic_declarator_pointer;
             if (has_inner) {
-                outer.inner = malloc(sizeof(ciwic_declarator));
+                outer.inner = ciwic_parser_alloc(parser, ciwic_node_declarator, sizeof(ciwic_declarator));
                 *outer.inner = inner;
             } else {
                 outer.inner = NULL;
             }
             outer.pointer_qualifiers = pointer_qualifiers;
+            outer.span = ciwic_parser_span(parser, pos);
 
             if (ciwic_parser_declarator(parser, &outer, decl)) {
                 parser->pos = pos;
@@ -1508,6 +1944,7 @@ int ciwic_parser_declarator(ciwic_parser *parser, ciwic_declarator *prev, ciwic_
 
         if (!ciwic_parser_identifier(parser, &ident)) {
             outer.type = ciwic_declarator_identifier;
+            outer.span = ciwic_parser_span(parser, pos);
             outer.inner = NULL;
             outer.ident = ident;
 
@@ -1551,8 +1988,9 @@ int ciwic_parser_declarator(ciwic_parser *parser, ciwic_declarator *prev, ciwic_
         }
 
         inner.type = ciwic_declarator_array;
+        inner.span = ciwic_parser_span(parser, start);
         if (prev != NULL) {
-            inner.inner = malloc(sizeof(ciwic_declarator));
+            inner.inner = ciwic_parser_alloc(parser, ciwic_node_declarator, sizeof(ciwic_declarator));
             *inner.inner = *prev;
         } else {
             inner.inner = NULL;
@@ -1561,7 +1999,7 @@ int ciwic_parser_declarator(ciwic_parser *parser, ciwic_declarator *prev, ciwic_
         inner.array.is_var_len = is_var_len;
         inner.array.type_qualifiers = type_qualifiers;
         if (has_expr) {
-            inner.array.expr = malloc(sizeof(ciwic_expr));
+            inner.array.expr = ciwic_parser_alloc(parser, ciwic_node_expr, sizeof(ciwic_expr));
             *inner.array.expr = expr;
         } else {
             inner.array.expr = NULL;
@@ -1582,6 +2020,9 @@ int ciwic_parser_declarator(ciwic_parser *parser, ciwic_declarator *prev, ciwic_
                 return 1;
             }
 
+            // The grouped declarator covers its parentheses
+            inner.span = ciwic_parser_span(parser, pos);
+
             if (ciwic_parser_declarator(parser, &inner, decl)) {
                 parser->pos = pos;
                 return 1;
@@ -1610,8 +2051,9 @@ int ciwic_parser_declarator(ciwic_parser *parser, ciwic_declarator *prev, ciwic_
         }
 
         inner.type = ciwic_declarator_func;
+        inner.span = ciwic_parser_span(parser, start);
         if (prev != NULL) {
-            inner.inner = malloc(sizeof(ciwic_declarator));
+            inner.inner = ciwic_parser_alloc(parser, ciwic_node_declarator, sizeof(ciwic_declarator));
             *inner.inner = *prev;
         } else {
             inner.inner = NULL;
@@ -1619,7 +2061,7 @@ int ciwic_parser_declarator(ciwic_parser *parser, ciwic_declarator *prev, ciwic_
         inner.func.has_ellipsis = has_ellipsis;
         
         if (has_params) {
-            inner.func.param_list = malloc(sizeof(ciwic_param_list));
+            inner.func.param_list = ciwic_parser_alloc(parser, ciwic_node_param_list, sizeof(ciwic_param_list));
             *inner.func.param_list = params;
         } else {
             inner.func.param_list = NULL;
@@ -1642,7 +2084,7 @@ int ciwic_parser_declarator(ciwic_parser *parser, ciwic_declarator *prev, ciwic_
     return 1;
 }
 
-int ciwic_parser_type_name(ciwic_parser *parser, ciwic_type_name *name) {
+int (ciwic_parser_type_name)(ciwic_parser *parser, ciwic_type_name *name) {
     ciwic_declaration_specifiers specifiers;
     ciwic_declarator declarator;
 
@@ -1663,7 +2105,7 @@ int ciwic_parser_type_name(ciwic_parser *parser, ciwic_type_name *name) {
     name->specifiers = specifiers;
 
     if (has_declarator) {
-        name->declarator = malloc(sizeof(ciwic_declarator));
+        name->declarator = ciwic_parser_alloc(parser, ciwic_node_declarator, sizeof(ciwic_declarator));
         *name->declarator = declarator;
     } else {
         name->declarator = NULL;
@@ -1672,8 +2114,8 @@ int ciwic_parser_type_name(ciwic_parser *parser, ciwic_type_name *name) {
     return 0;
 }
 
-int ciwic_parser_designation(ciwic_parser *parser, ciwic_designator_list *designation) {
-    ciwic_designator_list rest;
+// One [index] or .member designator, with rest unset
+int ciwic_parser_designator(ciwic_parser *parser, ciwic_designator_list *item) {
     int pos = parser->pos;
 
     if (!ciwic_parser_punctuation(parser, "[")) {
@@ -1688,15 +2130,9 @@ int ciwic_parser_designation(ciwic_parser *parser, ciwic_designator_list *design
             return 1;
         }
 
-        if (!ciwic_parser_designation(parser, &rest)) {
-            designation->rest = malloc(sizeof(ciwic_designator_list));
-            *designation->rest = rest;
-        } else {
-            designation->rest = NULL;
-        }
-
-        designation->type = ciwic_designator_expr;
-        designation->expr = expr;
+        item->type = ciwic_designator_expr;
+        item->expr = expr;
+        item->rest = NULL;
         return 0;
     }
 
@@ -1708,22 +2144,42 @@ int ciwic_parser_designation(ciwic_parser *parser, ciwic_designator_list *design
             return 1;
         }
 
-        if (!ciwic_parser_designation(parser, &rest)) {
-            designation->rest = malloc(sizeof(ciwic_designator_list));
-            *designation->rest = rest;
-        } else {
-            designation->rest = NULL;
-        }
-
-        designation->type = ciwic_designator_ident;
-        designation->ident = ident;
+        item->type = ciwic_designator_ident;
+        item->ident = ident;
+        item->rest = NULL;
         return 0;
     }
 
     return 1;
 }
 
-int ciwic_parser_initializer(ciwic_parser *parser, ciwic_initializer *init) {
+int (ciwic_parser_designation)(ciwic_parser *parser, ciwic_designator_list *designation) {
+    if (ciwic_parser_limit(parser)) {
+        return 1;
+    }
+
+    ciwic_designator_list item;
+
+    if (ciwic_parser_designator(parser, designation)) {
+        return 1;
+    }
+
+    ciwic_designator_list *last = designation;
+
+    while (!ciwic_parser_designator(parser, &item)) {
+        last->rest = ciwic_parser_alloc(parser, ciwic_node_designator_list, sizeof(ciwic_designator_list));
+        *last->rest = item;
+        last = last->rest;
+    }
+
+    return 0;
+}
+
+int (ciwic_parser_initializer)(ciwic_parser *parser, ciwic_initializer *init) {
+    if (ciwic_parser_limit(parser)) {
+        return 1;
+    }
+
     ciwic_expr expr;
     ciwic_initializer_list list;
 
@@ -1755,11 +2211,10 @@ int ciwic_parser_initializer(ciwic_parser *parser, ciwic_initializer *init) {
     return 1;
 }
 
-int ciwic_parser_initializer_list(ciwic_parser *parser, ciwic_initializer_list *list) {
+// One designation and initializer of an initializer list, with rest unset
+int ciwic_parser_initializer_item(ciwic_parser *parser, ciwic_initializer_list *item) {
     ciwic_designator_list designation;
     ciwic_initializer initializer;
-    ciwic_initializer_list rest;
-    int has_rest = 0;
 
     int pos = parser->pos;
 
@@ -1775,42 +2230,60 @@ int ciwic_parser_initializer_list(ciwic_parser *parser, ciwic_initializer_list *
         return 1;
     }
 
-    int last_pos = parser->pos;
+    item->initializer = ciwic_parser_alloc(parser, ciwic_node_initializer, sizeof(ciwic_initializer));
+    *item->initializer = initializer;
 
-    if (!ciwic_parser_punctuation(parser, ",")) {
-        has_rest = !ciwic_parser_initializer_list(parser, &rest);
-        if (!has_rest) {
-            parser->pos = last_pos;
-        }
+    if (has_designator) {
+        item->designation = ciwic_parser_alloc(parser, ciwic_node_designator_list, sizeof(ciwic_designator_list));
+        *item->designation = designation;
+    } else {
+        item->designation = NULL;
     }
 
-    list->initializer = malloc(sizeof(ciwic_initializer));
-    *list->initializer = initializer;
+    item->rest = NULL;
+    return 0;
+}
 
-    if (has_designator) {
-        list->designation = malloc(sizeof(ciwic_designator_list));
-        *list->designation = designation;
-    } else {
-        list->designation = NULL;
+int (ciwic_parser_initializer_list)(ciwic_parser *parser, ciwic_initializer_list *list) {
+    if (ciwic_parser_limit(parser)) {
+        return 1;
     }
 
-    if (has_rest) {
-        list->rest = malloc(sizeof(ciwic_initializer_list));
-        *list->rest = rest;
-    } else {
-        list->rest = NULL;
+    ciwic_initializer_list item;
+
+    if (ciwic_parser_initializer_item(parser, list)) {
+        return 1;
+    }
+
+    ciwic_initializer_list *last = list;
+
+    for (;;) {
+        // A trailing comma is left to the braces around the list
+        int last_pos = parser->pos;
+
+        if (ciwic_parser_punctuation(parser, ",")) {
+            break;
+        }
+
+        if (ciwic_parser_initializer_item(parser, &item)) {
+            parser->pos = last_pos;
+            break;
+        }
+
+        last->rest = ciwic_parser_alloc(parser, ciwic_node_initializer_list, sizeof(ciwic_initializer_list));
+        *last->rest = item;
+        last = last->rest;
     }
 
     return 0;
 }
 
-int ciwic_parser_init_declarator_list(ciwic_parser *parser, ciwic_init_declarator_list *list) {
+// One declarator and its initializer, with rest unset
+int ciwic_parser_init_declarator(ciwic_parser *parser, ciwic_init_declarator_list *item) {
     ciwic_declarator declarator;
     ciwic_initializer initializer;
-    ciwic_init_declarator_list rest;
 
     int has_initializer = 0;
-    int has_rest = 0;
 
     int pos = parser->pos;
 
@@ -1828,36 +2301,54 @@ int ciwic_parser_init_declarator_list(ciwic_parser *parser, ciwic_init_declarato
         has_initializer = !ciwic_parser_initializer(parser, &initializer);
     }
 
-    if (!ciwic_parser_punctuation(parser, ",")) {
-        if (!(has_rest = !ciwic_parser_init_declarator_list(parser, &rest))) {
-            parser->pos = pos;
-            return 1;
-        }
-    }
-
-    list->declarator = declarator;
+    item->declarator = declarator;
 
     if (has_initializer) {
-        list->initializer = malloc(sizeof(ciwic_initializer));
-        *list->initializer = initializer;
+        item->initializer = ciwic_parser_alloc(parser, ciwic_node_initializer, sizeof(ciwic_initializer));
+        *item->initializer = initializer;
     } else {
-        list->initializer = NULL;
+        item->initializer = NULL;
     }
 
-    if (has_rest) {
-        list->rest = malloc(sizeof(ciwic_init_declarator_list));
-        *list->rest = rest;
-    } else {
-        list->rest = NULL;
+    item->rest = NULL;
+    return 0;
+}
+
+int (ciwic_parser_init_declarator_list)(ciwic_parser *parser, ciwic_init_declarator_list *list) {
+    if (ciwic_parser_limit(parser)) {
+        return 1;
+    }
+
+    ciwic_init_declarator_list item;
+
+    int pos = parser->pos;
+
+    if (ciwic_parser_init_declarator(parser, list)) {
+        return 1;
+    }
+
+    ciwic_init_declarator_list *last = list;
+
+    while (!ciwic_parser_punctuation(parser, ",")) {
+        if (ciwic_parser_init_declarator(parser, &item)) {
+            parser->pos = pos;
+            return 1;
+        }
+
+        last->rest = ciwic_parser_alloc(parser, ciwic_node_init_declarator_list, sizeof(ciwic_init_declarator_list));
+        *last->rest = item;
+        last = last->rest;
     }
 
     return 0;
 }
 
-int ciwic_parser_declaration(ciwic_parser *parser, ciwic_declaration *decl) {
+int (ciwic_parser_declaration)(ciwic_parser *parser, ciwic_declaration *decl) {
     ciwic_declaration_specifiers specifiers;
     ciwic_init_declarator_list list;
 
+    ciwic_parser_whitespace(parser);
+
     int pos = parser->pos;
 
     if (ciwic_parser_declaration_specifiers(parser, &specifiers)) {
@@ -1875,13 +2366,14 @@ int ciwic_parser_declaration(ciwic_parser *parser, ciwic_declaration *decl) {
         return 1;
     }
 
+    decl->span = ciwic_parser_span(parser, pos);
     decl->specifiers = specifiers;
     decl->list = list;
     return 0;
 }
 
 
-int ciwic_parser_labeled_statement(ciwic_parser *parser, ciwic_statement *stmt) {
+int (ciwic_parser_labeled_statement)(ciwic_parser *parser, ciwic_statement *stmt) {
     string ident;
     ciwic_expr expr;
     ciwic_statement rest;
@@ -1901,7 +2393,7 @@ int ciwic_parser_labeled_statement(ciwic_parser *parser, ciwic_statement *stmt)
 
         stmt->type = ciwic_statement_label;
         stmt->labeled.label_ident = ident;
-        stmt->labeled.stmt = malloc(sizeof(ciwic_statement));
+        stmt->labeled.stmt = ciwic_parser_alloc(parser, ciwic_node_statement, sizeof(ciwic_statement));
         *stmt->labeled.stmt = rest;
         return 0;
     }
@@ -1922,7 +2414,7 @@ int ciwic_parser_labeled_statement(ciwic_parser *parser, ciwic_statement *stmt)
 
         stmt->type = ciwic_statement_case;
         stmt->labeled.case_expr = expr;
-        stmt->labeled.stmt = malloc(sizeof(ciwic_statement));
+        stmt->labeled.stmt = ciwic_parser_alloc(parser, ciwic_node_statement, sizeof(ciwic_statement));
         *stmt->labeled.stmt = rest;
         return 0;
     }
@@ -1939,7 +2431,7 @@ int ciwic_parser_labeled_statement(ciwic_parser *parser, ciwic_statement *stmt)
 
         stmt->type = ciwic_statement_default;
         stmt->labeled.case_expr = expr;
-        stmt->labeled.stmt = malloc(sizeof(ciwic_statement));
+        stmt->labeled.stmt = ciwic_parser_alloc(parser, ciwic_node_statement, sizeof(ciwic_statement));
         *stmt->labeled.stmt = rest;
         return 0;
     }
@@ -1948,9 +2440,14 @@ int ciwic_parser_labeled_statement(ciwic_parser *parser, ciwic_statement *stmt)
     return 1;
 }
 
-int ciwic_parser_block_list(ciwic_parser *parser, ciwic_statement *stmt) {
+int (ciwic_parser_block_list)(ciwic_parser *parser, ciwic_statement *stmt) {
+    if (ciwic_parser_limit(parser)) {
+        return 1;
+    }
+
     ciwic_statement head;
-    ciwic_statement rest;
+
+    ciwic_parser_whitespace(parser);
 
     int pos = parser->pos;
 
@@ -1959,25 +2456,43 @@ int ciwic_parser_block_list(ciwic_parser *parser, ciwic_statement *stmt) {
         return 1;
     }
 
-    int has_rest = !ciwic_parser_block_list(parser, &rest);
+    // Every statement after the first is the head of another block in the
+    // rest of this one. They are collected in a loop rather than by
+    // recursion so long blocks do not grow the stack.
+    ciwic_statement *last = stmt;
 
-    stmt->type = ciwic_statement_block;
+    for (;;) {
+        last->type = ciwic_statement_block;
+        last->span.start = pos;
+        last->block.head = ciwic_parser_alloc(parser, ciwic_node_statement, sizeof(ciwic_statement));
+        *last->block.head = head;
+        last->block.rest = NULL;
 
-    stmt->block.head = malloc(sizeof(ciwic_statement));
-    *stmt->block.head = head;
+        ciwic_parser_whitespace(parser);
+        pos = parser->pos;
 
-    if (has_rest) {
-        stmt->block.rest = malloc(sizeof(ciwic_statement));
-        *stmt->block.rest = rest;
-    } else {
-        stmt->block.rest = NULL;
+        if (ciwic_parser_statement(parser, &head)) {
+            parser->pos = pos;
+            break;
+        }
+
+        last->block.rest = ciwic_parser_alloc(parser, ciwic_node_statement, sizeof(ciwic_statement));
+        last = last->block.rest;
+    }
+
+    // Each block ends where the whole list does
+    for (ciwic_statement *block = stmt; block != NULL; block = block->block.rest) {
+        block->span.end = parser->pos;
     }
 
     return 0;
 }
 
-int ciwic_parser_compound_statement(ciwic_parser *parser, ciwic_statement *stmt) {
+int (ciwic_parser_compound_statement)(ciwic_parser *parser, ciwic_statement *stmt) {
     ciwic_statement inner;
+
+    ciwic_parser_whitespace(parser);
+
     int pos = parser->pos;
 
     if (ciwic_parser_punctuation(parser, "{")) {
@@ -1995,10 +2510,11 @@ int ciwic_parser_compound_statement(ciwic_parser *parser, ciwic_statement *stmt)
     }
 
     *stmt = inner;
+    stmt->span = ciwic_parser_span(parser, pos);
     return 0;
 }
 
-int ciwic_parser_expr_statement(ciwic_parser *parser, ciwic_statement *stmt) {
+int (ciwic_parser_expr_statement)(ciwic_parser *parser, ciwic_statement *stmt) {
     ciwic_expr expr;
 
     int pos = parser->pos;
@@ -2018,7 +2534,7 @@ int ciwic_parser_expr_statement(ciwic_parser *parser, ciwic_statement *stmt) {
     return 0;
 }
 
-int ciwic_parser_selection_statement(ciwic_parser *parser, ciwic_statement *stmt) {
+int (ciwic_parser_selection_statement)(ciwic_parser *parser, ciwic_statement *stmt) {
     ciwic_expr expr;
     ciwic_statement fst_stmt, else_stmt;
 
@@ -2054,11 +2570,11 @@ int ciwic_parser_selection_statement(ciwic_parser *parser, ciwic_statement *stmt
 
         stmt->type = ciwic_statement_if;
         stmt->if_stmt.expr = expr;
-        stmt->if_stmt.if_then = malloc(sizeof(ciwic_statement));
+        stmt->if_stmt.if_then = ciwic_parser_alloc(parser, ciwic_node_statement, sizeof(ciwic_statement));
         *stmt->if_stmt.if_then = fst_stmt;
 
         if (has_else) {
-            stmt->if_stmt.if_else = malloc(sizeof(ciwic_statement));
+            stmt->if_stmt.if_else = ciwic_parser_alloc(parser, ciwic_node_statement, sizeof(ciwic_statement));
             *stmt->if_stmt.if_else = else_stmt;
         } else {
             stmt->if_stmt.if_else = NULL;
@@ -2090,7 +2606,7 @@ int ciwic_parser_selection_statement(ciwic_parser *parser, ciwic_statement *stmt
 
         stmt->type = ciwic_statement_switch;
         stmt->switch_stmt.expr = expr;
-        stmt->switch_stmt.stmt = malloc(sizeof(ciwic_statement));
+        stmt->switch_stmt.stmt = ciwic_parser_alloc(parser, ciwic_node_statement, sizeof(ciwic_statement));
         *stmt->switch_stmt.stmt = fst_stmt;
         return 0;
     }
@@ -2099,7 +2615,7 @@ int ciwic_parser_selection_statement(ciwic_parser *parser, ciwic_statement *stmt
     return 1;
 }
 
-int ciwic_parser_iteration_statement(ciwic_parser *parser, ciwic_statement *stmt) {
+int (ciwic_parser_iteration_statement)(ciwic_parser *parser, ciwic_statement *stmt) {
     ciwic_declaration pre_decl;
     ciwic_expr expr, pre_expr, test_expr, post_expr;
     ciwic_statement inner_stmt;
@@ -2129,7 +2645,7 @@ int ciwic_parser_iteration_statement(ciwic_parser *parser, ciwic_statement *stmt
 
         stmt->type = ciwic_statement_while;
         stmt->while_stmt.expr = expr;
-        stmt->while_stmt.stmt = malloc(sizeof(ciwic_statement));
+        stmt->while_stmt.stmt = ciwic_parser_alloc(parser, ciwic_node_statement, sizeof(ciwic_statement));
         *stmt->while_stmt.stmt = inner_stmt;
 
         return 0;
@@ -2168,7 +2684,7 @@ int ciwic_parser_iteration_statement(ciwic_parser *parser, ciwic_statement *stmt
 
         stmt->type = ciwic_statement_do_while;
         stmt->while_stmt.expr = expr;
-        stmt->while_stmt.stmt = malloc(sizeof(ciwic_statement));
+        stmt->while_stmt.stmt = ciwic_parser_alloc(parser, ciwic_node_statement, sizeof(ciwic_statement));
         *stmt->while_stmt.stmt = inner_stmt;
 
         return 0;
@@ -2182,7 +2698,7 @@ int ciwic_parser_iteration_statement(ciwic_parser *parser, ciwic_statement *stmt
 
         int has_pre_decl = !ciwic_parser_declaration(parser, &pre_decl);
 
-        int has_pre_expr = !has_pre_decl && ciwic_parser_expr(parser, &pre_expr);
+        int has_pre_expr = !has_pre_decl && !ciwic_parser_expr(parser, &pre_expr);
 
         if (!has_pre_decl && ciwic_parser_punctuation(parser, ";")) {
             parser->pos = pos;
@@ -2211,34 +2727,34 @@ int ciwic_parser_iteration_statement(ciwic_parser *parser, ciwic_statement *stmt
         stmt->type = ciwic_statement_for;
 
         if (has_pre_decl) {
-            stmt->for_stmt.pre_decl = malloc(sizeof(ciwic_declaration));
+            stmt->for_stmt.pre_decl = ciwic_parser_alloc(parser, ciwic_node_declaration, sizeof(ciwic_declaration));
             *stmt->for_stmt.pre_decl = pre_decl;
         } else {
             stmt->for_stmt.pre_decl = NULL;
         }
 
         if (has_pre_expr) {
-            stmt->for_stmt.pre_expr = malloc(sizeof(ciwic_expr));
+            stmt->for_stmt.pre_expr = ciwic_parser_alloc(parser, ciwic_node_expr, sizeof(ciwic_expr));
             *stmt->for_stmt.pre_expr = pre_expr;
         } else {
             stmt->for_stmt.pre_expr = NULL;
         }
 
         if (has_test_expr) {
-            stmt->for_stmt.test_expr = malloc(sizeof(ciwic_expr));
+            stmt->for_stmt.test_expr = ciwic_parser_alloc(parser, ciwic_node_expr, sizeof(ciwic_expr));
             *stmt->for_stmt.test_expr = test_expr;
         } else {
             stmt->for_stmt.test_expr = NULL;
         }
 
         if (has_post_expr) {
-            stmt->for_stmt.post_expr = malloc(sizeof(ciwic_expr));
+            stmt->for_stmt.post_expr = ciwic_parser_alloc(parser, ciwic_node_expr, sizeof(ciwic_expr));
             *stmt->for_stmt.post_expr = post_expr;
         } else {
             stmt->for_stmt.post_expr = NULL;
         }
 
-        stmt->for_stmt.stmt = malloc(sizeof(ciwic_statement));
+        stmt->for_stmt.stmt = ciwic_parser_alloc(parser, ciwic_node_statement, sizeof(ciwic_statement));
         *stmt->for_stmt.stmt = inner_stmt;
 
         return 0;
@@ -2248,7 +2764,7 @@ int ciwic_parser_iteration_statement(ciwic_parser *parser, ciwic_statement *stmt
     return 1;
 }
 
-int ciwic_parser_jump_statement(ciwic_parser *parser, ciwic_statement *stmt) {
+int (ciwic_parser_jump_statement)(ciwic_parser *parser, ciwic_statement *stmt) {
     int pos = parser->pos;
 
     if (!ciwic_parser_keyword(parser, "goto")) {
@@ -2301,7 +2817,7 @@ int ciwic_parser_jump_statement(ciwic_parser *parser, ciwic_statement *stmt) {
         stmt->type = ciwic_statement_return;
 
         if (has_expr) {
-            stmt->return_expr = malloc(sizeof(ciwic_expr));
+            stmt->return_expr = ciwic_parser_alloc(parser, ciwic_node_expr, sizeof(ciwic_expr));
             *stmt->return_expr = expr;
         } else {
             stmt->return_expr = NULL;
@@ -2314,36 +2830,53 @@ int ciwic_parser_jump_statement(ciwic_parser *parser, ciwic_statement *stmt) {
     return 1;
 }
 
-int ciwic_parser_statement(ciwic_parser *parser, ciwic_statement *stmt) {
+int (ciwic_parser_statement)(ciwic_parser *parser, ciwic_statement *stmt) {
+    if (ciwic_parser_limit(parser)) {
+        return 1;
+    }
+
+    ciwic_parser_whitespace(parser);
+
+    int pos = parser->pos;
+
     if (!ciwic_parser_labeled_statement(parser, stmt)) {
+        stmt->span = ciwic_parser_span(parser, pos);
         return 0;
     }
     if (!ciwic_parser_compound_statement(parser, stmt)) {
         return 0;
     }
     if (!ciwic_parser_expr_statement(parser, stmt)) {
+        stmt->span = ciwic_parser_span(parser, pos);
         return 0;
     }
     if (!ciwic_parser_selection_statement(parser, stmt)) {
+        stmt->span = ciwic_parser_span(parser, pos);
         return 0;
     }
     if (!ciwic_parser_iteration_statement(parser, stmt)) {
+        stmt->span = ciwic_parser_span(parser, pos);
         return 0;
     }
     if (!ciwic_parser_jump_statement(parser, stmt)) {
+        stmt->span = ciwic_parser_span(parser, pos);
         return 0;
     }
     if (!ciwic_parser_punctuation(parser, ";")) {
         stmt->type = ciwic_statement_null;
+        stmt->span = ciwic_parser_span(parser, pos);
         return 0;
     }
 
     return 1;
 }
 
-int ciwic_parser_declaration_list(ciwic_parser *parser, ciwic_declaration_list *list) {
+int (ciwic_parser_declaration_list)(ciwic_parser *parser, ciwic_declaration_list *list) {
+    if (ciwic_parser_limit(parser)) {
+        return 1;
+    }
+
     ciwic_declaration decl;
-    ciwic_declaration_list rest;
 
     int pos = parser->pos;
 
@@ -2352,21 +2885,22 @@ int ciwic_parser_declaration_list(ciwic_parser *parser, ciwic_declaration_list *
         return 1;
     }
 
-    int has_rest = !ciwic_parser_declaration_list(parser, &rest);
-
     list->head = decl;
+    list->rest = NULL;
 
-    if (has_rest) {
-        list->rest = malloc(sizeof(ciwic_declaration_list));
-        *list->rest = rest;
-    } else {
-        list->rest = NULL;
+    ciwic_declaration_list *last = list;
+
+    while (!ciwic_parser_declaration(parser, &decl)) {
+        last->rest = ciwic_parser_alloc(parser, ciwic_node_declaration_list, sizeof(ciwic_declaration_list));
+        last = last->rest;
+        last->head = decl;
+        last->rest = NULL;
     }
 
     return 0;
 }
 
-int ciwic_parser_func_definition(ciwic_parser *parser, ciwic_func_definition *def) {
+int (ciwic_parser_func_definition)(ciwic_parser *parser, ciwic_func_definition *def) {
     ciwic_declaration_specifiers specifiers;
     ciwic_declarator declarator;
     ciwic_declaration_list decl_list;
@@ -2395,7 +2929,7 @@ int ciwic_parser_func_definition(ciwic_parser *parser, ciwic_func_definition *de
     def->declarator = declarator;
 
     if (has_decl_list) {
-        def->decl_list = malloc(sizeof(ciwic_declaration_list));
+        def->decl_list = ciwic_parser_alloc(parser, ciwic_node_declaration_list, sizeof(ciwic_declaration_list));
         *def->decl_list = decl_list;
     } else {
         def->decl_list = NULL;
@@ -2406,45 +2940,79 @@ int ciwic_parser_func_definition(ciwic_parser *parser, ciwic_func_definition *de
     return 0;
 }
 
-int ciwic_parser_translation_unit(ciwic_parser *parser, ciwic_translation_unit *translation_unit) {
+int (ciwic_parser_external_declaration)(ciwic_parser *parser, ciwic_translation_unit *def) {
     ciwic_func_definition func;
     ciwic_declaration decl;
-    ciwic_translation_unit rest;
+
+    ciwic_parser_whitespace(parser);
 
     int pos = parser->pos;
 
     if (!ciwic_parser_func_definition(parser, &func)) {
-        int has_rest = !ciwic_parser_translation_unit(parser, &rest);
+        def->def_type = ciwic_definition_func;
+        def->span = ciwic_parser_span(parser, pos);
+        def->func = func;
+        def->rest = NULL;
+        return 0;
+    }
 
-        translation_unit->def_type = ciwic_definition_func;
-        translation_unit->func = func;
+    if (!ciwic_parser_declaration(parser, &decl)) {
+        def->def_type = ciwic_definition_decl;
+        def->span = ciwic_parser_span(parser, pos);
+        def->decl = decl;
+        def->rest = NULL;
+        return 0;
+    }
 
-        if (has_rest) {
-            translation_unit->rest = malloc(sizeof(ciwic_translation_unit));
-            *translation_unit->rest = rest;
-        } else {
-            translation_unit->rest = NULL;
-        }
+    parser->pos = pos;
+    return parser->stop != ciwic_parser_running ? CIWIC_PARSER_STOPPED : 1;
+}
 
-        return 0;
+// Parses one top-level definition, recording it if the parser is traced
+int ciwic_parser_traced_declaration(ciwic_parser *parser, ciwic_translation_unit *def) {
+    if (parser->trace == NULL) {
+        return ciwic_parser_external_declaration(parser, def);
     }
 
-    if (!ciwic_parser_declaration(parser, &decl)) {
-        int has_rest = !ciwic_parser_translation_unit(parser, &rest);
+    int pos = parser->pos;
+    ciwic_parser_whitespace(parser);
+    int start = parser->pos;
+    uint64_t time = ciwic_trace_now();
 
-        translation_unit->def_type = ciwic_definition_decl;
-        translation_unit->decl = decl;
+    int res = ciwic_parser_external_declaration(parser, def);
+    if (res) {
+        parser->pos = pos;
+        return res;
+    }
 
-        if (has_rest) {
-            translation_unit->rest = malloc(sizeof(ciwic_translation_unit));
-            *translation_unit->rest = rest;
-        } else {
-            translation_unit->rest = NULL;
-        }
+    ciwic_trace_event_add(parser->trace, "definition", time, ciwic_trace_now(), NULL, start);
+    return 0;
+}
 
-        return 0;
+int (ciwic_parser_translation_unit)(ciwic_parser *parser, ciwic_translation_unit *translation_unit) {
+    ciwic_translation_unit def;
+
+    int pos = parser->pos;
+    int res = ciwic_parser_traced_declaration(parser, translation_unit);
+
+    if (res) {
+        parser->pos = pos;
+        return res;
     }
 
-    parser->pos = pos;
-    return 1;
+    // Definitions are collected in a loop rather than by recursion so long
+    // files do not grow the stack
+    ciwic_translation_unit *last = translation_unit;
+
+    while (!ciwic_parser_traced_declaration(parser, &def)) {
+        last->rest = ciwic_parser_alloc(parser, ciwic_node_translation_unit, sizeof(ciwic_translation_unit));
+        *last->rest = def;
+        last = last->rest;
+    }
+
+    if (parser->stop != ciwic_parser_running) {
+        return CIWIC_PARSER_STOPPED;
+    }
+
+    return 0;
 }
@@ -3,23 +3,66 @@
 #include <parselib.h>
 #include <ast.h>
 
+// Bumped whenever the parser produces a different AST for the same input
+#define CIWIC_PARSER_VERSION 5
+
+// Returned by ciwic_parser_translation_unit and
+// ciwic_parser_external_declaration when parser->limits stopped the parse
+#define CIWIC_PARSER_STOPPED 2
+
+// Default for limits.max_stack when the stack size is not limited
+#define CIWIC_PARSER_MAX_STACK (4 << 20)
+
+// Stack kept free for the caller of the parser and the frames between two
+// checks of the limits
+#define CIWIC_PARSER_STACK_RESERVE (256 << 10)
+
 extern const char* ciwic_prim_types_keywords[12];
 extern const ciwic_type_prim ciwic_prim_types_list[12];
 
 ciwic_parser ciwic_parser_new(char *buf, int len);
+
+// Starts parsing buf, keeping the flags and every buffer the parser has
+// allocated. Any AST parsed before is invalid afterwards.
+void ciwic_parser_reset(ciwic_parser *parser, char *buf, int len);
+
+// Frees the parser's buffers, including the AST it has parsed
+void ciwic_parser_free(ciwic_parser *parser);
+
+// Allocation kind of strings copied out of the source, after the node kinds
+#define CIWIC_ALLOC_TEXT ciwic_node_kind_count
+
+// No step budget, and the stack the process may grow to (RLIMIT_STACK) less
+// CIWIC_PARSER_STACK_RESERVE, or CIWIC_PARSER_MAX_STACK if that is not
+// limited. A thread with a smaller stack should lower limits.max_stack.
+ciwic_parser_limits ciwic_parser_default_limits(void);
+
+// Counts a step of the parse and checks the limits. Returns 1 once the
+// parse has been stopped.
+int ciwic_parser_limit(ciwic_parser *parser);
+const char *ciwic_parser_stop_message(ciwic_parser_stop stop);
+
+// Allocates AST memory for a node of the given ciwic_node_kind, or text
+void *ciwic_parser_alloc(ciwic_parser *parser, int kind, size_t size);
+int ciwic_parser_location(ciwic_parser *parser, int offset, ciwic_location *loc);
+ciwic_span ciwic_parser_span(ciwic_parser *parser, int start);
 int ciwic_parser_char(ciwic_parser *parser, char *res);
+int ciwic_parser_whitespace(ciwic_parser *parser);
 int ciwic_parser_int(ciwic_parser *parser, int *res);
 int ciwic_parser_expr_arg_list(ciwic_parser *parser, ciwic_expr_arg_list *res);
+int ciwic_parser_cast_expr(ciwic_parser *parser, ciwic_expr *res);
 int ciwic_parser_assignment_expr(ciwic_parser *parser, ciwic_expr *res);
 int ciwic_parser_expr(ciwic_parser *parser, ciwic_expr *res);
 
 int ciwic_parser_declaration(ciwic_parser *parser, ciwic_declaration *decl);
 int ciwic_parser_declaration_specifiers(ciwic_parser *parser, ciwic_declaration_specifiers *specifiers);
 int ciwic_parser_declarator(ciwic_parser *parser, ciwic_declarator *prev, ciwic_declarator *decl);
+int ciwic_parser_declaration_list(ciwic_parser *parser, ciwic_declaration_list *list);
 
 int ciwic_parser_initializer_list(ciwic_parser *parser, ciwic_initializer_list *list);
 int ciwic_parser_type_name(ciwic_parser *parser, ciwic_type_name *name);
 
 int ciwic_parser_statement(ciwic_parser *parser, ciwic_statement *name);
 
+int ciwic_parser_external_declaration(ciwic_parser *parser, ciwic_translation_unit *def);
 int ciwic_parser_translation_unit(ciwic_parser *parser, ciwic_translation_unit *translation_unit);
@@ -0,0 +1,183 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <profile.h>
+
+const char *ciwic_rule_names[ciwic_rule_count] = {
+#define CIWIC_PROFILE_RULE_NAME(name) #name,
+    CIWIC_PROFILE_RULES(CIWIC_PROFILE_RULE_NAME)
+#undef CIWIC_PROFILE_RULE_NAME
+};
+
+void ciwic_profile_init(ciwic_profile *profile) {
+    memset(profile, 0, sizeof(ciwic_profile));
+}
+
+void ciwic_profile_alloc(ciwic_profile *profile, int kind, size_t size) {
+    profile->allocs[kind].count++;
+    profile->allocs[kind].bytes += size;
+    profile->allocated += size;
+    profile->current += size;
+    if (profile->current > profile->peak) {
+        profile->peak = profile->current;
+    }
+}
+
+void ciwic_profile_enter(ciwic_parser *parser, ciwic_rule rule, ciwic_profile_frame *frame) {
+    ciwic_profile *profile = parser->profile;
+    if (profile == NULL) {
+        return;
+    }
+
+    profile->rules[rule].calls++;
+    frame->pos = parser->pos;
+    frame->furthest = profile->furthest;
+    profile->furthest = parser->pos;
+    frame->allocated = profile->allocated;
+    frame->wasted = profile->wasted;
+}
+
+void ciwic_profile_exit(ciwic_parser *parser, ciwic_rule rule, ciwic_profile_frame *frame, int res) {
+    ciwic_profile *profile = parser->profile;
+    if (profile == NULL) {
+        return;
+    }
+
+    int furthest = profile->furthest > parser->pos ? profile->furthest : parser->pos;
+
+    if (res == 0) {
+        profile->rules[rule].successes++;
+    } else {
+        profile->rules[rule].failures++;
+        profile->rules[rule].backtracked += furthest - frame->pos;
+        // Everything allocated since the call started is unreachable now,
+        // including what failed calls within it had already counted
+        profile->wasted = frame->wasted + (profile->allocated - frame->allocated);
+    }
+
+    profile->furthest = frame->furthest > furthest ? frame->furthest : furthest;
+}
+
+void ciwic_profile_column(ciwic_sink *sink, const char *text, int width) {
+    int len = strlen(text);
+    if (len < width) {
+        ciwic_sink_indent(sink, width - len);
+    }
+    ciwic_sink_str(sink, text);
+}
+
+void ciwic_profile_number(ciwic_sink *sink, uint64_t value, int width) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%llu", (unsigned long long) value);
+    ciwic_profile_column(sink, buf, width);
+}
+
+// Writes the allocations of every kind, largest first
+void ciwic_profile_report_allocs(ciwic_profile *profile, ciwic_sink *sink) {
+    int order[CIWIC_ALLOC_KINDS];
+    int len = 0;
+
+    for (int i = 0; i < CIWIC_ALLOC_KINDS; i++) {
+        if (profile->allocs[i].count > 0) {
+            order[len++] = i;
+        }
+    }
+
+    for (int i = 1; i < len; i++) {
+        int kind = order[i];
+        int j = i;
+        while (j > 0 && profile->allocs[order[j-1]].bytes < profile->allocs[kind].bytes) {
+            order[j] = order[j-1];
+            j--;
+        }
+        order[j] = kind;
+    }
+
+    ciwic_sink_str(sink, "kind");
+    ciwic_sink_indent(sink, 24);
+    ciwic_profile_column(sink, "count", 13);
+    ciwic_profile_column(sink, "bytes", 13);
+    ciwic_sink_char(sink, '\n');
+
+    for (int i = 0; i < len; i++) {
+        const char *name = order[i] < ciwic_node_kind_count ? ciwic_node_kind_names[order[i]] : "text";
+        ciwic_sink_str(sink, name);
+        ciwic_sink_indent(sink, 28 - (int) strlen(name));
+        ciwic_profile_number(sink, profile->allocs[order[i]].count, 13);
+        ciwic_profile_number(sink, profile->allocs[order[i]].bytes, 13);
+        ciwic_sink_char(sink, '\n');
+    }
+
+    ciwic_sink_str(sink, "allocated ");
+    ciwic_sink_int(sink, profile->allocated);
+    ciwic_sink_str(sink, " bytes, largest parse ");
+    ciwic_sink_int(sink, profile->peak);
+    ciwic_sink_str(sink, " bytes\n");
+
+#ifdef CIWIC_PROFILE
+    ciwic_sink_str(sink, "wasted by failed rules ");
+    ciwic_sink_int(sink, profile->wasted);
+    ciwic_sink_str(sink, " bytes\n");
+#endif
+}
+
+void ciwic_profile_report(ciwic_profile *profile, ciwic_sink *sink) {
+    int order[ciwic_rule_count];
+    int len = 0;
+
+    for (int i = 0; i < ciwic_rule_count; i++) {
+        if (profile->rules[i].calls > 0) {
+            order[len++] = i;
+        }
+    }
+
+    // Insertion sort by backtracked bytes, then calls
+    for (int i = 1; i < len; i++) {
+        int rule = order[i];
+        ciwic_rule_stats *stats = &profile->rules[rule];
+        int j = i;
+        while (j > 0) {
+            ciwic_rule_stats *prev = &profile->rules[order[j-1]];
+            if (prev->backtracked > stats->backtracked
+                    || (prev->backtracked == stats->backtracked && prev->calls >= stats->calls)) {
+                break;
+            }
+            order[j] = order[j-1];
+            j--;
+        }
+        order[j] = rule;
+    }
+
+    if (len > 0) {
+        char buf[32];
+
+        ciwic_sink_str(sink, "rule");
+        ciwic_sink_indent(sink, 24);
+        ciwic_profile_column(sink, "calls", 13);
+        ciwic_profile_column(sink, "succeeded", 13);
+        ciwic_profile_column(sink, "failed", 13);
+        ciwic_profile_column(sink, "backtracked", 13);
+        ciwic_profile_column(sink, "per byte", 10);
+        ciwic_sink_char(sink, '\n');
+
+        for (int i = 0; i < len; i++) {
+            ciwic_rule_stats *stats = &profile->rules[order[i]];
+
+            ciwic_sink_str(sink, ciwic_rule_names[order[i]]);
+            ciwic_sink_indent(sink, 28 - (int) strlen(ciwic_rule_names[order[i]]));
+
+            ciwic_profile_number(sink, stats->calls, 13);
+            ciwic_profile_number(sink, stats->successes, 13);
+            ciwic_profile_number(sink, stats->failures, 13);
+            ciwic_profile_number(sink, stats->backtracked, 13);
+            snprintf(buf, sizeof(buf), "%.2f", profile->bytes ? (double) stats->backtracked / profile->bytes : 0.0);
+            ciwic_profile_column(sink, buf, 10);
+            ciwic_sink_char(sink, '\n');
+        }
+
+        ciwic_sink_char(sink, '\n');
+    }
+
+    ciwic_profile_report_allocs(profile, sink);
+}
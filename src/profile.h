@@ -0,0 +1,125 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <ast.h>
+#include <parselib.h>
+#include <sink.h>
+
+// Rule profiling
+//
+// When parser.c is built with CIWIC_PROFILE (make profile) every call of a
+// grammar rule is counted in the ciwic_profile of its parser, if it has one.
+// A failed call also adds the bytes it and the rules it called had consumed
+// before the parser backtracked, which is work that will be done again by
+// whatever is tried next.
+//
+// In any build a parser with a profile also accounts for the AST memory it
+// allocates, by node kind and per parse. The bytes allocated by failed rule
+// calls, which are left unused in the arena, need the profiling build.
+
+#define CIWIC_PROFILE_RULES(X) \
+    X(ident) \
+    X(keyword) \
+    X(identifier) \
+    X(punctuation) \
+    X(constant_integer) \
+    X(constant) \
+    X(primary_expr) \
+    X(postfix_expr) \
+    X(expr_arg_list) \
+    X(unary_expr) \
+    X(cast_expr) \
+    X(binop_expr) \
+    X(logical_or_expr) \
+    X(conditional_expr) \
+    X(const_expr) \
+    X(conditional_expr_with_unary) \
+    X(assignment_expr) \
+    X(expr) \
+    X(storage_class) \
+    X(type_qualifier) \
+    X(function_specifier) \
+    X(type_prim) \
+    X(enum_list_inner) \
+    X(enum_list) \
+    X(struct_declarator_list) \
+    X(specifier_qualifier_list) \
+    X(struct_list_inner) \
+    X(struct_list) \
+    X(declaration_specifiers) \
+    X(type_qualifiers) \
+    X(param_list) \
+    X(declarator) \
+    X(type_name) \
+    X(designation) \
+    X(initializer) \
+    X(initializer_list) \
+    X(init_declarator_list) \
+    X(declaration) \
+    X(labeled_statement) \
+    X(block_list) \
+    X(compound_statement) \
+    X(expr_statement) \
+    X(selection_statement) \
+    X(iteration_statement) \
+    X(jump_statement) \
+    X(statement) \
+    X(declaration_list) \
+    X(func_definition) \
+    X(external_declaration) \
+    X(translation_unit)
+
+typedef enum {
+#define CIWIC_PROFILE_RULE_ENUM(name) ciwic_rule_##name,
+    CIWIC_PROFILE_RULES(CIWIC_PROFILE_RULE_ENUM)
+#undef CIWIC_PROFILE_RULE_ENUM
+    ciwic_rule_count,
+} ciwic_rule;
+
+extern const char *ciwic_rule_names[ciwic_rule_count];
+
+typedef struct {
+    uint64_t calls;
+    uint64_t successes;
+    uint64_t failures;
+    uint64_t backtracked; // Bytes consumed by failed calls
+} ciwic_rule_stats;
+
+// Node kinds and CIWIC_ALLOC_TEXT
+#define CIWIC_ALLOC_KINDS (ciwic_node_kind_count + 1)
+
+typedef struct {
+    uint64_t count;
+    uint64_t bytes;
+} ciwic_alloc_stats;
+
+struct ciwic_profile {
+    ciwic_rule_stats rules[ciwic_rule_count];
+    uint64_t bytes; // Input bytes parsed, added by the caller for the report
+    int furthest; // Furthest position reached within the current call
+
+    ciwic_alloc_stats allocs[CIWIC_ALLOC_KINDS];
+    uint64_t allocated; // Bytes of AST allocated in total
+    uint64_t wasted; // Part of allocated that was abandoned by failed calls
+    uint64_t current; // Bytes allocated since the parser was last reset
+    uint64_t peak; // Largest value of current
+};
+
+typedef struct {
+    int pos;
+    int furthest;
+    uint64_t allocated;
+    uint64_t wasted;
+} ciwic_profile_frame;
+
+void ciwic_profile_init(ciwic_profile *profile);
+
+void ciwic_profile_alloc(ciwic_profile *profile, int kind, size_t size);
+
+void ciwic_profile_enter(ciwic_parser *parser, ciwic_rule rule, ciwic_profile_frame *frame);
+void ciwic_profile_exit(ciwic_parser *parser, ciwic_rule rule, ciwic_profile_frame *frame, int res);
+
+// Writes a table of every rule that was called, ranked by backtracked bytes,
+// and the memory allocated for each kind of node
+void ciwic_profile_report(ciwic_profile *profile, ciwic_sink *sink);
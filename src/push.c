@@ -0,0 +1,276 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include <push.h>
+#include <parser.h>
+#include <scan.h>
+
+void ciwic_push_parser_init(ciwic_push_parser *push, ciwic_push_callback callback, void *data) {
+    push->buf = NULL;
+    push->len = 0;
+    push->cap = 0;
+    push->offset = 0;
+    push->flags = ciwic_parser_trigraphs;
+    push->failed = 0;
+    push->scan_pos = 0;
+    push->depth = 0;
+    push->in_line_comment = 0;
+    push->in_block_comment = 0;
+    push->last = 0;
+    push->body = 0;
+    push->wait = 0;
+    push->callback = callback;
+    push->data = data;
+    push->parser = ciwic_parser_new(NULL, 0);
+}
+
+void ciwic_push_parser_free(ciwic_push_parser *push) {
+    free(push->buf);
+    push->buf = NULL;
+    push->len = 0;
+    push->cap = 0;
+    ciwic_parser_free(&push->parser);
+}
+
+// Returns 1 if the text from parser->pos to end, which is not a definition,
+// may still be the start of one. A text ending in what looked like a function
+// body may be an initializer whose last compound literal follows its ')', so
+// it only has to start with declaration specifiers. A text ending in ';' has
+// to be the head of an old style function definition with its parameter
+// declarations.
+int ciwic_push_parser_prefix(ciwic_push_parser *push, int end) {
+    ciwic_parser *parser = &push->parser;
+    ciwic_declaration_specifiers specifiers;
+    ciwic_declarator declarator;
+    ciwic_declaration_list decl_list;
+
+    if (ciwic_parser_declaration_specifiers(parser, &specifiers)) {
+        return 0;
+    }
+
+    if (push->buf[end - 1] != ';') {
+        return 1;
+    }
+
+    if (ciwic_parser_declarator(parser, NULL, &declarator)
+            || ciwic_parser_declaration_list(parser, &decl_list)) {
+        return 0;
+    }
+
+    ciwic_parser_whitespace(parser);
+    return parser->pos == end;
+}
+
+// Parses and emits the definitions in buf[0..end), where end is just past a
+// ';' or the '}' of a function body at nesting depth zero, and drops them
+// from the buffer.
+void ciwic_push_parser_emit(ciwic_push_parser *push, int end) {
+    ciwic_parser *parser = &push->parser;
+    ciwic_translation_unit def;
+    int consumed = 0;
+
+    ciwic_parser_reset(parser, push->buf, end);
+    parser->flags = push->flags;
+
+    while (!ciwic_parser_external_declaration(parser, &def)) {
+        push->callback(push->data, &def, push->buf, push->offset);
+        consumed = parser->pos;
+    }
+
+    ciwic_parser_whitespace(parser);
+    if (parser->pos == end) {
+        consumed = end;
+    } else if (parser->stop != ciwic_parser_running || !ciwic_push_parser_prefix(push, end)) {
+        // Parsing the text again at the next boundary cannot make it a
+        // definition, it would only be parsed once more for every boundary
+        push->failed = 1;
+    }
+
+    // An old style function head can only be completed by its body, and an
+    // initializer taken for a body only by its ';', so boundaries of the same
+    // kind until then are not worth parsing the text again for
+    if (consumed == end) {
+        push->wait = 0;
+    } else {
+        push->wait = push->buf[end - 1] == ';' ? '}' : ';';
+    }
+
+    if (consumed == 0) {
+        return;
+    }
+
+    memmove(push->buf, &push->buf[consumed], push->len - consumed);
+    push->len -= consumed;
+    push->offset += consumed;
+    push->scan_pos -= consumed;
+}
+
+// Returns the change in nesting depth for the bracket starting at buf[i],
+// which is one, two or three characters long. Digraph and trigraph forms of
+// braces and parentheses count too.
+int ciwic_push_parser_bracket(ciwic_push_parser *push, int i, int *width) {
+    char *buf = push->buf;
+    int len = push->len;
+
+    *width = 1;
+
+    switch (buf[i]) {
+        case '{':
+        case '(':
+            return 1;
+        case '}':
+        case ')':
+            return -1;
+        case '<':
+            if (i + 1 < len && buf[i+1] == '%') {
+                *width = 2;
+                return 1;
+            }
+            return 0;
+        case '%':
+            if (i + 1 < len && buf[i+1] == '>') {
+                *width = 2;
+                return -1;
+            }
+            return 0;
+        case '?':
+            if (!(push->flags & ciwic_parser_trigraphs) || i + 2 >= len || buf[i+1] != '?') {
+                return 0;
+            }
+            *width = 3;
+            switch (buf[i+2]) {
+                case '<':
+                case '(':
+                    return 1;
+                case '>':
+                case ')':
+                    return -1;
+            }
+            *width = 1;
+            return 0;
+    }
+
+    return 0;
+}
+
+void ciwic_push_parser_scan(ciwic_push_parser *push, int eof) {
+    while (!push->failed && push->scan_pos < push->len) {
+        char *buf = push->buf;
+        int len = push->len;
+        int i = push->scan_pos;
+
+        if (push->in_line_comment) {
+            i = ciwic_scan_char(buf, i, len, '\n');
+            if (i >= len) {
+                push->scan_pos = len;
+                return;
+            }
+            // A line splice continues the comment
+            int line_end = i > 0 && buf[i-1] == '\r' ? i - 1 : i;
+            if (line_end == 0 || buf[line_end-1] != '\\') {
+                push->in_line_comment = 0;
+            }
+            push->scan_pos = i + 1;
+            continue;
+        }
+
+        if (push->in_block_comment) {
+            i = ciwic_scan_char(buf, i, len, '*');
+            if (i + 1 >= len && !eof) {
+                push->scan_pos = i < len ? i : len;
+                return;
+            }
+            if (i + 1 < len && buf[i+1] == '/') {
+                push->in_block_comment = 0;
+                push->scan_pos = i + 2;
+            } else {
+                push->scan_pos = i + 1;
+            }
+            continue;
+        }
+
+        char c = buf[i];
+
+        // These may start a token that continues in the next chunk
+        if (!eof && ((i + 1 >= len && (c == '/' || c == '<' || c == '%' || c == '?'))
+                    || (i + 2 >= len && c == '?'))) {
+            return;
+        }
+
+        if (c == '/' && i + 1 < len && (buf[i+1] == '/' || buf[i+1] == '*')) {
+            push->in_line_comment = buf[i+1] == '/';
+            push->in_block_comment = buf[i+1] == '*';
+            push->scan_pos = i + 2;
+            continue;
+        }
+
+        int width;
+        int bracket = ciwic_push_parser_bracket(push, i, &width);
+        int brace = bracket != 0 && (c == '{' || c == '}' || width == 2
+                || (width == 3 && (buf[i+2] == '<' || buf[i+2] == '>')));
+
+        // A function body follows the ')' of its declarator or the ';' of its
+        // last old style parameter declaration. Braces after '=', ',' or a
+        // struct tag close an initializer or a member list, which a
+        // definition never ends with.
+        if (brace && bracket > 0 && push->depth == 0) {
+            push->body = push->last == ')' || push->last == ';';
+        }
+
+        push->depth += bracket;
+        push->scan_pos = i + width;
+        if (!ciwic_scan_is_space(c)) {
+            push->last = buf[i + width - 1];
+        }
+
+        int boundary = 0;
+        if (push->depth == 0 && c == ';') {
+            boundary = ';';
+        } else if (push->depth == 0 && brace && bracket < 0 && push->body) {
+            boundary = '}';
+        }
+
+        if (boundary != 0 && (push->wait == 0 || push->wait == boundary)) {
+            ciwic_push_parser_emit(push, push->scan_pos);
+        }
+    }
+}
+
+int ciwic_push_parser_feed(ciwic_push_parser *push, const char *chunk, int len) {
+    if (push->failed) {
+        return 1;
+    }
+
+    if (push->len + len > push->cap) {
+        while (push->len + len > push->cap) {
+            push->cap = push->cap ? push->cap * 2 : 4096;
+        }
+        push->buf = realloc(push->buf, push->cap);
+    }
+
+    memcpy(&push->buf[push->len], chunk, len);
+    push->len += len;
+
+    ciwic_push_parser_scan(push, 0);
+
+    return push->failed;
+}
+
+int ciwic_push_parser_finish(ciwic_push_parser *push) {
+    ciwic_push_parser_scan(push, 1);
+
+    if (push->failed) {
+        return 1;
+    }
+
+    ciwic_parser *parser = &push->parser;
+    ciwic_parser_reset(parser, push->buf, push->len);
+    parser->flags = push->flags;
+    ciwic_parser_whitespace(parser);
+
+    if (parser->pos != push->len) {
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <parselib.h>
+#include <ast.h>
+
+// Push parser: the caller feeds arbitrary chunks of a translation unit and
+// every top-level definition is handed to the callback as soon as its closing
+// ';' or '}' has arrived. Only the unfinished tail of the input is buffered.
+
+// Called once per definition, with def->rest set to null. def and any
+// strings in it point into text, which is only valid until the callback
+// returns. Spans in def are relative to text, which starts at byte offset
+// in the stream.
+typedef void (*ciwic_push_callback)(void *data, ciwic_translation_unit *def, char *text, int offset);
+
+typedef struct {
+    char *buf;
+    int len;
+    int cap;
+    int offset; // Stream offset of buf[0]
+    int flags; // ciwic_parser_flags used for every definition
+    int failed; // Set once some input cannot be part of a definition
+
+    // State of the scan for definition boundaries
+    int scan_pos;
+    int depth;
+    int in_line_comment;
+    int in_block_comment;
+    int last; // Last character scanned outside comments and white space
+    int body; // Set if the brace open at depth zero starts a function body
+    int wait; // The boundary, ';' or '}', that the last attempt waits for, or 0
+
+    ciwic_push_callback callback;
+    void *data;
+
+    // Reset for every batch of definitions, so its buffers are reused
+    ciwic_parser parser;
+} ciwic_push_parser;
+
+void ciwic_push_parser_init(ciwic_push_parser *push, ciwic_push_callback callback, void *data);
+void ciwic_push_parser_free(ciwic_push_parser *push);
+
+// Buffers chunk and emits every definition it completes. Returns 1 once the
+// stream holds text that is not a definition, after which nothing more is
+// parsed.
+int ciwic_push_parser_feed(ciwic_push_parser *push, const char *chunk, int len);
+
+// Ends the stream. Returns 1 if any input remains that is not a complete
+// definition, or if the stream failed before.
+int ciwic_push_parser_finish(ciwic_push_parser *push);
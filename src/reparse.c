@@ -0,0 +1,190 @@
+#include <stdlib.h>
+
+#include <reparse.h>
+#include <parser.h>
+#include <visit.h>
+
+typedef struct {
+    const char *old_text;
+    int old_len;
+    char *new_text;
+    int shift;
+} ciwic_reparse_move;
+
+void ciwic_reparse_span(ciwic_reparse_move *move, ciwic_span *span) {
+    span->start += move->shift;
+    span->end += move->shift;
+}
+
+// Strings that were copied out of the text, because of line splices, are
+// left alone
+void ciwic_reparse_string(ciwic_reparse_move *move, string *str) {
+    if (str->text >= move->old_text && str->text < move->old_text + move->old_len) {
+        str->text = move->new_text + (str->text - move->old_text) + move->shift;
+    }
+}
+
+ciwic_visit_result ciwic_reparse_move_node(void *data, ciwic_node_kind kind, void *node) {
+    ciwic_reparse_move *move = data;
+
+    switch (kind) {
+        case ciwic_node_translation_unit:
+            ciwic_reparse_span(move, &((ciwic_translation_unit *) node)->span);
+            break;
+        case ciwic_node_declaration:
+            ciwic_reparse_span(move, &((ciwic_declaration *) node)->span);
+            break;
+        case ciwic_node_declaration_specifiers: {
+            ciwic_declaration_specifiers *specs = node;
+            if ((specs->type_spec == ciwic_type_spec_struct || specs->type_spec == ciwic_type_spec_union)
+                    && specs->struct_or_union.identifier != NULL) {
+                ciwic_reparse_string(move, specs->struct_or_union.identifier);
+            } else if (specs->type_spec == ciwic_type_spec_enum && specs->enum_.identifier != NULL) {
+                ciwic_reparse_string(move, specs->enum_.identifier);
+            } else if (specs->type_spec == ciwic_type_spec_typedef_name) {
+                ciwic_reparse_string(move, &specs->typedef_name);
+            }
+            break;
+        }
+        case ciwic_node_declarator: {
+            ciwic_declarator *decl = node;
+            ciwic_reparse_span(move, &decl->span);
+            if (decl->type == ciwic_declarator_identifier) {
+                ciwic_reparse_string(move, &decl->ident);
+            }
+            break;
+        }
+        case ciwic_node_designator_list: {
+            ciwic_designator_list *list = node;
+            if (list->type == ciwic_designator_ident) {
+                ciwic_reparse_string(move, &list->ident);
+            }
+            break;
+        }
+        case ciwic_node_enum_list:
+            ciwic_reparse_string(move, &((ciwic_enum_list *) node)->name);
+            break;
+        case ciwic_node_expr: {
+            ciwic_expr *expr = node;
+            ciwic_reparse_span(move, &expr->span);
+            if (expr->type == ciwic_expr_type_identifier) {
+                ciwic_reparse_string(move, &expr->identifier);
+            } else if (expr->type == ciwic_expr_type_member || expr->type == ciwic_expr_type_member_deref) {
+                ciwic_reparse_string(move, &expr->member.identifier);
+            }
+            break;
+        }
+        case ciwic_node_statement: {
+            ciwic_statement *stmt = node;
+            ciwic_reparse_span(move, &stmt->span);
+            if (stmt->type == ciwic_statement_label) {
+                ciwic_reparse_string(move, &stmt->labeled.label_ident);
+            } else if (stmt->type == ciwic_statement_goto) {
+                ciwic_reparse_string(move, &stmt->goto_ident);
+            } else if (stmt->type == ciwic_statement_block) {
+                // The visitor only sees the first cell of a block
+                for (ciwic_statement *block = stmt->block.rest; block != NULL; block = block->block.rest) {
+                    ciwic_reparse_span(move, &block->span);
+                }
+            }
+            break;
+        }
+        default:
+            break;
+    }
+
+    return ciwic_visit_continue;
+}
+
+// Parses definitions until the next one would start at or after end.
+// Returns 1 if a definition failed to parse.
+int ciwic_reparse_until(ciwic_parser *parser, int end, ciwic_translation_unit **last, int *count) {
+    ciwic_translation_unit def;
+
+    while (ciwic_parser_whitespace(parser), parser->pos < end) {
+        if (ciwic_parser_external_declaration(parser, &def)) {
+            return 1;
+        }
+
+        (*last)->rest = ciwic_parser_alloc(parser, ciwic_node_translation_unit, sizeof(ciwic_translation_unit));
+        *(*last)->rest = def;
+        *last = (*last)->rest;
+        (*count)++;
+    }
+
+    return 0;
+}
+
+int ciwic_reparse(ciwic_parser *parser, ciwic_translation_unit *old, const char *old_text, int old_len,
+        ciwic_edit *edits, int edit_count, ciwic_translation_unit *res) {
+    ciwic_translation_unit head;
+    ciwic_translation_unit *last = &head;
+    ciwic_reparse_move move;
+    ciwic_visitor visitor;
+    int count = 0;
+    int failed = 0;
+    int shift = 0;
+    int e = 0;
+
+    head.rest = NULL;
+
+    move.old_text = old_text;
+    move.old_len = old_len;
+    move.new_text = parser->text;
+
+    ciwic_visitor_init(&visitor, &move);
+    for (int i = 0; i < ciwic_node_kind_count; i++) {
+        visitor.pre[i] = ciwic_reparse_move_node;
+    }
+
+    ciwic_translation_unit *def = old;
+
+    while (def != NULL && !failed) {
+        ciwic_translation_unit *next = def->rest;
+
+        while (e < edit_count && edits[e].end < def->span.start) {
+            shift += edits[e].len - (edits[e].end - edits[e].start);
+            e++;
+        }
+
+        // An edit right next to the definition could join a token onto it
+        if (e < edit_count && edits[e].start <= def->span.end) {
+            def = next;
+            continue;
+        }
+
+        int start = def->span.start + shift;
+
+        failed = ciwic_reparse_until(parser, start, &last, &count);
+
+        // The text before it may now run into it, then it is parsed again
+        if (failed || parser->pos != start) {
+            def = next;
+            continue;
+        }
+
+        def->rest = NULL;
+        move.shift = shift;
+        ciwic_visit(&visitor, ciwic_node_translation_unit, def);
+
+        last->rest = def;
+        last = def;
+        count++;
+
+        parser->pos = def->span.end;
+        def = next;
+    }
+
+    if (!failed) {
+        ciwic_reparse_until(parser, parser->len, &last, &count);
+    }
+
+    ciwic_visitor_free(&visitor);
+
+    if (count == 0) {
+        return 1;
+    }
+
+    *res = *head.rest;
+    return 0;
+}
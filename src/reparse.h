@@ -0,0 +1,23 @@
+#pragma once
+
+#include <parselib.h>
+#include <ast.h>
+
+// Incremental reparsing
+//
+// After an edit only the definitions it touches have to be parsed again.
+// Every other definition of the old tree is moved into the new one, with its
+// spans shifted to its place in the new text and the strings in it pointed
+// into the new text.
+
+typedef struct {
+    int start; // Replaced byte range [start, end) of the old text
+    int end;
+    int len; // Length of the text that replaced it
+} ciwic_edit;
+
+// Parses the text of parser, which is old_text with edits applied, like
+// ciwic_parser_translation_unit. old must have been parsed from old_text and
+// is consumed. edits must be sorted by position and must not overlap.
+int ciwic_reparse(ciwic_parser *parser, ciwic_translation_unit *old, const char *old_text, int old_len,
+        ciwic_edit *edits, int edit_count, ciwic_translation_unit *res);
@@ -0,0 +1,233 @@
+#include <stdlib.h>
+
+#include <scan.h>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+const unsigned char ciwic_char_class[256] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+int ciwic_scan_is_space(char c) {
+    return ciwic_char_class[(unsigned char) c] & ciwic_class_space;
+}
+
+int ciwic_scan_push_line(int **lines, int *lines_len, int *lines_cap, int offset) {
+    if (*lines_len == *lines_cap) {
+        *lines_cap = *lines_cap ? *lines_cap * 2 : 64;
+        *lines = realloc(*lines, *lines_cap * sizeof(int));
+    }
+    (*lines)[(*lines_len)++] = offset;
+    return *lines_len;
+}
+
+int ciwic_scan_newlines(const char *text, int len, int **lines, int *lines_len, int *lines_cap) {
+    int i = 0;
+
+#if defined(__AVX2__)
+    const __m256i nl = _mm256_set1_epi8('\n');
+    for (; i + 32 <= len; i += 32) {
+        __m256i block = _mm256_loadu_si256((const __m256i *) &text[i]);
+        unsigned mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(block, nl));
+        while (mask) {
+            ciwic_scan_push_line(lines, lines_len, lines_cap, i + __builtin_ctz(mask) + 1);
+            mask &= mask - 1;
+        }
+    }
+#elif defined(__SSE2__)
+    const __m128i nl = _mm_set1_epi8('\n');
+    for (; i + 16 <= len; i += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i *) &text[i]);
+        unsigned mask = _mm_movemask_epi8(_mm_cmpeq_epi8(block, nl));
+        while (mask) {
+            ciwic_scan_push_line(lines, lines_len, lines_cap, i + __builtin_ctz(mask) + 1);
+            mask &= mask - 1;
+        }
+    }
+#endif
+
+    for (; i < len; i++) {
+        if (text[i] == '\n') {
+            ciwic_scan_push_line(lines, lines_len, lines_cap, i + 1);
+        }
+    }
+
+    return *lines_len;
+}
+
+int ciwic_scan_space(const char *text, int pos, int len) {
+    // Most tokens are preceded by at most one space, so avoid setting up the
+    // vector loop when there is nothing to skip.
+    if (pos >= len || !ciwic_scan_is_space(text[pos])) {
+        return pos;
+    }
+
+#if defined(__AVX2__)
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i tab = _mm256_set1_epi8('\t');
+    const __m256i ctrl_max = _mm256_set1_epi8('\r' - '\t');
+    for (; pos + 32 <= len; pos += 32) {
+        __m256i block = _mm256_loadu_si256((const __m256i *) &text[pos]);
+        // '\t' <= c <= '\r' as an unsigned range check
+        __m256i ctrl = _mm256_sub_epi8(block, tab);
+        __m256i is_ctrl = _mm256_cmpeq_epi8(_mm256_min_epu8(ctrl, ctrl_max), ctrl);
+        __m256i is_space = _mm256_or_si256(is_ctrl, _mm256_cmpeq_epi8(block, space));
+        unsigned mask = ~(unsigned) _mm256_movemask_epi8(is_space);
+        if (mask) {
+            return pos + __builtin_ctz(mask);
+        }
+    }
+#elif defined(__SSE2__)
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i ctrl_max = _mm_set1_epi8('\r' - '\t');
+    for (; pos + 16 <= len; pos += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i *) &text[pos]);
+        // '\t' <= c <= '\r' as an unsigned range check
+        __m128i ctrl = _mm_sub_epi8(block, tab);
+        __m128i is_ctrl = _mm_cmpeq_epi8(_mm_min_epu8(ctrl, ctrl_max), ctrl);
+        __m128i is_space = _mm_or_si128(is_ctrl, _mm_cmpeq_epi8(block, space));
+        unsigned mask = ~_mm_movemask_epi8(is_space) & 0xffff;
+        if (mask) {
+            return pos + __builtin_ctz(mask);
+        }
+    }
+#endif
+
+    while (pos < len && ciwic_scan_is_space(text[pos])) {
+        pos++;
+    }
+
+    return pos;
+}
+
+int ciwic_scan_char(const char *text, int pos, int len, char c) {
+#if defined(__AVX2__)
+    const __m256i needle = _mm256_set1_epi8(c);
+    for (; pos + 32 <= len; pos += 32) {
+        __m256i block = _mm256_loadu_si256((const __m256i *) &text[pos]);
+        unsigned mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle));
+        if (mask) {
+            return pos + __builtin_ctz(mask);
+        }
+    }
+#elif defined(__SSE2__)
+    const __m128i needle = _mm_set1_epi8(c);
+    for (; pos + 16 <= len; pos += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i *) &text[pos]);
+        unsigned mask = _mm_movemask_epi8(_mm_cmpeq_epi8(block, needle));
+        if (mask) {
+            return pos + __builtin_ctz(mask);
+        }
+    }
+#endif
+
+    while (pos < len && text[pos] != c) {
+        pos++;
+    }
+
+    return pos;
+}
+
+int ciwic_scan_comment_end(const char *text, int pos, int len) {
+    for (;;) {
+        pos = ciwic_scan_char(text, pos, len, '*');
+        if (pos + 1 >= len) {
+            return len;
+        }
+        if (text[pos + 1] == '/') {
+            return pos + 2;
+        }
+        pos++;
+    }
+}
+
+int ciwic_scan_ident(const char *text, int pos, int len) {
+#if defined(__AVX2__)
+    const __m256i lower = _mm256_set1_epi8(0x20);
+    const __m256i a = _mm256_set1_epi8('a');
+    const __m256i zero = _mm256_set1_epi8('0');
+    const __m256i underscore = _mm256_set1_epi8('_');
+    const __m256i alpha_max = _mm256_set1_epi8('z' - 'a');
+    const __m256i digit_max = _mm256_set1_epi8('9' - '0');
+    for (; pos + 32 <= len; pos += 32) {
+        __m256i block = _mm256_loadu_si256((const __m256i *) &text[pos]);
+        // Setting bit 5 maps 'A'-'Z' onto 'a'-'z' and nothing else into it
+        __m256i alpha = _mm256_sub_epi8(_mm256_or_si256(block, lower), a);
+        __m256i digit = _mm256_sub_epi8(block, zero);
+        __m256i is_alpha = _mm256_cmpeq_epi8(_mm256_min_epu8(alpha, alpha_max), alpha);
+        __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, digit_max), digit);
+        __m256i is_ident = _mm256_or_si256(_mm256_or_si256(is_alpha, is_digit),
+                _mm256_cmpeq_epi8(block, underscore));
+        unsigned mask = ~(unsigned) _mm256_movemask_epi8(is_ident);
+        if (mask) {
+            return pos + __builtin_ctz(mask);
+        }
+    }
+#elif defined(__SSE2__)
+    const __m128i lower = _mm_set1_epi8(0x20);
+    const __m128i a = _mm_set1_epi8('a');
+    const __m128i zero = _mm_set1_epi8('0');
+    const __m128i underscore = _mm_set1_epi8('_');
+    const __m128i alpha_max = _mm_set1_epi8('z' - 'a');
+    const __m128i digit_max = _mm_set1_epi8('9' - '0');
+    for (; pos + 16 <= len; pos += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i *) &text[pos]);
+        // Setting bit 5 maps 'A'-'Z' onto 'a'-'z' and nothing else into it
+        __m128i alpha = _mm_sub_epi8(_mm_or_si128(block, lower), a);
+        __m128i digit = _mm_sub_epi8(block, zero);
+        __m128i is_alpha = _mm_cmpeq_epi8(_mm_min_epu8(alpha, alpha_max), alpha);
+        __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, digit_max), digit);
+        __m128i is_ident = _mm_or_si128(_mm_or_si128(is_alpha, is_digit),
+                _mm_cmpeq_epi8(block, underscore));
+        unsigned mask = ~_mm_movemask_epi8(is_ident) & 0xffff;
+        if (mask) {
+            return pos + __builtin_ctz(mask);
+        }
+    }
+#endif
+
+    while (pos < len && ciwic_char_class[(unsigned char) text[pos]] & ciwic_class_ident) {
+        pos++;
+    }
+
+    return pos;
+}
+
+int ciwic_scan_ppnumber(const char *text, int pos, int len) {
+    for (;;) {
+        pos = ciwic_scan_ident(text, pos, len);
+
+        if (pos >= len) {
+            return pos;
+        }
+
+        char c = text[pos];
+        if (c == '.') {
+            pos++;
+        } else if ((c == '+' || c == '-') && (text[pos - 1] == 'e'
+                    || text[pos - 1] == 'E' || text[pos - 1] == 'p'
+                    || text[pos - 1] == 'P')) {
+            pos++;
+        } else {
+            return pos;
+        }
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+// Block scanning primitives used by the lexer. Every function has an SSE2
+// (or AVX2 when compiled with -mavx2) implementation and a scalar fallback.
+
+typedef enum {
+    ciwic_class_space = 1 << 0,
+    ciwic_class_letter = 1 << 1, // Includes '_'
+    ciwic_class_digit = 1 << 2,
+    ciwic_class_hex = 1 << 3,
+    ciwic_class_oct = 1 << 4,
+    ciwic_class_ident = ciwic_class_letter | ciwic_class_digit,
+} ciwic_char_class_flags;
+
+// Character classes of every byte, indexed by unsigned char
+extern const unsigned char ciwic_char_class[256];
+
+// Returns non-zero for ' ', '\t', '\n', '\v', '\f' and '\r'
+int ciwic_scan_is_space(char c);
+
+// Appends offset to *lines, growing it with realloc as needed
+int ciwic_scan_push_line(int **lines, int *lines_len, int *lines_cap, int offset);
+
+// Appends the offset following every '\n' in text[0..len) to *lines, growing
+// it with realloc as needed. Returns the new number of entries in *lines.
+int ciwic_scan_newlines(const char *text, int len, int **lines, int *lines_len, int *lines_cap);
+
+// Returns the offset of the first non white-space character in
+// text[pos..len), or len
+int ciwic_scan_space(const char *text, int pos, int len);
+
+// Returns the offset of the first occurrence of c in text[pos..len), or len
+int ciwic_scan_char(const char *text, int pos, int len, char c);
+
+// Returns the offset just past the "*/" closing a block comment whose body
+// starts at pos, or len if the comment is unterminated
+int ciwic_scan_comment_end(const char *text, int pos, int len);
+
+// Returns the offset of the first character in text[pos..len) that can not
+// be part of an identifier, or len
+int ciwic_scan_ident(const char *text, int pos, int len);
+
+// Returns the end of the pp-number starting at pos, that is a run of
+// identifier characters and '.', where '+' and '-' may follow e, E, p or P
+int ciwic_scan_ppnumber(const char *text, int pos, int len);
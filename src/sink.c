@@ -0,0 +1,139 @@
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sink.h>
+
+#define CIWIC_SINK_SIZE 65536
+
+// Indentation is copied from here rather than written a space at a time
+static const char ciwic_sink_spaces[] =
+    "                                                                "
+    "                                                                ";
+
+int ciwic_sink_flush_file(ciwic_sink *sink) {
+    return fwrite(sink->buf, 1, sink->len, sink->file) != sink->len || fflush(sink->file);
+}
+
+int ciwic_sink_flush_fd(ciwic_sink *sink) {
+    size_t done = 0;
+
+    while (done < sink->len) {
+        ssize_t n = write(sink->fd, &sink->buf[done], sink->len - done);
+        if (n < 0) {
+            return 1;
+        }
+        done += n;
+    }
+
+    return 0;
+}
+
+void ciwic_sink_init(ciwic_sink *sink, int (*flush)(ciwic_sink *sink)) {
+    sink->cap = CIWIC_SINK_SIZE;
+    sink->buf = malloc(sink->cap);
+    sink->len = 0;
+    sink->flush = flush;
+    sink->file = NULL;
+    sink->fd = -1;
+    sink->error = 0;
+}
+
+void ciwic_sink_init_file(ciwic_sink *sink, FILE *file) {
+    ciwic_sink_init(sink, ciwic_sink_flush_file);
+    sink->file = file;
+}
+
+void ciwic_sink_init_fd(ciwic_sink *sink, int fd) {
+    ciwic_sink_init(sink, ciwic_sink_flush_fd);
+    sink->fd = fd;
+}
+
+void ciwic_sink_init_memory(ciwic_sink *sink) {
+    ciwic_sink_init(sink, NULL);
+}
+
+int ciwic_sink_flush(ciwic_sink *sink) {
+    if (sink->flush == NULL || sink->len == 0) {
+        return sink->error;
+    }
+
+    if (sink->flush(sink)) {
+        sink->error = 1;
+    }
+
+    sink->len = 0;
+    return sink->error;
+}
+
+int ciwic_sink_close(ciwic_sink *sink) {
+    int res = ciwic_sink_flush(sink);
+    free(sink->buf);
+    sink->buf = NULL;
+    sink->len = 0;
+    sink->cap = 0;
+    return res;
+}
+
+// Makes room for at least n more bytes
+void ciwic_sink_reserve(ciwic_sink *sink, size_t n) {
+    if (sink->len + n <= sink->cap) {
+        return;
+    }
+
+    ciwic_sink_flush(sink);
+
+    while (sink->len + n > sink->cap) {
+        sink->cap *= 2;
+    }
+    sink->buf = realloc(sink->buf, sink->cap);
+}
+
+void ciwic_sink_write(ciwic_sink *sink, const char *data, size_t len) {
+    if (sink->len + len > sink->cap) {
+        ciwic_sink_reserve(sink, len);
+    }
+    memcpy(&sink->buf[sink->len], data, len);
+    sink->len += len;
+}
+
+void ciwic_sink_str(ciwic_sink *sink, const char *str) {
+    ciwic_sink_write(sink, str, strlen(str));
+}
+
+void ciwic_sink_char(ciwic_sink *sink, char c) {
+    if (sink->len == sink->cap) {
+        ciwic_sink_reserve(sink, 1);
+    }
+    sink->buf[sink->len++] = c;
+}
+
+void ciwic_sink_int(ciwic_sink *sink, long value) {
+    char digits[24];
+    int i = sizeof(digits);
+    unsigned long v = value < 0 ? -(unsigned long) value : (unsigned long) value;
+
+    do {
+        digits[--i] = '0' + v % 10;
+        v /= 10;
+    } while (v != 0);
+
+    if (value < 0) {
+        digits[--i] = '-';
+    }
+
+    ciwic_sink_write(sink, &digits[i], sizeof(digits) - i);
+}
+
+void ciwic_sink_indent(ciwic_sink *sink, int n) {
+    int run = sizeof(ciwic_sink_spaces) - 1;
+
+    while (n > run) {
+        ciwic_sink_write(sink, ciwic_sink_spaces, run);
+        n -= run;
+    }
+
+    if (n > 0) {
+        ciwic_sink_write(sink, ciwic_sink_spaces, n);
+    }
+}
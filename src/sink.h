@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdio.h>
+
+// Buffered output sink
+//
+// Output is collected in buf and handed to flush whenever it fills up. A
+// memory sink has no flush and grows its buffer instead, so once writing is
+// done buf[0..len) holds everything written.
+
+typedef struct ciwic_sink ciwic_sink;
+
+struct ciwic_sink {
+    char *buf;
+    size_t len;
+    size_t cap;
+    int (*flush)(ciwic_sink *sink); // Can be null
+    FILE *file;
+    int fd;
+    int error; // Set once a flush has failed
+};
+
+void ciwic_sink_init_file(ciwic_sink *sink, FILE *file);
+void ciwic_sink_init_fd(ciwic_sink *sink, int fd);
+void ciwic_sink_init_memory(ciwic_sink *sink);
+
+// Flushes any buffered output and frees the buffer. Returns 1 if any write
+// failed.
+int ciwic_sink_close(ciwic_sink *sink);
+
+int ciwic_sink_flush(ciwic_sink *sink);
+void ciwic_sink_write(ciwic_sink *sink, const char *data, size_t len);
+void ciwic_sink_str(ciwic_sink *sink, const char *str);
+void ciwic_sink_char(ciwic_sink *sink, char c);
+void ciwic_sink_int(ciwic_sink *sink, long value);
+
+// Writes n spaces
+void ciwic_sink_indent(ciwic_sink *sink, int n);
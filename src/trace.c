@@ -0,0 +1,129 @@
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <trace.h>
+
+void ciwic_trace_init(ciwic_trace *trace, int tid, const char *thread_name) {
+    trace->tid = tid;
+    trace->thread_name = thread_name;
+    trace->events = NULL;
+    trace->events_len = 0;
+    trace->events_cap = 0;
+}
+
+void ciwic_trace_free(ciwic_trace *trace) {
+    for (int i = 0; i < trace->events_len; i++) {
+        free(trace->events[i].detail);
+    }
+    free(trace->events);
+    trace->events = NULL;
+    trace->events_len = 0;
+    trace->events_cap = 0;
+}
+
+uint64_t ciwic_trace_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+void ciwic_trace_event_add(ciwic_trace *trace, const char *name, uint64_t start, uint64_t end, const char *detail, int offset) {
+    if (trace->events_len == trace->events_cap) {
+        trace->events_cap = trace->events_cap ? trace->events_cap * 2 : 1024;
+        trace->events = realloc(trace->events, sizeof(ciwic_trace_event) * trace->events_cap);
+    }
+
+    ciwic_trace_event *event = &trace->events[trace->events_len++];
+    event->name = name;
+    event->detail = detail != NULL ? strdup(detail) : NULL;
+    event->offset = offset;
+    event->start = start;
+    event->end = end;
+}
+
+void ciwic_trace_json_string(ciwic_sink *sink, const char *str) {
+    static const char hex[] = "0123456789abcdef";
+
+    ciwic_sink_char(sink, '"');
+    for (; *str; str++) {
+        unsigned char c = *str;
+        if (c == '"' || c == '\\') {
+            ciwic_sink_char(sink, '\\');
+            ciwic_sink_char(sink, c);
+        } else if (c < 0x20) {
+            ciwic_sink_str(sink, "\\u00");
+            ciwic_sink_char(sink, hex[c >> 4]);
+            ciwic_sink_char(sink, hex[c & 15]);
+        } else {
+            ciwic_sink_char(sink, c);
+        }
+    }
+    ciwic_sink_char(sink, '"');
+}
+
+// Writes a time in nanoseconds as the microseconds the format uses
+void ciwic_trace_micros(ciwic_sink *sink, uint64_t ns) {
+    char frac[4] = { '0' + ns / 100 % 10, '0' + ns / 10 % 10, '0' + ns % 10, 0 };
+    ciwic_sink_int(sink, ns / 1000);
+    ciwic_sink_char(sink, '.');
+    ciwic_sink_str(sink, frac);
+}
+
+void ciwic_trace_write(ciwic_sink *sink, ciwic_trace *traces, int count) {
+    int pid = getpid();
+    int first = 1;
+
+    ciwic_sink_str(sink, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+    for (int i = 0; i < count; i++) {
+        ciwic_trace *trace = &traces[i];
+
+        if (trace->thread_name != NULL) {
+            ciwic_sink_str(sink, first ? "\n" : ",\n");
+            first = 0;
+            ciwic_sink_str(sink, "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":");
+            ciwic_sink_int(sink, pid);
+            ciwic_sink_str(sink, ",\"tid\":");
+            ciwic_sink_int(sink, trace->tid);
+            ciwic_sink_str(sink, ",\"args\":{\"name\":");
+            ciwic_trace_json_string(sink, trace->thread_name);
+            ciwic_sink_str(sink, "}}");
+        }
+
+        for (int j = 0; j < trace->events_len; j++) {
+            ciwic_trace_event *event = &trace->events[j];
+
+            ciwic_sink_str(sink, first ? "\n" : ",\n");
+            first = 0;
+            ciwic_sink_str(sink, "{\"ph\":\"X\",\"name\":");
+            ciwic_trace_json_string(sink, event->name);
+            ciwic_sink_str(sink, ",\"pid\":");
+            ciwic_sink_int(sink, pid);
+            ciwic_sink_str(sink, ",\"tid\":");
+            ciwic_sink_int(sink, trace->tid);
+            ciwic_sink_str(sink, ",\"ts\":");
+            ciwic_trace_micros(sink, event->start);
+            ciwic_sink_str(sink, ",\"dur\":");
+            ciwic_trace_micros(sink, event->end - event->start);
+
+            if (event->detail != NULL || event->offset >= 0) {
+                ciwic_sink_str(sink, ",\"args\":{");
+                if (event->detail != NULL) {
+                    ciwic_sink_str(sink, "\"detail\":");
+                    ciwic_trace_json_string(sink, event->detail);
+                }
+                if (event->offset >= 0) {
+                    ciwic_sink_str(sink, event->detail != NULL ? ",\"offset\":" : "\"offset\":");
+                    ciwic_sink_int(sink, event->offset);
+                }
+                ciwic_sink_char(sink, '}');
+            }
+
+            ciwic_sink_char(sink, '}');
+        }
+    }
+
+    ciwic_sink_str(sink, "\n]}\n");
+}
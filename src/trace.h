@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <sink.h>
+
+// Timeline tracing
+//
+// Records how long each phase of the work took, one ciwic_trace per thread
+// so recording needs no locking, and writes them out in the Chrome trace
+// event format that chrome://tracing and Perfetto load. Recording an event
+// is two clock reads and an append, so callers keep a null trace when
+// tracing is off and check for it before reading the clock.
+
+typedef struct {
+    const char *name; // Static string
+    char *detail; // Can be null
+    int offset; // Offset into the input, or -1
+    uint64_t start; // Nanoseconds, see ciwic_trace_now
+    uint64_t end;
+} ciwic_trace_event;
+
+typedef struct ciwic_trace ciwic_trace;
+
+struct ciwic_trace {
+    int tid;
+    const char *thread_name; // Can be null
+    ciwic_trace_event *events;
+    int events_len;
+    int events_cap;
+};
+
+void ciwic_trace_init(ciwic_trace *trace, int tid, const char *thread_name);
+void ciwic_trace_free(ciwic_trace *trace);
+
+uint64_t ciwic_trace_now(void);
+
+// Records that name ran from start to end. detail, for example the file
+// being worked on, is copied.
+void ciwic_trace_event_add(ciwic_trace *trace, const char *name, uint64_t start, uint64_t end, const char *detail, int offset);
+
+// Writes the events of every trace as one JSON document
+void ciwic_trace_write(ciwic_sink *sink, ciwic_trace *traces, int count);
@@ -0,0 +1,342 @@
+#include <stdlib.h>
+
+#include <visit.h>
+
+void ciwic_visitor_init(ciwic_visitor *visitor, void *data) {
+    for (int i = 0; i < ciwic_node_kind_count; i++) {
+        visitor->pre[i] = NULL;
+        visitor->post[i] = NULL;
+    }
+
+    visitor->data = data;
+    visitor->stack = NULL;
+    visitor->stack_len = 0;
+    visitor->stack_cap = 0;
+}
+
+void ciwic_visitor_free(ciwic_visitor *visitor) {
+    free(visitor->stack);
+    visitor->stack = NULL;
+    visitor->stack_len = 0;
+    visitor->stack_cap = 0;
+}
+
+void ciwic_visit_push(ciwic_visitor *visitor, ciwic_node_kind kind, void *node, int is_post) {
+    if (node == NULL) {
+        return;
+    }
+
+    if (visitor->stack_len == visitor->stack_cap) {
+        visitor->stack_cap = visitor->stack_cap ? visitor->stack_cap * 2 : 64;
+        visitor->stack = realloc(visitor->stack, sizeof(ciwic_visit_frame) * visitor->stack_cap);
+    }
+
+    ciwic_visit_frame *frame = &visitor->stack[visitor->stack_len++];
+    frame->node = node;
+    frame->kind = kind;
+    frame->is_post = is_post;
+}
+
+void ciwic_visit_child(ciwic_visitor *visitor, ciwic_node_kind kind, void *node) {
+    ciwic_visit_push(visitor, kind, node, 0);
+}
+
+// Returns the cell after node if kind is a list kind
+void *ciwic_visit_next_sibling(ciwic_node_kind kind, void *node) {
+    switch (kind) {
+        case ciwic_node_translation_unit:
+            return ((ciwic_translation_unit *) node)->rest;
+        case ciwic_node_declaration_list:
+            return ((ciwic_declaration_list *) node)->rest;
+        case ciwic_node_init_declarator_list:
+            return ((ciwic_init_declarator_list *) node)->rest;
+        case ciwic_node_param_list:
+            return ((ciwic_param_list *) node)->rest;
+        case ciwic_node_initializer_list:
+            return ((ciwic_initializer_list *) node)->rest;
+        case ciwic_node_designator_list:
+            return ((ciwic_designator_list *) node)->rest;
+        case ciwic_node_struct_list:
+            return ((ciwic_struct_list *) node)->rest;
+        case ciwic_node_struct_declarator_list:
+            return ((ciwic_struct_declarator_list *) node)->rest;
+        case ciwic_node_enum_list:
+            return ((ciwic_enum_list *) node)->rest;
+        case ciwic_node_expr_arg_list:
+            return ((ciwic_expr_arg_list *) node)->rest;
+        default:
+            return NULL;
+    }
+}
+
+void ciwic_visit_expr_children(ciwic_visitor *visitor, ciwic_expr *expr) {
+    switch (expr->type) {
+        case ciwic_expr_type_identifier:
+        case ciwic_expr_type_constant:
+            break;
+        case ciwic_expr_type_unary_op:
+            ciwic_visit_child(visitor, ciwic_node_expr, expr->unary_op.inner);
+            break;
+        case ciwic_expr_type_binary_op:
+            ciwic_visit_child(visitor, ciwic_node_expr, expr->binary_op.fst);
+            ciwic_visit_child(visitor, ciwic_node_expr, expr->binary_op.snd);
+            break;
+        case ciwic_expr_type_call:
+            ciwic_visit_child(visitor, ciwic_node_expr, expr->call.fun);
+            ciwic_visit_child(visitor, ciwic_node_expr_arg_list, expr->call.args);
+            break;
+        case ciwic_expr_type_initialize:
+            ciwic_visit_child(visitor, ciwic_node_type_name, &expr->initialize.type_name);
+            ciwic_visit_child(visitor, ciwic_node_initializer_list, &expr->initialize.initializer_list);
+            break;
+        case ciwic_expr_type_subscript:
+            ciwic_visit_child(visitor, ciwic_node_expr, expr->subscript.val);
+            ciwic_visit_child(visitor, ciwic_node_expr, expr->subscript.pos);
+            break;
+        case ciwic_expr_type_member:
+        case ciwic_expr_type_member_deref:
+            ciwic_visit_child(visitor, ciwic_node_expr, expr->member.expr);
+            break;
+        case ciwic_expr_type_sizeof_expr:
+            ciwic_visit_child(visitor, ciwic_node_expr, expr->sizeof_expr);
+            break;
+        case ciwic_expr_type_sizeof_type:
+            ciwic_visit_child(visitor, ciwic_node_type_name, &expr->sizeof_type);
+            break;
+        case ciwic_expr_type_cast:
+            ciwic_visit_child(visitor, ciwic_node_type_name, &expr->cast.type_name);
+            ciwic_visit_child(visitor, ciwic_node_expr, expr->cast.expr);
+            break;
+        case ciwic_expr_type_conditional:
+            ciwic_visit_child(visitor, ciwic_node_expr, expr->conditional.cond);
+            ciwic_visit_child(visitor, ciwic_node_expr, expr->conditional.left);
+            ciwic_visit_child(visitor, ciwic_node_expr, expr->conditional.right);
+            break;
+        case ciwic_expr_type_assignment:
+            ciwic_visit_child(visitor, ciwic_node_expr, expr->assignment.left);
+            ciwic_visit_child(visitor, ciwic_node_expr, expr->assignment.right);
+            break;
+    }
+}
+
+void ciwic_visit_statement_children(ciwic_visitor *visitor, ciwic_statement *stmt) {
+    switch (stmt->type) {
+        case ciwic_statement_label:
+        case ciwic_statement_default:
+            ciwic_visit_child(visitor, ciwic_node_statement, stmt->labeled.stmt);
+            break;
+        case ciwic_statement_case:
+            ciwic_visit_child(visitor, ciwic_node_expr, &stmt->labeled.case_expr);
+            ciwic_visit_child(visitor, ciwic_node_statement, stmt->labeled.stmt);
+            break;
+        case ciwic_statement_block:
+            for (ciwic_statement *block = stmt; block != NULL; block = block->block.rest) {
+                ciwic_visit_child(visitor, ciwic_node_statement, block->block.head);
+            }
+            break;
+        case ciwic_statement_expr:
+            ciwic_visit_child(visitor, ciwic_node_expr, &stmt->expr);
+            break;
+        case ciwic_statement_if:
+            ciwic_visit_child(visitor, ciwic_node_expr, &stmt->if_stmt.expr);
+            ciwic_visit_child(visitor, ciwic_node_statement, stmt->if_stmt.if_then);
+            ciwic_visit_child(visitor, ciwic_node_statement, stmt->if_stmt.if_else);
+            break;
+        case ciwic_statement_switch:
+        case ciwic_statement_while:
+            ciwic_visit_child(visitor, ciwic_node_expr, &stmt->while_stmt.expr);
+            ciwic_visit_child(visitor, ciwic_node_statement, stmt->while_stmt.stmt);
+            break;
+        case ciwic_statement_do_while:
+            ciwic_visit_child(visitor, ciwic_node_statement, stmt->while_stmt.stmt);
+            ciwic_visit_child(visitor, ciwic_node_expr, &stmt->while_stmt.expr);
+            break;
+        case ciwic_statement_for:
+            ciwic_visit_child(visitor, ciwic_node_declaration, stmt->for_stmt.pre_decl);
+            ciwic_visit_child(visitor, ciwic_node_expr, stmt->for_stmt.pre_expr);
+            ciwic_visit_child(visitor, ciwic_node_expr, stmt->for_stmt.test_expr);
+            ciwic_visit_child(visitor, ciwic_node_expr, stmt->for_stmt.post_expr);
+            ciwic_visit_child(visitor, ciwic_node_statement, stmt->for_stmt.stmt);
+            break;
+        case ciwic_statement_return:
+            ciwic_visit_child(visitor, ciwic_node_expr, stmt->return_expr);
+            break;
+        case ciwic_statement_goto:
+        case ciwic_statement_continue:
+        case ciwic_statement_break:
+        case ciwic_statement_null:
+            break;
+    }
+}
+
+// Pushes the children of node in source order
+void ciwic_visit_children(ciwic_visitor *visitor, ciwic_node_kind kind, void *node) {
+    switch (kind) {
+        case ciwic_node_translation_unit: {
+            ciwic_translation_unit *def = node;
+            if (def->def_type == ciwic_definition_func) {
+                ciwic_visit_child(visitor, ciwic_node_func_definition, &def->func);
+            } else {
+                ciwic_visit_child(visitor, ciwic_node_declaration, &def->decl);
+            }
+            break;
+        }
+        case ciwic_node_func_definition: {
+            ciwic_func_definition *func = node;
+            ciwic_visit_child(visitor, ciwic_node_declaration_specifiers, &func->specifiers);
+            ciwic_visit_child(visitor, ciwic_node_declarator, &func->declarator);
+            ciwic_visit_child(visitor, ciwic_node_declaration_list, func->decl_list);
+            ciwic_visit_child(visitor, ciwic_node_statement, &func->statement);
+            break;
+        }
+        case ciwic_node_declaration: {
+            ciwic_declaration *decl = node;
+            ciwic_visit_child(visitor, ciwic_node_declaration_specifiers, &decl->specifiers);
+            ciwic_visit_child(visitor, ciwic_node_init_declarator_list, &decl->list);
+            break;
+        }
+        case ciwic_node_declaration_list:
+            ciwic_visit_child(visitor, ciwic_node_declaration, &((ciwic_declaration_list *) node)->head);
+            break;
+        case ciwic_node_declaration_specifiers: {
+            ciwic_declaration_specifiers *specs = node;
+            if (specs->type_spec == ciwic_type_spec_struct || specs->type_spec == ciwic_type_spec_union) {
+                ciwic_visit_child(visitor, ciwic_node_struct_list, specs->struct_or_union.decl);
+            } else if (specs->type_spec == ciwic_type_spec_enum) {
+                ciwic_visit_child(visitor, ciwic_node_enum_list, specs->enum_.decl);
+            }
+            break;
+        }
+        case ciwic_node_init_declarator_list: {
+            ciwic_init_declarator_list *list = node;
+            ciwic_visit_child(visitor, ciwic_node_declarator, &list->declarator);
+            ciwic_visit_child(visitor, ciwic_node_initializer, list->initializer);
+            break;
+        }
+        case ciwic_node_declarator: {
+            ciwic_declarator *decl = node;
+            ciwic_visit_child(visitor, ciwic_node_declarator, decl->inner);
+            if (decl->type == ciwic_declarator_array) {
+                ciwic_visit_child(visitor, ciwic_node_expr, decl->array.expr);
+            } else if (decl->type == ciwic_declarator_func) {
+                ciwic_visit_child(visitor, ciwic_node_param_list, decl->func.param_list);
+            }
+            break;
+        }
+        case ciwic_node_param_list: {
+            ciwic_param_list *list = node;
+            ciwic_visit_child(visitor, ciwic_node_declaration_specifiers, &list->specifiers);
+            ciwic_visit_child(visitor, ciwic_node_declarator, list->declarator);
+            break;
+        }
+        case ciwic_node_type_name: {
+            ciwic_type_name *name = node;
+            ciwic_visit_child(visitor, ciwic_node_declaration_specifiers, &name->specifiers);
+            ciwic_visit_child(visitor, ciwic_node_declarator, name->declarator);
+            break;
+        }
+        case ciwic_node_initializer: {
+            ciwic_initializer *init = node;
+            if (init->type == ciwic_initializer_init_expr) {
+                ciwic_visit_child(visitor, ciwic_node_expr, &init->expr);
+            } else {
+                ciwic_visit_child(visitor, ciwic_node_initializer_list, &init->list);
+            }
+            break;
+        }
+        case ciwic_node_initializer_list: {
+            ciwic_initializer_list *list = node;
+            ciwic_visit_child(visitor, ciwic_node_designator_list, list->designation);
+            ciwic_visit_child(visitor, ciwic_node_initializer, list->initializer);
+            break;
+        }
+        case ciwic_node_designator_list: {
+            ciwic_designator_list *list = node;
+            if (list->type == ciwic_designator_expr) {
+                ciwic_visit_child(visitor, ciwic_node_expr, &list->expr);
+            }
+            break;
+        }
+        case ciwic_node_struct_list: {
+            ciwic_struct_list *list = node;
+            ciwic_visit_child(visitor, ciwic_node_declaration_specifiers, &list->specifiers);
+            ciwic_visit_child(visitor, ciwic_node_struct_declarator_list, &list->declarator_list);
+            break;
+        }
+        case ciwic_node_struct_declarator_list: {
+            ciwic_struct_declarator_list *list = node;
+            ciwic_visit_child(visitor, ciwic_node_declarator, list->declarator);
+            ciwic_visit_child(visitor, ciwic_node_expr, list->expr);
+            break;
+        }
+        case ciwic_node_enum_list:
+            ciwic_visit_child(visitor, ciwic_node_expr, ((ciwic_enum_list *) node)->expr);
+            break;
+        case ciwic_node_expr:
+            ciwic_visit_expr_children(visitor, node);
+            break;
+        case ciwic_node_expr_arg_list:
+            ciwic_visit_child(visitor, ciwic_node_expr, &((ciwic_expr_arg_list *) node)->head);
+            break;
+        case ciwic_node_statement:
+            ciwic_visit_statement_children(visitor, node);
+            break;
+        case ciwic_node_kind_count:
+            break;
+    }
+}
+
+int ciwic_visit(ciwic_visitor *visitor, ciwic_node_kind kind, void *node) {
+    int base = visitor->stack_len;
+
+    ciwic_visit_child(visitor, kind, node);
+
+    while (visitor->stack_len > base) {
+        ciwic_visit_frame frame = visitor->stack[--visitor->stack_len];
+        ciwic_visit_result res = ciwic_visit_continue;
+
+        if (frame.is_post) {
+            if (visitor->post[frame.kind] != NULL) {
+                res = visitor->post[frame.kind](visitor->data, frame.kind, frame.node);
+            }
+            if (res == ciwic_visit_stop) {
+                visitor->stack_len = base;
+                return 1;
+            }
+            continue;
+        }
+
+        if (visitor->pre[frame.kind] != NULL) {
+            res = visitor->pre[frame.kind](visitor->data, frame.kind, frame.node);
+        }
+
+        if (res == ciwic_visit_stop) {
+            visitor->stack_len = base;
+            return 1;
+        }
+
+        // The stack holds the next sibling, then our post visit, then our
+        // children with the first on top
+        ciwic_visit_child(visitor, frame.kind, ciwic_visit_next_sibling(frame.kind, frame.node));
+        ciwic_visit_push(visitor, frame.kind, frame.node, 1);
+
+        if (res == ciwic_visit_skip) {
+            continue;
+        }
+
+        int first = visitor->stack_len;
+        ciwic_visit_children(visitor, frame.kind, frame.node);
+
+        for (int i = first, j = visitor->stack_len - 1; i < j; i++, j--) {
+            ciwic_visit_frame tmp = visitor->stack[i];
+            visitor->stack[i] = visitor->stack[j];
+            visitor->stack[j] = tmp;
+        }
+    }
+
+    return 0;
+}
+
+int ciwic_visit_translation_unit(ciwic_visitor *visitor, ciwic_translation_unit *translation_unit) {
+    return ciwic_visit(visitor, ciwic_node_translation_unit, translation_unit);
+}
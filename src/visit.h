@@ -0,0 +1,47 @@
+#pragma once
+
+#include <ast.h>
+
+// AST traversal without recursion
+//
+// Nodes are visited depth first in source order. Each node is passed to the
+// pre callback for its kind before its children and to the post callback
+// after them, together with a pointer to the AST struct of that kind. List
+// cells are nodes of the list's kind whose rest is visited as the next
+// sibling, so long lists do not nest. A block statement is a single node
+// with one child per statement.
+//
+// Pending nodes are kept on a heap allocated stack in the visitor, which is
+// reused between traversals.
+
+typedef enum {
+    ciwic_visit_continue,
+    ciwic_visit_skip, // Do not visit the children, the post callback still runs
+    ciwic_visit_stop, // End the traversal
+} ciwic_visit_result;
+
+typedef ciwic_visit_result (*ciwic_visit_callback)(void *data, ciwic_node_kind kind, void *node);
+
+typedef struct {
+    void *node;
+    ciwic_node_kind kind;
+    int is_post;
+} ciwic_visit_frame;
+
+typedef struct {
+    ciwic_visit_callback pre[ciwic_node_kind_count]; // Can be null
+    ciwic_visit_callback post[ciwic_node_kind_count]; // Can be null
+    void *data;
+
+    ciwic_visit_frame *stack;
+    int stack_len;
+    int stack_cap;
+} ciwic_visitor;
+
+void ciwic_visitor_init(ciwic_visitor *visitor, void *data);
+void ciwic_visitor_free(ciwic_visitor *visitor);
+
+// Visits node, which is of the given kind, and for list kinds every cell
+// after it. Returns 1 if a callback stopped the traversal.
+int ciwic_visit(ciwic_visitor *visitor, ciwic_node_kind kind, void *node);
+int ciwic_visit_translation_unit(ciwic_visitor *visitor, ciwic_translation_unit *translation_unit);
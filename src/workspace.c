@@ -0,0 +1,446 @@
+#include <dirent.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <workspace.h>
+#include <hash.h>
+#include <parser.h>
+#include <reparse.h>
+
+#define CIWIC_WORKSPACE_EVENTS (IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE)
+
+int ciwic_workspace_is_source(const char *name) {
+    size_t len = strlen(name);
+    return len > 2 && name[len-2] == '.' && (name[len-1] == 'c' || name[len-1] == 'h');
+}
+
+char *ciwic_workspace_join(const char *dir, const char *name) {
+    size_t len = strlen(dir) + strlen(name) + 2;
+    char *path = malloc(len);
+    snprintf(path, len, "%s/%s", dir, name);
+    return path;
+}
+
+int ciwic_workspace_read(const char *path, char **text, int *len, struct timespec *mtime) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return 1;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st)) {
+        close(fd);
+        return 1;
+    }
+
+    *mtime = st.st_mtim;
+
+    // One extra byte so an empty file still gets a buffer
+    *text = malloc(st.st_size + 1);
+    *len = 0;
+
+    ssize_t n;
+    while (*len < st.st_size && (n = read(fd, &(*text)[*len], st.st_size - *len)) > 0) {
+        *len += n;
+    }
+
+    close(fd);
+    return 0;
+}
+
+void ciwic_workspace_index_insert(ciwic_workspace *ws, int i) {
+    size_t slot = ciwic_hash64(ws->files[i].path, strlen(ws->files[i].path), 0) & (ws->index_cap - 1);
+    while (ws->index[slot] != 0) {
+        slot = (slot + 1) & (ws->index_cap - 1);
+    }
+    ws->index[slot] = i + 1;
+}
+
+ciwic_workspace_file *ciwic_workspace_find(ciwic_workspace *ws, const char *path) {
+    if (ws->index_cap == 0) {
+        return NULL;
+    }
+
+    size_t slot = ciwic_hash64(path, strlen(path), 0) & (ws->index_cap - 1);
+
+    while (ws->index[slot] != 0) {
+        ciwic_workspace_file *file = &ws->files[ws->index[slot] - 1];
+        if (strcmp(file->path, path) == 0) {
+            return file;
+        }
+        slot = (slot + 1) & (ws->index_cap - 1);
+    }
+
+    return NULL;
+}
+
+ciwic_workspace_file *ciwic_workspace_add(ciwic_workspace *ws, char *path) {
+    if (ws->files_len == ws->files_cap) {
+        ws->files_cap = ws->files_cap ? ws->files_cap * 2 : 64;
+        ws->files = realloc(ws->files, sizeof(ciwic_workspace_file) * ws->files_cap);
+    }
+
+    ciwic_workspace_file *file = &ws->files[ws->files_len++];
+    file->path = path;
+    file->text = NULL;
+    file->len = 0;
+    file->exists = 0;
+    file->parsed = 0;
+    file->stop = ciwic_parser_running;
+    file->arenas = NULL;
+    file->arenas_len = 0;
+    file->arenas_cap = 0;
+
+    if (ws->files_len * 2 > ws->index_cap) {
+        free(ws->index);
+        ws->index_cap = ws->index_cap ? ws->index_cap * 2 : 128;
+        ws->index = calloc(ws->index_cap, sizeof(int));
+        for (int i = 0; i < ws->files_len; i++) {
+            ciwic_workspace_index_insert(ws, i);
+        }
+    } else {
+        ciwic_workspace_index_insert(ws, ws->files_len - 1);
+    }
+
+    return file;
+}
+
+// Frees the AST of file
+void ciwic_workspace_free_ast(ciwic_workspace_file *file) {
+    for (int i = 0; i < file->arenas_len; i++) {
+        ciwic_arena_free(&file->arenas[i]);
+    }
+    file->arenas_len = 0;
+    file->parsed = 0;
+}
+
+// Parses the current contents of file. If it was parsed before only the
+// definitions touched by the part that changed are parsed again.
+void ciwic_workspace_parse(ciwic_workspace *ws, ciwic_workspace_file *file, char *text, int len) {
+    ciwic_parser parser = ciwic_parser_new(text, len);
+    parser.limits = ws->limits;
+    ciwic_translation_unit translation_unit;
+    int res;
+    int reparse = file->parsed && file->arenas_len < CIWIC_WORKSPACE_MAX_ARENAS;
+
+    if (reparse) {
+        // Everything between the common prefix and suffix is one edit
+        int prefix = 0;
+        int min = len < file->len ? len : file->len;
+        while (prefix < min && text[prefix] == file->text[prefix]) {
+            prefix++;
+        }
+
+        int suffix = 0;
+        while (suffix < min - prefix && text[len - 1 - suffix] == file->text[file->len - 1 - suffix]) {
+            suffix++;
+        }
+
+        ciwic_edit edit = { prefix, file->len - suffix, len - suffix - prefix };
+        res = ciwic_reparse(&parser, &file->translation_unit, file->text, file->len, &edit, 1, &translation_unit);
+    } else {
+        res = ciwic_parser_translation_unit(&parser, &translation_unit);
+    }
+
+    // Like ciwic_parse, the file only counts as parsed if every definition in
+    // it did
+    if (!res && (ciwic_parser_whitespace(&parser), parser.pos != len)) {
+        res = 1;
+    }
+
+    // The old AST is only needed if the new one shares it
+    if (!reparse || res) {
+        ciwic_workspace_free_ast(file);
+    }
+
+    if (res) {
+        ciwic_arena_free(&parser.arena);
+    } else {
+        if (file->arenas_len == file->arenas_cap) {
+            file->arenas_cap = file->arenas_cap ? file->arenas_cap * 2 : 4;
+            file->arenas = realloc(file->arenas, sizeof(ciwic_arena) * file->arenas_cap);
+        }
+        file->arenas[file->arenas_len++] = parser.arena;
+    }
+
+    free(parser.lines);
+    free(file->text);
+
+    file->text = text;
+    file->len = len;
+    file->exists = 1;
+    file->parsed = !res;
+    file->stop = parser.stop;
+
+    if (!res) {
+        file->translation_unit = translation_unit;
+    }
+}
+
+// Returns 1 if the file did not change
+int ciwic_workspace_update(ciwic_workspace *ws, ciwic_workspace_file *file) {
+    char *text;
+    int len;
+
+    if (ciwic_workspace_read(file->path, &text, &len, &file->mtime)) {
+        file->exists = 0;
+        return 0;
+    }
+
+    if (file->exists && len == file->len && memcmp(text, file->text, len) == 0) {
+        free(text);
+        return 1;
+    }
+
+    ciwic_workspace_parse(ws, file, text, len);
+    return 0;
+}
+
+void ciwic_workspace_watch_dir(ciwic_workspace *ws, const char *dir) {
+    int wd = inotify_add_watch(ws->inotify_fd, dir, CIWIC_WORKSPACE_EVENTS);
+    if (wd < 0) {
+        return;
+    }
+
+    if (ws->watches_len == ws->watches_cap) {
+        ws->watches_cap = ws->watches_cap ? ws->watches_cap * 2 : 16;
+        ws->watches = realloc(ws->watches, sizeof(ciwic_workspace_watch) * ws->watches_cap);
+    }
+
+    ws->watches[ws->watches_len].wd = wd;
+    ws->watches[ws->watches_len].path = strdup(dir);
+    ws->watches_len++;
+}
+
+// Watches dir and parses every source file below it. Returns the number of
+// files that were added.
+int ciwic_workspace_scan(ciwic_workspace *ws, const char *dir, ciwic_workspace_callback callback, void *data) {
+    DIR *d = opendir(dir);
+    if (d == NULL) {
+        return 0;
+    }
+
+    ciwic_workspace_watch_dir(ws, dir);
+
+    struct dirent *ent;
+    int count = 0;
+
+    while ((ent = readdir(d)) != NULL) {
+        if (strcmp(ent->d_name, ".") == 0 || strcmp(ent->d_name, "..") == 0) {
+            continue;
+        }
+
+        char *path = ciwic_workspace_join(dir, ent->d_name);
+        struct stat st;
+
+        if (stat(path, &st)) {
+            free(path);
+        } else if (S_ISDIR(st.st_mode)) {
+            count += ciwic_workspace_scan(ws, path, callback, data);
+            free(path);
+        } else if (S_ISREG(st.st_mode) && ciwic_workspace_is_source(ent->d_name)) {
+            ciwic_workspace_file *file = ciwic_workspace_find(ws, path);
+            if (file == NULL) {
+                file = ciwic_workspace_add(ws, path);
+            } else {
+                free(path);
+            }
+            if (!ciwic_workspace_update(ws, file)) {
+                count++;
+                if (callback != NULL) {
+                    callback(data, file);
+                }
+            }
+        } else {
+            free(path);
+        }
+    }
+
+    closedir(d);
+    return count;
+}
+
+int ciwic_workspace_init(ciwic_workspace *ws) {
+    ws->root = NULL;
+    ws->generation = 0;
+    ws->limits = ciwic_parser_default_limits();
+    ws->files = NULL;
+    ws->files_len = 0;
+    ws->files_cap = 0;
+    ws->index = NULL;
+    ws->index_cap = 0;
+    ws->watches = NULL;
+    ws->watches_len = 0;
+    ws->watches_cap = 0;
+
+    ws->inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (ws->inotify_fd < 0) {
+        return 1;
+    }
+
+    return 0;
+}
+
+int ciwic_workspace_open(ciwic_workspace *ws, const char *root) {
+    if (ciwic_workspace_init(ws)) {
+        return 1;
+    }
+
+    ws->root = strdup(root);
+    ciwic_workspace_scan(ws, root, NULL, NULL);
+    return 0;
+}
+
+ciwic_workspace_file *ciwic_workspace_load(ciwic_workspace *ws, const char *path) {
+    ciwic_workspace_file *file = ciwic_workspace_find(ws, path);
+    struct stat st;
+
+    if (stat(path, &st) || !S_ISREG(st.st_mode)) {
+        if (file != NULL && file->exists) {
+            file->exists = 0;
+            ciwic_workspace_free_ast(file);
+            ws->generation++;
+        }
+        return NULL;
+    }
+
+    if (file != NULL && file->exists && st.st_size == file->len
+            && st.st_mtim.tv_sec == file->mtime.tv_sec && st.st_mtim.tv_nsec == file->mtime.tv_nsec) {
+        return file;
+    }
+
+    if (file == NULL) {
+        file = ciwic_workspace_add(ws, strdup(path));
+    }
+
+    if (!ciwic_workspace_update(ws, file)) {
+        ws->generation++;
+    }
+
+    return file->exists ? file : NULL;
+}
+
+void ciwic_workspace_close(ciwic_workspace *ws) {
+    close(ws->inotify_fd);
+
+    for (int i = 0; i < ws->files_len; i++) {
+        ciwic_workspace_free_ast(&ws->files[i]);
+        free(ws->files[i].path);
+        free(ws->files[i].text);
+        free(ws->files[i].arenas);
+    }
+
+    for (int i = 0; i < ws->watches_len; i++) {
+        free(ws->watches[i].path);
+    }
+
+    free(ws->files);
+    free(ws->index);
+    free(ws->watches);
+    free(ws->root);
+}
+
+ciwic_workspace_watch *ciwic_workspace_find_watch(ciwic_workspace *ws, int wd) {
+    for (int i = 0; i < ws->watches_len; i++) {
+        if (ws->watches[i].wd == wd) {
+            return &ws->watches[i];
+        }
+    }
+    return NULL;
+}
+
+// Handles one event and returns the number of files it changed
+int ciwic_workspace_event(ciwic_workspace *ws, struct inotify_event *event, ciwic_workspace_callback callback, void *data) {
+    ciwic_workspace_watch *watch = ciwic_workspace_find_watch(ws, event->wd);
+
+    if (watch == NULL || event->len == 0) {
+        return 0;
+    }
+
+    char *path = ciwic_workspace_join(watch->path, event->name);
+
+    // New directories are scanned, files in them may have been written
+    // before the watch was added
+    if (event->mask & IN_ISDIR) {
+        int count = 0;
+        if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
+            count = ciwic_workspace_scan(ws, path, callback, data);
+        }
+        free(path);
+        return count;
+    }
+
+    if (!ciwic_workspace_is_source(event->name)) {
+        free(path);
+        return 0;
+    }
+
+    ciwic_workspace_file *file = ciwic_workspace_find(ws, path);
+
+    if (event->mask & (IN_DELETE | IN_MOVED_FROM)) {
+        free(path);
+        if (file == NULL || !file->exists) {
+            return 0;
+        }
+        file->exists = 0;
+        ciwic_workspace_free_ast(file);
+        if (callback != NULL) {
+            callback(data, file);
+        }
+        return 1;
+    }
+
+    // Creating a file is followed by writing it
+    if (event->mask & IN_CREATE) {
+        free(path);
+        return 0;
+    }
+
+    if (file == NULL) {
+        file = ciwic_workspace_add(ws, path);
+    } else {
+        free(path);
+    }
+
+    if (ciwic_workspace_update(ws, file)) {
+        return 0;
+    }
+
+    if (callback != NULL) {
+        callback(data, file);
+    }
+    return 1;
+}
+
+int ciwic_workspace_poll(ciwic_workspace *ws, int timeout, ciwic_workspace_callback callback, void *data) {
+    struct pollfd pfd = { ws->inotify_fd, POLLIN, 0 };
+
+    int res = poll(&pfd, 1, timeout);
+    if (res <= 0) {
+        return res;
+    }
+
+    char buf[65536] __attribute__((aligned(__alignof__(struct inotify_event))));
+    int count = 0;
+    ssize_t len;
+
+    while ((len = read(ws->inotify_fd, buf, sizeof(buf))) > 0) {
+        for (char *p = buf; p < buf + len; ) {
+            struct inotify_event *event = (struct inotify_event *) p;
+            count += ciwic_workspace_event(ws, event, callback, data);
+            p += sizeof(struct inotify_event) + event->len;
+        }
+    }
+
+    if (count > 0) {
+        ws->generation++;
+    }
+
+    return count;
+}
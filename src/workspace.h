@@ -0,0 +1,78 @@
+#pragma once
+
+#include <stdint.h>
+#include <time.h>
+
+#include <parselib.h>
+#include <ast.h>
+
+// Parsed workspace
+//
+// Every .c and .h file below a root directory is parsed once and kept in
+// memory. inotify reports changed files, which are parsed again with
+// ciwic_reparse, so only definitions that changed cost any parsing.
+
+// Every reparse adds an arena to the file. Once it has this many the file is
+// parsed in full, which frees them.
+#define CIWIC_WORKSPACE_MAX_ARENAS 8
+
+typedef struct {
+    char *path;
+    char *text;
+    int len;
+    int exists; // Cleared when the file is deleted
+    struct timespec mtime; // Modification time when text was read
+    int parsed; // Set if translation_unit holds the AST of text
+    ciwic_parser_stop stop; // Why the last parse was stopped, if it was
+    ciwic_translation_unit translation_unit;
+
+    // Arenas holding translation_unit. Definitions that a reparse did not
+    // touch stay in the arena of the parse that created them.
+    ciwic_arena *arenas;
+    int arenas_len;
+    int arenas_cap;
+} ciwic_workspace_file;
+
+typedef struct {
+    int wd;
+    char *path;
+} ciwic_workspace_watch;
+
+typedef struct {
+    char *root; // Can be null
+    int inotify_fd;
+    int generation; // Incremented whenever any file changes
+    ciwic_parser_limits limits; // Applied to the parse of every file
+
+    ciwic_workspace_file *files;
+    int files_len;
+    int files_cap;
+
+    // Open addressing table of file indices plus one, by path
+    int *index;
+    int index_cap;
+
+    ciwic_workspace_watch *watches;
+    int watches_len;
+    int watches_cap;
+} ciwic_workspace;
+
+// Creates an empty workspace. Returns 0 on success.
+int ciwic_workspace_init(ciwic_workspace *ws);
+// Parses every file below root and starts watching it. Returns 0 on success.
+int ciwic_workspace_open(ciwic_workspace *ws, const char *root);
+void ciwic_workspace_close(ciwic_workspace *ws);
+
+// Returns the file at path, reading and parsing it again first if its size
+// or modification time changed. Returns null if it cannot be read.
+ciwic_workspace_file *ciwic_workspace_load(ciwic_workspace *ws, const char *path);
+
+// Called for every file that was added, changed or deleted
+typedef void (*ciwic_workspace_callback)(void *data, ciwic_workspace_file *file);
+
+// Waits up to timeout milliseconds (-1 for ever) for changes and reparses
+// the files that changed. Returns the number of changed files, or -1 on
+// error.
+int ciwic_workspace_poll(ciwic_workspace *ws, int timeout, ciwic_workspace_callback callback, void *data);
+
+ciwic_workspace_file *ciwic_workspace_find(ciwic_workspace *ws, const char *path); // Can be null